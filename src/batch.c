@@ -0,0 +1,631 @@
+#include <allegro.h>
+#ifdef ALLEGRO_WINDOWS
+	#include <winalleg.h>
+	#include <process.h>	//For _wspawnv()
+#else
+	#include <sys/types.h>
+	#include <sys/wait.h>	//For waitpid()
+	#include <unistd.h>		//For fork() and execv()
+#endif
+#include <stdarg.h>
+#include <stdio.h>
+#include "main.h"
+#include "batch.h"
+#include "beat.h"
+#include "bf_import.h"
+#include "chart_import.h"
+#include "gh_import.h"
+#include "midi.h"
+#include "midi_import.h"
+#include "rs.h"
+#include "song.h"
+#include "utility.h"
+#include "foflc/Lyric_storage.h"	//For strcasestr_spec()
+#include "menu/file.h"
+#include "menu/song.h"
+
+#ifdef USEMEMWATCH
+#include "memwatch.h"
+#endif
+
+int eof_batch_mode = 0;
+int eof_batch_logging = 1;
+unsigned long eof_batch_failed = 0;
+
+static int eof_batch_jobs = 0;					//The number of files to convert at a time (0 until the -jobs parameter or the CPU count sets it)
+static int eof_batch_formats = EOF_BATCH_FORMAT_MID | EOF_BATCH_FORMAT_RS2 | EOF_BATCH_FORMAT_EOF;	//The outputs to write for each file
+static char eof_batch_out_path[1024] = {0};	//The folder in which each file's output subfolder is created, or empty to use each input file's folder
+static char **eof_batch_files = NULL;			//The absolute paths of the input files
+static unsigned long eof_batch_file_count = 0;
+
+static void eof_batch_usage(void)
+{
+	(void) fprintf(stderr, "Usage:  eof -batch [-jobs N] [-out folder] [-formats mid,rs2,eof] [-nolog] file [file ...]\n");
+	(void) fprintf(stderr, "Supported input files:  .eof, .mid, .rba, .chart, .pak.*, .rif, Rocksmith/Go PlayAlong .xml, .gp3, .gp4, .gp5\n");
+}
+
+int eof_batch_parse_arguments(int argc, char * argv[])
+{
+	int i;
+	char path[1024] = {0};
+	char *token;
+
+	if(!argv || (argc < 2))
+		return 0;	//Invalid parameters
+
+	eof_batch_files = malloc(sizeof(char *) * (size_t)argc);
+	if(!eof_batch_files)
+		return 0;
+
+	for(i = 2; i < argc; i++)
+	{	//For each parameter after -batch
+		if(!ustricmp(argv[i], "-jobs") && (i + 1 < argc))
+		{
+			i++;
+			eof_batch_jobs = atoi(argv[i]);
+			if(eof_batch_jobs < 1)
+			{
+				(void) fprintf(stderr, "Invalid job count \"%s\"\n", argv[i]);
+				eof_batch_usage();
+				return 0;
+			}
+		}
+		else if(!ustricmp(argv[i], "-out") && (i + 1 < argc))
+		{
+			i++;
+			(void) canonicalize_filename(eof_batch_out_path, argv[i], (int) sizeof(eof_batch_out_path));	//Resolve it now, before the working directory is changed
+		}
+		else if(!ustricmp(argv[i], "-formats") && (i + 1 < argc))
+		{
+			i++;
+			eof_batch_formats = 0;
+			strncpy(path, argv[i], sizeof(path) - 1);
+			for(token = strtok(path, ","); token; token = strtok(NULL, ","))
+			{	//For each comma separated format name
+				if(!ustricmp(token, "mid"))
+				{
+					eof_batch_formats |= EOF_BATCH_FORMAT_MID;
+				}
+				else if(!ustricmp(token, "rs2"))
+				{
+					eof_batch_formats |= EOF_BATCH_FORMAT_RS2;
+				}
+				else if(!ustricmp(token, "eof"))
+				{
+					eof_batch_formats |= EOF_BATCH_FORMAT_EOF;
+				}
+				else if(!ustricmp(token, "chart"))
+				{	//EOF imports Feedback charts but has no exporter for them
+					(void) fprintf(stderr, "Feedback .chart export is not supported, ignoring that format\n");
+				}
+				else
+				{
+					(void) fprintf(stderr, "Unknown output format \"%s\"\n", token);
+					eof_batch_usage();
+					return 0;
+				}
+			}
+			if(!eof_batch_formats)
+			{
+				eof_batch_usage();
+				return 0;
+			}
+		}
+		else if(!ustricmp(argv[i], "-nolog"))
+		{
+			eof_batch_logging = 0;
+		}
+		else if(argv[i][0] == '-')
+		{
+			(void) fprintf(stderr, "Unknown parameter \"%s\"\n", argv[i]);
+			eof_batch_usage();
+			return 0;
+		}
+		else
+		{	//Otherwise it's an input file
+			(void) canonicalize_filename(path, argv[i], (int) sizeof(path));	//Resolve it now, before the working directory is changed
+			eof_batch_files[eof_batch_file_count] = malloc(strlen(path) + 1);
+			if(!eof_batch_files[eof_batch_file_count])
+				return 0;
+			strcpy(eof_batch_files[eof_batch_file_count], path);
+			eof_batch_file_count++;
+		}
+	}
+
+	if(!eof_batch_file_count)
+	{
+		eof_batch_usage();
+		return 0;
+	}
+	if(!eof_batch_jobs)
+	{	//If the job count wasn't specified, use one per core
+		eof_batch_jobs = eof_cpu_count();
+	}
+
+	return 1;
+}
+
+static void eof_batch_close_project(void)
+{
+	if(eof_song)
+	{
+		eof_destroy_song(eof_song);
+		eof_song = NULL;
+	}
+	(void) eof_destroy_ogg();
+	eof_song_loaded = 0;
+	eof_changes = 0;
+}
+
+static int eof_batch_import_pro_guitar(char *fn, char gp)
+{
+	unsigned long track = EOF_TRACK_PRO_GUITAR;	//By default, a track imports to the 17 fret pro guitar track
+	char *name = get_filename(fn);
+	char nfn[1024] = {0};
+
+	//Pick the destination track the same way the command line import pre-selects it in the track dialog
+	if(strcasestr_spec(name, "_bonus"))
+	{
+		track = EOF_TRACK_PRO_GUITAR_B;
+	}
+	else if(strcasestr_spec(name, "_bass"))
+	{
+		track = strstr(name, "_22") ? EOF_TRACK_PRO_BASS_22 : EOF_TRACK_PRO_BASS;
+	}
+	else if(strstr(name, "_22"))
+	{
+		track = EOF_TRACK_PRO_GUITAR_22;
+	}
+
+	eof_song = eof_create_song_populated();
+	if(!eof_song)
+		return 1;	//Return error
+	eof_song_loaded = 1;
+	if(!eof_song_append_beats(eof_song, 1) || !eof_song_append_beats(eof_song, 1))
+	{	//If there was an error adding the two beats the command line import starts with
+		eof_batch_close_project();
+		return 1;	//Return error
+	}
+	(void) eof_menu_track_selected_track_number(track, 1);
+
+	if(gp ? eof_gp_import_common(fn) : eof_rs_import_common(fn))
+	{	//If the import failed
+		eof_batch_close_project();
+		return 1;	//Return error
+	}
+
+	//Use guitar.ogg if it's present, otherwise silent audio
+	(void) replace_filename(eof_song_path, fn, "", 1024);
+	(void) append_filename(nfn, eof_song_path, "guitar.ogg", 1024);
+	(void) eof_load_ogg(nfn, 1);
+
+	return 0;	//Return success
+}
+
+int eof_batch_convert_file(char *fn)
+{
+	char name[1024] = {0}, outfolder[1024] = {0}, temp[1024] = {0};
+	char *ext;
+	unsigned short user_warned = 0xFFFF;	//Mark all Rocksmith export warnings as already given so they aren't prompted for
+	unsigned long ctr;
+	unsigned long rs2tracks[] = {EOF_TRACK_PRO_BASS, EOF_TRACK_PRO_BASS_22, EOF_TRACK_PRO_GUITAR, EOF_TRACK_PRO_GUITAR_22, EOF_TRACK_PRO_GUITAR_B};
+	int retval = 0;
+	char midi_import = 0;
+
+	if(!fn)
+		return 1;	//Invalid parameter
+
+	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Batch converting \"%s\"", fn);
+	eof_log(eof_log_string, 1);
+
+	eof_batch_close_project();
+	(void) replace_filename(eof_song_path, fn, "", 1024);
+	(void) ustrcpy(eof_filename, fn);
+
+	/* import */
+	ext = get_extension(fn);
+	if(!ustricmp(ext, "eof"))
+	{
+		eof_song = eof_load_song(fn);
+		if(eof_song)
+		{	//Load the OGG profile's audio, or silence if it's missing
+			(void) append_filename(temp, eof_song_path, eof_song->tags->ogg[0].filename, 1024);
+			(void) eof_load_ogg(temp, 1);
+		}
+	}
+	else if(!ustricmp(ext, "mid") || !ustricmp(ext, "rba"))
+	{
+		if(!ustricmp(ext, "rba"))
+		{
+			char rbatempname[30] = {0};
+
+			(void) snprintf(rbatempname, sizeof(rbatempname) - 1, "eof_rba_import%03u.tmp", eof_log_id);	//Include this instance's ID so child processes converting files in the same folder don't share the file
+			(void) replace_filename(temp, fn, rbatempname, 1024);
+			if(eof_extract_rba_midi(fn, temp) == 0)
+			{	//If the MIDI was extracted successfully
+				eof_song = eof_import_midi(temp);
+			}
+			(void) delete_file(temp);	//Delete temporary file
+		}
+		else
+		{
+			eof_song = eof_import_midi(fn);
+		}
+		midi_import = 1;	//The MIDI specific cleanup is applied after the common fixup below
+	}
+	else if(!ustricmp(ext, "chart"))
+	{
+		eof_song = eof_import_chart(fn);
+		if(eof_song)
+		{
+			eof_song_enforce_mid_beat_tempo_change_removal();	//Remove mid beat tempo changes if applicable
+		}
+	}
+	else if(strcasestr_spec(fn, ".pak."))
+	{
+		eof_song = eof_import_gh(fn);
+	}
+	else if(!ustricmp(ext, "rif"))
+	{
+		eof_song = eof_load_bf(fn);
+	}
+	else if(!ustricmp(ext, "xml"))
+	{
+		int type = eof_identify_xml(fn);
+
+		if(type == 1)
+		{	//Rocksmith arrangement
+			(void) eof_batch_import_pro_guitar(fn, 0);
+		}
+		else if(type == 2)
+		{	//Go PlayAlong file
+			(void) eof_batch_import_pro_guitar(fn, 1);
+		}
+	}
+	else if(!ustricmp(ext, "gp3") || !ustricmp(ext, "gp4") || !ustricmp(ext, "gp5"))
+	{
+		(void) eof_batch_import_pro_guitar(fn, 1);
+	}
+	else
+	{
+		eof_log("\tUnsupported file type", 1);
+		return 1;	//Return error
+	}
+
+	if(!eof_song)
+	{
+		eof_log("\tImport failed", 1);
+		eof_batch_close_project();
+		return 1;	//Return error
+	}
+
+	/* fixup */
+	eof_song_loaded = 1;
+	eof_init_after_load(0);	//Initialize variables
+	if(!eof_repair_midi_import_grid_snap())
+	{
+		eof_log("\tGrid snap correction failed.", 1);
+	}
+	if(midi_import)
+	{	//Apply the rest of the cleanup a command line MIDI import performs
+		eof_track_fixup_notes(eof_song, EOF_TRACK_VOCALS, 0);
+		eof_song_enforce_mid_beat_tempo_change_removal();	//Remove mid beat tempo changes if applicable
+		(void) eof_detect_difficulties(eof_song, eof_selected_track);
+		eof_determine_phrase_status(eof_song, eof_selected_track);	//Update HOPO statuses
+		eof_detect_mid_measure_ts_changes();
+		eof_beat_stats_cached = 0;
+	}
+
+	/* export, into a folder named after the input file */
+	(void) ustrcpy(name, get_filename(fn));
+	ext = get_extension(name);
+	if((ext > name) && (ext[-1] == '.'))
+	{	//Drop the extension
+		ext[-1] = '\0';
+	}
+	if(eof_batch_out_path[0] != '\0')
+	{
+		(void) append_filename(outfolder, eof_batch_out_path, name, (int) sizeof(outfolder));
+	}
+	else
+	{
+		(void) replace_filename(outfolder, fn, name, (int) sizeof(outfolder));
+	}
+	if(!eof_folder_exists(outfolder) && eof_mkdir(outfolder))
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCould not create output folder \"%s\"", outfolder);
+		eof_log(eof_log_string, 1);
+		eof_batch_close_project();
+		return 1;	//Return error
+	}
+	put_backslash(outfolder);
+
+	if(eof_batch_formats & EOF_BATCH_FORMAT_MID)
+	{
+		(void) append_filename(temp, outfolder, "notes.mid", (int) sizeof(temp));
+		if(!eof_export_midi(eof_song, temp, 0, 0, 0, 0))
+		{
+			eof_log("\tMIDI export failed", 1);
+			retval = 1;
+		}
+	}
+	if(eof_batch_formats & EOF_BATCH_FORMAT_RS2)
+	{
+		(void) append_filename(temp, outfolder, "xmlpath.xml", (int) sizeof(temp));	//The exporter names each file after its arrangement
+		for(ctr = 0; ctr < sizeof(rs2tracks) / sizeof(unsigned long); ctr++)
+		{	//For each pro guitar/bass track
+			if(!eof_get_track_size(eof_song, rs2tracks[ctr]))
+				continue;	//Skip empty tracks
+
+			if(eof_export_rocksmith_2_track(eof_song, temp, rs2tracks[ctr], &user_warned) != 1)
+			{
+				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tRS2 export of \"%s\" failed", eof_song->track[rs2tracks[ctr]]->name);
+				eof_log(eof_log_string, 1);
+				retval = 1;
+			}
+		}
+	}
+	if(eof_batch_formats & EOF_BATCH_FORMAT_EOF)
+	{
+		(void) snprintf(temp, sizeof(temp) - 1, "%s%s.eof", outfolder, name);
+		if(!eof_save_song(eof_song, temp))
+		{
+			eof_log("\tProject save failed", 1);
+			retval = 1;
+		}
+	}
+
+	eof_batch_close_project();
+	return retval;
+}
+
+#ifdef ALLEGRO_WINDOWS
+	typedef HANDLE EOF_BATCH_CHILD;
+#else
+	typedef pid_t EOF_BATCH_CHILD;
+#endif
+
+static int eof_batch_spawn(char *exe, char *fn, EOF_BATCH_CHILD *child)
+{
+	char formats[20] = {0};
+	char *childargv[11];
+	int argc = 0;
+
+	//Rebuild the -formats parameter from the parsed formats
+	if(eof_batch_formats & EOF_BATCH_FORMAT_MID)
+		(void) strncat(formats, "mid,", sizeof(formats) - strlen(formats) - 1);
+	if(eof_batch_formats & EOF_BATCH_FORMAT_RS2)
+		(void) strncat(formats, "rs2,", sizeof(formats) - strlen(formats) - 1);
+	if(eof_batch_formats & EOF_BATCH_FORMAT_EOF)
+		(void) strncat(formats, "eof,", sizeof(formats) - strlen(formats) - 1);
+	if(formats[0] != '\0')
+		formats[strlen(formats) - 1] = '\0';	//Drop the trailing comma
+
+	childargv[argc++] = exe;
+	childargv[argc++] = "-batch";
+	childargv[argc++] = "-jobs";
+	childargv[argc++] = "1";
+	childargv[argc++] = "-nolog";	//Don't let the children overwrite each other's log file
+	childargv[argc++] = "-formats";
+	childargv[argc++] = formats;
+	if(eof_batch_out_path[0] != '\0')
+	{
+		childargv[argc++] = "-out";
+		childargv[argc++] = eof_batch_out_path;
+	}
+	childargv[argc++] = fn;
+	childargv[argc] = NULL;
+
+	#ifdef ALLEGRO_WINDOWS
+	{	//The spawned process' command line is the parameters joined with spaces, so each one is quoted, and converted to wide characters to support Unicode paths
+		wchar_t wexe[1024] = {0};
+		wchar_t wargs[11][1024] = {{0}};
+		wchar_t *wargv[11] = {NULL};
+		char quoted[1030] = {0};
+		intptr_t handle;
+		int i;
+
+		(void) uconvert(exe, U_UTF8, (char *)(&wexe[0]), U_UNICODE, (int) sizeof(wexe));
+		for(i = 0; i < argc; i++)
+		{
+			(void) snprintf(quoted, sizeof(quoted) - 1, "\"%s\"", childargv[i]);
+			(void) uconvert(quoted, U_UTF8, (char *)(&wargs[i][0]), U_UNICODE, (int) sizeof(wargs[i]));
+			wargv[i] = wargs[i];
+		}
+		handle = _wspawnv(_P_NOWAIT, wexe, (const wchar_t * const *)wargv);
+		if(handle == -1)
+			return 0;	//Return failure
+		*child = (HANDLE)handle;
+	}
+	#else
+	{
+		pid_t pid = fork();
+
+		if(pid < 0)
+			return 0;	//Return failure
+		if(pid == 0)
+		{	//This is the child process
+			(void) execv(exe, childargv);
+			_exit(127);	//The exec failed
+		}
+		*child = pid;
+	}
+	#endif
+
+	return 1;	//Return success
+}
+
+static int eof_batch_wait(EOF_BATCH_CHILD *children, unsigned long count, int *succeeded)
+{
+	#ifdef ALLEGRO_WINDOWS
+		DWORD ret, code = 1;
+
+		ret = WaitForMultipleObjects((DWORD)count, children, FALSE, INFINITE);
+		if((ret < WAIT_OBJECT_0) || (ret >= WAIT_OBJECT_0 + count))
+			return -1;	//Return error
+		ret -= WAIT_OBJECT_0;
+		(void) GetExitCodeProcess(children[ret], &code);
+		(void) CloseHandle(children[ret]);
+		*succeeded = (code == 0);
+		return (int)ret;
+	#else
+		int status = 0;
+		unsigned long ctr;
+		pid_t pid = waitpid(-1, &status, 0);
+
+		if(pid <= 0)
+			return -1;	//Return error
+		for(ctr = 0; ctr < count; ctr++)
+		{	//Find which child exited
+			if(children[ctr] == pid)
+			{
+				*succeeded = (WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+				return (int)ctr;
+			}
+		}
+		return -1;	//Return error
+	#endif
+}
+
+static unsigned long eof_batch_convert_in_children(void)
+{
+	char exe[1024] = {0};
+	EOF_BATCH_CHILD *children;
+	unsigned long *childfile, running = 0, next = 0, failed = 0, jobs = (unsigned long)eof_batch_jobs;
+	int slot, succeeded = 0;
+
+	#ifdef ALLEGRO_WINDOWS
+		if(jobs > MAXIMUM_WAIT_OBJECTS)
+			jobs = MAXIMUM_WAIT_OBJECTS;	//The most processes that can be waited on at once
+	#endif
+	children = malloc(sizeof(EOF_BATCH_CHILD) * jobs);
+	childfile = malloc(sizeof(unsigned long) * jobs);
+	if(!children || !childfile)
+	{
+		free(children);
+		free(childfile);
+		return eof_batch_file_count;
+	}
+	get_executable_name(exe, 1024);
+
+	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tConverting %lu files with up to %lu processes", eof_batch_file_count, jobs);
+	eof_log(eof_log_string, 1);
+	while((next < eof_batch_file_count) || running)
+	{	//Until every file has been converted
+		while((running < jobs) && (next < eof_batch_file_count))
+		{	//Start another child for each free job
+			if(!eof_batch_spawn(exe, eof_batch_files[next], &children[running]))
+			{
+				(void) printf("Failed:  %s (could not start process)\n", eof_batch_files[next]);
+				failed++;
+			}
+			else
+			{
+				childfile[running] = next;
+				running++;
+			}
+			next++;
+		}
+		if(!running)
+			break;
+
+		slot = eof_batch_wait(children, running, &succeeded);
+		if(slot < 0)
+		{	//If the children can no longer be waited on, count the rest as failed
+			failed += running + eof_batch_file_count - next;
+			break;
+		}
+		if(!succeeded)
+		{	//The child prints its own result unless it crashed, but it's counted here either way
+			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tConversion of \"%s\" failed", eof_batch_files[childfile[slot]]);
+			eof_log(eof_log_string, 1);
+			failed++;
+		}
+		running--;
+		children[slot] = children[running];	//Move the last child into the freed slot
+		childfile[slot] = childfile[running];
+	}
+
+	free(children);
+	free(childfile);
+	return failed;
+}
+
+int eof_batch_convert(void)
+{
+	unsigned long ctr;
+
+	(void) eof_validate_temp_folder();
+	if((eof_batch_jobs > 1) && (eof_batch_file_count > 1))
+	{	//Each file is converted by its own process, so EOF's global project state isn't shared and a crash only fails that file
+		eof_batch_failed = eof_batch_convert_in_children();
+	}
+	else
+	{
+		for(ctr = 0; ctr < eof_batch_file_count; ctr++)
+		{	//For each input file
+			if(eof_batch_convert_file(eof_batch_files[ctr]))
+			{
+				(void) printf("Failed:  %s\n", eof_batch_files[ctr]);
+				eof_batch_failed++;
+			}
+			else
+			{
+				(void) printf("Converted:  %s\n", eof_batch_files[ctr]);
+			}
+			(void) fflush(stdout);
+		}
+	}
+
+	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Batch conversion complete:  %lu of %lu files failed", eof_batch_failed, eof_batch_file_count);
+	eof_log(eof_log_string, 1);
+
+	for(ctr = 0; ctr < eof_batch_file_count; ctr++)
+	{
+		free(eof_batch_files[ctr]);
+	}
+	free(eof_batch_files);
+	eof_batch_files = NULL;
+	eof_batch_file_count = 0;
+
+	return (int)eof_batch_failed;
+}
+
+int eof_alert(const char *s1, const char *s2, const char *s3, const char *b1, const char *b2, int c1, int c2)
+{
+	char buffer[1024] = {0};	//The prompt text is often built in eof_log_string, so it's logged from a separate buffer
+
+	if(!eof_batch_mode)
+		return alert(s1, s2, s3, b1, b2, c1, c2);
+
+	(void) snprintf(buffer, sizeof(buffer) - 1, "\tBatch prompt \"%s %s %s\" answered with \"%s\"", s1 ? s1 : "", s2 ? s2 : "", s3 ? s3 : "", b1 ? b1 : "");
+	eof_log(buffer, 1);
+	return 1;	//Take the first choice on behalf of the user
+}
+
+int eof_alert3(const char *s1, const char *s2, const char *s3, const char *b1, const char *b2, const char *b3, int c1, int c2, int c3)
+{
+	if(!eof_batch_mode)
+		return alert3(s1, s2, s3, b1, b2, b3, c1, c2, c3);
+
+	return eof_alert(s1, s2, s3, b1, b2, c1, c2);
+}
+
+void eof_message(const char *format, ...)
+{
+	char buffer[1024] = {0};
+	va_list args;
+
+	va_start(args, format);
+	(void) vsnprintf(buffer, sizeof(buffer) - 1, format, args);
+	va_end(args);
+
+	if(!eof_batch_mode)
+	{
+		allegro_message("%s", buffer);
+		return;
+	}
+
+	eof_log(buffer, 1);
+	(void) fprintf(stderr, "%s\n", buffer);
+}
@@ -0,0 +1,29 @@
+#ifndef EOF_BATCH_H
+#define EOF_BATCH_H
+
+#define EOF_BATCH_FORMAT_MID	1
+#define EOF_BATCH_FORMAT_RS2	2
+#define EOF_BATCH_FORMAT_EOF	4
+
+extern int eof_batch_mode;				//Set to nonzero if EOF is launched with the -batch parameter to convert files without initializing graphics, sound or input
+extern int eof_batch_logging;			//Set to zero by the -nolog batch parameter (given to child processes so they don't all write to the same log file)
+extern unsigned long eof_batch_failed;	//The number of input files that could not be converted, used to set the program's exit code
+
+int eof_batch_parse_arguments(int argc, char * argv[]);
+	//Parses the batch conversion parameters that follow -batch on the command line:
+	//	-jobs N      Converts up to N files at a time, each in its own EOF process (defaults to the number of CPU cores)
+	//	-out folder  Writes each file's output to a subfolder of this folder named after the input file (defaults to the input file's folder)
+	//	-formats x   A comma separated list of the outputs to write:  mid, rs2 and/or eof (defaults to all of them)
+	//	-nolog       Disables logging
+	//Every other parameter is taken as an input file, and relative paths are resolved against the current working directory
+	//This is called before EOF changes the working directory to its program folder
+	//Returns zero and prints the usage to stderr if the parameters are invalid
+int eof_batch_convert(void);
+	//Converts each input file given to eof_batch_parse_arguments(), spawning child EOF processes when more than one job is allowed
+	//Prints one status line per file to stdout and returns the number of files that failed to convert
+int eof_batch_convert_file(char *fn);
+	//Imports the specified file into a new project with the same importers and cleanup as the command line/GUI imports,
+	// writes the selected output formats and closes the project
+	//Returns zero on success
+
+#endif
@@ -13,6 +13,8 @@
 #endif
 
 int eof_beat_stats_cached = 0;	//Tracks whether the cached statistics for the projects beats is current (should be reset after each load, import, undo, redo or beat operation)
+EOF_SONG *eof_beat_stats_song = NULL;	//Tracks which project the cached beat statistics were built for
+unsigned long eof_beat_stats_beats = 0;	//Tracks the number of beats the project had when the cached beat statistics were built
 
 ///Disabled for now until a more useful purpose for this feature is developed
 int eof_skip_mid_beats_in_measure_numbering = 0;	//Tracks whether beats inserted for mid beat tempo or TS changes should be ignored when counting beats and measures
@@ -21,7 +23,7 @@ int eof_skip_mid_beats_in_measure_numbering = 0;	//Tracks whether beats inserted
 
 unsigned long eof_get_beat(EOF_SONG * sp, unsigned long pos)
 {
-	unsigned long i;
+	unsigned long first, last, mid;
 
 //	eof_log("eof_get_beat() entered", 2);
 
@@ -41,22 +43,23 @@ unsigned long eof_get_beat(EOF_SONG * sp, unsigned long pos)
 	{
 		return ULONG_MAX;
 	}
-	if(sp->beats < 1)
-	{	//This is not a valid beat count
-		return ULONG_MAX;
-	}
-	for(i = 1; i < sp->beats; i++)
-	{	//For each beat after the first
-		if(sp->beat[i]->pos > pos)
+
+	//Binary search for the first beat that is after the specified position, the beat before it contains the position
+	first = 1;
+	last = sp->beats;
+	while(first < last)
+	{	//Until the search range is narrowed to one beat
+		mid = first + (last - first) / 2;
+		if(sp->beat[mid]->pos > pos)
 		{	//If this beat is after the specified position
-			return i - 1;	//If is within the previous beat
+			last = mid;		//The target is at or before this beat
+		}
+		else
+		{
+			first = mid + 1;	//The target is after this beat
 		}
 	}
-	if(pos >= sp->beat[sp->beats - 1]->pos)
-	{
-		return sp->beats - 1;
-	}
-	return 0;
+	return first - 1;	//The position is within the beat before the first one that is after it (or within the last beat)
 }
 
 unsigned long eof_get_nearest_beat(EOF_SONG * sp, unsigned long pos)
@@ -273,12 +276,12 @@ int eof_detect_tempo_map_corruption(EOF_SONG *sp, int report)
 
 			if(sp->tags->tempo_map_locked)
 			{	//If the chart's tempo map is locked
-				allegro_message("%s\n\nHowever the tempo map is locked.  To correct this, disable the \"Song>Lock tempo map\" option and re-run this check with \"Beat>Validate tempo map\".", eof_log_string);
+				eof_message("%s\n\nHowever the tempo map is locked.  To correct this, disable the \"Song>Lock tempo map\" option and re-run this check with \"Beat>Validate tempo map\".", eof_log_string);
 				break;
 			}
 			else
 			{
-				if(alert(eof_log_string, NULL, "Recreate tempo changes based on beat positions?", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert(eof_log_string, NULL, "Recreate tempo changes based on beat positions?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opts to correct the tempo map
 					eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 					if(sp->beat[0]->pos != sp->tags->ogg[0].midi_offset)
@@ -298,7 +301,7 @@ int eof_detect_tempo_map_corruption(EOF_SONG *sp, int report)
 
 	if(!corrupt && report)
 	{
-		allegro_message("Tempo map is valid");
+		eof_message("Tempo map is valid");
 	}
 
 	return 1;
@@ -602,6 +605,7 @@ EOF_BEAT_MARKER * eof_song_add_beat(EOF_SONG * sp)
 			sp->beat[sp->beats]->contains_end_event = 0;
 			sp->beat[sp->beats]->has_ts = 0;
 			sp->beats++;
+			eof_beat_stats_cached = 0;	//Mark the cached beat stats as not current
 			return sp->beat[sp->beats - 1];
 		}
 	}
@@ -627,6 +631,7 @@ void eof_song_delete_beat(EOF_SONG * sp, unsigned long beat)
 			sp->beat[i] = sp->beat[i + 1];
 		}
 		sp->beats--;
+		eof_beat_stats_cached = 0;	//Mark the cached beat stats as not current
 	}
 }
 
@@ -722,7 +727,7 @@ void eof_double_tempo(EOF_SONG * sp, unsigned long beat, char *undo_made)
 		if(eof_song_add_beat(sp) == NULL)
 		{	//If a new beat couldn't be created
 			(void) eof_undo_apply();	//Undo this failed operation
-			allegro_message("Failed to double tempo.  Operation canceled.");
+			eof_message("Failed to double tempo.  Operation canceled.");
 			return;
 		}
 		for(i = sp->beats - 1; i > beat; i--)
@@ -952,6 +957,18 @@ void eof_process_beat_statistics(EOF_SONG * sp, unsigned long track)
 	}
 
 	eof_beat_stats_cached = 1;
+	eof_beat_stats_song = sp;
+	eof_beat_stats_beats = sp->beats;
+}
+
+int eof_beat_stats_valid(EOF_SONG *sp)
+{
+	if(!sp || !eof_beat_stats_cached || (eof_beat_stats_song != sp))
+		return 0;	//The cached beat statistics don't describe this project
+	if(!sp->beats || (eof_beat_stats_beats != sp->beats))
+		return 0;	//Beats were added or removed since the statistics were built
+
+	return 1;
 }
 
 double eof_get_distance_in_beats(EOF_SONG *sp, unsigned long pos1, unsigned long pos2)
@@ -1023,7 +1040,7 @@ void eof_detect_mid_measure_ts_changes(void)
 		eof_beat_stats_cached = 0;
 		eof_seek_and_render_position(eof_selected_track, eof_note_type, eof_song->beat[eof_selected_beat]->pos);	//seek to the beat in question and render
 
-		allegro_message("%lu measures are interrupted by a time signature change.\nThis can cause problems in some rhythm games.\nSuggested T/S for this one is %d/%u.", mid_change_count, suggested_num, suggested_den);
+		eof_message("%lu measures are interrupted by a time signature change.\nThis can cause problems in some rhythm games.\nSuggested T/S for this one is %d/%u.", mid_change_count, suggested_num, suggested_den);
 	}
 }
 
@@ -1125,6 +1142,7 @@ void eof_remove_ts(unsigned long beatnum)
 	flags &= ~0xFF000000;	//Clear any custom TS numerator
 	flags &= ~0x00FF0000;	//Clear any custom TS denominator
 	eof_song->beat[beatnum]->flags = flags;
+	eof_beat_stats_cached = 0;	//Mark the cached beat stats as not current
 }
 
 int eof_check_for_anchors_between_selected_beat_and_seek_pos(void)
@@ -181,7 +181,7 @@ int eof_export_bandfuse(EOF_SONG * sp, char * fn, unsigned short *user_warned)
 					{	//Don't warn about missing FHPs in bass arrangements if user disabled that preference
 						if((*user_warned & 1) == 0)
 						{	//If the user wasn't alerted that one or more track difficulties have no fret hand positions defined
-							allegro_message("Warning (BF):  At least one track difficulty (including one in \"%s\") has no fret hand positions defined.  They will be created automatically.", sp->track[ctr]->name);
+							eof_message("Warning (BF):  At least one track difficulty (including one in \"%s\") has no fret hand positions defined.  They will be created automatically.", sp->track[ctr]->name);
 							*user_warned |= 1;
 						}
 					}
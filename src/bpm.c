@@ -1,4 +1,5 @@
 #include <alogg.h>
+#include "pcm.h"
 #include "minibpm-1.0/src/minibpm-c.h"
 
 static MiniBPMState eof_bpm_estimator_state;
@@ -23,27 +24,59 @@ static void eof_bpm_estimator_callback(void * buffer, int nsamples, int stereo)
 	minibpm_process(eof_bpm_estimator_state, eof_bpm_estimator_buffer, nsamples / iter);
 }
 
-double eof_estimate_bpm(ALOGG_OGG * ogg, double startpoint, double endpoint)
+double eof_estimate_bpm(const char *oggfilename, double startpoint, double endpoint)
 {
 	double bpm = 0.0;
+	EOF_PCM_CACHE_ENTRY *pcm;
+	unsigned short *data;
+	unsigned short buffer[1024];
+	unsigned long channels, startsample, endsample, index, ctr;
 
-	if(!ogg)
+	if(!oggfilename)
 		return 0.0;
 
 	if(startpoint > endpoint)	//If the start and end points are defined out of order
 		startpoint = endpoint;	//Analyze the entire audio file
 
-	eof_bpm_estimator_state = minibpm_new((float)alogg_get_wave_freq_ogg(ogg));
+	pcm = eof_pcm_cache_acquire(oggfilename);	//Use the decoded audio shared with the waveform graph and spectrogram instead of decoding the OGG again
+	if(!pcm)
+		return 0.0;
+	if(pcm->audio->bits != 16)
+	{	//Unexpected sample size
+		eof_pcm_cache_release(pcm);
+		return 0.0;
+	}
+
+	channels = pcm->audio->stereo ? 2 : 1;
+	data = (unsigned short *)pcm->audio->data;
+	startsample = startpoint * pcm->audio->freq;
+	if(startsample > pcm->audio->len)
+		startsample = pcm->audio->len;
+	endsample = pcm->audio->len;
+	if(startpoint != endpoint)
+	{	//If only a time range of the audio is to be analyzed
+		if(endpoint * pcm->audio->freq < endsample)
+			endsample = endpoint * pcm->audio->freq;
+	}
+	eof_bpm_estimator_state = minibpm_new((float)pcm->audio->freq);
 	if(eof_bpm_estimator_state)
 	{
 		eof_bpm_estimator_buffer = malloc(sizeof(float) * 1024); // 1024 mono floating point samples
 		if(eof_bpm_estimator_buffer)
 		{
-			(void) alogg_process_ogg(ogg, eof_bpm_estimator_callback, 1024, startpoint, endpoint);
+			for(index = startsample * channels; index < endsample * channels; index += 1024)
+			{	//For each block of 1024 samples in the range being analyzed
+				for(ctr = 0; ctr < 1024; ctr++)
+				{
+					buffer[ctr] = (index + ctr < endsample * channels) ? data[index + ctr] : 0x8000;	//Pad the last block with silent audio
+				}
+				eof_bpm_estimator_callback(buffer, 1024, pcm->audio->stereo);
+			}
 			bpm = minibpm_estimate_tempo(eof_bpm_estimator_state);
 			free(eof_bpm_estimator_buffer);
 		}
 		minibpm_delete(eof_bpm_estimator_state);
 	}
+	eof_pcm_cache_release(pcm);
 	return bpm;
 }
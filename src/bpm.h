@@ -1,10 +1,8 @@
 #ifndef EOF_BPM_H
 #define EOF_BPM_H
 
-#include <alogg.h>
-
-double eof_estimate_bpm(ALOGG_OGG * ogg, double startpoint, double endpoint);
-	//Uses MiniBPM to estimate the tempo of some/all of the specified audio
+double eof_estimate_bpm(const char *oggfilename, double startpoint, double endpoint);
+	//Uses MiniBPM to estimate the tempo of some/all of the specified OGG file, using its decoded PCM data from the PCM cache
 	//If startpoint is less than endpoint (each is a timestamp measured in seconds), that time range the entire audio file is analyzed
 	// otherwise the entire audio file is analyzed
 
@@ -92,8 +92,7 @@ static double chartpos_to_msec(struct FeedbackChart * chart, unsigned long chart
 					*gridsnap = 1;	//Signal this to the calling function
 					if(eof_log_level > 1)
 					{
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDetected grid snap of chartpos %lu is %lu / %lu", chartpos, ctr, interval);
-						eof_log(eof_log_string, 3);
+						eof_logf(3, "\t\tDetected grid snap of chartpos %lu is %lu / %lu", chartpos, ctr, interval);
 					}
 					break;			//Stop checking instances of this grid snap
 				}
@@ -139,8 +138,7 @@ static double chartpos_to_msec(struct FeedbackChart * chart, unsigned long chart
 
 			if(eof_log_level > 1)
 			{
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tTarget position is between anchors, adding %fms", partial_beat);
-				eof_log(eof_log_string, 3);
+				eof_logf(3, "\t\tTarget position is between anchors, adding %fms", partial_beat);
 			}
 			curpos += partial_beat;
 			break;
@@ -149,15 +147,13 @@ static double chartpos_to_msec(struct FeedbackChart * chart, unsigned long chart
 		if(eof_log_level > 1)
 		{
 			anchorctr++;
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tdB Anchor #%lu: Chartpos = %lu  BPM = %lu  TS = %d/%d  ms pos = %lu beat length = %f,  Detected pos = %fms", anchorctr, current_anchor->chartpos, current_anchor->BPM, current_anchor->TSN, current_anchor->TSD, current_anchor->usec, beat_length, curpos);
-			eof_log(eof_log_string, 3);
+			eof_logf(3, "\t\tdB Anchor #%lu: Chartpos = %lu  BPM = %lu  TS = %d/%d  ms pos = %lu beat length = %f,  Detected pos = %fms", anchorctr, current_anchor->chartpos, current_anchor->BPM, current_anchor->TSN, current_anchor->TSD, current_anchor->usec, beat_length, curpos);
 		}
 		current_anchor = current_anchor->next;
 	}
 	if(eof_log_level > 1)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tFinal converted realtime is %fms", curpos);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "\t\tFinal converted realtime is %fms", curpos);
 	}
 	return curpos;
 }
@@ -210,8 +206,7 @@ void eof_chart_import_process_note_markers(EOF_SONG *sp, unsigned long track, un
 				flags = eof_get_note_flags(sp, track, ctr3) ^ EOF_NOTE_FLAG_F_HOPO;	//Toggle the forced HOPO flag for this note
 				eof_set_note_flags(sp, track, ctr3, flags);
 				mpos = eof_get_note_midi_pos(sp, track, ctr3);
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tNote #%lu:  Diff = %d  Chartpos = %lu  Pos = %lums:  Toggling HOPO status to %s", ctr3, type, mpos, pos2, ((flags & EOF_NOTE_FLAG_F_HOPO) ? "ON" : "OFF"));
-				eof_log(eof_log_string, 2);
+				eof_logf(2, "\t\t\tNote #%lu:  Diff = %d  Chartpos = %lu  Pos = %lums:  Toggling HOPO status to %s", ctr3, type, mpos, pos2, ((flags & EOF_NOTE_FLAG_F_HOPO) ? "ON" : "OFF"));
 			}
 		}
 		eof_track_delete_note(sp, track, ctr2 - 1);	//Delete the HOPO marker gem
@@ -240,8 +235,7 @@ void eof_chart_import_process_note_markers(EOF_SONG *sp, unsigned long track, un
 			{	//If this note is within the span of the slider notation, is in the same difficulty and isn't the slider marker gem itself
 				unsigned long mpos = eof_get_note_midi_pos(sp, track, ctr3);
 				eof_set_note_flags(sp, track, ctr3, (eof_get_note_flags(sp, track, ctr3) | EOF_GUITAR_NOTE_FLAG_IS_SLIDER));	//Set the slider flag for this note
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tNote #%lu:  Diff = %d  Chartpos = %lu  Pos = %lums:  Enabling slider status", ctr3, type, mpos, pos2);
-				eof_log(eof_log_string, 2);
+				eof_logf(2, "\t\t\tNote #%lu:  Diff = %d  Chartpos = %lu  Pos = %lums:  Enabling slider status", ctr3, type, mpos, pos2);
 			}
 		}
 		eof_track_delete_note(sp, track, ctr2 - 1);	//Delete the slider marker gem
@@ -300,7 +294,7 @@ EOF_SONG * eof_import_chart(const char * fn)
 	if(chart == NULL)
 	{	//Import failed
 		(void) snprintf(oggfn, sizeof(oggfn) - 1, "Error:  %s", eof_chart_import_return_code_list[err % 31]);	//Display the appropriate error
-		(void) alert("Error:", NULL, eof_chart_import_return_code_list[err % 31], "OK", NULL, 0, KEY_ENTER);
+		(void) eof_alert("Error:", NULL, eof_chart_import_return_code_list[err % 31], "OK", NULL, 0, KEY_ENTER);
 		return NULL;
 	}
 	threshold = (chart->resolution * (66.0 / 192.0)) + 0.5;	//This is the tick distance at which notes become forced strums instead of HOPOs (66/192 beat or further)
@@ -493,7 +487,7 @@ EOF_SONG * eof_import_chart(const char * fn)
 	if(chart->guitartypes > 2)
 	{	//If the imported chart file has both normal AND GHL guitar tracks
 		eof_clear_input();
-		if(alert(NULL, "The imported file has both normal and GHL guitar parts.  Import which parts??", NULL, "&Normal", "&GHL", 'n', 'g') == 2)
+		if(eof_alert(NULL, "The imported file has both normal and GHL guitar parts.  Import which parts??", NULL, "&Normal", "&GHL", 'n', 'g') == 2)
 		{	//If the user opts to import the GHL parts
 			eof_log("\t\tImporting GHL guitar and skipping normal guitar", 1);
 			importguitartypes = 2;
@@ -507,7 +501,7 @@ EOF_SONG * eof_import_chart(const char * fn)
 	if(chart->basstypes > 2)
 	{	//If the imported chart file has both normal AND GHL bass tracks
 		eof_clear_input();
-		if(alert(NULL, "The imported file has both normal and GHL bass parts.  Import which parts??", NULL, "&Normal", "&GHL", 'n', 'g') == 2)
+		if(eof_alert(NULL, "The imported file has both normal and GHL bass parts.  Import which parts??", NULL, "&Normal", "&GHL", 'n', 'g') == 2)
 		{	//If the user opts to import the GHL parts
 			eof_log("\t\tImporting GHL bass and skipping normal bass", 1);
 			importbasstypes = 2;
@@ -637,8 +631,7 @@ EOF_SONG * eof_import_chart(const char * fn)
 			tracknum = sp->track[track]->tracknum;
 			tp = sp->legacy_track[tracknum];
 
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tTrack:  \"%s\" difficulty %d", sp->track[track]->name, difficulty);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\t\tTrack:  \"%s\" difficulty %d", sp->track[track]->name, difficulty);
 
 			if((current_track->isguitar > 1) || (current_track->isbass > 1))
 			{	//If this is a GHL guitar or bass track, configure the track accordingly
@@ -809,11 +802,8 @@ EOF_SONG * eof_import_chart(const char * fn)
 						}
 						else if(!limit_warned)
 						{	//If the note failed to be created
-							if((tp->notes == EOF_MAX_NOTES) && !limit_warned)
-							{	//The note limit was reached, and the user wasn't warned about this yet
-								allegro_message("Warning:  At least one instrument track being imported exceeds EOF's note limit and cannot be imported in its entirety.  You can try to work around this by importing a copy of the chart that has had one or more other difficulties deleted from it.");
-								limit_warned = 1;
-							}
+							eof_message("Warning:  At least one instrument track being imported could not be allocated in its entirety.");	//Note arrays grow as needed, so this only happens when memory runs out
+							limit_warned = 1;
 						}
 					}
 					else
@@ -840,10 +830,9 @@ EOF_SONG * eof_import_chart(const char * fn)
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tTrack notes imported (import currently at %.2f seconds)", (((double)cur_time - (double)start_time) / CLOCKS_PER_SEC));
 			eof_log(eof_log_string, 1);
 
-			eof_chart_import_process_note_markers(sp, track, difficulty);	//Process and remove toggle HOPO and slider marker gems where applicable so they no longer count against the track's note limit
+			eof_chart_import_process_note_markers(sp, track, difficulty);	//Process and remove toggle HOPO and slider marker gems where applicable so they aren't left in the track as notes
 
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tImported track difficulty:  %lu notes created, %lu gems combined to form chords", notes_created, notes_combined);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\t\tImported track difficulty:  %lu notes created, %lu gems combined to form chords", notes_created, notes_combined);
 
 			//Apply HOPO status to notes within the threshold
 			for(ctr = 0, prev_note = NULL; ctr < tp->notes; ctr++)
@@ -955,7 +944,7 @@ EOF_SONG * eof_import_chart(const char * fn)
 				eof_log("\t\t\t\t!This section is being added as a floating (off-beat) text event", 1);
 				if(!event_realignment_warning)
 				{	//If the user wasn't warned about this yet
-					allegro_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
+					eof_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
 					event_realignment_warning = 1;
 				}
 				flags = EOF_EVENT_FLAG_FLOATING_POS;	//The call to eof_song_add_text_event() will receive this as a floating text event
@@ -1064,8 +1053,7 @@ EOF_SONG * eof_import_chart(const char * fn)
 					length++;	//Increase the slider length by 1ms to better avoid special cases where the note will quantize to be outside the slider during MIDI export
 				}
 				end = eof_get_note_pos(sp, ctr, ctr2) + length;	//Track the end position of this run of slider notes
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tCreating slider section from %lums to %lums", start, end);
-				eof_log(eof_log_string, 2);
+				eof_logf(2, "\t\t\tCreating slider section from %lums to %lums", start, end);
 				(void) eof_track_add_section(sp, ctr, EOF_SLIDER_SECTION, 0xFF, start, end, 0, NULL);	//Add the slider phrase
 			}
 		}
@@ -1397,8 +1385,7 @@ struct FeedbackChart *ImportFeedback(const char *filename, int *error)
 			}
 			if(currentsection == 4)
 			{	//If this was an instrument track
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tParsed instrument section \"%s\":  %lu gems", curtrack->trackname, gemcount);
-				eof_log(eof_log_string, 2);
+				eof_logf(2, "\tParsed instrument section \"%s\":  %lu gems", curtrack->trackname, gemcount);
 			}
 			currentsection=0;
 			continue;							//Skip ahead to the next line
@@ -1998,8 +1985,7 @@ struct FeedbackChart *ImportFeedback(const char *filename, int *error)
 	free(textbuffer);
 	free(buffer2);
 
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tEnd of import.  Highest used chart position detected as %lu", chart->chart_length);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tEnd of import.  Highest used chart position detected as %lu", chart->chart_length);
 
 	return chart;
 }
@@ -107,7 +107,7 @@ unsigned long FindLongestLineLength_ALLEGRO(const char *filename, char exit_on_e
 	//avoid problems with the standard C functions being unable to handle filenames with special characters
 	//Returns 0 on error
 void eof_chart_import_process_note_markers(EOF_SONG *sp, unsigned long track, unsigned char difficulty);
-	//Processes and deletes toggle HOPO markers and slider markers from the specified track difficulty to remove them and help an imported track from avoid exceeding EOF_MAX_NOTES
+	//Processes and deletes toggle HOPO markers and slider markers from the specified track difficulty so they aren't left in the imported track as notes
 EOF_SONG * eof_import_chart(const char * fn);
 	//Invokes ImportFeedback() and transfers the chart data to EOF
 void sort_chart(struct FeedbackChart *chart);
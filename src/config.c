@@ -89,7 +89,6 @@ void eof_load_config(char * fn)
 		eof_cpu_saver = 0;
 	}
 	eof_supports_mp3 = get_config_int("config", "mp3_support", 0);
-	eof_supports_oggcat = get_config_int("config", "oggcat_support", 0);
 	eof_audio_fine_tune = get_config_int("config", "fine_tune", 0);
 	eof_global_volume = get_config_int("config", "volume", 255);
 	if(eof_global_volume < 0 || eof_global_volume > 255)
@@ -216,6 +215,11 @@ void eof_load_config(char * fn)
 		eof_min_note_distance = 3;	//Reset it to default
 	}
 	eof_min_note_distance_intervals = get_config_int("preferences", "eof_min_note_distance_intervals", 0);
+	eof_recovery_interval = get_config_int("preferences", "eof_recovery_interval", 1000);
+	if(eof_recovery_interval > 60000)
+	{	//If the auto-recovery write interval is invalid (more than one minute)
+		eof_recovery_interval = 1000;	//Reset it to default
+	}
 	if(eof_min_note_distance_intervals > 2)
 	{	//If the minimum note distance setting isn't ms, 1/# measure or 1/# beat
 		eof_min_note_distance_intervals = 0;	//Reset it to ms
@@ -360,7 +364,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {35,36,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_1 from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_1, default_mapping, sizeof(default_mapping));
 	}
 
@@ -370,7 +374,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {38,40,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_2 from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_2, default_mapping, sizeof(default_mapping));
 	}
 	(void) ustrcpy(gp_drum_mappings, get_config_string("other", "gp_drum_import_lane_2_rimshot", "37"));
@@ -379,7 +383,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {37,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_2_rimshot from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_2_rimshot, default_mapping, sizeof(default_mapping));
 	}
 
@@ -389,7 +393,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {47,50,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_3 from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_3, default_mapping, sizeof(default_mapping));
 	}
 	(void) ustrcpy(gp_drum_mappings, get_config_string("other", "gp_drum_import_lane_3_cymbal", "42,54,92"));
@@ -398,7 +402,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {42,54,92,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_3_cymbal from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_3_cymbal, default_mapping, sizeof(default_mapping));
 	}
 	(void) ustrcpy(gp_drum_mappings, get_config_string("other", "gp_drum_import_lane_3_hi_hat_pedal", "44"));
@@ -407,7 +411,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {44,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_3_hi_hat_pedal from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_3_hi_hat_pedal, default_mapping, sizeof(default_mapping));
 	}
 	(void) ustrcpy(gp_drum_mappings, get_config_string("other", "gp_drum_import_lane_3_hi_hat_open", "46"));
@@ -416,7 +420,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {46,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_3_hi_hat_open from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_3_hi_hat_open, default_mapping, sizeof(default_mapping));
 	}
 
@@ -426,7 +430,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {45,48,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_4 from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_4, default_mapping, sizeof(default_mapping));
 	}
 	(void) ustrcpy(gp_drum_mappings, get_config_string("other", "gp_drum_import_lane_4_cymbal", "51,53,56,59"));
@@ -435,7 +439,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {51,53,56,59,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_4_cymbal from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_4_cymbal, default_mapping, sizeof(default_mapping));
 	}
 
@@ -445,7 +449,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {41,43,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_5 from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_5, default_mapping, sizeof(default_mapping));
 	}
 	(void) ustrcpy(gp_drum_mappings, get_config_string("other", "gp_drum_import_lane_5_cymbal", "49,52,55,57"));
@@ -454,7 +458,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {49,52,55,57,0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_5_cymbal from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_5_cymbal, default_mapping, sizeof(default_mapping));
 	}
 
@@ -464,7 +468,7 @@ void eof_load_config(char * fn)
 		unsigned char default_mapping[] = {0};
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error processing gp_drum_import_lane_6 from the config file, resetting to defaults.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		memcpy(gp_drum_import_lane_6, default_mapping, sizeof(default_mapping));
 	}
 
@@ -514,8 +518,7 @@ void eof_save_config(char * fn)
 	}
 	if(eof_log_level > 2)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Writing to config file:  %s", fn);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "Writing to config file:  %s", fn);
 	}
 	set_config_file(fn);
 
@@ -534,7 +537,6 @@ void eof_save_config(char * fn)
 	set_config_int("config", "disable_vsync", eof_disable_vsync);
 	set_config_int("config", "cpu_saver", eof_cpu_saver);
 	set_config_int("config", "mp3_support", eof_supports_mp3);
-	set_config_int("config", "oggcat_support", eof_supports_oggcat);
 	set_config_int("config", "fine_tune", eof_audio_fine_tune);
 	set_config_int("config", "volume", eof_global_volume);
 
@@ -604,6 +606,7 @@ void eof_save_config(char * fn)
 	set_config_int("preferences", "eof_chord_density_threshold", eof_chord_density_threshold);
 	set_config_int("preferences", "eof_min_note_distance", eof_min_note_distance);
 	set_config_int("preferences", "eof_min_note_distance_intervals", eof_min_note_distance_intervals);
+	set_config_int("preferences", "eof_recovery_interval", eof_recovery_interval);
 	set_config_int("preferences", "eof_render_bass_drum_in_lane", eof_render_bass_drum_in_lane);
 	set_config_int("preferences", "eof_vanish_y", eof_vanish_y);
 	set_config_int("preferences", "eof_playback_time_stretch", eof_playback_time_stretch);
@@ -943,7 +946,7 @@ int eof_validate_default_ini_entry(const char *entry, int silent)
 		}
 		if(!silent)
 		{	//If errors are to be displayed to the user
-			allegro_message("%s", eof_log_string);
+			eof_message("%s", eof_log_string);
 		}
 		return 1;	//Return input string error
 	}
@@ -957,7 +960,7 @@ int eof_validate_default_ini_entry(const char *entry, int silent)
 			eof_log(eof_log_string, 1);
 			if(!silent)
 			{	//If errors are to be displayed to the user
-				allegro_message("%s", eof_log_string);
+				eof_message("%s", eof_log_string);
 			}
 			return 2;	//Return logic error
 		}
@@ -968,7 +971,7 @@ int eof_validate_default_ini_entry(const char *entry, int silent)
 			eof_log(eof_log_string, 1);
 			if(!silent)
 			{	//If errors are to be displayed to the user
-				allegro_message("%s", eof_log_string);
+				eof_message("%s", eof_log_string);
 			}
 			return 3;	//Return entry already defined
 		}
@@ -980,7 +983,7 @@ int eof_validate_default_ini_entry(const char *entry, int silent)
 		eof_log(eof_log_string, 1);
 		if(!silent)
 		{	//If errors are to be displayed to the user
-			allegro_message("%s", eof_log_string);
+			eof_message("%s", eof_log_string);
 		}
 		return 4;
 	}
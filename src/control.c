@@ -312,8 +312,7 @@ void eof_controller_save_config(EOF_CONTROLLER * cp, char * name)
 	{
 		if(eof_log_level > 2)
 		{
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tWriting %s config button #%d", name, i);
-			eof_log(eof_log_string, 3);
+			eof_logf(3, "\tWriting %s config button #%d", name, i);
 		}
 		(void) snprintf(string, sizeof(string) - 1, "button_%d_type", i);
 		set_config_int(name, string, cp->button[i].type);
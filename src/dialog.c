@@ -16,6 +16,7 @@
 #include "menu/context.h"
 #include "lc_import.h"
 #include "main.h"
+#include "batch.h"
 #include "player.h"
 #include "ini.h"
 #include "editor.h"
@@ -130,6 +131,11 @@ int eof_popup_dialog(DIALOG * dp, int n)
 
 	if(!dp)	//If this pointer is NULL for any reason
 		return D_O_K;
+	if(eof_batch_mode)
+	{	//There is no display or input in batch mode, treat the dialog as canceled
+		eof_log("\tDialog canceled in batch mode", 1);
+		return -1;
+	}
 
 	eof_close_menu = 0;
 	eof_prepare_menus();
@@ -280,6 +286,7 @@ int eof_popup_dialog(DIALOG * dp, int n)
 	eof_keyboard_shortcut = 0;
 	eof_main_menu_activated = 0;
 	eof_close_button_clicked = 0;	//Clear any tracking of the close button having been clicked while a dialog is open
+	eof_set_render_dirty();			//The dialog was drawn over the program window and may have changed any of the rendered settings
 
 	return ret;
 }
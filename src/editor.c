@@ -51,6 +51,60 @@ unsigned long eof_tech_anchor_diff[EOF_TRACKS_MAX] = {0};
 EOF_SNAP_DATA eof_snap;
 EOF_SNAP_DATA eof_tail_snap;
 
+int eof_selection_reserve(unsigned long count)
+{
+	char *array;
+	unsigned long newsize;
+
+	if(count <= eof_selection.multi_size)
+		return 1;	//The array is already large enough
+
+	//Double the size until it is large enough, the same way the track note arrays grow
+	newsize = eof_selection.multi_size ? eof_selection.multi_size : EOF_MIN_NOTE_CAPACITY;
+	while(newsize < count)
+	{
+		if(newsize > ULONG_MAX / 2)
+		{	//If doubling again would overflow
+			newsize = count;
+			break;
+		}
+		newsize *= 2;
+	}
+	array = realloc(eof_selection.multi, (size_t)newsize);
+	if(!array)
+	{
+		eof_log("\tError allocating memory for the note selection array", 1);
+		return 0;	//The original array is left intact
+	}
+	memset(array + eof_selection.multi_size, 0, (size_t)(newsize - eof_selection.multi_size));	//New entries are not selected
+	eof_selection.multi = array;
+	eof_selection.multi_size = newsize;
+
+	return 1;
+}
+
+void eof_selection_reset(void)
+{
+	char *multi = eof_selection.multi;
+	unsigned long multi_size = eof_selection.multi_size;
+
+	memset(&eof_selection, 0, sizeof(EOF_SELECTION_DATA));
+	if(multi)
+	{
+		memset(multi, 0, (size_t)multi_size);	//Clear the selected notes array
+	}
+	eof_selection.multi = multi;
+	eof_selection.multi_size = multi_size;
+	eof_selection.current = EOF_NO_NOTE_SELECTED;
+}
+
+void eof_selection_free(void)
+{
+	free(eof_selection.multi);
+	eof_selection.multi = NULL;
+	eof_selection.multi_size = 0;
+}
+
 double eof_pos_distance(double p1, double p2)
 {
 //	eof_log("eof_pos_distance() entered");
@@ -947,11 +1001,11 @@ if(eof_key_code == KEY_PAUSE)
 	{	//SHIFT is held
 		if(KEY_EITHER_CTRL)
 		{	//CTRL and SHIFT are held
-			allegro_message("CTRL+ALT+SHIFT+M captured!");
+			eof_message("CTRL+ALT+SHIFT+M captured!");
 		}
 		else
 		{	//Only SHIFT is held
-			allegro_message("ALT+SHIFT+M captured!");
+			eof_message("ALT+SHIFT+M captured!");
 		}
 		eof_shift_used = 1;	//Track that the SHIFT key was used
 	}
@@ -959,17 +1013,17 @@ if(eof_key_code == KEY_PAUSE)
 	{	//SHIFT is not held
 		if(KEY_EITHER_CTRL)
 		{	//CTRL is held
-			allegro_message("CTRL+ALT+M captured!");
+			eof_message("CTRL+ALT+M captured!");
 		}
 		else
 		{	//Neither CTRL nor SHIFT are held
-			allegro_message("ALT+M captured!");
+			eof_message("ALT+M captured!");
 		}
 	}
 }
 if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 {
-	allegro_message("ALT+V captured!");
+	eof_message("ALT+V captured!");
 }
 */
 
@@ -2348,6 +2402,7 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 				else
 				{
 					eof_entering_note_note->length = (eof_music_pos - eof_av_delay) - eof_entering_note_note->pos - 10;
+					eof_note_index_invalidate(eof_selected_track);	//The note was lengthened directly, so any cached note index for this track will need to be rebuilt
 				}
 			}
 		}
@@ -2618,6 +2673,7 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 						if(eof_entering_note && eof_entering_note_note)
 						{
 							eof_entering_note_note->length = (eof_music_pos - eof_av_delay - eof_guitar.delay) - eof_entering_note_note->pos - 10;
+							eof_note_index_invalidate(eof_selected_track);	//The note was lengthened directly, so any cached note index for this track will need to be rebuilt
 						}
 						eof_prepare_undo(EOF_UNDO_TYPE_RECORD);
 						new_note = eof_track_add_create_note(eof_song, eof_selected_track, eof_snote, eof_music_pos - eof_av_delay - eof_guitar.delay, 1, eof_note_type, NULL);
@@ -2651,6 +2707,7 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 				if(eof_entering_note && eof_entering_note_note)
 				{
 					eof_entering_note_note->length = (eof_music_pos - eof_av_delay - eof_guitar.delay) - eof_entering_note_note->pos - 10;
+					eof_note_index_invalidate(eof_selected_track);	//The note was lengthened directly, so any cached note index for this track will need to be rebuilt
 					if(eof_snote != eof_last_snote)
 					{
 						eof_entering_note = 0;
@@ -3731,6 +3788,8 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 						}
 						if(effective_hover_note >= 0)
 						{	//If the user is editing an existing note
+							unsigned long editpos = eof_get_note_pos(eof_song, eof_selected_track, effective_hover_note);
+							eof_invalidate_phrase_status(eof_song, eof_selected_track, editpos, editpos);	//Only the statuses around this note will need to be updated
 							if(ghl_open)
 							{	//If a GHL open note is being toggled
 								if(eof_legacy_guitar_note_is_open(eof_song, eof_selected_track, effective_hover_note))
@@ -3808,18 +3867,18 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 							{	//If the note just had all lanes cleared, delete the note
 								eof_track_delete_note(eof_song, eof_selected_track, effective_hover_note);
 								eof_selection.multi[eof_selection.current] = 0;
-								eof_selection.current = EOF_MAX_NOTES - 1;
+								eof_selection.current = EOF_NO_NOTE_SELECTED;
 								eof_track_sort_notes(eof_song, eof_selected_track);
 								eof_track_fixup_notes(eof_song, eof_selected_track, 1);
-								eof_determine_phrase_status(eof_song, eof_selected_track);
+								eof_update_phrase_status(eof_song, eof_selected_track);
 								(void) eof_detect_difficulties(eof_song, eof_selected_track);
 							}
 
-							if(eof_selection.current != EOF_MAX_NOTES - 1)
+							if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 							{	//If a new gem was placed (toggle gem didn't delete the affected note)
 								if(!eof_add_new_notes_to_selection)
 								{	//If the user didn't opt to prevent clearing the note selection when adding gems
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.track = eof_selected_track;
 								eof_selection.current_pos = eof_get_note_pos(eof_song, eof_selected_track, eof_selection.current);
@@ -3848,6 +3907,7 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 								targetpos = eof_pen_note.pos;
 								eof_pen_note.note ^= bitmask;
 							}
+							eof_invalidate_phrase_status(eof_song, eof_selected_track, targetpos, targetpos);	//Only the statuses around the new note will need to be updated
 							new_note = eof_track_add_create_note(eof_song, eof_selected_track, eof_pen_note.note, targetpos, notelen, eof_note_type, NULL);
 							if(new_note)
 							{
@@ -3878,7 +3938,7 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 								eof_selection.track = eof_selected_track;
 								if(!eof_add_new_notes_to_selection)
 								{	//If the user didn't opt to prevent clearing the note selection when adding gems
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_track_sort_notes(eof_song, eof_selected_track);
 								eof_selection.notemask = eof_pen_note.note;
@@ -3887,7 +3947,7 @@ if(KEY_EITHER_ALT && (eof_key_code == KEY_V))
 								(void) eof_detect_difficulties(eof_song, eof_selected_track);
 							}
 						}
-						eof_determine_phrase_status(eof_song, eof_selected_track);	//Update HOPO statuses
+						eof_update_phrase_status(eof_song, eof_selected_track);	//Update HOPO statuses
 					}//If user has pressed any key from 1 through 6
 				}//If a vocal track is not active
 			}//If the mouse is in the fretboard area
@@ -4373,7 +4433,7 @@ void eof_editor_logic(void)
 						eof_selection.current = eof_hover_note;		//Temporarily mark the hover note as the selected note
 						eof_selection.multi[eof_hover_note] = 1;
 						(void) eof_menu_note_edit_pro_guitar_note();
-						eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note statuses
+						eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note statuses
 						eof_selection.multi[eof_hover_note] = 0;
 					}
 					eof_mclick_released = 0;
@@ -4434,7 +4494,7 @@ void eof_editor_logic(void)
 				eof_lclick_released = 0;
 				if(eof_hover_note >= 0)
 				{
-					if(eof_selection.current != EOF_MAX_NOTES - 1)
+					if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 					{
 						eof_selection.last = eof_selection.current;
 						eof_selection.last_pos = eof_selection.current_pos;
@@ -4491,7 +4551,7 @@ void eof_editor_logic(void)
 										if(eof_selection.track != eof_selected_track)
 										{
 											eof_selection.track = eof_selected_track;
-											memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+											memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 										}
 										eof_selection.multi[i] = 1;
 										eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4507,7 +4567,7 @@ void eof_editor_logic(void)
 										if(eof_selection.track != eof_selected_track)
 										{
 											eof_selection.track = eof_selected_track;
-											memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+											memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 										}
 										eof_selection.multi[i] = 1;
 										eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4519,14 +4579,14 @@ void eof_editor_logic(void)
 						{	//Normal click replaces the selected note range with one note
 							if(!eof_selection.multi[eof_selection.current])
 							{
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							if(eof_selection.multi[eof_selection.current] == 1)
 							{	//If the note is already selected
 								if(eof_selection.track != eof_selected_track)
 								{
 									eof_selection.track = eof_selected_track;
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.multi[eof_selection.current] = 2;	//Flag this note as being clicked on
 								eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4536,7 +4596,7 @@ void eof_editor_logic(void)
 								if(eof_selection.track != eof_selected_track)
 								{
 									eof_selection.track = eof_selected_track;
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.multi[eof_selection.current] = 1;
 								eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4552,7 +4612,7 @@ void eof_editor_logic(void)
 							if(eof_selection.track != eof_selected_track)
 							{
 								eof_selection.track = eof_selected_track;
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							eof_selection.multi[eof_selection.current] = 2;	//Flag this note as being clicked on
 							eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4562,7 +4622,7 @@ void eof_editor_logic(void)
 							if(eof_selection.track != eof_selected_track)
 							{
 								eof_selection.track = eof_selected_track;
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							eof_selection.multi[eof_selection.current] = 1;
 							eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4600,7 +4660,7 @@ void eof_editor_logic(void)
 						{	//If CTRL is not held
 							if(!KEY_EITHER_SHIFT)
 							{	//SHIFT is not held
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								if(eof_selection.multi[eof_selection.current])
 								{
 									eof_selection.multi[eof_selection.current] = 0;
@@ -4625,7 +4685,7 @@ void eof_editor_logic(void)
 								if(eof_selection.track != eof_selected_track)
 								{
 									eof_selection.track = eof_selected_track;
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.multi[eof_selection.current] = 1;
 								eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -4656,7 +4716,7 @@ void eof_editor_logic(void)
 				{
 					eof_mouse_drug++;
 				}
-				if((eof_mouse_drug > 10) && (eof_selection.current != EOF_MAX_NOTES - 1))
+				if((eof_mouse_drug > 10) && (eof_selection.current != EOF_NO_NOTE_SELECTED))
 				{
 					if((eof_snap_mode != EOF_SNAP_OFF) && !KEY_EITHER_CTRL)
 					{	//Move notes by grid snap
@@ -4745,7 +4805,7 @@ void eof_editor_logic(void)
 					{
 						if(revert == 3)
 						{	//If something unexpected happened and the drag operation resulted in both edges of the chart having note(s) pushed beyond the edge
-							allegro_message("Logic error in eof_editor_logic() note drag handling");
+							eof_message("Logic error in eof_editor_logic() note drag handling");
 						}
 						for(i = 0; i < eof_get_track_size(eof_song, eof_selected_track); i++)
 						{
@@ -4786,7 +4846,7 @@ void eof_editor_logic(void)
 							eof_selection.track = eof_selected_track;
 							if(!eof_add_new_notes_to_selection)
 							{	//If the user didn't opt to prevent clearing the note selection when adding gems
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							if(eof_legacy_view && (eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT))
 							{	//If legacy view is in effect, alter the note's legacy bitmask
@@ -4817,7 +4877,7 @@ void eof_editor_logic(void)
 								if(note == 0)
 								{	//If the note just had all lanes cleared, delete the note
 									eof_track_delete_note(eof_song, eof_selected_track, eof_hover_note);
-									eof_selection.current = EOF_MAX_NOTES - 1;
+									eof_selection.current = EOF_NO_NOTE_SELECTED;
 									eof_track_sort_notes(eof_song, eof_selected_track);
 									eof_track_fixup_notes(eof_song, eof_selected_track, 1);	//Fixup notes and retain note selection
 									eof_determine_phrase_status(eof_song, eof_selected_track);
@@ -4906,7 +4966,7 @@ void eof_editor_logic(void)
 							eof_selection.track = eof_selected_track;
 							if(!eof_add_new_notes_to_selection)
 							{	//If the user didn't opt to prevent clearing the note selection when adding gems
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							eof_track_sort_notes(eof_song, eof_selected_track);
 							eof_selection.notemask = eof_pen_note.note;
@@ -5079,7 +5139,7 @@ void eof_editor_logic(void)
 							if(eof_selection.track != eof_selected_track)
 							{
 								eof_selection.track = eof_selected_track;
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							eof_selection.multi[eof_selection.current] = 1;
 							eof_render();
@@ -5090,7 +5150,7 @@ void eof_editor_logic(void)
 							{
 								eof_selection.current = eof_hover_note;
 								eof_selection.current_pos = eof_get_note_pos(eof_song, eof_selected_track, eof_selection.current);
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								eof_selection.multi[eof_selection.current] = 1;
 								eof_render();
 							}
@@ -5263,7 +5323,7 @@ void eof_vocal_editor_logic(void)
 				eof_lclick_released = 0;
 				if(eof_hover_note >= 0)
 				{
-					if(eof_selection.current != EOF_MAX_NOTES - 1)
+					if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 					{
 						eof_selection.last = eof_selection.current;
 						eof_selection.last_pos = eof_selection.current_pos;
@@ -5326,7 +5386,7 @@ void eof_vocal_editor_logic(void)
 										if(eof_selection.track != EOF_TRACK_VOCALS)
 										{
 											eof_selection.track = EOF_TRACK_VOCALS;
-											memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+											memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 										}
 										eof_selection.multi[i] = 1;
 										eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5342,7 +5402,7 @@ void eof_vocal_editor_logic(void)
 										if(eof_selection.track != EOF_TRACK_VOCALS)
 										{
 											eof_selection.track = EOF_TRACK_VOCALS;
-											memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+											memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 										}
 										eof_selection.multi[i] = 1;
 										eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5354,14 +5414,14 @@ void eof_vocal_editor_logic(void)
 						{
 							if(!eof_selection.multi[eof_selection.current])
 							{
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							if(eof_selection.multi[eof_selection.current] == 1)
 							{	//If the note is already selected
 								if(eof_selection.track != EOF_TRACK_VOCALS)
 								{
 									eof_selection.track = EOF_TRACK_VOCALS;
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.multi[eof_selection.current] = 2;	//Flag this note as being clicked on
 								eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5371,7 +5431,7 @@ void eof_vocal_editor_logic(void)
 								if(eof_selection.track != EOF_TRACK_VOCALS)
 								{
 									eof_selection.track = EOF_TRACK_VOCALS;
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.multi[eof_selection.current] = 1;
 								eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5387,7 +5447,7 @@ void eof_vocal_editor_logic(void)
 							if(eof_selection.track != EOF_TRACK_VOCALS)
 							{
 								eof_selection.track = EOF_TRACK_VOCALS;
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							eof_selection.multi[eof_selection.current] = 2;	//Flag this note as being clicked on
 							eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5397,7 +5457,7 @@ void eof_vocal_editor_logic(void)
 							if(eof_selection.track != EOF_TRACK_VOCALS)
 							{
 								eof_selection.track = EOF_TRACK_VOCALS;
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							}
 							eof_selection.multi[eof_selection.current] = 1;
 							eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5435,7 +5495,7 @@ void eof_vocal_editor_logic(void)
 						{
 							if(!KEY_EITHER_SHIFT)
 							{	//SHIFT is not held
-								memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+								memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								if(eof_selection.multi[eof_selection.current])
 								{
 									eof_selection.multi[eof_selection.current] = 0;
@@ -5460,7 +5520,7 @@ void eof_vocal_editor_logic(void)
 								if(eof_selection.track != EOF_TRACK_VOCALS)
 								{
 									eof_selection.track = EOF_TRACK_VOCALS;
-									memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+									memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 								}
 								eof_selection.multi[eof_selection.current] = 1;
 								eof_undo_last_type = EOF_UNDO_TYPE_NONE;
@@ -5491,7 +5551,7 @@ void eof_vocal_editor_logic(void)
 				{	//If a note was clicked and drug
 					eof_mouse_drug++;
 				}
-				if((eof_mouse_drug > 10) && (eof_selection.current != EOF_MAX_NOTES - 1))
+				if((eof_mouse_drug > 10) && (eof_selection.current != EOF_NO_NOTE_SELECTED))
 				{
 					if((eof_snap_mode != EOF_SNAP_OFF) && !KEY_EITHER_CTRL)
 					{	//Move notes by grid snap
@@ -5592,7 +5652,7 @@ void eof_vocal_editor_logic(void)
 					if((eof_scaled_mouse_y >= EOF_EDITOR_RENDER_OFFSET + 35 + eof_screen_layout.lyric_y) && (eof_scaled_mouse_y < EOF_EDITOR_RENDER_OFFSET + 35 + eof_screen_layout.lyric_y + 16))
 					{
 						eof_track_delete_note(eof_song, eof_selected_track, eof_hover_note);	//Delete the hovered over lyric
-						eof_selection.current = EOF_MAX_NOTES - 1;
+						eof_selection.current = EOF_NO_NOTE_SELECTED;
 						eof_track_sort_notes(eof_song, eof_selected_track);
 					}
 
@@ -5602,7 +5662,7 @@ void eof_vocal_editor_logic(void)
 						if(!eof_check_string(eof_song->vocal_track[tracknum]->lyric[eof_hover_note]->text))	//If removing the pitch from a note that is already textless
 						{	//Perform the cleanup code as if the lyric was deleted by inputting on top of the lyric text as above
 							eof_track_delete_note(eof_song, eof_selected_track, eof_hover_note);	//Delete the hovered over lyric
-							eof_selection.current = EOF_MAX_NOTES - 1;
+							eof_selection.current = EOF_NO_NOTE_SELECTED;
 							eof_track_sort_notes(eof_song, eof_selected_track);
 						}
 						else if(eof_rclick_released)	//Just remove the pitch, but only if the right mouse button was just clicked
@@ -5610,7 +5670,7 @@ void eof_vocal_editor_logic(void)
 							eof_song->vocal_track[tracknum]->lyric[eof_hover_note]->note = 0;
 							eof_selection.current = eof_hover_note;
 							eof_selection.track = eof_selected_track;
-							memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+							memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							eof_selection.multi[eof_selection.current] = 1;
 							eof_selection.current_pos = eof_song->vocal_track[tracknum]->lyric[eof_selection.current]->pos;
 							eof_selection.range_pos_1 = eof_selection.current_pos;
@@ -5624,7 +5684,7 @@ void eof_vocal_editor_logic(void)
 						eof_song->vocal_track[tracknum]->lyric[eof_hover_note]->note = eof_pen_lyric.note;
 						eof_selection.current = eof_hover_note;
 						eof_selection.track = EOF_TRACK_VOCALS;
-						memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+						memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 						eof_selection.multi[eof_selection.current] = 1;
 						eof_selection.current_pos = eof_song->vocal_track[tracknum]->lyric[eof_selection.current]->pos;
 						eof_selection.range_pos_1 = eof_selection.current_pos;
@@ -5721,7 +5781,7 @@ void eof_vocal_editor_logic(void)
 							eof_snap_logic(&eof_tail_snap, eof_song->vocal_track[tracknum]->lyric[i]->pos + eof_song->vocal_track[tracknum]->lyric[i]->length - 1);
 						}
 						eof_snap_length_logic(&eof_tail_snap);
-//							allegro_message("%d, %d\n%lu, %lu", eof_tail_snap.length, eof_tail_snap.beat, eof_get_note_pos(eof_selected_track, i) + eof_get_note_length(eof_selected_track, i), eof_song->beat[eof_tail_snap.beat]->pos);	//Debugging
+//							eof_message("%d, %d\n%lu, %lu", eof_tail_snap.length, eof_tail_snap.beat, eof_get_note_pos(eof_selected_track, i) + eof_get_note_length(eof_selected_track, i), eof_song->beat[eof_tail_snap.beat]->pos);	//Debugging
 						eof_song->vocal_track[tracknum]->lyric[i]->length -= eof_tail_snap.length;
 						if(eof_song->vocal_track[tracknum]->lyric[i]->length > 1)
 						{
@@ -5822,7 +5882,7 @@ void eof_vocal_editor_logic(void)
 						if(eof_selection.track != EOF_TRACK_VOCALS)
 						{
 							eof_selection.track = EOF_TRACK_VOCALS;
-							memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+							memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 						}
 						eof_selection.multi[eof_selection.current] = 1;
 						eof_render();
@@ -5833,7 +5893,7 @@ void eof_vocal_editor_logic(void)
 						{
 							eof_selection.current = eof_hover_note;
 							eof_selection.current_pos = eof_song->vocal_track[tracknum]->lyric[eof_selection.current]->pos;
-							memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+							memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 							eof_selection.multi[eof_selection.current] = 1;
 							eof_render();
 						}
@@ -5926,8 +5986,9 @@ int eof_get_tempo_text(unsigned long beat, char * buffer)
 void eof_render_editor_notes(EOF_WINDOW *window)
 {
 	unsigned long start;	//Will store the timestamp of the left visible edge of the piano roll
-	unsigned long i, numnotes;
+	unsigned long i, ctr, first = 0, count, numnotes;
 	char drawhighlight = 0;
+	EOF_NOTE_INDEX *ip;
 
 	if(!eof_song_loaded || !window)
 		return;	//Invalid parameter
@@ -5938,9 +5999,22 @@ void eof_render_editor_notes(EOF_WINDOW *window)
 	{	//Cache the results of the check for whether the hover note should be drawn highlighted
 		drawhighlight = 1;
 	}
+	ip = eof_get_note_index(eof_song, eof_selected_track, eof_note_type);
+	if(ip)
+	{	//If the active track difficulty's note index is available, skip the notes that end before the left edge of the piano roll
+		first = eof_note_index_find(eof_song, ip, (start > ip->maxlength) ? start - ip->maxlength : 0);
+		count = ip->count;
+	}
+	else
+	{	//Otherwise check every note in the track
+		count = numnotes;
+	}
 	eof_last_tab_notation[0] = '\0';	//Erase the tab notation summary string to ensure the first rendered notes has its notation fully displayed
-	for(i = 0; i < numnotes; i++)
+	for(ctr = first; ctr < count; ctr++)
 	{	//Render all visible notes in the list
+		i = ip ? ip->notes[ctr] : ctr;
+		if(i >= numnotes)
+			break;	//Bounds check
 		if((eof_note_type == eof_get_note_type(eof_song, eof_selected_track, i)) && (eof_get_note_pos(eof_song, eof_selected_track, i) + eof_get_note_length(eof_song, eof_selected_track, i) >= start))
 		{	//If this note is in the selected instrument difficulty and would render at or after the left edge of the piano roll
 			if(drawhighlight && (eof_hover_note == i))
@@ -6155,7 +6229,7 @@ void eof_render_editor_window_2(void)
 		temp_pos = eof_music_pos;					//Remember the active position
 		temp_selected = eof_selection.current;		//Remember the selected note
 		temp_hover = eof_hover_note;				//Remember the hover note
-		eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+		eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		eof_hover_note = -1;						//Clear the hover note
 
 		if(!eof_sync_piano_rolls)
@@ -7709,7 +7783,9 @@ void eof_seek_to_nearest_grid_snap(void)
 
 long eof_find_hover_note(long targetpos, int x_tolerance, char snaplogic)
 {
-	unsigned long i, npos, leftboundary, hoverlane = 0;
+	unsigned long i, ctr, first = 0, count, numnotes, npos, leftboundary, hoverlane = 0;
+	unsigned long lowpos = 0, highpos = 0, lookback;
+	EOF_NOTE_INDEX *ip;
 	long nlen;
 	int candidate;
 
@@ -7729,13 +7805,39 @@ long eof_find_hover_note(long targetpos, int x_tolerance, char snaplogic)
 	{	//If the user enabled the preference to include note tails in the clickable area for notes
 		hoverlane = 1 << (unsigned)eof_hover_piece;	//Get the bitmask reflecting the lane the mouse is currently hovering over
 	}
-	for(i = 0; (i < eof_get_track_size(eof_song, eof_selected_track)); i++)
-	{	//For each note in the active track, until a hover note is found
+	numnotes = eof_get_track_size(eof_song, eof_selected_track);
+	ip = eof_get_note_index(eof_song, eof_selected_track, eof_note_type);
+	if(ip)
+	{	//If the active track difficulty's note index is available, only examine the notes that could be within range of the target positions
+		lowpos = highpos = targetpos;
+		if(snaplogic)
+		{	//The pen note's position is also tested
+			if(eof_pen_note.pos < lowpos)
+				lowpos = eof_pen_note.pos;
+			if(eof_pen_note.pos > highpos)
+				highpos = eof_pen_note.pos;
+		}
+		lookback = (unsigned long)x_tolerance + (eof_note_tails_clickable ? ip->maxlength : 0);	//The furthest a note's clickable area can extend after its start position
+		first = eof_note_index_find(eof_song, ip, (lowpos > lookback) ? lowpos - lookback : 0);
+		count = ip->count;
+		highpos += x_tolerance;	//Any note starting after this position can't be within range
+	}
+	else
+	{
+		count = numnotes;
+	}
+	for(ctr = first; ctr < count; ctr++)
+	{	//For each note in the active track difficulty, until a hover note is found
+		i = ip ? ip->notes[ctr] : ctr;
+		if(i >= numnotes)
+			break;	//Bounds check
 		if(eof_get_note_type(eof_song, eof_selected_track, i) != eof_note_type)
 			continue;	//If the note is not in the active difficulty, skip it
 
 		candidate = 0;	//Reset this status
 		npos = eof_get_note_pos(eof_song, eof_selected_track, i);
+		if(ip && ip->sorted && (npos > highpos))
+			break;	//If this and all remaining notes in the difficulty start too late to be hovered over, stop looking
 		if(npos < x_tolerance)
 		{	//Avoid an underflow here
 			leftboundary = 0;
@@ -7815,10 +7917,10 @@ void eof_update_seek_selection(unsigned long start, unsigned long stop, char des
 	}
 
 //Clear the selection array
-	memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+	memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 	if(start == stop)
 	{	//If the seek selection is removed
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 		eof_selection.current_pos = 0;
 	}
 	if(deselect)
@@ -1,9 +1,12 @@
 #ifndef EOF_EDITOR_H
 #define EOF_EDITOR_H
 
+#include <limits.h>
 #include "song.h"
 #include "window.h"
 
+#define EOF_NO_NOTE_SELECTED ULONG_MAX	//The value of eof_selection.current when no note is selected, it is never a valid note index
+
 typedef struct
 {
 
@@ -11,7 +14,7 @@ typedef struct
 	unsigned long track;
 
 	/* the current selection */
-	unsigned long current;	//EOF_MAX_NOTES - 1 is used to represent no notes selected
+	unsigned long current;	//EOF_NO_NOTE_SELECTED is used to represent no notes selected
 	unsigned long current_pos;	//The position of the last selected note
 	unsigned long notemask;	//The bitmask of the last edited/created note, for the purpose of ensuring the fixup logic correctly re-assigns eof_selection.current (applicable when adding a gem to a disjointed note, since the gem is another note at the same position)
 
@@ -20,7 +23,8 @@ typedef struct
 	unsigned long last_pos;
 
 	/* which notes are selected */
-	char multi[EOF_MAX_NOTES];
+	char *multi;			//Grows with the tracks' note arrays, see eof_selection_reserve()
+	unsigned long multi_size;	//The number of entries allocated for multi[]
 
 	/* range data */
 	unsigned long range_pos_1;
@@ -50,6 +54,14 @@ extern EOF_SNAP_DATA eof_tail_snap;
 extern unsigned long eof_anchor_diff[EOF_TRACKS_MAX];		//Used for note auto-adjust logic
 extern unsigned long eof_tech_anchor_diff[EOF_TRACKS_MAX];	//Used for tech note auto-adjust logic
 
+int eof_selection_reserve(unsigned long count);
+	//Ensures eof_selection.multi[] has at least count entries, doubling its size as needed.  New entries are unselected
+	//The track note/lyric reserve functions call this so that every note index in any track has a selection entry
+	//Returns zero on error
+void eof_selection_reset(void);
+	//Clears all selection data and sets eof_selection.current to EOF_NO_NOTE_SELECTED, keeping eof_selection.multi[] allocated
+void eof_selection_free(void);
+	//Frees eof_selection.multi[]
 void eof_select_beat(unsigned long beat);
 	//Updates eof_selected_measure, eof_beat_in_measure, eof_beats_in_measure and eof_selected_beat to reflect the specified beat number
 void eof_snap_logic(EOF_SNAP_DATA * sp, unsigned long p);
@@ -376,7 +376,7 @@ int rs_lyric_substitute_char_extended(int character, int function)
 	return (int)code;
 }
 
-int rs_filter_string(char *string, char rs_filter)
+int rs_filter_string(const char *string, char rs_filter)
 {
 	unsigned long ctr;
 
@@ -527,7 +527,7 @@ void expand_xml_text(char *buffer, size_t size, const char *input, size_t warnsi
 	if(warnsize && (index > warnsize + 1))
 	{	//If there is a threshold length specified for the output string, and the expanded string exceeds it (accounting for the extra byte used by the string terminator)
 #ifdef EOF_BUILD
-		allegro_message("Warning:  The string\n\"%s\"\nis longer than %lu characters.  It will need to be shortened or it will be truncated.", buffer, (unsigned long)warnsize);
+		eof_message("Warning:  The string\n\"%s\"\nis longer than %lu characters.  It will need to be shortened or it will be truncated.", buffer, (unsigned long)warnsize);
 #else
 		printf("\nWarning:  The string\n\"%s\"\nis longer than %lu characters.  It will need to be shortened or it will be truncated.", buffer, (unsigned long)warnsize);
 #endif
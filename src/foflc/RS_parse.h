@@ -24,7 +24,7 @@ int rs_lyric_substitute_char_extended(int character, int function);
 	//The input and output characters are Win-1252 encoding (extended ASCII characters encoded as a single byte each)
 	//If function is 0, all accented ASCII characters have substitutions made
 	//If function is 1, only the unsupported characters (ie. 'A' with a tilde accent) have substitutions made (ie. 'A')
-int rs_filter_string(char *string, char rs_filter);
+int rs_filter_string(const char *string, char rs_filter);
 	//Returns 1 if any character in the provided string is considered a filtered character by rs_filter_char()
 	//Currently only used to validate chord names for Rocksmith export, so rs_filter_char() is invoked with a zero value for islyric,
 	// a zero value for isphrase_section and a nonzero value for ischordname
@@ -645,7 +645,7 @@ int eof_gh_read_instrument_section_note(filebuffer *fb, EOF_SONG *sp, gh_section
 			{	//If there are any accent status bits
 				if(!eof_gh_accent_prompt)
 				{	//If the user wasn't prompted about which game this chart is from
-					if(alert("Is this chart from any of the following GH games?", "\"Warriors of Rock\", \"Band Hero\", \"Guitar Hero 5\"", "(These use a different accent notation than Smash Hits)", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("Is this chart from any of the following GH games?", "\"Warriors of Rock\", \"Band Hero\", \"Guitar Hero 5\"", "(These use a different accent notation than Smash Hits)", "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user indicates the chart is from Warriors of Rock
 						eof_gh_accent_prompt = 1;
 					}
@@ -849,7 +849,7 @@ void eof_process_gh_lyric_text_u(EOF_SONG *sp)
 	for(ctr = 0; ctr < eof_get_track_size(sp, EOF_TRACK_VOCALS); ctr++)
 	{	//For each lyric
 		index = 0;	//Reset the index into the buffer
-		string = eof_get_note_name(sp, EOF_TRACK_VOCALS, ctr);
+		string = eof_get_lyric_text(sp, EOF_TRACK_VOCALS, ctr);
 		if(string == NULL)
 			return;	//If there is some kind of error
 		length = ustrlen(string);
@@ -858,7 +858,7 @@ void eof_process_gh_lyric_text_u(EOF_SONG *sp)
 		{	//For each character in the the lyric's text
 			if((ugetat(string, ctr2) == '=') && (ctr > 0))
 			{	//If this character is an equal sign, and there's a previous lyric, drop the character and append a hyphen to the previous lyric
-				prevstring = eof_get_note_name(sp, EOF_TRACK_VOCALS, ctr - 1);	//Get the string for the previous lyric
+				prevstring = eof_get_lyric_text(sp, EOF_TRACK_VOCALS, ctr - 1);	//Get the string for the previous lyric
 				if(prevstring != NULL)
 				{	//If there wasn't an error getting that string
 					prevlength = ustrlen(prevstring);
@@ -909,7 +909,7 @@ void eof_process_gh_lyric_phrases(EOF_SONG *sp)
 #ifdef GH_IMPORT_DEBUG
 		if((ctr > 0) && (tp->line[ctr].start_pos <= prevphrase))
 		{	//If this phrase doesn't come after the previous phrase
-			allegro_message("Error:  GH lyric phrases are not in order!");
+			eof_message("Error:  GH lyric phrases are not in order!");
 		}
 #endif
 		prevphrase = tp->line[ctr].start_pos;
@@ -927,7 +927,7 @@ void eof_process_gh_lyric_phrases(EOF_SONG *sp)
 #ifdef GH_IMPORT_DEBUG
 					if(tp->line[ctr].start_pos >= tp->line[ctr + 1].start_pos)
 					{
-						allegro_message("Error:  GH lyric phrases are not in order!");
+						eof_message("Error:  GH lyric phrases are not in order!");
 					}
 #endif
 					phraseend = voxstart + eof_get_note_length(sp, EOF_TRACK_VOCALS, ctr2);		//Set the phrase end to the end of this lyric
@@ -1045,7 +1045,7 @@ int eof_gh_read_vocals_note(filebuffer *fb, EOF_SONG *sp)
 #endif
 		if(voxpitch == 2)
 		{	//This pitch indicates a pitch shift bridging the previous and next lyrics
-			char *name = eof_get_note_name(sp, EOF_TRACK_VOCALS, eof_get_track_size(sp, EOF_TRACK_VOCALS) - 1);
+			char *name = eof_get_lyric_text(sp, EOF_TRACK_VOCALS, eof_get_track_size(sp, EOF_TRACK_VOCALS) - 1);
 			if(name)
 			{
 				unsigned long length = ustrlen(name);
@@ -1198,7 +1198,7 @@ int eof_gh_read_vocals_note(filebuffer *fb, EOF_SONG *sp)
 			eof_log("\t\tThere is a bug in this NOTE file (no defined vocal pitch has a matching position).  Estimating the appropriate pitch to match with.", 1);
 			for(ctr2 = 0; ctr2 < eof_get_track_size(sp, EOF_TRACK_VOCALS); ctr2++)
 			{	//For each lyric pitch in the EOF_SONG structure
-				char *name = eof_get_note_name(sp, EOF_TRACK_VOCALS, ctr2);
+				char *name = eof_get_lyric_text(sp, EOF_TRACK_VOCALS, ctr2);
 				if(!name || (name[0] != '+'))
 					continue;	//If this lyric pitch already has text assigned to it, skip it
 
@@ -1507,7 +1507,7 @@ EOF_SONG * eof_import_gh_note(const char * fn)
 #endif
 		if(ctr && (dword <= lastfretbar))
 		{	//If this beat doesn't come after the previous beat
-			allegro_message("Warning:  Corrupt fretbar position");
+			eof_message("Warning:  Corrupt fretbar position");
 			numbeats = ctr;	//Update the number of beats
 			if(numbeats < 3)
 			{	//If too few beats were usable
@@ -1528,13 +1528,13 @@ EOF_SONG * eof_import_gh_note(const char * fn)
 	{	//If at least two beat timings were defined
 		if(eof_gh_import_sustain_threshold_prompt)
 		{	//If the user enabled the import preference to ask to apply this threshold
-			if(alert(NULL, "Apply the sustain threshold (half of the first beat's length) to imported notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Apply the sustain threshold (half of the first beat's length) to imported notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If user opts to enforce the threshold
 				eof_gh_import_sustain_threshold = (sp->beat[1]->pos - sp->beat[0]->pos) / 2;	//The threshold is half the first beat length, rounded down
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tGH:  The sustain threshold of %lums is being enforced.", eof_gh_import_sustain_threshold);
 				eof_log(eof_log_string, 1);
 
-				if(alert("Also apply sustain trimming (half the sustain threshold)", NULL, "to imported notes that pass the sustain threshold?", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("Also apply sustain trimming (half the sustain threshold)", NULL, "to imported notes that pass the sustain threshold?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If user opts to apply sustain trimming
 					eof_gh_import_sustain_trim = eof_gh_import_sustain_threshold / 2;
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tGH:  The sustain trim of %lums is being enforced.", eof_gh_import_sustain_trim);
@@ -1655,7 +1655,7 @@ EOF_SONG * eof_import_gh_note(const char * fn)
 						(void) eof_apply_ts(tsnum, tsden, ctr2, sp, 0);	//Apply the signature
 						if(!ts_move_notified)
 						{	//If the user hasn't been warned about this yet
-							allegro_message("At least one time signature is 1-3ms out of sync with its target beat marker, it will be corrected.");
+							eof_message("At least one time signature is 1-3ms out of sync with its target beat marker, it will be corrected.");
 							ts_move_notified = 1;
 						}
 						break;
@@ -1665,7 +1665,7 @@ EOF_SONG * eof_import_gh_note(const char * fn)
 					{	//Otherwise if this time signature's position has been surpassed by a beat
 						if(!ts_warned)
 						{	//If the user hasn't been warned about this yet
-							allegro_message("Warning:  Mid beat time signature detected.  Skipping");
+							eof_message("Warning:  Mid beat time signature detected.  Skipping");
 							ts_warned = 1;
 						}
 						eof_log("\t\tWarning:  Mid beat time signature detected.  Skipping", 1);
@@ -1680,7 +1680,7 @@ EOF_SONG * eof_import_gh_note(const char * fn)
 	eof_calculate_tempo_map(sp);	//Build the tempo map based on the beat time stamps, but only after the time signatures were optionally applied
 
 	eof_clear_input();
-	if(alert(NULL, "Import the chart's original HOPO OFF notation?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Import the chart's original HOPO OFF notation?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{	//If user opts to have all non HOPO notes marked for forced strumming
 		forcestrum = 1;
 	}
@@ -1927,7 +1927,7 @@ int eof_gh_read_instrument_section_qb(filebuffer *fb, EOF_SONG *sp, const char *
 			{	//If the user hasn't been prompted to re-target this track
 				if(!eof_get_track_size(sp, EOF_TRACK_RHYTHM))
 				{	//If the rhythm track is empty
-					if(alert(NULL, "Import the auxiliary track into PART RHYTHM instead of PART KEYS?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "Import the auxiliary track into PART RHYTHM instead of PART KEYS?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to change the destination track for the auxiliary section
 						eof_song_aux_swap = 1;
 						eof_song_aux_track = EOF_TRACK_RHYTHM;
@@ -1940,7 +1940,7 @@ int eof_gh_read_instrument_section_qb(filebuffer *fb, EOF_SONG *sp, const char *
 				}
 				else if(!eof_get_track_size(sp, EOF_TRACK_BASS))
 				{	//If the rhythm track is populated but the bass track is empty
-					if(alert(NULL, "Import the auxiliary track into PART BASS instead of PART KEYS?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "Import the auxiliary track into PART BASS instead of PART KEYS?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to change the destination track for the auxiliary section
 						eof_song_aux_swap = 1;
 						eof_song_aux_track = EOF_TRACK_BASS;
@@ -1996,7 +1996,7 @@ int eof_gh_read_instrument_section_qb(filebuffer *fb, EOF_SONG *sp, const char *
 			numnotes = headersize / 3;
 			if(!eof_gh_import_threshold_prompt)
 			{	//If the user wasn't prompted to select a HOPO threshold yet during this import
-				eof_gh_import_threshold_prompt = alert("GH3/GHA charts can have one of two HOPO thresholds.", "Which should EOF use?", NULL, "66/192 qnote", "100/192 qnote", 0, 0);
+				eof_gh_import_threshold_prompt = eof_alert("GH3/GHA charts can have one of two HOPO thresholds.", "Which should EOF use?", NULL, "66/192 qnote", "100/192 qnote", 0, 0);
 			}
 			if(eof_gh_import_threshold_prompt == 2)
 			{	//If the user selected the 100/192 threshold now or earlier in the import
@@ -2470,7 +2470,7 @@ int eof_gh_read_vocals_qb(filebuffer *fb, EOF_SONG *sp, const char *songname, un
 #endif
 			if(voxpitch == 2)
 			{	//This pitch indicates a pitch shift bridging the previous and next lyrics
-				char *name = eof_get_note_name(sp, EOF_TRACK_VOCALS, eof_get_track_size(sp, EOF_TRACK_VOCALS) - 1);
+				char *name = eof_get_lyric_text(sp, EOF_TRACK_VOCALS, eof_get_track_size(sp, EOF_TRACK_VOCALS) - 1);
 				if(name)
 				{
 					unsigned long length2 = ustrlen(name);
@@ -2546,7 +2546,7 @@ int eof_gh_read_vocals_qb(filebuffer *fb, EOF_SONG *sp, const char *songname, un
 		}
 		if((size_t)length + 1 > sizeof(buffer))
 		{	//If the buffer isn't large enough to store this string and its NULL terminator
-			allegro_message("Error:  QB lyric buffer too small, aborting");
+			eof_message("Error:  QB lyric buffer too small, aborting");
 			return -1;
 		}
 		if(eof_filebuffer_memcpy(fb, buffer, (size_t)length) == EOF)	//Read the lyric string into a buffer
@@ -2644,7 +2644,7 @@ int eof_gh_read_vocals_qb(filebuffer *fb, EOF_SONG *sp, const char *songname, un
 				eof_log("\t\tThere is a bug in this QB file (no defined vocal pitch has a matching position).  Estimating the appropriate pitch to match with.", 1);
 				for(ctr2 = 0; ctr2 < eof_get_track_size(sp, EOF_TRACK_VOCALS); ctr2++)
 				{	//For each lyric pitch in the EOF_SONG structure
-					char *name = eof_get_note_name(sp, EOF_TRACK_VOCALS, ctr2);
+					char *name = eof_get_lyric_text(sp, EOF_TRACK_VOCALS, ctr2);
 
 					if(!name || (name[0] != '+'))
 						continue;	//If this lyric pitch already has text assigned to it, skip it
@@ -2932,7 +2932,7 @@ EOF_SONG * eof_import_gh_qb(const char *fn)
 			}
 			if(ctr2 && (dword <= lastfretbar))
 			{	//If this beat doesn't come after the previous beat
-				allegro_message("Warning:  Corrupt fretbar position");
+				eof_message("Warning:  Corrupt fretbar position");
 				numbeats = ctr2;	//Update the number of beats
 				if(numbeats < 3)
 				{	//If too few beats were usable
@@ -2964,13 +2964,13 @@ EOF_SONG * eof_import_gh_qb(const char *fn)
 	{	//If at least two beat timings were defined
 		if(eof_gh_import_sustain_threshold_prompt)
 		{	//If the user enabled the import preference to ask to apply this threshold
-			if(alert(NULL, "Apply the sustain threshold (half of the first beat's length) to imported notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Apply the sustain threshold (half of the first beat's length) to imported notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to enforce the threshold
 				eof_gh_import_sustain_threshold = (sp->beat[1]->pos - sp->beat[0]->pos) / 2;	//The threshold is half the first beat length, rounded down
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tGH:  The sustain threshold of %lums is being enforced.", eof_gh_import_sustain_threshold);
 				eof_log(eof_log_string, 1);
 
-				if(alert("Also apply sustain trimming (half the sustain threshold)", NULL, "to imported notes that pass the sustain threshold?", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("Also apply sustain trimming (half the sustain threshold)", NULL, "to imported notes that pass the sustain threshold?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If user opts to apply sustain trimming
 					eof_gh_import_sustain_trim = eof_gh_import_sustain_threshold / 2;
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tGH:  The sustain trim of %lums is being enforced.", eof_gh_import_sustain_trim);
@@ -3068,7 +3068,7 @@ EOF_SONG * eof_import_gh_qb(const char *fn)
 							(void) eof_apply_ts(tsnum, tsden, ctr3, sp, 0);	//Apply the signature
 							if(!ts_move_notified)
 							{	//If the user hasn't been warned about this yet
-								allegro_message("At least one time signature is 1-3ms out of sync with its target beat marker, it will be corrected.");
+								eof_message("At least one time signature is 1-3ms out of sync with its target beat marker, it will be corrected.");
 								ts_move_notified = 1;
 							}
 							break;
@@ -3078,7 +3078,7 @@ EOF_SONG * eof_import_gh_qb(const char *fn)
 						{	//Otherwise if this time signature's position has been surpassed by a beat
 							if(!ts_warned)
 							{	//If the user hasn't been warned about this yet
-								allegro_message("Warning:  Mid beat time signature detected.  Skipping");
+								eof_message("Warning:  Mid beat time signature detected.  Skipping");
 								ts_warned = 1;
 							}
 							eof_log("\t\t\t\tWarning:  Mid beat time signature detected.  Skipping", 1);
@@ -3098,7 +3098,7 @@ EOF_SONG * eof_import_gh_qb(const char *fn)
 	eof_calculate_tempo_map(sp);	//Build the tempo map based on the beat time stamps, but only after the time signatures were optionally applied
 
 	eof_clear_input();
-	if(alert(NULL, "Import the chart's original HOPO OFF notation?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Import the chart's original HOPO OFF notation?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{	//If user opts to have all non HOPO notes marked for forced strumming
 		forcestrum = 1;
 	}
@@ -3152,7 +3152,7 @@ EOF_SONG * eof_import_gh_qb(const char *fn)
 	}
 	if(sp_has_conflict)
 	{
-		int ret = alert3("At least one track has both normal AND battle SP phrases.", "Import which type when both are present?", NULL, "Normal", "Battle", "Both", 0, 0, 0);
+		int ret = eof_alert3("At least one track has both normal AND battle SP phrases.", "Import which type when both are present?", NULL, "Normal", "Battle", "Both", 0, 0, 0);
 		if(ret == 1)
 		{
 			import_battle_sp = 0;	//Don't import battle SP phrases when both SP types are present
@@ -3279,7 +3279,7 @@ int eof_ghl_import_common(const char *fn)
 		return 1;	//Return failure
 	if(eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
 	{
-		allegro_message("Cannot import a GHL file into a pro guitar track.");
+		eof_message("Cannot import a GHL file into a pro guitar track.");
 		eof_log("Cannot import a GHL file into a pro guitar track.  Aborting", 1);
 		return 1;	//Don't do anything if the active track is a pro guitar/bass track
 	}
@@ -3288,7 +3288,7 @@ int eof_ghl_import_common(const char *fn)
 
 //Erase active track if necessary
 	eof_clear_input();
-	if(eof_get_track_size(eof_song, eof_selected_track) && alert("This track already has notes", "Importing this XMK file will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+	if(eof_get_track_size(eof_song, eof_selected_track) && eof_alert("This track already has notes", "Importing this XMK file will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 	{	//If the active track is already populated and the user doesn't opt to overwrite it
 		return 0;
 	}
@@ -3344,7 +3344,7 @@ int eof_ghl_import_common(const char *fn)
 	if(numtempos || numtimesigs)
 	{	//If there are any tempo or time signature changes
 		eof_clear_input();
-		if(alert(NULL, "Import the file's tempo map?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Import the file's tempo map?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{
 			import_tempo_map = 1;
 		}
@@ -3353,7 +3353,7 @@ int eof_ghl_import_common(const char *fn)
 	if(import_tempo_map && (eof_get_chart_size(eof_song) > 0))
 	{	//If the user opted to import the tempo map and there is at least one note/lyric in the project, prompt to adjust the notes/lyrics
 		eof_clear_input();
-		if(alert(NULL, "Adjust notes to imported tempo map?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Adjust notes to imported tempo map?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{
 			adjust = 1;
 		}
@@ -3378,7 +3378,7 @@ int eof_ghl_import_common(const char *fn)
 		}
 		if(!eof_song->tags->accurate_ts)
 		{	//If accurate TS is not enabled in song properties
-			allegro_message("The accurate TS option in song properties will be enabled as it is required by GHL charts.");
+			eof_message("The accurate TS option in song properties will be enabled as it is required by GHL charts.");
 			eof_log("\tGHL:  \tEnabling accurate TS", 1);
 			eof_song->tags->accurate_ts = 1;
 		}
@@ -3515,7 +3515,7 @@ int eof_ghl_import_common(const char *fn)
 						eof_log(eof_log_string, 1);
 						if(!mid_beat_ts_warned)
 						{
-							allegro_message("Notice:  At least one mid beat time signature change was found.");
+							eof_message("Notice:  At least one mid beat time signature change was found.");
 							mid_beat_ts_warned = 1;
 						}
 					}
@@ -3572,7 +3572,7 @@ int eof_ghl_import_common(const char *fn)
 							mid_beat_change = 1;
 							if(!mid_beat_tempo_warned)
 							{
-								allegro_message("Warning:  At least one mid beat tempo change was found.");
+								eof_message("Warning:  At least one mid beat tempo change was found.");
 								mid_beat_tempo_warned = 1;
 							}
 							if(beat && (eof_song->beat[beat]->midi_pos > changes[ctr].delta))
@@ -3729,7 +3729,7 @@ int eof_ghl_import_common(const char *fn)
 		}
 		if(eventpos > eventendpos)
 		{
-			allegro_message("Error:  Malformed file (note has a negative length)");
+			eof_message("Error:  Malformed file (note has a negative length)");
 			eof_log("Error:  Malformed file (note has a negative length)", 1);
 			eof_filebuffer_close(fb);	//Close the file buffer
 			return 1;
@@ -3788,7 +3788,7 @@ int eof_ghl_import_common(const char *fn)
 				{	//If the lyric is at least one character long
 					if((eof_selected_track != EOF_TRACK_VOCALS) && !lyricwarn)
 					{	//If this is a vocal file but the vocal track is not active, and the user wasn't warned about this yet
-						allegro_message("Warning:  The file contains lyrics and will import into PART VOCALS instead of the active instrument track.");
+						eof_message("Warning:  The file contains lyrics and will import into PART VOCALS instead of the active instrument track.");
 						lyricwarn = 1;
 					}
 
@@ -3834,7 +3834,7 @@ int eof_ghl_import_common(const char *fn)
 					if(!newlyric)
 					{	//If the lyric was not created
 						eof_log("\tGHL:  \t\t\tFailed to add note", 1);
-						allegro_message("Error:  Could not add lyric.");
+						eof_message("Error:  Could not add lyric.");
 						eof_filebuffer_close(fb);	//Close the file buffer
 						return 1;	//Return failure
 					}
@@ -3858,7 +3858,7 @@ int eof_ghl_import_common(const char *fn)
 				{	//If there have been no lyrics in this line
 					if(!linewarned)
 					{	//If the user wasn't warned about this yet
-						allegro_message("Warning:  The file contains at least one line without lyrics that will be omitted.");
+						eof_message("Warning:  The file contains at least one line without lyrics that will be omitted.");
 						linewarned = 1;
 					}
 					eof_log("\tGHL:  \t\tIgnoring empty lyric line", 1);
@@ -4126,7 +4126,7 @@ int eof_export_ghl(EOF_SONG *sp, unsigned long track, char *fn)
 			{	//If this is a vocal percussion note
 				continue;	//Skip it
 			}
-			ptr = eof_get_note_name(sp, track, ctr);
+			ptr = eof_get_lyric_text(sp, track, ctr);
 			if(!ptr || (ptr[0] == '\0'))
 			{	//If the lyric has no text
 				continue;	//Skip it
@@ -4180,7 +4180,7 @@ int eof_export_ghl(EOF_SONG *sp, unsigned long track, char *fn)
 				continue;	//Do not export it
 			}
 
-			old_string = eof_get_note_name(sp, track, ctr);					//Store the pointer to the original string
+			old_string = eof_get_lyric_text(sp, track, ctr);					//Store the pointer to the original string
 			if(!old_string || (old_string[0] == '\0'))
 			{	//If the lyric has no text
 				continue;	//Do not export it
@@ -4952,7 +4952,7 @@ int eof_gh_read_sections_note(filebuffer *fb, EOF_SONG *sp)
 							eof_log("\t\t\t\t!This section is being added as a floating (off-beat) text event", 1);
 							if(!event_realignment_warning)
 							{	//If the user wasn't warned about this yet
-								allegro_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
+								eof_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
 								event_realignment_warning = 1;
 							}
 							flags = EOF_EVENT_FLAG_FLOATING_POS;	//The call to eof_song_add_text_event() will receive this as a floating text event
@@ -4993,7 +4993,7 @@ int eof_gh_read_sections_note(filebuffer *fb, EOF_SONG *sp)
 		{	//There were no sections loaded during this loop iteration
 			if(sectionsfound)
 			{	//If a different iteration found sections, alert the user and seek to beginning of buffer
-				allegro_message("There are no other languages detected");
+				eof_message("There are no other languages detected");
 				lastsectionpos = 0;	//The next loop iteration will rewind to beginning of file buffer (so the next pass can load the first language of sections again)
 			}
 			else
@@ -5084,7 +5084,7 @@ int eof_gh_read_sections_qb(filebuffer *fb, EOF_SONG *sp, char undo)
 										eof_log("\t\t\t\t!This section is being added as a floating (off-beat) text event", 1);
 										if(!event_realignment_warning)
 										{	//If the user wasn't warned about this yet
-											allegro_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
+											eof_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
 											event_realignment_warning = 1;
 										}
 										flags = EOF_EVENT_FLAG_FLOATING_POS;	//The call to eof_song_add_text_event() will receive this as a floating text event
@@ -5162,7 +5162,7 @@ int eof_gh_read_sections_qb(filebuffer *fb, EOF_SONG *sp, char undo)
 													eof_log("\t\t\t\t!This section is being added as a floating (off-beat) text event", 1);
 													if(!event_realignment_warning)
 													{	//If the user wasn't warned about this yet
-														allegro_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
+														eof_message("Note:  At least one section was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
 														event_realignment_warning = 1;
 													}
 													flags = EOF_EVENT_FLAG_FLOATING_POS;	//The call to eof_song_add_text_event() will receive this as a floating text event
@@ -5236,7 +5236,7 @@ int eof_gh_read_sections_qb(filebuffer *fb, EOF_SONG *sp, char undo)
 		{	//There were no sections loaded during this loop iteration
 			if(sectionsfound)
 			{	//If a different iteration found sections, alert the user and seek to beginning of buffer
-				allegro_message("There are no other languages detected");
+				eof_message("There are no other languages detected");
 				lastsectionpos = 0;	//The next loop iteration will rewind to beginning of section name file buffer (so the next pass can load the first language of sections again)
 			}
 			else
@@ -5251,7 +5251,7 @@ int eof_gh_read_sections_qb(filebuffer *fb, EOF_SONG *sp, char undo)
 					char * sectionfn;
 
 					eof_clear_input();
-					if(alert("No section names were found.", "Specify another file PAK or TXT file to try?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+					if(eof_alert("No section names were found.", "Specify another file PAK or TXT file to try?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 					{	//If user opts not to try looking for section names in another file
 						eof_show_mouse(NULL);
 						eof_cursor_visible = 1;
@@ -5277,7 +5277,7 @@ int eof_gh_read_sections_qb(filebuffer *fb, EOF_SONG *sp, char undo)
 					sections_file = eof_filebuffer_load(sectionfn);
 					if(sections_file == NULL)
 					{	//Section names file failed to buffer
-						allegro_message("Error:  Failed to buffer section name file");
+						eof_message("Error:  Failed to buffer section name file");
 					}
 					else
 					{	//Section names file buffered successfully
@@ -5512,7 +5512,7 @@ int eof_import_array_txt(const char *filename, char *undo_made)
 	{	//Import notes
 		if(eof_song->track[eof_selected_track]->track_format != EOF_LEGACY_TRACK_FORMAT)
 		{	//If a legacy track isn't active
-			allegro_message("Cannot import GH instrument notes in a pro guitar or vocal track.");
+			eof_message("Cannot import GH instrument notes in a pro guitar or vocal track.");
 			failed = 11;	//Invalid destination track
 			return failed;
 		}
@@ -5520,7 +5520,7 @@ int eof_import_array_txt(const char *filename, char *undo_made)
 		{	//Prompt for which HOPO threshold to use, but only if the HOPOs won't be explicitly marked per-note
 			int selection;
 
-			selection = alert("GH3/GHA charts can have one of two HOPO thresholds.", "Which should EOF use?", NULL, "66/192 qnote", "100/192 qnote", 0, 0);
+			selection = eof_alert("GH3/GHA charts can have one of two HOPO thresholds.", "Which should EOF use?", NULL, "66/192 qnote", "100/192 qnote", 0, 0);
 			if(selection == 2)
 			{	//If the user selected the 100/192 threshold
 				threshold = 100.0 / 192.0;
@@ -5539,13 +5539,13 @@ int eof_import_array_txt(const char *filename, char *undo_made)
 		{	//If at least two beat timings are in the active project
 			if(eof_gh_import_sustain_threshold_prompt)
 			{	//If the user enabled the import preference to ask to apply this threshold
-				if(alert(NULL, "Apply the sustain threshold (half of the first beat's length) to imported notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert(NULL, "Apply the sustain threshold (half of the first beat's length) to imported notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 				{	//If user opts to enforce the threshold
 					eof_gh_import_sustain_threshold = (eof_song->beat[1]->pos - eof_song->beat[0]->pos) / 2;	//The threshold is half the first beat length, rounded down
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tGH:  The sustain threshold of %lums is being enforced.", eof_gh_import_sustain_threshold);
 					eof_log(eof_log_string, 1);
 
-					if(alert("Also apply sustain trimming (half the sustain threshold)", NULL, "to imported notes that pass the sustain threshold?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("Also apply sustain trimming (half the sustain threshold)", NULL, "to imported notes that pass the sustain threshold?", "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to apply sustain trimming
 						eof_gh_import_sustain_trim = eof_gh_import_sustain_threshold / 2;
 						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tGH:  The sustain trim of %lums is being enforced.", eof_gh_import_sustain_trim);
@@ -5848,7 +5848,7 @@ int eof_import_array_txt(const char *filename, char *undo_made)
 					{
 						if(!eof_gh_accent_prompt)
 						{	//If the user wasn't prompted about which game this chart is from
-							if(alert("Is this chart from any of the following GH games?", "\"Warriors of Rock\", \"Band Hero\", \"Guitar Hero 5\"", "(These use a different accent notation than Smash Hits)", "&Yes", "&No", 'y', 'n') == 1)
+							if(eof_alert("Is this chart from any of the following GH games?", "\"Warriors of Rock\", \"Band Hero\", \"Guitar Hero 5\"", "(These use a different accent notation than Smash Hits)", "&Yes", "&No", 'y', 'n') == 1)
 							{	//If user indicates the chart is from Warriors of Rock
 								eof_gh_accent_prompt = 1;
 							}
@@ -5923,8 +5923,7 @@ int eof_import_array_txt(const char *filename, char *undo_made)
 
 				if(eof_log_level > 1)
 				{
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tGH:  Added note:  pos = %ld, len = %ld, mask = %ld, diff = %d", position, length, fixednote, eof_note_type);
-					eof_log(eof_log_string, 2);
+					eof_logf(2, "\t\tGH:  Added note:  pos = %ld, len = %ld, mask = %ld, diff = %d", position, length, fixednote, eof_note_type);
 				}
 
 				//Apply disjointed status if appropriate
@@ -6141,7 +6140,7 @@ int eof_gh_import_sustained_bass_drum_check(EOF_SONG *sp, unsigned long track, i
 				unsigned long flags = eof_get_note_flags(sp, track, ctr);
 				if(!user_alerted && !suppress)
 				{	//If the user wasn't told about this yet, and the message isn't being suppressed
-					allegro_message("Notice:  At least one sustained bass drum note was imported.  It will be highlighted and may need to be manually altered in order to work as desired in Clone Hero/Strikeline.");
+					eof_message("Notice:  At least one sustained bass drum note was imported.  It will be highlighted and may need to be manually altered in order to work as desired in Clone Hero/Strikeline.");
 					user_alerted = 1;
 				}
 				eof_set_note_flags(sp, track, ctr, flags | EOF_NOTE_FLAG_HIGHLIGHT);	//Highlight the note
@@ -7,13 +7,13 @@
 #include <allegro.h>
 #include <assert.h>
 #include "beat.h"
-#include "chart_import.h"	//For FindLongestLineLength_ALLEGRO()
 #include "main.h"
 #include "midi.h"
 #include "rs.h"
 #include "song.h"
 #include "tuning.h"
 #include "undo.h"
+#include "utility.h"	//For eof_text_fopen() and eof_xml_find_tag()
 #include "foflc/RS_parse.h"	//For shrink_xml_text()
 #include "menu/track.h"	//For tech view functions
 #endif
@@ -1662,7 +1662,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 	unsigned char usedtie;	//Tracks which strings in an imported note were tie notes
 	unsigned word = 0, fileversion;
 	unsigned long dword = 0, ctr, ctr2, ctr3, ctr4, ctr5, tracks = 0, measures = 0, *strings, beats = 0;
-	PACKFILE *inf = NULL, *inf2;	//The GPA import logic will open the file handle for the Guitar Pro file in inf if applicable
+	PACKFILE *inf = NULL;	//The GPA import logic will open the file handle for the Guitar Pro file in inf if applicable
 	struct eof_guitar_pro_struct *gp = NULL;
 	struct eof_gp_measure *tsarray;	//Stores measure information relating to time signatures, alternate endings and navigational symbols
 	EOF_PRO_GUITAR_NOTE **np;	//Will store the last created note for each track (for handling tie and grace notes)
@@ -1703,7 +1703,8 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 	char import_ts = 0;		//Will be set to nonzero if user opts to import time signatures
 	char note_is_short = 0;	//Will be set to nonzero if the note being parsed should have its sustain dropped (ie. shorter than a quarter note or is played staccato), pending techniques that overrule this
 	char parse_gpa = 0;		//Will be set to nonzero if the specified file is detected to be XML, in which case, the Go PlayAlong file will be parsed
-	size_t maxlinelength;
+	EOF_TEXT_FILE *inf2;	//The input file, buffered to check whether it is a Go PlayAlong XML file
+	EOF_XML_TAG xmltag;		//The last tag tokenized from the Go PlayAlong XML file
 	unsigned long linectr = 2, num_sync_points = 0, raw_num_sync_points = 0;
 	struct eof_gpa_sync_point *sync_points = NULL, temp_sync_point = {0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0};
 	char error = 0;
@@ -1727,39 +1728,24 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 
 
 //First, parse the input file to see if it is a Go PlayAlong XML file
-	//Allocate memory buffers large enough to hold any line in this file
-	inf2 = pack_fopen(fn, "rt");
+	inf2 = eof_text_fopen(fn);	//Buffer the file so it can be parsed in a single pass
 	if(!inf2)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError loading:  Cannot open input GP file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
-		eof_log(eof_log_string, 1);
-		return NULL;
-	}
-	maxlinelength = (size_t)FindLongestLineLength_ALLEGRO(fn, 0);
-	if(!maxlinelength)
-	{
-		eof_log("\tError finding the largest line in the file.  Aborting", 1);
-		(void) pack_fclose(inf2);
+		eof_log("\tError loading:  Cannot buffer input GP file", 1);
 		return NULL;
 	}
-	buffer2 = (char *)malloc(maxlinelength);
-	if(!buffer2)
-	{
-		eof_log("\tError allocating memory (1).  Aborting", 1);
-		(void) pack_fclose(inf2);
-		return NULL;
-	}
-	if(pack_fgets(buffer2, (int)maxlinelength, inf2))
-	{	//If the line was read
-		if(strcasestr_spec(buffer2, "<?xml") || strcasestr_spec(buffer2, "<song"))
+	if(!eof_text_feof(inf2))
+	{	//If there is a line to read
+		buffer2 = eof_text_fgets(inf2);
+		if(eof_xml_find_tag(buffer2, "?xml", &xmltag) || eof_xml_find_tag(buffer2, "song", &xmltag))
 		{	//If the file is determined to be XML based
 			if(eof_song->tags->tempo_map_locked)
 			{	//If the user has locked the tempo map
 				eof_clear_input();
-				if(alert(NULL, "The tempo map must be unlocked in order to import a Go PlayAlong file.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+				if(eof_alert(NULL, "The tempo map must be unlocked in order to import a Go PlayAlong file.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 				{	//If the user does not opt to unlock the tempo map
 					eof_log("\tUser cancellation.  Aborting", 1);
-					(void) pack_fclose(inf2);
+					eof_text_fclose(inf2);
 					return NULL;
 				}
 				eof_song->tags->tempo_map_locked = 0;	//Unlock the tempo map
@@ -1775,15 +1761,16 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 		char identity = 0;	//Set to 1 if any Go PlayAlong tags are found, 2 if a Rocksmith phrase tag is found
 
 		eof_log("\tParsing Go PlayAlong file", 1);
-		if(!pack_fgets(buffer2, (int)maxlinelength, inf2))
-		{	//I/O error
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tGo PlayAlong import failed on line #%lu:  Unable to read from file:  \"%s\"", linectr, strerror(errno));
+		if(eof_text_feof(inf2))
+		{	//If there is no second line
+			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tGo PlayAlong import failed on line #%lu:  Unexpected end of file", linectr);
 			eof_log(eof_log_string, 1);
 			error = 1;
 		}
-		while(!error && !pack_feof(inf2))
+		buffer2 = eof_text_fgets(inf2);
+		while(!error && !eof_text_feof(inf2))
 		{	//Until there was an error reading from the file or end of file is reached
-			ptr = strcasestr_spec(buffer2, "<scoreUrl>");	//Find the beginning of the GP file name, if present on this line
+			ptr = eof_xml_find_tag(buffer2, "scoreUrl", &xmltag);	//Find the beginning of the GP file name, if present on this line
 			if(ptr)
 			{	//If the GP file name was present, parse it into a buffer
 				identity = 1;
@@ -1822,7 +1809,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 				gpfile = eof_temp_filename;	//Point gpfile to the name of the GP file to parse
 			}
 
-			ptr = strcasestr_spec(buffer2, "<sync>");
+			ptr = eof_xml_find_tag(buffer2, "sync", &xmltag);
 			if(ptr)
 			{	//If the sync tag is present
 				identity = 1;
@@ -1907,7 +1894,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 				}
 			}//If the sync tag is present
 
-			ptr = strcasestr_spec(buffer2, "<phrases");
+			ptr = eof_xml_find_tag(buffer2, "phrases", &xmltag);
 			if(ptr)
 			{	//If a phrases tag (Rocksmith XML file) is present
 				identity = 2;
@@ -1915,7 +1902,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 				error = 1;
 			}
 
-			(void) pack_fgets(buffer2, (int)maxlinelength, inf2);	//Read next line of text
+			buffer2 = eof_text_fgets(inf2);	//Read next line of text
 			linectr++;	//Increment line counter
 		}//Until there was an error reading from the file or end of file is reached
 		if(error)
@@ -1923,28 +1910,26 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			switch(identity)
 			{
 				case 0:	//Unknown XML file
-					allegro_message("Error:  The format of this XML file is unknown.  Aborting");
+					eof_message("Error:  The format of this XML file is unknown.  Aborting");
 				break;
 				case 1:	//Go PlayAlong XML file
-					allegro_message("Error:  Malformed Go PlayAlong XML file.  Aborting");
+					eof_message("Error:  Malformed Go PlayAlong XML file.  Aborting");
 				break;
 				case 2:	//Rocksmith XML file
-					allegro_message("This appears to be a Rocksmith XML file.  Use \"File>Rocksmith Import\" instead.");
+					eof_message("This appears to be a Rocksmith XML file.  Use \"File>Rocksmith Import\" instead.");
 				break;
 				default:
 				break;
 			}
 			if(inf)
 				(void) pack_fclose(inf);
-			(void) pack_fclose(inf2);
+			eof_text_fclose(inf2);
 			if(sync_points)
 				free(sync_points);
-			free(buffer2);
 			return NULL;
 		}
 	}//If the input file was determined to be an XML file
-	(void) pack_fclose(inf2);
-	free(buffer2);
+	eof_text_fclose(inf2);
 
 
 //Initialize pointers and handles
@@ -2048,7 +2033,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 	}
 	else
 	{
-		allegro_message("File format version not supported\n(make sure it's GP5 format or older)");
+		eof_message("File format version not supported\n(make sure it's GP5 format or older)");
 		eof_log("File format version not supported", 1);
 		(void) pack_fclose(inf);
 		free(gp);
@@ -2340,7 +2325,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 	}
 	for(ctr = 0; ctr < tracks; ctr++)
 	{	//Initialize each pro guitar track
-		gp->track[ctr] = malloc(sizeof(EOF_PRO_GUITAR_TRACK));
+		gp->track[ctr] = eof_create_pro_guitar_track();
 		if(!gp->track[ctr])
 		{
 			eof_log("Error allocating memory (8)", 1);
@@ -2349,7 +2334,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			free(gp->instrument_types);
 			while(ctr > 0)
 			{	//Free all previously allocated track structures
-				free(gp->track[ctr - 1]);
+				eof_free_pro_guitar_track(gp->track[ctr - 1]);
 				ctr--;
 			}
 			free(gp->track);	//Free array of track pointers
@@ -2365,9 +2350,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 				free(sync_points);
 			return NULL;
 		}
-		memset(gp->track[ctr], 0, sizeof(EOF_PRO_GUITAR_TRACK));	//Initialize memory block to 0 to avoid crashes when not explicitly setting counters that were newly added to the pro guitar structure
 		gp->track[ctr]->numfrets = 22;
-		gp->track[ctr]->note = gp->track[ctr]->pgnote;	//Put the regular pro guitar note array into effect
 		gp->track[ctr]->parent = NULL;
 	}
 
@@ -2385,7 +2368,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 		{	//Free all previously allocated track structures
 			if(gp->track[ctr])
 			{	//Redundant NULL check to satisfy Splint
-				free(gp->track[ctr]);
+				eof_free_pro_guitar_track(gp->track[ctr]);
 			}
 		}
 		free(gp->track);
@@ -2480,7 +2463,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 							{	//Free all previously allocated track structures
 								if(gp->track[ctr])
 								{	//Redundant NULL check to satisfy Splint
-									free(gp->track[ctr]);
+									eof_free_pro_guitar_track(gp->track[ctr]);
 								}
 							}
 							for(ctr = 0; ctr < gp->text_events; ctr++)
@@ -2547,7 +2530,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 							free(gp->instrument_types);
 							for(ctr = 0; ctr < tracks; ctr++)
 							{	//Free all previously allocated track structures
-								free(gp->track[ctr]);
+								eof_free_pro_guitar_track(gp->track[ctr]);
 							}
 							for(ctr = 0; ctr < gp->text_events; ctr++)
 							{	//Free all allocated text events
@@ -2647,7 +2630,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			{	//Free all previously allocated track structures
 				if(gp->track[ctr])
 				{	//Redundant NULL check to satisfy Splint
-					free(gp->track[ctr]);
+					eof_free_pro_guitar_track(gp->track[ctr]);
 				}
 			}
 			for(ctr = 0; ctr < gp->text_events; ctr++)
@@ -2676,7 +2659,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 		if(eof_use_ts && !eof_song->tags->tempo_map_locked)
 		{	//If user has enabled the preference to import time signatures, and the project's tempo map isn't locked (skip the prompt if importing a Go PlayAlong file)
 			eof_clear_input();
-			if(alert(NULL, "Import Guitar Pro file's time signatures?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Import Guitar Pro file's time signatures?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to import those from this Guitar Pro file into the active project
 				import_ts = 1;
 				if(undo_made && (*undo_made == 0))
@@ -2688,7 +2671,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 		}
 		else
 		{	//TS change importing is being skipped
-			allegro_message("To allow time signatures to be imported, ensure the \"Import/Export TS\" preference is enabled and the tempo map isn't locked");
+			eof_message("To allow time signatures to be imported, ensure the \"Import/Export TS\" preference is enabled and the tempo map isn't locked");
 		}
 	}
 	else
@@ -2765,7 +2748,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			free(gp->instrument_types);
 			for(ctr = 0; ctr < tracks; ctr++)
 			{	//Free all previously allocated track structures
-				free(gp->track[ctr]);
+				eof_free_pro_guitar_track(gp->track[ctr]);
 			}
 			for(ctr = 0; ctr < gp->text_events; ctr++)
 			{	//Free all allocated text events
@@ -2941,7 +2924,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 				//Remove the appropriate number of beats from the front of the beat array so that beat 0 is the first one with a positive timestamp
 				if(skipbeatsourcectr)
 				{	//If any beats were positioned before 0ms
-					allegro_message("Warning:  This Go PlayAlong file is synchronized in a way that puts one or more beats before the start of the audio, these beats will be omitted from the import.");
+					eof_message("Warning:  This Go PlayAlong file is synchronized in a way that puts one or more beats before the start of the audio, these beats will be omitted from the import.");
 #ifdef GP_IMPORT_DEBUG
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t%lu beats are positioned before 0ms, they will be omitted from import", skipbeatsourcectr);
 					eof_log(eof_log_string, 1);
@@ -3028,7 +3011,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			free(gp->instrument_types);
 			for(ctr = 0; ctr < tracks; ctr++)
 			{	//Free all previously allocated track structures
-				free(gp->track[ctr]);
+				eof_free_pro_guitar_track(gp->track[ctr]);
 			}
 			for(ctr = 0; ctr < gp->text_events; ctr++)
 			{	//Free all allocated text events
@@ -3070,7 +3053,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			free(gp->instrument_types);
 			for(ctr = 0; ctr < tracks; ctr++)
 			{	//Free all previously allocated track structures
-				free(gp->track[ctr]);
+				eof_free_pro_guitar_track(gp->track[ctr]);
 			}
 			for(ctr = 0; ctr < gp->text_events; ctr++)
 			{	//Free all allocated text events
@@ -3094,7 +3077,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 			if(!string_warning)
 			{
 				eof_clear_input();
-				if(alert("Warning:  At least one track uses 7 strings.", "Only 6 can be used.  Drop which string?", "(If you want to use the standard 6 strings, drop string 7)", "&1 (thinnest)", "&7 (thickest)", '1', '7') == 2)
+				if(eof_alert("Warning:  At least one track uses 7 strings.", "Only 6 can be used.  Drop which string?", "(If you want to use the standard 6 strings, drop string 7)", "&1 (thinnest)", "&7 (thickest)", '1', '7') == 2)
 				{	//If the user opts to drop string 7
 					drop_7 = 1;
 				}
@@ -3256,7 +3239,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 						{	//Free all tech notes in this track
 							free(gp->track[ctr]->technote[ctr2]);
 						}
-						free(gp->track[ctr]);
+						eof_free_pro_guitar_track(gp->track[ctr]);
 					}
 					for(ctr = 0; ctr < gp->text_events; ctr++)
 					{	//Free all allocated text events
@@ -3308,7 +3291,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 					{	//If it's an invalid note length
 						if(!user_warned)
 						{
-							allegro_message("Warning:  This file has an invalid note length of %d and is probably corrupt", byte);
+							eof_message("Warning:  This file has an invalid note length of %d and is probably corrupt", byte);
 						}
 						user_warned = 1;
 						byte = 4;
@@ -3560,7 +3543,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 										{	//Free all tech notes in this track
 											free(gp->track[ctr]->technote[ctr2]);
 										}
-										free(gp->track[ctr]);
+										eof_free_pro_guitar_track(gp->track[ctr]);
 									}
 									for(ctr = 0; ctr < gp->text_events; ctr++)
 									{	//Free all allocated text events
@@ -3658,7 +3641,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 						{	//Tremolo bar
 							if(eof_gp_parse_bend(inf, NULL))
 							{	//If there was an error parsing the bend
-								allegro_message("Error parsing bend, file is corrupt");
+								eof_message("Error parsing bend, file is corrupt");
 								(void) pack_fclose(inf);
 								for(ctr = 0; ctr < tracks; ctr++)
 								{	//Free the previous track name strings
@@ -3676,7 +3659,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 									{	//Free all tech notes in this track
 										free(gp->track[ctr]->technote[ctr2]);
 									}
-									free(gp->track[ctr]);
+									eof_free_pro_guitar_track(gp->track[ctr]);
 								}
 								for(ctr = 0; ctr < gp->text_events; ctr++)
 								{	//Free all allocated text events
@@ -3883,7 +3866,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 								{	//Free all tech notes in this track
 									free(gp->track[ctr]->technote[ctr2]);
 								}
-								free(gp->track[ctr]);
+								eof_free_pro_guitar_track(gp->track[ctr]);
 							}
 							for(ctr = 0; ctr < gp->text_events; ctr++)
 							{	//Free all allocated text events
@@ -4038,7 +4021,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 								}
 								if(eof_gp_parse_bend(inf, &bendstruct) || (bendstruct.bendpoints > 30))
 								{	//If there was an error parsing the bend, or if bendpoints wasn't capped at 30 (a redundant check to satisfy a false positive in Coverity)
-									allegro_message("Error parsing bend, file is corrupt");
+									eof_message("Error parsing bend, file is corrupt");
 									(void) pack_fclose(inf);
 									for(ctr = 0; ctr < tracks; ctr++)
 									{	//Free the previous track name strings
@@ -4056,7 +4039,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 										{	//Free all tech notes in this track
 											free(gp->track[ctr]->technote[ctr2]);
 										}
-										free(gp->track[ctr]);
+										eof_free_pro_guitar_track(gp->track[ctr]);
 									}
 									for(ctr = 0; ctr < gp->text_events; ctr++)
 									{	//Free all allocated text events
@@ -4124,7 +4107,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 												{	//Free all tech notes in this track
 													free(gp->track[ctr]->technote[ctr2]);
 												}
-												free(gp->track[ctr]);
+												eof_free_pro_guitar_track(gp->track[ctr]);
 											}
 											for(ctr = 0; ctr < gp->text_events; ctr++)
 											{	//Free all allocated text events
@@ -4377,7 +4360,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 								}//Version 5 or newer GP file
 								if(slide_in_from_warned == 1)
 								{	//If this is the first slide in from above/below technique encountered, warn user
-									allegro_message("Imported slide in from above/below notes will be highlighted, as Rocksmith does not directly support this technique.");
+									eof_message("Imported slide in from above/below notes will be highlighted, as Rocksmith does not directly support this technique.");
 									slide_in_from_warned++;	//Change the value so this prompt isn't immediately triggered on the next loop iteration
 								}
 							}//Slide
@@ -4542,7 +4525,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 									{	//Free all tech notes in this track
 										free(gp->track[ctr]->technote[ctr2]);
 									}
-									free(gp->track[ctr]);
+									eof_free_pro_guitar_track(gp->track[ctr]);
 								}
 								for(ctr = 0; ctr < gp->text_events; ctr++)
 								{	//Free all allocated text events
@@ -4586,7 +4569,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 							np[ctr2]->legacymask = 0;
 							np[ctr2]->midi_length = 0;
 							np[ctr2]->midi_pos = 0;
-							np[ctr2]->name[0] = '\0';
+							np[ctr2]->name = eof_intern_note_name(NULL);
 							if(strings[ctr2] > 6)
 							{	//If this is a 7 string track
 								if(effective_drop_7)
@@ -4702,7 +4685,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 									{	//Free all tech notes in this track
 										free(gp->track[ctr]->technote[ctr2]);
 									}
-									free(gp->track[ctr]);
+									eof_free_pro_guitar_track(gp->track[ctr]);
 								}
 								for(ctr = 0; ctr < gp->text_events; ctr++)
 								{	//Free all allocated text events
@@ -4951,7 +4934,7 @@ struct eof_guitar_pro_struct *eof_load_gp(const char * fn, char *undo_made)
 	{	//For each imported track
 		if(eof_unwrap_gp_track(gp, ctr, import_ts, 0))
 		{	//If the track failed to unwrap
-			allegro_message("Warning:  Failed to unwrap repeats for track #%lu (%s).", ctr + 1, gp->names[ctr]);
+			eof_message("Warning:  Failed to unwrap repeats for track #%lu (%s).", ctr + 1, gp->names[ctr]);
 		}
 		import_ts = 0;	//Only unwrap the time signatures on the first pass
 	}
@@ -5072,7 +5055,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 	memcpy(working_symbols, gp->symbols, sizeof(working_symbols));
 
 	//Create a new pro guitar track structure to unwrap into
-	tp = malloc(sizeof(EOF_PRO_GUITAR_TRACK));
+	tp = eof_create_pro_guitar_track();
 	if(!tp)
 	{
 		eof_log("\tError allocating memory to unwrap GP track (2)", 1);
@@ -5080,10 +5063,8 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 		eof_destroy_song(dsp);	//Destroy working project
 		return 2;
 	}
-	memset(tp, 0, sizeof(EOF_PRO_GUITAR_TRACK));	//Initialize memory block to 0 to avoid crashes when not explicitly setting counters that were newly added to the pro guitar structure
 	tp->numfrets = gp->track[track]->numfrets;
 	tp->numstrings = gp->track[track]->numstrings;
-	tp->note = tp->pgnote;	//Put the regular pro guitar note array into effect
 	tp->parent = NULL;
 	memcpy(tp->tuning, gp->track[track]->tuning, sizeof(char) * EOF_TUNING_LENGTH);
 
@@ -5092,7 +5073,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 	if(!measuremap)
 	{
 		eof_log("\tError allocating memory to unwrap GP track (3)", 1);
-		free(tp);
+		eof_free_pro_guitar_track(tp);
 		free(working_num_of_repeats);
 		eof_destroy_song(dsp);	//Destroy working project
 		return 3;
@@ -5121,7 +5102,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 			if(!eof_song_add_beat(dsp))
 			{	//If another beat couldn't be added
 				eof_log("\tError allocating memory to unwrap GP track (4)", 1);
-				free(tp);
+				eof_free_pro_guitar_track(tp);
 				free(working_num_of_repeats);
 				free(measuremap);
 				eof_destroy_song(dsp);	//Destroy working project
@@ -5187,7 +5168,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 				{
 					eof_log("\tError allocating memory to unwrap GP track (5)", 1);
 					free(measuremap);
-					free(tp);
+					eof_free_pro_guitar_track(tp);
 					free(working_num_of_repeats);
 					for(ctr = 0; ctr < newevents; ctr++)
 					{	//For each unwrapped text event
@@ -5226,7 +5207,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 					{	//For each note that had been allocated for the unwrapped track
 						free(tp->note[ctr]);	//Free its memory
 					}
-					free(tp);
+					eof_free_pro_guitar_track(tp);
 					free(working_num_of_repeats);
 					for(ctr = 0; ctr < newevents; ctr++)
 					{	//For each unwrapped text event
@@ -5251,7 +5232,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 					{	//For each note that had been allocated for the unwrapped track
 						free(tp->note[ctr]);	//Free its memory
 					}
-					free(tp);
+					eof_free_pro_guitar_track(tp);
 					free(working_num_of_repeats);
 					for(ctr = 0; ctr < newevents; ctr++)
 					{	//For each unwrapped text event
@@ -5290,7 +5271,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 						{	//For each note that had been allocated for the unwrapped track
 							free(tp->note[ctr]);	//Free its memory
 						}
-						free(tp);
+						eof_free_pro_guitar_track(tp);
 						free(working_num_of_repeats);
 						for(ctr = 0; ctr < newevents; ctr++)
 						{	//For each unwrapped text event
@@ -5524,7 +5505,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 	{	//For each tech note in the target track
 		free(gp->track[track]->technote[ctr]);	//Free its memory
 	}
-	free(gp->track[track]);	//Free the pro guitar track
+	eof_free_pro_guitar_track(gp->track[track]);	//Free the pro guitar track
 	gp->track[track] = tp;	//Insert the new pro guitar track into the array
 
 	//Replace the active project's beat map with that of the working project
@@ -5535,7 +5516,7 @@ int eof_unwrap_gp_track(struct eof_guitar_pro_struct *gp, unsigned long track, c
 			if(!eof_song_add_beat(eof_song))
 			{	//If another beat couldn't be added
 				eof_log("\tError allocating memory to unwrap GP track (9)", 1);
-				free(tp);
+				eof_free_pro_guitar_track(tp);
 				free(working_num_of_repeats);
 				free(measuremap);
 				eof_destroy_song(dsp);	//Destroy working project
@@ -5619,9 +5600,9 @@ char eof_copy_notes_in_beat_range(EOF_SONG *ssp, EOF_PRO_GUITAR_TRACK *source, u
 			eof_log("\tError finding position for unwrapped note", 1);
 			return 0;	//Return error
 		}
-		if(dest->notes >= EOF_MAX_NOTES)
-		{	//If the track can't hold any more notes
-			eof_log("\tNote limit exceeded", 1);
+		if(!eof_pro_guitar_track_reserve_notes(dest, dest->notes + 1, (dest->note == dest->technote)))
+		{	//If the note array couldn't grow
+			eof_log("\tError allocating memory", 1);
 			return 0;	//Return error
 		}
 		dest->note[dest->notes] = malloc(sizeof(EOF_PRO_GUITAR_NOTE));	//Allocate memory for the copied note
@@ -171,7 +171,7 @@ int eof_save_ini(EOF_SONG * sp, char * fn, char silent)
 			{	//If the user manually defined the GHL guitar difficulty
 				if(!guitar_ghl_diff_conflict_warned && !silent)
 				{	//If the user wasn't warned about this already and warnings aren't being suppressed
-					allegro_message("Warning:  A GHL mode guitar track defines a difficulty that is overridden by a manually defined INI entry.");
+					eof_message("Warning:  A GHL mode guitar track defines a difficulty that is overridden by a manually defined INI entry.");
 					guitar_ghl_diff_conflict_warned = 1;
 				}
 				continue;	//Skip this INI setting
@@ -183,7 +183,7 @@ int eof_save_ini(EOF_SONG * sp, char * fn, char silent)
 			{	//If the user manually defined the GHL bass difficulty
 				if(!bass_ghl_diff_conflict_warned && !silent)
 				{	//If the user wasn't warned about this already and warnings aren't being suppressed
-					allegro_message("Warning:  A GHL mode bass track defines a difficulty that is overridden by a manually defined INI entry.");
+					eof_message("Warning:  A GHL mode bass track defines a difficulty that is overridden by a manually defined INI entry.");
 					bass_ghl_diff_conflict_warned = 1;
 				}
 				continue;	//Skip this INI setting
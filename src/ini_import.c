@@ -233,7 +233,7 @@ int eof_import_ini(EOF_SONG * sp, char * fn, int function)
 			}
 			if(eof_find_ini_setting_tag(sp, &index, "year") && (sp->tags->year[0] != '\0'))
 			{	//If the project has both a "year" custom INI setting AND a "year" numerical setting
-				allegro_message("Warning:  This project contains both a numerical and a non numerical year tag, one should be removed manually");
+				eof_message("Warning:  This project contains both a numerical and a non numerical year tag, one should be removed manually");
 			}
 		}
 		else if(!ustricmp(eof_import_ini_setting[i].type, "loading_phrase"))
@@ -547,7 +547,7 @@ int eof_compare_set_ini_string_field(char *dest, char *src, int *function, char
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Song property \"%s\" altered in INI file", tag);
 		eof_log(eof_log_string, 1);
 		eof_clear_input();
-		if(alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user did not opt to merge the changes into the project
 			return 1;	//Return user cancellation
 		}
@@ -557,7 +557,7 @@ int eof_compare_set_ini_string_field(char *dest, char *src, int *function, char
 
 	if(ustrsize(src) >= buffersize)
 	{
-		allegro_message("Warning:  The INI value for tag \"%s\" is longer than allowed and will be truncated.", tag);
+		eof_message("Warning:  The INI value for tag \"%s\" is longer than allowed and will be truncated.", tag);
 	}
 	(void) ustrncpy(dest, src, buffersize - 1);	//Copy the string, preventing buffer overflow
 	return 0;
@@ -582,7 +582,7 @@ int eof_compare_set_ini_boolean(char *status, char original, char *string, int *
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Song boolean \"%s\" altered in INI file", tag);
 		eof_log(eof_log_string, 1);
 		eof_clear_input();
-		if(alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user did not opt to merge the changes into the project
 			return 1;	//Return user cancellation
 		}
@@ -631,7 +631,7 @@ int eof_compare_set_ini_string_setting(EOF_SONG *sp, char *tag, char *value, int
 	if(*function)
 	{	//If the calling function wanted to prompt the user before changing/adding an INI setting
 		eof_clear_input();
-		if(alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user did not opt to merge the changes into the project
 			return 1;	//Return user cancellation
 		}
@@ -678,7 +678,7 @@ int eof_compare_set_ini_pro_guitar_tuning(EOF_PRO_GUITAR_TRACK *tp, char *string
 		char changes = 0;
 		if((ctr < 4) || (ctr > 6))
 		{	//If the number of strings defined isn't supported
-			allegro_message("Warning:  Invalid pro guitar tuning tag.  Reverting to 6 string standard tuning.");
+			eof_message("Warning:  Invalid pro guitar tuning tag.  Reverting to 6 string standard tuning.");
 			ctr = 6;
 			memset(tuning, 0, EOF_TUNING_LENGTH);
 		}
@@ -694,7 +694,7 @@ int eof_compare_set_ini_pro_guitar_tuning(EOF_PRO_GUITAR_TRACK *tp, char *string
 		{	//If the INI tag defined a different number of strings, or a different tuning for any of them
 			eof_log("Pro guitar/bass tuning tag altered in INI file", 1);
 			eof_clear_input();
-			if(alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 			{	//If the user did not opt to merge the changes into the project
 				return 1;	//Return user cancellation
 			}
@@ -722,7 +722,7 @@ int eof_compare_set_ini_integer(long *value, long original, char *string, int *f
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Song property \"%s\" altered in INI file", tag);
 		eof_log(eof_log_string, 1);
 		eof_clear_input();
-		if(alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("Warning:  The INI file has been externally edited.", "Merge its changes with the active project?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user did not opt to merge the changes into the project
 			return 1;	//Return user cancellation
 		}
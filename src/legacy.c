@@ -37,8 +37,7 @@ EOF_SONG * eof_load_notes_legacy(PACKFILE * fp, char version)
 	{
 		return NULL;
 	}
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tProject file format version '%c'", version);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tProject file format version '%c'", version);
 	switch(version)
 	{
 		case 'G':
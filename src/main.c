@@ -3,6 +3,8 @@
 #include <allegro.h>
 #ifdef ALLEGRO_WINDOWS
 	#include <winalleg.h>
+#else
+	#include <unistd.h>	//For getpid()
 #endif
 #ifdef ALLEGRO_LEGACY
 	#include <a5alleg.h>
@@ -10,6 +12,9 @@
 #include <locale.h>	//For setlocale()
 #include <ctype.h>
 #include <math.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdarg.h>
 #include <sys/stat.h>
 #include <time.h>
 #include "alogg/include/alogg.h"
@@ -49,6 +54,7 @@
 #include "waveform.h"
 #include "spectrogram.h"
 #include "silence.h"
+#include "pcm.h"
 #include "tuning.h"
 #include "ini_import.h"
 #include "midi_data_import.h"	//For eof_track_overridden_by_stored_MIDI_track()
@@ -56,6 +62,7 @@
 #include "song.h"
 #include "utility.h"	//For eof_ucode_table[] declaration
 #include "pathing.h"
+#include "batch.h"
 
 #ifdef USEMEMWATCH
 #include "memwatch.h"
@@ -172,6 +179,7 @@ int         eof_gp_import_nat_harmonics_only = 0;	//If nonzero during GP import,
 int         eof_min_note_length = 0;			//Specifies the user-configured minimum length for legacy guitar/bass notes (for making Guitar Hero customs, is set to 0 if undefined)
 int         eof_enforce_chord_density = 0;		//Specifies whether repeated chords that are separated by a rest automatically have crazy status applied to force RS export as low density chords
 unsigned    eof_chord_density_threshold = 10000;	//Specifies the maximum distance between repeated chords that allows them to be marked as high density (repeat lines)
+unsigned    eof_recovery_interval = 1000;		//The number of milliseconds the auto-recovery writer thread waits for a burst of edits to settle before writing the newest undo state to disk
 unsigned    eof_min_note_distance = 3;			//Specifies the user-configured minimum distance between notes (to avoid problems with timing conversion leading to precision loss that can cause notes to combine/drop)
 unsigned    eof_min_note_distance_intervals = 0;	//If 0, the minimum distance between notes is observed to be in ms.  If 1, it's observed to be /# measure.  If 2, it's observed to be 1/# beat.
 int         eof_render_bass_drum_in_lane = 0;	//If nonzero, the 3D rendering will draw bass drum gems in a lane instead of as a bar spanning all lanes
@@ -228,7 +236,6 @@ unsigned long eof_frame = 0;
 int         eof_cpu_saver = 0;
 char        eof_has_focus = 1;				//Indicates whether EOF is in foreground focus (if set to 2, EOF just switched back into focus)
 char        eof_supports_mp3 = 0;
-char        eof_supports_oggcat = 0;		//Set to nonzero if EOF determines oggCat is usable
 int         eof_new_idle_system = 0;
 char        eof_just_played = 0;
 char        eof_mark_drums_as_cymbal = 0;		//Allows the user to specify whether Y/B/G drum notes will be placed with cymbal notation by default
@@ -244,6 +251,7 @@ int         eof_undo_toggle = 0;
 int         eof_redo_toggle = 0;
 int         eof_window_title_dirty = 0;	//This is set to true when an undo state is made and is cleared when the window title is recreated with eof_fix_window_title()
 int         eof_change_count = 0;	//Counts the number of undo states created since the last save operation
+unsigned long eof_chart_edit_counter = 0;
 int         eof_zoom = 10;			//The width of one pixel in the editor window in ms (smaller = higher zoom)
 int         eof_zoom_3d = 5;
 int         eof_3d_min_depth = -100;
@@ -304,7 +312,6 @@ int         eof_vocals_selected = 0;	//Is set to nonzero if the active track is
 unsigned    eof_vocals_tab = 0;
 int         eof_vocals_offset = 60; // Start at "middle C"
 int         eof_song_loaded = 0;	//The boolean condition that a chart and its audio are successfully loaded
-int         eof_last_note = 0;
 int         eof_last_midi_offset = 0;
 PACKFILE *  eof_recovery = NULL;
 unsigned long eof_seek_selection_start = 0, eof_seek_selection_end = 0;	//Used to track the keyboard driven note selection system in Feedback input mode.  If both variables are of equal value, no seek selection is in effect
@@ -312,9 +319,6 @@ int         eof_shift_released = 1;	//Tracks the press/release of the SHIFT keys
 int         eof_shift_used = 0;	//Tracks whether the SHIFT key was used for a keyboard shortcut while SHIFT was held
 int         eof_tab_released = 1;	//Tracks the press/release of the tab key to prevent the Allegro bug of its status getting stuck from repeatedly triggering keyboard functions
 int         eof_emergency_stop = 0;	//Set to nonzero by eof_switch_out_callback() so that playback can be stopped OUTSIDE of the callback, in EOF's main loop so that a crash with time stretched playback can be avoided
-int         ch_sp_path_worker = 0;	//Set to nonzero if EOF is launched with the -ch_sp_path_worker parameter to have it run as a worker process for star power pathing evaluation
-int         ch_sp_path_worker_logging = 0;	//Set to nonzero if EOF is launched with the -ch_sp_path_worker_logging parameter, which will allow logging to be performed during solving
-unsigned long ch_sp_path_worker_number = 0;	//Set to the number in the job filename, for creating worker-specific logging
 
 char eof_default_ini_setting[EOF_MAX_INI_SETTINGS][EOF_INI_LENGTH] = {{0}};	//Stores the entries of the [default_ini_settings] section in the config file
 unsigned short eof_default_ini_settings = 0;	//The number of such entries in memory
@@ -562,7 +566,7 @@ long eof_put_porpos_sp(EOF_SONG *sp, unsigned long beat, double porpos, double o
 
 	if(fporpos <= -1.0)
 	{	//If the target offset is behind the specified beat number
-//		allegro_message("a - %f", fporpos);	//Debug
+//		eof_message("a - %f", fporpos);	//Debug
 		while(fporpos < 0.0)
 		{	//If the position within the beat to find is negative, scale up to a positive number
 			fporpos += 100.0;
@@ -580,7 +584,7 @@ long eof_put_porpos_sp(EOF_SONG *sp, unsigned long beat, double porpos, double o
 	}
 	else if(fporpos >= 100.0)
 	{	//If the target offset is more than 100% of a beat ahead of the specified beat number
-//		allegro_message("b - %f", fporpos);	//Debug
+//		eof_message("b - %f", fporpos);	//Debug
 		while(fporpos >= 100.0)
 		{
 			fporpos -= 100.0;
@@ -592,7 +596,7 @@ long eof_put_porpos_sp(EOF_SONG *sp, unsigned long beat, double porpos, double o
 		}
 		return -1;
 	}
-//	allegro_message("c - %f", fporpos);	//Debug
+//	eof_message("c - %f", fporpos);	//Debug
 
 	if(cbeat < sp->beats)
 	{	//If cbeat is valid
@@ -1013,22 +1017,22 @@ int eof_set_display_mode(unsigned long width, unsigned long height)
 			{	//If x2 zoom display is enabled
 				eof_screen_zoom = 0;	//Disable x2 zoom
 				eof_set_display_mode(width, height);
-				allegro_message("Warning:  Failed to enable x2 zoom.\nTry setting a smaller program window size first.");
+				eof_message("Warning:  Failed to enable x2 zoom.\nTry setting a smaller program window size first.");
 				return 2;
 			}
 			if(width != eof_screen_width_default)
 			{	//If the custom width failed to be applied, revert to the default width for this window height
 				eof_set_display_mode(eof_screen_width_default, height);
-				allegro_message("Warning:  Failed to set custom display width, reverted to default.\nTry setting a different width.");
+				eof_message("Warning:  Failed to set custom display width, reverted to default.\nTry setting a different width.");
 				return 2;
 			}
 			if(set_gfx_mode(GFX_SAFE, width, eof_screen_height, 0, 0))
 			{	//If the window size could not be set at all
-				allegro_message("Can't set up screen!  Error: %s",allegro_error);
+				eof_message("Can't set up screen!  Error: %s",allegro_error);
 				return 0;
 			}
 
-			allegro_message("EOF is in safe mode!\nThings may not work as expected.");
+			eof_message("EOF is in safe mode!\nThings may not work as expected.");
 		}
 	}
 	eof_screen = create_bitmap(eof_screen_width, eof_screen_height);
@@ -1053,30 +1057,26 @@ int eof_set_display_mode(unsigned long width, unsigned long height)
 	eof_window_editor = eof_window_create(0, 20, editorwidth, (eof_screen_height / 2) - 20, eof_screen);
 	if(!eof_window_editor)
 	{
-		allegro_message("Unable to create editor window!");
+		eof_message("Unable to create editor window!");
 		return 0;
 	}
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBuilt eof_window_editor:  x = %d, y = %d, w = %d, h = %d", eof_window_editor->x, eof_window_editor->y, eof_window_editor->w, eof_window_editor->h);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tBuilt eof_window_editor:  x = %d, y = %d, w = %d, h = %d", eof_window_editor->x, eof_window_editor->y, eof_window_editor->w, eof_window_editor->h);
 	eof_window_editor2 = eof_window_create(0, (eof_screen_height / 2) + 1, editorwidth, eof_screen_height, eof_screen);
 	if(!eof_window_editor2)
 	{
-		allegro_message("Unable to create second editor window!");
+		eof_message("Unable to create second editor window!");
 		return 0;
 	}
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBuilt eof_window_editor2:  x = %d, y = %d, w = %d, h = %d", eof_window_editor2->x, eof_window_editor2->y, eof_window_editor2->w, eof_window_editor2->h);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tBuilt eof_window_editor2:  x = %d, y = %d, w = %d, h = %d", eof_window_editor2->x, eof_window_editor2->y, eof_window_editor2->w, eof_window_editor2->h);
 	eof_window_note_lower_left = eof_window_create(0, eof_screen_height / 2, editorwidth, eof_screen_height / 2, eof_screen);	//Make the note window the same width as the editor window
 	eof_window_note_upper_left = eof_window_create(0, 20, editorwidth, eof_screen_height / 2, eof_screen);
 	if(!eof_window_note_lower_left || !eof_window_note_upper_left)
 	{
-		allegro_message("Unable to create information windows!");
+		eof_message("Unable to create information windows!");
 		return 0;
 	}
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBuilt eof_window_note_lower_left:  x = %d, y = %d, w = %d, h = %d", eof_window_note_lower_left->x, eof_window_note_lower_left->y, eof_window_note_lower_left->w, eof_window_note_lower_left->h);
-	eof_log(eof_log_string, 2);
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBuilt eof_window_note_upper_left:  x = %d, y = %d, w = %d, h = %d", eof_window_note_upper_left->x, eof_window_note_upper_left->y, eof_window_note_upper_left->w, eof_window_note_upper_left->h);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tBuilt eof_window_note_lower_left:  x = %d, y = %d, w = %d, h = %d", eof_window_note_lower_left->x, eof_window_note_lower_left->y, eof_window_note_lower_left->w, eof_window_note_lower_left->h);
+	eof_logf(2, "\tBuilt eof_window_note_upper_left:  x = %d, y = %d, w = %d, h = %d", eof_window_note_upper_left->x, eof_window_note_upper_left->y, eof_window_note_upper_left->w, eof_window_note_upper_left->h);
 	if(eof_full_height_3d_preview)
 	{	//If the 3D preview is expanded to take the full program window height
 		eof_window_3d = eof_window_create(eof_screen_width - EOF_SCREEN_PANEL_WIDTH, 20, EOF_SCREEN_PANEL_WIDTH, eof_screen_height, eof_screen);
@@ -1087,11 +1087,10 @@ int eof_set_display_mode(unsigned long width, unsigned long height)
 	}
 	if(!eof_window_3d)
 	{
-		allegro_message("Unable to create 3D preview window!");
+		eof_message("Unable to create 3D preview window!");
 		return 0;
 	}
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBuilt eof_window_3d:  x = %d, y = %d, w = %d, h = %d", eof_window_3d->x, eof_window_3d->y, eof_window_3d->w, eof_window_3d->h);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tBuilt eof_window_3d:  x = %d, y = %d, w = %d, h = %d", eof_window_3d->x, eof_window_3d->y, eof_window_3d->w, eof_window_3d->h);
 	eof_screen_layout.scrollbar_y = (eof_screen_height / 2) - 37;
 	eof_scale_fretboard(5);	//Set the eof_screen_layout.note_y[] array based on a 5 lane track, for setting the fretboard height below
 	eof_screen_layout.lyric_y = 20;
@@ -1261,6 +1260,7 @@ void eof_prepare_undo(int type)
 
 	eof_log("eof_prepare_undo() entered", 1);
 
+	eof_chart_edit_counter++;	//An edit is about to be made, even if eof_undo_add() merges it into the previous undo state
 	if(eof_undo_add(type))
 	{
 		eof_change_count++;
@@ -1278,9 +1278,9 @@ void eof_prepare_undo(int type)
 		eof_log("\tSaving periodic backup", 1);
 		if(!eof_save_song(eof_song, fn))
 		{
-			allegro_message("Undo state error!");
+			eof_message("Undo state error!");
 		}
-//		allegro_message("backup saved\n%s", eof_temp_filename);
+//		eof_message("backup saved\n%s", eof_temp_filename);
 	}
 }
 
@@ -1394,12 +1394,21 @@ int eof_note_is_hopo(unsigned long cnote)
 		return 0;	//Otherwise if the specified note isn't at least the second note in the track, it can't be a HOPO
 
 	cnotepos = eof_get_note_pos(eof_song, eof_selected_track, cnote);
-	for(i = 0; i < eof_song->beats - 1; i++)
-	{	//Find the beat that cnote is in
-		if((eof_song->beat[i]->pos <= cnotepos) && (eof_song->beat[i + 1]->pos > cnotepos))
-		{
-			beat = i;
-			break;
+	i = eof_get_beat(eof_song, cnotepos);	//Find the beat that cnote is in with a binary search
+	if(i != ULONG_MAX)
+	{
+		if(i + 1 < eof_song->beats)
+			beat = i;	//The note has to be before the last beat
+	}
+	else
+	{	//If the note is beyond the chart length, fall back to a linear search
+		for(i = 0; i + 1 < eof_song->beats; i++)
+		{	//Find the beat that cnote is in
+			if((eof_song->beat[i]->pos <= cnotepos) && (eof_song->beat[i + 1]->pos > cnotepos))
+			{
+				beat = i;
+				break;
+			}
 		}
 	}
 	if(beat < 0)
@@ -1430,37 +1439,186 @@ int eof_note_is_hopo(unsigned long cnote)
 			return 1;
 		}
 	}
-//	allegro_message("bpm = %f\nscale = %f\ndelta = %f\npnote = %d(%d), cnote = %d(%d)", bpm, scale, delta, pnote, eof_song->legacy_track[tracknum]->note[pnote].pos, cnote, eof_song->legacy_track[tracknum]->note[cnote].pos);	//Debug
+//	eof_message("bpm = %f\nscale = %f\ndelta = %f\npnote = %d(%d), cnote = %d(%d)", bpm, scale, delta, pnote, eof_song->legacy_track[tracknum]->note[pnote].pos, cnote, eof_song->legacy_track[tracknum]->note[cnote].pos);	//Debug
 
 	return 0;
 }
 
-void eof_determine_phrase_status(EOF_SONG *sp, unsigned long track)
+typedef struct
+{
+	EOF_PHRASE_SECTION *section;	//The phrase
+	unsigned long index;			//The phrase's index in the track's array of phrases of this type
+} EOF_PHRASE_SWEEP_ENTRY;
+
+typedef struct
+{
+	EOF_PHRASE_SWEEP_ENTRY *entry;	//The track's phrases of one type, sorted by start position
+	unsigned long count;			//The number of entries
+	unsigned long next;				//The first entry whose phrase starts after the sweep position
+	unsigned long *active;			//The entries whose phrases contain the sweep position
+	unsigned long activecount;		//The number of entries in active[]
+} EOF_PHRASE_SWEEP;
+
+static EOF_SONG *eof_phrase_status_dirty_song = NULL;	//The song and track that eof_invalidate_phrase_status() recorded a pending time range for
+static unsigned long eof_phrase_status_dirty_track = 0;
+static unsigned long eof_phrase_status_dirty_start = 0, eof_phrase_status_dirty_end = 0;
+static EOF_SONG *eof_phrase_status_sort_song = NULL;	//The song and track whose notes eof_phrase_status_qsort_notes() compares
+static unsigned long eof_phrase_status_sort_track = 0;
+
+static int eof_phrase_sweep_qsort_entries(const void * e1, const void * e2)
+{
+	const EOF_PHRASE_SWEEP_ENTRY *thing1 = (const EOF_PHRASE_SWEEP_ENTRY *)e1;
+	const EOF_PHRASE_SWEEP_ENTRY *thing2 = (const EOF_PHRASE_SWEEP_ENTRY *)e2;
+
+	if(thing1->section->start_pos < thing2->section->start_pos)
+		return -1;
+	if(thing1->section->start_pos > thing2->section->start_pos)
+		return 1;
+	if(thing1->index < thing2->index)
+		return -1;
+	if(thing1->index > thing2->index)
+		return 1;
+	return 0;
+}
+
+static int eof_phrase_status_qsort_notes(const void * e1, const void * e2)
+{
+	unsigned long note1 = *(const unsigned long *)e1, note2 = *(const unsigned long *)e2;
+	unsigned long pos1 = eof_get_note_pos(eof_phrase_status_sort_song, eof_phrase_status_sort_track, note1);
+	unsigned long pos2 = eof_get_note_pos(eof_phrase_status_sort_song, eof_phrase_status_sort_track, note2);
+
+	if(pos1 < pos2)
+		return -1;
+	if(pos1 > pos2)
+		return 1;
+	if(note1 < note2)
+		return -1;
+	if(note1 > note2)
+		return 1;
+	return 0;
+}
+
+static void eof_phrase_sweep_destroy(EOF_PHRASE_SWEEP *sw)
+{
+	if(sw->entry)
+		free(sw->entry);
+	if(sw->active)
+		free(sw->active);
+	memset(sw, 0, sizeof(EOF_PHRASE_SWEEP));
+}
+
+static int eof_phrase_sweep_init(EOF_PHRASE_SWEEP *sw, EOF_SONG *sp, unsigned long track, unsigned long count, EOF_PHRASE_SECTION *(*getphrase)(EOF_SONG *, unsigned long, unsigned long))
+{
+	unsigned long ctr;
+	EOF_PHRASE_SECTION *ptr;
+
+	memset(sw, 0, sizeof(EOF_PHRASE_SWEEP));
+	if(!count)
+		return 1;	//No phrases of this type
+
+	sw->entry = malloc(sizeof(EOF_PHRASE_SWEEP_ENTRY) * count);
+	sw->active = malloc(sizeof(unsigned long) * count);
+	if(!sw->entry || !sw->active)
+	{	//If either array couldn't be allocated
+		eof_phrase_sweep_destroy(sw);
+		return 0;
+	}
+	for(ctr = 0; ctr < count; ctr++)
+	{	//For each phrase of this type
+		ptr = getphrase(sp, track, ctr);
+		if(!ptr)
+			break;
+		sw->entry[sw->count].section = ptr;
+		sw->entry[sw->count].index = ctr;
+		sw->count++;
+	}
+	qsort(sw->entry, (size_t)sw->count, sizeof(EOF_PHRASE_SWEEP_ENTRY), eof_phrase_sweep_qsort_entries);
+
+	return 1;
+}
+
+static void eof_phrase_sweep_advance(EOF_PHRASE_SWEEP *sw, unsigned long pos)
 {
-	unsigned long i, j, k, tracknum;
+	unsigned long ctr, ctr2;
+
+	while((sw->next < sw->count) && (sw->entry[sw->next].section->start_pos <= pos))
+	{	//Add each phrase that starts at or before this position to the active list
+		sw->active[sw->activecount++] = sw->next++;
+	}
+	for(ctr = ctr2 = 0; ctr < sw->activecount; ctr++)
+	{	//Drop each active phrase that ended before this position, since the sweep position never decreases
+		if(sw->entry[sw->active[ctr]].section->end_pos >= pos)
+			sw->active[ctr2++] = sw->active[ctr];
+	}
+	sw->activecount = ctr2;
+}
+
+static int eof_phrase_sweep_expand_range(EOF_PHRASE_SWEEP *sw, unsigned long *start, unsigned long *end)
+{
+	unsigned long ctr;
+	int changed = 0;
+	EOF_PHRASE_SECTION *ptr;
+
+	for(ctr = 0; ctr < sw->count; ctr++)
+	{	//For each phrase
+		ptr = sw->entry[ctr].section;
+		if(ptr->start_pos > *end)
+			break;	//This and all remaining phrases start after the range
+		if(ptr->end_pos < *start)
+			continue;	//This phrase ends before the range
+		if(ptr->start_pos < *start)
+		{
+			*start = ptr->start_pos;
+			changed = 1;
+		}
+		if(ptr->end_pos > *end)
+		{
+			*end = ptr->end_pos;
+			changed = 1;
+		}
+	}
+
+	return changed;
+}
+
+static void eof_phrase_status_delete_unused(EOF_SONG *sp, unsigned long track, unsigned long numphrases, char *used, unsigned long start, unsigned long end, EOF_PHRASE_SECTION *(*getphrase)(EOF_SONG *, unsigned long, unsigned long), void (*deletephrase)(EOF_SONG *, unsigned long, unsigned long))
+{
+	unsigned long j;
+	EOF_PHRASE_SECTION *ptr;
+
+	for(j = numphrases; j > 0; j--)
+	{	//For each phrase of this type in the track (in reverse order)
+		ptr = getphrase(sp, track, j - 1);
+		if(!ptr || (ptr->start_pos < start) || (ptr->end_pos > end))
+			continue;	//Only phrases entirely within the processed time range had all of their notes counted
+		if(!used[j - 1])
+		{	//If the section's note count taken was 0
+			deletephrase(sp, track, j - 1);
+		}
+	}
+}
+
+static void eof_phrase_status_process(EOF_SONG *sp, unsigned long track, unsigned long start, unsigned long end, char partial)
+{
+	unsigned long i, j, k, n, tracknum, firsttrack = track;
 	char st[EOF_MAX_PHRASES] = {0};
 	char so[EOF_MAX_PHRASES] = {0};
 	char trills[EOF_MAX_PHRASES] = {0};
 	char tremolos[EOF_MAX_PHRASES] = {0};
 	char arpeggios[EOF_MAX_PHRASES] = {0};
 	char sliders[EOF_MAX_PHRASES] = {0};
-	unsigned long notepos, flags, tflags, numphrases, numnotes;
+	char hopodone[256];
+	unsigned long notepos, flags, tflags, numnotes;
 	unsigned char notetype;
 	EOF_PHRASE_SECTION *sectionptr = NULL;
+	EOF_PHRASE_SWEEP sweep[6];	//Star power, solo, trill, tremolo, arpeggio and slider phrases
+	unsigned long *order = NULL;	//The note numbers sorted by position, or NULL if the track's notes are already in order
 	char restore_tech_view = 0;
-
-	eof_log("eof_determine_phrase_status() entered", 2);
-
-	if(!sp || (track >= sp->tracks) || !track)
-		return;	//Invalid parameters
-	if(!eof_music_paused)
-		return;	//Do not allow this to run during playback because it causes too much lag when switching to a track with a large number of notes
+	char slidertrack;
 
 	restore_tech_view = eof_menu_track_get_tech_view_state(sp, track);
 	eof_menu_track_set_tech_view_state(sp, track, 0);	//Disable tech view if applicable
 
-	tracknum = sp->track[track]->tracknum;
-	numnotes = eof_get_track_size(sp, track);
 	for(k = 0; k < 2; k++)
 	{	//Perform two passes, because the two drum tracks can share their phrasing
 		if(k > 0)
@@ -1472,203 +1630,260 @@ void eof_determine_phrase_status(EOF_SONG *sp, unsigned long track)
 			if(sp->track[track]->track_type == EOF_TRACK_DRUM_PS)
 			{	//If the first pass processed the Phase Shift drum track
 				track = EOF_TRACK_DRUM;	//The second pass will process the regular drum track
-				numnotes = eof_get_track_size(sp, track);
 			}
 			else if(sp->track[track]->track_type == EOF_TRACK_DRUM)
 			{	//And vice-versa
 				track = EOF_TRACK_DRUM_PS;
-				numnotes = eof_get_track_size(sp, track);
 			}
 			else
 			{	//Otherwise if it's not a drum track
 				break;	//Don't perform a second pass
 			}
 		}
+		tracknum = sp->track[track]->tracknum;
+		numnotes = eof_get_track_size(sp, track);
+		slidertrack = (((sp->track[track]->track_behavior == EOF_GUITAR_TRACK_BEHAVIOR) && (sp->track[track]->track_format == EOF_LEGACY_TRACK_FORMAT)) || (track == EOF_TRACK_KEYS));	//Only legacy guitar and keys tracks use the is slider flag
+
+		//Sort each phrase type by start position so the notes can be swept in a single pass instead of testing every note against every phrase
+		(void) eof_phrase_sweep_init(&sweep[0], sp, track, eof_get_num_star_power_paths(sp, track), eof_get_star_power_path);
+		(void) eof_phrase_sweep_init(&sweep[1], sp, track, eof_get_num_solos(sp, track), eof_get_solo);
+		(void) eof_phrase_sweep_init(&sweep[2], sp, track, eof_get_num_trills(sp, track), eof_get_trill);
+		(void) eof_phrase_sweep_init(&sweep[3], sp, track, eof_get_num_tremolos(sp, track), eof_get_tremolo);
+		(void) eof_phrase_sweep_init(&sweep[4], sp, track, (sp->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT) ? sp->pro_guitar_track[tracknum]->arpeggios : 0, eof_get_arpeggio);
+		(void) eof_phrase_sweep_init(&sweep[5], sp, track, slidertrack ? eof_get_num_sliders(sp, track) : 0, eof_get_slider);
+		if(partial && !k)
+		{	//If only a time range is being processed, widen it to include all phrases overlapping it, since their note counts have to be re-taken
+			int changed = 1;
+
+			while(changed)
+			{	//Until no phrase extends the range any further
+				changed = 0;
+				for(j = 0; j < 6; j++)
+					changed |= eof_phrase_sweep_expand_range(&sweep[j], &start, &end);
+			}
+		}
+
+		//Determine the order in which to sweep the notes
+		for(i = 1; i < numnotes; i++)
+		{	//Check whether the notes are already sorted by position, which they normally are
+			if(eof_get_note_pos(sp, track, i) < eof_get_note_pos(sp, track, i - 1))
+				break;
+		}
+		if(i < numnotes)
+		{	//If they aren't, sort their note numbers
+			order = malloc(sizeof(unsigned long) * numnotes);
+			if(!order)
+			{
+				eof_log("\tError allocating memory.  Aborting", 1);
+				for(j = 0; j < 6; j++)
+					eof_phrase_sweep_destroy(&sweep[j]);
+				eof_menu_track_set_tech_view_state(sp, firsttrack, restore_tech_view);	//Re-enable tech view if applicable
+				return;
+			}
+			for(i = 0; i < numnotes; i++)
+				order[i] = i;
+			eof_phrase_status_sort_song = sp;
+			eof_phrase_status_sort_track = track;
+			qsort(order, (size_t)numnotes, sizeof(unsigned long), eof_phrase_status_qsort_notes);
+		}
+
+		//Find the first note in the range with a binary search
+		{
+			unsigned long first = 0, last = numnotes, mid;
+
+			while(first < last)
+			{
+				mid = first + (last - first) / 2;
+				if(eof_get_note_pos(sp, track, order ? order[mid] : mid) < start)
+					first = mid + 1;
+				else
+					last = mid;
+			}
+			i = first;
+		}
+		memset(hopodone, 0, sizeof(hopodone));
+
+		for(; i < numnotes; i++)
+		{	//For each note in the processed time range, in order of position
+			n = order ? order[i] : i;
+			notepos = eof_get_note_pos(sp, track, n);
+			notetype = eof_get_note_type(sp, track, n);
+			flags = eof_get_note_flags(sp, track, n);
+			if(notepos > end)
+			{	//If this note is after the processed time range
+				if(!partial || k)
+					break;
+				if(!hopodone[notetype])
+				{	//The first note of each difficulty after the range is checked because its HOPO status depends on the note before it
+					hopodone[notetype] = 1;
+					flags &= (~EOF_NOTE_FLAG_HOPO);
+					if(eof_note_is_hopo(n))
+					{
+						flags |= EOF_NOTE_FLAG_HOPO;
+						flags &= ~EOF_NOTE_FLAG_NO_HOPO;	//Ensure that if a note has forced HOPO and forced non HOPO, forced HOPO takes precedence
+					}
+					eof_set_note_flags(sp, track, n, flags);
+				}
+				continue;
+			}
 
-		for(i = 0; i < numnotes; i++)
-		{	//For each note in the active track
 			/* clear the flags */
-			notepos = eof_get_note_pos(sp, track, i);
-			notetype = eof_get_note_type(sp, track, i);
-			flags = eof_get_note_flags(sp, track, i);
-			tflags = eof_get_note_tflags(sp, track, i);
+			tflags = eof_get_note_tflags(sp, track, n);
 			flags &= (~EOF_NOTE_FLAG_HOPO);
 			flags &= (~EOF_NOTE_FLAG_SP);
 			flags &= (~EOF_NOTE_FLAG_IS_TRILL);
 			flags &= (~EOF_NOTE_FLAG_IS_TREMOLO);
 			tflags &= (~EOF_NOTE_TFLAG_SOLO_NOTE);
-			if(((sp->track[track]->track_behavior == EOF_GUITAR_TRACK_BEHAVIOR) && (sp->track[track]->track_format == EOF_LEGACY_TRACK_FORMAT)) || (track == EOF_TRACK_KEYS))
+			if(slidertrack)
 			{	//Only clear the is slider flag if this is a legacy guitar or keys track
 				flags &= (~EOF_GUITAR_NOTE_FLAG_IS_SLIDER);
 			}
 
 			/* mark HOPO */
-			if(eof_note_is_hopo(i))
+			if(eof_note_is_hopo(n))
 			{
 				flags |= EOF_NOTE_FLAG_HOPO;
 				flags &= ~EOF_NOTE_FLAG_NO_HOPO;	//Ensure that if a note has forced HOPO and forced non HOPO, forced HOPO takes precedence
 			}
 
+			for(j = 0; j < 6; j++)
+				eof_phrase_sweep_advance(&sweep[j], notepos);	//Update the phrases that contain this note
+
 			/* mark and check star power notes */
-			numphrases = eof_get_num_star_power_paths(sp, track);
-			for(j = 0; j < numphrases; j++)
-			{	//For each star power path in the active track
-				sectionptr = eof_get_star_power_path(sp, track, j);
-				if((notepos >= sectionptr->start_pos) && (notepos <= sectionptr->end_pos))
-				{	//If the note is in this star power section
-					flags |= EOF_NOTE_FLAG_SP;
-					st[j] = 1;
-				}
+			for(j = 0; j < sweep[0].activecount; j++)
+			{	//For each star power path containing the note
+				flags |= EOF_NOTE_FLAG_SP;
+				st[sweep[0].entry[sweep[0].active[j]].index] = 1;
 			}
 
 			/* check solos */
-			numphrases = eof_get_num_solos(sp, track);
-			for(j = 0; j < numphrases; j++)
-			{	//For each solo section in the active track
-				sectionptr = eof_get_solo(sp, track, j);
-				if((notepos >= sectionptr->start_pos) && (notepos <= sectionptr->end_pos))
-				{	//If the note is in this solo section
-					tflags |= EOF_NOTE_TFLAG_SOLO_NOTE;
-					so[j] = 1;
-				}
+			for(j = 0; j < sweep[1].activecount; j++)
+			{	//For each solo section containing the note
+				tflags |= EOF_NOTE_TFLAG_SOLO_NOTE;
+				so[sweep[1].entry[sweep[1].active[j]].index] = 1;
 			}
 
 			/* mark and check trills */
-			numphrases = eof_get_num_trills(sp, track);
-			for(j = 0; j < numphrases; j++)
-			{	//For each trill section in the active track
-				sectionptr = eof_get_trill(sp, track, j);
-				if((notepos >= sectionptr->start_pos) && (notepos <= sectionptr->end_pos))
-				{	//If the note is in this trill section
-					flags |= EOF_NOTE_FLAG_IS_TRILL;
-					trills[j] = 1;
-				}
+			for(j = 0; j < sweep[2].activecount; j++)
+			{	//For each trill section containing the note
+				flags |= EOF_NOTE_FLAG_IS_TRILL;
+				trills[sweep[2].entry[sweep[2].active[j]].index] = 1;
 			}
 
 			/* mark and check tremolos */
-			numphrases = eof_get_num_tremolos(sp, track);
-			for(j = 0; j < numphrases; j++)
-			{	//For each tremolo section in the active track
-				sectionptr = eof_get_tremolo(sp, track, j);
-				if((notepos >= sectionptr->start_pos) && (notepos <= sectionptr->end_pos))
-				{	//If the note is in this tremolo section
-					if(eof_song->track[track]->flags & EOF_TRACK_FLAG_UNLIMITED_DIFFS)
-					{	//If the track's difficulty limit has been removed
-						if(sectionptr->difficulty == notetype)	//And the tremolo section applies to this note's track difficulty
-							flags |= EOF_NOTE_FLAG_IS_TREMOLO;
-					}
-					else
-					{
-						if(sectionptr->difficulty == 0xFF)	//Otherwise if the tremolo section applies to all track difficulties
-							flags |= EOF_NOTE_FLAG_IS_TREMOLO;
-					}
-
-					tremolos[j] = 1;
+			for(j = 0; j < sweep[3].activecount; j++)
+			{	//For each tremolo section containing the note
+				sectionptr = sweep[3].entry[sweep[3].active[j]].section;
+				if(eof_song->track[track]->flags & EOF_TRACK_FLAG_UNLIMITED_DIFFS)
+				{	//If the track's difficulty limit has been removed
+					if(sectionptr->difficulty == notetype)	//And the tremolo section applies to this note's track difficulty
+						flags |= EOF_NOTE_FLAG_IS_TREMOLO;
+				}
+				else
+				{
+					if(sectionptr->difficulty == 0xFF)	//Otherwise if the tremolo section applies to all track difficulties
+						flags |= EOF_NOTE_FLAG_IS_TREMOLO;
 				}
+				tremolos[sweep[3].entry[sweep[3].active[j]].index] = 1;
 			}
 
 			/* check arpeggios */
-			if(sp->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
-			{	//If this is a pro guitar track
-				for(j = 0; j < sp->pro_guitar_track[tracknum]->arpeggios; j++)
-				{	//For each arpeggio section in the active track
-					sectionptr = &sp->pro_guitar_track[tracknum]->arpeggio[j];
-					if((notepos >= sectionptr->start_pos) && (notepos <= sectionptr->end_pos))
-					{	//If the note is in this arpeggio section
-						if((sectionptr->difficulty == 0xFF) || (sectionptr->difficulty == notetype))
-						{	//If the arpeggio section applies to all difficulties or if it applies to this note's track difficulty
-							arpeggios[j] = 1;
-						}
-					}
+			for(j = 0; j < sweep[4].activecount; j++)
+			{	//For each arpeggio section containing the note
+				sectionptr = sweep[4].entry[sweep[4].active[j]].section;
+				if((sectionptr->difficulty == 0xFF) || (sectionptr->difficulty == notetype))
+				{	//If the arpeggio section applies to all difficulties or if it applies to this note's track difficulty
+					arpeggios[sweep[4].entry[sweep[4].active[j]].index] = 1;
 				}
 			}
 
 			/* mark and check sliders */
-			if(((sp->track[track]->track_behavior == EOF_GUITAR_TRACK_BEHAVIOR) && (sp->track[track]->track_format == EOF_LEGACY_TRACK_FORMAT)) || (track == EOF_TRACK_KEYS))
-			{	//Only check the is slider flag if this is a legacy guitar or keys track
-				numphrases = eof_get_num_sliders(sp, track);
-				for(j = 0; j < numphrases; j++)
-				{	//For each slider section in the active track
-					sectionptr = eof_get_slider(sp, track, j);
-					if((notepos >= sectionptr->start_pos) && (notepos <= sectionptr->end_pos))
-					{	//If the note is in this slider section
-						flags |= EOF_GUITAR_NOTE_FLAG_IS_SLIDER;
-						sliders[j] = 1;
-					}
-				}
+			for(j = 0; j < sweep[5].activecount; j++)
+			{	//For each slider section containing the note
+				flags |= EOF_GUITAR_NOTE_FLAG_IS_SLIDER;
+				sliders[sweep[5].entry[sweep[5].active[j]].index] = 1;
 			}
 
 			if(!k)
 			{	//Only update note flags on the first pass
-				eof_set_note_flags(sp, track, i, flags);	//Update the note's flags variable
-				eof_set_note_tflags(sp, track, i, tflags);	//Update the note's temporary flags variable
+				eof_set_note_flags(sp, track, n, flags);	//Update the note's flags variable
+				eof_set_note_tflags(sp, track, n, tflags);	//Update the note's temporary flags variable
 			}
-		}//For each note in the active track
-	}//Perform two passes, because the two drum tracks can share their phrasing
+		}//For each note in the processed time range
 
-	/* delete star power phrases with no notes */
-	numphrases = eof_get_num_star_power_paths(sp, track);
-	for(j = numphrases; j > 0; j--)
-	{	//For each star power section in the active track (in reverse order)
-		if(!st[j - 1])
-		{	//If the section's note count taken above was 0
-			eof_track_delete_star_power_path(sp, track, j - 1);
+		for(j = 0; j < 6; j++)
+			eof_phrase_sweep_destroy(&sweep[j]);
+		if(order)
+		{
+			free(order);
+			order = NULL;
 		}
-	}
+	}//Perform two passes, because the two drum tracks can share their phrasing
 
-	/* delete solos with no notes */
-	numphrases = eof_get_num_solos(sp, track);
-	for(j = numphrases; j > 0; j--)
-	{	//For each solo section in the active track (in reverse order)
-		if(!so[j - 1])
-		{	//If the section's note count taken above was 0
-			eof_track_delete_solo(sp, track, j - 1);
-		}
+	/* delete phrases with no notes */
+	eof_phrase_status_delete_unused(sp, track, eof_get_num_star_power_paths(sp, track), st, start, end, eof_get_star_power_path, eof_track_delete_star_power_path);
+	eof_phrase_status_delete_unused(sp, track, eof_get_num_solos(sp, track), so, start, end, eof_get_solo, eof_track_delete_solo);
+	eof_phrase_status_delete_unused(sp, track, eof_get_num_trills(sp, track), trills, start, end, eof_get_trill, eof_track_delete_trill);
+	eof_phrase_status_delete_unused(sp, track, eof_get_num_tremolos(sp, track), tremolos, start, end, eof_get_tremolo, eof_track_delete_tremolo);
+	if(sp->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
+	{	//If this is a pro guitar track
+		eof_phrase_status_delete_unused(sp, track, sp->pro_guitar_track[sp->track[track]->tracknum]->arpeggios, arpeggios, start, end, eof_get_arpeggio, eof_track_delete_arpeggio);
 	}
+	eof_phrase_status_delete_unused(sp, track, eof_get_num_sliders(sp, track), sliders, start, end, eof_get_slider, eof_track_delete_slider);
 
-	/* delete trills with no notes */
-	numphrases = eof_get_num_trills(sp, track);
-	for(j = numphrases; j > 0; j--)
-	{	//For each trill section in the active track (in reverse order)
-		if(!trills[j - 1])
-		{	//If the section's note count taken above was 0
-			eof_track_delete_trill(sp, track, j - 1);
-		}
-	}
+	eof_menu_track_set_tech_view_state(sp, firsttrack, restore_tech_view);	//Re-enable tech view if applicable
+}
 
-	/* delete tremolos with no notes */
-	numphrases = eof_get_num_tremolos(sp, track);
-	for(j = numphrases; j > 0; j--)
-	{	//For each tremolo section in the active track (in reverse order)
-		if(!tremolos[j - 1])
-		{	//If the section's note count taken above was 0
-			eof_track_delete_tremolo(sp, track, j - 1);
-		}
-	}
+void eof_determine_phrase_status(EOF_SONG *sp, unsigned long track)
+{
+	eof_log("eof_determine_phrase_status() entered", 2);
 
-	/* delete arpeggios with no notes */
-	if(sp->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
-	{	//If this is a pro guitar track
-		for(j = sp->pro_guitar_track[tracknum]->arpeggios; j > 0; j--)
-		{	//For each arpeggio section in the active track (in reverse order)
-			if(!arpeggios[j - 1])
-			{	//If the section's note count taken above was 0
-				eof_pro_guitar_track_delete_arpeggio(sp->pro_guitar_track[tracknum], j - 1);
-			}
-		}
+	if(!sp || (track >= sp->tracks) || !track)
+		return;	//Invalid parameters
+
+	if((eof_phrase_status_dirty_song == sp) && (eof_phrase_status_dirty_track == track))
+	{	//If a time range of this track was invalidated, the entire track is being processed now
+		eof_phrase_status_dirty_song = NULL;
 	}
+	eof_phrase_status_process(sp, track, 0, ULONG_MAX, 0);
+}
 
-	/* delete sliders with no notes */
-	numphrases = eof_get_num_sliders(sp, track);
-	for(j = numphrases; j > 0; j--)
-	{	//For each slider section in the active track (in reverse order)
-		if(!sliders[j - 1])
-		{	//If the section's note count taken above was 0
-			eof_track_delete_slider(sp, track, j - 1);
-		}
+void eof_invalidate_phrase_status(EOF_SONG *sp, unsigned long track, unsigned long start, unsigned long end)
+{
+	if(!sp || (track >= sp->tracks) || !track || (start > end))
+		return;	//Invalid parameters
+
+	if(eof_phrase_status_dirty_song && ((eof_phrase_status_dirty_song != sp) || (eof_phrase_status_dirty_track != track)))
+	{	//If a range of a different track is pending, process it first
+		eof_update_phrase_status(eof_phrase_status_dirty_song, eof_phrase_status_dirty_track);
 	}
+	if(!eof_phrase_status_dirty_song)
+	{	//If no range is pending
+		eof_phrase_status_dirty_song = sp;
+		eof_phrase_status_dirty_track = track;
+		eof_phrase_status_dirty_start = start;
+		eof_phrase_status_dirty_end = end;
+		return;
+	}
+	if(start < eof_phrase_status_dirty_start)
+		eof_phrase_status_dirty_start = start;
+	if(end > eof_phrase_status_dirty_end)
+		eof_phrase_status_dirty_end = end;
+}
+
+void eof_update_phrase_status(EOF_SONG *sp, unsigned long track)
+{
+	unsigned long start, end;
+
+	if(!sp || (track >= sp->tracks) || !track)
+		return;	//Invalid parameters
+	if((eof_phrase_status_dirty_song != sp) || (eof_phrase_status_dirty_track != track))
+		return;	//Nothing was invalidated in this track
 
-	eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
+	start = eof_phrase_status_dirty_start;
+	end = eof_phrase_status_dirty_end;
+	eof_phrase_status_dirty_song = NULL;
+	eof_phrase_status_process(sp, track, start, end, 1);
 }
 
 int eof_figure_difficulty(void)
@@ -1763,7 +1978,7 @@ unsigned long eof_count_selected_notes(unsigned long *total)
 	/* if no notes remain selected, current note should be unset */
 	if(count == 0)
 	{
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 		eof_selection.current_pos = 0;
 	}
 
@@ -1925,8 +2140,11 @@ int eof_load_ogg(char * filename, char function)
 	if(!eof_music_data)
 	{	//If the referenced file couldn't be buffered to memory, have the user browse for another file
 		(void) replace_filename(output, filename, "", 1024);	//Get the path of the target file's parent directory (the project folder)
-		returnedfn = ncd_file_select(0, output, "Select Music File", eof_filter_music_files);
-		eof_clear_input();
+		if(!eof_batch_mode)
+		{	//Batch mode can't prompt, it falls back to silent audio instead if the calling function allows
+			returnedfn = ncd_file_select(0, output, "Select Music File", eof_filter_music_files);
+			eof_clear_input();
+		}
 		if(returnedfn)
 		{	//User selected an OGG, WAV or MP3 file, write a suitably named OGG into the chart's destination folder
 			ptr = returnedfn;
@@ -1984,7 +2202,7 @@ int eof_load_ogg(char * filename, char function)
 	}
 	if(!loaded)
 	{
-		allegro_message("Unable to load OGG file.\n%s\nMake sure your file is a valid OGG file.", ptr);
+		eof_message("Unable to load OGG file.\n%s\nMake sure your file is a valid OGG file.", ptr);
 		if(eof_music_data)
 		{
 			free(eof_music_data);
@@ -2004,6 +2222,7 @@ int eof_destroy_ogg(void)
 
 	eof_log("eof_destroy_ogg() entered", 1);
 
+	eof_pcm_cache_flush();	//The decoded audio is no longer valid
 	if(eof_music_track)
 	{
 		alogg_destroy_ogg(eof_music_track);
@@ -2220,7 +2439,7 @@ void eof_read_global_keys(void)
 			eof_windowed = 0;
 			if(set_gfx_mode(GFX_AUTODETECT, 640, 480, 0, 0))
 			{
-				allegro_message("Can't set up screen!  Error: %s",allegro_error);
+				eof_message("Can't set up screen!  Error: %s",allegro_error);
 				exit(1);
 			}
 			set_palette(eof_palette);
@@ -2231,7 +2450,7 @@ void eof_read_global_keys(void)
 			eof_windowed = 1;
 			if(set_gfx_mode(GFX_AUTODETECT_WINDOWED, 640, 480, 0, 0))
 			{
-				allegro_message("Can't set up screen!  Error: %s",allegro_error);
+				eof_message("Can't set up screen!  Error: %s",allegro_error);
 				exit(1);
 			}
 			set_palette(eof_palette);
@@ -2686,8 +2905,6 @@ void eof_logic(void)
 		eof_show_mouse(NULL);
 	}
 
-	eof_last_note = EOF_MAX_NOTES;
-
 	get_mouse_mickeys(&eof_mickeys_x, &eof_mickeys_y);
 	if(eof_song_loaded)
 	{
@@ -3123,7 +3340,7 @@ void eof_display_info_panel(void)
 		eof_info_panel = eof_create_text_panel("info.panel.txt", 1);	//Reload the Info panel, recover the panel file from eof.dat if necessary
 		if(!eof_info_panel)
 		{
-			allegro_message("Could not open Information panel");
+			eof_message("Could not open Information panel");
 			eof_disable_info_panel = 1;
 
 			return;
@@ -3693,7 +3910,7 @@ void eof_render_3d_window(void)
 		}
 */
 	}
-//	allegro_message("first = %d\nlast = %d", first_note, last_note);	//Debug
+//	eof_message("first = %d\nlast = %d", first_note, last_note);	//Debug
 
 	eof_render_lyric_preview(eof_window_3d->screen);
 
@@ -3740,9 +3957,201 @@ void eof_render_notes_window(void)
 	eof_render_text_panel(eof_notes_panel, 1);
 }
 
+#define EOF_RENDER_HEARTBEAT 50
+
+typedef struct
+{
+	EOF_SONG *song;
+	unsigned long track, type, selected_notes, current_note, hover_beat, catalog_entry;
+	int music_pos, catalog_pos, paused, hover_note, seek_hover_note, input_mode, zoom, undo_count, window_title_dirty, beat_stats_cached, song_loaded;
+	char catalog_playback, changes, has_focus;
+} EOF_RENDER_STATE;
+
+static EOF_RENDER_STATE eof_last_render_state;	//The state at the previous call to eof_update_render_damage()
+static int eof_last_render_mouse_x = -1, eof_last_render_mouse_y = -1, eof_last_render_mouse_z = 0;
+static unsigned long eof_render_unchanged_count = 0;	//The number of consecutive calls to eof_update_render_damage() that found nothing changed
+static int eof_render_skipped = 0;	//Set to nonzero by the main loop when eof_render_damaged() wasn't called because nothing changed, so eof_idle_logic() can rest longer
+
+static EOF_WINDOW *eof_render_window_list(unsigned long index)
+{
+	EOF_WINDOW *window_list[6] = {eof_window_editor, eof_window_editor2, eof_window_3d, eof_window_note_lower_left, eof_window_note_upper_left, eof_window_notes};	//The primary piano roll is listed first, the others share the bottom half of the program window
+
+	if(index >= 6)
+		return NULL;
+	return window_list[index];
+}
+
+void eof_set_render_dirty(void)
+{
+	EOF_WINDOW *wp;
+	unsigned long ctr;
+
+	for(ctr = 0; ctr < 6; ctr++)
+	{	//For each of the program's windows
+		wp = eof_render_window_list(ctr);
+		if(wp)
+			wp->dirty = 1;
+	}
+}
+
+static void eof_clear_render_dirty(void)
+{
+	EOF_WINDOW *wp;
+	unsigned long ctr;
+
+	for(ctr = 0; ctr < 6; ctr++)
+	{	//For each of the program's windows
+		wp = eof_render_window_list(ctr);
+		if(wp)
+			wp->dirty = 0;
+	}
+}
+
+static int eof_render_lower_dirty(void)
+{
+	EOF_WINDOW *wp;
+	unsigned long ctr;
+
+	for(ctr = 1; ctr < 6; ctr++)
+	{	//For each of the windows that share the bottom half of the program window
+		wp = eof_render_window_list(ctr);
+		if(wp && wp->dirty)
+			return 1;
+	}
+
+	return 0;
+}
+
+static void eof_damage_window_at(int x, int y)
+{
+	if(!eof_window_editor || !eof_window_note_lower_left)
+		return;
+
+	if(y >= eof_screen_height / 2)
+	{	//If the coordinates are in the bottom half of the program window
+		eof_window_note_lower_left->dirty = 1;	//The bottom half is redrawn as a whole
+	}
+	else if((y >= eof_window_editor->y) && (x >= 0) && (x < eof_window_editor->w))
+	{	//If the coordinates are in the primary piano roll
+		eof_window_editor->dirty = 1;
+	}
+}
+
+int eof_update_render_damage(void)
+{
+	EOF_RENDER_STATE state;
+	unsigned long ctr;
+	int changed = 0;
+
+	memset(&state, 0, sizeof(state));	//Zero the padding bytes too, so the structures can be compared with memcmp()
+	state.song = eof_song;
+	state.song_loaded = eof_song_loaded;
+	state.track = eof_selected_track;
+	state.type = eof_note_type;
+	state.music_pos = eof_music_pos;
+	state.paused = eof_music_paused;
+	state.catalog_playback = eof_music_catalog_playback;
+	state.catalog_pos = eof_music_catalog_pos;
+	state.catalog_entry = eof_selected_catalog_entry;
+	state.changes = eof_changes;
+	state.undo_count = eof_undo_count;
+	state.hover_note = eof_hover_note;
+	state.seek_hover_note = eof_seek_hover_note;
+	state.hover_beat = eof_hover_beat;
+	state.input_mode = eof_input_mode;
+	state.zoom = eof_zoom;
+	state.window_title_dirty = eof_window_title_dirty;
+	state.beat_stats_cached = eof_beat_stats_cached;
+	state.has_focus = eof_has_focus;
+	if(eof_song_loaded && eof_song)
+	{
+		state.selected_notes = eof_count_selected_notes(NULL);
+		state.current_note = eof_selection.current;
+	}
+
+	if(memcmp(&state, &eof_last_render_state, sizeof(state)))
+	{	//If an edit, seek, playback, selection or hover change occurred
+		changed = 1;
+	}
+	else if(mouse_b || (mouse_z != eof_last_render_mouse_z) || eof_key_pressed)
+	{	//If a mouse button is held, the scroll wheel moved or a key was pressed
+		changed = 1;
+	}
+	else
+	{
+		for(ctr = 0; ctr < KEY_MAX; ctr++)
+		{	//For each key scan code
+			if(key[ctr])
+			{	//If the key is held, it may be adjusting something continuously (ie. the 3D camera or seeking)
+				changed = 1;
+				break;
+			}
+		}
+	}
+	if(changed || (eof_render_unchanged_count >= EOF_RENDER_HEARTBEAT))
+	{
+		eof_set_render_dirty();
+	}
+	else if((mouse_x != eof_last_render_mouse_x) || (mouse_y != eof_last_render_mouse_y))
+	{	//If the mouse only moved, redraw the pen note in the windows it left and entered
+		if(eof_screen_zoom || (eof_cursor_visible && eof_soft_cursor))
+		{	//The whole program window is redrawn in these cases anyway
+			eof_set_render_dirty();
+		}
+		else
+		{
+			eof_damage_window_at(eof_last_render_mouse_x, eof_last_render_mouse_y);
+			eof_damage_window_at(mouse_x, mouse_y);
+			if(eof_text_panel_mouse_wanted && eof_window_note_lower_left)
+			{	//If a text panel displays the mouse coordinates
+				eof_window_note_lower_left->dirty = 1;
+			}
+		}
+	}
+	memcpy(&eof_last_render_state, &state, sizeof(state));
+	eof_last_render_mouse_x = mouse_x;
+	eof_last_render_mouse_y = mouse_y;
+	eof_last_render_mouse_z = mouse_z;
+
+	if((eof_window_editor && eof_window_editor->dirty) || eof_render_lower_dirty())
+	{	//If anything is to be redrawn
+		eof_render_unchanged_count = 0;
+		return 1;
+	}
+	eof_render_unchanged_count++;
+	return 0;
+}
+
+static void eof_render_background(int y, int h)
+{
+	if(eof_background)
+	{	//If a background image was loaded
+		if((eof_screen->h > eof_background->h + 5) || (eof_screen->w > eof_background->w + 5))
+		{	//If the program window is more than 5 pixels taller/wider than the background image
+			rectfill(eof_screen, 0, y, eof_screen->w - 1, y + h - 1, eof_color_gray);	//Clear the area to ensure that remnants of the previous frame don't get left
+		}
+		blit(eof_background, eof_screen, 0, y, 0, y, eof_screen->w, h);	//Display it
+	}
+	else
+	{	//Otherwise just draw a blank area
+		rectfill(eof_screen, 0, y, eof_screen->w - 1, y + h - 1, eof_color_light_gray);
+	}
+}
+
 void eof_render(void)
 {
-//	eof_log("eof_render() entered.", 3);
+	eof_set_render_dirty();	//Callers outside of the main loop expect the entire program window to be redrawn
+	eof_render_damaged();
+}
+
+void eof_render_damaged(void)
+{
+	int upper, lower;	//Tracks whether each half of the program window is to be redrawn
+
+//	eof_log("eof_render_damaged() entered.", 3);
+
+	if(eof_batch_mode)
+		return;	//There is no display in batch mode
 
 	/* don't draw if window is out of focus */
 	if(!eof_has_focus)
@@ -3760,17 +4169,23 @@ void eof_render(void)
 		{	//If the window title needs to be redrawn
 			eof_fix_window_title();
 		}
-		if(eof_background)
-		{	//If a background image was loaded
-			if((eof_screen->h > eof_background->h + 5) || (eof_screen->w > eof_background->w + 5))
-			{	//If the program window is more than 5 pixels taller/wider than the background image
-				clear_to_color(eof_screen, eof_color_gray);	//Clear the screen to ensure that remnants of the previous frame don't get left
-			}
-			blit(eof_background, eof_screen, 0, 0, 0, 0, eof_screen->w, eof_screen->h);	//Display it
+		upper = eof_window_editor->dirty;
+		lower = eof_render_lower_dirty();
+		if(eof_full_screen_3d || eof_full_height_3d_preview || eof_screen_zoom || (eof_cursor_visible && eof_soft_cursor))
+		{	//These layouts draw across both halves of the program window, so it has to be redrawn entirely
+			upper = lower = 1;
+		}
+		if(upper && lower)
+		{	//If the entire program window is being redrawn
+			eof_render_background(0, eof_screen->h);
+		}
+		else if(upper)
+		{	//If only the primary piano roll is being redrawn, the bottom half is reused from the previous frame
+			eof_render_background(eof_window_editor->y, eof_window_editor->h);
 		}
 		else
-		{	//Otherwise just draw a blank screen
-			clear_to_color(eof_screen, eof_color_light_gray);
+		{	//If only the bottom half is being redrawn, the primary piano roll is reused from the previous frame
+			eof_render_background(eof_screen_height / 2, eof_screen->h - eof_screen_height / 2);
 		}
 		if(!eof_full_screen_3d && !eof_screen_zoom)
 		{	//Only blit the menu bar now if neither full screen 3D view nor x2 zoom is in effect, otherwise it will be blitted later
@@ -3788,19 +4203,27 @@ void eof_render(void)
 			eof_log("\tRebuilding beat stats.", 3);
 			eof_process_beat_statistics(eof_song, eof_selected_track);	//Rebuild them (from the perspective of the specified track)
 		}
-		eof_ch_sp_solution_wanted = 0;	//The rendering of the info and notes panels will change this to 1 any CH SP scoring information is needed for expansion macros
-		if(!eof_full_screen_3d)
-		{	//In full screen 3D view, don't render the info window yet, it will just be overwritten by the 3D window
-//			eof_log("\tRendering Information panel.", 3);
-			eof_render_info_window();	//Otherwise render the info window first, so if the user didn't opt to display its full width, it won't draw over the 3D window
+		if(lower)
+		{	//If the bottom half of the program window is being redrawn
+			eof_ch_sp_solution_wanted = 0;	//The rendering of the info and notes panels will change this to 1 any CH SP scoring information is needed for expansion macros
+			eof_text_panel_mouse_wanted = 0;	//Likewise for whether they display the mouse coordinates
+			if(!eof_full_screen_3d)
+			{	//In full screen 3D view, don't render the info window yet, it will just be overwritten by the 3D window
+//				eof_log("\tRendering Information panel.", 3);
+				eof_render_info_window();	//Otherwise render the info window first, so if the user didn't opt to display its full width, it won't draw over the 3D window
+			}
+//			eof_log("\tRendering 3D preview.", 3);
+			eof_render_3d_window();
 		}
-//		eof_log("\tRendering 3D preview.", 3);
-		eof_render_3d_window();
 		if(!eof_full_screen_3d)
 		{	//In full screen 3D view, don't render these windows
-			eof_render_editor_window(eof_window_editor);	//Render the primary piano roll
-			eof_render_editor_window_2();	//Render the secondary piano roll if applicable
-			eof_render_notes_window();		//Render the notes panel if applicable
+			if(upper)
+				eof_render_editor_window(eof_window_editor);	//Render the primary piano roll
+			if(lower)
+			{
+				eof_render_editor_window_2();	//Render the secondary piano roll if applicable
+				eof_render_notes_window();		//Render the notes panel if applicable
+			}
 		}
 		eof_ch_sp_solution_rebuild();	//Build SP CH solution data if necessary
 	}
@@ -3913,8 +4336,9 @@ void eof_render(void)
 	#ifdef ALLEGRO_LEGACY
 		allegro_render_screen();
 	#endif
+	eof_clear_render_dirty();
 
-//	eof_log("eof_render() completed.", 3);
+//	eof_log("eof_render_damaged() completed.", 3);
 }
 
 static int work_around_fsel_bug = 0;
@@ -4009,7 +4433,7 @@ int eof_load_data(void)
 	}
 	if(!exists("eof.dat"))
 	{
-		allegro_message("DAT file missing.  If using a hotfix, make sure you extract the appropriate EOF release candidate first and then extract the hotfix on top of it (replacing with files in the hotfix).");
+		eof_message("DAT file missing.  If using a hotfix, make sure you extract the appropriate EOF release candidate first and then extract the hotfix on top of it (replacing with files in the hotfix).");
 		return 0;
 	}
 
@@ -4122,7 +4546,7 @@ int eof_load_data(void)
 	//Load and scale the non-GHL HOPO images, using the scale size in user preferences
 	if(!eof_load_and_scale_hopo_images((double)eof_3d_hopo_scale_size / 100.0))
 	{
-		allegro_message("Error loading and scaling 3D HOPO images!");
+		eof_message("Error loading and scaling 3D HOPO images!");
 		return 0;
 	}
 
@@ -4130,19 +4554,19 @@ int eof_load_data(void)
 	eof_font = eof_load_bitmap_font("font_times_new_roman.pcx");
 	if(!eof_font)
 	{
-		allegro_message("Could not load font!");
+		eof_message("Could not load font!");
 		return 0;
 	}
 	eof_mono_font = eof_load_bitmap_font("font_courier_new.pcx");
 	if(!eof_mono_font)
 	{
-		allegro_message("Could not load mono font!");
+		eof_message("Could not load mono font!");
 		return 0;
 	}
 	eof_symbol_font = eof_load_bitmap_font("font_symbols.pcx");
 	if(!eof_symbol_font)
 	{
-		allegro_message("Could not load symbol font!");
+		eof_message("Could not load symbol font!");
 		return 0;
 	}
 	eof_add_extended_ascii_glyphs();	//Copy extended ASCII glyphs 128 - 159 to their Unicode equivalent code points
@@ -4157,7 +4581,7 @@ int eof_load_data(void)
 	{
 		if(!eof_image[i])
 		{
-			allegro_message("Could not load all images!\nFailed on %d", i);
+			eof_message("Could not load all images!\nFailed on %d", i);
 			return 0;
 		}
 	}
@@ -4226,6 +4650,7 @@ void eof_destroy_data(void)
 	eof_log("eof_destroy_data() entered", 1);
 
 	agup_shutdown();
+	eof_destroy_fret_number_sprites();	//These were rendered with the fonts and color depth in use
 	for(i = 0; i < EOF_MAX_IMAGES; i++)
 	{
 		if(eof_image[i])
@@ -4288,26 +4713,31 @@ int eof_initialize(int argc, char * argv[])
 		return 0;
 	}
 
-	if((argc >= 3) && !ustricmp(argv[1], "-ch_sp_path_worker"))
-	{	//If this EOF instance was launched as a worker process to perform star power pathing (must be second parameter)
-		ch_sp_path_worker = 1;
-	}
-	if((argc >= 4) && !ustricmp(argv[3], "-ch_sp_path_worker_logging"))
-	{	//If this EOF instance was is being called with logging manually enabled (must be fourth parameter)
-		char * fnptr = get_filename(argv[2]);	//Get a pointer to the filename of the job file path
-		(void) replace_extension(temp_filename, fnptr, "", sizeof(temp_filename));	//Strip away the extension to get the worker number
-		ch_sp_path_worker_number = atol(temp_filename);	//Convert it to a number
-		ch_sp_path_worker_logging = 1;
+	//Identify this EOF instance by its process ID, which no concurrently running instance shares
+	#ifdef ALLEGRO_WINDOWS
+		eof_log_id = (unsigned int) GetCurrentProcessId();
+	#else
+		eof_log_id = (unsigned int) getpid();
+	#endif
+
+	if((argc >= 2) && !ustricmp(argv[1], "-batch"))
+	{	//If this EOF instance was launched to convert files without a display (must be first parameter)
+		eof_batch_mode = 1;
+		if(!eof_batch_parse_arguments(argc, argv))
+		{	//If the batch parameters were invalid (the usage was printed)
+			eof_batch_failed = 1;
+			return 0;
+		}
 	}
 
-	if(!ch_sp_path_worker)
-	{	//Don't bother setting up the sound system if EOF is acting as a worker process
+	if(!eof_batch_mode)
+	{	//Don't bother setting up the sound system if EOF is converting files in batch mode
 		if(install_sound(DIGI_AUTODETECT, MIDI_AUTODETECT, NULL))
 		{	//If Allegro failed to initialize the sound AND midi
-//			allegro_message("Can't set up MIDI!  Error: %s\nAttempting to init audio only",allegro_error);
+//			eof_message("Can't set up MIDI!  Error: %s\nAttempting to init audio only",allegro_error);
 			if(install_sound(DIGI_AUTODETECT, MIDI_NONE, NULL))
 			{
-				allegro_message("Can't set up sound!  Error: %s",allegro_error);
+				eof_message("Can't set up sound!  Error: %s",allegro_error);
 				return 0;
 			}
 			eof_midi_initialized = 0;	//Couldn't set up MIDI
@@ -4321,30 +4751,33 @@ int eof_initialize(int argc, char * argv[])
 
 	InitIdleSystem();
 
-	retry = 5;
-	while(install_keyboard())
-	{	//Try to install the keyboard up to 5 times
-		retry--;
-		if(!retry)
-		{
-			allegro_message("Can't set up keyboard!  Error: %s",allegro_error);
-			return 0;
+	if(!eof_batch_mode)
+	{	//Batch mode doesn't take any keyboard, mouse or joystick input
+		retry = 5;
+		while(install_keyboard())
+		{	//Try to install the keyboard up to 5 times
+			retry--;
+			if(!retry)
+			{
+				eof_message("Can't set up keyboard!  Error: %s",allegro_error);
+				return 0;
+			}
+			Idle(1);	//Brief wait before retry
 		}
-		Idle(1);	//Brief wait before retry
-	}
 
-	retry = 5;
-	while(install_mouse() < 0)
-	{	//Try to install the mouse up to 5 times
-		retry--;
-		if(!retry)
-		{
-			allegro_message("Can't set up mouse!  Error: %s",allegro_error);
-			return 0;
+		retry = 5;
+		while(install_mouse() < 0)
+		{	//Try to install the mouse up to 5 times
+			retry--;
+			if(!retry)
+			{
+				eof_message("Can't set up mouse!  Error: %s",allegro_error);
+				return 0;
+			}
+			Idle(1);	//Brief wait before retry
 		}
-		Idle(1);	//Brief wait before retry
+		install_joystick(JOY_TYPE_AUTODETECT);
 	}
-	install_joystick(JOY_TYPE_AUTODETECT);
 	alogg_detect_endianess(); // make sure OGG player works for PPC
 
 	//Ensure the current working directory is EOF's program folder
@@ -4354,7 +4787,7 @@ int eof_initialize(int argc, char * argv[])
 		(void) replace_filename(temp_filename, temp_filename, "", 1024);
 		if(eof_chdir(temp_filename))
 		{
-			allegro_message("Could not load program data!\n%s\nMove EOF to a file path without any special (ie. accented) characters if applicable.", temp_filename);
+			eof_message("Could not load program data!\n%s\nMove EOF to a file path without any special (ie. accented) characters if applicable.", temp_filename);
 			return 0;
 		}
 	}
@@ -4372,8 +4805,8 @@ int eof_initialize(int argc, char * argv[])
 	(void) setlocale(LC_ALL, "C");
 
 	//Start the logging system (unless the user disabled it via preferences)
-	if(!ch_sp_path_worker || ch_sp_path_worker_logging)
-	{	//Don't start logging if this is a worker process (unless the separate parameter was provided to enable logging)
+	if(eof_batch_logging)
+	{	//Unless the -nolog batch parameter was given (batch conversion child processes are launched with it)
 		eof_start_logging();
 		seconds = time(NULL);
 		caltime = localtime(&seconds);
@@ -4382,7 +4815,7 @@ int eof_initialize(int argc, char * argv[])
 		eof_log(EOF_VERSION_STRING, 0);
 	}
 
-	if(!ch_sp_path_worker)
+	if(!eof_batch_mode)
 		show_mouse(NULL);
 	eof_load_config("eof.cfg");
 	if((eof_log_level >= 0) && (eof_log_level <= 3))
@@ -4409,6 +4842,15 @@ int eof_initialize(int argc, char * argv[])
 	}
 	put_backslash(eof_songs_path);	//Append a file separator if necessary
 
+	/* divert to batch conversion if applicable, before any display is created */
+	if(eof_batch_mode)
+	{
+		eof_log("Changing to batch conversion mode", 1);
+		(void) eof_batch_convert();
+		eof_quit = 1;	//Signal the main function to exit
+		return 1;
+	}
+
 	eof_zoom_backup = eof_zoom;	//Save this because it will be over-written in eof_set_display_mode()
 	if(eof_zoom_backup <= 0)
 	{	//Validate eof_zoom_backup, to ensure a valid zoom level was loaded from the config file
@@ -4424,14 +4866,14 @@ int eof_initialize(int argc, char * argv[])
 	}
 	if(!eof_set_display_mode_preset_custom_width(eof_screen_layout.mode, eof_screen_width))
 	{
-		allegro_message("Unable to set display mode, reverting to default width!");
+		eof_message("Unable to set display mode, reverting to default width!");
 		if(!eof_set_display_mode_preset(eof_screen_layout.mode))
 		{
-			allegro_message("Unable to set display mode, reverting to default resolution!");
+			eof_message("Unable to set display mode, reverting to default resolution!");
 			eof_screen_layout.mode = 0;
 			if(!eof_set_display_mode_preset(eof_screen_layout.mode))
 			{
-				allegro_message("Unable to set display mode!");
+				eof_message("Unable to set display mode!");
 				return 0;
 			}
 		}
@@ -4452,20 +4894,11 @@ int eof_initialize(int argc, char * argv[])
 	gui_text_list_proc = d_agup_text_list_proc;
 	gui_edit_proc = d_hackish_edit_proc;
 
-	/* divert to the Clone Hero SP pathing behavior if applicable */
-	if(ch_sp_path_worker)
-	{
-		eof_log("Changing to SP path worker mode", 1);
-		eof_ch_sp_path_worker(argv[2]);
-		eof_quit = 1;	//Signal the main function to exit
-		return 1;
-	}
-
 	/* create file filters */
 	eof_filter_eof_files = ncdfs_filter_list_create();
 	if(!eof_filter_eof_files)
 	{
-		allegro_message("Could not create file list filter (*.eof)!");
+		eof_message("Could not create file list filter (*.eof)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_eof_files, "eof", "EOF Files (*.eof)", 1);
@@ -4473,7 +4906,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_midi_files = ncdfs_filter_list_create();
 	if(!eof_filter_midi_files)
 	{
-		allegro_message("Could not create file list filter (*.mid)!");
+		eof_message("Could not create file list filter (*.mid)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_midi_files, "mid;rba", "MIDI Files (*.mid, *.rba)", 1);
@@ -4481,7 +4914,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_dB_files = ncdfs_filter_list_create();
 	if(!eof_filter_dB_files)
 	{
-		allegro_message("Could not create file list filter (*.chart)!");
+		eof_message("Could not create file list filter (*.chart)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_dB_files, "chart", "dB Chart Files (*.chart)", 1);
@@ -4489,7 +4922,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_gh_files = ncdfs_filter_list_create();
 	if(!eof_filter_gh_files)
 	{
-		allegro_message("Could not create file list filter (*.*)!");
+		eof_message("Could not create file list filter (*.*)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_gh_files, "*", "GH Chart Files (*.*)", 1);
@@ -4497,7 +4930,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_ghl_files = ncdfs_filter_list_create();
 	if(!eof_filter_ghl_files)
 	{
-		allegro_message("Could not create file list filter (*.xmk)!");
+		eof_message("Could not create file list filter (*.xmk)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_ghl_files, "xmk", "GHL Chart Files (*.xmk)", 1);
@@ -4505,7 +4938,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_gp_files = ncdfs_filter_list_create();
 	if(!eof_filter_gp_files)
 	{
-		allegro_message("Could not create file list filter (*.gp5;gp4;gp3;xml)!");
+		eof_message("Could not create file list filter (*.gp5;gp4;gp3;xml)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_gp_files, "gp5;gp4;gp3;xml", "Guitar Pro (*.gp?), Go PlayAlong (*.xml)", 1);
@@ -4513,7 +4946,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_gp_lyric_text_files = ncdfs_filter_list_create();
 	if(!eof_filter_gp_lyric_text_files)
 	{
-		allegro_message("Could not create file list filter (*.txt)!");
+		eof_message("Could not create file list filter (*.txt)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_gp_lyric_text_files, "txt", "Guitar Pro lyric text files (*.txt)", 1);
@@ -4521,7 +4954,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_rs_files = ncdfs_filter_list_create();
 	if(!eof_filter_rs_files)
 	{
-		allegro_message("Could not create file list filter (*.xml)!");
+		eof_message("Could not create file list filter (*.xml)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_rs_files, "xml", "Rocksmith chart files (*.xml)", 1);
@@ -4529,7 +4962,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_sonic_visualiser_files = ncdfs_filter_list_create();
 	if(!eof_filter_sonic_visualiser_files)
 	{
-		allegro_message("Could not create file list filter (*.svl)!");
+		eof_message("Could not create file list filter (*.svl)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_sonic_visualiser_files, "svl", "Sonic Visualiser files (*.svl)", 1);
@@ -4537,7 +4970,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_bf_files = ncdfs_filter_list_create();
 	if(!eof_filter_bf_files)
 	{
-		allegro_message("Could not create file list filter (*.rif)!");
+		eof_message("Could not create file list filter (*.rif)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_bf_files, "rif", "Bandfuse chart files (*.rif)", 1);
@@ -4545,7 +4978,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_note_panel_files = ncdfs_filter_list_create();
 	if(!eof_filter_note_panel_files)
 	{
-		allegro_message("Could not create file list filter (*.panel.txt)!");
+		eof_message("Could not create file list filter (*.panel.txt)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_note_panel_files, "panel.txt", "Notes panel text (*.panel.txt)", 1);
@@ -4553,7 +4986,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_array_txt_files = ncdfs_filter_list_create();
 	if(!eof_filter_array_txt_files)
 	{
-		allegro_message("Could not create file list filter (*.txt)!");
+		eof_message("Could not create file list filter (*.txt)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_array_txt_files, "txt", "Queen Bee array text (*.txt)", 1);
@@ -4572,7 +5005,7 @@ int eof_initialize(int argc, char * argv[])
 		{
 			eof_supports_mp3 = 0;
 			(void) delete_file("foo");
-			allegro_message("MP3 support disabled.\n\nPlease install LAME and Vorbis Tools if you want MP3 support.");
+			eof_message("MP3 support disabled.\n\nPlease install LAME and Vorbis Tools if you want MP3 support.");
 		}
 	#elif defined(ALLEGRO_MACOSX)
 		if((eof_system("lame -S check.wav >foo") == 0) && (eof_system("oggenc -h >foo") == 0))
@@ -4585,7 +5018,7 @@ int eof_initialize(int argc, char * argv[])
 		{
 			eof_supports_mp3 = 0;
 			(void) delete_file("foo");
-			allegro_message("MP3 support disabled.\n\nPlease install LAME and Vorbis Tools if you want MP3 support.");
+			eof_message("MP3 support disabled.\n\nPlease install LAME and Vorbis Tools if you want MP3 support.");
 		}
 	#else
 		if((eof_system("lame -S check.wav >foo") == 0) && (eof_system("oggenc -h >foo") == 0))
@@ -4598,51 +5031,16 @@ int eof_initialize(int argc, char * argv[])
 		{
 			eof_supports_mp3 = 0;
 			(void) delete_file("foo");
-			allegro_message("MP3 support disabled.\n\nPlease install LAME and Vorbis Tools if you want MP3 support.");
+			eof_message("MP3 support disabled.\n\nPlease install LAME and Vorbis Tools if you want MP3 support.");
 		}
 	#endif
 	}
 
-	/* check availability of silence generating tools */
-	if(!eof_supports_oggcat)
-	{
-		SAMPLE *silentaudio = create_silence_sample(1);	//Create 1ms worth of silence
-		if(silentaudio != NULL)
-		{	//If the silence was successfully created
-			(void) delete_file("silence.wav");	//Delete these temp files if they exist
-			(void) delete_file("silence.ogg");
-			(void) delete_file("silence2.ogg");
-			(void) delete_file("silence3.ogg");
-			if(save_wav("silence.wav", silentaudio) && exists("silence.wav"))
-			{	//If the wave file was successfully created
-				#ifdef ALLEGRO_WINDOWS
-				if((eof_system("oggenc2 -o silence.ogg -b 128 silence.wav") == 0) &&
-				#else
-				if((eof_system("oggenc -o silence.ogg -b 128 silence.wav") == 0) &&
-				#endif
-					exists("silence.ogg"))
-				{	//If the OGG file was succesfully created
-					if(eof_copy_file("silence.ogg","silence2.ogg") && exists("silence2.ogg"))
-					{	//If the OGG file was successfully duplicated
-						if(!eof_system("oggCat silence3.ogg silence.ogg silence2.ogg") && exists("silence3.ogg"))
-						{	//If oggCat successfully concatenated the two files
-							eof_supports_oggcat = 1;
-							(void) delete_file("silence3.ogg");
-						}
-						(void) delete_file("silence2.ogg");
-					}
-					(void) delete_file("silence.ogg");
-				}
-				(void) delete_file("silence.wav");
-			}
-		}
-	}
-
 	/* make music filter */
 	eof_filter_music_files = ncdfs_filter_list_create();
 	if(!eof_filter_music_files)
 	{
-		allegro_message("Could not create file list filter (*.mp3, *.ogg)!");
+		eof_message("Could not create file list filter (*.mp3, *.ogg)!");
 		return 0;
 	}
 	if(eof_supports_mp3)
@@ -4656,7 +5054,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_ogg_files = ncdfs_filter_list_create();
 	if(!eof_filter_ogg_files)
 	{
-		allegro_message("Could not create file list filter (*.ogg)!");
+		eof_message("Could not create file list filter (*.ogg)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_ogg_files, "ogg", "Music Files (*.ogg)", 1);
@@ -4664,7 +5062,7 @@ int eof_initialize(int argc, char * argv[])
 	eof_filter_lyrics_files = ncdfs_filter_list_create();
 	if(!eof_filter_lyrics_files)
 	{
-		allegro_message("Could not create file list filter (*.txt, *.mid, *.rmi, *.rba, *.lrc, *.vl, *.kar, *.mp3, *.srt, *.xml)!");
+		eof_message("Could not create file list filter (*.txt, *.mid, *.rmi, *.rba, *.lrc, *.vl, *.kar, *.mp3, *.srt, *.xml)!");
 		return 0;
 	}
 	ncdfs_filter_list_add(eof_filter_lyrics_files, "txt;mid;rmi;rba;lrc;vl;kar;mp3;srt;xml;c9c", "Lyrics (txt,mid,rmi,rba,lrc,vl,kar,mp3,srt,xml,c9c)", 1);
@@ -4673,22 +5071,26 @@ int eof_initialize(int argc, char * argv[])
 	#ifdef ALLEGRO_WINDOWS
 		if(!eof_filter_exe_files)
 		{
-			allegro_message("Could not create file list filter (*.exe)!");
+			eof_message("Could not create file list filter (*.exe)!");
 			return 0;
 		}
 		ncdfs_filter_list_add(eof_filter_exe_files, "exe", "Executable Files (*.exe)", 1);
 	#else
 		if(!eof_filter_exe_files)
 		{
-			allegro_message("Could not create file list filter (*.*)!");
+			eof_message("Could not create file list filter (*.*)!");
 			return 0;
 		}
 		ncdfs_filter_list_add(eof_filter_exe_files, "*", "Executable Files (*.*)", 1);
 	#endif
 
 	eof_undo_reset(); // restart undo system
-	memset(&eof_selection, 0, sizeof(EOF_SELECTION_DATA));
-	eof_selection.current = EOF_MAX_NOTES - 1;
+	if(!eof_selection_reserve(EOF_MIN_NOTE_CAPACITY))
+	{
+		eof_message("Could not allocate the note selection array!");
+		return 0;
+	}
+	eof_selection_reset();
 
 	eof_log("\tInitializing audio", 1);
 	eof_mix_init();
@@ -4733,13 +5135,13 @@ int eof_initialize(int argc, char * argv[])
 					{	//If the recovery file contained the names of an undo file and a project file that each exist
 						eof_clear_input();
 						eof_use_key();
-						if(alert(NULL, "Recover crashed project from last undo state?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+						if(eof_alert(NULL, "Recover crashed project from last undo state?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 						{	//If user opts to recover from a crashed EOF instance
 							eof_log("\t\tLoading last undo state", 1);
 							eof_song = eof_load_song(buffer);
 							if(!eof_song)
 							{
-								allegro_message("Unable to load last undo state. File could be corrupt!");
+								eof_message("Unable to load last undo state. File could be corrupt!");
 								return 0;
 							}
 							(void) ustrcpy(eof_filename, ptr);		//Set the full project path
@@ -4749,7 +5151,7 @@ int eof_initialize(int argc, char * argv[])
 							(void) append_filename(temp_filename, eof_song_path, eof_song->tags->ogg[0].filename, 1024);	//Construct the full OGG path
 							if(!eof_load_ogg(temp_filename, 1))	//If user does not provide audio, fail over to using silent audio
 							{
-								allegro_message("Failed to load OGG!");
+								eof_message("Failed to load OGG!");
 								return 0;
 							}
 							eof_song_loaded = 1;
@@ -4790,7 +5192,7 @@ int eof_initialize(int argc, char * argv[])
 				eof_song = eof_load_song(argv[i]);
 				if(!eof_song)
 				{
-					allegro_message("Unable to load project. File could be corrupt!");
+					eof_message("Unable to load project. File could be corrupt!");
 					return 0;
 				}
 
@@ -4802,7 +5204,7 @@ int eof_initialize(int argc, char * argv[])
 				(void) append_filename(temp_filename, eof_song_path, eof_song->tags->ogg[0].filename, 1024);
 				if(!eof_load_ogg(temp_filename, 1))	//If user does not provide audio, fail over to using silent audio
 				{
-					allegro_message("Failed to load OGG!");
+					eof_message("Failed to load OGG!");
 					return 0;
 				}
 				eof_song_loaded = 1;
@@ -4813,7 +5215,7 @@ int eof_initialize(int argc, char * argv[])
 				eof_song = eof_import_midi(argv[i]);
 				if(!eof_song)
 				{
-					allegro_message("Could not import MIDI!");
+					eof_message("Could not import MIDI!");
 					return 0;
 				}
 				eof_init_after_load(0);
@@ -4831,7 +5233,10 @@ int eof_initialize(int argc, char * argv[])
 			}
 			else if(!ustricmp(get_extension(argv[i]), "rba"))
 			{
-				(void) replace_filename(temp_filename, argv[i], "eof_rba_import.tmp", 1024);
+				char rbatempname[30] = {0};
+
+				(void) snprintf(rbatempname, sizeof(rbatempname) - 1, "eof_rba_import%03u.tmp", eof_log_id);	//Include this instance's ID so instances importing from the same folder don't share the file
+				(void) replace_filename(temp_filename, argv[i], rbatempname, 1024);
 
 				if(eof_extract_rba_midi(argv[i], temp_filename) == 0)
 				{	//If this was an RBA file and the MIDI was extracted successfully
@@ -4840,7 +5245,7 @@ int eof_initialize(int argc, char * argv[])
 				}
 				if(!eof_song)
 				{
-					allegro_message("Could not import RBA!");
+					eof_message("Could not import RBA!");
 					return 0;
 				}
 
@@ -4862,7 +5267,7 @@ int eof_initialize(int argc, char * argv[])
 				eof_song = eof_import_chart(argv[i]);
 				if(!eof_song)
 				{
-					allegro_message("Could not import Feedback chart!");
+					eof_message("Could not import Feedback chart!");
 					return 0;
 				}
 				eof_song_enforce_mid_beat_tempo_change_removal();	//Remove mid beat tempo changes if applicable
@@ -4873,7 +5278,7 @@ int eof_initialize(int argc, char * argv[])
 				eof_song = eof_import_gh(argv[i]);
 				if(!eof_song)
 				{
-					allegro_message("Could not import Guitar Hero .pak!");
+					eof_message("Could not import Guitar Hero .pak!");
 					return 0;
 				}
 				eof_song_loaded = 1;
@@ -4884,7 +5289,7 @@ int eof_initialize(int argc, char * argv[])
 				eof_song = eof_load_bf(argv[i]);
 				if(!eof_song)
 				{
-					allegro_message("Could not import Bandfuse chart!");
+					eof_message("Could not import Bandfuse chart!");
 					return 0;
 				}
 				eof_song_loaded = 1;
@@ -4903,7 +5308,7 @@ int eof_initialize(int argc, char * argv[])
 					}
 					else
 					{
-						allegro_message("Could not import Rocksmith XML file!");
+						eof_message("Could not import Rocksmith XML file!");
 						return 0;
 					}
 				}
@@ -4915,7 +5320,7 @@ int eof_initialize(int argc, char * argv[])
 					}
 					else
 					{
-						allegro_message("Could not import Go PlayAlong XML file!");
+						eof_message("Could not import Go PlayAlong XML file!");
 						return 0;
 					}
 				}
@@ -4928,7 +5333,7 @@ int eof_initialize(int argc, char * argv[])
 				}
 				else
 				{
-					allegro_message("Could not import Guitar Pro file!");
+					eof_message("Could not import Guitar Pro file!");
 					return 0;
 				}
 			}
@@ -4961,7 +5366,7 @@ int eof_initialize(int argc, char * argv[])
 	//Warn about toolkit support for abridged RS2 files
 	if(eof_abridged_rs2_export && !eof_abridged_rs2_export_warning_suppressed)
 	{	//If abridged RS2 export is enabled and this warning hasn't been permanently dismissed
-		if(alert3("Warning:  The abridged RS2 file export preference is enabled.", "These XML files are only supported in Rocksmith Custom Song Toolkit 2.8.2.0 or newer.", "Ensure you have a new enough toolkit or disable this option in File>Preferences>Import/Export", "&OK", "Don't warn again", "&OK", 'O', 0, 'O') == 2)
+		if(eof_alert3("Warning:  The abridged RS2 file export preference is enabled.", "These XML files are only supported in Rocksmith Custom Song Toolkit 2.8.2.0 or newer.", "Ensure you have a new enough toolkit or disable this option in File>Preferences>Import/Export", "&OK", "Don't warn again", "&OK", 'O', 0, 'O') == 2)
 		{	//If the user opts to permanently suppress this warning
 			eof_abridged_rs2_export_warning_suppressed = 1;
 		}
@@ -4979,7 +5384,7 @@ int eof_initialize(int argc, char * argv[])
 
 			if(!ustrcmp(eof_songs_path, exepath))
 			{	//If the song path is currently set to the default of the executable file's parent folder
-				int retval = alert3("The default location for new projects is with EOF's executable and that can ultimately", "be within the application bundle.  This can make it hard to find in OS X.", "Would you like to browse for a different song folder location now?", "Yes", "No", "Later", 0, 0, 0);
+				int retval = eof_alert3("The default location for new projects is with EOF's executable and that can ultimately", "be within the application bundle.  This can make it hard to find in OS X.", "Would you like to browse for a different song folder location now?", "Yes", "No", "Later", 0, 0, 0);
 
 				if(retval == 1)
 				{	//If the user opts to define the song folder
@@ -5034,8 +5439,8 @@ void eof_exit(void)
 	//Delete the undo/redo related files
 	(void) eof_validate_temp_folder();	//Attempt to set the current working directory if it isn't EOF's executable/resource folder
 
-	if(!ch_sp_path_worker)
-	{	//None of these are applicable if this EOF instance was a worker process
+	if(!eof_batch_mode)
+	{	//Batch conversions (which may run as many processes at once) don't change the configuration
 		eof_save_config("eof.cfg");
 		if(!exists("eof.cfg"))
 		{
@@ -5051,34 +5456,36 @@ void eof_exit(void)
 				eof_log("Allegro's config routines could not create eof.cfg, but the standard fopen() function was able to.  Please report whether subsequent EOF sessions also fail to save the configuration.", 1);
 				fclose(fp);
 			}
-			allegro_message("Error:  Could not write config file eof.cfg.  Check logging for details.");
+			eof_message("Error:  Could not write config file eof.cfg.  Check logging for details.");
 		}
 		else
 		{
 			eof_log("\tConfiguration saved", 3);
 		}
-		(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo", eof_temp_path_s, eof_log_id);	//Get the name of this EOF instance's redo file
-		(void) delete_file(fn);	//And delete it if it exists
-		(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo.ogg", eof_temp_path_s, eof_log_id);	//Get the name of this EOF instance's redo OGG
-		(void) delete_file(fn);	//And delete it if it exists
-		if(eof_undo_states_initialized > 0)
-		{
-			for(i = 0; i < EOF_MAX_UNDO; i++)
-			{	//For each undo slot
-				if(eof_undo_filename[i])
-				{
-					(void) delete_file(eof_undo_filename[i]);	//Delete the undo file
-					(void) snprintf(fn, sizeof(fn) - 1, "%s.ogg", eof_undo_filename[i]);	//Get the filename of any associated undo OGG
-					(void) delete_file(fn);	//And delete it if it exists
-				}
+	}
+	eof_undo_stop_recovery_writer();	//Finish writing any pending auto-recovery snapshot before the undo files are deleted
+	(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo", eof_temp_path_s, eof_log_id);	//Get the name of this EOF instance's redo file
+	(void) delete_file(fn);	//And delete it if it exists
+	(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo.ogg", eof_temp_path_s, eof_log_id);	//Get the name of this EOF instance's redo OGG
+	(void) delete_file(fn);	//And delete it if it exists
+	if(eof_undo_states_initialized > 0)
+	{
+		for(i = 0; i < EOF_MAX_UNDO; i++)
+		{	//For each undo slot
+			if(eof_undo_filename[i])
+			{
+				(void) delete_file(eof_undo_filename[i]);	//Delete the undo file
+				(void) snprintf(fn, sizeof(fn) - 1, "%s.ogg", eof_undo_filename[i]);	//Get the filename of any associated undo OGG
+				(void) delete_file(fn);	//And delete it if it exists
 			}
 		}
-		(void) snprintf(eof_autoadjust_path, sizeof(eof_autoadjust_path) - 1, "%seof.autoadjust", eof_temp_path_s);
-		(void) delete_file(eof_autoadjust_path);
-		eof_destroy_undo();
 	}
+	(void) snprintf(eof_autoadjust_path, sizeof(eof_autoadjust_path) - 1, "%seof.autoadjust", eof_temp_path_s);
+	(void) delete_file(eof_autoadjust_path);
+	eof_destroy_undo();
+	eof_destroy_midi_events();
 
-	//Free the file filters (they will not have been set to a non NULL value if EOF launched via command line as a worker process
+	//Free the file filters
 	if(eof_filter_music_files)
 		free(eof_filter_music_files);
 	if(eof_filter_ogg_files)
@@ -5131,10 +5538,13 @@ void eof_exit(void)
 	eof_destroy_data();	//Frees graphics and fonts from memory
 	eof_destroy_ogg();	//Frees chart audio
 	eof_destroy_song(eof_song);	//Frees memory used by any currently loaded chart
+	eof_selection_free();	//Frees the note selection array
+	eof_free_note_names();	//Frees the interned note names
 	eof_destroy_waveform(eof_waveform);	//Frees memory used by any currently loaded waveform data
 	eof_waveform = NULL;
 	eof_destroy_spectrogram(eof_spectrogram);	//Frees memory used by any currently loaded spectrogram data
 	eof_spectrogram = NULL;
+	eof_destroy_spectrogram_fftplan();	//Frees the FFTW plan kept for generating spectrograms
 	eof_window_destroy(eof_window_editor);
 	eof_window_destroy(eof_window_editor2);
 	eof_window_destroy(eof_window_note_lower_left);
@@ -5207,6 +5617,7 @@ void eof_init_after_load(char initaftersavestate)
 	eof_log("\tInitializing after load", 1);
 	eof_log("eof_init_after_load() entered", 1);
 
+	eof_chart_edit_counter++;	//The chart was replaced by a loaded project or undo/redo state
 	eof_music_paused = 1;
 	if((eof_selected_track == 0) || (eof_selected_track >= eof_song->tracks))
 	{	//Validate eof_selected_track, to ensure a valid track was loaded from the config file
@@ -5427,29 +5838,17 @@ void eof_start_logging(void)
 
 	if((eof_log_fp == NULL) && eof_enable_logging)
 	{	//If logging isn't alredy running, and logging isn't disabled
-		srand(time(NULL));	//Seed the random number generator with the current time
-		// coverity[dont_call]
-		eof_log_id = ((unsigned int) rand()) % 1000;	//Create a 3 digit random number to represent this EOF instance
 		get_executable_name(log_filename, 1024);	//Get the path of the EOF binary that is running
-		if(ch_sp_path_worker_logging)
-		{	//If this is a worker process, use the process number in the log file name
-			char tempstr[10];
-
-			(void) snprintf(tempstr, sizeof(tempstr) - 1, "%lu.log", ch_sp_path_worker_number);
-			(void) replace_filename(log_filename, log_filename, tempstr, 1024);
-		}
-		else
-		{	//Normal EOF process
-			(void) replace_filename(log_filename, log_filename, "eof_log.txt", 1024);
-		}
+		(void) replace_filename(log_filename, log_filename, "eof_log.txt", 1024);
 		eof_log_fp = fopen(log_filename, "w");
+		eof_log_start_writer();
 
 		if(eof_log_fp == NULL)
 		{
 			#ifdef ALLEGRO_MACOSX
-				allegro_message("Error opening log file for writing.  Move EOF to a file path without any special (ie. accented) characters if applicable, and also move outside of the Downloads folder.");
+				eof_message("Error opening log file for writing.  Move EOF to a file path without any special (ie. accented) characters if applicable, and also move outside of the Downloads folder.");
 			#else
-				allegro_message("Error opening log file for writing.  Move EOF to a file path without any special (ie. accented) characters if applicable.");
+				eof_message("Error opening log file for writing.  Move EOF to a file path without any special (ie. accented) characters if applicable.");
 			#endif
 		}
 		#ifdef ALLEGRO_WINDOWS
@@ -5468,7 +5867,7 @@ void eof_start_logging(void)
 				eof_log(eof_log_string, 1);
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tOutput log path:  %s", log_filename);
 				eof_log(eof_log_string, 1);
-				allegro_message("Warning:  Running EOF from within a \"Program files\" folder in Windows Vista or newer can cause problems.  Moving the EOF program folder elsewhere is recommended.\"");
+				eof_message("Warning:  Running EOF from within a \"Program files\" folder in Windows Vista or newer can cause problems.  Moving the EOF program folder elsewhere is recommended.\"");
 			}
 		}
 		#endif
@@ -5479,24 +5878,225 @@ void eof_stop_logging(void)
 {
 	if(eof_log_fp)
 	{
+		eof_log_stop_writer();	//Write all queued log text before the file is closed
 		(void) fclose(eof_log_fp);
 		eof_log_fp = NULL;
 	}
 }
 
 #define EOF_LOG_STRING_SIZE 2048
+#define EOF_LOG_RING_SIZE 65536	//Must be a power of two
 char eof_log_string[EOF_LOG_STRING_SIZE] = {0};
+static char eof_log_ring[EOF_LOG_RING_SIZE];	//Log text waiting to be written by the log writer thread
+static volatile unsigned long eof_log_ring_head = 0;	//The total number of bytes ever queued.  Both counters are masked with EOF_LOG_RING_SIZE - 1 to index the ring
+static volatile unsigned long eof_log_ring_tail = 0;	//The total number of bytes ever written to the log file
+static pthread_mutex_t eof_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t eof_log_data_cond = PTHREAD_COND_INITIALIZER;	//Signaled when text is queued
+static pthread_cond_t eof_log_space_cond = PTHREAD_COND_INITIALIZER;	//Signaled when queued text has been written
+static pthread_t eof_log_thread;
+static int eof_log_thread_running = 0;
+static int eof_log_thread_stop = 0;
+static void (*eof_log_old_signal_handler[4])(int);
+static const int eof_log_crash_signal[4] = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+
+static void eof_log_write_ring(unsigned long tail, unsigned long head)
+{
+	unsigned long start = tail & (EOF_LOG_RING_SIZE - 1), length = head - tail;
+
+	if(start + length > EOF_LOG_RING_SIZE)
+	{	//If the queued text wraps around the end of the ring
+		(void) fwrite(&eof_log_ring[start], 1, EOF_LOG_RING_SIZE - start, eof_log_fp);
+		length -= EOF_LOG_RING_SIZE - start;
+		start = 0;
+	}
+	(void) fwrite(&eof_log_ring[start], 1, length, eof_log_fp);
+	(void) fflush(eof_log_fp);	//Explicitly commit the write to disk
+}
+
+static void *eof_log_writer_thread(void *arg)
+{
+	unsigned long head;
+
+	(void) arg;
+	(void) pthread_mutex_lock(&eof_log_lock);
+	while(1)
+	{
+		while((eof_log_ring_head == eof_log_ring_tail) && !eof_log_thread_stop)
+		{	//Wait for log text to be queued
+			(void) pthread_cond_wait(&eof_log_data_cond, &eof_log_lock);
+		}
+		if(eof_log_ring_head == eof_log_ring_tail)
+			break;	//Stopping with nothing left to write
+
+		//Producers only ever write to the free part of the ring, so everything queued up to this point can be written without holding the lock
+		head = eof_log_ring_head;
+		(void) pthread_mutex_unlock(&eof_log_lock);
+		eof_log_write_ring(eof_log_ring_tail, head);
+		(void) pthread_mutex_lock(&eof_log_lock);
+		eof_log_ring_tail = head;
+		(void) pthread_cond_broadcast(&eof_log_space_cond);
+	}
+	(void) pthread_mutex_unlock(&eof_log_lock);
+
+	return NULL;
+}
+
+static void eof_log_enqueue(const char *text, size_t length)
+{
+	unsigned long space, start, count;
+
+	if(!eof_log_fp || !text || !length)
+		return;
+
+	(void) pthread_mutex_lock(&eof_log_lock);
+	if(!eof_log_thread_running)
+	{	//If the writer thread isn't running, write the text directly
+		(void) fwrite(text, 1, length, eof_log_fp);
+		(void) fflush(eof_log_fp);
+		(void) pthread_mutex_unlock(&eof_log_lock);
+		return;
+	}
+	while(length)
+	{	//Until all of the text is queued
+		while((space = EOF_LOG_RING_SIZE - (eof_log_ring_head - eof_log_ring_tail)) == 0)
+		{	//If the ring is full, wait for the writer thread to catch up
+			(void) pthread_cond_broadcast(&eof_log_data_cond);
+			(void) pthread_cond_wait(&eof_log_space_cond, &eof_log_lock);
+		}
+		start = eof_log_ring_head & (EOF_LOG_RING_SIZE - 1);
+		count = (length < space) ? length : space;
+		if(start + count > EOF_LOG_RING_SIZE)
+		{	//Don't copy past the end of the ring, the rest of the text goes to the beginning in the next pass
+			count = EOF_LOG_RING_SIZE - start;
+		}
+		memcpy(&eof_log_ring[start], text, count);
+		eof_log_ring_head += count;
+		text += count;
+		length -= count;
+	}
+	(void) pthread_cond_broadcast(&eof_log_data_cond);
+	(void) pthread_mutex_unlock(&eof_log_lock);
+}
+
+static void eof_log_flush(void)
+{
+	unsigned long head, tail;
+
+	if(!eof_log_fp)
+		return;
+
+	//Writes any queued log text from the crash handler.  The lock may be held by the thread that crashed, so the ring is written without it
+	//The tail is advanced before writing so the writer thread doesn't write the same text again
+	head = eof_log_ring_head;
+	tail = eof_log_ring_tail;
+	if(head != tail)
+	{
+		eof_log_ring_tail = head;
+		eof_log_write_ring(tail, head);
+	}
+}
+
+static void eof_log_crash_handler(int sig)
+{
+	unsigned long ctr;
+
+	eof_log_flush();
+	for(ctr = 0; ctr < 4; ctr++)
+	{	//Restore the handler that was in place before logging started, and let it handle the signal
+		if(eof_log_crash_signal[ctr] == sig)
+		{
+			(void) signal(sig, eof_log_old_signal_handler[ctr] ? eof_log_old_signal_handler[ctr] : SIG_DFL);
+			break;
+		}
+	}
+	(void) raise(sig);
+}
+
+void eof_log_start_writer(void)
+{
+	unsigned long ctr;
+	static int exit_registered = 0;
+
+	if(!eof_log_fp || eof_log_thread_running)
+		return;
+
+	eof_log_ring_head = eof_log_ring_tail = 0;
+	eof_log_thread_stop = 0;
+	if(pthread_create(&eof_log_thread, NULL, eof_log_writer_thread, NULL))
+		return;	//Log lines will be written directly instead
+	eof_log_thread_running = 1;
+	if(!exit_registered)
+	{	//If the program exits without going through eof_exit(), still write the queued log text
+		(void) atexit(eof_stop_logging);
+		exit_registered = 1;
+	}
+	for(ctr = 0; ctr < 4; ctr++)
+	{	//Write queued log text to disk if EOF crashes
+		eof_log_old_signal_handler[ctr] = signal(eof_log_crash_signal[ctr], eof_log_crash_handler);
+		if(eof_log_old_signal_handler[ctr] == SIG_ERR)
+		{
+			eof_log_old_signal_handler[ctr] = NULL;
+		}
+	}
+}
+
+void eof_log_stop_writer(void)
+{
+	unsigned long ctr;
+
+	if(!eof_log_thread_running)
+		return;
+
+	for(ctr = 0; ctr < 4; ctr++)
+	{	//Restore the previous signal handlers
+		(void) signal(eof_log_crash_signal[ctr], eof_log_old_signal_handler[ctr] ? eof_log_old_signal_handler[ctr] : SIG_DFL);
+	}
+	(void) pthread_mutex_lock(&eof_log_lock);
+	eof_log_thread_stop = 1;	//The thread writes everything that is queued and exits
+	(void) pthread_cond_broadcast(&eof_log_data_cond);
+	(void) pthread_mutex_unlock(&eof_log_lock);
+	(void) pthread_join(eof_log_thread, NULL);
+	eof_log_thread_running = 0;
+}
+
 void eof_log(const char *text, int level)
 {
+	char line[EOF_LOG_STRING_SIZE + 8], *buffer = line;
+	size_t length;
+
 	if(text && eof_log_fp && (eof_log_level >= level))
 	{	//If the log file is open and the current logging level is high enough
-		if(fprintf(eof_log_fp, "%03u: %s\n", eof_log_id, text) > 0)	//Prefix the log text with this EOF instance's logging ID
-		{	//If the log line was successfully written
-			(void) fflush(eof_log_fp);	//Explicitly commit the write to disk
+		length = strlen(text) + 6;	//The log ID prefix, the text and a newline character
+		if(length >= sizeof(line))
+		{	//If the text is too long for the local buffer
+			buffer = malloc(length + 1);
+			if(!buffer)
+				return;
+		}
+		(void) snprintf(buffer, length + 1, "%03u: %s\n", eof_log_id, text);	//Prefix the log text with this EOF instance's logging ID
+		eof_log_enqueue(buffer, strlen(buffer));
+		if(buffer != line)
+		{
+			free(buffer);
 		}
 	}
 }
 
+void eof_logf(int level, const char *format, ...)
+{
+	char buffer[EOF_LOG_STRING_SIZE];
+	va_list args;
+
+	if(!format || !eof_log_fp || (eof_log_level < level))
+		return;	//Don't spend any time formatting text that won't be logged
+
+	va_start(args, format);
+	(void) vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	buffer[sizeof(buffer) - 1] = '\0';
+	eof_log(buffer, level);
+}
+
 void eof_log_casual(const char *text, int level, int prefix, int newline)
 {
 	static char buffer[EOF_LOG_STRING_SIZE * 2] = {0};
@@ -5509,8 +6109,7 @@ void eof_log_casual(const char *text, int level, int prefix, int newline)
 	{	//If the log file is open
 		if(!text)
 		{	//If the input string is NULL, flush buffer to disk
-			(void) fputs(buffer, eof_log_fp);	//Write the buffer to file
-			(void) fflush(eof_log_fp);			//Explicitly commit the write to disk
+			eof_log_enqueue(buffer, buffered_chars);	//Queue the buffer to be written to file
 			buffer[0] = '\0';	//Empty the buffers
 			buffer2[0] = '\0';
 			buffered_chars = 0;
@@ -5545,7 +6144,7 @@ void eof_log_casual(const char *text, int level, int prefix, int newline)
 				length = strlen(buffer2);
 				if(buffered_chars + length >= sizeof(buffer))
 				{	//If the buffer isn't large enough to hold this string
-					(void) fputs(buffer, eof_log_fp);	//Flush the buffer to file
+					eof_log_enqueue(buffer, buffered_chars);	//Flush the buffer to file
 					buffer[0] = '\0';	//Empty the buffer
 					buffered_chars = 0;
 				}
@@ -5624,17 +6223,23 @@ void eof_log_cwd(void)
 /* use to prevent 100% CPU usage */
 static void eof_idle_logic(void)
 {
+	int resttime = eof_cpu_saver * 5;
+
+	if(eof_render_skipped && (resttime < 10))
+	{	//If nothing changed during the last frame, rest for at least one logic tick, any input will still be handled at the next one
+		resttime = 10;
+	}
 	if(eof_new_idle_system)
 	{	//If the newer idle system was enabled via command line
 		/* rest to save CPU */
 		if(eof_has_focus)
 		{
 			#ifndef ALLEGRO_WINDOWS
-				Idle(eof_cpu_saver * 5);
+				Idle(resttime);
 			#else
-				if(eof_disable_vsync)
-				{
-					Idle(eof_cpu_saver * 5);
+				if(eof_disable_vsync || eof_render_skipped)
+				{	//If vsync isn't limiting the frame rate, or no frame was rendered to wait for vsync
+					Idle(resttime);
 				}
 			#endif
 		}
@@ -5651,7 +6256,7 @@ static void eof_idle_logic(void)
 		/* rest to save CPU */
 		if(eof_has_focus)
 		{
-			rest(eof_cpu_saver * 5);
+			rest(resttime);
 		}
 
 		/* make program "sleep" until it is back in focus */
@@ -5734,19 +6339,24 @@ int main(int argc, char * argv[])
 		/* update and draw the screen */
 		if(!updated)
 		{
-			eof_render();
 			updated = 1;
-
-			#define EOF_FPS_SAMPLE_COUNT 10
-			eof_main_loop_ctr++;	//Count the number of calls to eof_render in this loop
-			if(eof_main_loop_ctr >= EOF_FPS_SAMPLE_COUNT)
-			{	//Every 5 renders, detect the number of rendered frames per second
-				time2 = clock();
-				if(time2 > time1)
-				{	//Verify these values are different in order to avoid a division by zero
-					eof_main_loop_fps = (double)CLOCKS_PER_SEC / ((double)time2 - time1) * EOF_FPS_SAMPLE_COUNT;
-					time1 = time2;
-					eof_main_loop_ctr = 0;
+			eof_render_skipped = 1;
+			if(eof_update_render_damage())
+			{	//Only redraw if something that is displayed changed since the last frame
+				eof_render_damaged();
+				eof_render_skipped = 0;
+
+				#define EOF_FPS_SAMPLE_COUNT 10
+				eof_main_loop_ctr++;	//Count the number of calls to eof_render in this loop
+				if(eof_main_loop_ctr >= EOF_FPS_SAMPLE_COUNT)
+				{	//Every 5 renders, detect the number of rendered frames per second
+					time2 = clock();
+					if(time2 > time1)
+					{	//Verify these values are different in order to avoid a division by zero
+						eof_main_loop_fps = (double)CLOCKS_PER_SEC / ((double)time2 - time1) * EOF_FPS_SAMPLE_COUNT;
+						time1 = time2;
+						eof_main_loop_ctr = 0;
+					}
 				}
 			}
 		}
@@ -5817,7 +6427,7 @@ int main(int argc, char * argv[])
 		#endif
 		eof_exit();
 	}
-	return 0;
+	return (eof_batch_failed ? 1 : 0);	//In batch mode, the exit code reports whether any file failed to convert
 }
 
 int eof_beat_is_mandatory_anchor(EOF_SONG *sp, unsigned long beat)
@@ -6083,6 +6693,7 @@ void eof_set_color_set(void)
 
 	eof_log("eof_set_color_set() entered", 2);
 
+	eof_destroy_fret_number_sprites();	//Re-render the fret numbers with the new color set
 	if(!eof_song)
 		return;
 
@@ -6318,64 +6929,47 @@ EOF_SONG *eof_create_new_project_select_pro_guitar(void)
 int eof_identify_xml(char *fn)
 {
 	char *buffer;
-	PACKFILE *inf = NULL;
-	size_t maxlinelength;
+	EOF_TEXT_FILE *inf = NULL;
+	EOF_XML_TAG tag;
 	int done = 0;
 	int retval = 0;
 
 	if(!fn)
 		return 0;	//Return error
 
-	inf = pack_fopen(fn, "rt");	//Open file in text mode
+	inf = eof_text_fopen(fn);	//Buffer the file so it can be parsed in a single pass
 	if(!inf)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError loading:  Cannot open input xml file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
-		eof_log(eof_log_string, 1);
+		eof_log("\tError loading:  Cannot buffer input xml file", 1);
 		return 0;	//Return error
 	}
 
-	//Allocate memory buffers large enough to hold any line in this file
-	maxlinelength = (size_t)FindLongestLineLength_ALLEGRO(fn, 0);
-	if(!maxlinelength)
-	{
-		eof_log("\tError finding the largest line in the file.  Aborting", 1);
-		(void) pack_fclose(inf);
-		return 0;	//Return error
-	}
-	buffer = (char *)malloc(maxlinelength);
-	if(!buffer)
-	{
-		(void) pack_fclose(inf);
-		return 0;	//Return error
-	}
-
-	//Read first line of text, capping it to prevent buffer overflow
-	if(!pack_fgets(buffer, (int)maxlinelength, inf))
-	{	//I/O error
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "XML inspection failed.  Unable to read from file:  \"%s\"", strerror(errno));
-		eof_log(eof_log_string, 1);
+	//Read first line of text
+	if(eof_text_feof(inf))
+	{	//Empty file
+		eof_log("XML inspection failed.  The file is empty", 1);
 		done = 1;
 	}
+	buffer = eof_text_fgets(inf);
 
 	//Parse the contents of the file
-	while(!done && !pack_feof(inf))
+	while(!done && !eof_text_feof(inf))
 	{	//Until there was an error reading from the file or end of file is reached
-		if(strcasestr_spec(buffer, "<ebeats"))
+		if(eof_xml_find_tag(buffer, "ebeats", &tag))
 		{	//If this is the opening ebeats tag (Rocksmith XML file)
 			retval = 1;
 			done = 1;
 		}
-		else if(strcasestr_spec(buffer, "<scoreUrl>"))
+		else if(eof_xml_find_tag(buffer, "scoreUrl", &tag))
 		{	//If this is a scoreUrl tag (Go PlayAlong XML file)
 			retval = 2;
 			done = 1;
 		}
 
-		(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+		buffer = eof_text_fgets(inf);	//Read next line of text
 	}//Until there was an error reading from the file or end of file is reached
 
-	free(buffer);
-	(void) pack_fclose(inf);
+	eof_text_fclose(inf);
 
 	return retval;
 }
@@ -6446,7 +7040,7 @@ int eof_validate_temp_folder(void)
 	if(eof_mkdir(eof_temp_path))
 	{	//If the folder could not be created
 		eof_log("\t\tCould not create temp folder", 1);
-		allegro_message("Could not create temp folder (%s)", eof_temp_path_s);
+		eof_message("Could not create temp folder (%s)", eof_temp_path_s);
 		return 3;
 	}
 
@@ -6498,7 +7092,7 @@ int eof_load_and_scale_hopo_images(double value)
 	}
 	if(!exists("eof.dat"))
 	{
-		allegro_message("DAT file missing.  If using a hotfix, make sure you extract the appropriate EOF release candidate first and then extract the hotfix on top of it (replacing with files in the hotfix).");
+		eof_message("DAT file missing.  If using a hotfix, make sure you extract the appropriate EOF release candidate first and then extract the hotfix on top of it (replacing with files in the hotfix).");
 		return 0;
 	}
 
@@ -6602,7 +7196,7 @@ int eof_increase_display_width_to_panel_count(int prompt)
 		eof_clear_input();
 		if(prompt)
 		{	//If the calling function specified to prompt the user
-			retval = alert(NULL, "Resize the program window to fit all panels?", NULL, "&Yes", "&No", 'y', 'n');
+			retval = eof_alert(NULL, "Resize the program window to fit all panels?", NULL, "&Yes", "&No", 'y', 'n');
 
 			if(retval != 1)
 			{	//If the user declined to resize
@@ -394,6 +394,7 @@ extern int         eof_gp_import_nat_harmonics_only;
 extern int         eof_min_note_length;
 extern int         eof_enforce_chord_density;
 extern unsigned    eof_chord_density_threshold;
+extern unsigned    eof_recovery_interval;
 extern unsigned    eof_min_note_distance;
 extern unsigned    eof_min_note_distance_intervals;
 extern int         eof_render_bass_drum_in_lane;
@@ -472,7 +473,7 @@ extern int         eof_undo_toggle;
 extern int         eof_redo_toggle;
 extern int         eof_window_title_dirty;
 extern int         eof_change_count;
-extern int         eof_last_note;
+extern unsigned long eof_chart_edit_counter;	//Incremented whenever an undo state is made or a project is loaded/undone/redone, so cached chart statistics know they have to be rebuilt
 extern int         eof_last_midi_offset;
 extern int         eof_notes_moved;
 extern EOF_NOTE *  eof_entering_note_note;
@@ -485,9 +486,6 @@ extern int         eof_shift_released;
 extern int         eof_shift_used;
 extern int         eof_tab_released;
 extern int         eof_emergency_stop;
-extern int         ch_sp_path_worker;
-extern int         ch_sp_path_worker_logging;
-extern unsigned long ch_sp_path_worker_number;
 extern char        eof_default_ini_setting[EOF_MAX_INI_SETTINGS][EOF_INI_LENGTH];
 extern unsigned short eof_default_ini_settings;
 
@@ -618,7 +616,6 @@ extern char      * eof_snap_name[11];
 extern char      * eof_input_name[EOF_INPUT_NAME_NUM + 1];
 
 extern char        eof_supports_mp3;
-extern char        eof_supports_oggcat;
 extern char        eof_just_played;
 extern char        eof_mark_drums_as_cymbal;
 extern char        eof_mark_drums_as_double_bass;
@@ -710,6 +707,13 @@ int eof_set_display_mode(unsigned long width, unsigned long height);
 void eof_set_3d_projection(void);	//Sets the 3d projection by calling ocd3d_set_projection() with the screen dimensions and vanishing coordinate
 void eof_determine_phrase_status(EOF_SONG *sp, unsigned long track);
 	//Re-applies the HOPO, SP, trill and tremolo status of each note in the specified track, as well as deleting empty SP, Solo, trill, tremolo and arpeggio phrases
+	//The notes are swept in order of position against the phrases sorted by start position, so this is fast enough to run during playback
+void eof_invalidate_phrase_status(EOF_SONG *sp, unsigned long track, unsigned long start, unsigned long end);
+	//Records that the notes and/or phrases of the specified track between the two timestamps (inclusive) were changed
+	//The ranges are merged until eof_update_phrase_status() processes them.  If a range of a different track is pending, it is processed first
+void eof_update_phrase_status(EOF_SONG *sp, unsigned long track);
+	//Performs the logic of eof_determine_phrase_status() for the time range recorded by eof_invalidate_phrase_status(), widened to the phrases overlapping it,
+	// and the first note of each difficulty after it (whose HOPO status depends on the note before it).  Does nothing if no range of this track is pending
 void eof_cat_track_difficulty_string(char *str);	//Concatenates the current track name and difficulty name/number to the specified string
 void eof_fix_window_title(void);
 int eof_load_ogg_quick(char * filename);
@@ -726,6 +730,20 @@ int eof_load_complete_song(char * filename);
 int eof_destroy_ogg(void);	//Frees chart audio
 int eof_save_ogg(char * fn);	//Writes the memory buffered chart audio OGG (eof_music_data) to the specified file
 void eof_render(void);
+	//Marks every window as dirty and renders the entire program window
+void eof_render_damaged(void);
+	//Renders the program window, only re-rendering the windows whose dirty flag is set
+	//The primary piano roll is redrawn on its own, the info panel, 3D preview, secondary piano roll and notes panel which share the bottom half of the program window are redrawn together
+	//Layouts that draw across both halves (full screen/full height 3D preview, x2 zoom, software cursor) always redraw everything
+	//The dirty flags are cleared after the windows are rendered
+void eof_set_render_dirty(void);
+	//Marks every window and the background as needing to be redrawn by the next call to eof_render_damaged()
+	//This should be called after anything draws over the program window or changes state that eof_update_render_damage() doesn't track
+int eof_update_render_damage(void);
+	//Compares the state that the rendered windows depend on (seek position, playback, edits, selection, hover notes, keyboard and mouse input) against that of the last check,
+	// setting the dirty flag of each window whose contents would change
+	//Every EOF_RENDER_HEARTBEAT consecutive checks that find nothing changed, every window is marked dirty anyway in case of a change that isn't tracked
+	//Returns nonzero if any window is dirty and eof_render_damaged() needs to be called
 void eof_render_lyric_window(void);
 void eof_render_3d_window(void);
 	//Renders the 3D preview
@@ -777,9 +795,23 @@ void eof_set_2D_lane_positions(unsigned long track);
 void eof_start_logging(void);	//Opens the log file for writing if it isn't already open
 void eof_stop_logging(void);	//Closes the log file if it is open
 void eof_log(const char *text, int level);
-	//If the log is open, writes the string to the log file, followed by a newline character, and flushes the I/O stream
+	//If the log is open, queues the string to be written to the log file, followed by a newline character, by the log writer thread
 	//Level indicates the minimum level of logging that must be in effect to log the message (ie. 1 = on, 2 = verbose)
 	//Verbose logging should be disabled during chart creation/deletion due to the large amount of note creations/deletions
+	//This is safe to call from worker threads
+#ifdef __GNUC__
+void eof_logf(int level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+#else
+void eof_logf(int level, const char *format, ...);
+#endif
+	//Formats and logs the text like snprintf() followed by eof_log(), but checks the logging level first so nothing is formatted
+	//if the message won't be logged.  Use this instead of building the message in eof_log_string for verbose/exhaustive logging
+	//It formats into its own buffer, so unlike eof_log_string it is safe to use from worker threads
+void eof_log_start_writer(void);
+	//Starts the thread that writes queued log text to the log file, and installs signal handlers that write the queue if EOF crashes
+	//Called by eof_start_logging().  If the thread can't be started, log text is written directly
+void eof_log_stop_writer(void);
+	//Writes everything that is queued, ends the log writer thread and restores the previous signal handlers
 void eof_log_casual(const char *text, int level, int prefix, int newline);
 	//Similar to eof_log(), except that it has an internal memory buffer four times the size of EOF_LOG_STRING_SIZE
 	//only flushes to disk when the buffer has insufficient space for another EOF_LOG_STRING_SIZE number of bytes
@@ -790,8 +822,9 @@ void eof_log_notes(EOF_SONG *sp, unsigned long track);
 	//Debug function that logs the position and length of each note in the specified track
 extern char eof_log_string[2048];	//A string reserved for use with eof_log()
 extern unsigned int eof_log_id;
-	//This will be set to a random value when logging is started, so if multiple instances of EOF are writing to the same
-	//log file (Windows does not prevent this), each instance's log entries can be identified separately from each other.
+	//This is set to the process ID during program initialization, whether or not logging is enabled.  If multiple instances of EOF are writing
+	//to the same log file (Windows does not prevent this), each instance's log entries can be identified separately from each other, and
+	//concurrently running instances (such as batch conversion child processes) use it to keep their undo and temporary file names unique
 void eof_log_cwd(void);		//Logs the current working directory
 
 void eof_init_colors(void);		//Initializes the color structures, to be called after eof_load_data()
@@ -866,4 +899,10 @@ int eof_increase_display_width_to_panel_count(int prompt);
 	//If the user declines that prompt, or if the window resize fails, the non-default panels are disabled
 	//Returns zero on error
 
+int eof_alert(const char *s1, const char *s2, const char *s3, const char *b1, const char *b2, int c1, int c2);
+int eof_alert3(const char *s1, const char *s2, const char *s3, const char *b1, const char *b2, const char *b3, int c1, int c2, int c3);
+void eof_message(const char *format, ...);
+	//Wrappers for Allegro's alert(), alert3() and allegro_message() (defined in batch.c), which EOF calls instead of the Allegro functions
+	//In batch mode there is no display or keyboard, so prompts are logged and answered with their first button, and messages are logged and printed to stderr
+
 #endif
@@ -640,7 +640,7 @@ int eof_menu_beat_bpm_change(void)
 		if((bpm < 0.1) || (bpm > 2000.0))
 		{
 			eof_render();
-			allegro_message("BPM must be between 0.1 and 2000.");
+			eof_message("BPM must be between 0.1 and 2000.");
 			eof_cursor_visible = 1;
 			eof_pen_visible = 1;
 			eof_show_mouse(NULL);
@@ -779,14 +779,14 @@ int eof_menu_beat_ts_custom_dialog(unsigned start)
 		if((num > 256) || (num < 1) || (den > 256) || (den < 1))
 		{	//These values must fit within an 8 bit number (where all bits zero represents 1 and all bits set represents 256)
 			eof_render();
-			allegro_message("Time signature numerator and denominator must be between 1 and 256");
+			eof_message("Time signature numerator and denominator must be between 1 and 256");
 		}
 		else
 		{
 			if((den != 1) && (den != 2) && (den != 4) && (den != 8) && (den != 16) && (den != 32) && (den != 64) && (den != 128) && (den != 256))
 			{
 				eof_render();
-				allegro_message("Time signature denominator must be a power of two");
+				eof_message("Time signature denominator must be a power of two");
 			}
 			else
 			{	//User provided a valid time signature
@@ -1012,7 +1012,7 @@ int eof_menu_beat_reset_offset(void)
 	if(eof_song->tags->tempo_map_locked)	//If the chart's tempo map is locked
 	{
 		eof_clear_input();
-		if(alert("Cannot perform this operation while the tempo map is locked.", NULL, "Would you like to unlock the tempo map?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("Cannot perform this operation while the tempo map is locked.", NULL, "Would you like to unlock the tempo map?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If user does not opt to unlock the tempo map to carry out the operation
 			return 1;	//Return without making changes
 		}
@@ -1025,7 +1025,7 @@ int eof_menu_beat_reset_offset(void)
 	if(eof_song->beat[0]->pos >= eof_song->beat[1]->pos - eof_song->beat[0]->pos)
 	{	//If the MIDI delay is at least one beat length long, offer to insert as many evenly spaced beats as possible
 		eof_clear_input();
-		if(alert(NULL, "Insert evenly spaced beats at the beginning of the chart?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Insert evenly spaced beats at the beginning of the chart?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If user opts to insert evenly spaced beats
 			while(eof_song->beat[0]->pos >= eof_song->beat[1]->pos - eof_song->beat[0]->pos)
 			{	//While the MIDI delay is still large enough to be moved back one beat
@@ -1354,7 +1354,7 @@ int eof_menu_beat_reset_bpm(void)
 		if(eof_get_track_size_all(eof_song, i))
 		{	//If the track is populated with normal notes or tech notes
 			eof_clear_input();
-			if(alert(NULL, "Adjust notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Adjust notes?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to adjust the notes
 				adjust = 1;
 			}
@@ -1364,7 +1364,7 @@ int eof_menu_beat_reset_bpm(void)
 
 	if(eof_selected_beat != 0)
 	{	//If a beat besides the first is selected
-		if(alert(NULL, "Erase all BPM changes after the first beat or the selected beat?", NULL, "First", "Selected", 0, 0) == 2)
+		if(eof_alert(NULL, "Erase all BPM changes after the first beat or the selected beat?", NULL, "First", "Selected", 0, 0) == 2)
 		{	//If the user opted to only erase BPM changes after the selected beat
 			startbeat = eof_selected_beat;
 		}
@@ -1380,7 +1380,7 @@ int eof_menu_beat_reset_bpm(void)
 	}
 	if(reset)
 	{
-		if(alert(NULL, "Erase specified BPM changes?", NULL, "OK", "Cancel", 0, 0) == 1)
+		if(eof_alert(NULL, "Erase specified BPM changes?", NULL, "OK", "Cancel", 0, 0) == 1)
 		{
 			eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 			if(adjust)
@@ -1403,7 +1403,7 @@ int eof_menu_beat_reset_bpm(void)
 	}
 	else
 	{
-		allegro_message("No BPM changes to erase!");
+		eof_message("No BPM changes to erase!");
 	}
 	eof_clear_input();
 	return 1;
@@ -1425,7 +1425,7 @@ int eof_menu_beat_remove_ts(void)
 	}
 	if(reset)
 	{	//If there was at least one time signature change
-		if(alert(NULL, "Erase all time signature changes?", NULL, "OK", "Cancel", 0, 0) == 1)
+		if(eof_alert(NULL, "Erase all time signature changes?", NULL, "OK", "Cancel", 0, 0) == 1)
 		{	//If the user opted to erase the changes
 			eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 			for(i = 0; i < eof_song->beats; i++)
@@ -1448,7 +1448,7 @@ int eof_menu_beat_remove_ts(void)
 	}
 	else
 	{
-		allegro_message("No time signature changes to erase!");
+		eof_message("No time signature changes to erase!");
 	}
 	eof_clear_input();
 	return 1;
@@ -1657,11 +1657,11 @@ int eof_menu_beat_clear_events(void)
 	unsigned long i;
 	if(eof_song->text_events == 0)
 	{
-		allegro_message("No events to clear!");
+		eof_message("No events to clear!");
 		return 1;
 	}
 	eof_clear_input();
-	if(alert(NULL, "Erase all events?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Erase all events?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		(void) eof_song_resize_text_events(eof_song, 0);
@@ -1682,11 +1682,11 @@ int eof_menu_beat_clear_non_rs_events(void)
 
 	if(eof_song->text_events == 0)
 	{
-		allegro_message("No events to clear!");
+		eof_message("No events to clear!");
 		return 1;
 	}
 	eof_clear_input();
-	if(alert(NULL, "Erase all non Rocksmith events?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Erase all non Rocksmith events?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		for(i = eof_song->text_events; i > 0; i--)
 		{	//For each text event, in reverse
@@ -1991,7 +1991,7 @@ int eof_menu_beat_add_section(void)
 
 	if(strchr(eof_etext, '[') || strchr(eof_etext, ']'))
 	{
-		allegro_message("Section names cannot include opening or closing brackets [ ]");
+		eof_message("Section names cannot include opening or closing brackets [ ]");
 		return D_O_K;
 	}
 	(void) snprintf(text, sizeof(text) - 1, "[section %s]", eof_etext);	//Format the section string
@@ -2197,7 +2197,7 @@ void eof_add_or_edit_text_event(EOF_TEXT_EVENT *ptr, unsigned long flags, char *
 		{	//User opted to make this a Rocksmith event marker
 			if(!eof_rs_event_text_valid(eof_etext))
 			{	//If this isn't a valid Rocksmith event name
-				allegro_message("Warning:  This is not a valid Rocksmith event.  Please edit it appropriately or remove it and re-add it using Beat>Place Rocksmith Event");
+				eof_message("Warning:  This is not a valid Rocksmith event.  Please edit it appropriately or remove it and re-add it using Beat>Place Rocksmith Event");
 			}
 			newflags |= EOF_EVENT_FLAG_RS_EVENT;
 		}
@@ -2211,14 +2211,14 @@ void eof_add_or_edit_text_event(EOF_TEXT_EVENT *ptr, unsigned long flags, char *
 			}
 			else if(!rssectionname || ustrcmp(rssectionname, eof_etext))
 			{	//Otherwise if this isn't a valid Rocksmith native section name (case sensitive), the user will have to resolve the conflict manually
-				allegro_message("Warning:  This is not a valid Rocksmith section.\nPlease edit it appropriately or remove it and re-add it using Beat>Rocksmith>Place Rocksmith Section");
+				eof_message("Warning:  This is not a valid Rocksmith section.\nPlease edit it appropriately or remove it and re-add it using Beat>Rocksmith>Place Rocksmith Section");
 			}
 		}
 		if(eof_events_add_dialog[3].flags & D_SELECTED)
 		{	//User opted to make this a track specific event
 			if((eof_song->track[eof_selected_track]->track_format != EOF_PRO_GUITAR_TRACK_FORMAT) && (newflags & EOF_EVENT_FLAG_RS_PHRASE))
 			{	//If the user is tried to add a track specific RS phrase marker in a non pro guitar/bass track
-				allegro_message("You cannot add a track-specific Rocksmith phrase marker in a non pro guitar/bass track");
+				eof_message("You cannot add a track-specific Rocksmith phrase marker in a non pro guitar/bass track");
 				return;
 			}
 			newtrack = eof_selected_track;
@@ -2251,7 +2251,7 @@ void eof_add_or_edit_text_event(EOF_TEXT_EVENT *ptr, unsigned long flags, char *
 
 			if(eof_events_set_rs_solo_phrase_status(eof_etext, newtrack, status, undo_made))
 			{	//If any such events were edited to match
-				allegro_message("All instances of a Rocksmith phrase use the same solo status.  One or more matching phrases in this event's scope had solo status %s to match.", (status ? "added" : "removed"));
+				eof_message("All instances of a Rocksmith phrase use the same solo status.  One or more matching phrases in this event's scope had solo status %s to match.", (status ? "added" : "removed"));
 			}
 		}
 	}//User clicked OK
@@ -2542,7 +2542,7 @@ int eof_menu_beat_trainer_event(void)
 	if(eof_song_contains_event(eof_song, selected_string, relevant_track, 0xFFFF, 1))
 	{	//If this training event is already defined in the active track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  This text event already exists in this track.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  This text event already exists in this track.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to place the duplicate text event
 			return 0;
 		}
@@ -2788,7 +2788,7 @@ int eof_menu_beat_set_RBN_tempos(void)
 	}
 	if(undo_made)
 	{	//If any changes were made
-		allegro_message("Tempos adjusted");
+		eof_message("Tempos adjusted");
 	}
 	for(i = 0; i < eof_song->beats; i++)
 	{	//For each beat
@@ -2796,13 +2796,13 @@ int eof_menu_beat_set_RBN_tempos(void)
 		{	//If this beat's tempo is > 300BPM or < 40BPM
 			eof_selected_beat = i;
 			eof_seek_and_render_position(eof_selected_track, eof_note_type, eof_song->beat[i]->pos);
-			allegro_message("Warning:  This beat has a tempo that must be manually corrected.");
+			eof_message("Warning:  This beat has a tempo that must be manually corrected.");
 			return 1;
 		}
 	}
 	if(!undo_made)
 	{	//If no changes were made
-		allegro_message("No tempo adjustments necessary");
+		eof_message("No tempo adjustments necessary");
 	}
 	return 1;
 }
@@ -3161,7 +3161,7 @@ int eof_menu_beat_copy_rs_events(void)
 	}
 	if(!num)
 	{
-		allegro_message("This beat has no applicable Rocksmith phrases or sections");
+		eof_message("This beat has no applicable Rocksmith phrases or sections");
 		return 1;
 	}
 
@@ -3176,7 +3176,7 @@ int eof_menu_beat_copy_rs_events(void)
 	fp = pack_fopen(eof_events_clipboard_path, "w");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return 1;
 	}
 	(void) pack_iputl(num, fp);	//Write the number of events this clipboard file will contain
@@ -3239,7 +3239,7 @@ int eof_menu_beat_copy_events(void)
 		fp = pack_fopen(eof_events_clipboard_path, "w");
 		if(!fp)
 		{
-			allegro_message("Clipboard error!");
+			eof_message("Clipboard error!");
 			return 1;
 		}
 		(void) pack_iputl(count, fp);	//Write the number of events this clipboard file will contain
@@ -3265,7 +3265,7 @@ int eof_menu_beat_paste_events(void)
 	fp = pack_fopen(eof_events_clipboard_path, "r");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!\nNothing to paste!");
+		eof_message("Clipboard error!\nNothing to paste!");
 		return 1;
 	}
 
@@ -3285,7 +3285,7 @@ int eof_menu_beat_paste_events(void)
 				{	//If the event is Rocksmith-specific
 					if((eof_song->track[eof_selected_track]->track_format != EOF_PRO_GUITAR_TRACK_FORMAT) && !rs_warn)
 					{	//If the destination track is not a pro guitar track, and the user hasn't been warned of this yet
-						allegro_message("Warning:  You cannot paste a track-specific Rocksmith event into a non pro guitar/bass track.");
+						eof_message("Warning:  You cannot paste a track-specific Rocksmith event into a non pro guitar/bass track.");
 						rs_warn = 1;
 						continue;	//Skip pasting this event
 					}
@@ -3411,7 +3411,7 @@ int eof_menu_beat_estimate_bpm(void)
 	if((eof_song->tags->start_point != ULONG_MAX) && (eof_song->tags->end_point != ULONG_MAX) && (eof_song->tags->start_point != eof_song->tags->end_point))
 	{	//If start/end markers are defined
 		eof_clear_input();
-		if(alert(NULL, "Estimate tempo of the entire song or just the portion between the start and end markers?", NULL, "&All", "&Portion", 'a', 'p') == 2)
+		if(eof_alert(NULL, "Estimate tempo of the entire song or just the portion between the start and end markers?", NULL, "&All", "&Portion", 'a', 'p') == 2)
 		{	//If the user opts to estimate just between the start and end markers
 			portion = 1;
 		}
@@ -3426,12 +3426,12 @@ int eof_menu_beat_estimate_bpm(void)
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Estimating tempo from %f seconds to %f seconds", start, end);
 		eof_log(eof_log_string, 1);
 
-		result = eof_estimate_bpm(eof_music_track, start, end);
+		result = eof_estimate_bpm(eof_loaded_ogg_name, start, end);
 		eof_fix_window_title();
 
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tMiniBPM processed %lu samples and determined a tempo of %fBPM", eof_bpm_estimator_sample_count, result);
 		eof_log(eof_log_string, 1);
-		allegro_message("Estimated tempo of the selection is %fBPM", result);
+		eof_message("Estimated tempo of the selection is %fBPM", result);
 
 		startbeat = eof_get_beat(eof_song, eof_song->tags->start_point);
 		if(eof_beat_num_valid(eof_song, startbeat))
@@ -3442,7 +3442,7 @@ int eof_menu_beat_estimate_bpm(void)
 			if(eof_song->beat[startbeat]->pos == eof_song->tags->start_point)
 			{	//If the selection starts on that beat marker exactly
 				eof_clear_input();
-				if(eof_song->tags->tempo_map_locked || (alert(NULL, "Would you like to apply this tempo to the beat at which the selection starts?", NULL, "&Yes", "&No", 'y', 'n') != 1))
+				if(eof_song->tags->tempo_map_locked || (eof_alert(NULL, "Would you like to apply this tempo to the beat at which the selection starts?", NULL, "&Yes", "&No", 'y', 'n') != 1))
 					return D_O_K;	//If the tempo map is locked or the user does not opt to apply the estimated tempo, return immediately
 			}
 			else
@@ -3457,15 +3457,15 @@ int eof_menu_beat_estimate_bpm(void)
 	{
 		eof_log("Estimating tempo of entire song", 1);
 
-		result = eof_estimate_bpm(eof_music_track, 0, 0);
+		result = eof_estimate_bpm(eof_loaded_ogg_name, 0, 0);
 		eof_fix_window_title();
 
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tMiniBPM processed %lu samples and determined a tempo of %fBPM", eof_bpm_estimator_sample_count, result);
 		eof_log(eof_log_string, 1);
-		allegro_message("Estimated tempo of the song is %fBPM", result);
+		eof_message("Estimated tempo of the song is %fBPM", result);
 
 		eof_clear_input();
-		if(eof_song->tags->tempo_map_locked || (alert(NULL, "Would you like to apply this tempo to the first beat?", NULL, "&Yes", "&No", 'y', 'n') != 1))
+		if(eof_song->tags->tempo_map_locked || (eof_alert(NULL, "Would you like to apply this tempo to the first beat?", NULL, "&Yes", "&No", 'y', 'n') != 1))
 			return D_O_K;	//If the tempo map is locked or the user does not opt to apply the estimated tempo, return immediately
 
 		startbeat = 0;		//The tempo will apply starting with the first beat marker
@@ -3505,7 +3505,7 @@ int eof_menu_beat_copy_tempo_map(void)
 	//Validate start and end points
 	if((eof_song->tags->start_point == ULONG_MAX) || (eof_song->tags->end_point == ULONG_MAX))
 	{	//If either the start point or the end point aren't defined
-		allegro_message("No selection defined.\n%s", instructions);
+		eof_message("No selection defined.\n%s", instructions);
 		return D_O_K;
 	}
 
@@ -3513,13 +3513,13 @@ int eof_menu_beat_copy_tempo_map(void)
 	end_beat = eof_get_beat(eof_song, eof_song->tags->end_point);
 	if((start_beat >= eof_song->beats) || (end_beat >= eof_song->beats))
 	{
-		allegro_message("Invalid selection.\n%s", instructions);
+		eof_message("Invalid selection.\n%s", instructions);
 		return D_O_K;
 	}
 
 	if((start_beat == end_beat) && (eof_song->tags->start_point != eof_song->beat[start_beat]->pos))
 	{	//If there is a selection, but it doesn't overlap any beat markers
-		allegro_message("No beat markers are selected.\n%s", instructions);
+		eof_message("No beat markers are selected.\n%s", instructions);
 		return D_O_K;
 	}
 
@@ -3534,7 +3534,7 @@ int eof_menu_beat_copy_tempo_map(void)
 	fp = pack_fopen(clipboard_path, "w");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return D_O_K;
 	}
 
@@ -3578,7 +3578,7 @@ int eof_menu_beat_paste_tempo_map(void)
 	fp = pack_fopen(clipboard_path, "r");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return D_O_K;
 	}
 
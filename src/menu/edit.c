@@ -770,7 +770,7 @@ int eof_menu_edit_copy_vocal(void)
 	fp = pack_fopen(clipboard_path, "w");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return 1;
 	}
 	(void) pack_iputl(eof_log_id, fp);		//Store the source EOF instance number
@@ -792,7 +792,7 @@ int eof_menu_edit_copy_vocal(void)
 				if(eof_beat_num_valid(eof_song, beatnum + 1) && (beatnum < eof_song->beats - 1) && (eof_song->beat[beatnum + 1]->pos - eof_get_note_pos(eof_song, eof_selected_track, i) <= 10))
 				{	//If there is a next beat and the first selected lyric is within 10 ms of it
 					eof_clear_input();
-					if(alert(NULL, "First lyric appears to be off.", "Adjust?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "First lyric appears to be off.", "Adjust?", "&Yes", "&No", 'y', 'n') == 1)
 					{
 						eof_set_note_pos(eof_song, eof_selected_track, i, eof_song->beat[beatnum + 1]->pos);	//Move the first selected lyric to the next beat
 					}
@@ -810,7 +810,7 @@ int eof_menu_edit_copy_vocal(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -819,7 +819,7 @@ int eof_menu_edit_paste_vocal_logic(int function)
 {
 	unsigned long i, j;
 	unsigned long tracknum = eof_song->track[eof_selected_track]->tracknum;
-	unsigned long paste_pos[EOF_MAX_NOTES] = {0};
+	unsigned long *paste_pos = NULL;	//The positions of the pasted lyrics, sized to the clipboard's lyric count
 	unsigned long paste_count = 0;
 	unsigned long first_beat = 0;
 	unsigned long this_beat;
@@ -866,15 +866,28 @@ int eof_menu_edit_paste_vocal_logic(int function)
 	fp = pack_fopen(clipboard_path, "r");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!\nNothing to paste!");
+		eof_message("Clipboard error!\nNothing to paste!");
 		return 1;
 	}
 	eof_prepare_undo(EOF_UNDO_TYPE_NOTE_SEL);
 	source_id = pack_igetl(fp);			//Read the source EOF instance number
 	copy_notes = pack_igetl(fp);
 	first_beat = pack_igetl(fp);
-	memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
-	eof_selection.current = EOF_MAX_NOTES - 1;
+	if(copy_notes)
+	{	//If there are lyrics on the clipboard
+		if(copy_notes <= (size_t)-1 / sizeof(unsigned long))
+		{	//If the array size can be addressed
+			paste_pos = malloc(sizeof(unsigned long) * copy_notes);
+		}
+		if(!paste_pos)
+		{
+			eof_log("\tError allocating memory to paste lyrics", 1);
+			(void) pack_fclose(fp);
+			return 1;
+		}
+	}
+	memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
+	eof_selection.current = EOF_NO_NOTE_SELECTED;
 	eof_selection.current_pos = 0;
 
 	if(!oldpaste)
@@ -979,7 +992,7 @@ int eof_menu_edit_paste_vocal_logic(int function)
 	if((paste_count > 0) && (eof_selection.track != EOF_TRACK_VOCALS))
 	{
 		eof_selection.track = EOF_TRACK_VOCALS;
-		memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+		memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 	}
 	for(i = 0; i < paste_count; i++)
 	{
@@ -992,6 +1005,7 @@ int eof_menu_edit_paste_vocal_logic(int function)
 			}
 		}
 	}
+	free(paste_pos);
 	return 1;
 }
 
@@ -1044,7 +1058,7 @@ int eof_menu_edit_cut(unsigned long anchor, int option)
 	fp = pack_fopen(eof_autoadjust_path, "w");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return 1;
 	}
 
@@ -1258,7 +1272,7 @@ int eof_menu_edit_cut_paste(unsigned long anchor, int option)
 	fp = pack_fopen(eof_autoadjust_path, "r");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return 1;
 	}
 
@@ -1268,7 +1282,7 @@ int eof_menu_edit_cut_paste(unsigned long anchor, int option)
 	unshare_drum_phrasing = eof_song->tags->unshare_drum_phrasing;	//Store this value and temporarily force unsharing so any existing PS drum track phrases can be adjusted appropriately
 	eof_song->tags->unshare_drum_phrasing = 1;
 
-	memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+	memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 	for(j = 1; j < eof_song->tracks; j++)
 	{	//For each track
 		EOF_PRO_GUITAR_TRACK *tp = NULL;
@@ -1516,7 +1530,7 @@ int eof_menu_edit_copy(void)
 	fp = pack_fopen(clipboard_path, "w");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return 1;
 	}
 	(void) pack_iputl(eof_log_id, fp);			//Store the source EOF instance number
@@ -1540,7 +1554,7 @@ int eof_menu_edit_copy(void)
 				if(eof_beat_num_valid(eof_song, beatnum + 1) && (beatnum < eof_song->beats - 1) && (eof_song->beat[beatnum + 1]->pos - eof_get_note_pos(eof_song, eof_selected_track, i) <= 10))
 				{	//If there is a next beat and the first selected note is within 10 ms of it
 					eof_clear_input();
-					if(alert(NULL, "First note appears to be off.", "Adjust?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "First note appears to be off.", "Adjust?", "&Yes", "&No", 'y', 'n') == 1)
 					{
 						eof_set_note_pos(eof_song, eof_selected_track, i, eof_song->beat[beatnum + 1]->pos);	//Move the first selected note to the next beat
 					}
@@ -1558,7 +1572,7 @@ int eof_menu_edit_copy(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1566,7 +1580,7 @@ int eof_menu_edit_copy(void)
 int eof_menu_edit_paste_logic(int function)
 {
 	unsigned long i, j;
-	unsigned long paste_pos[EOF_MAX_NOTES] = {0};
+	unsigned long *paste_pos = NULL;	//The positions of the pasted notes, sized to the clipboard's note count
 	unsigned long paste_count = 0;
 	unsigned long first_beat = 0;
 	unsigned long this_beat;
@@ -1614,7 +1628,7 @@ int eof_menu_edit_paste_logic(int function)
 	fp = pack_fopen(clipboard_path, "r");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!\nNothing to paste!");
+		eof_message("Clipboard error!\nNothing to paste!");
 		return 1;
 	}
 	if(!oldpaste && (first_beat + this_beat >= eof_song->beats - 1))
@@ -1639,7 +1653,7 @@ int eof_menu_edit_paste_logic(int function)
 			char message[120] = {0};
 			(void) snprintf(message, sizeof(message) - 1, "Warning:  This track's fret limit is exceeded by a pasted note's fret value of %lu.  Continue?", highestfret);
 			eof_clear_input();
-			if(alert(NULL, message, NULL, "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert(NULL, message, NULL, "&Yes", "&No", 'y', 'n') != 1)
 			{	//If user does not opt to continue after being alerted of this fret limit issue
 				(void) pack_fclose(fp);
 				return 0;
@@ -1652,7 +1666,7 @@ int eof_menu_edit_paste_logic(int function)
 		char message[120] = {0};
 		(void) snprintf(message, sizeof(message) - 1, "Warning:  This track's highest lane number is exceeded by a pasted note with a gem on lane %lu.", highestlane);
 		eof_clear_input();
-		if(alert(NULL, message, "Gems will either be dropped, or added to form all-lane chords for such notes.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, message, "Gems will either be dropped, or added to form all-lane chords for such notes.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If user does not opt to continue after being alerted of this lane limit issue
 			(void) pack_fclose(fp);
 			return 0;
@@ -1665,8 +1679,8 @@ int eof_menu_edit_paste_logic(int function)
 		newpasteoffset = eof_get_porpos(targetpos);
 	}
 
-	memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
-	eof_selection.current = EOF_MAX_NOTES - 1;
+	memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
+	eof_selection.current = EOF_NO_NOTE_SELECTED;
 	eof_selection.current_pos = 0;
 
 	if(eof_paste_erase_overlap)
@@ -1699,7 +1713,7 @@ int eof_menu_edit_paste_logic(int function)
 		fp = pack_fopen(clipboard_path, "r");
 		if(!fp)
 		{
-			allegro_message("Error re-opening clipboard");
+			eof_message("Error re-opening clipboard");
 			return 1;
 		}
 		source_id = pack_igetl(fp);			//Read the source EOF instance number
@@ -1709,6 +1723,16 @@ int eof_menu_edit_paste_logic(int function)
 		first_beat = pack_igetl(fp);		//Read the original beat number of the first note that was copied
 	}
 
+	if(copy_notes <= (size_t)-1 / sizeof(unsigned long))
+	{	//If the array size can be addressed
+		paste_pos = malloc(sizeof(unsigned long) * copy_notes);
+	}
+	if(!paste_pos)
+	{
+		eof_log("\tError allocating memory to paste notes", 1);
+		(void) pack_fclose(fp);
+		return 1;
+	}
 	if(!oldpaste)
 	{	//If using new paste, find the seek position's percentage within the current beat
 		newpasteoffset = eof_get_porpos(targetpos);
@@ -1742,6 +1766,7 @@ int eof_menu_edit_paste_logic(int function)
 			if(!eof_song_append_beats(eof_song, 1))
 			{	//If there was an error adding a beat
 				eof_log("\tError adding beat.  Aborting", 1);
+				free(paste_pos);
 				return 1;
 			}
 			eof_beat_stats_cached = 0;	//Mark the cached beat stats as not current
@@ -1825,7 +1850,7 @@ int eof_menu_edit_paste_logic(int function)
 					{	//If this paste had a lossy conversion from GHL to non GHL format
 						if(!warning)
 						{	//If the user wasn't already warned about this during this paste operation
-							allegro_message("Chords containing lane 3 white GHL gems can't be authored in a non GHL track");
+							eof_message("Chords containing lane 3 white GHL gems can't be authored in a non GHL track");
 							warning = 1;
 						}
 					}
@@ -1907,7 +1932,7 @@ int eof_menu_edit_paste_logic(int function)
 	if((paste_count > 0) && (eof_selection.track != eof_selected_track))
 	{
 		eof_selection.track = eof_selected_track;
-		memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+		memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 	}
 	for(i = 0; i < paste_count; i++)
 	{
@@ -1920,6 +1945,7 @@ int eof_menu_edit_paste_logic(int function)
 			}
 		}
 	}
+	free(paste_pos);
 	return 1;
 }
 
@@ -2055,7 +2081,7 @@ int eof_menu_edit_snap_custom(void)
 		{
 			eof_snap_interval = last_interval;
 			eof_render();
-			allegro_message("Invalid snap setting, must be between 1 and %d", EOF_MAX_GRID_SNAP_INTERVALS - 1);
+			eof_message("Invalid snap setting, must be between 1 and %d", EOF_MAX_GRID_SNAP_INTERVALS - 1);
 		}
 		else
 		{
@@ -2689,7 +2715,7 @@ int eof_menu_edit_select_like_function(char thorough)
 			}
 		}
 	}
-	memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+	memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 	for(i = 0; i < eof_get_track_size(eof_song, eof_selected_track); i++)
 	{	//For each note in the active track
 		for(j = 0; j < ntypes; j++)
@@ -2707,7 +2733,7 @@ int eof_menu_edit_select_like_function(char thorough)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2725,7 +2751,7 @@ int eof_menu_edit_precise_select_like(void)
 int eof_menu_edit_deselect_all(void)
 {
 	eof_update_seek_selection(0, 0, 1);	//Clear the seek selection and the selected notes array, do not reselect a note at position 0
-	eof_selection.current = EOF_MAX_NOTES - 1;
+	eof_selection.current = EOF_NO_NOTE_SELECTED;
 	eof_selection.current_pos = 0;
 	eof_selection.range_pos_1 = 0;
 	eof_selection.range_pos_2 = 0;
@@ -2740,7 +2766,7 @@ int eof_menu_edit_select_rest(void)
 	{
 		return 1;
 	}
-	if(eof_selection.current == EOF_MAX_NOTES - 1)	//No notes selected?
+	if(eof_selection.current == EOF_NO_NOTE_SELECTED)	//No notes selected?
 		return 1;	//Don't perform this operation
 
 	for(i = eof_selection.current; i < eof_get_track_size(eof_song, eof_selected_track); i++)
@@ -2794,7 +2820,7 @@ int eof_menu_edit_select_by_note_length_logic(int (*check)(long, long), int func
 	threshold = atol(eof_etext2);
 	if(!threshold && (eof_snap_mode == EOF_SNAP_OFF))
 	{	//If the user specified a threshold of one grid snap, but no grid snap length is active
-		allegro_message("Grid snap must be enabled in order to select/deselect notes longer/shorter than one grid snap length.");
+		eof_message("Grid snap must be enabled in order to select/deselect notes longer/shorter than one grid snap length.");
 		return 1;
 	}
 	if(threshold < 0)
@@ -2831,11 +2857,11 @@ int eof_menu_edit_select_by_note_length_logic(int (*check)(long, long), int func
 			eof_selection.multi[i] = 1;
 		}
 	}
-	if(eof_selection.current != EOF_MAX_NOTES - 1)
+	if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -2926,7 +2952,7 @@ int eof_menu_edit_select_note_within_threshhold_of_next_note_logic(int function,
 		return 1;	//If the specified value is not valid, return immediately
 	if(!threshold && (eof_snap_mode == EOF_SNAP_OFF))
 	{	//If the user specified a threshold of one grid snap, but no grid snap length is active
-		allegro_message("Grid snap must be enabled in order to select/deselect notes less than one grid snap length away from their next neighbor.");
+		eof_message("Grid snap must be enabled in order to select/deselect notes less than one grid snap length away from their next neighbor.");
 		return 1;
 	}
 
@@ -2978,11 +3004,11 @@ int eof_menu_edit_select_note_within_threshhold_of_next_note_logic(int function,
 			eof_selection.multi[i] = 1;
 		}
 	}
-	if(eof_selection.current != EOF_MAX_NOTES - 1)
+	if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -3256,11 +3282,11 @@ int eof_menu_edit_conditional_selection_logic(int function)
 			}
 		}
 	}//For each note in the track
-	if(eof_selection.current != EOF_MAX_NOTES - 1)
+	if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -3372,11 +3398,11 @@ int eof_menu_edit_deselect_logic(int (*check)(EOF_SONG *, unsigned long, unsigne
 			}
 		}
 	}
-	if(eof_selection.current != EOF_MAX_NOTES - 1)
+	if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -3529,11 +3555,11 @@ int eof_menu_edit_select_gem_count_logic(int function)
 	}
 
 	//Clean up
-	if(!function && (eof_selection.current != EOF_MAX_NOTES - 1))
+	if(!function && (eof_selection.current != EOF_NO_NOTE_SELECTED))
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -3629,7 +3655,7 @@ int eof_menu_edit_paste_from_difficulty(unsigned long source_difficulty, char *u
 	if(eof_track_diff_populated_status[eof_note_type])
 	{	//If the current difficulty is populated
 		eof_clear_input();
-		if(alert(NULL, "This operation will replace this difficulty's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "This operation will replace this difficulty's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If user does not opt to overwrite this difficulty
 			return 1;
 		}
@@ -3781,7 +3807,7 @@ static unsigned long lyrics_in_beat(unsigned long beat)
 int eof_menu_edit_paste_from_catalog(void)
 {
 	unsigned long i, j, bitmask;
-	unsigned long paste_pos[EOF_MAX_NOTES] = {0};
+	unsigned long *paste_pos;	//The positions of the pasted notes, sized to the catalog entry's note count
 	unsigned long paste_count = 0;
 	unsigned long note_count = 0;
 	unsigned long first = ULONG_MAX;
@@ -3855,7 +3881,7 @@ int eof_menu_edit_paste_from_catalog(void)
 			char message[120] = {0};
 			(void) snprintf(message, sizeof(message) - 1, "Warning:  This track's fret limit is exceeded by a pasted note's fret value of %lu.  Continue?", highestfret);
 			eof_clear_input();
-			if(alert(NULL, message, NULL, "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert(NULL, message, NULL, "&Yes", "&No", 'y', 'n') != 1)
 			{	//If user does not opt to continue after being alerted of this fret limit issue
 				return 0;
 			}
@@ -3866,12 +3892,18 @@ int eof_menu_edit_paste_from_catalog(void)
 		char message[120] = {0};
 		(void) snprintf(message, sizeof(message) - 1, "Warning:  This track's highest lane number is exceeded by a pasted note with a gem on lane %lu.", highestlane);
 		eof_clear_input();
-		if(alert(NULL, message, "Such notes will be omitted.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, message, "Such notes will be omitted.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If user does not opt to continue after being alerted of this lane limit issue
 			return 0;
 		}
 	}
 
+	paste_pos = malloc(sizeof(unsigned long) * note_count);
+	if(!paste_pos)
+	{
+		eof_log("\tError allocating memory to paste catalog entry", 1);
+		return 1;
+	}
 	newpasteoffset = eof_get_porpos(eof_music_pos - eof_av_delay);	//Find the seek position's percentage within the current beat
 	eof_prepare_undo(EOF_UNDO_TYPE_NOTE_SEL);
 	if(eof_paste_erase_overlap)
@@ -3979,7 +4011,7 @@ int eof_menu_edit_paste_from_catalog(void)
 			startpos = eof_put_porpos(current_beat, nporpos, newpasteoffset);
 			endpos = eof_put_porpos(end_beat - first_beat + start_beat, nporendpos, newpasteoffset);
 			new_note = eof_copy_note_simple(eof_song, sourcetrack, i, eof_selected_track, startpos, endpos - startpos, eof_note_type);
-			if(new_note)
+			if(new_note && (paste_count < note_count))
 			{	//If the note was successfully created
 				newnotenum = eof_get_track_size(eof_song, eof_selected_track) - 1;	//The index of the new note
 				paste_pos[paste_count] = eof_get_note_pos(eof_song, eof_selected_track, newnotenum);
@@ -4006,6 +4038,7 @@ int eof_menu_edit_paste_from_catalog(void)
 			}
 		}
 	}
+	free(paste_pos);
 	return 1;
 }
 
@@ -4017,7 +4050,7 @@ int eof_menu_edit_select_previous(void)
 	{
 		return 1;
 	}
-	if(eof_selection.current == EOF_MAX_NOTES - 1)	//No notes selected?
+	if(eof_selection.current == EOF_NO_NOTE_SELECTED)	//No notes selected?
 		return 1;	//Don't perform this operation
 
 	for(i = 0; (i < eof_selection.current) && (i < eof_get_track_size(eof_song, eof_selected_track)); i++)
@@ -4455,7 +4488,7 @@ int eof_menu_song_paste_from_difficulty(void)
 	}
 	if(diffcount == 0)
 	{
-		allegro_message("No other difficulties in this track contain notes.");
+		eof_message("No other difficulties in this track contain notes.");
 		return 1;
 	}
 
@@ -4562,11 +4595,11 @@ int eof_menu_edit_select_note_number_in_sequence_logic(int function)
 		}
 	}//For each note in the active track
 
-	if(eof_selection.current != EOF_MAX_NOTES - 1)
+	if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -4651,11 +4684,11 @@ int eof_menu_edit_select_on_or_off_beat_note_logic(int function, int position)
 			}
 		}
 	}//For each note in the track
-	if(eof_selection.current != EOF_MAX_NOTES - 1)
+	if(eof_selection.current != EOF_NO_NOTE_SELECTED)
 	{	//If there was a last selected note
 		if(eof_selection.multi[eof_selection.current] == 0)
 		{	//And it's not selected anymore
-			eof_selection.current = EOF_MAX_NOTES - 1;	//Clear the selected note
+			eof_selection.current = EOF_NO_NOTE_SELECTED;	//Clear the selected note
 		}
 	}
 
@@ -4844,7 +4877,7 @@ int eof_menu_edit_benchmark_rubberband(void)
 		set_window_title("Benchmarking complete");
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBenchmarking complete in %.2f seconds:  ~%lu samples in %lu clocks (%f samples per clock)", (double)duration / CLOCKS_PER_SEC, eof_benchmark_rubberband_sample_count, (unsigned long) duration, (double)eof_benchmark_rubberband_sample_count / duration);
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 	}
 	else
 	{
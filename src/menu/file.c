@@ -25,9 +25,11 @@
 #include "../rs.h"
 #include "../rs_import.h"
 #include "../silence.h"	//For save_wav_with_silence_appended
+#include "../pcm.h"
 #include "../song.h"
 #include "../bf_import.h"
 #include "../bf.h"
+#include "../batch.h"
 #include "../main.h"	//For eof_import_to_track_dialog[] declaration
 #include "beat.h"	//For eof_menu_beat_reset_offset()
 #include "edit.h"	//For eof_menu_edit_undo()
@@ -489,7 +491,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 		if(err && !eof_folder_exists(syscommand))
 		{	//If it couldn't be created and is still not found to exist (in case the previous check was a false negative)
 			eof_render();
-			allegro_message("Could not create folder!\n%s\nEnsure that the specified folder name is valid and\nthe Song Folder is configured to a non write-restricted area.\n(File->Song Folder)", syscommand);
+			eof_message("Could not create folder!\n%s\nEnsure that the specified folder name is valid and\nthe Song Folder is configured to a non write-restricted area.\n(File->Song Folder)", syscommand);
 			return 0;
 		}
 	}
@@ -503,7 +505,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 		if(exists(eof_temp_filename))
 		{
 			eof_clear_input();
-			if(alert(NULL, "Existing guitar.ogg will be overwritten. Proceed?", NULL, "&Yes", "&No", 'y', 'n') == 2)
+			if(eof_alert(NULL, "Existing guitar.ogg will be overwritten. Proceed?", NULL, "&Yes", "&No", 'y', 'n') == 2)
 			{
 				return 0;
 			}
@@ -515,7 +517,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 		if(exists(eof_temp_filename))
 		{
 			eof_clear_input();
-			if(alert(NULL, "Existing original.mp3 will be overwritten. Proceed?", NULL, "&Yes", "&No", 'y', 'n') == 2)
+			if(eof_alert(NULL, "Existing original.mp3 will be overwritten. Proceed?", NULL, "&Yes", "&No", 'y', 'n') == 2)
 			{
 				return 0;
 			}
@@ -531,7 +533,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 		{
 			eof_clear_input();
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Existing OGG file will be overwritten.  Proceed?");
-			if(alert(NULL, eof_log_string, NULL, "&Yes", "&No", 'y', 'n') == 2)
+			if(eof_alert(NULL, eof_log_string, NULL, "&Yes", "&No", 'y', 'n') == 2)
 			{
 				return 0;
 			}
@@ -541,7 +543,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 		{
 			eof_clear_input();
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Existing WAV file will be overwritten.  Proceed?");
-			if(alert(NULL, eof_log_string, NULL, "&Yes", "&No", 'y', 'n') == 2)
+			if(eof_alert(NULL, eof_log_string, NULL, "&Yes", "&No", 'y', 'n') == 2)
 			{
 				return 0;
 			}
@@ -551,7 +553,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 		{
 			eof_clear_input();
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Existing EOF project \"%s\" will be overwritten.  Proceed?", filename);
-			if(alert(NULL, eof_log_string, NULL, "&Yes", "&No", 'y', 'n') == 2)
+			if(eof_alert(NULL, eof_log_string, NULL, "&Yes", "&No", 'y', 'n') == 2)
 			{
 				return 0;
 			}
@@ -598,7 +600,7 @@ int eof_menu_file_new_supplement(char *directory, char *filename, char check)
 	if(err)
 	{
 		eof_clear_input();
-		if(alert(NULL, "Some existing chart files will be overwritten. Proceed?", NULL, "&Yes", "&No", 'y', 'n') == 2)
+		if(eof_alert(NULL, "Some existing chart files will be overwritten. Proceed?", NULL, "&Yes", "&No", 'y', 'n') == 2)
 		{
 			return 0;
 		}
@@ -668,7 +670,7 @@ int eof_menu_file_load(void)
 		if(!eof_song)
 		{
 			eof_song_loaded = 0;
-			allegro_message("Error loading song!");
+			eof_message("Error loading song!");
 			eof_fix_window_title();
 			return 1;
 		}
@@ -777,7 +779,7 @@ int eof_menu_file_save_as(void)
 		{	//If save was not successful
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError code %d during \"Save as\"", retval);
 			eof_log(eof_log_string, 1);
-			allegro_message("Could not save project (error %d)", retval);
+			eof_message("Could not save project (error %d)", retval);
 		}
 		return retval;
 	}
@@ -812,7 +814,7 @@ int eof_menu_file_load_ogg(void)
 	(void) replace_filename(checkfn2, eof_song_path, "", 1024);
 	if(ustricmp(checkfn, checkfn2))
 	{
-		allegro_message("OGGs can only be loaded from the current song folder!\n");
+		eof_message("OGGs can only be loaded from the current song folder!\n");
 		return 1;
 	}
 
@@ -828,10 +830,10 @@ int eof_menu_file_load_ogg(void)
 			eof_cursor_visible = 1;
 			eof_pen_visible = 1;
 			(void) append_filename(eof_temp_filename, eof_song_path, "notes.lostoggbackup.eof", 1024);
-			allegro_message("%s", eof_temp_filename);
+			eof_message("%s", eof_temp_filename);
 			if(!eof_save_song(eof_song, eof_temp_filename))
 			{
-				allegro_message("Couldn't save backup!");
+				eof_message("Couldn't save backup!");
 			}
 			if(eof_song)
 			{
@@ -891,7 +893,7 @@ int eof_menu_file_save_logic(char silent)
 	{
 		eof_show_mouse(screen);
 		eof_clear_input();
-		if(alert(NULL, "No Changes, save anyway?", NULL, "&Yes", "&No", 'y', 'n') == 2)
+		if(eof_alert(NULL, "No Changes, save anyway?", NULL, "&Yes", "&No", 'y', 'n') == 2)
 		{
 			eof_show_mouse(NULL);
 			eof_cursor_visible = 1;
@@ -904,7 +906,7 @@ int eof_menu_file_save_logic(char silent)
 	if((eof_song_path[0] == '\0') || (eof_loaded_song_name[0] == '\0'))
 	{
 		eof_log("Song and project paths not initialized.  Save failed.", 1);
-		allegro_message("Save failed, please try \"Save as\".");
+		eof_message("Save failed, please try \"Save as\".");
 		return 2;	//Project path strings are invalid
 	}
 	(void) append_filename(eof_temp_filename, eof_song_path, eof_loaded_song_name, (int) sizeof(eof_temp_filename));	//Get full project path
@@ -921,7 +923,7 @@ int eof_menu_file_save_logic(char silent)
 		if(!eof_folder_exists(eof_temp_filename))
 		{
 			eof_clear_input();
-			if(alert("Song folder no longer exists.", "Recreate folder?", NULL, "&Yes", "&No", 'y', 'n') == 2)
+			if(eof_alert("Song folder no longer exists.", "Recreate folder?", NULL, "&Yes", "&No", 'y', 'n') == 2)
 			{
 				eof_show_mouse(NULL);
 				eof_cursor_visible = 1;
@@ -934,7 +936,7 @@ int eof_menu_file_save_logic(char silent)
 				eof_render();
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError creating project folder:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
 				eof_log(eof_log_string, 1);
-				allegro_message("Could not create folder!\n%s", eof_temp_filename);
+				eof_message("Could not create folder!\n%s", eof_temp_filename);
 				eof_show_mouse(NULL);
 				eof_cursor_visible = 1;
 				eof_pen_visible = 1;
@@ -961,7 +963,7 @@ int eof_menu_file_save_logic(char silent)
 	{	//If save was not successful
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError code %d during \"Save\"", retval);
 		eof_log(eof_log_string, 1);
-		allegro_message("Could not save project (error %d)", retval);
+		eof_message("Could not save project (error %d)", retval);
 	}
 	eof_show_mouse(NULL);
 	eof_cursor_visible = 1;
@@ -1032,7 +1034,7 @@ int eof_menu_file_lyrics_import(void)
 				(void) delete_file(templyricfile);	//Delete it
 			}
 			eof_log("\t\tError:  Could not import lyrics.  Undetermined error.", 1);
-			(void) alert("Error", NULL, "Could not import lyrics.  Undetermined error.", "OK", NULL, 0, KEY_ENTER);
+			(void) eof_alert("Error", NULL, "Could not import lyrics.  Undetermined error.", "OK", NULL, 0, KEY_ENTER);
 			return 1;
 		}
 
@@ -1046,7 +1048,7 @@ int eof_menu_file_lyrics_import(void)
 			{	//If a temporary file was created
 				(void) delete_file(templyricfile);	//Delete it
 			}
-			(void) alert("Error", NULL, "No lyrics detected", "OK", NULL, 0, KEY_ENTER);
+			(void) eof_alert("Error", NULL, "No lyrics detected", "OK", NULL, 0, KEY_ENTER);
 			return 0;	//return error
 		}
 
@@ -1070,7 +1072,7 @@ int eof_menu_file_lyrics_import(void)
 		if(returncode == 0)
 		{	//This was initialized to nonzero, so if it's zero now, the import above failed, undo the import by loading the last undo state
 			eof_log("\t\tError:  Invalid lyric file", 1);
-			(void) alert("Error", NULL, "Invalid lyric file", "OK", NULL, 0, KEY_ENTER);
+			(void) eof_alert("Error", NULL, "Invalid lyric file", "OK", NULL, 0, KEY_ENTER);
 			(void) eof_menu_edit_undo();
 		}
 		else
@@ -1172,7 +1174,7 @@ int eof_menu_file_midi_import(void)
 		else
 		{
 			eof_song_loaded = 0;
-			allegro_message("Could not import MIDI!");
+			eof_message("Could not import MIDI!");
 			eof_fix_window_title();
 			eof_changes = 0;
 			eof_undo_last_type = 0;
@@ -1218,13 +1220,13 @@ int eof_menu_file_settings(void)
 		eof_buffer_size = atol(eof_etext2);
 		if(eof_buffer_size < 1024)
 		{
-			allegro_message("Buffer size must be at least 1024. It has been set to 1024.");
+			eof_message("Buffer size must be at least 1024. It has been set to 1024.");
 			eof_buffer_size = 1024;
 		}
 		eof_midi_tone_delay = atol(eof_etext3);
 		if(eof_midi_tone_delay < 0)
 		{
-			allegro_message("MIDI Delay must be at least 0.\nIt has been set to 0 for now.");
+			eof_message("MIDI Delay must be at least 0.\nIt has been set to 0 for now.");
 			eof_midi_tone_delay = 0;
 		}
 		eof_cpu_saver = eof_settings_dialog[8].d2;
@@ -1455,7 +1457,7 @@ int eof_menu_file_preferences(void)
 			{	//If the minimum note distance or chord density threshold values were changes, and the minimum note distance setting is in ms
 				if(eof_chord_density_threshold < eof_min_note_distance)
 				{	//If EOF is configured to truncate note tails to enforce a distance longer than the chord density threshold
-					allegro_message("Warning:  Configuring the minimum note distance to be longer than the chord density\nthreshold will eliminate chord repeat lines for all chords that aren't close enough to\neach others' start positions.");
+					eof_message("Warning:  Configuring the minimum note distance to be longer than the chord density\nthreshold will eliminate chord repeat lines for all chords that aren't close enough to\neach others' start positions.");
 				}
 			}
 			eof_enforce_chord_density = (eof_preferences_dialog[44].flags == D_SELECTED ? 1 : 0);
@@ -1751,7 +1753,7 @@ int eof_menu_file_display(void)
 				{	//If a sufficiently high width and height were specified
 					if((width >= maxwidth) || (height >= maxheight))
 					{	//User specified a resolution that won't fit on screen
-						allegro_message("Must specify a width and height smaller than the screen resolution (%d x %d)", maxwidth, maxheight);
+						eof_message("Must specify a width and height smaller than the screen resolution (%d x %d)", maxwidth, maxheight);
 						cancelled = 1;
 					}
 					else if(width % 4 != 0)
@@ -1764,7 +1766,7 @@ int eof_menu_file_display(void)
 						suggestion2 = suggestion1 + 4;		//The next multiple of 4 after that
 						(void) snprintf(string1, sizeof(string1) - 1, "%lu", suggestion1);
 						(void) snprintf(string2, sizeof(string1) - 1, "%lu", suggestion2);
-						ret = alert3(NULL, "The window width must be a multiple of 4.", "Try one of these suggested widths.", string1, string2, "Cancel", 0, 0, 0);
+						ret = eof_alert3(NULL, "The window width must be a multiple of 4.", "Try one of these suggested widths.", string1, string2, "Cancel", 0, 0, 0);
 						if(ret == 1)
 							width = suggestion1;
 						else if(ret == 2)
@@ -1816,7 +1818,7 @@ void eof_apply_display_settings(int mode)
 	}
 	if(!eof_set_display_mode_preset(mode))
 	{
-		allegro_message("Unable to set display mode, reverting!");
+		eof_message("Unable to set display mode, reverting!");
 		(void) eof_set_display_mode_preset(eof_screen_layout.mode);
 	}
 	set_palette(eof_palette);
@@ -1833,7 +1835,7 @@ void eof_apply_display_settings(int mode)
 	}
 	if(!eof_load_data())
 	{	//Load images AFTER the graphics mode has been set, to avoid performance issues in Allegro
-		allegro_message("Could not reload program data!");
+		eof_message("Could not reload program data!");
 		exit(0);
 	}
 
@@ -1968,7 +1970,7 @@ int eof_menu_file_link(unsigned char application)
 			(void) ustrcpy(eof_rs_to_tab_executable_path, returnedfn);
 			if(strcasestr_spec(returnedfn, "RocksmithToTabGUI.exe"))
 			{	//If the selected file name indicates that the user picked the GUI program
-				allegro_message("It appears you picked the GUI version of RocksmithToTab instead of the command line one (RocksmithToTab.exe).  Consider re-linking to the correct program if problems are encountered.");
+				eof_message("It appears you picked the GUI version of RocksmithToTab instead of the command line one (RocksmithToTab.exe).  Consider re-linking to the correct program if problems are encountered.");
 			}
 		}
 	}
@@ -2029,18 +2031,18 @@ int eof_menu_file_exit(void)
 		(void) eof_display_notes_panel();
 		eof_render();
 	}
-	if(alert(NULL, "Want to Quit?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Want to Quit?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		if(eof_changes)
 		{
 			eof_clear_input();
-			ret = alert3(NULL, "Quick save changes before quitting?", NULL, "&Yes", "&No", "Cancel", 'y', 'n', 0);
+			ret = eof_alert3(NULL, "Quick save changes before quitting?", NULL, "&Yes", "&No", "Cancel", 'y', 'n', 0);
 			if(ret == 1)
 			{
 				if(eof_menu_file_quick_save() > 1)
 				{	//If the result was anything other than success or user cancellation
 					eof_clear_input();
-					ret2 = alert3(NULL, "Quick save failed! Exit without saving?", NULL, "&Yes", "&No", NULL, 'y', 'n', 0);
+					ret2 = eof_alert3(NULL, "Quick save failed! Exit without saving?", NULL, "&Yes", "&No", NULL, 'y', 'n', 0);
 				}
 			}
 		}
@@ -2394,7 +2396,7 @@ int eof_guitar_controller_redefine(DIALOG * d)
 	(void) dialog_message(eof_guitar_settings_dialog, MSG_DRAW, 0, &i);
 
 	if(eof_test_controller_conflict(&eof_guitar,0,7))
-		(void) alert("Warning", NULL, "There is a key conflict for this controller", "OK", NULL, 0, KEY_ENTER);
+		(void) eof_alert("Warning", NULL, "There is a key conflict for this controller", "OK", NULL, 0, KEY_ENTER);
 
 	return 0;
 }
@@ -2422,7 +2424,7 @@ int eof_drum_controller_redefine(DIALOG * d)
 	(void) dialog_message(eof_drum_settings_dialog, MSG_DRAW, 0, &i);
 
 	if(eof_test_controller_conflict(&eof_drums,0,4))
-		(void) alert("Warning", NULL, "There is a key conflict for this controller", "OK", NULL, 0, KEY_ENTER);
+		(void) eof_alert("Warning", NULL, "There is a key conflict for this controller", "OK", NULL, 0, KEY_ENTER);
 
 	return 0;
 }
@@ -2590,7 +2592,7 @@ int eof_menu_file_feedback_import(void)
 		if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 		{	//Import failed
 			(void) puts("Assert() handled successfully!");
-			allegro_message("dB Chart import failed");
+			eof_message("dB Chart import failed");
 			eof_show_mouse(NULL);
 			eof_cursor_visible = 1;
 			eof_pen_visible = 1;
@@ -2685,7 +2687,7 @@ void EnumeratedBChartInfo(struct FeedbackChart *chart)
 		free(tempstr);
 	}
 
-	allegro_message("%s",chartinfo);
+	eof_message("%s",chartinfo);
 }
 
 int eof_audio_to_ogg(char *file, char *directory, char *dest_name, char function)
@@ -3060,7 +3062,7 @@ int eof_new_chart(char * filename)
 	eof_song = eof_create_song_populated();
 	if(!eof_song)
 	{
-		allegro_message("Error creating new song!");
+		eof_message("Error creating new song!");
 		eof_cursor_visible = 1;
 		eof_pen_visible = 1;
 		eof_show_mouse(NULL);
@@ -3185,7 +3187,7 @@ int eof_save_helper_checks(void)
 	{	//Only display this warning if there is chart audio loaded
 		(void) snprintf(oggfn, sizeof(oggfn) - 1, "Warning:  Track \"%s\" contains notes/lyrics extending beyond the chart's audio.", eof_song->track[notes_after_chart_audio]->name);
 		eof_clear_input();
-		if(alert(oggfn, NULL, "This chart may not work properly.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(oggfn, NULL, "This chart may not work properly.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user doesn't opt to continue due to this error condition
 			return 1;	//Return cancellation
 		}
@@ -3212,7 +3214,7 @@ int eof_save_helper_checks(void)
 				eof_show_mouse(screen);
 				eof_clear_input();
 				eof_seek_and_render_position(EOF_TRACK_VOCALS, eof_get_note_type(eof_song, EOF_TRACK_VOCALS, ctr), eof_get_note_pos(eof_song, EOF_TRACK_VOCALS, ctr));
-				if(alert("Warning: One or more lyrics aren't within lyric phrases.", "These lyrics won't export to FoF script or simple text formats.", "Continue?", "&Yes", "&No", 'y', 'n') == 2)
+				if(eof_alert("Warning: One or more lyrics aren't within lyric phrases.", "These lyrics won't export to FoF script or simple text formats.", "Continue?", "&Yes", "&No", 'y', 'n') == 2)
 				{	//If user opts to cancel the save
 					eof_show_mouse(NULL);
 					eof_cursor_visible = 1;
@@ -3229,7 +3231,7 @@ int eof_save_helper_checks(void)
 				if((eof_song->vocal_track[0]->lyric[ctr]->text[0] != '\0') && (eof_string_has_non_ascii(eof_song->vocal_track[0]->lyric[ctr]->text)))
 				{	//If any of the lyrics that contain text have non ASCII characters
 					eof_clear_input();
-					if(alert("Warning: One or more lyrics have non ASCII characters.", "These lyrics may not work correctly for some rhythm games.", "Cancel and seek to first offending lyric?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("Warning: One or more lyrics have non ASCII characters.", "These lyrics may not work correctly for some rhythm games.", "Cancel and seek to first offending lyric?", "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to cancel the save
 						eof_seek_and_render_position(EOF_TRACK_VOCALS, eof_get_note_type(eof_song, EOF_TRACK_VOCALS, ctr), eof_get_note_pos(eof_song, EOF_TRACK_VOCALS, ctr));
 						return 1;	//Return cancellation
@@ -3253,7 +3255,7 @@ int eof_save_helper_checks(void)
 				continue;	//If this note's length is not shorter than the minimum length, skip it
 
 			eof_clear_input();
-			if(alert("Warning:  At least one note was truncated shorter", "than your defined minimum length.", "Cancel save and seek to the first such note?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("Warning:  At least one note was truncated shorter", "than your defined minimum length.", "Cancel save and seek to the first such note?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opted to seek to the first offending note (only prompt once per call)
 				eof_seek_and_render_position(ctr, eof_get_note_type(eof_song, ctr, ctr2), eof_get_note_pos(eof_song, ctr, ctr2));
 				return 1;	//Return cancellation
@@ -3288,7 +3290,7 @@ int eof_save_helper_checks(void)
 				continue;	//If this note and the next note are at the same position and have disjointed status, skip it
 
 			eof_clear_input();
-			if(alert("Warning:  At least one note is too close to another", "to enforce the minimum note distance.", "Cancel save and seek to the first such note?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("Warning:  At least one note is too close to another", "to enforce the minimum note distance.", "Cancel save and seek to the first such note?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opted to seek to the first offending note (only prompt once per call)
 				eof_seek_and_render_position(ctr, eof_get_note_type(eof_song, ctr, ctr2), thisnotepos);
 				return 1;	//Return cancellation
@@ -3322,7 +3324,7 @@ int eof_save_helper_checks(void)
 		eof_beat_stats_cached = 0;
 		eof_seek_and_render_position(eof_selected_track, eof_note_type, eof_song->beat[ctr]->pos);	//seek to the beat in question and render
 		eof_clear_input();
-		if(alert("At least one measure is interrupted by a time signature.", "This can cause problems in some rhythm games.", newfolderpath, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert("At least one measure is interrupted by a time signature.", "This can cause problems in some rhythm games.", newfolderpath, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to correct the issue
 			return 1;	//Return cancellation
 		}
@@ -3336,7 +3338,7 @@ int eof_save_helper_checks(void)
 		(void) eof_correct_chord_fingerings();			//Ensure all chords in each pro guitar track have valid finger arrays, prompt user to provide any that are missing
 		if(eof_check_fret_hand_positions())
 		{	//If any fret hand position errors were found
-			if(alert("One or more problems with defined fret hand positions were found.", NULL, "Cancel save and review them now?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("One or more problems with defined fret hand positions were found.", NULL, "Cancel save and review them now?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to see the problems
 				(void) eof_check_fret_hand_positions_menu();
 				return 1;	//Return cancellation
@@ -3381,7 +3383,7 @@ int eof_save_helper_checks(void)
 			if(eof_track_rs_tone_names_list_strings_num == 1)
 			{	//If only one tone name is used
 				eof_clear_input();
-				if(!warning3 && alert("Warning:  At least one track uses only one tone name.  You must use at least", "two different tone names and set one as default for them to work in Rocksmith 2014.", "Cancel save and update tone definitions?", "&Yes", "&No", 'y', 'n') == 1)
+				if(!warning3 && eof_alert("Warning:  At least one track uses only one tone name.  You must use at least", "two different tone names and set one as default for them to work in Rocksmith 2014.", "Cancel save and update tone definitions?", "&Yes", "&No", 'y', 'n') == 1)
 				{
 					eof_track_destroy_rs_tone_names_list_strings();
 					(void) eof_menu_track_selected_track_number(ctr, 1);	//Set the active instrument track
@@ -3396,7 +3398,7 @@ int eof_save_helper_checks(void)
 				if((tp->defaulttone[0] == '\0') && !warning1)
 				{	//If the default tone is not set, and the user wasn't warned about this yet
 					eof_clear_input();
-					if(alert("Warning:  At least one track with tone changes has no default tone set.", NULL, "Cancel save and update tone definitions?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("Warning:  At least one track with tone changes has no default tone set.", NULL, "Cancel save and update tone definitions?", "&Yes", "&No", 'y', 'n') == 1)
 					{
 						eof_track_destroy_rs_tone_names_list_strings();
 						(void) eof_menu_track_selected_track_number(ctr, 1);	//Set the active instrument track
@@ -3408,7 +3410,7 @@ int eof_save_helper_checks(void)
 				}
 				if((eof_track_rs_tone_names_list_strings_num > 4) && !warning2)
 				{	//If there are more than 4 unique tone names used, and the user wasn't warned about this yet
-					if(alert("Warning:  At least one arrangement uses more than 4 different tones.", "Rocksmith doesn't support more than 4 so EOF will only export changes for 4 tone names.", "Cancel save and update tone definitions?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("Warning:  At least one arrangement uses more than 4 different tones.", "Rocksmith doesn't support more than 4 so EOF will only export changes for 4 tone names.", "Cancel save and update tone definitions?", "&Yes", "&No", 'y', 'n') == 1)
 					{
 						eof_track_destroy_rs_tone_names_list_strings();
 						(void) eof_menu_track_selected_track_number(ctr, 1);	//Set the active instrument track
@@ -3455,7 +3457,7 @@ int eof_save_helper_checks(void)
 			{
 				eof_clear_input();
 				eof_seek_and_render_position(ctr, tp->arpeggio[ctr2].difficulty, tp->arpeggio[ctr2].start_pos);
-				if(alert("Warning:  At least one arpeggio phrase doesn't contain at least two notes.", "You should remove the arpeggio phrase or add additional notes into it.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("Warning:  At least one arpeggio phrase doesn't contain at least two notes.", "You should remove the arpeggio phrase or add additional notes into it.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opts to cancel
 					return 1;	//Return cancellation
 				}
@@ -3493,7 +3495,7 @@ int eof_save_helper_checks(void)
 						{	//If the note has slide technique and is missing the end position, and the user hasn't been warned about this yet
 							eof_clear_input();
 							eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);
-							if(alert("Warning:  At least one slide note doesn't define its ending position.", "Unless you define this information they will export as 1 fret slides.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+							if(eof_alert("Warning:  At least one slide note doesn't define its ending position.", "Unless you define this information they will export as 1 fret slides.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 							{	//If the user opts to cancel
 								return 1;	//Return cancellation
 							}
@@ -3503,7 +3505,7 @@ int eof_save_helper_checks(void)
 						{	//If the note has bend technique and is missing the bend strength, and the user hasn't been warned about this yet
 							eof_clear_input();
 							eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);
-							if(alert("Warning:  At least one bend note doesn't define its bend strength.", "Unless you define this information they will export as bending 1 half step.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+							if(eof_alert("Warning:  At least one bend note doesn't define its bend strength.", "Unless you define this information they will export as bending 1 half step.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 							{	//If the user opts to cancel
 								return 1;	//Return cancellation
 							}
@@ -3542,7 +3544,7 @@ int eof_save_helper_checks(void)
 						if(slide_error)
 						{	//If one of the above checks failed
 							eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);
-							if(alert("Warning:  At least one slide note has an error in its end position.", "Unless corrected, it will not export to XML as a slide.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+							if(eof_alert("Warning:  At least one slide note has an error in its end position.", "Unless corrected, it will not export to XML as a slide.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 							{	//If the user opts to cancel
 								return 1;	//Return cancellation
 							}
@@ -3565,7 +3567,8 @@ int eof_save_helper_checks(void)
 	if(eof_write_rs_files || eof_write_rs2_files)
 	{	//If the user wants to save Rocksmith capable files
 		char target = 1;	//Unless eof_write_rs2_files is enabled, only notes that are valid for RS1 export are checked
-		char *name, user_prompted = 0;
+		const char *name;
+		char user_prompted = 0;
 		unsigned char original_eof_2d_render_top_option = eof_2d_render_top_option;	//Back up the user's preference
 
 		if(eof_write_rs2_files)
@@ -3594,7 +3597,7 @@ int eof_save_helper_checks(void)
 				eof_2d_render_top_option = 5;					//Change the user preference to render note names at the top of the piano roll
 				eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);	//Render the track so the user can see where the correction needs to be made
 				eof_clear_input();
-				if(!user_prompted && alert("At least one chord has an unaccepted character: } , \\ : { \"", "This can cause Rocksmith to crash or hang and will be removed.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+				if(!user_prompted && eof_alert("At least one chord has an unaccepted character: } , \\ : { \"", "This can cause Rocksmith to crash or hang and will be removed.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user hasn't already answered this prompt, and opts to correct the issue
 					eof_2d_render_top_option = original_eof_2d_render_top_option;	//Restore the user's preference
 					return 1;	//Return cancellation
@@ -3681,7 +3684,7 @@ int eof_save_helper_checks(void)
 						}
 						eof_seek_and_render_position(ctr, eof_note_type, tp->arpeggio[ctr2].start_pos);	//Render the track so the user can see where the correction needs to be made
 						eof_clear_input();
-						if(!user_prompted && alert("At least one arpeggio/handshape crosses over into another RS phrase", "This can behave strangely in Rocksmith if the chart has dynamic difficulty.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+						if(!user_prompted && eof_alert("At least one arpeggio/handshape crosses over into another RS phrase", "This can behave strangely in Rocksmith if the chart has dynamic difficulty.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 						{	//If the user hasn't already answered this prompt, and opts to correct the issue
 							eof_2d_render_top_option = original_eof_2d_render_top_option;	//Restore the user's preference
 							return 1;	//Return cancellation
@@ -3734,7 +3737,7 @@ int eof_save_helper_checks(void)
 					{	//If the bend strength is greater than 3 half steps (6 quarter steps)
 						eof_seek_and_render_position(ctr, tp->note[ctr3]->type, tp->note[ctr3]->pos);	//Render the track so the user can see where the correction needs to be made
 						eof_clear_input();
-						if(!user_prompted && alert("At least one bend note has a strength higher than 3 half steps.", "3 half steps is the strongest bend that Rocksmith supports.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+						if(!user_prompted && eof_alert("At least one bend note has a strength higher than 3 half steps.", "3 half steps is the strongest bend that Rocksmith supports.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 						{	//If the user hasn't already answered this prompt, and opts to correct the issue
 							return 1;	//Return cancellation
 						}
@@ -3808,7 +3811,7 @@ int eof_save_helper_checks(void)
 			{	//If the user was not prompted yet
 				int ret;
 
-				ret = alert3(warning, NULL, "Cancel and seek to first offending note?", "Yes", "No", "Highlight all and cancel", 0, 0, 0);
+				ret = eof_alert3(warning, NULL, "Cancel and seek to first offending note?", "Yes", "No", "Highlight all and cancel", 0, 0, 0);
 				if(ret == 2)
 				{	//User declined
 					note_skew_warned = 1;	//Set a condition to exit the outer for loop
@@ -3863,7 +3866,7 @@ int eof_save_helper_checks(void)
 				eof_seek_and_render_position(ctr, eof_note_type, eof_song->beat[ctr]->pos);	//Render the track so the user can see where the correction needs to be made
 				eof_clear_input();
 
-				if(alert("Warning (RS):  At least one RS section/phrase has a non alphanumeric character in its name.", "Some characters may cause the game to malfunction.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("Warning (RS):  At least one RS section/phrase has a non alphanumeric character in its name.", "Some characters may cause the game to malfunction.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opted to cancel the save
 					return 1;	//Return cancellation
 				}
@@ -3898,7 +3901,7 @@ int eof_save_helper_checks(void)
 				eof_menu_pro_guitar_track_set_tech_view_state(tp, 1);	//Activate the tech note set
 				eof_seek_and_render_position(ctr, tp->pgnote[ctr2]->type, tp->pgnote[ctr2]->pos);	//Render the track so the user can see where the correction needs to be made
 				eof_clear_input();
-				if(!user_prompted && alert("At least one note has 33 or more bend tech notes", "This would cause Rocksmith 2014 to crash so only the first 32 bend points will export.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+				if(!user_prompted && eof_alert("At least one note has 33 or more bend tech notes", "This would cause Rocksmith 2014 to crash so only the first 32 bend points will export.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user hasn't already answered this prompt, and opts to correct the issue
 					return 1;	//Return cancellation
 				}
@@ -3988,7 +3991,7 @@ int eof_save_helper_checks(void)
 					eof_2d_render_top_option = 9;					//Change the user preference to render RS phrases and sections at the top of the piano roll
 					eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);	//Render the track so the user can see where the correction needs to be made
 					eof_clear_input();
-					if(!user_prompted && alert("Warning (RS):  At least one note crosses an RS phrase or section boundary.", "This can behave strangely in Rocksmith if the chart has dynamic difficulty.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+					if(!user_prompted && eof_alert("Warning (RS):  At least one note crosses an RS phrase or section boundary.", "This can behave strangely in Rocksmith if the chart has dynamic difficulty.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user hasn't already answered this prompt, and opts to correct the issue
 						return 1;	//Return cancellation
 					}
@@ -4004,6 +4007,56 @@ int eof_save_helper_checks(void)
 	return 0;
 }
 
+typedef struct
+{
+	char filename[1024];	//The path of the WAV file to write
+	char fallback[1024];	//The path to retry with if that write fails (ie. the song title contains invalid characters)
+	unsigned long silence;	//The amount of silence (in milliseconds) to append to the audio
+	char oggfilename[1024];	//The chart audio file, whose decoded PCM data is obtained from the PCM cache
+	void *oggdata;			//The chart audio's memory buffered copy (eof_music_data), captured on the main thread
+	int oggsize;			//The size of that buffer
+	int result;				//Set by the worker thread:  0 if the audio couldn't be decoded, 1 if the WAV was written, 2 if it was written to the fallback path, 3 if neither write succeeded
+	double elapsed;			//The number of seconds the worker thread took
+	pthread_t thread;
+} EOF_RS_WAV_JOB;
+
+static void *eof_save_rs_wav_thread(void *arg)
+{
+	EOF_RS_WAV_JOB *job = (EOF_RS_WAV_JOB *)arg;
+	EOF_PCM_CACHE_ENTRY *pcm;
+	double starttime = eof_get_wall_time();
+
+	if(!job)
+		return NULL;
+
+	pcm = eof_pcm_cache_acquire_buffer(job->oggfilename, job->oggdata, job->oggsize);	//Get the PCM data for the chart audio, decoding it if the waveform graph or spectrogram haven't already
+	if(pcm)
+	{	//Write a WAV file with it, appending the requested silence
+		if(save_wav_with_silence_appended(job->filename, pcm->audio, job->silence))
+		{
+			job->result = 1;
+		}
+		else if(save_wav_with_silence_appended(job->fallback, pcm->audio, 8000))
+		{
+			job->result = 2;
+		}
+		else
+		{
+			job->result = 3;
+		}
+		eof_pcm_cache_release(pcm);
+	}
+	job->elapsed = eof_get_wall_time() - starttime;
+
+	return NULL;
+}
+
+static void eof_log_export_time(const char *exportname, double starttime)
+{
+	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tExported %s in %f seconds", exportname, eof_get_wall_time() - starttime);
+	eof_log(eof_log_string, 1);
+}
+
 int eof_save_helper(char *destfilename, char silent)
 {
 	unsigned long ctr;
@@ -4018,6 +4071,10 @@ int eof_save_helper(char *destfilename, char silent)
 	unsigned short user_warned = 0;	//Tracks whether the user was warned about hand positions being undefined and auto-generated during Rocksmith and Bandfuse exports
 	int err;
 	int midi_export_success = 1;
+	double starttime, exportstarttime;
+	unsigned long rstracks[] = {EOF_TRACK_PRO_BASS, EOF_TRACK_PRO_BASS_22, EOF_TRACK_PRO_GUITAR, EOF_TRACK_PRO_GUITAR_22, EOF_TRACK_PRO_GUITAR_B};
+	EOF_RS_WAV_JOB wavjob;
+	char wavjob_running = 0;
 
 	eof_log("eof_save_helper() entered", 1);
 
@@ -4083,7 +4140,7 @@ int eof_save_helper(char *destfilename, char silent)
 			{	//Make sure it's gone
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  Could not delete the previous_save backup file.  Aborting save.  Please use \"Save as\" to save to a new location.");
 				eof_log(eof_log_string, 1);
-				allegro_message("%s", eof_log_string);
+				eof_message("%s", eof_log_string);
 				return 5;	//Return failure:  Error deleting lastsave file
 			}
 		}
@@ -4094,7 +4151,7 @@ int eof_save_helper(char *destfilename, char silent)
 			{	//Make sure it was created
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  Could not create the previous_save backup file.  Aborting save.  Please use \"Save as\" to save to a new location.");
 				eof_log(eof_log_string, 1);
-				allegro_message("%s", eof_log_string);
+				eof_message("%s", eof_log_string);
 				return 6;	//Return failure:  Could not create previous_save backup file
 			}
 			(void) delete_file(eof_temp_filename);	//Delete the target file name
@@ -4102,7 +4159,7 @@ int eof_save_helper(char *destfilename, char silent)
 			{	//Make sure it was deleted
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  Could not delete the last save file.  Aborting save.  Please use \"Save as\" to save to a new location.");
 				eof_log(eof_log_string, 1);
-				allegro_message("%s", eof_log_string);
+				eof_message("%s", eof_log_string);
 				return 7;	//Return failure:  Could not delete the last save file
 			}
 		}
@@ -4113,7 +4170,7 @@ int eof_save_helper(char *destfilename, char silent)
  	eof_log("\tSaving project", 1);
 	if(!eof_save_song(eof_song, eof_temp_filename))
 	{
-		allegro_message("Could not save song!");
+		eof_message("Could not save song!");
 		eof_show_mouse(NULL);
 		eof_cursor_visible = 1;
 		eof_pen_visible = 1;
@@ -4127,11 +4184,40 @@ int eof_save_helper(char *destfilename, char silent)
 	{	//Make sure the target file was created
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  Save operation did not create project file.  Please use \"Save as\" to save to a new location.");
 		eof_log(eof_log_string, 1);
-		allegro_message("%s", eof_log_string);
+		eof_message("%s", eof_log_string);
 		return 9;	//Return failure:  Could not create project file
 	}
 	(void) ustrcpy(eof_filename, eof_temp_filename);	//Update the absolute project filename
 	(void) ustrcpy(eof_loaded_song_name, get_filename(eof_temp_filename));	//Update the relative project filename
+	exportstarttime = eof_get_wall_time();
+
+	/* start writing the Rocksmith WAV file if it's needed, decoding the audio is the slowest part of the save and doesn't depend on the other exports */
+	if((eof_write_rs_files || eof_write_rs2_files) && !eof_silence_loaded && !eof_disable_rs_wav && eof_music_data && eof_song_has_pro_guitar_content(eof_song))
+	{	//If the user wants to save Rocksmith capable files, chart audio is loaded and there is at least one normal or tech note in any pro guitar track
+		memset(&wavjob, 0, sizeof(wavjob));
+		eof_get_rocksmith_wav_path(wavjob.filename, newfolderpath, sizeof(wavjob.filename));	//Build the path to the target WAV file
+		(void) replace_filename(wavjob.fallback, newfolderpath, "guitar.wav", (int) sizeof(wavjob.fallback));
+		if(!exists(wavjob.filename) && !exists(wavjob.fallback))
+		{	//If neither the WAV file nor "guitar.wav" exist
+			if(eof_write_rs_files)
+			{	//If the user wants to save Rocksmith 1 files
+				wavjob.silence = 8000;	//Create a WAV with 8 seconds of silence appended, so that the song will end properly in-game
+			}
+			(void) ustrcpy(wavjob.oggfilename, eof_loaded_ogg_name);
+			wavjob.oggdata = eof_music_data;	//The worker thread doesn't read these globals itself, and the chart audio isn't unloaded before it is joined
+			wavjob.oggsize = eof_music_data_size;
+			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Writing RS WAV file (%s) with %lums of silence on a worker thread", wavjob.filename, wavjob.silence);
+			eof_log(eof_log_string, 1);
+			if(!pthread_create(&wavjob.thread, NULL, eof_save_rs_wav_thread, &wavjob))
+			{
+				wavjob_running = 1;
+			}
+			else
+			{
+				eof_log("\tCould not start worker thread, the RS WAV file was not written", 1);
+			}
+		}
+	}
 
 	/* save the MIDI, INI and other files*/
 	if(!silent && (eof_write_fof_files || eof_write_rb_files))
@@ -4150,7 +4236,7 @@ int eof_save_helper(char *destfilename, char silent)
 		if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 		{	//Lyric export failed
 			(void) puts("Assert() handled successfully!");
-			allegro_message("Plain script lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+			eof_message("Plain script lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 		}
 		else
 		{
@@ -4162,7 +4248,9 @@ int eof_save_helper(char *destfilename, char silent)
 	{	//If the user opted to save FoF related files
 		/* Save MIDI file */
 		(void) append_filename(eof_temp_filename, newfolderpath, "notes.mid", (int) sizeof(eof_temp_filename));
+		starttime = eof_get_wall_time();
 		midi_export_success &= eof_export_midi(eof_song, eof_temp_filename, 0, fixvoxpitches, fixvoxphrases, 0);
+		eof_log_export_time("notes.mid", starttime);
 
 		/* Save INI file */
 		if(!eof_disable_ini_export)
@@ -4179,7 +4267,7 @@ int eof_save_helper(char *destfilename, char silent)
 			if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 			{	//Lyric export failed
 				(void) puts("Assert() handled successfully!");
-				allegro_message("Script lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+				eof_message("Script lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 			}
 			else
 			{
@@ -4196,7 +4284,7 @@ int eof_save_helper(char *destfilename, char silent)
 		if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 		{	//Lyric export failed
 			(void) puts("Assert() handled successfully!");
-			allegro_message("LRC lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+			eof_message("LRC lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 		}
 		else
 		{
@@ -4209,7 +4297,7 @@ int eof_save_helper(char *destfilename, char silent)
 		if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 		{	//Lyric export failed
 			(void) puts("Assert() handled successfully!");
-			allegro_message("ELRC lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+			eof_message("ELRC lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 		}
 		else
 		{
@@ -4222,7 +4310,7 @@ int eof_save_helper(char *destfilename, char silent)
 		if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 		{	//Lyric export failed
 			(void) puts("Assert() handled successfully!");
-			allegro_message("QRC lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+			eof_message("QRC lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 		}
 		else
 		{
@@ -4238,26 +4326,36 @@ int eof_save_helper(char *destfilename, char silent)
 
 		/* Save GHWT MIDI variant */
 		(void) append_filename(eof_temp_filename, newfolderpath, "notes_ghwt.mid", (int) sizeof(eof_temp_filename));
+		starttime = eof_get_wall_time();
 		midi_export_success &= eof_export_midi(eof_song, eof_temp_filename, 0, fixvoxpitches, fixvoxphrases, 1);
+		eof_log_export_time("notes_ghwt.mid", starttime);
 
 		/* Save GH3 MIDI variant */
 		(void) append_filename(eof_temp_filename, newfolderpath, "notes_gh3.mid", (int) sizeof(eof_temp_filename));
+		starttime = eof_get_wall_time();
 		midi_export_success &= eof_export_midi(eof_song, eof_temp_filename, 0, fixvoxpitches, fixvoxphrases, 2);
+		eof_log_export_time("notes_gh3.mid", starttime);
 	}
 
 	if(eof_write_rb_files)
 	{	//If the user opted to also save RBN2 and RB3 pro guitar upgrade compliant MIDIs
 		(void) append_filename(eof_temp_filename, newfolderpath, "notes_rbn.mid", (int) sizeof(eof_temp_filename));
+		starttime = eof_get_wall_time();
 		midi_export_success &= eof_export_midi(eof_song, eof_temp_filename, 1, fixvoxpitches, fixvoxphrases, 0);	//Write a RBN2 compliant MIDI
+		eof_log_export_time("notes_rbn.mid", starttime);
 		if(eof_get_track_size_normal(eof_song, EOF_TRACK_PRO_BASS) || eof_get_track_size_normal(eof_song, EOF_TRACK_PRO_BASS_22) || eof_get_track_size_normal(eof_song, EOF_TRACK_PRO_GUITAR) || eof_get_track_size_normal(eof_song, EOF_TRACK_PRO_GUITAR_22))
 		{	//If any of the pro guitar tracks' normal note sets are populated
 			//Write the pro guitar upgrade MIDI
 			(void) append_filename(eof_temp_filename, newfolderpath, "notes_pro.mid", (int) sizeof(eof_temp_filename));
+			starttime = eof_get_wall_time();
 			midi_export_success &= eof_export_midi(eof_song, eof_temp_filename, 2, fixvoxpitches, fixvoxphrases, 0);	//Write a RB3 pro guitar upgrade compliant MIDI
+			eof_log_export_time("notes_pro.mid", starttime);
 
 			//Write the Rock Band MIDI that can be built by the C3 release of Magma
 			(void) append_filename(eof_temp_filename, newfolderpath, "notes_c3.mid", (int) sizeof(eof_temp_filename));
+			starttime = eof_get_wall_time();
 			midi_export_success &= eof_export_midi(eof_song, eof_temp_filename, 3, fixvoxpitches, fixvoxphrases, 0);	//Write a MIDI containing the RBN and pro guitar content
+			eof_log_export_time("notes_c3.mid", starttime);
 
 			//Write a DTA file for the pro guitar upgrade
 			(void) ustrcpy(eof_temp_filename, newfolderpath);
@@ -4268,7 +4366,9 @@ int eof_save_helper(char *destfilename, char silent)
 				err = eof_mkdir(eof_temp_filename);
 				if(err && !eof_folder_exists(eof_temp_filename))
 				{	//If it couldn't be created and is still not found to exist (in case the previous check was a false negative)
-					allegro_message("Could not create folder!\n%s", eof_temp_filename);
+					eof_message("Could not create folder!\n%s", eof_temp_filename);
+					if(wavjob_running)
+						(void) pthread_join(wavjob.thread, NULL);	//Don't return while the worker thread is using this stack frame
 					return 10;	//Return failure:  Could not recreate project folder
 				}
 			}
@@ -4280,15 +4380,19 @@ int eof_save_helper(char *destfilename, char silent)
 
 	if(!midi_export_success)
 	{	//If any of the calls to eof_export_midi() returned 0 (failed)
-		allegro_message("Error:  At least one MIDI file failed to export.  Check the logging for details.");
+		eof_message("Error:  At least one MIDI file failed to export.  Check the logging for details.");
 	}
 
 	if(eof_write_music_midi)
 	{	//If the user opted to also save musical MIDIs
 		(void) append_filename(eof_temp_filename, newfolderpath, "notes_music.mid", (int) sizeof(eof_temp_filename));
+		starttime = eof_get_wall_time();
 		(void) eof_export_music_midi(eof_song, eof_temp_filename, 0);	//Write a Synthesia formatted MIDI
+		eof_log_export_time("notes_music.mid", starttime);
 		(void) append_filename(eof_temp_filename, newfolderpath, "notes_fretlight.mid", (int) sizeof(eof_temp_filename));
+		starttime = eof_get_wall_time();
 		(void) eof_export_music_midi(eof_song, eof_temp_filename, 1);	//Write a Fretlight formatted MIDI
+		eof_log_export_time("notes_fretlight.mid", starttime);
 	}
 
 	if(eof_write_rs_files || eof_write_rs2_files)
@@ -4303,19 +4407,23 @@ int eof_save_helper(char *destfilename, char silent)
 
 		if(eof_write_rs_files)
 		{	//If the user wants to save Rocksmith 1 files
-			(void) eof_export_rocksmith_1_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_BASS, &user_warned);
-			(void) eof_export_rocksmith_1_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_BASS_22, &user_warned);
-			(void) eof_export_rocksmith_1_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_GUITAR, &user_warned);
-			(void) eof_export_rocksmith_1_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_GUITAR_22, &user_warned);
-			(void) eof_export_rocksmith_1_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_GUITAR_B, &user_warned);
+			for(ctr = 0; ctr < sizeof(rstracks) / sizeof(unsigned long); ctr++)
+			{	//For each pro guitar/bass track
+				starttime = eof_get_wall_time();
+				(void) eof_export_rocksmith_1_track(eof_song, eof_temp_filename, rstracks[ctr], &user_warned);
+				(void) snprintf(tempfilename2, sizeof(tempfilename2) - 1, "%s (RS1)", eof_song->track[rstracks[ctr]]->name);
+				eof_log_export_time(tempfilename2, starttime);
+			}
 		}
 		if(eof_write_rs2_files)
 		{	//If the user wants to save Rocksmith 2 files
-			(void) eof_export_rocksmith_2_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_BASS, &user_warned);
-			(void) eof_export_rocksmith_2_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_BASS_22, &user_warned);
-			(void) eof_export_rocksmith_2_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_GUITAR, &user_warned);
-			(void) eof_export_rocksmith_2_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_GUITAR_22, &user_warned);
-			(void) eof_export_rocksmith_2_track(eof_song, eof_temp_filename, EOF_TRACK_PRO_GUITAR_B, &user_warned);
+			for(ctr = 0; ctr < sizeof(rstracks) / sizeof(unsigned long); ctr++)
+			{	//For each pro guitar/bass track
+				starttime = eof_get_wall_time();
+				(void) eof_export_rocksmith_2_track(eof_song, eof_temp_filename, rstracks[ctr], &user_warned);
+				(void) snprintf(tempfilename2, sizeof(tempfilename2) - 1, "%s (RS2)", eof_song->track[rstracks[ctr]]->name);
+				eof_log_export_time(tempfilename2, starttime);
+			}
 		}
 		if(eof_song->vocal_track[0]->lyrics)
 		{	//If there are lyrics, export them in Rocksmith format as well
@@ -4346,7 +4454,7 @@ int eof_save_helper(char *destfilename, char silent)
 				if(jumpcode!=0) //if program control returned to the setjmp() call above returning any nonzero value
 				{	//Lyric export failed
 					(void) puts("Assert() handled successfully!");
-					allegro_message("Rocksmith lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+					eof_message("Rocksmith lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 				}
 				else
 				{
@@ -4382,7 +4490,7 @@ int eof_save_helper(char *destfilename, char silent)
 				if(jumpcode != 0) //if program control returned to the setjmp() call above returning any nonzero value
 				{	//Lyric export failed
 					(void) puts("Assert() handled successfully!");
-					allegro_message("Rocksmith lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
+					eof_message("Rocksmith lyric export failed.\nMake sure there are no Unicode or extended ASCII characters in EOF's folder path,\nbecause EOF's lyric export doesn't support them.");
 				}
 				else
 				{
@@ -4403,45 +4511,6 @@ int eof_save_helper(char *destfilename, char silent)
 		(void) eof_detect_difficulties(eof_song, eof_selected_track);		//Update eof_track_diff_populated_status[] to reflect the currently selected difficulty
 		eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
 
-		//Determine if the Rocksmith WAV file exists, if not, export the chart audio in WAV format
-		if(!eof_silence_loaded && eof_song_has_pro_guitar_content(eof_song))
-		{	//If chart audio is loaded and there is at least one normal or tech note in any pro guitar track
-			eof_get_rocksmith_wav_path(eof_temp_filename, newfolderpath, sizeof(eof_temp_filename));	//Build the path to the target WAV file
-			if(!exists(eof_temp_filename))
-			{	//If the WAV file does not exist
-				(void) replace_filename(eof_temp_filename, newfolderpath, "guitar.wav", (int) sizeof(eof_temp_filename));
-				if(!eof_disable_rs_wav)
-				{	//If the user hasn't disabled the creation of the Rocksmith WAV file
-					if(!exists(eof_temp_filename))
-					{	//If "guitar.wav" also does not exist
-						unsigned long silence = 0;	//The amount of silence to append to the RS WAV file (8000ms if RS1 export is enabled)
-						SAMPLE *decoded = alogg_create_sample_from_ogg(eof_music_track);	//Create PCM data from the loaded chart audio
-
-						eof_get_rocksmith_wav_path(eof_temp_filename, newfolderpath, sizeof(eof_temp_filename));	//Rebuild the target path based on the song title
-						eof_log("Saving Rocksmith WAV file", 1);
-						set_window_title("Saving WAV file for use with Wwise.  Please wait.");
-						if(eof_write_rs_files)
-						{	//If the user wants to save Rocksmith 1 files
-							silence = 8000;	//Create a WAV with 8 seconds of silence appended, so that the song will end properly in-game
-						}
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Writing RS WAV file (%s) with %lums of silence", eof_temp_filename, silence);
-						eof_log(eof_log_string, 1);
-						//Write a WAV file with it, appending either 0 or 8 seconds of silence to it
-						if(!save_wav_with_silence_appended(eof_temp_filename, decoded, silence))
-						{	//If it didn't save, try saving again as "guitar.wav", just in case the user put invalid characters in the song title
-							eof_log("Retrying as \"guitar.wav\"", 1);
-							(void) replace_filename(eof_temp_filename, newfolderpath, "guitar.wav", (int) sizeof(eof_temp_filename));
-							if(!save_wav_with_silence_appended(eof_temp_filename, decoded, 8000))
-							{	//If it didn't save again
-								allegro_message("Error saving WAV file, check the log for the OS' reason");
-							}
-						}
-						destroy_sample(decoded);	//Release buffered chart audio
-						eof_fix_window_title();
-					}
-				}
-			}
-		}
 	}//If the user wants to save Rocksmith capable files
 
 	if(eof_write_bf_files)
@@ -4472,9 +4541,35 @@ int eof_save_helper(char *destfilename, char silent)
 		}
 		(void) append_filename(eof_temp_filename, newfolderpath, tempfilename2, (int) sizeof(eof_temp_filename));	//Build the full file name
 
+		starttime = eof_get_wall_time();
 		(void) eof_export_bandfuse(eof_song, eof_temp_filename, &user_warned);
+		eof_log_export_time(tempfilename2, starttime);
 	}//If the user wants to save Bandfuse capable files
 
+	/* wait for the Rocksmith WAV file */
+	if(wavjob_running)
+	{
+		set_window_title("Saving WAV file for use with Wwise.  Please wait.");
+		(void) pthread_join(wavjob.thread, NULL);
+		eof_fix_window_title();
+		if(wavjob.result == 0)
+		{
+			eof_log("\tCould not decode the chart audio, the RS WAV file was not written", 1);
+		}
+		else if(wavjob.result == 2)
+		{
+			eof_log("\tRS WAV file was written as \"guitar.wav\" instead", 1);
+		}
+		else if(wavjob.result == 3)
+		{
+			eof_message("Error saving WAV file, check the log for the OS' reason");
+		}
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tRS WAV file worker thread finished in %f seconds", wavjob.elapsed);
+		eof_log(eof_log_string, 1);
+	}
+	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tAll exports completed in %f seconds", eof_get_wall_time() - exportstarttime);
+	eof_log(eof_log_string, 1);
+
 	/* save OGG file if necessary*/
 	if(!eof_silence_loaded)
 	{	//Only try to save an audio file if one is loaded
@@ -4574,7 +4669,7 @@ int eof_menu_prompt_save_changes(void)
 	{
 		eof_music_play(0);
 	}
-	ret = alert3(NULL, "You have unsaved changes.", NULL, "Save", "Discard", "Cancel", 0, 0, 0);
+	ret = eof_alert3(NULL, "You have unsaved changes.", NULL, "Save", "Discard", "Cancel", 0, 0, 0);
 	if(ret == 1)
 	{
 		(void) eof_menu_file_save();
@@ -4646,7 +4741,7 @@ int eof_menu_file_gh_import(void)
 		}
 		else
 		{
-			allegro_message("Could not import GH file!");
+			eof_message("Could not import GH file!");
 			eof_song_loaded = 0;
 			eof_changes = 0;
 			eof_fix_window_title();
@@ -4721,7 +4816,7 @@ int eof_menu_file_ghl_import(void)
 			}
 			else
 			{
-				allegro_message("Could not import GHL file!");
+				eof_message("Could not import GHL file!");
 			}
 		}
 		(void) replace_filename(eof_last_gp_path, returnedfn_path, "", 1024);	//Set the last loaded GP file path
@@ -4808,7 +4903,7 @@ int eof_gp_import_drum_track(int importvoice, int function)
 	if(populated || populated2)
 	{	//If the destination track(s) have notes in them
 		eof_clear_input();
-		if(alert("The destination drum track(s) have notes", "Importing this GP track will overwrite their contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("The destination drum track(s) have notes", "Importing this GP track will overwrite their contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the drum track(s) are already populated and the user doesn't opt to overwrite them
 			eof_log("\t\tImport canceled", 1);
 			return 0;
@@ -4977,7 +5072,7 @@ int eof_gp_import_drum_track(int importvoice, int function)
 				if(!gracenote_prompt)
 				{	//If the user wasn't prompted yet
 					eof_clear_input();
-					if(alert("There is at least one before-the-beat grace note", NULL, "Import the notes that follow these as flams?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("There is at least one before-the-beat grace note", NULL, "Import the notes that follow these as flams?", "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user opts to treat this as flam drum notation
 						gracenote_prompt = 1;
 					}
@@ -4997,7 +5092,7 @@ int eof_gp_import_drum_track(int importvoice, int function)
 				np = eof_track_add_create_note(eof_song, EOF_TRACK_DRUM, note, gnp->pos, 1, EOF_NOTE_AMAZING, NULL);
 				if(!np)
 				{	//If the memory couldn't be allocated
-					allegro_message("Error allocating memory.  Aborting");
+					eof_message("Error allocating memory.  Aborting");
 					eof_log("\t\tImport failed", 1);
 					return 0;
 				}
@@ -5008,7 +5103,7 @@ int eof_gp_import_drum_track(int importvoice, int function)
 				np = eof_track_add_create_note(eof_song, EOF_TRACK_DRUM_PS, note, gnp->pos, 1, EOF_NOTE_AMAZING, NULL);
 				if(!np)
 				{	//If the memory couldn't be allocated
-					allegro_message("Error allocating memory.  Aborting");
+					eof_message("Error allocating memory.  Aborting");
 					eof_log("\t\tImport failed", 1);
 					return 0;
 				}
@@ -5024,11 +5119,11 @@ int eof_gp_import_drum_track(int importvoice, int function)
 	{	//If one or more cymbal+tom notes were imported
 		if(function == 3)
 		{	//If the drum notes were imported into both the normal and the Phase Shift drum tracks
-			allegro_message("Note:  The imported drum track contains cymbal+tom notes, but these notes are only compatible with the Phase Shift drum track.  This status was retained for the notes imported into the Phase Shift drum track, but not the ones imported into the normal drum track.");
+			eof_message("Note:  The imported drum track contains cymbal+tom notes, but these notes are only compatible with the Phase Shift drum track.  This status was retained for the notes imported into the Phase Shift drum track, but not the ones imported into the normal drum track.");
 		}
 		else if(!(function & 2))
 		{	//If the drum notes were only imported into the normal drum track
-			allegro_message("Note:  The imported drum track contains cymbal+tom notes, but these notes are only compatible with the Phase Shift drum track.  Re-import the Guitar Pro file into that drum track is this notation is wanted.");
+			eof_message("Note:  The imported drum track contains cymbal+tom notes, but these notes are only compatible with the Phase Shift drum track.  Re-import the Guitar Pro file into that drum track is this notation is wanted.");
 		}
 	}
 	eof_fixup_notes(eof_song);
@@ -5058,7 +5153,7 @@ int eof_gp_import_guitar_track(int importvoice)
 		eof_clear_input();
 		if(eof_gp_import_replaces_track)
 		{	//If the user preference to replace the entire active track with the imported track is enabled
-			if(eof_get_track_size_all(eof_song, eof_selected_track) && alert("This track already has notes", "Importing this GP track will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_get_track_size_all(eof_song, eof_selected_track) && eof_alert("This track already has notes", "Importing this GP track will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 			{	//If the active track is already populated (with normal or tech notes) and the user doesn't opt to overwrite it
 				eof_log("\t\tImport canceled", 1);
 				return 0;
@@ -5066,7 +5161,7 @@ int eof_gp_import_guitar_track(int importvoice)
 		}
 		else
 		{	//If the imported track will only replace the active track difficulty
-			if(eof_track_diff_populated_status[eof_note_type] && alert("This track difficulty already has notes", "Importing this GP track will overwrite this difficulty's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_track_diff_populated_status[eof_note_type] && eof_alert("This track difficulty already has notes", "Importing this GP track will overwrite this difficulty's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 			{	//If the active track difficulty is already populated and the user doesn't opt to overwrite it
 				eof_log("\t\tImport canceled", 1);
 				return 0;
@@ -5100,7 +5195,7 @@ int eof_gp_import_guitar_track(int importvoice)
 				EOF_PRO_GUITAR_NOTE *np = eof_pro_guitar_track_add_note(eof_song->pro_guitar_track[tracknum]);	//Allocate a new note
 				if(!np)
 				{	//If the memory couldn't be allocated
-					allegro_message("Error allocating memory.  Aborting");
+					eof_message("Error allocating memory.  Aborting");
 					eof_log("\t\tImport failed", 1);
 					return 0;
 				}
@@ -5116,7 +5211,7 @@ int eof_gp_import_guitar_track(int importvoice)
 				EOF_PRO_GUITAR_NOTE *np = eof_pro_guitar_track_add_tech_note(eof_song->pro_guitar_track[tracknum]);	//Allocate a new note
 				if(!np)
 				{	//If the memory couldn't be allocated
-					allegro_message("Error allocating memory.  Aborting");
+					eof_message("Error allocating memory.  Aborting");
 					eof_log("\t\tImport failed", 1);
 					return 0;
 				}
@@ -5165,7 +5260,7 @@ int eof_gp_import_guitar_track(int importvoice)
 		//Copy the imported track's tuning, string count, fret count and capo position into the active track
 		if(eof_detect_string_gem_conflicts(eof_song->pro_guitar_track[tracknum], eof_parsed_gp_file->track[selected]->numstrings))
 		{	//If the track being imported has a different string count that would cause notes to be removed from the track
-			if(alert("Warning:  The imported track's string count is lower than the active track.", "Applying the string count will alter/delete existing notes in the track.", "Apply the imported track's string count?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("Warning:  The imported track's string count is lower than the active track.", "Applying the string count will alter/delete existing notes in the track.", "Apply the imported track's string count?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If user opts to change the string count even though notes will be altered/deleted
 				eof_song->pro_guitar_track[tracknum]->numstrings = eof_parsed_gp_file->track[selected]->numstrings;
 			}
@@ -5184,14 +5279,14 @@ int eof_gp_import_guitar_track(int importvoice)
 		}
 		if(is_bass && (eof_parsed_gp_file->instrument_types[selected] == 1))
 		{	//If the imported GP track is a guitar track and the user is importing it into an EOF track that's configured as a bass arrangement
-			if(alert("You are importing a guitar arrangement into a bass track.", NULL, "Update the recipient track's type to a non-bass arrangement type?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("You are importing a guitar arrangement into a bass track.", NULL, "Update the recipient track's type to a non-bass arrangement type?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to alter the arrangement type
 				eof_song->pro_guitar_track[tracknum]->arrangement = 0;	//Set it to undefined guitar arrangement
 			}
 		}
 		else if(!is_bass && (eof_parsed_gp_file->instrument_types[selected] == 2))
 		{	//If the imported GP track is a bass track and the user is importing it into an EOF track that's configured as a guitar arrangement
-			if(alert("You are importing a bass arrangement into a guitar track.", NULL, "Update the recipient track's type to a bass arrangement type?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("You are importing a bass arrangement into a guitar track.", NULL, "Update the recipient track's type to a bass arrangement type?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to alter the arrangement type
 				eof_song->pro_guitar_track[tracknum]->arrangement = 4;	//Set it to bass arrangement
 			}
@@ -5207,7 +5302,7 @@ int eof_gp_import_guitar_track(int importvoice)
 			new_tuning %= 12;	//Ensure the stored value is bounded to [-11,11]
 			if(!tuning_prompted && still_populated && (new_tuning != eof_song->pro_guitar_track[tracknum]->tuning[ctr]))
 			{	//If applying the imported track's tuning would alter the tuning for other notes that are already in the track, prompt the user
-				if(alert("Warning:  The imported track's tuning is different than the track's current tuning.", "Applying the tuning will affect the existing notes in the track.", "Apply the imported track's tuning?", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("Warning:  The imported track's tuning is different than the track's current tuning.", "Applying the tuning will affect the existing notes in the track.", "Apply the imported track's tuning?", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opts to set the imported track's tuning even though the active track still has notes in it
 					tuning_prompted = 1;	//Note that the user answered yes
 				}
@@ -5255,7 +5350,7 @@ int eof_gp_import_track(DIALOG * d)
 		}
 		if((voicespresent == 3) && !importvoice)
 		{	//If notes in both voices have been encountered and the user hasn't been prompted about which to import
-			int ret = alert3(NULL, "Import which voices from this track?", NULL, "&Lead", "&Bass", "B&Oth", 'l', 'b', 'o');
+			int ret = eof_alert3(NULL, "Import which voices from this track?", NULL, "&Lead", "&Bass", "B&Oth", 'l', 'b', 'o');
 			if(ret == 1)
 			{	//Import lead voice only
 				importvoice = 1;
@@ -5302,9 +5397,9 @@ int eof_gp_import_track(DIALOG * d)
 	if(eof_parsed_gp_file->instrument_types[selected] == 3)
 	{	//If this is a drum track
 		eof_clear_input();
-		if(alert(NULL, "Import the selected track as a drum track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Import the selected track as a drum track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to import this drum track as a drum track
-			int ret = alert3(NULL, "Import into which drum track(s)?", NULL, "&Normal", "&Phase Shift", "&Both", 'n', 'p', 'b');
+			int ret = eof_alert3(NULL, "Import into which drum track(s)?", NULL, "&Normal", "&Phase Shift", "&Both", 'n', 'p', 'b');
 
 			return eof_gp_import_drum_track(importvoice, ret);
 		}
@@ -5335,7 +5430,7 @@ int eof_gp_import_common(const char *fn)
 		if(eof_parsed_gp_file->text_events)
 		{	//If there were text events imported
 			eof_clear_input();
-			if(alert(NULL, "Import Guitar Pro file's section markers/beat text as Rocksmith phrases/sections?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Import Guitar Pro file's section markers/beat text as Rocksmith phrases/sections?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to import RS phrases and sections from GP files
 				if(!gp_import_undo_made)
 				{	//If an undo state hasn't been made yet
@@ -5355,9 +5450,28 @@ int eof_gp_import_common(const char *fn)
 			eof_sort_events(eof_song);
 		}
 
-		eof_color_dialog(eof_gp_import_dialog, gui_fg_color, gui_bg_color);
-		centre_dialog(eof_gp_import_dialog);
-		(void) eof_popup_dialog(eof_gp_import_dialog, 0);	//Launch the dialog to allow the user to import a track
+		if(eof_batch_mode)
+		{	//If converting in batch mode, import the first GP track of the active track's instrument type (or the first track) instead of prompting
+			char type = ((eof_selected_track == EOF_TRACK_PRO_BASS) || (eof_selected_track == EOF_TRACK_PRO_BASS_22)) ? 2 : 1;
+
+			eof_gp_import_dialog[1].d1 = 0;
+			for(ctr = 0; ctr < eof_parsed_gp_file->numtracks; ctr++)
+			{	//For each track parsed from the Guitar Pro file
+				if(eof_parsed_gp_file->instrument_types[ctr] == type)
+				{
+					eof_gp_import_dialog[1].d1 = (int)ctr;
+					break;
+				}
+			}
+			if(eof_parsed_gp_file->numtracks)
+				(void) eof_gp_import_track(&eof_gp_import_dialog[1]);
+		}
+		else
+		{
+			eof_color_dialog(eof_gp_import_dialog, gui_fg_color, gui_bg_color);
+			centre_dialog(eof_gp_import_dialog);
+			(void) eof_popup_dialog(eof_gp_import_dialog, 0);	//Launch the dialog to allow the user to import a track
+		}
 		eof_cursor_visible = 1;
 		eof_pen_visible = 1;
 		eof_show_mouse(NULL);
@@ -5374,7 +5488,7 @@ int eof_gp_import_common(const char *fn)
 			{	//For each tech note in the track
 				free(eof_parsed_gp_file->track[ctr]->technote[ctr2]);	//Free its memory
 			}
-			free(eof_parsed_gp_file->track[ctr]);	//Free the pro guitar track
+			eof_free_pro_guitar_track(eof_parsed_gp_file->track[ctr]);	//Free the pro guitar track
 		}
 		free(eof_parsed_gp_file->names);
 		free(eof_parsed_gp_file->track);
@@ -5390,7 +5504,7 @@ int eof_gp_import_common(const char *fn)
 				{	//If the tremolo was successfully found
 					if(ptr->difficulty == eof_note_type)
 					{	//If the tremolo phrase is specific to the active track, it was newly imported
-						if(alert(NULL, "Remove the track difficulty limit to show imported tremolo phrases?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+						if(eof_alert(NULL, "Remove the track difficulty limit to show imported tremolo phrases?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 						{	//If the user opts to remove the track difficulty limit
 							(void) eof_track_rocksmith_toggle_difficulty_limit();
 						}
@@ -5402,7 +5516,7 @@ int eof_gp_import_common(const char *fn)
 	}//The file was successfully parsed...
 	else
 	{
-		allegro_message("Failure.  Check log for details.");
+		eof_message("Failure.  Check log for details.");
 		return 1;	//Return failure
 	}
 
@@ -5632,14 +5746,14 @@ int eof_set_3d_hopo_scale_size(void)
 
 			if((percent < 10) || (percent > 200))
 			{
-				allegro_message("Invalid scale size.");
+				eof_message("Invalid scale size.");
 				return 0;
 			}
 
 			eof_3d_hopo_scale_size = percent;
 			if(!eof_load_and_scale_hopo_images((double)eof_3d_hopo_scale_size / 100.0))
 			{
-				allegro_message("Error reloading HOPO images.  EOF must exit, please save if necessary.");
+				eof_message("Error reloading HOPO images.  EOF must exit, please save if necessary.");
 				(void) eof_menu_file_exit();
 			}
 		}
@@ -5740,7 +5854,7 @@ int eof_rs_import_common(char *fn)
 			eof_erase_track(eof_song, eof_selected_track);	//Delete all notes, tech notes, etc.
 			tp->parent = eof_song->pro_guitar_track[tracknum]->parent;
 			tp->parent->flags |= EOF_TRACK_FLAG_UNLIMITED_DIFFS;	//Remove the difficulty limit for this track
-			free(eof_song->pro_guitar_track[tracknum]);	//Free the active track
+			eof_free_pro_guitar_track(eof_song->pro_guitar_track[tracknum]);	//Free the active track
 			eof_song->pro_guitar_track[tracknum] = tp;	//Replace it with the track imported from the Rocksmith file
 
 			eof_log("Cleaning up beats", 1);
@@ -5756,7 +5870,7 @@ int eof_rs_import_common(char *fn)
 		}
 		else
 		{
-			allegro_message("Failure.  Check log for details.");
+			eof_message("Failure.  Check log for details.");
 			return 1;	//Return failure
 		}
 	}
@@ -5788,7 +5902,7 @@ int eof_menu_file_rs_import(void)
 			return 1;	//Don't do anything unless the active track is a pro guitar/bass track
 
 		eof_clear_input();
-		if(eof_get_track_size_all(eof_song, eof_selected_track) && alert("This track already has notes", "Importing this Rocksmith track will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_get_track_size_all(eof_song, eof_selected_track) && eof_alert("This track already has notes", "Importing this Rocksmith track will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the active track is already populated (by either normal or tech notes) and the user doesn't opt to overwrite it
 			return 0;
 		}
@@ -5916,7 +6030,7 @@ int eof_menu_file_sonic_visualiser_import(void)
 	if(eof_song->tags->tempo_map_locked)
 	{	//If the user has locked the tempo map
 		eof_clear_input();
-		if(alert(NULL, "The tempo map must be unlocked in order to import a Sonic Visualiser file.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "The tempo map must be unlocked in order to import a Sonic Visualiser file.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to unlock the tempo map
 			eof_log("\tUser cancellation.  Aborting", 1);
 			return 1;
@@ -5977,8 +6091,7 @@ int eof_menu_file_sonic_visualiser_import(void)
 	while(!error && !done && !pack_feof(inf))
 	{	//Until there was an error reading from the file or end of file is reached
 		#ifdef RS_IMPORT_DEBUG
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tProcessing line #%lu", linectr);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\tProcessing line #%lu", linectr);
 		#endif
 
 		//Separate the line into the opening XML tag (buffer) and the content between the opening and closing tag (buffer2)
@@ -6123,7 +6236,7 @@ int eof_menu_file_sonic_visualiser_import(void)
 		{	//If an undo state was made
 			(void) eof_undo_apply();	//Load it
 		}
-		allegro_message("Sonic Visualiser import failed, see log for details.");
+		eof_message("Sonic Visualiser import failed, see log for details.");
 	}
 	else
 	{
@@ -6205,7 +6318,7 @@ int eof_menu_file_bf_import(void)
 		}
 		else
 		{
-			allegro_message("Failure.  Check log for details.");
+			eof_message("Failure.  Check log for details.");
 			eof_log("\tImport failed", 1);
 		}
 	}
@@ -6356,7 +6469,7 @@ int eof_menu_file_export_audio_range(void)
 		if(exists(oggpath))
 		{	//If the specified file path already exists
 			eof_clear_input();
-			if(alert(NULL, "The specified audio file already exists.  Overwrite?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert(NULL, "The specified audio file already exists.  Overwrite?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 			{	//If the user does not opt to overwrite the file
 				return 0;	//Cancel
 			}
@@ -6399,7 +6512,7 @@ int eof_menu_file_export_guitar_pro(void)
 	//Ensure RocksmithToTab is linked
 	if(!exists(eof_rs_to_tab_executable_path))
 	{	//If the path to RocksmithToTab is not defined or otherwise doesn't refer to a valid file
-		retval = alert3("RocksmithToTab is not properly linked", "First download and extract the program", "Then use \"File>Link to RocksmithToTab\" to browse to the program", "OK", "Download", "Link", 0, 0, 0);
+		retval = eof_alert3("RocksmithToTab is not properly linked", "First download and extract the program", "Then use \"File>Link to RocksmithToTab\" to browse to the program", "OK", "Download", "Link", 0, 0, 0);
 		if(retval == 2)
 		{	//If the user opted to download the program
 			(void) eof_system("start https://sourceforge.net/projects/rocksmithtotab/");
@@ -6528,7 +6641,7 @@ int eof_menu_file_export_song_preview(void)
 	{	//If no chart audio is loaded
 		return 1;
 	}
-	if(alert(NULL, "Generate preview audio files?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+	if(eof_alert(NULL, "Generate preview audio files?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 	{	//If the user declined to generate audio files
 		return 1;
 	}
@@ -6607,7 +6720,7 @@ void eof_rebuild_notes_window(void)
 	}
 	if(!eof_window_notes)
 	{
-		allegro_message("Unable to create notes window!");
+		eof_message("Unable to create notes window!");
 		eof_enable_notes_panel = 0;
 	}
 	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tNew notes panel window instance:  0x%p", eof_window_notes);
@@ -6655,7 +6768,7 @@ int eof_display_notes_panel_logic(int builtin)
 		eof_notes_panel = eof_create_text_panel(effective_target, builtin);	//Reload the active Notes panel file, recover panel file from eof.dat if necessary
 		if(eof_notes_panel == NULL)
 		{	//Could not buffer file
-			allegro_message("Error opening Notes panel file");
+			eof_message("Error opening Notes panel file");
 			eof_enable_notes_panel = 0;
 			return 1;
 		}
@@ -6887,7 +7000,7 @@ int eof_menu_file_array_txt_import(void)
 		{
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError %d", retval);
 			eof_log(eof_log_string, 1);
-			allegro_message("Import failed (error %u).", retval);
+			eof_message("Import failed (error %u).", retval);
 		}
 		else
 		{
@@ -6932,7 +7045,7 @@ int eof_menu_file_multiple_array_txt_import(void)
 		done = al_findfirst(searchpath, &info, FA_ALL);
 		if(done)
 		{	//If no file matches are found
-			allegro_message("\tNo .txt files were found at this path.");
+			eof_message("\tNo .txt files were found at this path.");
 			empty_set = 1;
 		}
 
@@ -6947,7 +7060,7 @@ int eof_menu_file_multiple_array_txt_import(void)
 			{
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tError %d", retval);
 				eof_log(eof_log_string, 1);
-				allegro_message("Import failed (error %u).", retval);
+				eof_message("Import failed (error %u).", retval);
 			}
 			else
 			{
@@ -6966,7 +7079,7 @@ int eof_menu_file_multiple_array_txt_import(void)
 		eof_log(eof_log_string, 1);
 
 		if(!count)
-			allegro_message("No files were imported.");
+			eof_message("No files were imported.");
 
 		if(!empty_set)
 		{	//If there were any file search results
@@ -6998,7 +7111,7 @@ int eof_menu_file_gh3_section_import(void)
 	fb = eof_filebuffer_load(sectionfn);
 	if(fb == NULL)
 	{	//Section names file failed to buffer
-		allegro_message("Error:  Failed to buffer section name file");
+		eof_message("Error:  Failed to buffer section name file");
 	}
 
 	//Import sections
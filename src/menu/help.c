@@ -43,7 +43,7 @@ int eof_menu_help_keys(void)
 	eof_help_text = eof_buffer_file("keys.txt", 1);	//Buffer the help file into memory, appending a NULL terminator
 	if(eof_help_text == NULL)
 	{	//Could not buffer file
-		allegro_message("Error reading keys.txt");
+		eof_message("Error reading keys.txt");
 		return 1;
 	}
 
@@ -153,7 +153,7 @@ int eof_menu_help_about(void)
 	eof_cursor_visible = 0;
 	eof_pen_visible = 0;
 	eof_render();
-	(void) alert(EOF_VERSION_STRING, NULL, EOF_COPYRIGHT_STRING, "Okay", NULL, KEY_ENTER, 0);
+	(void) eof_alert(EOF_VERSION_STRING, NULL, EOF_COPYRIGHT_STRING, "Okay", NULL, KEY_ENTER, 0);
 	eof_clear_input();
 	eof_show_mouse(NULL);
 	eof_cursor_visible = 1;
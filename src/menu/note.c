@@ -1329,7 +1329,7 @@ void eof_prepare_note_menu(void)
 		if(note_selection_updated)
 		{	//If the only note modified was the seek hover note
 			eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-			eof_selection.current = EOF_MAX_NOTES - 1;
+			eof_selection.current = EOF_NO_NOTE_SELECTED;
 		}
 
 		/* Note>Clone Hero */
@@ -1436,7 +1436,7 @@ int eof_menu_note_transpose_up(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1503,7 +1503,7 @@ int eof_menu_note_transpose_down(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1534,7 +1534,7 @@ int eof_menu_note_transpose_up_octave(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1565,7 +1565,7 @@ int eof_menu_note_transpose_down_octave(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1629,7 +1629,7 @@ int eof_menu_note_resnap_logic(int any)
 				if(!note1ghosted && !note2ghosted)
 				{	//As long as neither note being merged is fully ghosted, warn the user
 					eof_seek_and_render_position(eof_selected_track, eof_note_type, notepos);
-					if(alert("Warning: One or more notes/lyrics will snap to the same position", "and will be automatically combined.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+					if(eof_alert("Warning: One or more notes/lyrics will snap to the same position", "and will be automatically combined.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 					{	//If user opts opts to cancel the operation
 						cancel = 1;
 					}
@@ -1673,7 +1673,7 @@ int eof_menu_note_resnap_logic(int any)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1794,7 +1794,7 @@ int eof_menu_note_toggle_green(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1838,7 +1838,7 @@ int eof_menu_note_toggle_red(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1893,7 +1893,7 @@ int eof_menu_note_toggle_yellow(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -1948,7 +1948,7 @@ int eof_menu_note_toggle_blue(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2003,7 +2003,7 @@ int eof_menu_note_toggle_purple(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2063,7 +2063,7 @@ int eof_menu_note_toggle_orange(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2120,7 +2120,7 @@ int eof_menu_note_clear_green(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2177,7 +2177,7 @@ int eof_menu_note_clear_red(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2234,7 +2234,7 @@ int eof_menu_note_clear_yellow(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2291,7 +2291,7 @@ int eof_menu_note_clear_blue(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2348,7 +2348,7 @@ int eof_menu_note_clear_purple(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2411,7 +2411,7 @@ int eof_menu_note_clear_orange(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2453,7 +2453,7 @@ int eof_menu_note_toggle_accent_lane(unsigned int lanenum)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2525,7 +2525,7 @@ int eof_menu_note_clear_accent_lane(unsigned int lanenum)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2590,7 +2590,7 @@ int eof_menu_note_clear_accent_all(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2632,7 +2632,7 @@ int eof_menu_note_toggle_ghost_lane(unsigned int lanenum)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2704,7 +2704,7 @@ int eof_menu_note_clear_ghost_lane(unsigned int lanenum)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2769,7 +2769,7 @@ int eof_menu_note_clear_ghost_all(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2827,7 +2827,7 @@ int eof_menu_note_toggle_crazy(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2881,7 +2881,7 @@ int eof_menu_note_remove_crazy(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2914,7 +2914,7 @@ int eof_menu_note_toggle_double_bass(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2950,7 +2950,7 @@ int eof_menu_note_remove_double_bass(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3010,7 +3010,7 @@ int eof_menu_note_toggle_rb3_cymbal_green_logic(int function, char *undo_made)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3082,7 +3082,7 @@ int eof_menu_note_toggle_rb3_cymbal_yellow_logic(int function, char *undo_made)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3154,7 +3154,7 @@ int eof_menu_note_toggle_rb3_cymbal_blue_logic(int function, char *undo_made)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3221,7 +3221,7 @@ int eof_menu_note_remove_cymbal(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3385,7 +3385,7 @@ int eof_menu_split_lyric(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return D_O_K;
 }
@@ -3423,7 +3423,7 @@ int eof_menu_solo_mark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	eof_determine_phrase_status(eof_song, eof_selected_track);
 	return 1;
@@ -3454,7 +3454,7 @@ int eof_menu_solo_unmark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	eof_determine_phrase_status(eof_song, eof_selected_track);
 	return 1;
@@ -3463,7 +3463,7 @@ int eof_menu_solo_unmark(void)
 int eof_menu_solo_erase_all(void)
 {
 	eof_clear_input();
-	if(eof_get_num_solos(eof_song, eof_selected_track) && (alert(NULL, "Erase all solos from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1))
+	if(eof_get_num_solos(eof_song, eof_selected_track) && (eof_alert(NULL, "Erase all solos from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1))
 	{	//If the active track has solos and the user opts to delete them
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		eof_set_num_solos(eof_song, eof_selected_track, 0);
@@ -3526,7 +3526,7 @@ int eof_menu_star_power_mark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3557,7 +3557,7 @@ int eof_menu_star_power_unmark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3565,7 +3565,7 @@ int eof_menu_star_power_unmark(void)
 int eof_menu_star_power_erase_all(void)
 {
 	eof_clear_input();
-	if(eof_get_num_star_power_paths(eof_song, eof_selected_track) && (alert(NULL, "Erase all star power from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1))
+	if(eof_get_num_star_power_paths(eof_song, eof_selected_track) && (eof_alert(NULL, "Erase all star power from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1))
 	{	//If the active track has star power sections and the user opts to delete them
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		eof_set_num_star_power_paths(eof_song, eof_selected_track, 0);
@@ -3635,7 +3635,7 @@ int eof_menu_lyric_line_mark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3669,7 +3669,7 @@ int eof_menu_lyric_line_unmark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3682,7 +3682,7 @@ int eof_menu_lyric_line_erase_all(void)
 		return 1;
 
 	eof_clear_input();
-	if(alert(NULL, "Erase all lyric lines?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Erase all lyric lines?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		eof_song->vocal_track[tracknum]->lines = 0;
@@ -3737,7 +3737,7 @@ int eof_menu_lyric_line_toggle_overdrive(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3779,7 +3779,7 @@ int eof_menu_hopo_auto(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3848,7 +3848,7 @@ int eof_menu_hopo_cycle(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3892,7 +3892,7 @@ int eof_menu_hopo_force_on(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3934,7 +3934,7 @@ int eof_menu_hopo_force_off(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -3974,7 +3974,7 @@ int eof_menu_note_toggle_flag(unsigned char function, unsigned char track_format
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -4024,7 +4024,7 @@ int eof_menu_note_clear_flag(unsigned char function, unsigned char track_format,
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -4125,7 +4125,7 @@ int eof_transpose_possible(int dir)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return retval;
 }
@@ -4163,7 +4163,7 @@ int eof_new_lyric_dialog(void)
 		eof_selection.current_pos = new_lyric->pos;
 		eof_selection.range_pos_1 = eof_selection.current_pos;
 		eof_selection.range_pos_2 = eof_selection.current_pos;
-		memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+		memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 		eof_track_sort_notes(eof_song, eof_selected_track);
 		eof_track_fixup_notes(eof_song, eof_selected_track, 0);
 		eof_enforce_lyric_gap_multiplier(eof_song, eof_selected_track, eof_selection.current);		//Enforce the variable note gap on the lyric before the new lyric, if appropriate
@@ -4222,7 +4222,7 @@ int eof_edit_lyric_dialog(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return D_O_K;
 }
@@ -4269,7 +4269,7 @@ int eof_menu_set_freestyle(char status)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -4307,7 +4307,7 @@ int eof_menu_toggle_freestyle(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -4340,7 +4340,7 @@ int eof_menu_lyric_remove_pitch(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -4452,10 +4452,10 @@ int eof_menu_note_edit_pro_guitar_note(void)
 	unsigned char ghostmask;		//Used to build the updated ghost bitmask
 	unsigned long flags;			//Used to build the updated flag bitmask
 	unsigned long eflags;			//Used to build the updated extended flag bitmask
-	char *newname = NULL, *tempptr;
+	const char *newname = NULL, *tempptr;
 	char autoprompt[100] = {0};
 	char previously_refused;
-	char declined_list[EOF_MAX_NOTES] = {0};	//This lists all notes whose names/legacy bitmasks the user declined to have applied to the edited note
+	char *declined_list;	//This lists all notes whose names/legacy bitmasks the user declined to have applied to the edited note, sized to the track
 	char autobitmask[10] = {0};
 	unsigned long index = 0;
 	char pro_guitar_string[30] = {0};
@@ -4796,7 +4796,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 				{	//For each character in the name field
 					if((eof_note_edit_name[i] == '[') || (eof_note_edit_name[i] == ']'))
 					{	//If the character is a bracket
-						allegro_message("You cannot use a bracket in the note's name");
+						eof_message("You cannot use a bracket in the note's name");
 						eof_show_mouse(NULL);
 						eof_cursor_visible = 1;
 						eof_pen_visible = 1;
@@ -4812,13 +4812,13 @@ int eof_menu_note_edit_pro_guitar_note(void)
 				eof_clear_input();
 				if(!dont_ask)
 				{	//If the user didn't suppress this prompt
-					retval2 = alert3(NULL, "Warning:  This information will be applied to all selected notes.", NULL, "&OK", "&Cancel", "OK, don't ask again", 'y', 'n', 0);
+					retval2 = eof_alert3(NULL, "Warning:  This information will be applied to all selected notes.", NULL, "&OK", "&Cancel", "OK, don't ask again", 'y', 'n', 0);
 					if(retval2 == 2)
 					{	//If user opts to cancel the operation
 						if(note_selection_updated)
 						{	//If the only note modified was the seek hover note
 							eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-							eof_selection.current = EOF_MAX_NOTES - 1;
+							eof_selection.current = EOF_NO_NOTE_SELECTED;
 						}
 						eof_show_mouse(NULL);
 						eof_cursor_visible = 1;
@@ -4845,7 +4845,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 						undo_made = 1;
 					}
-					memcpy(tp->note[i]->name, eof_note_edit_name, sizeof(eof_note_edit_name));
+					tp->note[i]->name = eof_intern_note_name(eof_note_edit_name);
 					(void) eof_rs_check_chord_name(eof_song, eof_selected_track, eof_selection.current, 0);	//Check if the user included lowercase "maj" in the name
 				}
 
@@ -5140,7 +5140,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						continue;	//If this note doesn't match the one that was edited, or if the name is already the same, skip it
 
 					eof_clear_input();
-					if(alert(NULL, "Update other matching notes in this track to have the same name?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "Update other matching notes in this track to have the same name?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user opts to use the updated note name on matching notes in this track
 						for(; ctr < eof_get_track_size(eof_song, eof_selected_track); ctr++)
 						{	//For each note in the active track, starting from the one that just matched the comparison
@@ -5151,7 +5151,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 									eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 									undo_made = 1;
 								}
-								(void) ustrcpy(eof_get_note_name(eof_song, eof_selected_track, ctr), eof_note_edit_name);
+								eof_set_note_name(eof_song, eof_selected_track, ctr, eof_note_edit_name);
 							}
 						}
 					}
@@ -5162,8 +5162,8 @@ int eof_menu_note_edit_pro_guitar_note(void)
 	//Or prompt whether the selected notes' name should be updated from the other existing notes
 			else
 			{	//The user did not enter a name
-				memset(declined_list, 0, sizeof(declined_list));	//Clear the declined list
-				for(ctr = 0; ctr < eof_get_track_size(eof_song, eof_selected_track); ctr++)
+				declined_list = calloc((size_t)eof_get_track_size(eof_song, eof_selected_track) + 1, 1);	//Allocate a cleared declined list
+				for(ctr = 0; declined_list && (ctr < eof_get_track_size(eof_song, eof_selected_track)); ctr++)
 				{	//For each note in the active track
 					if((ctr == eof_selection.current) || (eof_note_compare_simple(eof_song, eof_selected_track, eof_selection.current, ctr) != 0))
 						continue;	//If this note is the one that was just edited, or if it doesn't match the latter, skip it
@@ -5193,7 +5193,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						(void) snprintf(autoprompt, sizeof(autoprompt) - 1, "Set selected notes' name to \"%s\"?",newname);
 					}
 					eof_clear_input();
-					if(alert(NULL, autoprompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, autoprompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user opts to assign this note's name to the selected notes
 						for(ctr2 = 0; ctr2 < eof_get_track_size(eof_song, eof_selected_track); ctr2++)
 						{	//For each note in the track
@@ -5207,7 +5207,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 										eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 										undo_made = 1;
 									}
-									(void) ustrcpy(tempptr, newname);	//Update the note's name to the user selection
+									eof_set_note_name(eof_song, eof_selected_track, ctr2, newname);	//Update the note's name to the user selection
 								}
 							}
 						}
@@ -5218,6 +5218,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						declined_list[ctr] = 1;	//Mark this note's name as having been declined
 					}
 				}//For each note in the active track
+				free(declined_list);
 			}//The user did not enter a name
 
 	//Prompt whether matching notes need to have their legacy bitmask updated
@@ -5231,7 +5232,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						continue;	//If the two notes have the same legacy bitmask, skip it
 
 					eof_clear_input();
-					if(alert(NULL, "Update other matching notes in this track difficulty to have the same legacy bitmask?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "Update other matching notes in this track difficulty to have the same legacy bitmask?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user opts to use the updated note legacy bitmask on matching notes in this track difficulty
 						for(; ctr < eof_get_track_size(eof_song, eof_selected_track); ctr++)
 						{	//For each note in the active track, starting from the one that just matched the comparison
@@ -5253,8 +5254,8 @@ int eof_menu_note_edit_pro_guitar_note(void)
 	//Or prompt whether the selected notes' legacy bitmask should be updated from the other existing notes
 			else
 			{	//The user did not enter a legacy bitmask
-				memset(declined_list, 0, sizeof(declined_list));	//Clear the declined list
-				for(ctr = 0; ctr < eof_get_track_size(eof_song, eof_selected_track); ctr++)
+				declined_list = calloc((size_t)eof_get_track_size(eof_song, eof_selected_track) + 1, 1);	//Allocate a cleared declined list
+				for(ctr = 0; declined_list && (ctr < eof_get_track_size(eof_song, eof_selected_track)); ctr++)
 				{	//For each note in the active track
 					if((ctr == eof_selection.current) || (eof_note_compare_simple(eof_song, eof_selected_track, eof_selection.current, ctr) != 0))
 						continue;	//If this note is the one that was just edited, or it doesn't match the latter, skip it
@@ -5293,7 +5294,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						(void) snprintf(autoprompt, sizeof(autoprompt) - 1, "Set selected notes' legacy bitmask to \"%s\"?",autobitmask);
 					}
 					eof_clear_input();
-					if(alert(NULL, autoprompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert(NULL, autoprompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user opts to assign this note's legacy bitmask to the edited note
 						for(ctr2 = 0; ctr2 < eof_get_track_size(eof_song, eof_selected_track); ctr2++)
 						{	//For each note in the track
@@ -5317,6 +5318,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 						declined_list[ctr] = 1;	//Mark this note's name as having been declined
 					}
 				}//For each note in the active track
+				free(declined_list);
 			}//The user did not enter a legacy bitmask
 			if(retval == 56)
 			{	//If the user clicked Apply, re-render the screen to reflect any changes made
@@ -5325,7 +5327,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 		}//If user clicked OK or Apply
 		else if(retval == 54)
 		{	//If user clicked <- (previous note)
-			memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+			memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 			eof_selection.current = previous_note;	//Set the previous note as the currently selected note
 			eof_selection.multi[previous_note] = 1;	//Ensure the note selection includes the previous note
 			eof_set_seek_position(eof_get_note_pos(eof_song, eof_selected_track, previous_note) + eof_av_delay);	//Seek to previous note
@@ -5334,7 +5336,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 		}
 		else if(retval == 58)
 		{	//If user clicked -> (next note)
-			memset(eof_selection.multi, 0, sizeof(eof_selection.multi));	//Clear the selected notes array
+			memset(eof_selection.multi, 0, eof_selection.multi_size);	//Clear the selected notes array
 			eof_selection.current = next_note;	//Set the next note as the currently selected note
 			eof_selection.multi[next_note] = 1;	//Ensure the note selection includes the next note
 			eof_set_seek_position(eof_get_note_pos(eof_song, eof_selected_track, next_note) + eof_av_delay);	//Seek to next note
@@ -5348,7 +5350,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 		if(highfretvalue > tp->numfrets)
 		{	//If the user input includes a fret value that exceeds the track's current maximum
 			(void) snprintf(eof_etext, sizeof(eof_etext) - 1, "Increase the fret limit to %ld to compensate?", highfretvalue);
-			if(alert("One or more fret values specified exceed the track's fret limit", eof_etext, NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("One or more fret values specified exceed the track's fret limit", eof_etext, NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If user opts to increase the fret limit
 				tp->numfrets = highfretvalue;
 			}
@@ -5362,7 +5364,7 @@ int eof_menu_note_edit_pro_guitar_note(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -5580,7 +5582,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 						{	//If the value doesn't indicate that it is played open or muted
 							if(eof_finger_strings[i][0] == '\0')
 							{	//If no finger value is given
-								allegro_message("If any fingering is specified, it must be done for all fretted strings.\nCorrect or erase the finger numbers before clicking OK.");
+								eof_message("If any fingering is specified, it must be done for all fretted strings.\nCorrect or erase the finger numbers before clicking OK.");
 								retry = 1;	//Flag that the user must enter valid finger information
 								break;
 							}
@@ -5589,7 +5591,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 						{	//The string is played open or muted
 							if(((eof_finger_strings[i][0] != '\0') && (toupper(eof_finger_strings[i][0]) != 'X')) && (eof_pro_guitar_note_frets_dialog[27 - i].flags != D_SELECTED))
 							{	//If the inputs don't indicate muting
-								allegro_message("If any fingering is specified, it must be done for all fretted strings.\nCorrect or erase the finger numbers before clicking OK.");
+								eof_message("If any fingering is specified, it must be done for all fretted strings.\nCorrect or erase the finger numbers before clicking OK.");
 								retry = 1;
 								break;
 							}
@@ -5599,7 +5601,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 					{	//There is no fret value defined
 						if(eof_finger_strings[i][0] != '\0')
 						{	//If there is a fingering defined
-							allegro_message("If any fingering is specified, it must be done only for the fretted strings.\nCorrect or erase the finger numbers before clicking OK.");
+							eof_message("If any fingering is specified, it must be done only for the fretted strings.\nCorrect or erase the finger numbers before clicking OK.");
 							retry = 1;
 							break;
 						}
@@ -5615,13 +5617,13 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 					eof_clear_input();
 					if(!dont_ask)
 					{	//If the user didn't suppress this prompt
-						retval = alert3(NULL, "Warning:  This information will be applied to all selected notes.", NULL, "&OK", "&Cancel", "OK, don't ask again", 'y', 'n', 0);
+						retval = eof_alert3(NULL, "Warning:  This information will be applied to all selected notes.", NULL, "&OK", "&Cancel", "OK, don't ask again", 'y', 'n', 0);
 						if(retval == 2)
 						{	//If user opts to cancel the operation
 							if(note_selection_updated)
 							{	//If the only note modified was the seek hover note
 								eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-								eof_selection.current = EOF_MAX_NOTES - 1;
+								eof_selection.current = EOF_NO_NOTE_SELECTED;
 							}
 							eof_show_mouse(NULL);
 							eof_cursor_visible = 1;
@@ -5794,7 +5796,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 						}
 					}
 					eof_clear_input();
-					if(function || (offerupdatefingering && (alert(NULL, "Update all instances of this note to use this fingering?", NULL, "&Yes", "&No", 'y', 'n') == 1)))
+					if(function || (offerupdatefingering && (eof_alert(NULL, "Update all instances of this note to use this fingering?", NULL, "&Yes", "&No", 'y', 'n') == 1)))
 					{	//If the user opts to update the fingering array of all matching notes (or if the calling function wanted all instances to be updated automatically)
 						for(trackctr = 1; trackctr < eof_song->tracks; trackctr++)
 						{	//For each track in the project
@@ -5831,7 +5833,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 				if(highfretvalue > tp->numfrets)
 				{	//If the user input includes a fret value that exceeds the track's current maximum
 					(void) snprintf(eof_etext, sizeof(eof_etext) - 1, "Increase the fret limit to %ld to compensate?", highfretvalue);
-					if(alert("One or more fret values specified exceed the track's fret limit", eof_etext, NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("One or more fret values specified exceed the track's fret limit", eof_etext, NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to increase the fret limit
 						tp->numfrets = highfretvalue;
 					}
@@ -5848,7 +5850,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 			if(note_selection_updated)
 			{	//If the only note modified was the seek hover note
 				eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-				eof_selection.current = EOF_MAX_NOTES - 1;
+				eof_selection.current = EOF_NO_NOTE_SELECTED;
 			}
 			return 0;	//Return Cancel selected
 		}
@@ -5860,7 +5862,7 @@ int eof_menu_note_edit_pro_guitar_note_frets_fingers(char function, char *undo_m
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;	//Return OK selected
 }
@@ -5892,7 +5894,7 @@ int eof_correct_chord_fingerings_option(char report, char *undo_made)
 		user_prompted = 1;	//Suppress asking to make changes since the user already gave intention to make any needed corrections
 	}
 	eof_song_fix_fingerings(eof_song, undo_made);		//Erase partial note fingerings, replicate valid finger definitions to matching notes without finger definitions
-	memset(&eof_selection, 0, sizeof(EOF_SELECTION_DATA));	//Clear the note selection
+	eof_selection_reset();	//Clear the note selection
 	for(ctr = 1; ctr < eof_song->tracks; ctr++)
 	{	//For each track (skipping the global track, 0)
 		if(eof_song->track[ctr]->track_format != EOF_PRO_GUITAR_TRACK_FORMAT)
@@ -5916,7 +5918,7 @@ int eof_correct_chord_fingerings_option(char report, char *undo_made)
 			if(!user_prompted)
 			{	//If the user hasn't been prompted whether to update the fingering (or if the prompt hasn't been suppressed)
 				eof_clear_input();
-				if(alert("One or more chords don't have correct finger information", "Update them now?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+				if(eof_alert("One or more chords don't have correct finger information", "Update them now?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 				{	//If the user does not opt to update the fingering
 					eof_menu_track_set_tech_view_state(eof_song, eof_selected_track, restore_tech_view); //Re-enable tech view if applicable
 					return 0;
@@ -5930,7 +5932,7 @@ int eof_correct_chord_fingerings_option(char report, char *undo_made)
 			}
 			if(!auto_complete && result)
 			{	//If the user hasn't been prompted whether to use the chord definitions yet, and the chord's fingering CAN be automatically applied
-				if(alert(NULL, "Automatically apply fingerings for known chord shapes?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+				if(eof_alert(NULL, "Automatically apply fingerings for known chord shapes?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 				{	//If the user declines using the chord shape definitions
 					auto_complete = 2;	//Remember a no answer
 				}
@@ -5957,7 +5959,7 @@ int eof_correct_chord_fingerings_option(char report, char *undo_made)
 				eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);	//Show the offending note
 				cancelled = !eof_menu_note_edit_pro_guitar_note_frets_fingers(1, undo_made);	//Open the edit fret/finger dialog where only the necessary finger fields can be altered
 				eof_selection.multi[ctr2] = 0;	//Unselect this note
-				eof_selection.current = EOF_MAX_NOTES - 1;
+				eof_selection.current = EOF_NO_NOTE_SELECTED;
 				if(cancelled)
 				{	//If the user canceled updating the chord fingering
 					eof_menu_track_set_tech_view_state(eof_song, eof_selected_track, restore_tech_view); //Re-enable tech view if applicable
@@ -5969,7 +5971,7 @@ int eof_correct_chord_fingerings_option(char report, char *undo_made)
 	}//For each track (skipping the global track, 0)
 	if(report && !(*undo_made))
 	{	//If no alterations were necessary and the calling function wanted this reported
-		allegro_message("All fingerings are already defined");
+		eof_message("All fingerings are already defined");
 	}
 	return 1;
 }
@@ -6013,7 +6015,7 @@ int eof_menu_note_toggle_tapping(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6050,7 +6052,7 @@ int eof_menu_note_remove_tapping(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6144,7 +6146,7 @@ int eof_menu_note_toggle_bend_logic(int function)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6199,7 +6201,7 @@ int eof_menu_note_remove_bend(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6268,7 +6270,7 @@ int eof_menu_note_toggle_slide_up(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6327,7 +6329,7 @@ int eof_menu_note_toggle_slide_down(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6368,7 +6370,7 @@ int eof_menu_note_remove_slide(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6414,7 +6416,7 @@ int eof_menu_note_reverse_slide(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6492,12 +6494,12 @@ int eof_menu_note_convert_slide_to_unpitched(void)
 	}
 	if(skipped)
 	{	//If at least one slide note was skipped
-		allegro_message("%lu slide note%s skipped during conversion since a usable end of slide position could not be defined.\nThe offending note%s been highlighted.", skipped, ((skipped == 1) ? " was" : "s were"), ((skipped == 1) ? " has" : "s have"));
+		eof_message("%lu slide note%s skipped during conversion since a usable end of slide position could not be defined.\nThe offending note%s been highlighted.", skipped, ((skipped == 1) ? " was" : "s were"), ((skipped == 1) ? " has" : "s have"));
 	}
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6555,7 +6557,7 @@ int eof_menu_note_convert_slide_to_pitched(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6589,7 +6591,7 @@ int eof_menu_note_toggle_palm_muting(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6623,7 +6625,7 @@ int eof_menu_note_remove_palm_muting(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6708,7 +6710,7 @@ int eof_menu_arpeggio_mark_logic(int handshape)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	eof_track_fixup_notes(eof_song, eof_selected_track, 1);	//Run the fixup logic immediately in order to correct the arpeggio's base chord
 	return 1;
@@ -6764,7 +6766,7 @@ int eof_menu_arpeggio_unmark_logic(int handshape)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6803,7 +6805,7 @@ int eof_menu_arpeggio_erase_all(void)
 		return 1;	//Do not allow this function to run unless a pro guitar track is active
 
 	eof_clear_input();
-	if(alert(NULL, "Erase all arpeggios from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Erase all arpeggios from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		tracknum = eof_song->track[eof_selected_track]->tracknum;
 		tp = eof_song->pro_guitar_track[tracknum];
@@ -6829,7 +6831,7 @@ int eof_menu_handshape_erase_all(void)
 		return 1;	//Do not allow this function to run unless a pro guitar track is active
 
 	eof_clear_input();
-	if(alert(NULL, "Erase all handshape phrases from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Erase all handshape phrases from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		tracknum = eof_song->track[eof_selected_track]->tracknum;
 		tp = eof_song->pro_guitar_track[tracknum];
@@ -6886,7 +6888,7 @@ int eof_menu_trill_mark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6946,7 +6948,7 @@ int eof_menu_tremolo_mark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -6992,7 +6994,7 @@ int eof_menu_slider_mark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7032,7 +7034,7 @@ int eof_menu_trill_unmark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7082,7 +7084,7 @@ int eof_menu_tremolo_unmark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7122,7 +7124,7 @@ int eof_menu_slider_unmark(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7140,7 +7142,7 @@ int eof_menu_trill_erase_all(void)
 		prompt = drum_track_prompt;	//If this is a drum track, refer to the sections as "special drum rolls" instead of "trills"
 
 	eof_clear_input();
-	if(alert(NULL, prompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, prompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		eof_set_num_trills(eof_song, eof_selected_track, 0);
@@ -7162,7 +7164,7 @@ int eof_menu_tremolo_erase_all(void)
 		prompt = drum_track_prompt;	//If this is a drum track, refer to the sections as "drum rolls" instead of "tremolos"
 
 	eof_clear_input();
-	if(alert(NULL, prompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, prompt, NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		eof_set_num_tremolos(eof_song, eof_selected_track, 0);
@@ -7177,7 +7179,7 @@ int eof_menu_slider_erase_all(void)
 		return 1;	//Do not allow this function to run unless a legacy guitar track is active
 
 	eof_clear_input();
-	if(alert(NULL, "Erase all slider sections from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+	if(eof_alert(NULL, "Erase all slider sections from this track?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 	{
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		eof_set_num_sliders(eof_song, eof_selected_track, 0);
@@ -7312,7 +7314,7 @@ int eof_menu_note_clear_legacy_values(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7320,7 +7322,8 @@ int eof_menu_note_clear_legacy_values(void)
 int eof_menu_note_edit_name(void)
 {
 	unsigned long i;
-	char *notename = NULL, undo_made = 0, auto_apply = 0;
+	const char *notename = NULL;
+	char undo_made = 0, auto_apply = 0;
 
 	if(!eof_music_catalog_playback)
 	{
@@ -7346,7 +7349,7 @@ int eof_menu_note_edit_name(void)
 			if((eof_etext[0] == '\0') && (eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT))
 			{	//If the user kept the name field empty and this is a pro guitar track, offer to apply auto-detected names
 				eof_clear_input();
-				if(alert(NULL, "Apply automatically-detected chord names?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert(NULL, "Apply automatically-detected chord names?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opts to apply auto-detected names
 					auto_apply = 1;
 				}
@@ -7357,7 +7360,7 @@ int eof_menu_note_edit_name(void)
 				{	//For each character in the name field
 					if((eof_etext[i] == '[') || (eof_etext[i] == ']'))
 					{	//If the character is a bracket
-						allegro_message("You cannot use a bracket in the note's name");
+						eof_message("You cannot use a bracket in the note's name");
 						eof_cursor_visible = 1;
 						eof_pen_visible = 1;
 						eof_show_mouse(screen);
@@ -7394,7 +7397,7 @@ int eof_menu_note_edit_name(void)
 		if(note_selection_updated)
 		{	//If the only note modified was the seek hover note
 			eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-			eof_selection.current = EOF_MAX_NOTES - 1;
+			eof_selection.current = EOF_NO_NOTE_SELECTED;
 		}
 	}
 	eof_cursor_visible = 1;
@@ -7407,7 +7410,8 @@ int eof_name_search_replace(void)
 {
 	unsigned long ctr, count = 0;
 	int note_selection_updated, focus;
-	char undo_made = 0, *ptr;
+	char undo_made = 0;
+	const char *ptr;
 	int result;
 
 	//Initialize the dialog
@@ -7469,7 +7473,7 @@ int eof_name_search_replace(void)
 				}
 			}
 
-			allegro_message("%lu %s made.", count, ((count == 1) ? "replacement" : "replacements"));
+			eof_message("%lu %s made.", count, ((count == 1) ? "replacement" : "replacements"));
 		}
 	}
 	eof_cursor_visible = 1;
@@ -7478,7 +7482,7 @@ int eof_name_search_replace(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return D_O_K;
 }
@@ -7520,7 +7524,7 @@ int eof_pro_guitar_toggle_strum_up(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7562,7 +7566,7 @@ int eof_pro_guitar_toggle_strum_down(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7604,7 +7608,7 @@ int eof_pro_guitar_toggle_strum_mid(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7640,7 +7644,7 @@ int eof_menu_note_remove_strum_direction(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -7727,7 +7731,7 @@ int eof_menu_copy_solos_track_number(EOF_SONG *sp, unsigned long sourcetrack, un
 	if(eof_get_num_solos(sp, desttrack))
 	{	//If there are already solos in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing solo phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing solo phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -7833,7 +7837,7 @@ int eof_menu_copy_sp_track_number(EOF_SONG *sp, unsigned long sourcetrack, unsig
 	if(eof_get_num_star_power_paths(sp, desttrack))
 	{	//If there are already star power phrases in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing star power phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing star power phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -7939,7 +7943,7 @@ int eof_menu_copy_arpeggio_track_number(EOF_SONG *sp, unsigned long sourcetrack,
 	if(eof_get_num_arpeggios(sp, desttrack))
 	{	//If there are already arpeggio phrases in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing arpeggio phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing arpeggio phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -8045,7 +8049,7 @@ int eof_menu_copy_trill_track_number(EOF_SONG *sp, unsigned long sourcetrack, un
 	if(eof_get_num_trills(sp, desttrack))
 	{	//If there are already trill phrases in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing trill phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing trill phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -8151,7 +8155,7 @@ int eof_menu_copy_tremolo_track_number(EOF_SONG *sp, unsigned long sourcetrack,
 	if(eof_get_num_tremolos(sp, desttrack))
 	{	//If there are already tremolo phrases in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing tremolo phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing tremolo phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -8257,7 +8261,7 @@ int eof_menu_copy_sliders_track_number(EOF_SONG *sp, unsigned long sourcetrack,
 	if(eof_get_num_sliders(sp, desttrack))
 	{	//If there are already sliders in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing slider phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing slider phrases in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -8326,7 +8330,7 @@ int eof_menu_note_toggle_hi_hat_open(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8376,7 +8380,7 @@ int eof_menu_note_toggle_hi_hat_pedal(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8426,7 +8430,7 @@ int eof_menu_note_toggle_hi_hat_sizzle(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8472,7 +8476,7 @@ int eof_menu_note_remove_hi_hat_status(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8514,7 +8518,7 @@ int eof_menu_note_toggle_rimshot(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8556,7 +8560,7 @@ int eof_menu_note_remove_rimshot(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8590,7 +8594,7 @@ int eof_menu_note_toggle_flam(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8624,7 +8628,7 @@ int eof_menu_note_remove_flam(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8672,7 +8676,7 @@ int eof_menu_pro_guitar_toggle_hammer_on(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8710,7 +8714,7 @@ int eof_menu_pro_guitar_remove_hammer_on(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8758,7 +8762,7 @@ int eof_menu_pro_guitar_toggle_pull_off(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8796,7 +8800,7 @@ int eof_menu_pro_guitar_remove_pull_off(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8835,7 +8839,7 @@ int eof_menu_note_toggle_ghost(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8874,7 +8878,7 @@ int eof_menu_note_remove_ghost(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8913,7 +8917,7 @@ int eof_menu_note_remove_vibrato(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8947,7 +8951,7 @@ int eof_menu_note_toggle_vibrato(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -8984,7 +8988,7 @@ int eof_menu_note_remove_pop(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9022,7 +9026,7 @@ int eof_menu_note_toggle_pop(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9059,7 +9063,7 @@ int eof_menu_note_remove_slap(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9097,7 +9101,7 @@ int eof_menu_note_toggle_slap(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9201,7 +9205,7 @@ int eof_menu_note_remove_ch_sp_deploy(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9226,7 +9230,7 @@ int eof_menu_note_toggle_ch_sp_deploy(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9310,7 +9314,7 @@ int eof_pro_guitar_note_slide_end_fret(char undo)
 				eof_cursor_visible = 1;
 				eof_pen_visible = 1;
 				eof_show_mouse(NULL);
-				allegro_message("Error:  The fret number specified is higher than the max fret for this track");
+				eof_message("Error:  The fret number specified is higher than the max fret for this track");
 				return 1;	//Return error
 			}
 		}
@@ -9335,7 +9339,7 @@ int eof_pro_guitar_note_slide_end_fret(char undo)
 						eof_cursor_visible = 1;
 						eof_pen_visible = 1;
 						eof_show_mouse(NULL);
-						allegro_message("Error:  The fret number specified must be higher than the lowest fret on upward slide notes");
+						eof_message("Error:  The fret number specified must be higher than the lowest fret on upward slide notes");
 						break;	//Stop processing selected notes
 					}
 				}
@@ -9346,7 +9350,7 @@ int eof_pro_guitar_note_slide_end_fret(char undo)
 						eof_cursor_visible = 1;
 						eof_pen_visible = 1;
 						eof_show_mouse(NULL);
-						allegro_message("Error:  The fret number specified must be lower than the lowest fret on downward slide notes");
+						eof_message("Error:  The fret number specified must be lower than the lowest fret on downward slide notes");
 						break;	//Stop processing selected notes
 					}
 				}
@@ -9373,7 +9377,7 @@ int eof_pro_guitar_note_slide_end_fret(char undo)
 			}
 			else if(newend)
 			{	//Or as long as a valid end of slide position was otherwise provided
-				allegro_message("Error:  The fret number specified must be different from the selected note's lowest used fret");
+				eof_message("Error:  The fret number specified must be different from the selected note's lowest used fret");
 			}
 		}//For each note in the active track
 	}//User clicked OK
@@ -9381,7 +9385,7 @@ int eof_pro_guitar_note_slide_end_fret(char undo)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	eof_cursor_visible = 1;
 	eof_pen_visible = 1;
@@ -9455,7 +9459,7 @@ int eof_pro_guitar_note_define_unpitched_slide(void)
 				eof_cursor_visible = 1;
 				eof_pen_visible = 1;
 				eof_show_mouse(NULL);
-				allegro_message("Error:  The fret number specified is higher than the max fret for this track");
+				eof_message("Error:  The fret number specified is higher than the max fret for this track");
 				error = 1;
 			}
 		}
@@ -9477,7 +9481,7 @@ int eof_pro_guitar_note_define_unpitched_slide(void)
 						eof_cursor_visible = 1;
 						eof_pen_visible = 1;
 						eof_show_mouse(NULL);
-						allegro_message("Error:  The fret number specified must be higher or lower than the note's lowest used fret");
+						eof_message("Error:  The fret number specified must be higher or lower than the note's lowest used fret");
 						break;	//Stop processing selected notes
 					}
 				}
@@ -9511,7 +9515,7 @@ int eof_pro_guitar_note_define_unpitched_slide(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	eof_cursor_visible = 1;
 	eof_pen_visible = 1;
@@ -9549,7 +9553,7 @@ int eof_menu_note_remove_unpitched_slide(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9681,7 +9685,7 @@ int eof_pro_guitar_note_bend_strength(char undo)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	eof_cursor_visible = 1;
 	eof_pen_visible = 1;
@@ -9732,7 +9736,7 @@ int eof_menu_pro_guitar_remove_fingering(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9762,7 +9766,7 @@ int eof_note_menu_read_gp_lyric_texts(void)
 	fp = pack_fopen(returnedfn, "rt");
 	if(!fp)
 	{
-		allegro_message("Couldn't open file:  \"%s\"", strerror(errno));
+		eof_message("Couldn't open file:  \"%s\"", strerror(errno));
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError loading:  Cannot open input .eof file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
 		eof_log(eof_log_string, 1);
 		return 0;
@@ -9791,7 +9795,7 @@ int eof_note_menu_read_gp_lyric_texts(void)
 			{
 				if(pack_getc(fp) != '\n')
 				{	//If it was followed by the rest of the sequence (newline)
-					allegro_message("Error:  Malformed text file?");
+					eof_message("Error:  Malformed text file?");
 					(void) pack_fclose(fp);
 					return 0;
 				}
@@ -9907,7 +9911,7 @@ int eof_menu_remove_statuses(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9975,7 +9979,7 @@ int eof_rocksmith_convert_mute_to_palm_mute_single_note(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -9984,10 +9988,10 @@ void eof_menu_note_cycle_selection_back(unsigned long notenum)
 {
 	unsigned long ctr;
 
-	if(notenum >= EOF_MAX_NOTES)
+	if(notenum >= eof_selection.multi_size)
 		return;	//Invalid parameter
 
-	for(ctr = notenum; ctr + 1 < EOF_MAX_NOTES; ctr++)
+	for(ctr = notenum; ctr + 1 < eof_selection.multi_size; ctr++)
 	{	//For each entry in the selection array, up to the second to last one
 		eof_selection.multi[ctr] = eof_selection.multi[ctr + 1];	//This remaining note will cycled back one in number, so it needs to retain its selection status
 	}
@@ -10031,7 +10035,7 @@ int eof_menu_note_simplify_chords(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -10095,7 +10099,7 @@ int eof_menu_pro_guitar_toggle_string_mute(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -10261,7 +10265,7 @@ int eof_menu_note_reflect(char function)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -10325,7 +10329,7 @@ int eof_menu_note_move_tech_note_to_previous_note_pos(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -10483,7 +10487,7 @@ int eof_menu_note_convert_to_ghl_open(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 
 	return 1;
@@ -10517,7 +10521,7 @@ int eof_menu_note_swap_ghl_black_white_gems(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 
 	return 1;
@@ -10564,7 +10568,7 @@ int eof_menu_note_remove_disjointed(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 
 	eof_legacy_track_fixup_notes(eof_song, eof_selected_track, 1);
@@ -1041,7 +1041,7 @@ int eof_menu_song_seek_note_index(void)
 		value = atol(eof_etext);
 		if(value < 0)
 		{
-			allegro_message("Must be a number >= 0");
+			eof_message("Must be a number >= 0");
 			return 1;
 		}
 
@@ -1158,7 +1158,7 @@ int eof_menu_song_seek_bookmark_9(void)
 
 int eof_menu_song_file_info(void)
 {
-	allegro_message("Song Folder:\n  %s\n\nEOF Filename:\n  %s\n\nRevision %lu", eof_song_path, eof_loaded_song_name, eof_song->tags->revision);
+	eof_message("Song Folder:\n  %s\n\nEOF Filename:\n  %s\n\nRevision %lu", eof_song_path, eof_loaded_song_name, eof_song->tags->revision);
 	return 1;
 }
 
@@ -1274,7 +1274,7 @@ int eof_menu_song_properties(void)
 		}
 		if((ustrlen(eof_etext) > 255) || (ustrlen(eof_etext2) > 255) || (ustrlen(eof_etext3) > 255) || (ustrlen(eof_etext5) > 31) || (ustrlen(eof_etext6) > 511))
 		{
-			allegro_message("Text too large for allocated buffer!");
+			eof_message("Text too large for allocated buffer!");
 			return 1;
 		}
 		(void) ustrcpy(eof_song->tags->title, eof_etext);
@@ -1306,7 +1306,7 @@ int eof_menu_song_properties(void)
 		}
 		if(invalid)
 		{
-			allegro_message("Invalid MIDI offset.");
+			eof_message("Invalid MIDI offset.");
 		}
 		if(eof_song->beat[0]->pos != eof_song->tags->ogg[0].midi_offset)
 		{	//If the first beat's position changed
@@ -1319,7 +1319,7 @@ int eof_menu_song_properties(void)
 		if((eof_song->tags->ogg[0].midi_offset != old_offset) && (eof_get_chart_size(eof_song) > 0))
 		{	//If the MIDI offset was changed and there is at least one note/lyric in the chart, prompt to adjust the notes/lyrics
 			eof_clear_input();
-			if(alert(NULL, "Adjust notes to new offset?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Adjust notes to new offset?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{
 				(void) eof_adjust_notes(ULONG_MAX, eof_song->tags->ogg[0].midi_offset - old_offset);
 			}
@@ -1354,7 +1354,7 @@ int eof_menu_song_properties(void)
 				if(i < eof_song->beats - 1)
 				{	//If this condition is met, one of the time signatures used a TS with a denominator other than 4
 					eof_clear_input();
-					if(alert(NULL, "Alter tempos to keep beat positions intact?", NULL, "Yes", "No", 'y', 'n') == 1)
+					if(eof_alert(NULL, "Alter tempos to keep beat positions intact?", NULL, "Yes", "No", 'y', 'n') == 1)
 					{	//If the user opted to keep them intact
 						eof_change_accurate_ts(eof_song, newaccurate_ts);
 					}
@@ -1396,7 +1396,7 @@ int eof_menu_song_test(char application)
 		difficulty = eof_figure_difficulty();
 		if(difficulty < 0)
 		{
-			(void) alert("Error", NULL, "No Notes!", "OK", NULL, 0, KEY_ENTER);
+			(void) eof_alert("Error", NULL, "No Notes!", "OK", NULL, 0, KEY_ENTER);
 			eof_clear_input();
 			return 1;
 		}
@@ -1405,7 +1405,7 @@ int eof_menu_song_test(char application)
 		part = eof_figure_part();
 		if(part < 0)
 		{
-			(void) alert("Error", NULL, "No Notes!", "OK", NULL, 0, KEY_ENTER);
+			(void) eof_alert("Error", NULL, "No Notes!", "OK", NULL, 0, KEY_ENTER);
 			eof_clear_input();
 			return 1;
 		}
@@ -1426,7 +1426,7 @@ int eof_menu_song_test(char application)
 	/* switch to songs folder */
 	if(eof_chdir(songs_path))
 	{
-		allegro_message("Song could not be tested!\nMake sure you set the %s song folder correctly (\"Link To %s\")!", appdisplayname, appdisplayname);
+		eof_message("Song could not be tested!\nMake sure you set the %s song folder correctly (\"Link To %s\")!", appdisplayname, appdisplayname);
 		return 1;
 	}
 
@@ -1441,7 +1441,7 @@ int eof_menu_song_test(char application)
 	eof_fixup_notes(eof_song);
 	if(!eof_save_song(eof_song, temppath2))
 	{
-		allegro_message("Song could not be tested!\nMake sure you set the %s song folder correctly (\"Link To %s\")!", appdisplayname, appdisplayname);
+		eof_message("Song could not be tested!\nMake sure you set the %s song folder correctly (\"Link To %s\")!", appdisplayname, appdisplayname);
 		get_executable_name(temppath, 1024);
 		(void) replace_filename(temppath, temppath, "", 1024);
 		(void) eof_chdir(temppath);
@@ -1462,7 +1462,7 @@ int eof_menu_song_test(char application)
 	(void) replace_filename(temppath, executablepath, "", 1024);
 	if(eof_chdir(temppath))
 	{
-		allegro_message("Song could not be tested!\nMake sure you set the %s song folder correctly (\"Link To %s\")!", appdisplayname, appdisplayname);
+		eof_message("Song could not be tested!\nMake sure you set the %s song folder correctly (\"Link To %s\")!", appdisplayname, appdisplayname);
 		return 1;
 	}
 
@@ -1501,7 +1501,7 @@ int eof_menu_song_test(char application)
 	/* switch to songs folder */
 	if(eof_chdir(songs_path))
 	{
-		allegro_message("Cleanup failed!");
+		eof_message("Cleanup failed!");
 		return 1;
 	}
 
@@ -1789,7 +1789,7 @@ int eof_menu_catalog_add(void)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return 1;
 }
@@ -2029,7 +2029,7 @@ DIALOG eof_leading_silence_dialog[] =
 	{ d_agup_radio_proc,      16,  180, 110, 15,  2,   23,  0,    0,          0,   0,   "Beats",                 NULL, NULL },
 	{ eof_verified_edit_proc, 16,  200, 110, 20,  2,   23,  0,    0,          10,  0,   eof_etext,       "1234567890", NULL },
 	{ d_agup_check_proc,      16,  226, 180, 16,  2,   23,  0,    D_SELECTED, 1,   0,   "Adjust Notes/Beats",    NULL, NULL },
-	{ d_agup_radio_proc,      16,  246, 160, 15,  2,   23,  0,    0,          1,   0,   "Stream copy (oggCat)",  NULL, NULL },
+	{ d_agup_radio_proc,      16,  246, 160, 15,  2,   23,  0,    0,          1,   0,   "Stream copy",         NULL, NULL },
 	{ d_agup_radio_proc,      16,  266, 90,  15,  2,   23,  0,    0,          1,   0,   "Re-encode",             NULL, NULL },
 	{ d_agup_button_proc,     16,  292, 68,  28,  2,   23,  '\r', D_EXIT,     0,   0,   "OK",                    NULL, NULL },
 	{ d_agup_button_proc,     116, 292, 68,  28,  2,   23,  0,    D_EXIT,     0,   0,   "Cancel",                NULL, NULL },
@@ -2073,7 +2073,7 @@ int eof_menu_song_add_silence(void)
 	unsigned long i, x;
 	char fn[1024] = {0};
 	char mp3fn[1024] = {0};
-	static int creationmethod = 9;	//Stores the user's last selected leading silence creation method (default to oggCat, which is menu item 9 in eof_leading_silence_dialog[])
+	static int creationmethod = 9;	//Stores the user's last selected leading silence creation method (default to stream copy, which is menu item 9 in eof_leading_silence_dialog[])
 	int retval;
 	unsigned long old_eof_music_length = eof_music_length;	//Keep track of the current chart audio's length to compare with after silence was added
 
@@ -2086,11 +2086,6 @@ int eof_menu_song_add_silence(void)
 
 	eof_leading_silence_dialog[9].flags = 0;
 	eof_leading_silence_dialog[10].flags = 0;
-	if(eof_supports_oggcat == 0)
-	{	//If EOF has not found oggCat to be available, disable it in the menu and select re-encode
-		creationmethod = 10;	//eof_leading_silence_dialog[10] is the re-encode option
-		eof_leading_silence_dialog[9].flags = D_DISABLED;	//Disable the stream copy option
-	}
 
 	eof_leading_silence_dialog[creationmethod].flags = D_SELECTED;	//Select the last selected creation method
 
@@ -2169,8 +2164,8 @@ int eof_menu_song_add_silence(void)
 				}
 			}
 
-			if((eof_leading_silence_dialog[9].flags == D_SELECTED) && eof_supports_oggcat)
-			{	//User opted to use oggCat
+			if(eof_leading_silence_dialog[9].flags == D_SELECTED)
+			{	//User opted to stream copy the original audio
 				creationmethod = 9;		//Remember this as the default next time
 				retval = eof_add_silence(eof_loaded_ogg_name, silence_length);
 			}
@@ -2192,7 +2187,7 @@ int eof_menu_song_add_silence(void)
 			{	//If silence could not be inserted
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError code %d when adding leading silence", retval);
 				eof_log(eof_log_string, 1);
-				allegro_message("Could not add leading silence (error %d)", retval);
+				eof_message("Could not add leading silence (error %d)", retval);
 			}
 			after_silence_length = get_ogg_length(eof_loaded_ogg_name);
 			eof_song->tags->ogg[0].modified = 1;
@@ -2204,7 +2199,7 @@ int eof_menu_song_add_silence(void)
 
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tLeading silence failure detected.  Chart audio went from %lums to %lums in length", old_eof_music_length, eof_music_length);
 			eof_log(eof_log_string, 1);
-			if(alert("Warning:  The leading silence operation seemed to have failed.", ((creationmethod == 9) ? stream_copy_message : ""), "Undo?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("Warning:  The leading silence operation seemed to have failed.", ((creationmethod == 9) ? stream_copy_message : ""), "Undo?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to undo the operation
 				(void) eof_undo_apply();
 			}
@@ -3314,14 +3309,14 @@ int eof_raw_midi_track_import(DIALOG * d)
 	}
 	else if((selected->timedivision) || !ustricmp(selected->trackname, "BEAT"))
 	{	//If the user selected the tempo track or the beat track
-		allegro_message("Import of this track is not allowed because it is written during save");
+		eof_message("Import of this track is not allowed because it is written during save");
 		selected = NULL;
 		canceled = 1;
 	}
 	else if(!ustricmp(selected->trackname, "EVENTS"))
 	{
 		eof_clear_input();
-		if(alert("Warning:  This track contains the chart's text events.", "Importing it will cause it to replace the project's events track", "in the MIDI created during save.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert("Warning:  This track contains the chart's text events.", "Importing it will cause it to replace the project's events track", "in the MIDI created during save.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If user did not opt to override the project's events track with that of the external MIDI
 			selected = NULL;
 			canceled = 1;
@@ -3334,7 +3329,7 @@ int eof_raw_midi_track_import(DIALOG * d)
 			if(!ustricmp(selected->trackname, eof_midi_tracks[ctr].name))
 			{	//If the user selected a track with a name that EOF natively supports
 				eof_clear_input();
-				if(alert("Warning:  This is a track supported natively by EOF.", "Importing it will cause it to replace the project's related track", "in the MIDI created during save.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
+				if(eof_alert("Warning:  This is a track supported natively by EOF.", "Importing it will cause it to replace the project's related track", "in the MIDI created during save.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
 				{	//If user did not opt to override the project's native track with that of the external MIDI
 					selected = NULL;
 					canceled = 1;
@@ -3352,7 +3347,7 @@ int eof_raw_midi_track_import(DIALOG * d)
 			if(!ustricmp(selected->trackname, ptr->trackname))
 			{	//If the user selected a track with a name matching a track already being stored in the project
 				eof_clear_input();
-				if(alert("A track with this name is already being stored:", selected->trackname, "Replace it?", "&Yes", "&No", 'y', 'n') != 1)
+				if(eof_alert("A track with this name is already being stored:", selected->trackname, "Replace it?", "&Yes", "&No", 'y', 'n') != 1)
 				{	//If the user declined to replace the previously-stored track with the newly-selected track
 					selected = NULL;
 					canceled = 1;
@@ -3457,7 +3452,7 @@ int eof_raw_midi_dialog_add(DIALOG * d)
 		}
 		if(!eof_work_midi)
 		{
-			allegro_message("Error:  Invalid MIDI file");
+			eof_message("Error:  Invalid MIDI file");
 			(void) dialog_message(eof_raw_midi_tracks_dialog, MSG_DRAW, 0, &junk);	//Redraw the Manage raw MIDI tracks dialog
 			return 0;
 		}
@@ -3470,7 +3465,7 @@ int eof_raw_midi_dialog_add(DIALOG * d)
 		{	//If a nonzero delay was read from song.ini
 			(void) snprintf(tempfilename, sizeof(tempfilename) - 1, "%d", delay);
 			eof_clear_input();
-			if(alert("Import this MIDI delay from song.ini?", tempfilename, NULL, "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert("Import this MIDI delay from song.ini?", tempfilename, NULL, "&Yes", "&No", 'y', 'n') != 1)
 			{	//If the user declined using the MIDI delay from the MIDI's song.ini file
 				delay = 0;	//Set the delay back to 0
 			}
@@ -3486,7 +3481,7 @@ int eof_raw_midi_dialog_add(DIALOG * d)
 			ptr = eof_get_raw_MIDI_data(eof_work_midi, ctr, delay);
 			if(!ptr)
 			{	//If the track was not read
-				allegro_message("Error parsing MIDI track");
+				eof_message("Error parsing MIDI track");
 				(void) dialog_message(eof_raw_midi_tracks_dialog, MSG_DRAW, 0, &junk);	//Redraw the Manage raw MIDI tracks dialog
 				return 0;
 			}
@@ -4125,7 +4120,7 @@ int eof_phrase_edit_timing(unsigned long *start, unsigned long *end)
 
 		if(newstart >= newend)
 		{	//If the given timing is not valid
-			allegro_message("The entry must end after it begins");
+			eof_message("The entry must end after it begins");
 		}
 		else if((*start != newstart) || (*end != newend))
 		{	//If the timing was changed
@@ -4278,7 +4273,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 							eof_2d_render_top_option = 7;			//Display fret hand positions at the top of the piano roll
 							eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);
 
-							if(alert("Warning:  A fret hand position was not defined at/before the first note in this track difficulty.", "You should correct this by setting the fret hand position at or before this note,", "or by deleting/regenerating the fret hand positions.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
+							if(eof_alert("Warning:  A fret hand position was not defined at/before the first note in this track difficulty.", "You should correct this by setting the fret hand position at or before this note,", "or by deleting/regenerating the fret hand positions.  Continue?", "&Yes", "&No", 'y', 'n') != 1)
 							{	//If the user does not opt to continue looking for errors
 								eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
 								(void) eof_detect_difficulties(eof_song, eof_selected_track);	//Update eof_track_diff_populated_status[] to reflect all populated difficulties for the active track
@@ -4308,7 +4303,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 
 						if(eof_write_rs_files)
 						{	//If Rocksmith 1 files are to be exported
-							ret = alert3("Warning (RS1):  Fret hand positions higher than 19 (considering any capo in use) are invalid.", "You should change this to a lower number or delete/regenerate the fret hand positions.", "Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
+							ret = eof_alert3("Warning (RS1):  Fret hand positions higher than 19 (considering any capo in use) are invalid.", "You should change this to a lower number or delete/regenerate the fret hand positions.", "Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
 							problem_found = 1;
 							triggered = 1;
 						}
@@ -4316,7 +4311,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 						{	//If Rocksmith 2 files are to be exported
 							if(position + tp->capo > 21)
 							{	//If the effective position is above fret 21
-								ret = alert3("Warning (RS2):  Fret hand positions higher than 21 (considering any capo in use) are invalid.", "You should change this to a lower number or delete/regenerate the fret hand positions.", "Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
+								ret = eof_alert3("Warning (RS2):  Fret hand positions higher than 21 (considering any capo in use) are invalid.", "You should change this to a lower number or delete/regenerate the fret hand positions.", "Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
 								problem_found = 1;
 								triggered = 1;
 							}
@@ -4357,7 +4352,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 						{	//If this note is a chord, and its fret range is too large to fit into Rocksmith's chord box
 							if(!width_warning && report)
 							{	//If the user wasn't warned about this yet, and this validation function was manually invoked through the menu
-								if(alert("Warning (RS1):  At least one chord is too wide to fit into a chord box.", "It may be a good idea to change its fretting.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+								if(eof_alert("Warning (RS1):  At least one chord is too wide to fit into a chord box.", "It may be a good idea to change its fretting.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 								{	//If the user does not opt to continue looking for errors
 									eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
 									(void) eof_detect_difficulties(eof_song, eof_selected_track);	//Update eof_track_diff_populated_status[] to reflect all populated difficulties for the active track
@@ -4391,7 +4386,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 							}
 							if(warning)
 							{	//If a warning is being displayed instead of suppressed
-								ret = alert3(warning, "You should correct this by setting the fret hand position at or before this note,", "or by deleting/regenerating the fret hand positions.  Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
+								ret = eof_alert3(warning, "You should correct this by setting the fret hand position at or before this note,", "or by deleting/regenerating the fret hand positions.  Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
 								if(ret == 2)
 								{	//If the user does not opt to continue looking for errors
 									eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
@@ -4430,7 +4425,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 								eof_selection.track = ctr;
 								eof_selection.multi[ctr2] = 1;
 								eof_seek_and_render_position(ctr, tp->note[ctr2]->type, tp->note[ctr2]->pos);
-								ret = alert3("Warning:  This note is specified as using the index finger,", "but the fret hand position is on a different fret.", "It's recommended to change the fret hand position to match.  Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
+								ret = eof_alert3("Warning:  This note is specified as using the index finger,", "but the fret hand position is on a different fret.", "It's recommended to change the fret hand position to match.  Continue?", "&Yes", "&No", "&Ignore", 'y', 'n', 'i');
 								if(ret == 2)
 								{	//If the user does not opt to continue looking for errors
 									eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
@@ -4482,7 +4477,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 									eof_selected_beat = ctr2;				//Change the selected beat
 									eof_seek_and_render_position(ctr, ctr3, startpos);
 									eof_clear_input();
-									phrase_warning = alert3("The fret hand position is not redefined at each difficulty of each phrase.", "This can prevent the positions from working in dynamic difficulty charts.", "Correct this issue?", "&Yes", "&No", "Cancel", 'y', 'n', 0);
+									phrase_warning = eof_alert3("The fret hand position is not redefined at each difficulty of each phrase.", "This can prevent the positions from working in dynamic difficulty charts.", "Correct this issue?", "&Yes", "&No", "Cancel", 'y', 'n', 0);
 									if(phrase_warning == 3)
 									{	//If the user does not opt to continue looking for errors
 										eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
@@ -4520,7 +4515,7 @@ int eof_check_fret_hand_positions_option(char report, char *undo_made)
 
 	if(report && !problem_found)
 	{	//If the calling function wanted to report if no errors were found, and none were
-		allegro_message("No fret hand position errors were found");
+		eof_message("No fret hand position errors were found");
 	}
 
 	eof_process_beat_statistics(eof_song, eof_selected_track);	//Cache section name information into the beat structures (from the perspective of the active track)
@@ -4899,7 +4894,7 @@ int eof_menu_song_compare_piano_rolls(int function)
 
 	if(diffcount == 1)
 		plurality = singular;
-	allegro_message("%lu difference%s found.", diffcount, plurality);
+	eof_message("%lu difference%s found.", diffcount, plurality);
 
 	return 1;
 }
@@ -4925,7 +4920,7 @@ int eof_menu_song_toggle_ch_sp_durations(void)
 			eof_process_beat_statistics(eof_song, eof_selected_track);	//Rebuild beat statistics if necessary
 		if(!eof_song->beat[0]->has_ts)	//If the first beat marker has no time signature
 		{
-			allegro_message("The first beat marker must contain a time signature (select it and use Beat>Time Signature) before star power durations can be displayed");
+			eof_message("The first beat marker must contain a time signature (select it and use Beat>Time Signature) before star power durations can be displayed");
 			eof_show_ch_sp_durations = 0;	//Disable this feature
 		}
 	}
@@ -4958,7 +4953,7 @@ int eof_menu_song_add_floating_text_event(void)
 	{	//For each beat in the project
 		if(eof_song->beat[ctr]->pos == eof_music_pos - eof_av_delay)
 		{	//If the seek position is on a beat marker
-			allegro_message("Note:  Placing a floating event at a beat marker position will not assign it to that beat and it will not move with the beat.");
+			eof_message("Note:  Placing a floating event at a beat marker position will not assign it to that beat and it will not move with the beat.");
 			break;
 		}
 	}
@@ -658,7 +658,7 @@ int eof_track_rename(void)
 				{	//For each track in the project
 					if(!ustrncmp(eof_etext, eof_song->track[ctr]->name, EOF_NAME_LENGTH) || !ustrncmp(eof_etext, eof_song->track[ctr]->altname, EOF_NAME_LENGTH))
 					{	//If the provided name matches the track's native or display name
-						allegro_message("Error:  The provided name is already in use by this track:  %s", eof_song->track[ctr]->name);
+						eof_message("Error:  The provided name is already in use by this track:  %s", eof_song->track[ctr]->name);
 						return 1;
 					}
 				}
@@ -1093,17 +1093,17 @@ int eof_track_tuning(void)
 
 			if(eof_fret_strings[ctr][0] == '\0')
 			{	//Ensure the user entered a tuning
-				allegro_message("Error:  Each of the track's strings must have a defined tuning");
+				eof_message("Error:  Each of the track's strings must have a defined tuning");
 				return 1;
 			}
 			if(!value && (eof_fret_strings[ctr][0] != '0'))
 			{	//Ensure the tuning is valid (ie. not "-")
-				allegro_message("Error:  Invalid tuning value");
+				eof_message("Error:  Invalid tuning value");
 				return 1;
 			}
 			if((value > 24) || (value < -24))
 			{	//Ensure the tuning is within range (allow up to two octaves above or below standard)
-				allegro_message("Error:  Invalid tuning value (must be between -11 and 11)");
+				eof_message("Error:  Invalid tuning value (must be between -11 and 11)");
 				return 1;
 			}
 		}
@@ -1138,7 +1138,7 @@ int eof_track_tuning(void)
 		{	//If the user has given a drop tuning
 			if(tp->ignore_tuning)
 			{	//If the option to disregard the tuning for chord name lookups is in effect
-				if(alert("This appears to be a drop tuning.", "Disable the option to ignore the tuning", "for chord names? (recommended)", "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("This appears to be a drop tuning.", "Disable the option to ignore the tuning", "for chord names? (recommended)", "&Yes", "&No", 'y', 'n') == 1)
 				{	//If user opts to take the drop tuning into account for chord name lookups
 					tp->ignore_tuning = 0;
 				}
@@ -1186,7 +1186,7 @@ int eof_track_transpose_tuning(EOF_PRO_GUITAR_TRACK* tp, char *tuningdiff)
 						diffmask |= bitmask;	//Build a bitmask defining which strings are being transposed
 						if(!prompt)
 						{	//If the user hasn't been prompted yet
-							if(alert("This track contains notes that would be affected by the tuning change.", "Would you like to transpose the notes to keep the same pitches where possible?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+							if(eof_alert("This track contains notes that would be affected by the tuning change.", "Would you like to transpose the notes to keep the same pitches where possible?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 							{	//If the user doesn't opt to transpose the track
 								eof_menu_pro_guitar_track_set_tech_view_state(tp, restore_tech_view);	//Re-enable the original note set in use
 								return 1;
@@ -1214,7 +1214,7 @@ int eof_track_transpose_tuning(EOF_PRO_GUITAR_TRACK* tp, char *tuningdiff)
 									if(!(warning & 1))
 									{	//If the user hasn't been warned about this problem yet
 										eof_seek_and_render_position(eof_selected_track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
-										allegro_message("Warning:  At least one note will have to be manually transposed to another string or octave.\nThese notes will be highlighted.");
+										eof_message("Warning:  At least one note will have to be manually transposed to another string or octave.\nThese notes will be highlighted.");
 										warning |= 1;
 									}
 									break;	//Skip checking the rest of the strings
@@ -1242,7 +1242,7 @@ int eof_track_transpose_tuning(EOF_PRO_GUITAR_TRACK* tp, char *tuningdiff)
 									if(!(warning & 1))
 									{	//If the user hasn't been warned about this problem yet
 										eof_seek_and_render_position(eof_selected_track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
-										allegro_message("Warning:  At least one note will have to be manually transposed to another string or octave.\nThese notes will be highlighted.");
+										eof_message("Warning:  At least one note will have to be manually transposed to another string or octave.\nThese notes will be highlighted.");
 										warning |= 1;
 									}
 									break;	//Skip checking the rest of the strings
@@ -1323,19 +1323,19 @@ int eof_track_transpose_tuning(EOF_PRO_GUITAR_TRACK* tp, char *tuningdiff)
 						if((skiptranspose & 2) && !(warning & 2))
 						{	//If the user hasn't been warned about this problem yet
 							eof_seek_and_render_position(eof_selected_track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
-							allegro_message("Warning:  At least one sliding chord will have to be manually transposed due to only some of its strings being affected.\nThese notes will be highlighted.");
+							eof_message("Warning:  At least one sliding chord will have to be manually transposed due to only some of its strings being affected.\nThese notes will be highlighted.");
 							warning |= 2;
 						}
 						if((skiptranspose & 4) && !(warning & 4))
 						{	//If the user hasn't been warned about this problem yet
 							eof_seek_and_render_position(eof_selected_track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
-							allegro_message("Warning:  At least one sliding chord will have to be manually transposed due to its end of slide position.\nThese notes will be highlighted.");
+							eof_message("Warning:  At least one sliding chord will have to be manually transposed due to its end of slide position.\nThese notes will be highlighted.");
 							warning |= 4;
 						}
 						if((skiptranspose & 8) && !(warning & 8))
 						{	//If the user hasn't been warned about this problem yet
 							eof_seek_and_render_position(eof_selected_track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
-							allegro_message("Warning:  At least one sliding chord will have to be manually transposed due to its start of slide position.\nThese notes will be highlighted.");
+							eof_message("Warning:  At least one sliding chord will have to be manually transposed due to its start of slide position.\nThese notes will be highlighted.");
 							warning |= 8;
 						}
 					}
@@ -1435,7 +1435,7 @@ int eof_track_set_num_frets_strings(void)
 			char message[120] = {0};
 			(void) snprintf(message, sizeof(message) - 1, "Warning:  This track uses frets as high as %lu, exceeding the proposed limit.", highestfret);
 			eof_clear_input();
-			retval = alert3(NULL, message, "Continue?", "&Yes", "&No", "Highlight conflicts", 'y', 'n', 0);
+			retval = eof_alert3(NULL, message, "Continue?", "&Yes", "&No", "Highlight conflicts", 'y', 'n', 0);
 			if(retval != 1)
 			{	//If user does not opt to continue after being alerted of this fret limit issue
 				if(retval == 3)
@@ -1471,7 +1471,7 @@ int eof_track_set_num_frets_strings(void)
 		if(eof_detect_string_gem_conflicts(eof_song->pro_guitar_track[tracknum], newnumstrings))
 		{
 			eof_clear_input();
-			if(alert(NULL, "Warning:  Changing the # of strings will cause one or more gems to be deleted.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert(NULL, "Warning:  Changing the # of strings will cause one or more gems to be deleted.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 			{	//If user opts to cancel
 				cancel = 1;
 			}
@@ -1538,7 +1538,7 @@ int eof_track_pro_guitar_set_capo_position(void)
 	}
 	if(position > eof_song->pro_guitar_track[tracknum]->numfrets)
 	{	//If the given capo position is higher than this track's supported number of frets
-		allegro_message("You cannot specify a capo position that is higher than this track's number of frets (%u).", eof_song->pro_guitar_track[tracknum]->numfrets);
+		eof_message("You cannot specify a capo position that is higher than this track's number of frets (%u).", eof_song->pro_guitar_track[tracknum]->numfrets);
 	}
 	else if(position != tp->capo)
 	{	//If the user gave a valid position and it is different from the capo position that was already in use
@@ -1614,7 +1614,7 @@ int eof_track_pro_guitar_set_fret_hand_position(void)
 		position = atol(eof_etext);
 		if(position > tp->numfrets)
 		{	//If the given fret position is higher than this track's supported number of frets
-			allegro_message("You cannot specify a fret hand position that is higher than this track's number of frets (%u).", tp->numfrets);
+			eof_message("You cannot specify a fret hand position that is higher than this track's number of frets (%u).", tp->numfrets);
 			return 1;
 		}
 		else if(position + tp->capo > limit)
@@ -1624,24 +1624,24 @@ int eof_track_pro_guitar_set_fret_hand_position(void)
 				if(tp->capo)
 				{	//If there is a capo in use
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "You cannot specify a fret hand position higher than %u when a capo is at fret %u (it will cause Rocksmith 1 to crash).", 19U - tp->capo, tp->capo);
-					allegro_message("%s", eof_log_string);
+					eof_message("%s", eof_log_string);
 				}
 				else
 				{
-					allegro_message("You cannot specify a fret hand position higher than 19 (it will cause Rocksmith 1 to crash).");
+					eof_message("You cannot specify a fret hand position higher than 19 (it will cause Rocksmith 1 to crash).");
 				}
 				return 1;
 			}
 			//If this line is reached, it's because the limit was exceeded and it wasn't that of Rocksmith 1 or Rock Band (is Rocksmith 2's limit)
 			if(eof_write_rs2_files)
 			{	//Fret 24 is the highest supported fret in Rocksmith 2
-				allegro_message("You cannot specify a fret hand position higher than 21 (it will cause Rocksmith 2 to crash).");
+				eof_message("You cannot specify a fret hand position higher than 21 (it will cause Rocksmith 2 to crash).");
 				return 1;
 			}
 		}
 		else if(!position)
 		{	//If the user gave a fret position of 0
-			allegro_message("You cannot specify a fret hand position of 0.");
+			eof_message("You cannot specify a fret hand position of 0.");
 			return 1;
 		}
 		else
@@ -1826,7 +1826,7 @@ int eof_fret_hand_position_seek(DIALOG * d)
 	return D_O_K;
 }
 
-char eof_fret_hand_position_list_text[EOF_MAX_NOTES][25] = {{0}};
+char eof_fret_hand_position_list_text[25] = {0};	//The list box draws each entry as it is returned, so only the requested entry's text is built
 
 char * eof_fret_hand_position_list(int index, int * size)
 {
@@ -1842,14 +1842,14 @@ char * eof_fret_hand_position_list(int index, int * size)
 	{	//For each fret hand position
 		if(eof_song->pro_guitar_track[tracknum]->handposition[i].difficulty == eof_note_type)
 		{	//If the fret hand position is in the active difficulty
-			if(ecount < EOF_MAX_TEXT_EVENTS)
-			{
+			if((index >= 0) && (ecount == (unsigned long)index))
+			{	//If this is the entry being requested
 				ism = (eof_song->pro_guitar_track[tracknum]->handposition[i].start_pos / 1000) / 60;
 				iss = (eof_song->pro_guitar_track[tracknum]->handposition[i].start_pos / 1000) % 60;
 				isms = (eof_song->pro_guitar_track[tracknum]->handposition[i].start_pos % 1000);
-				(void) snprintf(eof_fret_hand_position_list_text[ecount], sizeof(eof_fret_hand_position_list_text[ecount]) - 1, "%02d:%02d.%03d: Fret %lu", ism, iss, isms, eof_song->pro_guitar_track[tracknum]->handposition[i].end_pos);
-				ecount++;
+				(void) snprintf(eof_fret_hand_position_list_text, sizeof(eof_fret_hand_position_list_text) - 1, "%02d:%02d.%03d: Fret %lu", ism, iss, isms, eof_song->pro_guitar_track[tracknum]->handposition[i].end_pos);
 			}
+			ecount++;
 		}
 	}
 	switch(index)
@@ -1878,8 +1878,8 @@ char * eof_fret_hand_position_list(int index, int * size)
 		}
 		default:
 		{
-			if(index < EOF_MAX_NOTES)
-				return eof_fret_hand_position_list_text[index];
+			if((index >= 0) && ((unsigned long)index < ecount))
+				return eof_fret_hand_position_list_text;
 		}
 	}
 	return NULL;
@@ -1982,7 +1982,7 @@ int eof_track_rs_popup_add(void)
 
 		if(!duration)
 		{	//If the given duration is not valid
-			allegro_message("The popup message must have a duration.");
+			eof_message("The popup message must have a duration.");
 		}
 		else
 		{
@@ -1990,7 +1990,7 @@ int eof_track_rs_popup_add(void)
 			{	//For each character in the user-specified string
 				if((ugetat(eof_etext, i) == '(') || (ugetat(eof_etext, i) == ')'))
 				{	//If the character is an open or close parenthesis
-					allegro_message("Rocksmith does not allow parentheses () in popup messages.");
+					eof_message("Rocksmith does not allow parentheses () in popup messages.");
 					failed = 1;
 					break;
 				}
@@ -2069,7 +2069,7 @@ void eof_rebuild_rs_popup_messages_list_strings(void)
 		eof_track_rs_popup_messages_list_strings[ctr] = malloc(stringlen + 1);	//Allocate memory to build the string
 		if(!eof_track_rs_popup_messages_list_strings[ctr])
 		{
-			allegro_message("Error allocating memory");
+			eof_message("Error allocating memory");
 			while(ctr > 0)
 			{	//Free previously allocated strings
 				free(eof_track_rs_popup_messages_list_strings[ctr - 1]);
@@ -2258,7 +2258,7 @@ int eof_track_rs_popup_messages_edit(DIALOG * d)
 
 		if(!duration)
 		{	//If the given timing is not valid
-			allegro_message("The popup message must have a duration");
+			eof_message("The popup message must have a duration");
 		}
 		else
 		{
@@ -2266,7 +2266,7 @@ int eof_track_rs_popup_messages_edit(DIALOG * d)
 			{	//For each character in the user-specified string
 				if((ugetat(eof_etext, i) == '(') || (ugetat(eof_etext, i) == ')'))
 				{	//If the character is an open or close parenthesis
-					allegro_message("Rocksmith does not allow parentheses () in popup messages.");
+					eof_message("Rocksmith does not allow parentheses () in popup messages.");
 					failed = 1;
 					break;
 				}
@@ -2502,20 +2502,20 @@ int eof_track_rocksmith_toggle_difficulty_limit(void)
 		{	//For each possible difficulty, starting after the first 5
 			if(eof_track_diff_populated_status[ctr])
 			{	//If this difficulty is populated
-				allegro_message("Warning:  There is at least one populated difficulty beyond the first 5 difficulties.  Only the first 5 will export to MIDI.");
+				eof_message("Warning:  There is at least one populated difficulty beyond the first 5 difficulties.  Only the first 5 will export to MIDI.");
 				break;
 			}
 		}
 		if(eof_track_diff_populated_status[EOF_NOTE_SPECIAL])
 		{	//If there are any notes in the BRE difficulty
-			allegro_message("Warning:  There are notes in the BRE difficulty.  Ensure this difficulty's contents are valid by Rock Band standards if you plan to use the exported MIDI.");
+			eof_message("Warning:  There are notes in the BRE difficulty.  Ensure this difficulty's contents are valid by Rock Band standards if you plan to use the exported MIDI.");
 		}
 	}
 	else
 	{	//The track currently has the difficulty limit in effect, toggle this flag on
 		if(eof_track_diff_populated_status[EOF_NOTE_SPECIAL])
 		{	//If there are any notes in the BRE difficulty
-			allegro_message("Warning:  There are notes in the BRE difficulty.  BRE notes from Rock Band charts are not compatible with Rocksmith and will need to be removed.");
+			eof_message("Warning:  There are notes in the BRE difficulty.  BRE notes from Rock Band charts are not compatible with Rocksmith and will need to be removed.");
 		}
 	}
 
@@ -2545,7 +2545,7 @@ int eof_track_rocksmith_insert_difficulty(void)
 
 	if(eof_song->track[eof_selected_track]->numdiffs == 255)
 	{
-		allegro_message("No more difficulties can be added.");
+		eof_message("No more difficulties can be added.");
 		return 1;
 	}
 	eof_prepare_undo(EOF_UNDO_TYPE_NONE);
@@ -2554,7 +2554,7 @@ int eof_track_rocksmith_insert_difficulty(void)
 	tp = eof_song->pro_guitar_track[tracknum];
 
 	eof_clear_input();
-	if(alert(NULL, "Insert the new difficulty above or below the active difficulty?", NULL, "&Above", "&Below", 'a', 'b') == 1)
+	if(eof_alert(NULL, "Insert the new difficulty above or below the active difficulty?", NULL, "&Above", "&Below", 'a', 'b') == 1)
 	{	//If the user chooses to insert the difficulty above the active difficulty
 		newdiff = eof_note_type + 1;	//The difficulty number of all content at/above the difficulty immediately above the active difficulty will be incremented
 	}
@@ -2584,6 +2584,7 @@ int eof_track_rocksmith_insert_difficulty(void)
 			tp->technote[ctr]->type++;
 		}
 	}
+	eof_note_index_invalidate(eof_selected_track);	//The tech notes' difficulties were changed directly, so any cached note index for this track will need to be rebuilt
 
 	//Update arpeggio difficulties
 	for(ctr = 0; ctr < tp->arpeggios; ctr++)
@@ -2617,7 +2618,7 @@ int eof_track_rocksmith_insert_difficulty(void)
 	if(lower && !upper)
 	{	//If only the lower difficulty is populated, offer to copy it into the new difficulty
 		eof_clear_input();
-		if(alert(NULL, "Would you like to copy the lower difficulty's contents?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Would you like to copy the lower difficulty's contents?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If user opted to copy the lower difficulty
 			(void) eof_menu_edit_paste_from_difficulty(newdiff - 1, &undo_made);
 		}
@@ -2625,7 +2626,7 @@ int eof_track_rocksmith_insert_difficulty(void)
 	else if(!lower && upper)
 	{	//If only the upper difficulty is populated, offer to copy it into the new difficulty
 		eof_clear_input();
-		if(alert(NULL, "Would you like to copy the upper difficulty's contents?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Would you like to copy the upper difficulty's contents?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If user opted to copy the upper difficulty
 			(void) eof_menu_edit_paste_from_difficulty(newdiff + 1, &undo_made);
 		}
@@ -2633,10 +2634,10 @@ int eof_track_rocksmith_insert_difficulty(void)
 	else if(lower && upper)
 	{	//If both the upper and lower difficulties are populated, prompt whether to copy either into the new difficulty
 		eof_clear_input();
-		if(alert(NULL, "Would you like to copy an adjacent difficulty's contents?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Would you like to copy an adjacent difficulty's contents?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If user opted to copy either the upper or lower difficulty
 			eof_clear_input();
-			if(alert(NULL, "Copy the upper difficulty or the lower difficulty?", NULL, "&Upper", "&Lower", 'u', 'l') == 1)
+			if(eof_alert(NULL, "Copy the upper difficulty or the lower difficulty?", NULL, "&Upper", "&Lower", 'u', 'l') == 1)
 			{	//If user opted to copy the upper difficulty
 				(void) eof_menu_edit_paste_from_difficulty(newdiff + 1, &undo_made);
 			}
@@ -2666,7 +2667,7 @@ int eof_track_delete_difficulty(void)
 	if(eof_track_diff_populated_status[eof_note_type])
 	{	//If the active track has any notes
 		eof_clear_input();
-		if(alert(NULL, "Warning:  This difficulty contains at least one note.  Delete the difficulty anyway?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  This difficulty contains at least one note.  Delete the difficulty anyway?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user doesn't opt to delete the populated track difficulty
 			return 1;
 		}
@@ -2767,7 +2768,7 @@ int eof_track_fret_hand_positions_copy_from(void)
 	}
 	if(diffcount == 0)
 	{
-		allegro_message("No other difficulties in this track contain fret hand positions.");
+		eof_message("No other difficulties in this track contain fret hand positions.");
 		return 1;
 	}
 
@@ -2786,7 +2787,7 @@ int eof_track_fret_hand_positions_copy_from(void)
 			if(tp->handposition[ctr - 1].difficulty == eof_note_type)
 			{	//If this hand position is in the active track difficulty
 				eof_clear_input();
-				if(!user_warned && alert("Warning:  This track difficulty's existing fret hand positions will be replaced.", NULL, "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+				if(!user_warned && eof_alert("Warning:  This track difficulty's existing fret hand positions will be replaced.", NULL, "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 				{	//If the user doesn't opt to replace the existing fret hand positions
 					eof_cursor_visible = 1;
 					eof_pen_visible = 1;
@@ -2900,7 +2901,7 @@ void eof_rebuild_manage_rs_phrases_strings(void)
 	}
 	if(!eof_track_manage_rs_phrases_strings)
 	{
-		allegro_message("Error allocating memory");
+		eof_message("Error allocating memory");
 		return;
 	}
 	for(ctr = 0, index = 0; ctr < eof_song->beats; ctr++)
@@ -2918,7 +2919,7 @@ void eof_rebuild_manage_rs_phrases_strings(void)
 			eof_track_manage_rs_phrases_strings[index] = malloc(stringlen + 1);	//Allocate memory to build the string
 			if(!eof_track_manage_rs_phrases_strings[index])
 			{
-				allegro_message("Error allocating memory");
+				eof_message("Error allocating memory");
 				for(ctr = 0; ctr < index; ctr++)
 				{	//Free previously allocated strings
 					free(eof_track_manage_rs_phrases_strings[ctr]);
@@ -3061,7 +3062,7 @@ int eof_track_manage_rs_phrases_add_or_remove_level(int function)
 	if(instancectr > 1)
 	{
 		eof_clear_input();
-		if(alert(NULL, "Modify all instances of the selected phrase?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Modify all instances of the selected phrase?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to increase the level of all instances of the selected phrase
 			ctr = 0;	//Parse the beats below starting from the first
 		}
@@ -3110,7 +3111,7 @@ int eof_track_manage_rs_phrases_add_or_remove_level(int function)
 
 	if(!undo_made)
 	{	//If no notes were within the selected phrase instance(s)
-		allegro_message("The selected phrase instance(s) had no notes at or above the current difficulty, so no alterations were performed.");
+		eof_message("The selected phrase instance(s) had no notes at or above the current difficulty, so no alterations were performed.");
 	}
 	else
 	{	//Otherwise remove the difficulty limit since this operation has modified the chart
@@ -3210,7 +3211,7 @@ int eof_menu_track_open_strum(void)
 				eof_pen_visible = 0;
 				eof_show_mouse(screen);
 				eof_clear_input();
-				if(alert(NULL, "Warning: Open bass strum notes must have other lanes cleared to enable open bass.  Continue?", NULL, "&Yes", "&No", 'y', 'n') == 2)
+				if(eof_alert(NULL, "Warning: Open bass strum notes must have other lanes cleared to enable open bass.  Continue?", NULL, "&Yes", "&No", 'y', 'n') == 2)
 				{	//If user opts cancel the save
 					eof_show_mouse(NULL);
 					eof_cursor_visible = 1;
@@ -3301,7 +3302,7 @@ int eof_track_erase_track_difficulty(void)
 	}
 
 	eof_clear_input();
-	if(alert(NULL, "This operation will erase this track difficulty's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+	if(eof_alert(NULL, "This operation will erase this track difficulty's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 	{	//If the user does not opt to erase the track difficulty
 		return 1;	//Cancel
 	}
@@ -3324,7 +3325,7 @@ int eof_track_erase_track(void)
 	}
 
 	eof_clear_input();
-	if(alert(NULL, "This operation will erase this track's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+	if(eof_alert(NULL, "This operation will erase this track's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 	{	//If user does not opt to erase the track
 		return 1;	//Cancel
 	}
@@ -3485,7 +3486,7 @@ void eof_track_rebuild_rs_tone_changes_list_strings(void)
 		eof_track_rs_tone_changes_list_strings[ctr] = malloc(stringlen);	//Allocate memory to build the string
 		if(!eof_track_rs_tone_changes_list_strings[ctr])
 		{
-			allegro_message("Error allocating memory");
+			eof_message("Error allocating memory");
 			while(ctr > 0)
 			{	//Free previously allocated strings
 				free(eof_track_rs_tone_changes_list_strings[ctr - 1]);
@@ -3887,7 +3888,7 @@ void eof_track_rebuild_rs_tone_names_list_strings(unsigned long track, char allo
 		eof_track_rs_tone_names_list_strings[index] = malloc(stringlen);
 		if(!eof_track_rs_tone_names_list_strings[index])
 		{
-			allegro_message("Error allocating memory");
+			eof_message("Error allocating memory");
 			while(index > 0)
 			{	//Free previously allocated strings
 				free(eof_track_rs_tone_names_list_strings[index - 1]);
@@ -4101,7 +4102,7 @@ int eof_menu_track_copy_tone_changes_track_number(EOF_SONG *sp, unsigned long so
 	if(dtp->tonechanges)
 	{	//If there are already tone changes in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing tone changes in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing tone changes in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -4156,7 +4157,7 @@ int eof_menu_track_copy_popups_track_number(EOF_SONG *sp, unsigned long sourcetr
 	if(dtp->popupmessages)
 	{	//If there are already popup messages in the destination track
 		eof_clear_input();
-		if(alert(NULL, "Warning:  Existing popup messages in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Warning:  Existing popup messages in this track will be lost.  Continue?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to continue
 			return 0;
 		}
@@ -4248,6 +4249,10 @@ int eof_menu_track_clone_track_number(EOF_SONG *sp, unsigned long sourcetrack, u
 	unsigned long stracknum, dtracknum, noteset, notesetcount = 1, ctr;
 	EOF_TRACK_ENTRY *parent;
 	EOF_PRO_GUITAR_NOTE **setptr;
+	EOF_NOTE **legacynotes;							//Back up the destination track's dynamically allocated arrays, they aren't shared with the source track
+	EOF_PRO_GUITAR_NOTE **pgnotes, **technotes;
+	EOF_PHRASE_SECTION *handpositions;
+	unsigned long notecapacity, technotecapacity, handpositioncapacity;
 	int populated = 1;	//Set to nonzero if the destination track is found to contain no notes
 	char s_restore_tech_view = 0, d_restore_tech_view = 0;	//Store the original tech view states of the source/destination tracks if applicable
 
@@ -4258,7 +4263,7 @@ int eof_menu_track_clone_track_number(EOF_SONG *sp, unsigned long sourcetrack, u
 
 	if((sourcetrack == EOF_TRACK_DANCE) || (desttrack == EOF_TRACK_DANCE))
 	{
-		allegro_message("Cannot clone between dance and non dance tracks");
+		eof_message("Cannot clone between dance and non dance tracks");
 		return 0;	//Invalid parameters
 	}
 
@@ -4268,7 +4273,7 @@ int eof_menu_track_clone_track_number(EOF_SONG *sp, unsigned long sourcetrack, u
 	{	//If the destination track isn't populated in either note set (either normal or tech notes)
 		populated = 0;
 	}
-	if(populated && alert(NULL, "This operation will replace this track's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+	if(populated && eof_alert(NULL, "This operation will replace this track's contents.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 	{	//If user does not opt to replace the track
 		return 1;	//Cancel
 	}
@@ -4287,9 +4292,13 @@ int eof_menu_track_clone_track_number(EOF_SONG *sp, unsigned long sourcetrack, u
 	switch(sp->track[sourcetrack]->track_format)
 	{
 		case EOF_LEGACY_TRACK_FORMAT:
-			parent = sp->legacy_track[dtracknum]->parent;	//Back up this pointer
+			parent = sp->legacy_track[dtracknum]->parent;	//Back up these pointers
+			legacynotes = sp->legacy_track[dtracknum]->note;
+			notecapacity = sp->legacy_track[dtracknum]->note_capacity;
 			memcpy(sp->legacy_track[dtracknum], sp->legacy_track[stracknum], sizeof(EOF_LEGACY_TRACK));
-			sp->legacy_track[dtracknum]->parent = parent;	//Restore this pointer
+			sp->legacy_track[dtracknum]->parent = parent;	//Restore these pointers
+			sp->legacy_track[dtracknum]->note = legacynotes;
+			sp->legacy_track[dtracknum]->note_capacity = notecapacity;
 			sp->legacy_track[dtracknum]->notes = 0;			//Clear the note count
 			if(desttrack == EOF_TRACK_KEYS)
 			{	//The keys track must be forced to remain at 5 lanes
@@ -4300,11 +4309,30 @@ int eof_menu_track_clone_track_number(EOF_SONG *sp, unsigned long sourcetrack, u
 		case EOF_PRO_GUITAR_TRACK_FORMAT:
 			parent = sp->pro_guitar_track[dtracknum]->parent;	//Back up these pointers
 			setptr = sp->pro_guitar_track[dtracknum]->note;
+			pgnotes = sp->pro_guitar_track[dtracknum]->pgnote;
+			notecapacity = sp->pro_guitar_track[dtracknum]->pgnote_capacity;
+			technotes = sp->pro_guitar_track[dtracknum]->technote;
+			technotecapacity = sp->pro_guitar_track[dtracknum]->technote_capacity;
+			handpositions = sp->pro_guitar_track[dtracknum]->handposition;
+			handpositioncapacity = sp->pro_guitar_track[dtracknum]->handposition_capacity;
 			s_restore_tech_view = eof_menu_track_get_tech_view_state(sp, sourcetrack);	//Track which note set each track was in
 			d_restore_tech_view = eof_menu_track_get_tech_view_state(sp, desttrack);
 			memcpy(sp->pro_guitar_track[dtracknum], sp->pro_guitar_track[stracknum], sizeof(EOF_PRO_GUITAR_TRACK));
 			sp->pro_guitar_track[dtracknum]->parent = parent;	//Restore these pointers
 			sp->pro_guitar_track[dtracknum]->note = setptr;
+			sp->pro_guitar_track[dtracknum]->pgnote = pgnotes;
+			sp->pro_guitar_track[dtracknum]->pgnote_capacity = notecapacity;
+			sp->pro_guitar_track[dtracknum]->technote = technotes;
+			sp->pro_guitar_track[dtracknum]->technote_capacity = technotecapacity;
+			sp->pro_guitar_track[dtracknum]->handposition = handpositions;
+			sp->pro_guitar_track[dtracknum]->handposition_capacity = handpositioncapacity;
+			sp->pro_guitar_track[dtracknum]->handpositions = 0;
+			if(eof_pro_guitar_track_reserve_hand_positions(sp->pro_guitar_track[dtracknum], sp->pro_guitar_track[stracknum]->handpositions))
+			{	//If the destination track can hold the source track's fret hand positions, copy them
+				sp->pro_guitar_track[dtracknum]->handpositions = sp->pro_guitar_track[stracknum]->handpositions;
+				if(sp->pro_guitar_track[stracknum]->handpositions)
+					memcpy(sp->pro_guitar_track[dtracknum]->handposition, sp->pro_guitar_track[stracknum]->handposition, sizeof(EOF_PHRASE_SECTION) * sp->pro_guitar_track[stracknum]->handpositions);
+			}
 			sp->pro_guitar_track[dtracknum]->notes = sp->pro_guitar_track[dtracknum]->pgnotes = sp->pro_guitar_track[dtracknum]->technotes = 0;	//Clear the note counts
 			notesetcount = 2;	//Pro guitar tracks have the normal notes AND tech notes that need to be cloned
 		break;
@@ -4439,7 +4467,7 @@ int eof_track_fret_hand_positions_generate_all(void)
 	if(tp->handpositions)
 	{	//If the active track has at least one fret hand position already
 		eof_clear_input();
-		if(alert(NULL, "Existing fret hand positions for the active track will be removed.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+		if(eof_alert(NULL, "Existing fret hand positions for the active track will be removed.", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user does not opt to remove the existing hand positions
 			return 1;
 		}
@@ -4753,22 +4781,22 @@ int eof_menu_track_repair_grid_snap(void)
 		newnotecount = eof_get_track_size_all(eof_song, eof_selected_track);	//Read the number of note (and tech notes if applicable)
 		if(oldnotecount > newnotecount)
 		{	//If one or more notes were lost (ie. merged) since the changes
-			allegro_message("Warning:  %lu notes were lost (ie. merged with other notes) during the repair.  Please undo if this is unwanted.", oldnotecount - newnotecount);
+			eof_message("Warning:  %lu notes were lost (ie. merged with other notes) during the repair.  Please undo if this is unwanted.", oldnotecount - newnotecount);
 		}
 		if(eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
 		{	//If a pro guitar track is active
 			if(eof_technote_auto_adjust)
 			{	//If the "Auto-adjust tech notes" preference is enabled
-				allegro_message("%lu note%s and %lu tech note%s were moved.", count, countplurality, tncount, tncountplurality);
+				eof_message("%lu note%s and %lu tech note%s were moved.", count, countplurality, tncount, tncountplurality);
 			}
 			else
 			{
-				allegro_message("%lu note%s %s moved.  Auto-adjustment of tech notes (in File>Preferences>Preferences) is not currently enabled.", count, countplurality, verbplurality);
+				eof_message("%lu note%s %s moved.  Auto-adjustment of tech notes (in File>Preferences>Preferences) is not currently enabled.", count, countplurality, verbplurality);
 			}
 		}
 		else
 		{
-			allegro_message("%lu note%s %s moved.", count, countplurality, verbplurality);
+			eof_message("%lu note%s %s moved.", count, countplurality, verbplurality);
 		}
 	}
 
@@ -4806,7 +4834,7 @@ int eof_menu_track_clone_track_to_clipboard(void)
 	fp = pack_fopen(clipboard_path, "w");
 	if(!fp)
 	{
-		allegro_message("Clipboard error!");
+		eof_message("Clipboard error!");
 		return 3;	//Clipboard write error
 	}
 	eof_log("\tCloning to clipboard", 1);
@@ -4886,14 +4914,12 @@ int eof_menu_track_clone_track_to_clipboard(void)
 		(void) pack_iputl(sectioncount, fp);	//Write the number of instances of this section type
 		if(sectioncount)
 		{
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tProcessing %lu instances of section type %lu", sectioncount, sectiontype);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\tProcessing %lu instances of section type %lu", sectioncount, sectiontype);
 		}
 
 		for(sectionnum = 0; sectionnum < sectioncount; sectionnum++)
 		{	//For each instance of this type of section in the track
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tCloning section instance %lu", sectionnum + 1);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\t\tCloning section instance %lu", sectionnum + 1);
 
 			content_found = 1;
 			(void) pack_iputl(eof_get_beat(eof_song, phrase[sectionnum].start_pos), fp);	//Write the beat number in which this section starts
@@ -4954,7 +4980,7 @@ int eof_menu_track_clone_track_to_clipboard(void)
 
 	if(!content_found)
 	{
-		allegro_message("There was no content found in the track.");
+		eof_message("There was no content found in the track.");
 		(void) delete_file(clipboard_path);
 	}
 
@@ -4995,7 +5021,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 	fp = pack_fopen(clipboard_path, "r");
 	if(!fp)
 	{
-		allegro_message("Cannot access clipboard.");
+		eof_message("Cannot access clipboard.");
 		return 2;	//Clipboard read error
 	}
 	sourcetrack = pack_getc(fp);		//Read the source track of the clipboard data
@@ -5014,7 +5040,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 		tp = eof_song->pro_guitar_track[eof_song->track[eof_selected_track]->tracknum];
 	if(source_vocal != dest_vocal)
 	{
-		allegro_message("Cannot clone between vocal and non vocal tracks");
+		eof_message("Cannot clone between vocal and non vocal tracks");
 		(void) pack_fclose(fp);
 		return 4;	//Invalid clone operation
 	}
@@ -5025,7 +5051,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 		dest_dance = 1;
 	if(source_dance != dest_dance)
 	{
-		allegro_message("Cannot clone between dance and non dance tracks");
+		eof_message("Cannot clone between dance and non dance tracks");
 		(void) pack_fclose(fp);
 		return 4;	//Invalid clone operation
 	}
@@ -5033,7 +5059,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 	eof_log("\tCloning from clipboard", 1);
 
 	//Prompt user
-	if(eof_get_track_size_all(eof_song, eof_selected_track) && alert("This track already has notes", "Cloning from the clipboard will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+	if(eof_get_track_size_all(eof_song, eof_selected_track) && eof_alert("This track already has notes", "Cloning from the clipboard will overwrite this track's contents", "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 	{	//If the active track is already populated (with normal or tech notes) and the user doesn't opt to overwrite it
 		(void) pack_fclose(fp);
 		return 5;	//User cancellation
@@ -5110,7 +5136,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 				if(!eof_song_append_beats(eof_song, 1))
 				{	//If there was an error adding a beat
 					eof_log("\tError adding beat (notes).  Aborting", 1);
-					allegro_message("Error adding beat (notes).  Aborting");
+					eof_message("Error adding beat (notes).  Aborting");
 					eof_erase_track(eof_song, eof_selected_track);
 					(void) pack_fclose(fp);
 					return 6;
@@ -5141,7 +5167,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 			if(!np)
 			{	//If the note was not created
 				eof_log("\tError adding note.  Aborting", 1);
-				allegro_message("Error adding note.  Aborting");
+				eof_message("Error adding note.  Aborting");
 				eof_erase_track(eof_song, eof_selected_track);
 				(void) pack_fclose(fp);
 				return 7;
@@ -5184,13 +5210,11 @@ int eof_menu_track_clone_track_from_clipboard(void)
 		sectioncount = pack_igetl(fp);	//Read the number of instances of this section type
 		if(sectioncount)
 		{
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tProcessing %lu instances of section type %lu", sectioncount, sectiontype);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\tProcessing %lu instances of section type %lu", sectioncount, sectiontype);
 		}
 		for(sectionnum = 0; sectionnum < sectioncount; sectionnum++)
 		{	//For each instance of this type of section in the track
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tCloning section instance %lu", sectionnum + 1);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\t\tCloning section instance %lu", sectionnum + 1);
 
 			beat = pack_igetl(fp);	//Read the beat number in which this section starts
 			(void) pack_fread(&pos, (long)sizeof(double), fp);	//Read the percentage into the beat at which this section starts
@@ -5200,7 +5224,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 			if((beat < 0) || (endbeat < 0))
 			{	//If an invalid value was read
 				eof_log("\tError determining phrase timing.  Aborting", 1);
-				allegro_message("Error determining phrase timing.  Aborting");
+				eof_message("Error determining phrase timing.  Aborting");
 				(void) pack_fclose(fp);
 				return 8;	//Return error
 			}
@@ -5235,7 +5259,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 				if(!eof_song_append_beats(eof_song, 1))
 				{	//If there was an error adding a beat
 					eof_log("\tError adding beat (phrase).  Aborting", 1);
-					allegro_message("Error adding beat (phrase).  Aborting");
+					eof_message("Error adding beat (phrase).  Aborting");
 					eof_erase_track(eof_song, eof_selected_track);
 					(void) pack_fclose(fp);
 					return 9;
@@ -5247,7 +5271,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 			if(!eof_track_add_section(eof_song, eof_selected_track, sectiontype, sectiondiff, start, end, sectionflags, name))
 			{	//If the section couldn't be added
 				eof_log("\tError adding section.  Aborting", 1);
-				allegro_message("Error adding section.  Aborting");
+				eof_message("Error adding section.  Aborting");
 				eof_erase_track(eof_song, eof_selected_track);
 				(void) pack_fclose(fp);
 				return 10;
@@ -5293,7 +5317,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 			if(!eof_song_append_beats(eof_song, 1))
 			{	//If there was an error adding a beat
 				eof_log("\tError adding beat (event).  Aborting", 1);
-				allegro_message("Error adding beat (event).  Aborting");
+				eof_message("Error adding beat (event).  Aborting");
 				eof_erase_track(eof_song, eof_selected_track);
 				(void) pack_fclose(fp);
 				return 11;
@@ -5305,7 +5329,7 @@ int eof_menu_track_clone_track_from_clipboard(void)
 		if(!eof_song_add_text_event(eof_song, beatnum, text, eof_selected_track, eventflags, 0))
 		{	//If the event couldn't be added
 			eof_log("\tError adding event.  Aborting", 1);
-			allegro_message("Error adding event.  Aborting");
+			eof_message("Error adding event.  Aborting");
 			eof_erase_track(eof_song, eof_selected_track);
 			(void) pack_fclose(fp);
 			return 12;
@@ -5376,7 +5400,7 @@ int eof_track_menu_enable_ghl_mode(void)
 
 	if(lane_6_gem)
 	{
-		allegro_message("Warning:  Lane 3 white GHL gems will be converted to 5 note chords.");
+		eof_message("Warning:  Lane 3 white GHL gems will be converted to 5 note chords.");
 	}
 	ep = eof_song->track[eof_selected_track];		//Simplify
 	ep->flags ^= EOF_TRACK_FLAG_GHL_MODE;			//Toggle this flag
@@ -5396,7 +5420,7 @@ int eof_track_menu_enable_ghl_mode(void)
 		{	//If the conversion of a chord containing a lane 3 white gem caused a loss of original authoring
 			if(!warning)
 			{	//If the user wasn't already warned about this
-				allegro_message("Warning:  Chords containing lane 3 white GHL gems can't be authored in a non GHL track.  These were converted to 5 note chords and highlighted.");
+				eof_message("Warning:  Chords containing lane 3 white GHL gems can't be authored in a non GHL track.  These were converted to 5 note chords and highlighted.");
 				warning = 1;
 			}
 		}
@@ -5515,7 +5539,7 @@ int eof_menu_track_offset(void)
 	eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 	if(eof_adjust_notes(eof_selected_track, offset) == 0)
 	{	//The operation failed
-		allegro_message("Cannot offset content to a position earlier than 0ms.  The operation will be canceled.");
+		eof_message("Cannot offset content to a position earlier than 0ms.  The operation will be canceled.");
 		(void) eof_undo_apply();	//Undo this failed operation
 	}
 
@@ -5560,7 +5584,7 @@ int eof_menu_track_check_chord_snapping(void)
 	{	//If there are notes that should be snapped into chords
 		eof_render();
 		eof_clear_input();
-		if(alert("At least one note would chord snap with the specified threshold", "These have been highlighted", "Re-align the gems to make them proper chords?", "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert("At least one note would chord snap with the specified threshold", "These have been highlighted", "Re-align the gems to make them proper chords?", "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to automatically fix the unsnapped chords
 			eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 			eof_song_check_unsnapped_chords(eof_song, eof_selected_track, 1, timing, threshold);
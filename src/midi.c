@@ -21,19 +21,116 @@
 #include "memwatch.h"
 #endif
 
-static EOF_MIDI_EVENT * eof_midi_event[EOF_MAX_MIDI_EVENTS];
+#define EOF_MIDI_EVENT_BLOCK_SIZE 4096	//The number of event structures allocated at a time
+
+typedef struct EOF_MIDI_EVENT_BLOCK
+{
+	struct EOF_MIDI_EVENT_BLOCK *next;
+	EOF_MIDI_EVENT event[EOF_MIDI_EVENT_BLOCK_SIZE];
+} EOF_MIDI_EVENT_BLOCK;
+
+typedef struct
+{
+	EOF_MIDI_EVENT **event;	//The note on/off events added for this note number, in the order they were added
+	unsigned long count, max;
+	char unsorted;			//Is set to nonzero if an event was added at an earlier position than the previous one, in which case the list can't be binary searched
+} EOF_MIDI_NOTE_INDEX;
+
+static EOF_MIDI_EVENT ** eof_midi_event = NULL;	//Grows as needed, the event structures themselves are allocated from eof_midi_event_blocks
 static unsigned long eof_midi_events = 0;
-static char eof_midi_event_full = 0;			//Is set to nonzero when an overflow of the eof_midi_event[] array was prevented, is reset by eof_clear_midi_events()
+static unsigned long eof_midi_events_max = 0;	//The number of pointers eof_midi_event[] can currently hold
+static EOF_MIDI_EVENT_BLOCK *eof_midi_event_blocks = NULL;	//The list of event blocks, which are kept by eof_clear_midi_events() so the next track can reuse them
+static EOF_MIDI_EVENT_BLOCK *eof_midi_event_block = NULL;	//The block events are currently being allocated from
+static unsigned long eof_midi_event_block_used = 0;			//The number of events used in eof_midi_event_block
+static EOF_MIDI_NOTE_INDEX eof_midi_note_index[128];		//The note on/off events for each note number, used by eof_midi_note_already_added()
+static char eof_midi_event_full = 0;			//Is set to nonzero when memory for an event couldn't be allocated, is reset by eof_clear_midi_events()
 static char eof_midi_note_status[128] = {0};	//Used by some functions to track the on/off status of notes 0 through 127
 unsigned long enddelta = 0, endbeatnum = 0;		//If these becomes nonzero, they define the position of a user-defined end event
 
+static EOF_MIDI_EVENT *eof_midi_event_alloc(void)
+{
+	EOF_MIDI_EVENT *ptr;
+
+	if(eof_midi_events >= eof_midi_events_max)
+	{	//If eof_midi_event[] needs to grow
+		unsigned long newmax = eof_midi_events_max ? eof_midi_events_max * 2 : EOF_MIDI_EVENT_BLOCK_SIZE;
+		EOF_MIDI_EVENT **newarray = realloc(eof_midi_event, sizeof(EOF_MIDI_EVENT *) * newmax);
+
+		if(!newarray)
+			return NULL;
+		eof_midi_event = newarray;
+		eof_midi_events_max = newmax;
+	}
+	if(!eof_midi_event_block || (eof_midi_event_block_used >= EOF_MIDI_EVENT_BLOCK_SIZE))
+	{	//If the current block is full, move to the next one
+		EOF_MIDI_EVENT_BLOCK *next = eof_midi_event_block ? eof_midi_event_block->next : eof_midi_event_blocks;
+
+		if(!next)
+		{	//If there isn't a block left over from a previous track, allocate one
+			next = malloc(sizeof(EOF_MIDI_EVENT_BLOCK));
+			if(!next)
+				return NULL;
+			next->next = NULL;
+			if(eof_midi_event_block)
+				eof_midi_event_block->next = next;
+			else
+				eof_midi_event_blocks = next;
+		}
+		eof_midi_event_block = next;
+		eof_midi_event_block_used = 0;
+	}
+	ptr = &eof_midi_event_block->event[eof_midi_event_block_used++];
+	memset(ptr, 0, sizeof(EOF_MIDI_EVENT));
+	eof_midi_event[eof_midi_events++] = ptr;
+
+	return ptr;
+}
+
+static void eof_midi_event_alloc_failed(void)
+{
+	if(!eof_midi_event_full)
+	{
+		eof_log("Error:  Could not allocate memory for MIDI event.", 1);
+		eof_midi_event_full = 1;
+	}
+}
+
+static void eof_midi_note_index_add(EOF_MIDI_EVENT *ptr)
+{
+	EOF_MIDI_NOTE_INDEX *index;
+
+	if((ptr->note < 0) || (ptr->note > 127))
+		return;	//Only legal MIDI notes are indexed
+
+	index = &eof_midi_note_index[ptr->note];
+	if(index->count >= index->max)
+	{	//If the index for this note number needs to grow
+		unsigned long newmax = index->max ? index->max * 2 : 64;
+		EOF_MIDI_EVENT **newarray = realloc(index->event, sizeof(EOF_MIDI_EVENT *) * newmax);
+
+		if(!newarray)
+		{	//If the index couldn't grow, eof_midi_note_already_added() will fall back to checking every event
+			index->unsorted = 2;
+			return;
+		}
+		index->event = newarray;
+		index->max = newmax;
+	}
+	if(index->count && (ptr->pos < index->event[index->count - 1]->pos))
+	{	//If this event is earlier than the last one indexed for this note number
+		if(!index->unsorted)
+			index->unsorted = 1;
+	}
+	index->event[index->count++] = ptr;
+}
+
 void eof_add_midi_event(unsigned long pos, int type, int note, int velocity, int channel)
 {	//To avoid rounding issues during timing conversion, this should be called with the MIDI tick position of the event being stored
 	char note_off = 0;	//Will be set to non zero if this is a note off event
 	char note_on = 0;	//Will be set to non zero if this is a note on event
+	EOF_MIDI_EVENT *ptr;
 
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tAdding MIDI event:  Pos = %lu, type = 0x%X, note = %d, vel = %d, ch = %d", pos, type, note, velocity, channel);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tAdding MIDI event:  Pos = %lu, type = 0x%X, note = %d, vel = %d, ch = %d", pos, type, note, velocity, channel);
 
 	if(enddelta && (pos > enddelta))
 		return;	//If attempting to write an event that exceeds a user-defined end event, don't do it
@@ -49,46 +146,36 @@ void eof_add_midi_event(unsigned long pos, int type, int note, int velocity, int
 		note_on = 1;
 	}
 
-	if(eof_midi_events < EOF_MAX_MIDI_EVENTS)
-	{	//If eof_midi_event[] is able to store more events
-		eof_midi_event[eof_midi_events] = malloc(sizeof(EOF_MIDI_EVENT));
-		if(eof_midi_event[eof_midi_events])
-		{
-			eof_midi_event[eof_midi_events]->pos = pos;
-			eof_midi_event[eof_midi_events]->type = type;
-			eof_midi_event[eof_midi_events]->note = note;
-			eof_midi_event[eof_midi_events]->velocity = velocity;
-			eof_midi_event[eof_midi_events]->channel = channel;
-			eof_midi_event[eof_midi_events]->allocation = 0;
-			eof_midi_event[eof_midi_events]->filtered = 0;
-			eof_midi_event[eof_midi_events]->dp = NULL;
-			eof_midi_event[eof_midi_events]->on = note_on;
-			eof_midi_event[eof_midi_events]->off = note_off;
-			eof_midi_event[eof_midi_events]->length = 0;	//The calling function is required to set this for HOPO on/off marker's Note Off event
-			eof_midi_event[eof_midi_events]->needle = 0;	//Calling function must manually set this if wanted
-			eof_midi_events++;
-
-			if((note >= 0) && (note <= 127))
-			{	//If the note is in bounds of a legal MIDI note, track the writing of each on/off status
-				if(note_off)	//Note Off
-					eof_midi_note_status[note] = 0;
-				else if(note_on)	//Note On
-					eof_midi_note_status[note] = 1;
-			}
-		}
-	}
-	else
+	ptr = eof_midi_event_alloc();
+	if(!ptr)
 	{
-		if(!eof_midi_event_full)
-		{
-			eof_log("Error:  The number of MIDI events that can be handled has been exceeded.", 1);
-			eof_midi_event_full = 1;
-		}
+		eof_midi_event_alloc_failed();
+		return;
+	}
+	ptr->pos = pos;
+	ptr->type = type;
+	ptr->note = note;
+	ptr->velocity = velocity;
+	ptr->channel = channel;
+	ptr->on = note_on;
+	ptr->off = note_off;
+	//The calling function is required to set the length for HOPO on/off marker's Note Off event
+	//The calling function must manually set the needle if wanted
+	eof_midi_note_index_add(ptr);
+
+	if((note >= 0) && (note <= 127))
+	{	//If the note is in bounds of a legal MIDI note, track the writing of each on/off status
+		if(note_off)	//Note Off
+			eof_midi_note_status[note] = 0;
+		else if(note_on)	//Note On
+			eof_midi_note_status[note] = 1;
 	}
 }
 
 void eof_add_midi_lyric_event(unsigned long pos, char * text, char allocation)
 {	//To avoid rounding issues during timing conversion, this should be called with the MIDI tick position of the event being stored
+	EOF_MIDI_EVENT *ptr;
+
 	eof_log("eof_add_midi_lyric_event() entered", 2);	//Only log this if verbose logging is on
 
 	if(enddelta && (pos > enddelta))
@@ -96,38 +183,25 @@ void eof_add_midi_lyric_event(unsigned long pos, char * text, char allocation)
 
 	if(text)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tAdding lyric:  pos: %lums\ttext: %s", pos, text);
-		eof_log(eof_log_string, 2);
+		eof_logf(2, "\tAdding lyric:  pos: %lums\ttext: %s", pos, text);
 
-		if(eof_midi_events < EOF_MAX_MIDI_EVENTS)
-		{	//If eof_midi_event[] is able to store more events
-			eof_midi_event[eof_midi_events] = malloc(sizeof(EOF_MIDI_EVENT));
-			if(eof_midi_event[eof_midi_events])
-			{
-				eof_midi_event[eof_midi_events]->pos = pos;
-				eof_midi_event[eof_midi_events]->type = 0x05;
-				eof_midi_event[eof_midi_events]->dp = text;
-				eof_midi_event[eof_midi_events]->allocation = allocation;
-				eof_midi_event[eof_midi_events]->filtered = 0;
-				eof_midi_event[eof_midi_events]->on = 0;
-				eof_midi_event[eof_midi_events]->off = 0;
-				eof_midi_event[eof_midi_events]->needle = 0;	//Calling function must manually set this if wanted
-				eof_midi_events++;
-			}
-			else
-			{
-				if(!eof_midi_event_full)
-				{
-					eof_log("Error:  The number of MIDI events that can be handled has been exceeded.", 1);
-					eof_midi_event_full = 1;
-				}
-			}
+		ptr = eof_midi_event_alloc();
+		if(!ptr)
+		{
+			eof_midi_event_alloc_failed();
+			return;
 		}
+		ptr->pos = pos;
+		ptr->type = 0x05;
+		ptr->dp = text;
+		ptr->allocation = allocation;
 	}
 }
 
 void eof_add_midi_text_event(unsigned long pos, char * text, char allocation, unsigned long index)
 {	//To avoid rounding issues during timing conversion, this should be called with the MIDI tick position of the event being stored
+	EOF_MIDI_EVENT *ptr;
+
 	eof_log("eof_add_midi_text_event() entered", 2);	//Only log this if verbose logging is on
 
 	if(enddelta && (pos > enddelta))
@@ -135,75 +209,47 @@ void eof_add_midi_text_event(unsigned long pos, char * text, char allocation, un
 
 	if(text)
 	{
-		if(eof_midi_events < EOF_MAX_MIDI_EVENTS)
-		{	//If eof_midi_event[] is able to store more events
-			eof_midi_event[eof_midi_events] = malloc(sizeof(EOF_MIDI_EVENT));
-			if(eof_midi_event[eof_midi_events])
-			{
-				eof_midi_event[eof_midi_events]->pos = pos;
-				eof_midi_event[eof_midi_events]->type = 0x01;
-				eof_midi_event[eof_midi_events]->dp = text;
-				eof_midi_event[eof_midi_events]->allocation = allocation;
-				eof_midi_event[eof_midi_events]->filtered = 0;
-				eof_midi_event[eof_midi_events]->on = 0;
-				eof_midi_event[eof_midi_events]->off = 0;
-				eof_midi_event[eof_midi_events]->index = index;
-				eof_midi_event[eof_midi_events]->needle = 0;	//Calling function must manually set this if wanted
-				eof_midi_events++;
-			}
-			else
-			{
-				if(!eof_midi_event_full)
-				{
-					eof_log("Error:  The number of MIDI events that can be handled has been exceeded.", 1);
-					eof_midi_event_full = 1;
-				}
-			}
+		ptr = eof_midi_event_alloc();
+		if(!ptr)
+		{
+			eof_midi_event_alloc_failed();
+			return;
 		}
+		ptr->pos = pos;
+		ptr->type = 0x01;
+		ptr->dp = text;
+		ptr->allocation = allocation;
+		ptr->index = index;
 	}
 }
 
 void eof_add_sysex_event(unsigned long pos, int size, void *data, char sysexon)
 {	//To avoid rounding issues during timing conversion, this should be called with the MIDI tick position of the event being stored
 	void *datacopy = NULL;
+	EOF_MIDI_EVENT *ptr;
 
 	eof_log("eof_add_sysex_event() entered", 2);	//Only log this if verbose logging is on
 
 	if((size > 0) && data)
 	{
-		if(eof_midi_events < EOF_MAX_MIDI_EVENTS)
-		{	//If eof_midi_event[] is able to store more events
-			eof_midi_event[eof_midi_events] = malloc(sizeof(EOF_MIDI_EVENT));
-			if(eof_midi_event[eof_midi_events])
-			{
-				datacopy = malloc((size_t)size);
-				if(datacopy)
-				{
-					memcpy(datacopy, data, (size_t)size);	//Copy the input data into the new buffer
-					eof_midi_event[eof_midi_events]->pos = pos;
-					eof_midi_event[eof_midi_events]->type = 0xF0;
-					eof_midi_event[eof_midi_events]->note = size;	//Store the size of the Sysex message in the note variable
-					eof_midi_event[eof_midi_events]->dp = (char *)datacopy;	//Store the newly buffered data
-					eof_midi_event[eof_midi_events]->allocation = 1;	//At this time, all Sysex data chunks are stored in memory allocated within this function
-					eof_midi_event[eof_midi_events]->filtered = 0;
-					eof_midi_event[eof_midi_events]->on = 0;
-					eof_midi_event[eof_midi_events]->off = 0;
-					eof_midi_event[eof_midi_events]->sysexon = sysexon;
-					eof_midi_event[eof_midi_events]->needle = 0;	//Calling function must manually set this if wanted
-					eof_midi_events++;
-				}
-			}
-			else
-			{
-				if(!eof_midi_event_full)
-				{
-					eof_log("Error:  The number of MIDI events that can be handled has been exceeded.", 1);
-					eof_midi_event_full = 1;
-				}
-			}
+		datacopy = malloc((size_t)size);
+		if(!datacopy)
+			return;
+		ptr = eof_midi_event_alloc();
+		if(!ptr)
+		{
+			free(datacopy);
+			eof_midi_event_alloc_failed();
+			return;
 		}
+		memcpy(datacopy, data, (size_t)size);	//Copy the input data into the new buffer
+		ptr->pos = pos;
+		ptr->type = 0xF0;
+		ptr->note = size;	//Store the size of the Sysex message in the note variable
+		ptr->dp = (char *)datacopy;	//Store the newly buffered data
+		ptr->allocation = 1;	//At this time, all Sysex data chunks are stored in memory allocated within this function
+		ptr->sysexon = sysexon;
 	}
-	// cppcheck-suppress memleak symbolName=datacopy	//Cppcheck generates a false positive when the allocted memory's pointer is stored into a global array
 }
 
 unsigned long eof_find_midi_event_needle(unsigned char num)
@@ -232,20 +278,78 @@ void eof_clear_midi_events(void)
 		{	//If this event has memory allocated for data
 			free(eof_midi_event[i]->dp);	//Free it now
 		}
-		free(eof_midi_event[i]);
 	}
 	eof_midi_events = 0;
 	eof_midi_event_full = 0;
+	eof_midi_event_block = NULL;	//Start reusing the allocated event blocks from the first one
+	eof_midi_event_block_used = 0;
+	for(i = 0; i < 128; i++)
+	{	//Empty the index of each note number, keeping its memory
+		eof_midi_note_index[i].count = 0;
+		eof_midi_note_index[i].unsorted = 0;
+	}
+}
+
+void eof_destroy_midi_events(void)
+{
+	unsigned long i;
+	EOF_MIDI_EVENT_BLOCK *next;
+
+	eof_clear_midi_events();
+	while(eof_midi_event_blocks)
+	{	//Free each event block
+		next = eof_midi_event_blocks->next;
+		free(eof_midi_event_blocks);
+		eof_midi_event_blocks = next;
+	}
+	if(eof_midi_event)
+		free(eof_midi_event);
+	eof_midi_event = NULL;
+	eof_midi_events_max = 0;
+	for(i = 0; i < 128; i++)
+	{
+		if(eof_midi_note_index[i].event)
+			free(eof_midi_note_index[i].event);
+		eof_midi_note_index[i].event = NULL;
+		eof_midi_note_index[i].max = 0;
+	}
 }
 
 int eof_midi_note_already_added(unsigned long deltastart, unsigned long deltaend, int note)
 {
-	unsigned long ctr;
+	unsigned long ctr, first, last, mid;
+	EOF_MIDI_NOTE_INDEX *index;
+
+	if((note < 0) || (note > 127) || (eof_midi_note_index[note].unsorted > 1))
+	{	//If the note number isn't indexed, or its index is incomplete, check every stored MIDI event
+		for(ctr = 0; ctr < eof_midi_events; ctr++)
+		{	//For each stored MIDI event
+			if((eof_midi_event[ctr]->pos >= deltastart) && (eof_midi_event[ctr]->pos <= deltaend) && (eof_midi_event[ctr]->note == note))
+				return 1;	//The note already exists
+		}
+		return 0;
+	}
 
-	for(ctr = 0; ctr < eof_midi_events; ctr++)
-	{	//For each stored MIDI event
-		if((eof_midi_event[ctr]->pos >= deltastart) && (eof_midi_event[ctr]->pos <= deltaend) && (eof_midi_event[ctr]->note == note))
+	index = &eof_midi_note_index[note];
+	first = 0;
+	if(!index->unsorted)
+	{	//If the note's events were added in chronological order, binary search for the first one at or after the start of the range
+		last = index->count;
+		while(first < last)
+		{
+			mid = first + (last - first) / 2;
+			if(index->event[mid]->pos < deltastart)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+	}
+	for(ctr = first; ctr < index->count; ctr++)
+	{	//For each indexed event of this note number (starting with the first one in range if the list is sorted)
+		if((index->event[ctr]->pos >= deltastart) && (index->event[ctr]->pos <= deltaend))
 			return 1;	//The note already exists
+		if(!index->unsorted && (index->event[ctr]->pos > deltaend))
+			break;	//The remaining events are after the range
 	}
 
 	return 0;
@@ -422,12 +526,12 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 {
 	unsigned char header[14] = {'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1, 0, 1, (EOF_DEFAULT_TIME_DIVISION >> 8), (EOF_DEFAULT_TIME_DIVISION & 0xFF)}; //The last two bytes are the time division
 	unsigned long timedivision = EOF_DEFAULT_TIME_DIVISION;	//Unless the project is storing a tempo track, EOF's default time division will be used
-	char notetempname[EOF_TRACKS_MAX+1][25];
+	char notetempname[EOF_TRACKS_MAX+1][40];
 	char notetrackspopulated[EOF_TRACKS_MAX+1] = {0};
-	char expertplustempname[30];	//Stores the temporary filename for the Expert+ track data
-	char tempotempname[30];
-	char eventtempname[30];
-	char beattempname[30];
+	char expertplustempname[40];	//Stores the temporary filename for the Expert+ track data
+	char tempotempname[40];
+	char eventtempname[40];
+	char beattempname[40];
 	char expertplusfilename[1024] = {0};
 	char expertplusshortname[30];
 	char *tempotrackname;
@@ -458,7 +562,8 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 	int channel = 0, velocity = 0, scale, last_scale, chord = 0, isslash = 0, bassnote = 0;	//Used for pro guitar export
 	unsigned long bitmask;
 	EOF_PHRASE_SECTION *sectionptr;
-	char *currentname = NULL, chordname[100]="";
+	const char *currentname = NULL;
+	char chordname[100]="";
 	unsigned char phase_shift_sysex_phrase[8] = {'P','S','\0',0,0,0,0,0xF7};	//This is used to write Sysex messages for features supported in Phase Shift (ie. open strum)
 	char fret_hand_pos_written;					//This is used to track whether the track's fret hand positions were completely written yet
 	char fret_hand_positions_generated;			//This is used to track whether fret hand positions were automatically generated for an exported pro guitar/bass track's expert difficulty
@@ -509,15 +614,15 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 	header[12] = timedivision >> 8;		//Update the MIDI header to reflect the time division (which may have changed if a stored tempo track is present)
 	header[13] = timedivision & 0xFF;
 
-	//Generate temporary filenames
-	(void) snprintf(expertplustempname, sizeof(expertplustempname) - 1, "%sexpert+.tmp", eof_temp_path_s);
-	(void) snprintf(tempotempname, sizeof(tempotempname) - 1, "%stempo.tmp", eof_temp_path_s);
-	(void) snprintf(eventtempname, sizeof(eventtempname) - 1, "%sevent.tmp", eof_temp_path_s);
-	(void) snprintf(beattempname, sizeof(beattempname) - 1, "%sbeat.tmp", eof_temp_path_s);
+	//Generate temporary filenames, including this instance's ID so that concurrently running instances don't share them
+	(void) snprintf(expertplustempname, sizeof(expertplustempname) - 1, "%sexpert+%03u.tmp", eof_temp_path_s, eof_log_id);
+	(void) snprintf(tempotempname, sizeof(tempotempname) - 1, "%stempo%03u.tmp", eof_temp_path_s, eof_log_id);
+	(void) snprintf(eventtempname, sizeof(eventtempname) - 1, "%sevent%03u.tmp", eof_temp_path_s, eof_log_id);
+	(void) snprintf(beattempname, sizeof(beattempname) - 1, "%sbeat%03u.tmp", eof_temp_path_s, eof_log_id);
 	(void) snprintf(expertplusshortname, sizeof(expertplusshortname) - 1, "%sexpert+.mid", eof_temp_path_s);
 	for(i = 0; i < EOF_TRACKS_MAX+1; i++)
 	{
-		(void) snprintf(notetempname[i], sizeof(notetempname[i]) - 1, "%seof%lu.tmp", eof_temp_path_s, i);
+		(void) snprintf(notetempname[i], sizeof(notetempname[i]) - 1, "%seof%03u-%lu.tmp", eof_temp_path_s, eof_log_id, i);
 	}
 
 	eof_sort_notes(sp);	//Writing efficient on-the-fly HOPO phrasing relies on all notes being sorted
@@ -1356,8 +1461,7 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 				for(i = 0; i < eof_get_num_sliders(sp, j); i++)
 				{	//For each slider in the track
 					sectionptr = eof_get_slider(sp, j, i);
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tAdding slider #%lu: Start = %lums, stop = %lums", i, sectionptr->start_pos, sectionptr->end_pos);
-					eof_log(eof_log_string, 2);
+					eof_logf(2, "\t\tAdding slider #%lu: Start = %lums, stop = %lums", i, sectionptr->start_pos, sectionptr->end_pos);
 					deltapos = eof_ConvertToDeltaTime(sectionptr->start_pos, anchorlist, tslist, timedivision, 1, has_stored_tempo);	//Store the tick position of the phrase
 					deltalength = eof_ConvertToDeltaTime(sectionptr->end_pos, anchorlist, tslist, timedivision, 0, 1) - deltapos;		//Store the number of delta ticks representing the phrase's length
 					if(deltalength < 1)
@@ -1383,9 +1487,9 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 			}
 
 			if(eof_midi_event_full)
-			{	//If the track exceeded the number of MIDI events that could be written
-				allegro_message("Error:  Too many MIDI events, aborting MIDI export.");
-				eof_log("Error:  Too many MIDI events, aborting MIDI export.", 1);
+			{	//If memory for one of the track's MIDI events couldn't be allocated
+				eof_message("Error:  Not enough memory to store the MIDI events, aborting MIDI export.");
+				eof_log("Error:  Not enough memory to store the MIDI events, aborting MIDI export.", 1);
 				eof_destroy_ks_list(kslist);		//Free memory used by the KS change list
 				eof_destroy_tempo_list(anchorlist);	//Free memory used by the anchor list
 				eof_destroy_ts_list(tslist);		//Free memory used by the TS change list
@@ -1399,13 +1503,13 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 					continue;	//If this note was not left on, skip it
 
 				//Otherwise send an alert message, as this is abnormal
-				allegro_message("MIDI export error:  Note %lu was not turned off", i);
+				eof_message("MIDI export error:  Note %lu was not turned off", i);
 				eof_log("MIDI export error:  Note %lu was not turned off", 1);
 				if(endbeatnum)
 				{	//If the chart has a manually defined end event, that's probably the cause
 					eof_log("\tend event was manually defined", 1);
 					eof_clear_input();
-					if(alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to seek to the offending event
 						eof_set_seek_position(sp->beat[endbeatnum]->pos + eof_av_delay);
 						eof_selected_beat = endbeatnum;
@@ -1418,21 +1522,18 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 				return 0;	//Return failure
 			}
 			qsort(eof_midi_event, (size_t)eof_midi_events, sizeof(EOF_MIDI_EVENT *), qsort_helper3);
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Post-sort event content:  %lu events", eof_midi_events);
-			eof_log(eof_log_string, 3);
+			eof_logf(3, "Post-sort event content:  %lu events", eof_midi_events);
 			eof_log_midi_event_list();
 
 			eof_check_for_note_overlap();	//Filter out any improperly overlapping note on/off events
 			eof_check_for_hopo_phrase_overlap();	//Ensure that no HOPO on/off phrases start/end at the same delta position as each other
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Post-overlap removal event content:  %lu events", eof_midi_events);
-			eof_log(eof_log_string, 3);
+			eof_logf(3, "Post-overlap removal event content:  %lu events", eof_midi_events);
 			eof_log_midi_event_list();
 
 			qsort(eof_midi_event, (size_t)eof_midi_events, sizeof(EOF_MIDI_EVENT *), qsort_helper3);	//Re-sort, since the previous function may have changed the events' order
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Post-sort event content:  %lu events", eof_midi_events);
-			eof_log(eof_log_string, 3);
+			eof_logf(3, "Post-sort event content:  %lu events", eof_midi_events);
 			eof_log_midi_event_list();
-//			allegro_message("break1");
+//			eof_message("break1");
 
 			for(trackctr = 0; trackctr <= expertplus; trackctr++)
 			{	//This loop makes a second pass to write the expert+ drum MIDI if applicable
@@ -1682,9 +1783,9 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 			}
 
 			if(eof_midi_event_full)
-			{	//If the track exceeded the number of MIDI events that could be written
-				allegro_message("Error:  Too many MIDI events, aborting MIDI export.");
-				eof_log("Error:  Too many MIDI events, aborting MIDI export.", 1);
+			{	//If memory for one of the track's MIDI events couldn't be allocated
+				eof_message("Error:  Not enough memory to store the MIDI events, aborting MIDI export.");
+				eof_log("Error:  Not enough memory to store the MIDI events, aborting MIDI export.", 1);
 				eof_destroy_ks_list(kslist);		//Free memory used by the KS change list
 				eof_destroy_ts_list(tslist);		//Free memory used by the TS change list
 				eof_destroy_tempo_list(anchorlist);	//Free memory used by the anchor list
@@ -1698,13 +1799,13 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 					continue;	//If this note was not left on, skip it
 
 				//Otherwise send an alert message, as this is abnormal
-				allegro_message("MIDI export error:  Note %lu was not turned off", i);
+				eof_message("MIDI export error:  Note %lu was not turned off", i);
 				eof_log("MIDI export error:  Note %lu was not turned off", 1);
 				if(endbeatnum)
 				{	//If the chart has a manually defined end event, that's probably the cause
 					eof_log("\tend event was manually defined", 1);
 					eof_clear_input();
-					if(alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to seek to the offending event
 						eof_set_seek_position(sp->beat[endbeatnum]->pos + eof_av_delay);
 						eof_selected_beat = endbeatnum;
@@ -1833,7 +1934,7 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 					{	//If there was at least one note in the Expert difficulty, and fret hand positions couldn't be generated automatically, alert the user
 						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error:  Failed to automatically generate fret hand positions for \"%s\" during MIDI export.", sp->track[j]->name);
 						eof_log(eof_log_string, 1);
-						allegro_message("%s", eof_log_string);
+						eof_message("%s", eof_log_string);
 					}
 				}
 			}
@@ -2158,7 +2259,7 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 					{	//If the user opted to write a single fret hand position of 1 for this pro guitar/bass track
 						if(fret_hand_positions_present && !fret_hand_positions_generated && !fret_hand_pos_override_warning)
 						{	//If this track had manually defined fret hand positions, and they are being overridden by the song property to define a single fret hand position at fret 1
-							allegro_message("Warning:  This track has fret hand positions, but the song property to write a single fret hand position is overriding them");
+							eof_message("Warning:  This track has fret hand positions, but the song property to write a single fret hand position is overriding them");
 							eof_log("Warning:  This track has fret hand positions, but the song property to write a single fret hand position is overriding them", 1);
 							fret_hand_pos_override_warning = 1;
 						}
@@ -2336,9 +2437,9 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 			}
 
 			if(eof_midi_event_full)
-			{	//If the track exceeded the number of MIDI events that could be written
-				allegro_message("Error:  Too many MIDI events, aborting MIDI export.");
-				eof_log("Error:  Too many MIDI events, aborting MIDI export.", 1);
+			{	//If memory for one of the track's MIDI events couldn't be allocated
+				eof_message("Error:  Not enough memory to store the MIDI events, aborting MIDI export.");
+				eof_log("Error:  Not enough memory to store the MIDI events, aborting MIDI export.", 1);
 				eof_destroy_ts_list(tslist);		//Free memory used by the TS change list
 				eof_destroy_ks_list(kslist);		//Free memory used by the KS change list
 				eof_destroy_tempo_list(anchorlist);	//Free memory used by the anchor list
@@ -2352,13 +2453,13 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 					continue;	//If this note was not left on, skip it
 
 				//Otherwise send an alert message, as this is abnormal
-				allegro_message("MIDI export error:  Note %lu was not turned off", i);
+				eof_message("MIDI export error:  Note %lu was not turned off", i);
 				eof_log("MIDI export error:  Note %lu was not turned off", 1);
 				if(endbeatnum)
 				{	//If the chart has a manually defined end event, that's probably the cause
 					eof_clear_input();
 					eof_log("\tend event was manually defined", 1);
-					if(alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to seek to the offending event
 						eof_set_seek_position(sp->beat[endbeatnum]->pos + eof_av_delay);
 						eof_selected_beat = endbeatnum;
@@ -2372,7 +2473,7 @@ int eof_export_midi(EOF_SONG * sp, char * fn, char featurerestriction, char fixv
 			}
 			qsort(eof_midi_event, (size_t)eof_midi_events, sizeof(EOF_MIDI_EVENT *), qsort_helper3);
 			eof_check_for_note_overlap();	//Filter out any improperly overlapping note on/off events
-//			allegro_message("break1");
+//			eof_message("break1");
 
 			/* open the file */
 			fp = pack_fopen(notetempname[j], "w");
@@ -2840,9 +2941,9 @@ int eof_export_music_midi(EOF_SONG *sp, char *fn, char format)
 	struct eof_MIDI_data_track *trackptr;		//Used to count the number of raw MIDI tracks to export
 	EOF_MIDI_KS_LIST *kslist;
 	#define EOF_MUSIC_MIDI_TRACKS_MAX (EOF_PRO_GUITAR_TRACKS_MAX + EOF_PRO_GUITAR_TRACKS_MAX + EOF_VOCAL_TRACKS_MAX + 1)
-	char notetempname[EOF_MUSIC_MIDI_TRACKS_MAX][25] = {{0}};	//The list of temporary files created to store the binary content for each MIDI track, a maximum potential of two copies of each pro guitar track and one of each vocal track
-	char tempotempname[30];
-	char eventtempname[30];
+	char notetempname[EOF_MUSIC_MIDI_TRACKS_MAX][40] = {{0}};	//The list of temporary files created to store the binary content for each MIDI track, a maximum potential of two copies of each pro guitar track and one of each vocal track
+	char tempotempname[40];
+	char eventtempname[40];
 	unsigned char pitchmask, pitches[6] = {0};
 	char *name, notename[EOF_NAME_LENGTH+1] = {0};
 	char eventstrackwritten = 0;			//Tracks whether an events track has been written
@@ -2889,12 +2990,12 @@ int eof_export_music_midi(EOF_SONG *sp, char *fn, char format)
 	header[12] = timedivision >> 8;		//Update the MIDI header to reflect the time division (which may have changed if a stored tempo track is present)
 	header[13] = timedivision & 0xFF;
 
-	//Generate temporary filenames
-	(void) snprintf(tempotempname, sizeof(tempotempname) - 1, "%stempo.tmp", eof_temp_path_s);
-	(void) snprintf(eventtempname, sizeof(eventtempname) - 1, "%sevent.tmp", eof_temp_path_s);
+	//Generate temporary filenames, including this instance's ID so that concurrently running instances don't share them
+	(void) snprintf(tempotempname, sizeof(tempotempname) - 1, "%stempo%03u.tmp", eof_temp_path_s, eof_log_id);
+	(void) snprintf(eventtempname, sizeof(eventtempname) - 1, "%sevent%03u.tmp", eof_temp_path_s, eof_log_id);
 	for(i = 0; i < EOF_MUSIC_MIDI_TRACKS_MAX; i++)
 	{
-		(void) snprintf(notetempname[i], sizeof(notetempname[i]) - 1, "%seof%lu.tmp", eof_temp_path_s, i);
+		(void) snprintf(notetempname[i], sizeof(notetempname[i]) - 1, "%seof%03u-%lu.tmp", eof_temp_path_s, eof_log_id, i);
 	}
 
 	eof_sort_notes(sp);
@@ -3030,7 +3131,7 @@ int eof_export_music_midi(EOF_SONG *sp, char *fn, char format)
 				//Write note name or lyric text if applicable
 				if(sp->track[j]->track_format == EOF_VOCAL_TRACK_FORMAT)
 				{	//If a lyric is being exported
-					name = eof_get_note_name(sp, j, i);
+					name = eof_get_lyric_text(sp, j, i);
 					if(name && (name[0] != '\0'))
 					{	//If the lyric has defined text
 						eof_add_midi_lyric_event(deltapos, name, 0);	//Track that the lyric text was NOT dynamically allocated
@@ -3050,9 +3151,9 @@ int eof_export_music_midi(EOF_SONG *sp, char *fn, char format)
 				}
 
 				if(eof_midi_event_full)
-				{	//If the track exceeded the number of MIDI events that could be written
-					allegro_message("Error:  Too many MIDI events, aborting MIDI export.");
-					eof_log("Error:  Too many MIDI events, aborting MIDI export.", 1);
+				{	//If memory for one of the track's MIDI events couldn't be allocated
+					eof_message("Error:  Not enough memory to store the MIDI events, aborting MIDI export.");
+					eof_log("Error:  Not enough memory to store the MIDI events, aborting MIDI export.", 1);
 					eof_destroy_ks_list(kslist);		//Free memory used by the KS change list
 					eof_destroy_ts_list(tslist);		//Free memory used by the TS change list
 					eof_destroy_tempo_list(anchorlist);	//Free memory used by the anchor list
@@ -3068,13 +3169,13 @@ int eof_export_music_midi(EOF_SONG *sp, char *fn, char format)
 					continue;	//If this note was not left on, skip it
 
 				//Otherwise send an alert message, as this is abnormal
-				allegro_message("MIDI export error:  Note %lu was not turned off", i);
+				eof_message("MIDI export error:  Note %lu was not turned off", i);
 				eof_log("MIDI export error:  Note %lu was not turned off", 1);
 				if(endbeatnum)
 				{	//If the chart has a manually defined end event, that's probably the cause
 					eof_clear_input();
 					eof_log("\tend event was manually defined", 1);
-					if(alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("It appears this is due to an [end] event that cuts out a note early", "Would you like to seek to the beat containing this [end] event?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 					{	//If user opts to seek to the offending event
 						eof_set_seek_position(sp->beat[endbeatnum]->pos + eof_av_delay);
 						eof_selected_beat = endbeatnum;
@@ -3093,7 +3194,7 @@ int eof_export_music_midi(EOF_SONG *sp, char *fn, char format)
 			/* open the file */
 			if(trackcounter >= EOF_MUSIC_MIDI_TRACKS_MAX)
 			{	//If this function attempted to store more tracks than it was prepared for
-				allegro_message("Error:  Too many MIDI tracks, aborting MIDI export.");
+				eof_message("Error:  Too many MIDI tracks, aborting MIDI export.");
 				eof_log("Error:  Too many MIDI tracks, aborting MIDI export.", 1);
 				eof_destroy_ks_list(kslist);		//Free memory used by the KS change list
 				eof_destroy_ts_list(tslist);		//Free memory used by the TS change list
@@ -3390,8 +3491,7 @@ struct Tempo_change *eof_add_to_tempo_list(unsigned long delta, double realtime,
 	{
 		eof_log("eof_add_to_tempo_list() entered", 3);
 
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tAdding tempo change:  Delta = %lu, pos = %f, BPM = %f", delta, realtime, BPM);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "\tAdding tempo change:  Delta = %lu, pos = %f, BPM = %f", delta, realtime, BPM);
 	}
 
 //Allocate and initialize new link
@@ -3417,12 +3517,193 @@ struct Tempo_change *eof_add_to_tempo_list(unsigned long delta, double realtime,
 	return ptr;			//Return original head link
 }
 
+typedef struct
+{
+	unsigned long pos;			//The grid snap position, rounded to the nearest millisecond
+	unsigned short rank;		//The order in which eof_ConvertToDeltaTime() would have tested this grid snap, the lowest rank wins when several positions match
+	unsigned short delta;		//The grid snap's delta tick offset from the start of the beat (gridsnapnum * beatlength_delta / interval), which is less than one beat's length in delta ticks
+} EOF_MIDI_SNAP_POS;
+
+typedef struct
+{
+	EOF_MIDI_SNAP_POS *snap;		//The beat's unique grid snap positions, sorted by position, or NULL if the beat's grid snaps aren't used for quantization
+	unsigned long snaps;
+} EOF_MIDI_BEAT_SNAP;
+
+static struct
+{
+	EOF_SONG *sp;						//The chart the table was built for
+	struct Tempo_change *anchorlist;	//The tempo and TS lists the table was built for, the table is only used when these are passed to eof_ConvertToDeltaTime()
+	EOF_MIDI_TS_LIST *tslist;
+	unsigned long tschanges;			//The number of TS changes when the table was built
+	EOF_MIDI_BEAT_SNAP *beat;			//The grid snap table for each beat
+	unsigned long beats;
+	struct Tempo_change **tempo;		//The tempo changes in the order of the linked list, if they are in chronological order
+	unsigned long tempos;
+	char tssorted;						//Nonzero if the TS changes are in chronological order and can be binary searched
+} eof_midi_delta_table = {NULL, NULL, NULL, 0, NULL, 0, NULL, 0, 0};
+
+static int eof_midi_snap_pos_qsort(const void * e1, const void * e2)
+{
+	const EOF_MIDI_SNAP_POS *thing1 = (const EOF_MIDI_SNAP_POS *)e1;
+	const EOF_MIDI_SNAP_POS *thing2 = (const EOF_MIDI_SNAP_POS *)e2;
+
+	if(thing1->pos < thing2->pos)
+		return -1;
+	if(thing1->pos > thing2->pos)
+		return 1;
+	if(thing1->rank < thing2->rank)
+		return -1;
+	if(thing1->rank > thing2->rank)
+		return 1;
+	return 0;
+}
+
+static void eof_destroy_delta_conversion_table(void)
+{
+	unsigned long ctr;
+
+	if(eof_midi_delta_table.beat)
+	{
+		for(ctr = 0; ctr < eof_midi_delta_table.beats; ctr++)
+		{
+			if(eof_midi_delta_table.beat[ctr].snap)
+				free(eof_midi_delta_table.beat[ctr].snap);
+		}
+		free(eof_midi_delta_table.beat);
+	}
+	if(eof_midi_delta_table.tempo)
+		free(eof_midi_delta_table.tempo);
+	memset(&eof_midi_delta_table, 0, sizeof(eof_midi_delta_table));
+}
+
+static void eof_build_delta_conversion_table(EOF_SONG *sp, struct Tempo_change *anchorlist, EOF_MIDI_TS_LIST *tslist)
+{
+	unsigned long ctr, ctr2, interval, gridsnapnum, rank, count;
+	struct Tempo_change *temp;
+	EOF_MIDI_SNAP_POS *snap, *shrunk;
+
+	eof_destroy_delta_conversion_table();
+	if(!sp || !anchorlist || !tslist)
+		return;	//Invalid parameters
+
+	//Store the tempo changes in an array so they can be binary searched
+	for(temp = anchorlist, count = 0; temp != NULL; temp = temp->next, count++);
+	eof_midi_delta_table.tempo = malloc(sizeof(struct Tempo_change *) * count);
+	eof_midi_delta_table.beat = malloc(sizeof(EOF_MIDI_BEAT_SNAP) * (sp->beats ? sp->beats : 1));
+	if(!eof_midi_delta_table.tempo || !eof_midi_delta_table.beat)
+	{
+		eof_destroy_delta_conversion_table();
+		return;
+	}
+	for(temp = anchorlist, ctr = 0; temp != NULL; temp = temp->next, ctr++)
+	{
+		eof_midi_delta_table.tempo[ctr] = temp;
+		if(ctr && (temp->realtime < eof_midi_delta_table.tempo[ctr - 1]->realtime))
+		{	//If the tempo changes aren't in chronological order, the linked list will be walked instead
+			free(eof_midi_delta_table.tempo);
+			eof_midi_delta_table.tempo = NULL;
+			break;
+		}
+	}
+	if(eof_midi_delta_table.tempo)
+		eof_midi_delta_table.tempos = count;
+	eof_midi_delta_table.tssorted = 1;
+	for(ctr = 1; ctr < tslist->changes; ctr++)
+	{
+		if(tslist->change[ctr]->realtime < tslist->change[ctr - 1]->realtime)
+			eof_midi_delta_table.tssorted = 0;	//The TS changes will be scanned linearly instead
+	}
+
+	//Build the grid snap positions of each beat, in the same order eof_ConvertToDeltaTime() used to test them
+	memset(eof_midi_delta_table.beat, 0, sizeof(EOF_MIDI_BEAT_SNAP) * (sp->beats ? sp->beats : 1));
+	eof_midi_delta_table.beats = sp->beats;
+	for(ctr = 0; ctr < sp->beats; ctr++)
+	{	//For each beat
+		double beatlength = eof_calc_beat_length(sp, ctr);
+		unsigned num = 4, den = 4;
+		unsigned long beatlength_delta;
+
+		if(beatlength < 1.0)
+			continue;	//If a suitable beat length wasn't obtained, this beat isn't quantized
+		if(!eof_get_effective_ts(sp, &num, &den, ctr, 0))
+			continue;	//If the time signature of the beat wasn't obtained, this beat isn't quantized
+		beatlength_delta = EOF_DEFAULT_TIME_DIVISION * 4 / den;	//One beat is considered to be (EOF_DEFAULT_TIME_DIVISION * 4 / TS_DENOMINATOR) delta ticks in length
+
+		for(interval = 2, count = 0; interval < EOF_MAX_GRID_SNAP_INTERVALS; interval++)
+		{	//Count the grid snaps of all usable intervals
+			if(beatlength_delta % interval == 0)
+				count += interval;
+		}
+		if(!count)
+			continue;
+		snap = malloc(sizeof(EOF_MIDI_SNAP_POS) * count);
+		if(!snap)
+			continue;	//This beat will be converted without quantization
+
+		for(interval = 2, rank = 0; interval < EOF_MAX_GRID_SNAP_INTERVALS; interval++)
+		{	//Check all of the possible supported custom grid snap intervals
+			double snaplength;
+
+			if(beatlength_delta % interval != 0)
+				continue;	//If the beat's delta length isn't divisible by this interval, skip it
+
+			snaplength = beatlength / (double) interval;	//Determine the real time length of one such grid snap interval
+			for(gridsnapnum = 0; gridsnapnum < interval; gridsnapnum++, rank++)
+			{	//For each instance of that grid snap
+				snap[rank].pos = (sp->beat[ctr]->fpos + (double)gridsnapnum * snaplength) + 0.5;
+				snap[rank].rank = rank;
+				snap[rank].delta = gridsnapnum * beatlength_delta / interval;
+			}
+		}
+		qsort(snap, (size_t)count, sizeof(EOF_MIDI_SNAP_POS), eof_midi_snap_pos_qsort);
+		for(ctr2 = 1, rank = 1; ctr2 < count; ctr2++)
+		{	//Keep only the first tested grid snap at each position
+			if(snap[ctr2].pos != snap[rank - 1].pos)
+				snap[rank++] = snap[ctr2];
+		}
+		shrunk = realloc(snap, sizeof(EOF_MIDI_SNAP_POS) * rank);	//Release the memory used by the duplicate positions
+		if(shrunk)
+			snap = shrunk;
+		eof_midi_delta_table.beat[ctr].snap = snap;
+		eof_midi_delta_table.beat[ctr].snaps = rank;
+	}
+
+	eof_midi_delta_table.sp = sp;
+	eof_midi_delta_table.anchorlist = anchorlist;
+	eof_midi_delta_table.tslist = tslist;
+	eof_midi_delta_table.tschanges = tslist->changes;
+}
+
+static EOF_MIDI_SNAP_POS *eof_find_delta_conversion_snap(EOF_MIDI_BEAT_SNAP *bs, unsigned long pos)
+{
+	unsigned long first = 0, last = bs->snaps, mid;
+
+	while(first < last)
+	{	//Binary search for the grid snap at this position
+		mid = first + (last - first) / 2;
+		if(bs->snap[mid].pos < pos)
+			first = mid + 1;
+		else if(bs->snap[mid].pos > pos)
+			last = mid;
+		else
+			return &bs->snap[mid];
+	}
+
+	return NULL;
+}
+
 void eof_destroy_tempo_list(struct Tempo_change *ptr)
 {
 	struct Tempo_change *temp = NULL;
 
 	eof_log("eof_destroy_tempo_list() entered", 1);
 
+	if(ptr && (ptr == eof_midi_delta_table.anchorlist))
+	{	//If the grid snap table was built for this tempo list, it is no longer valid
+		eof_destroy_delta_conversion_table();
+	}
+
 	while(ptr != NULL)
 	{
 		temp=ptr->next;	//Store this pointer
@@ -3443,15 +3724,39 @@ unsigned long eof_ConvertToDeltaTime(double realtime, struct Tempo_change *ancho
 	unsigned long ctr;
 	unsigned long realtimeint = realtime;	//The integer representation of the target timestamp is used in the grid snap matching logic
 	unsigned long beatnum, gridsnapnum, interval;
+	char usetable;	//Set to nonzero if the lists were built by eof_build_tempo_and_ts_lists() and its precomputed table can be used
 
 	assert_wrapper(temp != NULL);	//Ensure the tempomap is populated
+	usetable = (eof_midi_delta_table.anchorlist == anchorlist) && (eof_midi_delta_table.tslist == tslist) && (eof_midi_delta_table.sp == eof_song) && tslist && (tslist->changes == eof_midi_delta_table.tschanges);
 
 	//Determine if a clean delta value can be obtained with integer math, depending on whether the specified timestamp falls within
 	//a 1/# beat interval where the beat's delta length is divisible by #
 	if(!disablequantize)
 	{	//Only do this if the calling function didn't prevent it
 		beatnum = eof_get_beat(eof_song, realtime + 0.5);	//Round to nearest ms to compare against integer beat timings
-		if(beatnum < eof_song->beats)
+		if(usetable)
+		{	//If the beat's grid snap positions were precomputed, look up the target timestamp and the positions within 1ms of it to account for rounding error
+			if((beatnum < eof_midi_delta_table.beats) && eof_midi_delta_table.beat[beatnum].snaps && (eof_song->beat[beatnum]->midi_pos < ULONG_MAX))
+			{
+				EOF_MIDI_BEAT_SNAP *bs = &eof_midi_delta_table.beat[beatnum];
+				EOF_MIDI_SNAP_POS *match, *best = eof_find_delta_conversion_snap(bs, realtimeint);
+
+				match = eof_find_delta_conversion_snap(bs, realtimeint + 1);
+				if(match && (!best || (match->rank < best->rank)))
+					best = match;
+				if(realtimeint)
+				{
+					match = eof_find_delta_conversion_snap(bs, realtimeint - 1);
+					if(match && (!best || (match->rank < best->rank)))
+						best = match;
+				}
+				if(best)
+				{	//If the target timestamp matches a grid snap position
+					return eof_song->beat[beatnum]->midi_pos + best->delta;
+				}
+			}
+		}
+		else if(beatnum < eof_song->beats)
 		{	//If the beat containing this timestamp was identified
 			double beatlength = eof_calc_beat_length(eof_song, beatnum);
 			if(beatlength >= 1.0)
@@ -3489,7 +3794,25 @@ unsigned long eof_ConvertToDeltaTime(double realtime, struct Tempo_change *ancho
 	}
 
 //Find the last time signature change at or before the specified real time value
-	if((tslist != NULL) && (tslist->changes > 0))
+	if(usetable && eof_midi_delta_table.tssorted && (tslist->changes > 0))
+	{	//If the TS changes are in chronological order, binary search for the last one at or before the target realtime
+		unsigned long first = 0, last = tslist->changes, mid;
+
+		while(first < last)
+		{
+			mid = first + (last - first) / 2;
+			if(realtime >= tslist->change[mid]->realtime)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+		if(first)
+		{
+			tstime = tslist->change[first - 1]->realtime;	//Store the realtime position
+			tsdelta = tslist->change[first - 1]->pos;		//Store the delta time position
+		}
+	}
+	else if((tslist != NULL) && (tslist->changes > 0))
 	{	//If there's at least one TS change
 		for(ctr = 0; ctr < tslist->changes; ctr++)
 		{
@@ -3502,9 +3825,26 @@ unsigned long eof_ConvertToDeltaTime(double realtime, struct Tempo_change *ancho
 	}
 
 //Find the last tempo change at or before the specified real time value
-	while((temp->next != NULL) && (realtime >= (temp->next)->realtime))	//For each tempo change,
-	{	//If the tempo change is at or before the target realtime
-		temp = temp->next;	//Advance to that time stamp
+	if(usetable && eof_midi_delta_table.tempos)
+	{	//If the tempo changes are in chronological order, binary search for the last one at or before the target realtime
+		unsigned long first = 1, last = eof_midi_delta_table.tempos, mid;
+
+		while(first < last)
+		{
+			mid = first + (last - first) / 2;
+			if(realtime >= eof_midi_delta_table.tempo[mid]->realtime)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+		temp = eof_midi_delta_table.tempo[first - 1];
+	}
+	else
+	{
+		while((temp->next != NULL) && (realtime >= (temp->next)->realtime))	//For each tempo change,
+		{	//If the tempo change is at or before the target realtime
+			temp = temp->next;	//Advance to that time stamp
+		}
 	}
 
 //Find the latest tempo or TS change that occurs before the target realtime position and use that event's timing for the conversion
@@ -3552,7 +3892,7 @@ int eof_calculate_beat_delta_positions(EOF_SONG *sp, unsigned long timedivision)
 
 		if(eof_get_ts(sp, &num, &den, ctr) == -1)
 		{	//If the beat's time signature could not be read
-			allegro_message("eof_calculate_beat_delta_positions() error");
+			eof_message("eof_calculate_beat_delta_positions() error");
 			return 0;	//Error
 		}
 
@@ -3710,6 +4050,10 @@ void eof_destroy_ts_list(EOF_MIDI_TS_LIST *ptr)
 
 	eof_log("eof_destroy_ts_list() entered", 1);
 
+	if(ptr && (ptr == eof_midi_delta_table.tslist))
+	{	//If the grid snap table was built for this TS list, it is no longer valid
+		eof_destroy_delta_conversion_table();
+	}
 	if(ptr != NULL)
 	{
 		for(i = 0; i < ptr->changes; i++)
@@ -3814,6 +4158,20 @@ int eof_get_effective_ts(EOF_SONG *sp, unsigned *num, unsigned *den, unsigned lo
 	{	//If the calling function does not want to assume 4/4 in the absence of a defined time signature
 		numerator = denominator = 0;
 	}
+	if(eof_beat_stats_valid(sp) && (eof_get_ts(sp, NULL, NULL, beatnum) != 1))
+	{	//If the cached beat statistics are current and this beat doesn't define its own TS, use the TS in effect that was cached for it
+		if(sp->beat[beatnum]->has_ts)
+		{	//If a time signature is in effect at this beat
+			numerator = sp->beat[beatnum]->num_beats_in_measure;
+			denominator = sp->beat[beatnum]->beat_unit;
+		}
+		if(num)
+			*num = numerator;
+		if(den)
+			*den = denominator;
+
+		return 1;	//Return success
+	}
 	while(eof_get_ts(sp, &numerator, &denominator, beatnum) != 1)
 	{	//Until a TS change is seen, check each beat in reverse, from the selected beat to the first one
 		if(beatnum == 0)
@@ -3880,8 +4238,8 @@ int eof_apply_ts(unsigned num, unsigned den, unsigned long beatnum, EOF_SONG *sp
 		if(undo)	//If calling function specified to make an undo state (would be if applying the change to the active project)
 		{
 			eof_prepare_undo(EOF_UNDO_TYPE_NONE);	//Make an undo state
-			eof_beat_stats_cached = 0;				//Mark the cached beat stats as not current
 		}
+		eof_beat_stats_cached = 0;			//Mark the cached beat stats as not current
 		sp->beat[beatnum]->flags = flags;	//Apply the flag changes
 	}
 
@@ -4070,7 +4428,7 @@ void eof_MIDI_data_track_export(EOF_SONG *sp, PACKFILE *outf, struct Tempo_chang
 	struct eof_MIDI_data_event *eventptr;
 	char trackheader[4] = {'M', 'T', 'r', 'k'};
 	unsigned char endoftrack[3] = {0xFF, 0x2F, 0};
-	char tempfname[30];
+	char tempfname[40];
 	PACKFILE *tempf;
 	unsigned long lastdelta, deltapos, track_length, ctr;
 	char has_stored_tempo;		//Will be set to nonzero if the project contains a stored tempo track, which will affect timing conversion
@@ -4094,7 +4452,7 @@ void eof_MIDI_data_track_export(EOF_SONG *sp, PACKFILE *outf, struct Tempo_chang
 			continue;	//If this track is not a tempo track (which will be written in eof_export_midi() ), skip it
 
 		//Otherwise write the track's MIDI data to a temporary file so its size can be obtained easily
-		(void) snprintf(tempfname, sizeof(tempfname) - 1, "%smididatatemp.tmp", eof_temp_path_s);
+		(void) snprintf(tempfname, sizeof(tempfname) - 1, "%smididatatemp%03u.tmp", eof_temp_path_s, eof_log_id);	//Include this instance's ID so that concurrently running instances don't share the file
 		tempf = pack_fopen(tempfname, "w");	//Open temporary file for writing
 		if(!tempf)
 			return;
@@ -4157,7 +4515,7 @@ void eof_check_vocals(EOF_SONG* sp, char *fixvoxpitches, char *fixvoxphrases)
 			eof_pen_visible = 0;
 			eof_show_mouse(screen);
 			eof_clear_input();
-			if(alert(NULL, "Write pitchless lyrics as playable freestyle?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Write pitchless lyrics as playable freestyle?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If user opts to have the lyrics corrected, update the fixvoxpitches variable
 				*fixvoxpitches = 1;
 			}
@@ -4178,7 +4536,7 @@ void eof_check_vocals(EOF_SONG* sp, char *fixvoxpitches, char *fixvoxphrases)
 			eof_pen_visible = 0;
 			eof_show_mouse(screen);
 			eof_clear_input();
-			if(alert(NULL, "Add MIDI phrases for lyrics/percussions not in lyric phrases?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Add MIDI phrases for lyrics/percussions not in lyric phrases?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If user opts to have missing lyric phrases inserted
 				*fixvoxphrases = 1;
 			}
@@ -4317,6 +4675,7 @@ int eof_build_tempo_and_ts_lists(EOF_SONG *sp, struct Tempo_change **anchorlistp
 		}//For each event in the stored track
 	}//If building the tempo and TS lists from the stored tempo map
 
+	eof_build_delta_conversion_table(sp, anchorlist, tslist);	//Precompute the grid snap positions and searchable tempo/TS arrays used by eof_ConvertToDeltaTime()
 	*anchorlistptr = anchorlist;	//Return the tempo list through the pointer
 	*tslistptr = tslist;		//Return the TS list through the pointer
 	return 1;
@@ -4324,7 +4683,8 @@ int eof_build_tempo_and_ts_lists(EOF_SONG *sp, struct Tempo_change **anchorlistp
 
 void eof_check_for_note_overlap(void)
 {
-	unsigned long ctr, ctr2;
+	unsigned long ctr;
+	unsigned long pending_off[128] = {0};	//The number of upcoming note off events to filter for each note number, because their note on events were filtered
 
 	eof_log("eof_check_for_note_overlap() entered", 1);
 	memset(eof_midi_note_status,0,sizeof(eof_midi_note_status));	//Clear note status array
@@ -4338,14 +4698,7 @@ void eof_check_for_note_overlap(void)
 			if(eof_midi_note_status[eof_midi_event[ctr]->note] == 1)
 			{	//If this note was already on
 				eof_midi_event[ctr]->filtered = 1;	//Filter this event from being written to MIDI
-				for(ctr2 = ctr + 1; ctr2 < eof_midi_events; ctr2++)
-				{	//Examine the rest of the events to filter the next note off for this note #
-					if((eof_midi_event[ctr]->note == eof_midi_event[ctr2]->note) && (eof_midi_event[ctr2]->off) && (!eof_midi_event[ctr2]->filtered))
-					{	//If this event is a note off for the target note #, and it isn't already filtered out
-						eof_midi_event[ctr2]->filtered = 1;	//Filter this event from being written to MIDI
-						break;
-					}
-				}
+				pending_off[eof_midi_event[ctr]->note]++;	//Also filter the next note off for this note #, instead of searching ahead for it now
 			}
 			else
 			{
@@ -4354,7 +4707,12 @@ void eof_check_for_note_overlap(void)
 		}
 		else if(eof_midi_event[ctr]->off)
 		{	//If this is a note off event
-			if(eof_midi_note_status[eof_midi_event[ctr]->note] == 0)
+			if(pending_off[eof_midi_event[ctr]->note])
+			{	//If this note off pairs with a note on that was filtered
+				eof_midi_event[ctr]->filtered = 1;	//Filter this event from being written to MIDI
+				pending_off[eof_midi_event[ctr]->note]--;
+			}
+			else if(eof_midi_note_status[eof_midi_event[ctr]->note] == 0)
 			{	//If this note was already off
 				eof_midi_event[ctr]->filtered = 1;	//Filter this event from being written to MIDI
 			}
@@ -4587,7 +4945,6 @@ void eof_log_midi_event_list(void)
 	for(ctr = 0; ctr < eof_midi_events; ctr++)
 	{	//For each event in the list
 		ptr = &eof_midi_event[ctr];
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tMIDI event:  Pos = %lu, type = 0x%X, note = %d, vel = %d, ch = %d", (*ptr)->pos, (*ptr)->type, (*ptr)->note, (*ptr)->velocity, (*ptr)->channel);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "\tMIDI event:  Pos = %lu, type = 0x%X, note = %d, vel = %d, ch = %d", (*ptr)->pos, (*ptr)->type, (*ptr)->note, (*ptr)->velocity, (*ptr)->channel);
 	}
 }
@@ -7,7 +7,6 @@
 #define EOF_DEFAULT_TIME_DIVISION 480 // default time division used to convert midi_pos to msec_pos
 #define EOF_MAX_TS 500
 #define EOF_MAX_KS 100
-#define EOF_MAX_MIDI_EVENTS (EOF_MAX_NOTES * 4)
 
 //Rock Band 3 Pro drum markers (force as drum instead of cymbal)
 #define RB3_DRUM_YELLOW_FORCE 110	//Force the 2nd pad as a tom
@@ -108,6 +107,7 @@ unsigned long eof_ConvertToDeltaTime(double realtime, struct Tempo_change *ancho
 	//An adaptation of the ConvertToDeltaTime() function from the FoFLC source
 	//The specified real time position is checked against grid snap positions and a quantized delta time is returned when possible
 	//This logic expects that eof_calculate_beat_delta_positions() was called by the calling MIDI export function to initialize the chart's beat delta timings
+	//If the lists were built by eof_build_tempo_and_ts_lists(), its precomputed grid snap table is used to look up the timestamp and the tempo/TS changes are binary searched
 	//This logic is also incompatible with a stored tempo track, so disablequantize must be specified as nonzero if a stored tempo track is in use
 	//Otherwise, the timing is converted formulaically and can be vulnerable to floating point math/rounding errors
 	//Parses a linked list of anchors and returns the delta time of the specified realtime
@@ -175,6 +175,7 @@ int eof_build_tempo_and_ts_lists(EOF_SONG *sp, struct Tempo_change **anchorlistp
 	//If the passed chart contains a stored tempo track, that track is used to build the lists
 	//Otherwise the chart's native tempo map is used to build them
 	//If the passed chart contains a stored tempo track, that track's time division is returned via reference, otherwise EOF's default is returned via reference
+	//A table of each beat's grid snap positions is also built for eof_ConvertToDeltaTime(), it is discarded when either list is destroyed
 	//Nonzero is returned upon success
 void eof_check_vocals(EOF_SONG* sp, char *fixvoxpitches, char *fixvoxphrases);
 	//Scans the vocal tracks contained in the chart for missing pitches or vocal phrases
@@ -207,10 +208,14 @@ unsigned long eof_find_midi_event_needle(unsigned char num);
 	//Used to find the index of a specific event after the index changes after a sort operation
 	//Returns ULONG_MAX if no such event is found
 void eof_clear_midi_events(void);
-	//Frees the memory for all structures in eof_midi_event[], including any dynamically allocated strings
+	//Empties eof_midi_event[], freeing any dynamically allocated strings
+	//The event structures are allocated in blocks, which are kept so the next track's events can reuse them
 	//Resets the eof_midi_event_full variable to zero
+void eof_destroy_midi_events(void);
+	//Clears eof_midi_event[] and frees all memory used for storing MIDI events
 int eof_midi_note_already_added(unsigned long deltastart, unsigned long deltaend, int note);
 	//Returns nonzero if eof_midi_event[] already has a note on/off event anywhere within the specified delta times
+	//Uses an index of each note number's events, which reflects their positions at the time they were added with eof_add_midi_event()
 	//Used to avoid writing overlapping tom markers, since tom markers are now allowed to be written for tom notes in difficulties lower than expert
 void WriteVarLen(unsigned long value, PACKFILE * fp);
 	//Writes the specified value in variable length format to the specified file handle
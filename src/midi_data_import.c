@@ -339,7 +339,7 @@ struct eof_MIDI_data_track *eof_get_raw_MIDI_data(MIDI *midiptr, unsigned trackn
 					{	//If the offset is negative
 						if(-offset > preoffseted)
 						{	//If the offset is large enough to give an event a negative timestamp
-							allegro_message("Error:  Invalid negative MIDI delay");
+							eof_message("Error:  Invalid negative MIDI delay");
 							eof_log("\tError:  Invalid negative MIDI delay", 1);
 							eof_MIDI_empty_tempo_list(tempohead);
 							eof_MIDI_empty_event_list(head);
@@ -31,8 +31,9 @@ typedef struct
 
 typedef struct
 {
-	EOF_IMPORT_MIDI_EVENT * event[EOF_IMPORT_MAX_EVENTS];
+	EOF_IMPORT_MIDI_EVENT ** event;	//Grows as events are added, see eof_import_reserve_event()
 	unsigned long events;
+	unsigned long event_capacity;	//The number of entries allocated for event[]
 	int type;
 	int game;	//Is set to 0 to indicate a Frets on Fire, Rock Band or Guitar Hero style MIDI is being imported, 1 to indicate a Power Gig MIDI is being imported or 2 to indicate a Guitar Hero animation track is being imported
 	unsigned char diff;	//Some tracks (such as the pro keys and Power Gig tracks) have all of their contents applicable to a single difficulty level
@@ -66,7 +67,9 @@ static EOF_IMPORT_MIDI_EVENT_LIST * eof_import_create_events_list(void)
 	{
 		return NULL;
 	}
+	lp->event = NULL;
 	lp->events = 0;
+	lp->event_capacity = 0;
 	lp->type = -1;
 	lp->game = 0;
 	lp->diff = 0;
@@ -86,10 +89,33 @@ static void eof_import_destroy_events_list(EOF_IMPORT_MIDI_EVENT_LIST * lp)
 		{
 			free(lp->event[i]);
 		}
+		free(lp->event);
 		free(lp);
 	}
 }
 
+static int eof_import_reserve_event(EOF_IMPORT_MIDI_EVENT_LIST * lp)
+{	//Ensures the list has room for one more event, doubling the array as needed.  Returns zero on error
+	EOF_IMPORT_MIDI_EVENT **array;
+	unsigned long newcapacity;
+
+	if(!lp)
+		return 0;
+	if(lp->events < lp->event_capacity)
+		return 1;	//There is already room
+
+	newcapacity = lp->event_capacity ? lp->event_capacity * 2 : EOF_MIN_NOTE_CAPACITY;
+	if((newcapacity <= lp->event_capacity) || (newcapacity > (size_t)-1 / sizeof(EOF_IMPORT_MIDI_EVENT *)))
+		return 0;	//The array can't grow any further
+	array = realloc(lp->event, (size_t)newcapacity * sizeof(EOF_IMPORT_MIDI_EVENT *));
+	if(!array)
+		return 0;
+	lp->event = array;
+	lp->event_capacity = newcapacity;
+
+	return 1;
+}
+
 /* parse_var_len:
  *  The MIDI file format is a strange thing. Time offsets are only 32 bits,
  *  yet they are compressed in a weird variable length format. This routine
@@ -183,7 +209,7 @@ static void eof_midi_import_add_event(EOF_IMPORT_MIDI_EVENT_LIST * events, unsig
 {
 //	eof_log("eof_midi_import_add_event() entered");
 
-	if(events && (events->events < EOF_IMPORT_MAX_EVENTS))
+	if(events && eof_import_reserve_event(events))
 	{
 		events->event[events->events] = malloc(sizeof(EOF_IMPORT_MIDI_EVENT));
 		if(events->event[events->events])
@@ -201,7 +227,7 @@ static void eof_midi_import_add_event(EOF_IMPORT_MIDI_EVENT_LIST * events, unsig
 	}
 //	else
 //	{
-//		allegro_message("too many events!");
+//		eof_message("too many events!");
 //	}
 }
 
@@ -209,7 +235,7 @@ static void eof_midi_import_add_text_event(EOF_IMPORT_MIDI_EVENT_LIST * events,
 {
 //	eof_log("eof_midi_import_add_text_event() entered");
 
-	if(events && text && (events->events < EOF_IMPORT_MAX_EVENTS))
+	if(events && text && eof_import_reserve_event(events))
 	{
 		if(size > EOF_MAX_MIDI_TEXT_SIZE)	//Prevent a buffer overflow by truncating the string if necessary
 			size = EOF_MAX_MIDI_TEXT_SIZE;
@@ -229,7 +255,7 @@ static void eof_midi_import_add_text_event(EOF_IMPORT_MIDI_EVENT_LIST * events,
 	}
 //	else
 //	{
-//		allegro_message("too many events!");
+//		eof_message("too many events!");
 //	}
 }
 
@@ -238,7 +264,7 @@ static void eof_midi_import_add_sysex_event(EOF_IMPORT_MIDI_EVENT_LIST * events,
 //	eof_log("eof_midi_import_add_sysex_event() entered");
 	char *datacopy = NULL;
 
-	if(events && (events->events < EOF_IMPORT_MAX_EVENTS) && data && (size > 0))
+	if(events && data && (size > 0) && eof_import_reserve_event(events))
 	{
 		events->event[events->events] = malloc(sizeof(EOF_IMPORT_MIDI_EVENT));
 		if(events->event[events->events])
@@ -259,7 +285,7 @@ static void eof_midi_import_add_sysex_event(EOF_IMPORT_MIDI_EVENT_LIST * events,
 	}
 //	else
 //	{
-//		allegro_message("too many events!");
+//		eof_message("too many events!");
 //	}
 }
 
@@ -786,7 +812,7 @@ EOF_SONG * eof_import_midi(const char * fn)
 										{	//If both a normal and a GHL guitar track have been encountered
 											eof_log("\t\tNormal AND GHL guitar tracks detected.", 1);
 											eof_clear_input();
-											if(alert("Both normal AND GHL guitar tracks were found.", "Import which one?", NULL, "&Normal", "&GHL", 'n', 'g') == 1)
+											if(eof_alert("Both normal AND GHL guitar tracks were found.", "Import which one?", NULL, "&Normal", "&GHL", 'n', 'g') == 1)
 											{	//If the user opts to import the normal guitar track
 												eof_log("\t\tUser opted to import the normal guitar track.", 1);
 												eof_import_events[ghl_guitar_track]->type = -1;	//Mark the GHL guitar track as one to be skipped during note import
@@ -823,7 +849,7 @@ EOF_SONG * eof_import_midi(const char * fn)
 										{	//If both a normal and a GHL bass track have been encountered
 											eof_log("\t\tNormal AND GHL bass tracks detected.", 1);
 											eof_clear_input();
-											if(alert("Both normal AND GHL bass tracks were found.", "Import which one?", NULL, "&Normal", "&GHL", 'n', 'g') == 1)
+											if(eof_alert("Both normal AND GHL bass tracks were found.", "Import which one?", NULL, "&Normal", "&GHL", 'n', 'g') == 1)
 											{	//If the user opts to import the normal bass track
 												eof_log("\t\tUser opted to import the normal bass track.", 1);
 												eof_import_events[ghl_bass_track]->type = -1;	//Mark the GHL bass track as one to be skipped during note import
@@ -877,7 +903,7 @@ EOF_SONG * eof_import_midi(const char * fn)
 										if(!forcestrum)
 										{	//If the user wasn't asked about whether to mark non forced HOPOs as forced strums
 											eof_clear_input();
-											if(alert(NULL, "Import the Power Gig chart's original HOPO OFF notation?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+											if(eof_alert(NULL, "Import the Power Gig chart's original HOPO OFF notation?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 											{	//If user opts to have all non HOPO notes marked for forced strumming
 												forcestrum = 1;
 											}
@@ -919,7 +945,7 @@ EOF_SONG * eof_import_midi(const char * fn)
 								if(ustrstr(text,"PART") || (ustrstr(text,"HARM") == text))
 								{	//If this is a track name that contains the word "PART" in the name (or begins with "HARM")
 									eof_clear_input();
-									if(alert("Unsupported track:", text, "Import raw data?", "&Yes", "&No", 'y', 'n') == 1)
+									if(eof_alert("Unsupported track:", text, "Import raw data?", "&Yes", "&No", 'y', 'n') == 1)
 									{	//If the user opts to import the raw track data
 										eof_MIDI_add_track(sp, eof_get_raw_MIDI_data(eof_work_midi, track[i], 0));	//Add this to the linked list of raw MIDI track data
 									}
@@ -1080,7 +1106,7 @@ EOF_SONG * eof_import_midi(const char * fn)
 		if(eof_song_add_beat(sp) == NULL)	//Add a new beat
 		{					//Or return failure if that doesn't succeed
 
-allegro_message("Fail point 1");
+eof_message("Fail point 1");
 
 			eof_import_destroy_events_list(eof_import_bpm_events);
 			eof_import_destroy_events_list(eof_import_text_events);
@@ -1240,7 +1266,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 	if(midbeatchangefound && eof_write_rb_files)
 	{	//If a mid beat tempo or TS change was found, and Rock Band export is enabled
 		eof_clear_input();
-		if(alert("Warning:  There were one or more mid beat tempo/TS changes.", "Store the tempo track into the project?", "(Only recommended if creating RB3 upgrades)", "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert("Warning:  There were one or more mid beat tempo/TS changes.", "Store the tempo track into the project?", "(Only recommended if creating RB3 upgrades)", "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to import the tempo track
 			struct eof_MIDI_data_track *ptr;
 			char *tempotrackname = "(TEMPO)";
@@ -1270,7 +1296,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 			{	//If there was a beat track found
 				char *beattrackname = "(BEAT)";
 				eof_clear_input();
-				if(alert("Store the BEAT track as well?", "(Recommended)", NULL, "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert("Store the BEAT track as well?", "(Recommended)", NULL, "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opts to store the beat track
 					ptr = eof_get_raw_MIDI_data(eof_work_midi, beat_track, 0);
 					if(!ptr)
@@ -1299,7 +1325,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 				}
 			}
 			eof_clear_input();
-			if(alert("Lock the tempo map to preserve sync?", "(Recommended)", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("Lock the tempo map to preserve sync?", "(Recommended)", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to lock the tempo map
 				sp->tags->tempo_map_locked |= 1;
 			}
@@ -1371,7 +1397,6 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 		char fretwarning = 0;					//Tracks whether the user was warned about the track violating its standard fret limit, if applicable
 		unsigned long linestart = 0;			//Tracks the start of a line of lyrics for Power Gig MIDIs, which don't formally mark line placements with a note
 		char linetrack = 0;						//Is set to nonzero when linestart is tracking the position of the current line of lyrics
-		char filter = 0;						//Is set to nonzero if the track's note limit is reached and upon prompting, the user opts to import only the expert difficulty
 
 		if(eof_import_events[i]->type < 0)
 		{	//If this track is to be skipped (ie. unidentified track)
@@ -1532,8 +1557,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					{
 						sp->vocal_track[0]->line[last_105].end_pos = event_realtime;
 //#ifdef EOF_DEBUG_MIDI_IMPORT
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tAdding lyric line from %lums to %lums", sp->vocal_track[0]->line[last_105].start_pos, sp->vocal_track[0]->line[last_105].end_pos);
-						eof_log(eof_log_string, 3);
+						eof_logf(3, "\t\t\tAdding lyric line from %lums to %lums", sp->vocal_track[0]->line[last_105].start_pos, sp->vocal_track[0]->line[last_105].end_pos);
 //#endif
 						sp->vocal_track[0]->lines++;
 						if(overdrive_pos == sp->vocal_track[0]->line[last_105].start_pos)
@@ -1545,8 +1569,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					{
 						sp->vocal_track[0]->line[last_106].end_pos = event_realtime;
 //#ifdef EOF_DEBUG_MIDI_IMPORT
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tAdding lyric line from %lums to %lums", sp->vocal_track[0]->line[last_106].start_pos, sp->vocal_track[0]->line[last_106].end_pos);
-						eof_log(eof_log_string, 3);
+						eof_logf(3, "\t\t\tAdding lyric line from %lums to %lums", sp->vocal_track[0]->line[last_106].start_pos, sp->vocal_track[0]->line[last_106].end_pos);
 //#endif
 						sp->vocal_track[0]->lines++;
 						if(overdrive_pos == sp->vocal_track[0]->line[last_106].start_pos)
@@ -1620,8 +1643,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 								sp->vocal_track[0]->line[sp->vocal_track[0]->lines].end_pos = event_realtime;
 								sp->vocal_track[0]->line[sp->vocal_track[0]->lines].flags = 0;	//Init flags for this line as 0
 //#ifdef EOF_DEBUG_MIDI_IMPORT
-								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tAdding lyric line from %lums to %lums", sp->vocal_track[0]->line[sp->vocal_track[0]->lines].start_pos, sp->vocal_track[0]->line[sp->vocal_track[0]->lines].end_pos);
-								eof_log(eof_log_string, 3);
+								eof_logf(3, "\t\t\tAdding lyric line from %lums to %lums", sp->vocal_track[0]->line[sp->vocal_track[0]->lines].start_pos, sp->vocal_track[0]->line[sp->vocal_track[0]->lines].end_pos);
 //#endif
 								sp->vocal_track[0]->lines++;
 								linetrack = 0;
@@ -1646,8 +1668,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									}
 								}
 //#ifdef EOF_DEBUG_MIDI_IMPORT
-								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tAdding lyric:  %lums \"%s\"", sp->vocal_track[0]->lyric[note_count[picked_track]]->pos, sp->vocal_track[0]->lyric[note_count[picked_track]]->text);
-								eof_log(eof_log_string, 3);
+								eof_logf(3, "\t\t\tAdding lyric:  %lums \"%s\"", sp->vocal_track[0]->lyric[note_count[picked_track]]->pos, sp->vocal_track[0]->lyric[note_count[picked_track]]->text);
 //#endif
 								note_count[picked_track]++;
 							}
@@ -1671,8 +1692,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					if(eof_import_events[i]->game == 1)
 					{	//If the MIDI is in Power Gig notation
 //#ifdef EOF_DEBUG_MIDI_IMPORT
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tControl change:  Controller type %d, value %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, eof_import_events[i]->event[j]->d2, event_miditime, event_realtime);
-						eof_log(eof_log_string, 3);
+						eof_logf(3, "\t\t\tControl change:  Controller type %d, value %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, eof_import_events[i]->event[j]->d2, event_miditime, event_realtime);
 //#endif
 						if((midinote >= 80) && (midinote <= 82))
 						{	//These control change events mark "mojo" sections (the equivalent of star power phrases)
@@ -2006,11 +2026,6 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					}
 				}//Note on or note off
 
-				if(filter && (diff >= 0) && (diff != EOF_NOTE_AMAZING))
-				{	//If this event pertains to a note/marker that is being filtered from the import
-					continue;	//Skip it
-				}
-
 				/* note on */
 				if(eof_import_events[i]->event[j]->type == 0x90)
 				{
@@ -2019,8 +2034,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					unsigned char accent = 0, ghost = 0;
 
 #ifdef EOF_DEBUG
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tNote on:  %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, event_miditime, event_realtime);
-					eof_log(eof_log_string, 2);
+					eof_logf(2, "\t\t\tNote on:  %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, event_miditime, event_realtime);
 #endif
 
 					if(eof_import_events[i]->game == 0)
@@ -2154,42 +2168,11 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					{	//If a note difficulty was identified above, import the gem as a new note
 						//The note off handling will apply disjointed status where appropriate and the fixup logic will combine notes without disjointed status where appropriate
 						notenum = note_count[picked_track];
-						if(notenum >= EOF_MAX_NOTES)
-						{	//If the track's capacity is exceeded
-							if(!filter)
-							{	//If the user wasn't prompted about how to handle this yet
-								eof_clear_input();
-								if(alert("Error:  The maximum number of notes is exceeded by track:", eof_midi_tracks[picked_track].name, "Import expert notes only instead of truncating import?", "&Yes", "&No", 'y', 'n') == 1)
-								{	//If the user opts to drop notes that aren't expert difficulty
-									unsigned long filterctr, deletectr;
-
-									eof_log("\t\t\tNote limit reached.  User opted to filter out non expert notes for the track.", 1);
-									filter = 1;
-
-									for(filterctr = eof_get_track_size(sp, picked_track), deletectr = 0; filterctr > 0; filterctr--)
-									{	//For each note in the track, in reverse order
-										if(eof_get_note_type(sp, picked_track, filterctr - 1) != EOF_NOTE_AMAZING)
-										{	//If the note isn't in the expert difficulty
-											eof_track_delete_note(sp, picked_track, filterctr - 1);	//Delete the note
-											note_count[picked_track]--;	//Decrement the track's note counter
-											deletectr++;	//Count how many already-imported notes are being removed
-										}
-									}
-									(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tRemoved %lu filtered notes.", deletectr);
-									eof_log(eof_log_string, 1);
-								}
-								else
-								{	//User opted to truncating the import of this track
-									eof_log("\t\t\tNote limit reached.  User opted to truncate the track's import.", 1);
-									break;	//Exit outer for loop
-								}
-							}
-							else
-							{	//If the user already opted to drop non expert notes but the note limit was still reached
-								eof_log("\t\t\t\tNote limit still reached.  Track import truncated.", 1);
-								allegro_message("Error:  The maximum number of expert notes is exceeded by track \"%s\".  Truncating track.", eof_midi_tracks[picked_track].name);
-								break;	//Exit outer for loop
-							}
+						if(notenum >= eof_get_track_size(sp, picked_track))
+						{	//If the track couldn't be resized to hold this note
+							eof_log("\t\t\tError allocating memory for note.  Track import truncated.", 1);
+							eof_message("Error:  Not enough memory to import all notes of track \"%s\".  Truncating track.", eof_midi_tracks[picked_track].name);
+							break;	//Exit outer for loop
 						}
 						eof_set_note_note(sp, picked_track, notenum, lane_chart[lane]);
 						eof_set_note_pos(sp, picked_track, notenum, event_realtime);
@@ -2203,8 +2186,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 							eof_set_note_tflags(sp, picked_track, notenum, EOF_NOTE_TFLAG_RESNAP);	//Track that the note is expected to be grid snapped after MIDI import completes
 						note_count[picked_track]++;
 #ifdef EOF_DEBUG
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tInitializing note #%lu (Diff=%d):  Mask=%u, Pos=%lu, Length=%d", notenum, eof_get_note_type(sp, picked_track, notenum), lane_chart[lane], event_realtime, 0);
-						eof_log(eof_log_string, 3);
+						eof_logf(3, "\t\t\t\tInitializing note #%lu (Diff=%d):  Mask=%u, Pos=%lu, Length=%d", notenum, eof_get_note_type(sp, picked_track, notenum), lane_chart[lane], event_realtime, 0);
 #endif
 						if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 						{
@@ -2259,8 +2241,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					char ghlopen = 0;
 
 #ifdef EOF_DEBUG
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tNote off:  %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, event_miditime, event_realtime);
-					eof_log(eof_log_string, 2);
+					eof_logf(2, "\t\t\tNote off:  %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, event_miditime, event_realtime);
 #endif
 
 					if(eof_import_events[i]->game == 0)
@@ -2422,14 +2403,13 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 							{	//Check for each note that has been imported, in reverse order
 								if((eof_get_note_type(sp, picked_track, k - 1) == diff) && (eof_get_note_note(sp, picked_track, k - 1) & lane_chart[lane]))
 								{	//If the note is in the same difficulty as this note off event and it contains one of the same gems
-//										allegro_message("break %d, %d, %d", k - 1, sp->legacy_track[picked_track]->note[k - 1]->note, sp->legacy_track[picked_track]->note[note_count[picked_track]]->note);	//Debug
+//										eof_message("break %d, %d, %d", k - 1, sp->legacy_track[picked_track]->note[k - 1]->note, sp->legacy_track[picked_track]->note[note_count[picked_track]]->note);	//Debug
 									unsigned long pos, length1, length2, lengthdiff, eflags;	//Variables used to compare the lengths between notes for application of disjointed status
 
 									if(ghlopen && !(eof_get_note_flags(sp, picked_track, k - 1) & EOF_GUITAR_NOTE_FLAG_GHL_OPEN))
 										continue;	//If this isn't the open note that needs to be altered, skip it
 
-									(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tModifying note #%lu (Diff=%u, Pos=%lu, Mask=%u) from length %ld to %lu", k - 1, eof_get_note_type(sp, picked_track, k - 1), eof_get_note_pos(sp, picked_track, k - 1), eof_get_note_note(sp, picked_track, k - 1), eof_get_note_length(sp, picked_track, k - 1), event_realtime - eof_get_note_pos(sp, picked_track, k - 1));
-									eof_log(eof_log_string, 3);
+									eof_logf(3, "\t\t\t\tModifying note #%lu (Diff=%u, Pos=%lu, Mask=%u) from length %ld to %lu", k - 1, eof_get_note_type(sp, picked_track, k - 1), eof_get_note_pos(sp, picked_track, k - 1), eof_get_note_note(sp, picked_track, k - 1), eof_get_note_length(sp, picked_track, k - 1), event_realtime - eof_get_note_pos(sp, picked_track, k - 1));
 
 									eof_set_note_length(sp, picked_track, k - 1, event_realtime - eof_get_note_pos(sp, picked_track, k - 1));
 									if(eof_get_note_length(sp, picked_track, k - 1) <= 0)
@@ -2449,8 +2429,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 
 											if((length2 != 0) && (lengthdiff > 1))
 											{	//If the note has had its length determined and it's more than 1ms different from the note that was just imported
-												(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tApplying disjointed status to note #%lu and #%lu at %lums in difficulty %d", ctr, k - 1, pos, eof_get_note_type(sp, picked_track, ctr));
-												eof_log(eof_log_string, 3);
+												eof_logf(3, "\t\t\t\tApplying disjointed status to note #%lu and #%lu at %lums in difficulty %d", ctr, k - 1, pos, eof_get_note_type(sp, picked_track, ctr));
 
 												eflags = eof_get_note_eflags(sp, picked_track, ctr) | EOF_NOTE_EFLAG_DISJOINTED;
 												eof_set_note_eflags(sp, picked_track, ctr, eflags);	//Add the disjointed status to the pre-existing note
@@ -2479,8 +2458,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 								switch(eof_import_events[i]->event[j]->dp[5])
 								{	//Check the value of the phrase ID
 									case 1:	//Open strum
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Open strum (deltapos=%lu, pos=%lu, diff=%d, status=%d)", event_miditime, event_realtime, phrasediff, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Open strum (deltapos=%lu, pos=%lu, diff=%d, status=%d)", event_miditime, event_realtime, phrasediff, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of open strum phrase
@@ -2515,7 +2493,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 																	if(!nonstandard_open_strum_marker_prompt)
 																	{	//If the user hasn't been prompted how to treat such markers during this import
 																		eof_clear_input();
-																		if(alert("Warning:  This MIDI has nonstandard use of open strum markers marking multiple notes.", "This makes open notes extending over other notes impossible.", "Import all notes in the markers as open notes?", "&Yes", "&No", 'y', 'n') == 1)
+																		if(eof_alert("Warning:  This MIDI has nonstandard use of open strum markers marking multiple notes.", "This makes open notes extending over other notes impossible.", "Import all notes in the markers as open notes?", "&Yes", "&No", 'y', 'n') == 1)
 																		{	//If the user opts to import all notes within the marker as open notes
 																			nonstandard_open_strum_marker_prompt = 1;	//All notes within the marker will be converted to open notes
 																			eof_log("\tUser opted to convert all notes in nonstandard open strum markers into strum notes.", 1);
@@ -2531,8 +2509,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 
 															if((nonstandard_open_strum_marker_prompt != 2) || (notepos == firstpos))
 															{	//If this note isn't being excluded from being marked as an open note as per the above prompt
-																(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tModifying note #%lu (Diff=%u, Pos=%lu, Mask=%u, Length=%ld) to have a note mask of 33", k, eof_get_note_type(sp, picked_track, k), notepos, eof_get_note_note(sp, picked_track, k), eof_get_note_length(sp, picked_track, k));
-																eof_log(eof_log_string, 3);
+																eof_logf(3, "\t\t\t\tModifying note #%lu (Diff=%u, Pos=%lu, Mask=%u, Length=%ld) to have a note mask of 33", k, eof_get_note_type(sp, picked_track, k), notepos, eof_get_note_note(sp, picked_track, k), eof_get_note_length(sp, picked_track, k));
 
 																eof_set_note_note(sp, picked_track, k, 33);	//Change this note to a lane 1+6 chord (the cleanup logic should later correct this to just a lane 6 gem, EOF's in-editor notation for open strum bass).  This modification is necessary so that the note off event representing the end of the lane 1 gem for an open bass note can be processed properly.
 																sp->track[picked_track]->flags = EOF_TRACK_FLAG_SIX_LANES;	//Set this flag
@@ -2548,8 +2525,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 4:	//Slider
 										if((sp->track[picked_track]->track_behavior == EOF_GUITAR_TRACK_BEHAVIOR) && (sp->track[picked_track]->track_format == EOF_LEGACY_TRACK_FORMAT))
 										{	//Only parse slider phrases for legacy guitar tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Slider (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Slider (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2569,7 +2545,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 												{
 													if(!sliders_exceeded_warning)
 													{
-														allegro_message("This MIDI contains too many sliders, only the first %d will be imported.", EOF_MAX_PHRASES);
+														eof_message("This MIDI contains too many sliders, only the first %d will be imported.", EOF_MAX_PHRASES);
 														sliders_exceeded_warning = 1;
 													}
 												}
@@ -2579,8 +2555,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 5:	//Open hi hat
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse hi hat phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Open hi hat (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Open hi hat (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2601,8 +2576,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 6:	//Pedal controlled hi hat
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse hi hat phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pedal hi hat (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Pedal hi hat (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2623,8 +2597,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 7:	//Snare rim shot
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse rim shot phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Rim shot (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Rim shot (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2645,8 +2618,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 8:	//Sizzle hi hat
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse hi hat phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Sizzle hi hat (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Sizzle hi hat (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2667,8 +2639,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 17:	//Yellow Tom + Cymbal
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse hi hat phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Yellow tom/cymbal combo (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Yellow tom/cymbal combo (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2689,8 +2660,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 18:	//Blue Tom + Cymbal
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse hi hat phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Blue tom/cymbal combo (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Blue tom/cymbal combo (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2711,8 +2681,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 									case 19:	//Green Tom + Cymbal
 										if((picked_track == EOF_TRACK_DRUM) || (picked_track == EOF_TRACK_DRUM_PS))
 										{	//Only parse hi hat phrases for the drum tracks
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Green tom/cymbal combo (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-											eof_log(eof_log_string, 2);
+											eof_logf(2, "\t\tSysex marker:  Green tom/cymbal combo (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 											if(eof_import_events[i]->event[j]->dp[6] == 1)
 											{	//Start of phrase
@@ -2747,8 +2716,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 				{	//Control change event
 					if(eof_import_events[i]->game == 1)
 					{	//If the MIDI is in Power Gig notation
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tControl change:  Controller type %d, value %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, eof_import_events[i]->event[j]->d2, event_miditime, event_realtime);
-						eof_log(eof_log_string, 2);
+						eof_logf(2, "\t\t\tControl change:  Controller type %d, value %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, eof_import_events[i]->event[j]->d2, event_miditime, event_realtime);
 
 						if(eof_import_events[i]->event[j]->d1 == 68)
 						{	//This control change event marks forced HOPO phrases
@@ -2840,8 +2808,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					unsigned long *slideptr;	//This will point to either the up or down slide position array as appropriate, so the velocity can be checked just once
 					char strum = 0;	//Will store the strum type, to reduce duplicated logic below
 
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tNote on:  %d (deltapos=%lu, pos=%lu)", midinote, event_miditime, event_realtime);
-					eof_log(eof_log_string, 2);
+					eof_logf(2, "\t\t\tNote on:  %d (deltapos=%lu, pos=%lu)", midinote, event_miditime, event_realtime);
 
 					/* store forced Ho/Po markers, when the note off for this marker occurs, search for note with same position and apply it to that note */
 					//Pro guitar forced Ho/Po are both marked as lane 1 + 6
@@ -2981,8 +2948,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 					{	//Pro guitar fret hand positions are marked with note 108
 						if(eof_import_events[i]->event[j]->d2 < 100)
 						{	//If this is an invalid velocity for a fret hand position
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tModifying fret hand position at pos=%lu from velocity %d to 101", event_realtime, eof_import_events[i]->event[j]->d2);
-							eof_log(eof_log_string, 2);
+							eof_logf(2, "\t\t\t\tModifying fret hand position at pos=%lu from velocity %d to 101", event_realtime, eof_import_events[i]->event[j]->d2);
 
 							eof_import_events[i]->event[j]->d2 = 101;	//Reset it to a position of 1
 						}
@@ -3027,22 +2993,19 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 								eof_set_note_tflags(sp, picked_track, notenum, EOF_NOTE_TFLAG_RESNAP);	//Track that the note is expected to be grid snapped after MIDI import completes
 							note_count[picked_track]++;
 
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tInitializing note #%lu (Diff=%d):  Mask=%u, Pos=%lu, Length=%d", notenum, eof_get_note_type(sp, picked_track, notenum), lane_chart[lane], event_realtime, 0);
-							eof_log(eof_log_string, 3);
+							eof_logf(3, "\t\t\t\tInitializing note #%lu (Diff=%d):  Mask=%u, Pos=%lu, Length=%d", notenum, eof_get_note_type(sp, picked_track, notenum), lane_chart[lane], event_realtime, 0);
 						}
 						else
 						{	//Otherwise just modify the existing note by adding a gem
 							notenum = k - 1;
 
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tModifying note #%lu (Diff=%d, Pos=%lu) from mask %d to %d", notenum, eof_get_note_type(sp, picked_track, notenum), event_realtime, eof_get_note_note(sp, picked_track, notenum), eof_get_note_note(sp, picked_track, notenum) | lane_chart[lane]);
-							eof_log(eof_log_string, 3);
+							eof_logf(3, "\t\t\t\tModifying note #%lu (Diff=%d, Pos=%lu) from mask %d to %d", notenum, eof_get_note_type(sp, picked_track, notenum), event_realtime, eof_get_note_note(sp, picked_track, notenum), eof_get_note_note(sp, picked_track, notenum) | lane_chart[lane]);
 
 							eof_set_note_note(sp, picked_track, notenum, eof_get_note_note(sp, picked_track, notenum) | lane_chart[lane]);
 						}
 						if(eof_import_events[i]->event[j]->d2 < 100)
 						{	//Some other editors may have an invalid velocity defined
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tModifying note #%lu (Diff=%d, Pos=%lu) from velocity %d to 100", notenum, eof_get_note_type(sp, picked_track, notenum), event_realtime, eof_import_events[i]->event[j]->d2);
-							eof_log(eof_log_string, 3);
+							eof_logf(3, "\t\t\t\tModifying note #%lu (Diff=%d, Pos=%lu) from velocity %d to 100", notenum, eof_get_note_type(sp, picked_track, notenum), event_realtime, eof_import_events[i]->event[j]->d2);
 
 							eof_import_events[i]->event[j]->d2 = 100;	//In which case, revert the velocity to the lowest usable value
 						}
@@ -3053,7 +3016,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 							{	//If the user hasn't been warned about this problem for this track
 								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  At least one note (at %lu ms) in %s breaks the track's fret limit of %u.  This can cause Rock Band to crash.", event_realtime, eof_midi_tracks[picked_track].name, sp->pro_guitar_track[tracknum]->numfrets);
 								eof_log(eof_log_string, 1);
-								allegro_message("Warning:  At least one note (at %lu ms) in %s breaks the track's fret limit of %u.\nThis can cause Rock Band to crash.", event_realtime, eof_midi_tracks[picked_track].name, sp->pro_guitar_track[tracknum]->numfrets);
+								eof_message("Warning:  At least one note (at %lu ms) in %s breaks the track's fret limit of %u.\nThis can cause Rock Band to crash.", event_realtime, eof_midi_tracks[picked_track].name, sp->pro_guitar_track[tracknum]->numfrets);
 								fretwarning = 1;
 							}
 							sp->pro_guitar_track[tracknum]->numfrets = sp->pro_guitar_track[tracknum]->note[notenum]->frets[lane];	//Increase the maximum to reflect this fret value
@@ -3094,8 +3057,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 				/* note off so get length of note */
 				else if(eof_import_events[i]->event[j]->type == 0x80)
 				{	//Note off event
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tNote off:  %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, event_miditime, event_realtime);
-					eof_log(eof_log_string, 2);
+					eof_logf(2, "\t\t\tNote off:  %d (deltapos=%lu, pos=%lu)", eof_import_events[i]->event[j]->d1, event_miditime, event_realtime);
 
 					/* detect forced HOPO */
 					hopodiff = -1;
@@ -3285,8 +3247,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 						{	//Check for each note that has been imported, in reverse order
 							if((eof_get_note_type(sp, picked_track, k - 1) == diff) && (eof_get_note_note(sp, picked_track, k - 1) & lane_chart[lane]))
 							{	//If the note is in the same difficulty as this note off event and it contains one of the same gems
-								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tModifying note #%lu (Diff=%u, Pos=%lu, Mask=%u) from length %ld to %lu", k - 1, eof_get_note_type(sp, picked_track, k - 1), eof_get_note_pos(sp, picked_track, k - 1), eof_get_note_note(sp, picked_track, k - 1), eof_get_note_length(sp, picked_track, k - 1), event_realtime - eof_get_note_pos(sp, picked_track, k - 1));
-								eof_log(eof_log_string, 3);
+								eof_logf(3, "\t\t\t\tModifying note #%lu (Diff=%u, Pos=%lu, Mask=%u) from length %ld to %lu", k - 1, eof_get_note_type(sp, picked_track, k - 1), eof_get_note_pos(sp, picked_track, k - 1), eof_get_note_note(sp, picked_track, k - 1), eof_get_note_length(sp, picked_track, k - 1), event_realtime - eof_get_note_pos(sp, picked_track, k - 1));
 
 								eof_set_note_length(sp, picked_track, k - 1, event_realtime - eof_get_note_pos(sp, picked_track, k - 1));
 								if(eof_get_note_length(sp, picked_track, k - 1) <= 0)
@@ -3355,8 +3316,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 								switch(eof_import_events[i]->event[j]->dp[5])
 								{	//Check the value of the phrase ID
 									case 2:	//Pro guitar slide up
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar slide up (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar slide up (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar slide up phrase
@@ -3374,8 +3334,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 3:	//Pro guitar slide down
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar slide down (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar slide down (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar slide down phrase
@@ -3393,8 +3352,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 9:	//Pro guitar palm mute
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar palm mute (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar palm mute (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar palm mute phrase
@@ -3412,8 +3370,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 10:	//Pro guitar vibrato
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar vibrato (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar vibrato (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar vibrato phrase
@@ -3431,8 +3388,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 11:	//Pro guitar harmonic
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar harmonic (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar harmonic (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar harmonic phrase
@@ -3450,8 +3406,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 12:	//Pro guitar pinch harmonic
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar pinch harmonic (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar pinch harmonic (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar pinch harmonic phrase
@@ -3469,8 +3424,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 13:	//Pro guitar bend
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar bend (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar bend (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar bend phrase
@@ -3488,8 +3442,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 14:	//Pro guitar accent
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar accent (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar accent (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar accent phrase
@@ -3507,8 +3460,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 15:	//Pro guitar pop
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar pop (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar pop (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar pop phrase
@@ -3526,8 +3478,7 @@ assert(anchorlist != NULL);	//This would mean eof_add_to_tempo_list() failed
 										}
 									break;
 									case 16:	//Pro guitar slap
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSysex marker:  Pro guitar slap (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
-										eof_log(eof_log_string, 2);
+										eof_logf(2, "\t\tSysex marker:  Pro guitar slap (deltapos=%lu, pos=%lu, status=%d)", event_miditime, event_realtime, eof_import_events[i]->event[j]->dp[6]);
 
 										if(eof_import_events[i]->event[j]->dp[6] == 1)
 										{	//Start of pro guitar slap phrase
@@ -3662,7 +3613,7 @@ eof_log("\tThird pass complete", 1);
 		eof_pen_visible = 0;
 		eof_show_mouse(screen);
 		eof_clear_input();
-		if(alert(NULL, "Import lane 1 forced HOPO bass notes as open strums (ie. this is a Guitar Hero chart)?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Import lane 1 forced HOPO bass notes as open strums (ie. this is a Guitar Hero chart)?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to import lane 1 HOPO bass notes as open strums
 			sp->legacy_track[tracknum]->numlanes = 6;						//Set this track to have 6 lanes instead of 5
 			sp->track[EOF_TRACK_BASS]->flags |= EOF_TRACK_FLAG_SIX_LANES;	//Set this flag
@@ -3768,7 +3719,7 @@ eof_log("\tThird pass complete", 1);
 				unsigned long pos = b;
 				unsigned long flags = 0;	//By default, the section is to be treated as an on-beat section
 
-//				allegro_message("%s", eof_import_text_events->event[i]->text);	//Debug
+//				eof_message("%s", eof_import_text_events->event[i]->text);	//Debug
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tText event:  Original MIDI position = %lu ticks.  Assigned position = %lums: %s", eof_import_text_events->event[i]->pos, tp, eof_import_text_events->event[i]->text);
 				eof_log(eof_log_string, 1);
 
@@ -3777,7 +3728,7 @@ eof_log("\tThird pass complete", 1);
 					eof_log("\t\t\t\t!This section is being added as a floating (off-beat) text event", 1);
 					if(!event_realignment_warning)
 					{	//If the user wasn't warned about this yet
-						allegro_message("Note:  At least one text event was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
+						eof_message("Note:  At least one text event was defined mid-beat and is being stored as a \"floating\" text event.  Check logging for details.");
 						event_realignment_warning = 1;
 					}
 					flags = EOF_EVENT_FLAG_FLOATING_POS;	//The call to eof_song_add_text_event() will receive this as a floating text event
@@ -3828,28 +3779,28 @@ eof_log("\tThird pass complete", 1);
 	tracknum = sp->track[EOF_TRACK_PRO_GUITAR]->tracknum;
 	if(eof_detect_string_gem_conflicts(sp->pro_guitar_track[tracknum], sp->pro_guitar_track[tracknum]->numstrings))
 	{
-		allegro_message("Warning:  17 fret pro guitar tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
+		eof_message("Warning:  17 fret pro guitar tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
 		sp->pro_guitar_track[tracknum]->numstrings = 6;
 		memset(sp->pro_guitar_track[tracknum]->tuning, 0, EOF_TUNING_LENGTH);
 	}
 	tracknum = sp->track[EOF_TRACK_PRO_GUITAR_22]->tracknum;
 	if(eof_detect_string_gem_conflicts(sp->pro_guitar_track[tracknum], sp->pro_guitar_track[tracknum]->numstrings))
 	{
-		allegro_message("Warning:  22 fret pro guitar tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
+		eof_message("Warning:  22 fret pro guitar tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
 		sp->pro_guitar_track[tracknum]->numstrings = 6;
 		memset(sp->pro_guitar_track[tracknum]->tuning, 0, EOF_TUNING_LENGTH);
 	}
 	tracknum = sp->track[EOF_TRACK_PRO_BASS]->tracknum;
 	if(eof_detect_string_gem_conflicts(sp->pro_guitar_track[tracknum], sp->pro_guitar_track[tracknum]->numstrings))
 	{
-		allegro_message("Warning:  17 fret pro bass tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
+		eof_message("Warning:  17 fret pro bass tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
 		sp->pro_guitar_track[tracknum]->numstrings = 6;
 		memset(sp->pro_guitar_track[tracknum]->tuning, 0, EOF_TUNING_LENGTH);
 	}
 	tracknum = sp->track[EOF_TRACK_PRO_BASS_22]->tracknum;
 	if(eof_detect_string_gem_conflicts(sp->pro_guitar_track[tracknum], sp->pro_guitar_track[tracknum]->numstrings))
 	{
-		allegro_message("Warning:  22 fret pro bass tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
+		eof_message("Warning:  22 fret pro bass tuning tag defines too few strings.  Reverting to 6 string standard tuning.");
 		sp->pro_guitar_track[tracknum]->numstrings = 6;
 		memset(sp->pro_guitar_track[tracknum]->tuning, 0, EOF_TUNING_LENGTH);
 	}
@@ -3857,10 +3808,10 @@ eof_log("\tThird pass complete", 1);
 	//Check all instrument tracks for chord snap authoring errors
 	if(eof_song_check_unsnapped_chords(sp, 0, 0, 0, 10))
 	{
-		allegro_message("Warning:  At least one note has a chord snap error (gems defined 1-10 delta ticks apart).  These gems have been highlighted.");
+		eof_message("Warning:  At least one note has a chord snap error (gems defined 1-10 delta ticks apart).  These gems have been highlighted.");
 
 		eof_clear_input();
-		if(alert(NULL, "Re-align the gems to make them proper chords?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(NULL, "Re-align the gems to make them proper chords?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to automatically fix the unsnapped chords
 			eof_song_check_unsnapped_chords(sp, 0, 1, 0, 10);
 		}
@@ -3968,11 +3919,11 @@ int eof_song_check_unsnapped_chords(EOF_SONG *sp, unsigned long track, int funct
 	{	//If all notes were zero positioned
 		if(!timing)
 		{	//Compare MIDI positions
-			allegro_message("None of the notes' MIDI positions are defined.  They are only defined during file imports and are not kept during save.");
+			eof_message("None of the notes' MIDI positions are defined.  They are only defined during file imports and are not kept during save.");
 		}
 		else
 		{	//Compare millisecond positions
-			allegro_message("All notes in the project are at 0ms");
+			eof_message("All notes in the project are at 0ms");
 		}
 		return 0;
 	}
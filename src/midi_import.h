@@ -7,7 +7,6 @@
 
 #define EOF_MAX_IMPORT_MIDI_TRACKS 32
 #define EOF_MAX_MIDI_TEXT_SIZE 255
-#define EOF_IMPORT_MAX_EVENTS EOF_MAX_MIDI_EVENTS
 
 extern unsigned char eof_midi_import_drum_accent_velocity;
 extern unsigned char eof_midi_import_drum_ghost_velocity;
@@ -69,7 +69,7 @@ char eof_mix_next_metronome_pitch;
 unsigned long eof_mix_next_note;
 unsigned long eof_mix_next_percussion;
 
-unsigned long eof_mix_clap_pos[EOF_MAX_NOTES] = {0};
+unsigned long *eof_mix_clap_pos = NULL;
 int eof_mix_claps = 0;
 int eof_mix_current_clap = 0;
 
@@ -80,14 +80,14 @@ typedef struct {
 	int tone;
 } guitar_midi_note;
 
-guitar_midi_note eof_guitar_notes[EOF_MAX_NOTES] = {{0,0,0,0}};
+guitar_midi_note *eof_guitar_notes = NULL;
 int eof_mix_guitar_notes = 0;
 int eof_mix_current_guitar_note = 0;
 
-unsigned long eof_mix_note_pos[EOF_MAX_NOTES] = {0};
-unsigned long eof_mix_note_note[EOF_MAX_NOTES] = {0};
-unsigned long eof_mix_note_ms_pos[EOF_MAX_NOTES] = {0};	//Used to store the start positions of notes (for MIDI playback)
-unsigned long eof_mix_note_ms_end[EOF_MAX_NOTES] = {0};	//Used to store the end positions of notes (for MIDI playback)
+unsigned long *eof_mix_note_pos = NULL;
+unsigned long *eof_mix_note_note = NULL;
+unsigned long *eof_mix_note_ms_pos = NULL;	//Used to store the start positions of notes (for MIDI playback)
+unsigned long *eof_mix_note_ms_end = NULL;	//Used to store the end positions of notes (for MIDI playback)
 int eof_mix_notes = 0;
 int eof_mix_current_note = 0;
 
@@ -96,14 +96,87 @@ char eof_mix_metronome_pos_pitch[EOF_MAX_BEATS] = {0};	//Will track whether the
 int eof_mix_metronomes = 0;
 int eof_mix_current_metronome = 0;
 
-unsigned long eof_mix_percussion_pos[EOF_MAX_NOTES] = {0};
+unsigned long *eof_mix_percussion_pos = NULL;
 int eof_mix_percussions = 0;
 int eof_mix_current_percussion = 0;
 
-void eof_mix_callback_common(void)
+static unsigned long eof_mix_cue_capacity = 0;			//The number of entries allocated for each of the clap, vocal tone and percussion arrays
+static unsigned long eof_mix_guitar_note_capacity = 0;	//The number of entries allocated for eof_guitar_notes[]
+
+static int eof_mix_reserve_cues(unsigned long count, unsigned long guitarcount)
+{	//Grows the cue arrays to hold at least the given number of entries, returns zero on error
+	//The caller has reset the cue counts to zero, so the mixer callback doesn't index into an array while it moves
+	void *ptr;
+
+	if(count > eof_mix_cue_capacity)
+	{
+		if((ptr = realloc(eof_mix_clap_pos, (size_t)count * sizeof(unsigned long))) == NULL)
+			return 0;
+		eof_mix_clap_pos = ptr;
+		if((ptr = realloc(eof_mix_note_pos, (size_t)count * sizeof(unsigned long))) == NULL)
+			return 0;
+		eof_mix_note_pos = ptr;
+		if((ptr = realloc(eof_mix_note_note, (size_t)count * sizeof(unsigned long))) == NULL)
+			return 0;
+		eof_mix_note_note = ptr;
+		if((ptr = realloc(eof_mix_note_ms_pos, (size_t)count * sizeof(unsigned long))) == NULL)
+			return 0;
+		eof_mix_note_ms_pos = ptr;
+		if((ptr = realloc(eof_mix_note_ms_end, (size_t)count * sizeof(unsigned long))) == NULL)
+			return 0;
+		eof_mix_note_ms_end = ptr;
+		if((ptr = realloc(eof_mix_percussion_pos, (size_t)count * sizeof(unsigned long))) == NULL)
+			return 0;
+		eof_mix_percussion_pos = ptr;
+		eof_mix_cue_capacity = count;
+	}
+	if(guitarcount > eof_mix_guitar_note_capacity)
+	{
+		if((ptr = realloc(eof_guitar_notes, (size_t)guitarcount * sizeof(guitar_midi_note))) == NULL)
+			return 0;
+		eof_guitar_notes = ptr;
+		eof_mix_guitar_note_capacity = guitarcount;
+	}
+
+	return 1;
+}
+
+#define EOF_MIX_BLOCK_SIZE 512	//The maximum number of sample frames mixed at a time, sized to keep the scratch buffers in cache
+
+static int eof_mix_chart_block[EOF_MIX_BLOCK_SIZE * 2];	//The signed chart audio for the block being mixed, interleaved if stereo
+static int eof_mix_cue_block[EOF_MIX_BLOCK_SIZE];		//The sum of all playing cue voices for the block being mixed, added to each channel
+
+static unsigned long eof_mix_frames_until_cue_check(unsigned long next, int current, int count)
+{
+	if(current >= count)
+		return ULONG_MAX;	//This cue list is exhausted
+	if(next > eof_mix_sample_count)
+		return next - eof_mix_sample_count;
+	return 1;	//A pending cue is triggered after the next sample
+}
+
+static unsigned long eof_mix_frames_until_cue(void)
+{
+	unsigned long frames, min;
+
+	min = eof_mix_frames_until_cue_check(eof_mix_next_clap, eof_mix_current_clap, eof_mix_claps);
+	frames = eof_mix_frames_until_cue_check(eof_mix_next_metronome, eof_mix_current_metronome, eof_mix_metronomes);
+	if(frames < min)
+		min = frames;
+	frames = eof_mix_frames_until_cue_check(eof_mix_next_note, eof_mix_current_note, eof_mix_notes);
+	if(frames < min)
+		min = frames;
+	frames = eof_mix_frames_until_cue_check(eof_mix_next_percussion, eof_mix_current_percussion, eof_mix_notes);
+	if(frames < min)
+		min = frames;
+
+	return min;
+}
+
+void eof_mix_callback_common(unsigned long frames)
 {
 	/* increment the sample and check sound triggers */
-	eof_mix_sample_count++;
+	eof_mix_sample_count += frames;
 
 	//Mix claps
 	if((eof_mix_sample_count >= eof_mix_next_clap) && (eof_mix_current_clap < eof_mix_claps))
@@ -168,143 +241,182 @@ void eof_mix_callback_common(void)
 	}
 }
 
-void eof_mix_callback_stereo(void * buf, int length)
+static void eof_mix_voice_block(EOF_MIX_VOICE *voice, unsigned long frames)
 {
-	unsigned long bytes_left;
-	unsigned short * buffer;
-	long sum=0,sum2=0;	//Use a signed long integer to allow the clipping logic to be more efficient
-	long cuesample;		//Used to apply a volume to cues, where the appropriate amplitude multiplier for changing the cue's loudness to X% is to multiply its amplitudes by sqrt(X/100)
-	unsigned long i, j;
-
-	bytes_left = length >> 1;	//Divide by two (length refers to the number of bytes to process, but buffer will be accessed as an array of 16 bit integer values)
-	buffer = (unsigned short *)buf;
+	unsigned short *data = (unsigned short *)voice->sp->data;
+	unsigned long i, n, len = voice->sp->len;
+	long pos = voice->pos;
+	double multiplier = voice->multiplier;
+
+	if(eof_mix_sample_increment == 1.0)
+	{	//If the chart audio is 44.1KHz, the cue's position advances exactly one sample per frame, so it can be mixed as a contiguous span
+		n = len - (unsigned long)pos;
+		if(n > frames)
+			n = frames;
+		data += pos;
+		if(voice->volume != 100)
+		{	//Change the cue to the specified loudness
+			for(i = 0; i < n; i++)
+				eof_mix_cue_block[i] += (int)((double)((int)data[i] - 32768) * multiplier);
+		}
+		else
+		{
+			for(i = 0; i < n; i++)
+				eof_mix_cue_block[i] += (int)data[i] - 32768;
+		}
+		voice->fpos += (double)n;
+		voice->pos = pos + (long)n;
+	}
+	else
+	{	//Otherwise step through the cue with the floating point position
+		double fpos = voice->fpos, increment = eof_mix_sample_increment;
 
-	/* add audio data to the buffer */
-	for(i = 0; i < bytes_left; i += 2)
+		for(i = 0; i < frames; i++)
+		{
+			int cuesample = (int)data[pos] - 32768;
+
+			if(voice->volume != 100)
+				cuesample *= multiplier;	//Change the cue to the specified loudness
+			eof_mix_cue_block[i] += cuesample;
+			fpos += increment;
+			pos = fpos + 0.5;	//Round to nearest full sample number
+			if((unsigned long)pos >= len)
+				break;
+		}
+		voice->fpos = fpos;
+		voice->pos = pos;
+	}
+	if((unsigned long)voice->pos >= len)
 	{
-		/* store original sample values */
-		sum = buffer[i] - 32768;		//Convert to signed sample
-		sum2 = buffer[i+1] - 32768;		//Repeat for the other channel of a stereo sample
+		voice->playing = 0;
+	}
+}
 
+static void eof_mix_block(unsigned short *buffer, unsigned long frames, int stereo)
+{
+	unsigned long i, samples = stereo ? frames * 2 : frames;
+	int *chart = eof_mix_chart_block, *cue = eof_mix_cue_block;
+	int sum, j, cues = 0;
+
+	/* store original sample values */
+	for(i = 0; i < samples; i++)
+		chart[i] = (int)buffer[i] - 32768;		//Convert to signed sample
+
+	if(stereo)
+	{
 		/* perform phase cancellation if enabled */
 		if(eof_phase_cancellation)
 		{
-			long sum3 = (sum - sum2) / 2;		//Subtract one channel's amplitude from the other and divide by two
-
-			sum = sum3;		//And use that for each channel's amplitude
-			sum2 = sum3;
+			for(i = 0; i < samples; i += 2)
+			{
+				chart[i] = chart[i + 1] = (chart[i] - chart[i + 1]) / 2;	//Subtract one channel's amplitude from the other and divide by two, and use that for each channel's amplitude
+			}
 		}
 
 		/* perform center isolation if enabled */
 		else if(eof_center_isolation)
 		{
-			long sum3 = (sum + sum2) / 2;		//Add the two channels' amplitudes and divide by two
-
-			sum = sum3;		//And use that for each channel's amplitude
-			sum2 = sum3;
-		}
-
-		/* apply volume multiplier */
-		if(eof_chart_volume != 100)		//If the chart volume is to be less than 100%
-		{
-			sum *= eof_chart_volume_multiplier;
-			sum2 *= eof_chart_volume_multiplier;	//If this is a stereo audio file, apply the volume to the other channel as well
+			for(i = 0; i < samples; i += 2)
+			{
+				chart[i] = chart[i + 1] = (chart[i] + chart[i + 1]) / 2;	//Add the two channels' amplitudes and divide by two, and use that for each channel's amplitude
+			}
 		}
+	}
 
-		/* mix voices */
-		for(j = 0; j < EOF_MIX_MAX_CHANNELS; j++)
-		{
-			if(!eof_voice[j].playing)
-				continue;	//If this voice isn't playing, skip it
+	/* apply volume multiplier */
+	if(eof_chart_volume != 100)		//If the chart volume is to be less than 100%
+	{
+		double multiplier = eof_chart_volume_multiplier;
 
-			cuesample = ((unsigned short *)(eof_voice[j].sp->data))[(unsigned long)eof_voice[j].pos] - 32768;
-			if(eof_voice[j].volume != 100)
-				cuesample *= eof_voice[j].multiplier;	//Change the cue to the specified loudness
+		for(i = 0; i < samples; i++)
+			chart[i] = (int)((double)chart[i] * multiplier);
+	}
 
-			sum += cuesample;
-			sum2 += cuesample;	//If this is a stereo audio file, mix the voice into the other channel as well
+	/* mix voices */
+	for(j = 0; j < EOF_MIX_MAX_CHANNELS; j++)
+	{
+		if(!eof_voice[j].playing)
+			continue;	//If this voice isn't playing, skip it
 
-			eof_voice[j].fpos += eof_mix_sample_increment;
-			eof_voice[j].pos = eof_voice[j].fpos + 0.5;	//Round to nearest full sample number
-			if(eof_voice[j].pos >= eof_voice[j].sp->len)
-			{
-				eof_voice[j].playing = 0;
-			}
+		if(!cues)
+		{	//If this is the first voice mixed into this block, clear the cue mix
+			memset(cue, 0, sizeof(int) * frames);
+			cues = 1;
 		}
+		eof_mix_voice_block(&eof_voice[j], frames);
+	}
 
-		/* Apply the floor and ceiling for 16 bit sample data as necessary */
-		if(sum < -32768)
-			sum = -32768;
-		else if(sum > 32767)
-			sum = 32767;
-		buffer[i] = sum + 32768;		//Convert the summed PCM samples to unsigned and store into buffer
-
-		if(sum2 < -32768)
-			sum2 = -32768;
-		else if(sum2 > 32767)
-			sum2 = 32767;
-		buffer[i+1] = sum2 + 32768;	//Convert the summed PCM samples to unsigned and store into buffer
-
-		eof_mix_callback_common();	//Increment the sample and check sound triggers
+	/* Apply the floor and ceiling for 16 bit sample data as necessary and convert the summed PCM samples to unsigned */
+	if(!cues)
+	{	//If no voices are playing, only the chart audio needs to be stored
+		for(i = 0; i < samples; i++)
+		{
+			sum = chart[i];
+			sum = sum < -32768 ? -32768 : (sum > 32767 ? 32767 : sum);
+			buffer[i] = (unsigned short)(sum + 32768);
+		}
+	}
+	else if(stereo)
+	{	//Mix the voices into both channels
+		for(i = 0; i < frames; i++)
+		{
+			sum = chart[2 * i] + cue[i];
+			sum = sum < -32768 ? -32768 : (sum > 32767 ? 32767 : sum);
+			buffer[2 * i] = (unsigned short)(sum + 32768);
+			sum = chart[2 * i + 1] + cue[i];
+			sum = sum < -32768 ? -32768 : (sum > 32767 ? 32767 : sum);
+			buffer[2 * i + 1] = (unsigned short)(sum + 32768);
+		}
+	}
+	else
+	{
+		for(i = 0; i < frames; i++)
+		{
+			sum = chart[i] + cue[i];
+			sum = sum < -32768 ? -32768 : (sum > 32767 ? 32767 : sum);
+			buffer[i] = (unsigned short)(sum + 32768);
+		}
 	}
-	eof_just_played = 1;
 }
 
-void eof_mix_callback_mono(void * buf, int length)
+static void eof_mix_callback(void * buf, int length, int stereo)
 {
-	unsigned long bytes_left;
+	unsigned long frames_left, frames, next_cue;
 	unsigned short * buffer;
-	long sum=0;			//Use a signed long integer to allow the clipping logic to be more efficient
-	long cuesample;		//Used to apply a volume to cues, where the appropriate amplitude multiplier for changing the cue's loudness to X% is to multiply its amplitudes by sqrt(X/100)
-	unsigned long i, j;
 
-	bytes_left = length >> 1;	//Divide by two (length refers to the number of bytes to process, but buffer will be accessed as an array of 16 bit integer values)
+	frames_left = (unsigned long)length >> 1;	//Divide by two (length refers to the number of bytes to process, but buffer will be accessed as an array of 16 bit integer values)
+	if(stereo)
+		frames_left >>= 1;	//Each stereo frame is two 16 bit values
 	buffer = (unsigned short *)buf;
 
-	/* add audio data to the buffer */
-	for(i = 0; i < bytes_left; i++)
+	/* mix the buffer in blocks that end where a sound cue is triggered, so the cue checks run once per block instead of once per sample */
+	while(frames_left)
 	{
-		/* store original sample values */
-		sum = buffer[i] - 32768;	//Convert to signed sample
-
-		/* apply volume multiplier */
-		if(eof_chart_volume != 100)		//If the chart volume is to be less than 100%
-		{
-			sum *= eof_chart_volume_multiplier;
-		}
-
-		/* mix voices */
-		for(j = 0; j < EOF_MIX_MAX_CHANNELS; j++)
-		{
-			if(eof_voice[j].playing)
-			{
-				cuesample = ((unsigned short *)(eof_voice[j].sp->data))[(unsigned long)eof_voice[j].pos] - 32768;
-				if(eof_voice[j].volume != 100)
-					cuesample *= eof_voice[j].multiplier;	//Change the cue to the specified loudness
-
-				sum += cuesample;
-
-				eof_voice[j].fpos += eof_mix_sample_increment;
-				eof_voice[j].pos = eof_voice[j].fpos + 0.5;	//Round to nearest full sample number
-				if(eof_voice[j].pos >= eof_voice[j].sp->len)
-				{
-					eof_voice[j].playing = 0;
-				}
-			}
-		}
-
-		/* Apply the floor and ceiling for 16 bit sample data as necessary */
-		if(sum < -32768)
-			sum = -32768;
-		else if(sum > 32767)
-			sum = 32767;
-		buffer[i] = sum + 32768;		//Convert the summed PCM samples to unsigned and store into buffer
-
-		eof_mix_callback_common();		//Increment the sample and check sound triggers
+		frames = frames_left;
+		if(frames > EOF_MIX_BLOCK_SIZE)
+			frames = EOF_MIX_BLOCK_SIZE;
+		next_cue = eof_mix_frames_until_cue();
+		if(frames > next_cue)
+			frames = next_cue;
+
+		eof_mix_block(buffer, frames, stereo);
+		eof_mix_callback_common(frames);	//Increment the sample count and check sound triggers
+		buffer += stereo ? frames * 2 : frames;
+		frames_left -= frames;
 	}
 	eof_just_played = 1;
 }
 
+void eof_mix_callback_stereo(void * buf, int length)
+{
+	eof_mix_callback(buf, length, 1);
+}
+
+void eof_mix_callback_mono(void * buf, int length)
+{
+	eof_mix_callback(buf, length, 0);
+}
+
 unsigned long eof_mix_msec_to_sample(unsigned long msec, int freq)
 {
 	unsigned long sample;
@@ -324,7 +436,7 @@ unsigned long eof_mix_msec_to_sample(unsigned long msec, int freq)
 void eof_mix_find_claps(void)
 {
 	unsigned long i, bitmask;
-	unsigned long tracknum;
+	unsigned long tracknum, count, guitarcount = 0;
 	EOF_PRO_GUITAR_TRACK *tp = NULL;
 
 	if(!eof_music_track)
@@ -333,12 +445,31 @@ void eof_mix_find_claps(void)
 
 	eof_mix_claps = 0;
 	eof_mix_current_clap = 0;
+	eof_mix_guitar_notes = 0;
+	eof_mix_notes = 0;
+	eof_mix_percussions = 0;
 	tracknum = eof_song->track[eof_selected_track]->tracknum;
 	if(eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
 	{	//If a pro guitar/bass track is active
 		tp = eof_song->pro_guitar_track[eof_song->track[eof_selected_track]->tracknum];
 	}
 
+	//Size the cue arrays for the active track and the lead vocal track
+	count = eof_get_track_size(eof_song, eof_selected_track);
+	if(eof_song->vocal_track[0]->lyrics > count)
+	{
+		count = eof_song->vocal_track[0]->lyrics;
+	}
+	if(tp)
+	{
+		guitarcount = count * 6;	//Each note can queue one MIDI tone per string
+	}
+	if(!eof_mix_reserve_cues(count, guitarcount))
+	{
+		eof_log("\tError allocating memory for sound cues", 1);
+		return;
+	}
+
 	//Queue claps
 	if(eof_vocals_selected)
 	{
@@ -485,22 +616,22 @@ void eof_mix_init(void)
 	eof_sound_clap = eof_load_wav("clap.wav");
 	if(!eof_sound_clap)
 	{
-		allegro_message("Couldn't load clap sound!");
+		eof_message("Couldn't load clap sound!");
 	}
 	eof_sound_metronome = eof_load_wav("metronome.wav");
 	if(!eof_sound_metronome)
 	{
-		allegro_message("Couldn't load metronome sound!");
+		eof_message("Couldn't load metronome sound!");
 	}
 	eof_sound_metronome_low = eof_load_wav("metronome_low.wav");
 	if(!eof_sound_metronome_low)
 	{
-		allegro_message("Couldn't load low pitched metronome sound!");
+		eof_message("Couldn't load low pitched metronome sound!");
 	}
 	eof_sound_grid_snap = eof_load_wav("gridsnap.wav");
 	if(!eof_sound_grid_snap)
 	{
-		allegro_message("Couldn't load seek sound!");
+		eof_message("Couldn't load seek sound!");
 	}
 	for(i = 36; i < 85; i++)
 	{	//Load piano tones (only tones numbered 36 through 84 are included in the DAT file
@@ -552,7 +683,7 @@ SAMPLE *eof_mix_load_ogg_sample(char *fn)
 			alogg_destroy_ogg(temp_ogg);
 		}
 		if(loadedsample == NULL)
-			allegro_message("Couldn't load sample %s!",fn);
+			eof_message("Couldn't load sample %s!",fn);
 		free(buffer);
 	}
 
@@ -614,6 +745,23 @@ void eof_mix_exit(void)
 	destroy_sample(eof_sound_clap4);
 	eof_sound_clap4=NULL;
 
+	eof_mix_claps = eof_mix_notes = eof_mix_percussions = eof_mix_guitar_notes = 0;
+	free(eof_mix_clap_pos);
+	eof_mix_clap_pos = NULL;
+	free(eof_mix_note_pos);
+	eof_mix_note_pos = NULL;
+	free(eof_mix_note_note);
+	eof_mix_note_note = NULL;
+	free(eof_mix_note_ms_pos);
+	eof_mix_note_ms_pos = NULL;
+	free(eof_mix_note_ms_end);
+	eof_mix_note_ms_end = NULL;
+	free(eof_mix_percussion_pos);
+	eof_mix_percussion_pos = NULL;
+	free(eof_guitar_notes);
+	eof_guitar_notes = NULL;
+	eof_mix_cue_capacity = eof_mix_guitar_note_capacity = 0;
+
 	for(i = 0; i < EOF_MAX_VOCAL_TONES; i++)
 	{
 		if(eof_sound_note[i] != NULL)
@@ -14,6 +14,19 @@
 
 char eof_last_tab_notation[65] = {0};	//Used to store a copy of the results of the last call to eof_get_note_notation(), so repeated notation can be summarized
 
+typedef struct
+{
+	BITMAP *bitmap;		//The cached bitmap, or NULL if this entry is unused
+	char text[65];		//The fret number or notation rendered to the bitmap
+	FONT *font;
+	unsigned long padding;
+	int textcol, fillcol;
+	int height;			//The height the bitmap was stretched to, or 0 if it is at the font's height
+} EOF_FRET_NUMBER_SPRITE;
+
+#define EOF_FRET_NUMBER_SPRITE_COUNT 512
+static EOF_FRET_NUMBER_SPRITE eof_fret_number_sprites[EOF_FRET_NUMBER_SPRITE_COUNT];	//A hash table of fret number and notation bitmaps, an entry is replaced when another key hashes to its slot
+
 unsigned long eof_note_count_colors(EOF_SONG *sp, unsigned long track, unsigned long note)
 {
 //	eof_log("eof_note_count_colors() entered", 3);
@@ -140,8 +153,7 @@ int eof_adjust_notes(unsigned long track, int offset)
 
 		if(track == ULONG_MAX)
 		{
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tProcessing track \"%s\"", eof_song->track[i]->name);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\t\tProcessing track \"%s\"", eof_song->track[i]->name);
 		}
 
 		//Offset the regular notes
@@ -555,13 +567,12 @@ int eof_note_draw(unsigned long track, unsigned long notenum, int p, EOF_WINDOW
 						}
 					}
 
-					fretbmp = eof_create_fret_number_bitmap(NULL, notation, 0, 2, textcol, bgcol, eof_symbol_font);	//Build a bordered bitmap for the technique, allow 2 pixels for padding
+					fretbmp = eof_get_fret_number_sprite(NULL, notation, 0, 2, textcol, bgcol, eof_symbol_font, 0);	//Get a bordered bitmap for the technique, allow 2 pixels for padding
 					if(fretbmp != NULL)
-					{	//Render the bitmap in place of the note and then destroy the bitmap
+					{	//Render the bitmap in place of the note
 						y = EOF_EDITOR_RENDER_OFFSET + 15 + ychart[ctr];	//Store this to make the code more readable
 						draw_sprite(window->screen, fretbmp, x - (fretbmp->w/2), y - (text_height(font)/2));	//Fudge (x,y) to make it print centered over the gem
 					}
-					destroy_bitmap(fretbmp);
 				}//Render for each of the available fret lanes
 				return 0;	//Return status:  Note was not clipped in its entirety
 			}//If tech view is in effect, render the tab notation for the note and nothing else
@@ -790,11 +801,10 @@ int eof_note_draw(unsigned long track, unsigned long notenum, int p, EOF_WINDOW
 				if(!eof_legacy_view && (track > 0) && (notenote & mask) && (eof_song->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT) && (eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT))
 				{	//If legacy view is disabled, this is a pro guitar note and a pro guitar track is active, perform pro guitar specific rendering
 					//Render the fret number over the center of the note (but only if the active track is a pro guitar track)
-					BITMAP *fretbmp = eof_create_fret_number_bitmap(eof_song->pro_guitar_track[tracknum]->note[notenum], NULL, ctr, 2, tcol, dcol, font);	//Allow 2 pixels for padding
+					BITMAP *fretbmp = eof_get_fret_number_sprite(eof_song->pro_guitar_track[tracknum]->note[notenum], NULL, ctr, 2, tcol, dcol, font, 0);	//Allow 2 pixels for padding
 					if(fretbmp != NULL)
-					{	//Render the bitmap on top of the 2D note and then destroy the bitmap
+					{	//Render the bitmap on top of the 2D note
 						draw_sprite(window->screen, fretbmp, x - (fretbmp->w/2), y - (text_height(font)/2));	//Fudge (x,y) to make it print centered over the gem
-						destroy_bitmap(fretbmp);
 					}
 				}
 			}
@@ -1572,21 +1582,11 @@ int eof_note_draw_3d(unsigned long track, unsigned long notenum, int p)
 
 			if(!eof_legacy_view && (notenote & mask) && (eof_song->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT))
 			{	//If legacy view is disabled and this is a pro guitar note, render the fret number over the center of the note
-				BITMAP *fretbmp = eof_create_fret_number_bitmap(eof_song->pro_guitar_track[tracknum]->note[notenum], NULL, ctr, 8, eof_color_white, eof_color_black, font);	//Allow one extra character's width for padding
+				int scaledheight = eof_full_height_3d_preview ? (double)text_height(font) * height_scale : 0;	//If the fret number bitmap should be scaled also, use the scaled variant of the sprite
+				BITMAP *fretbmp = eof_get_fret_number_sprite(eof_song->pro_guitar_track[tracknum]->note[notenum], NULL, ctr, 8, eof_color_white, eof_color_black, font, scaledheight);	//Allow one extra character's width for padding
 				if(fretbmp != NULL)
-				{	//Render the bitmap on top of the 3D note and then destroy the bitmap
-					if(eof_full_height_3d_preview)
-					{	//If the fret number bitmap should be scaled also
-						BITMAP *scaledbmp = create_bitmap(fretbmp->w, (double)fretbmp->h * height_scale);
-						if(scaledbmp)
-						{	//If the scaled bitmap was created
-							stretch_blit(fretbmp, scaledbmp, 0, 0, fretbmp->w, fretbmp->h, 0, 0, scaledbmp->w, scaledbmp->h);
-							destroy_bitmap(fretbmp);
-							fretbmp = scaledbmp;
-						}
-					}
+				{	//Render the bitmap on top of the 3D note
 					ocd3d_draw_bitmap(eof_window_3d->screen, fretbmp, xchart[lanenum] - 8, 200 - (image_height / 2) + offset_y_3d, npos);
-					destroy_bitmap(fretbmp);
 				}
 			}
 			else if(track == EOF_TRACK_DRUM_PS)
@@ -1937,42 +1937,48 @@ unsigned long eof_find_lyric_number(EOF_LYRIC * np)
 	return 0;
 }
 
-BITMAP *eof_create_fret_number_bitmap(EOF_PRO_GUITAR_NOTE *note, char *text, unsigned char stringnum, unsigned long padding, int textcol, int fillcol, FONT *font)
-{
-	BITMAP *fretbmp = NULL;
-	int height, width;
-	char fretstring[10] = {0};
-
-	if(!note && !text)
-		return NULL;	//Invalid parameters
-	if(!font)
-		return NULL;
-
+static char *eof_get_fret_number_text(EOF_PRO_GUITAR_NOTE *note, char *text, unsigned char stringnum, char *fretstring, size_t fretstringsize, int *textcol, int *fillcol)
+{	//Returns the string to render for the specified note's string (using fretstring as the buffer) or text, updating the colors if the note calls for different ones
 	if(note != NULL)
 	{	//If the specified note's fretting will be rendered to the bitmap
 		if(note->frets[stringnum] & 0x80)
 		{	//This is a muted fret
-			(void) snprintf(fretstring, sizeof(fretstring) - 1, "X");
+			(void) snprintf(fretstring, fretstringsize - 1, "X");
 		}
 		else
 		{	//This is a non muted fret
 			if(note->ghost & (1 << stringnum))
 			{	//This is a ghosted note
-				(void) snprintf(fretstring, sizeof(fretstring) - 1,"(%u)", note->frets[stringnum]);
+				(void) snprintf(fretstring, fretstringsize - 1,"(%u)", note->frets[stringnum]);
 				if(note->eflags & EOF_PRO_GUITAR_NOTE_EFLAG_GHOST_HS)
 				{	//If this note has ghost handshape status
-					fillcol = eof_color_red;
-					textcol = eof_color_blue;
+					*fillcol = eof_color_red;
+					*textcol = eof_color_blue;
 				}
 			}
 			else
 			{	//This is a normal note
-				(void) snprintf(fretstring, sizeof(fretstring) - 1,"%u", note->frets[stringnum]);
+				(void) snprintf(fretstring, fretstringsize - 1,"%u", note->frets[stringnum]);
 			}
 		}
 		text = fretstring;	//This string will be rendered to the bitmap
 	}
 
+	return text;
+}
+
+BITMAP *eof_create_fret_number_bitmap(EOF_PRO_GUITAR_NOTE *note, char *text, unsigned char stringnum, unsigned long padding, int textcol, int fillcol, FONT *font)
+{
+	BITMAP *fretbmp = NULL;
+	int height, width;
+	char fretstring[10] = {0};
+
+	if(!note && !text)
+		return NULL;	//Invalid parameters
+	if(!font)
+		return NULL;
+
+	text = eof_get_fret_number_text(note, text, stringnum, fretstring, sizeof(fretstring), &textcol, &fillcol);
 	width = text_length(font, text) + padding + 1;	//The font in use doesn't look centered, so pad the left by one pixel
 	height = text_height(font);
 	fretbmp = create_bitmap(width, height);
@@ -1986,6 +1992,79 @@ BITMAP *eof_create_fret_number_bitmap(EOF_PRO_GUITAR_NOTE *note, char *text, uns
 	return fretbmp;
 }
 
+BITMAP *eof_get_fret_number_sprite(EOF_PRO_GUITAR_NOTE *note, char *text, unsigned char stringnum, unsigned long padding, int textcol, int fillcol, FONT *font, int height)
+{
+	char fretstring[10] = {0};
+	unsigned long hash = 5381, ctr;
+	EOF_FRET_NUMBER_SPRITE *sprite;
+	BITMAP *fretbmp, *scaledbmp;
+
+	if(!note && !text)
+		return NULL;	//Invalid parameters
+	if(!font)
+		return NULL;
+
+	text = eof_get_fret_number_text(note, text, stringnum, fretstring, sizeof(fretstring), &textcol, &fillcol);
+	if(strlen(text) >= sizeof(sprite->text))
+		return NULL;	//The text is too long to be cached
+
+	//Find the sprite's slot in the hash table
+	for(ctr = 0; text[ctr] != '\0'; ctr++)
+	{
+		hash = hash * 33 + (unsigned char)text[ctr];
+	}
+	hash = hash * 33 + (unsigned long)textcol;
+	hash = hash * 33 + (unsigned long)fillcol;
+	hash = hash * 33 + padding;
+	hash = hash * 33 + (unsigned long)height;
+	hash = hash * 33 + (font == eof_symbol_font);
+	sprite = &eof_fret_number_sprites[hash % EOF_FRET_NUMBER_SPRITE_COUNT];
+	if(sprite->bitmap && (sprite->font == font) && (sprite->padding == padding) && (sprite->textcol == textcol) && (sprite->fillcol == fillcol) && (sprite->height == height) && !strcmp(sprite->text, text))
+	{	//If this sprite was already rendered
+		return sprite->bitmap;
+	}
+
+	//Otherwise render it, replacing whatever sprite was cached in this slot
+	fretbmp = eof_create_fret_number_bitmap(NULL, text, 0, padding, textcol, fillcol, font);
+	if(!fretbmp)
+		return NULL;
+	if(height && (height != fretbmp->h))
+	{	//If the bitmap is to be scaled
+		scaledbmp = create_bitmap(fretbmp->w, height);
+		if(scaledbmp)
+		{	//If the scaled bitmap was created, it replaces the unscaled one
+			stretch_blit(fretbmp, scaledbmp, 0, 0, fretbmp->w, fretbmp->h, 0, 0, scaledbmp->w, scaledbmp->h);
+			destroy_bitmap(fretbmp);
+			fretbmp = scaledbmp;
+		}
+	}
+	if(sprite->bitmap)
+		destroy_bitmap(sprite->bitmap);
+	sprite->bitmap = fretbmp;
+	(void) ustrcpy(sprite->text, text);
+	sprite->font = font;
+	sprite->padding = padding;
+	sprite->textcol = textcol;
+	sprite->fillcol = fillcol;
+	sprite->height = height;
+
+	return fretbmp;
+}
+
+void eof_destroy_fret_number_sprites(void)
+{
+	unsigned long ctr;
+
+	for(ctr = 0; ctr < EOF_FRET_NUMBER_SPRITE_COUNT; ctr++)
+	{	//For each entry in the sprite cache
+		if(eof_fret_number_sprites[ctr].bitmap)
+		{
+			destroy_bitmap(eof_fret_number_sprites[ctr].bitmap);
+			eof_fret_number_sprites[ctr].bitmap = NULL;
+		}
+	}
+}
+
 void eof_get_note_notation(char *buffer, unsigned long track, unsigned long note, unsigned char sanitycheck)
 {
 	unsigned long index = 0, flags = 0, eflags = 0;
@@ -2648,7 +2727,7 @@ char eof_pro_guitar_note_is_open_chord(EOF_PRO_GUITAR_TRACK *tp, unsigned long n
 
 char eof_build_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, char *buffer)
 {
-	char *name;
+	const char *name;
 	int scale = 0, chord = 0, isslash = 0, bassnote = 0;
 	unsigned long tracknum;
 
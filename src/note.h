@@ -59,6 +59,13 @@ BITMAP *eof_create_fret_number_bitmap(EOF_PRO_GUITAR_NOTE *note, char *text, uns
 	//Used to create a bordered rectangle bitmap with the specified string number, for use in the editor or 3D window, returns NULL on error
 	//The specified font is used, allowing the mono-spaced symbol and regular fonts to be used interchangeably
 	//If note is NULL, a bitmap containing the string in the text pointer is used instead
+BITMAP *eof_get_fret_number_sprite(EOF_PRO_GUITAR_NOTE *note, char *text, unsigned char stringnum, unsigned long padding, int textcol, int fillcol, FONT *font, int height);
+	//Returns the same bitmap eof_create_fret_number_bitmap() would create, from a cache of previously rendered fret numbers and notations
+	//If height is nonzero, the bitmap is stretched to that height
+	//The returned bitmap belongs to the cache and must not be destroyed by the calling function
+	//Returns NULL on error
+void eof_destroy_fret_number_sprites(void);
+	//Destroys the cached fret number and notation bitmaps, so they are re-rendered with the current fonts and colors
 void eof_get_note_notation(char *buffer, unsigned long track, unsigned long note, unsigned char sanitycheck);
 	//Used to store notations (ie. "PM" for palm mute) for the specified note into the buffer, which should be able to hold at least 65 characters just to guarantee an overflow isn't possible
 	//If sanitycheck is nonzero and the specified note is a pro guitar note, the validity of any pitched/unpitched slide technique it has is checked
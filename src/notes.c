@@ -22,6 +22,34 @@
 
 #define TEXT_PANEL_BUFFER_SIZE 2047
 
+int eof_text_panel_mouse_wanted = 0;
+
+static EOF_NOTES_MACRO_CACHE_ENTRY eof_notes_macro_cache[EOF_NOTES_MACRO_CACHE_SIZE];
+static EOF_SONG *eof_notes_macro_cache_song = NULL;	//The chart, edit counter, track difficulty and tech view state the cached statistics reflect
+static unsigned long eof_notes_macro_cache_edit_counter = 0;
+static unsigned long eof_notes_macro_cache_track = 0;
+static unsigned long eof_notes_macro_cache_type = 0;
+static char eof_notes_macro_cache_tech_view = 0;
+
+//Macros whose expansion only depends on the chart's content and the active track difficulty
+static const char *eof_notes_statistic_macros[] =
+{
+	"IF_ACTIVE_DIFFICULTY_HAS_EMPTY_SOLO", "IF_ACTIVE_DIFFICULTY_HAS_NO_CYMBALS", "IF_ANY_SOLOS_CLOSER_THAN_1_SECOND", "IF_TRACK_DIFF_HAS_INVALID_DRUM_CHORDS",
+	"IF_TRACK_HAS_NO_STAR_POWER", "IF_TRACK_HAS_NO_EXPERT_PLUS_BASS", "IF_ANY_TRACK_DIFFICULTY_UNDEFINED",
+	"TRACK_SOLO_NOTE_COUNT", "TRACK_SOLO_NOTE_STATS", "TRACK_SP_NOTE_COUNT", "SP_LYRIC_LINE_COUNT", "TRACK_SP_NOTE_STATS", "TRACK_SLIDER_NOTE_COUNT", "TRACK_SLIDER_NOTE_STATS",
+	"TRACK_DIFF_COUNT_AND_RATIO_OPEN_CHORDS", "TRACK_DIFF_COUNT_AND_RATIO_BARRE_CHORDS", "TRACK_DIFF_COUNT_AND_RATIO_STRING_MUTES",
+	"TRACK_DIFF_NOTE_COUNT_AND_RATIO_EXPERT_PLUS_BASS", "TRACK_DIFF_NOTE_COUNT_AND_RATIO_CYMBALS",
+	"TRACK_DIFF_COUNT_AND_RATIO_PITCHED_LYRIC", "TRACK_DIFF_COUNT_AND_RATIO_UNPITCHED_LYRIC", "TRACK_DIFF_COUNT_AND_RATIO_PERCUSSION_LYRIC",
+	"TRACK_DIFF_COUNT_AND_RATIO_FREESTYLE_LYRIC", "TRACK_DIFF_COUNT_AND_RATIO_PITCH_SHIFT_LYRIC", NULL
+};
+
+//Parameterized macros with the same property, matched by prefix
+static const char *eof_notes_statistic_macro_prefixes[] =
+{
+	"IF_TRACK_DIFF_HAS_NOTES_WITH_GEM_COUNT_", "TRACK_DIFF_NUMBER_NOTES_WITH_GEM_COUNT_", "TRACK_DIFF_NOTE_COUNT_INSTANCES_",
+	"TRACK_DIFF_NOTE_COUNT_AND_RATIO_INSTANCES_", "COUNT_LYRICS_WITH_PITCH_NUMBER_", NULL
+};
+
 EOF_TEXT_PANEL *eof_create_text_panel(char *filename, int builtin)
 {
 	EOF_TEXT_PANEL *panel;
@@ -30,8 +58,7 @@ EOF_TEXT_PANEL *eof_create_text_panel(char *filename, int builtin)
 	if(!filename)
 		return NULL;	//Invalid parameter
 
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Creating text panel from file \"%s\"", filename);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "Creating text panel from file \"%s\"", filename);
 	if(!exists(filename))
 	{	//If the file doesn't exist
 		if(builtin)
@@ -53,6 +80,8 @@ EOF_TEXT_PANEL *eof_create_text_panel(char *filename, int builtin)
 		return NULL;	//Couldn't allocate memory
 
 	(void) ustrncpy(panel->filename, filename, sizeof(panel->filename) - 1);	//Copy the input file name
+	panel->line = NULL;
+	panel->linecount = 0;
 	panel->text = eof_buffer_file(filename, 1);	//Buffer the specified file into memory, appending a NULL terminator
 	if(panel->text == NULL)
 	{	//Could not buffer file
@@ -61,21 +90,212 @@ EOF_TEXT_PANEL *eof_create_text_panel(char *filename, int builtin)
 		free(panel);
 		return NULL;
 	}
+	if(!eof_compile_text_panel(panel))
+	{	//Could not split the file into lines
+		eof_log("Error loading:  Cannot compile text panel", 1);
+		free(panel->text);
+		free(panel);
+		return NULL;
+	}
 
 	eof_notes_panel_logged = 0;	//Enable exhaustive logging of this panel's processing for the next frame
 	return panel;
 }
 
+int eof_compile_text_panel(EOF_TEXT_PANEL *panel)
+{
+	unsigned long index, start, numlines = 1;
+
+	if(!panel || !panel->text)
+		return 0;	//Invalid parameter
+
+	for(index = 0; panel->text[index] != '\0'; index++)
+	{	//Count the line breaks to determine the maximum number of lines
+		if(panel->text[index] == '\n')
+			numlines++;
+	}
+	panel->line = malloc(sizeof(EOF_TEXT_PANEL_LINE) * numlines);
+	if(!panel->line)
+		return 0;	//Couldn't allocate memory
+	panel->linecount = 0;
+
+	for(index = start = 0; ; index++)
+	{	//For each character in the text file
+		int endofline = 0;
+
+		if(panel->text[index] == '\0')
+		{	//The end of the file was reached
+			endofline = 1;
+		}
+		else if((panel->text[index] == '\r') && (panel->text[index + 1] == '\n'))
+		{	//Carriage return and line feed characters represent a new line
+			panel->text[index] = '\0';	//Terminate the line in place
+			endofline = 2;
+		}
+		if(!endofline)
+			continue;
+
+		if(index - start >= TEXT_PANEL_BUFFER_SIZE)
+		{	//If the line doesn't fit into the expansion buffer
+			eof_log("\t\t\tText panel line is too long, ignoring the rest of the file", 1);
+			break;
+		}
+		if((index > start) && (panel->text[start] != ';'))
+		{	//If the line isn't empty and isn't a comment (neither of which ever print anything)
+			EOF_TEXT_PANEL_LINE *lp = &panel->line[panel->linecount];
+
+			lp->text = &panel->text[start];
+			lp->length = index - start;
+			lp->hasmacro = (strchr(lp->text, '%') ? 1 : 0);
+			panel->linecount++;
+		}
+		if(endofline == 1)
+			break;
+		index++;	//Skip the line feed character
+		start = index + 1;
+	}
+
+	eof_logf(2, "\tCompiled %lu printable text panel lines", panel->linecount);
+	return 1;
+}
+
 void eof_destroy_text_panel(EOF_TEXT_PANEL *panel)
 {
 	if(panel)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Destroying text panel for file \"%s\"", panel->filename);
-		eof_log(eof_log_string, 2);
+		eof_logf(2, "Destroying text panel for file \"%s\"", panel->filename);
 		if(panel->text)
 			free(panel->text);
+		if(panel->line)
+			free(panel->line);
 		free(panel);
 	}
+	eof_destroy_notes_macro_cache();	//Any statistics cached for this panel's macros are no longer needed
+}
+
+void eof_destroy_notes_macro_cache(void)
+{
+	unsigned long ctr;
+
+	for(ctr = 0; ctr < EOF_NOTES_MACRO_CACHE_SIZE; ctr++)
+	{	//For each slot in the cache
+		if(eof_notes_macro_cache[ctr].macro)
+			free(eof_notes_macro_cache[ctr].macro);
+		if(eof_notes_macro_cache[ctr].expansion)
+			free(eof_notes_macro_cache[ctr].expansion);
+	}
+	memset(eof_notes_macro_cache, 0, sizeof(eof_notes_macro_cache));
+}
+
+static unsigned long eof_notes_macro_hash(const char *macro)
+{
+	unsigned long hash = 2166136261UL;	//FNV-1a, case insensitive since macro names are matched case insensitively
+
+	for(; *macro != '\0'; macro++)
+	{
+		hash ^= (unsigned char)toupper((unsigned char)*macro);
+		hash *= 16777619UL;
+	}
+
+	return hash;
+}
+
+static char eof_notes_macro_is_statistic(char *macro)
+{
+	unsigned long ctr;
+
+	for(ctr = 0; eof_notes_statistic_macros[ctr]; ctr++)
+	{
+		if(!ustricmp(macro, eof_notes_statistic_macros[ctr]))
+			return 1;
+	}
+	for(ctr = 0; eof_notes_statistic_macro_prefixes[ctr]; ctr++)
+	{
+		if(strcasestr_spec(macro, eof_notes_statistic_macro_prefixes[ctr]))
+			return 1;
+	}
+
+	return 0;
+}
+
+static EOF_NOTES_MACRO_CACHE_ENTRY *eof_notes_macro_cache_find(char *macro)
+{
+	unsigned long index, probe;
+	EOF_NOTES_MACRO_CACHE_ENTRY *ptr;
+
+	index = eof_notes_macro_hash(macro) % EOF_NOTES_MACRO_CACHE_SIZE;
+	for(probe = 0; probe < EOF_NOTES_MACRO_CACHE_SIZE; probe++)
+	{	//Linear probing
+		ptr = &eof_notes_macro_cache[(index + probe) % EOF_NOTES_MACRO_CACHE_SIZE];
+		if(!ptr->macro)
+		{	//If this slot is unused, the macro isn't cached yet
+			ptr->macro = malloc(strlen(macro) + 1);
+			if(!ptr->macro)
+				return NULL;	//Couldn't allocate memory
+			strcpy(ptr->macro, macro);
+			ptr->expansion = NULL;
+			ptr->statistic = eof_notes_macro_is_statistic(macro);	//Classify the macro once instead of every frame
+			ptr->valid = 0;
+			return ptr;
+		}
+		if(!strcmp(ptr->macro, macro))
+			return ptr;
+	}
+
+	return NULL;	//The cache is full
+}
+
+int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel)
+{
+	EOF_NOTES_MACRO_CACHE_ENTRY *ptr;
+	char tech_view = 0;
+	unsigned long ctr;
+	int status;
+
+	if(!macro || !dest_buffer || (dest_buffer_size < 1) || !panel || !eof_song)
+		return eof_expand_notes_window_macro_uncached(macro, dest_buffer, dest_buffer_size, panel);
+
+	if(eof_song->track[eof_selected_track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
+	{	//Tech view changes which notes the statistics examine
+		tech_view = eof_menu_pro_guitar_track_get_tech_view_state(eof_song->pro_guitar_track[eof_song->track[eof_selected_track]->tracknum]);
+	}
+	if((eof_notes_macro_cache_song != eof_song) || (eof_notes_macro_cache_edit_counter != eof_chart_edit_counter) || (eof_notes_macro_cache_track != eof_selected_track) ||
+		(eof_notes_macro_cache_type != eof_note_type) || (eof_notes_macro_cache_tech_view != tech_view) || mouse_b)
+	{	//If the chart or active track difficulty changed since the statistics were cached, or a mouse drag may be altering the chart
+		for(ctr = 0; ctr < EOF_NOTES_MACRO_CACHE_SIZE; ctr++)
+			eof_notes_macro_cache[ctr].valid = 0;
+		eof_notes_macro_cache_song = eof_song;
+		eof_notes_macro_cache_edit_counter = eof_chart_edit_counter;
+		eof_notes_macro_cache_track = eof_selected_track;
+		eof_notes_macro_cache_type = eof_note_type;
+		eof_notes_macro_cache_tech_view = tech_view;
+	}
+
+	ptr = eof_notes_macro_cache_find(macro);
+	if(!ptr || !ptr->statistic)
+	{	//If the macro couldn't be cached or its expansion depends on more than the chart's content
+		return eof_expand_notes_window_macro_uncached(macro, dest_buffer, dest_buffer_size, panel);
+	}
+	if(ptr->valid && ptr->expansion)
+	{	//If the statistic is cached
+		strncpy(dest_buffer, ptr->expansion, dest_buffer_size - 1);
+		dest_buffer[dest_buffer_size - 1] = '\0';
+		return ptr->status;
+	}
+
+	dest_buffer[0] = '\0';
+	status = eof_expand_notes_window_macro_uncached(macro, dest_buffer, dest_buffer_size, panel);
+	if(ptr->expansion)
+		free(ptr->expansion);
+	ptr->expansion = malloc(strlen(dest_buffer) + 1);
+	if(ptr->expansion)
+	{
+		strcpy(ptr->expansion, dest_buffer);
+		ptr->status = status;
+		ptr->valid = 1;
+	}
+
+	return status;
 }
 
 int eof_expand_notes_window_text(char *src_buffer, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel)
@@ -340,7 +560,7 @@ int eof_expand_notes_window_text(char *src_buffer, char *dest_buffer, unsigned l
 	return 1;
 }
 
-int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel)
+int eof_expand_notes_window_macro_uncached(char *macro, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel)
 {
 	unsigned long tracknum, tracksize;
 	EOF_PHRASE_SECTION *phraseptr;
@@ -352,8 +572,7 @@ int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long
 
 	if((eof_log_level > 2) && !eof_notes_panel_logged)
 	{	//If exhaustive logging is enabled and this panel hasn't been logged since it was loaded
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\tProcessing Notes macro \"%s\"", macro);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "\t\t\tProcessing Notes macro \"%s\"", macro);
 	}
 
 	tracknum = eof_song->track[eof_selected_track]->tracknum;
@@ -709,7 +928,7 @@ int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long
 	{
 		if(eof_selection.current < tracksize)
 		{	//If a note is selected
-			char *name = eof_get_note_name(eof_song, eof_selected_track, eof_selection.current);
+			const char *name = eof_get_note_name(eof_song, eof_selected_track, eof_selection.current);
 
 			if(name[0] != '\0')
 			{	//If this note was manually given a name
@@ -3162,6 +3381,8 @@ int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long
 	{
 		char name[20] = {0};
 		EOF_WINDOW *ptr = eof_coordinates_identify_window(mouse_x, mouse_y, name);	//Determine which subwindow the mouse is in
+
+		eof_text_panel_mouse_wanted = 1;
 		if(ptr)
 		{	//If it is in a subwindow
 			snprintf(dest_buffer, dest_buffer_size, "%d (%s: %d)", mouse_x, name, mouse_x - ptr->x);
@@ -3178,6 +3399,8 @@ int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long
 	{
 		char name[20] = {0};
 		EOF_WINDOW *ptr = eof_coordinates_identify_window(mouse_x, mouse_y, name);	//Determine which subwindow the mouse is in
+
+		eof_text_panel_mouse_wanted = 1;
 		if(ptr)
 		{	//If it is in a subwindow
 			snprintf(dest_buffer, dest_buffer_size, "%d (%s: %d)", mouse_y, name, mouse_y - ptr->y);
@@ -3739,7 +3962,8 @@ int eof_read_macro_gem_designations(char *string, unsigned char *bitmask, unsign
 void eof_render_text_panel(EOF_TEXT_PANEL *panel, int opaque)
 {
 	char buffer[TEXT_PANEL_BUFFER_SIZE+1], buffer2[TEXT_PANEL_BUFFER_SIZE+1];
-	unsigned long src_index, dst_index, linectr = 1;
+	char *output;
+	unsigned long linectr;
 	int retval;
 
 	if(!eof_song_loaded || !eof_song)	//If a project isn't loaded
@@ -3749,8 +3973,7 @@ void eof_render_text_panel(EOF_TEXT_PANEL *panel, int opaque)
 
 	if((eof_log_level > 2) && !eof_notes_panel_logged)
 	{	//If exhaustive logging is enabled and this panel hasn't been logged since it was loaded
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tRendering text panel for file \"%s\"", panel->filename);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "\t\tRendering text panel for file \"%s\"", panel->filename);
 	}
 
 	if(!eof_notes_panel_logged)
@@ -3776,25 +3999,21 @@ void eof_render_text_panel(EOF_TEXT_PANEL *panel, int opaque)
 
 	if((eof_log_level > 2) && !eof_notes_panel_logged)
 	{	//If exhaustive logging is enabled and this panel hasn't been logged since it was loaded
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tBeginning processing of panel text beginning with line:  %.20s", panel->text);
-		eof_log(eof_log_string, 3);
+		eof_logf(3, "\t\tBeginning processing of panel text beginning with line:  %.20s", panel->text);
 	}
 
-	//Parse the contents of the buffered file one line at a time and print each to the screen
-	src_index = dst_index = 0;	//Reset these indexes
-	while(panel->text[src_index] != '\0')
-	{	//Until the end of the text file is reached
-		char thischar = panel->text[src_index++];	//Read one character from the source buffer
+	//Process the compiled lines of the panel one at a time and print each to the screen
+	for(linectr = 0; linectr < panel->linecount; linectr++)
+	{	//For each printable line in the text file
+		EOF_TEXT_PANEL_LINE *lp = &panel->line[linectr];
 
-		if(dst_index >= TEXT_PANEL_BUFFER_SIZE)
-		{	//If the output buffer is full
-			buffer[TEXT_PANEL_BUFFER_SIZE] = '\0';	//NULL terminate the buffer at its last byte
-			eof_log("\t\t\tBuffer full", 3);
-			return;
+		if(!eof_notes_panel_logged)
+		{
+			eof_logf(3, "\t\tBeginning processing of panel text line #%lu", linectr + 1);
 		}
-		if((thischar == '\r') && (panel->text[src_index] == '\n'))
-		{	//Carriage return and line feed characters represent a new line
-			buffer[dst_index] = '\0';	//NULL terminate the buffer
+		if(lp->hasmacro)
+		{	//If the line has macros to expand
+			memcpy(buffer, lp->text, lp->length + 1);	//The expansion alters the source buffer when processing conditional macros, so work on a copy
 			retval = eof_expand_notes_window_text(buffer, buffer2, TEXT_PANEL_BUFFER_SIZE, panel);
 			if(!retval)
 			{	//If the buffer's content was not successfully parsed to expand macros, disable the notes panel
@@ -3802,61 +4021,29 @@ void eof_render_text_panel(EOF_TEXT_PANEL *panel, int opaque)
 				eof_log("\t\t\tMacro expansion error", 3);
 				return;
 			}
-			if(panel->allowempty || panel->contentprinted || (buffer2[0] != '\0'))
-			{	//If the printing of an empty line was allowed by the %EMPTY% macro or this line isn't empty
-				//If content was printed earlier in the line and flushed to the Notes panel, allow the coordinates to reset to the next line
-				if(!eof_notes_panel_logged)
-					eof_log("\t\t\tPrinting line", 3);
-				textout_ex(panel->window->screen, font, buffer2, panel->xpos, panel->ypos, panel->color, panel->bgcolor);	//Print this line to the screen
-				panel->allowempty = 0;	//Reset this condition, it has to be enabled per-line
-				panel->xpos = 2;			//Reset the x coordinate to the beginning of the line
-				panel->ypos +=12;
-				panel->contentprinted = 0;
-				if(!eof_notes_panel_logged)
-					eof_log("\t\t\tLine printed", 3);
-			}
-
-			dst_index = 0;	//Reset the destination buffer index
-			src_index++;	//Seek past the line feed character in the source buffer
-			if(panel->endpanel)
-			{	//If the printing of this panel was signaled to end
-				break;	//Break from while loop
-			}
-			linectr++;		//Track the line number being processed for debugging purposes
-			if(!eof_notes_panel_logged)
-			{
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tBeginning processing of panel text line #%lu", linectr);
-				eof_log(eof_log_string, 3);
-			}
+			output = buffer2;
 		}
 		else
-		{
-			buffer[dst_index++] = thischar;	//Append the character to the destination buffer
+		{	//Otherwise the line is printed as-is
+			output = lp->text;
 		}
-	}
-
-	//Print any remaining content in the output buffer
-	if(dst_index && (dst_index < TEXT_PANEL_BUFFER_SIZE))
-	{	//If there are any characters in the destination buffer, and there is room in the buffer for the NULL terminator
-		if(!eof_notes_panel_logged)
-			eof_log("\t\tProcessing remainder of buffer", 3);
-		buffer[dst_index] = '\0';	//NULL terminate the buffer
-		retval = eof_expand_notes_window_text(buffer, buffer2, TEXT_PANEL_BUFFER_SIZE, panel);
-		if(!retval)
-		{	//If the buffer's content was not successfully parsed to expand macros, disable the notes panel
-			eof_enable_notes_panel = 0;
-			eof_log("\t\t\tMacro expansion error", 3);
-			return;
-		}
-		if((retval == 2) || (buffer2[0] != '\0'))
+		if(panel->allowempty || panel->contentprinted || (output[0] != '\0'))
 		{	//If the printing of an empty line was allowed by the %EMPTY% macro or this line isn't empty
+			//If content was printed earlier in the line and flushed to the Notes panel, allow the coordinates to reset to the next line
 			if(!eof_notes_panel_logged)
 				eof_log("\t\t\tPrinting line", 3);
-			textout_ex(panel->window->screen, font, buffer2, panel->xpos, panel->ypos, panel->color, panel->bgcolor);	//Print this line to the screen
+			textout_ex(panel->window->screen, font, output, panel->xpos, panel->ypos, panel->color, panel->bgcolor);	//Print this line to the screen
+			panel->allowempty = 0;	//Reset this condition, it has to be enabled per-line
+			panel->xpos = 2;			//Reset the x coordinate to the beginning of the line
 			panel->ypos +=12;
+			panel->contentprinted = 0;
 			if(!eof_notes_panel_logged)
 				eof_log("\t\t\tLine printed", 3);
 		}
+		if(panel->endpanel)
+		{	//If the printing of this panel was signaled to end
+			break;	//Break from for loop
+		}
 	}
 
 	//Draw a border around the edge of the notes panel
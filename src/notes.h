@@ -5,6 +5,17 @@
 #include "main.h"
 #include "song.h"
 
+extern int eof_text_panel_mouse_wanted;	//Set to nonzero when a text panel expands a macro that displays the mouse coordinates, so eof_update_render_damage() knows that moving the mouse changes the panel's contents
+
+#define EOF_NOTES_MACRO_CACHE_SIZE 256
+
+typedef struct
+{
+	char *text;				//The line's content, pointing into the panel's text buffer
+	unsigned long length;	//The number of characters in the line
+	char hasmacro;			//Nonzero if the line contains any percent signs and has to be run through eof_expand_notes_window_text()
+} EOF_TEXT_PANEL_LINE;
+
 //This structure is passed to eof_expand_notes_window_macro() so that it can alter Notes panel settings when relevant macros are read
 typedef struct
 {
@@ -13,6 +24,10 @@ typedef struct
 	char *text;				//The pointer to the memory buffer containing the above text file
 	EOF_WINDOW *window;		//The window to which the panel will render
 
+	//Compiled template
+	EOF_TEXT_PANEL_LINE *line;	//The printable lines of the text file, split once by eof_compile_text_panel() so that the file isn't re-scanned every frame
+	unsigned long linecount;	//The number of entries in line[]
+
 	//Print controls
 	int xpos, ypos;	//The current output coordinates of text being printed to the Notes panel
 	int color;		//The text color in use
@@ -29,11 +44,27 @@ typedef struct
 
 } EOF_TEXT_PANEL;
 
+typedef struct
+{
+	char *macro;		//The macro's name, or NULL if this slot is unused
+	char *expansion;	//The text the macro last expanded to, if it is a statistic macro
+	int status;			//The value eof_expand_notes_window_macro() returned when the macro was last expanded
+	char statistic;		//Nonzero if the macro's expansion only depends on the chart's content and the active track difficulty, so it can be cached
+	char valid;			//Nonzero if expansion and status reflect the current chart
+} EOF_NOTES_MACRO_CACHE_ENTRY;
+
 EOF_TEXT_PANEL *eof_create_text_panel(char *filename, int builtin);
 	//Creates a text panel and buffers the specified filename into its text variable
 	//If builtin is nonzero, the function will attempt to recover the specified file from eof.dat if it is missing from the CWD (which is expected to be EOF's program folder)
+int eof_compile_text_panel(EOF_TEXT_PANEL *panel);
+	//Splits panel->text into the panel->line[] array, dropping comment lines and empty lines since they never print anything
+	//Lines are split at carriage return + line feed pairs, which are replaced with NULL terminators in panel->text
+	//A line too long to fit into the text panel's expansion buffer ends the template, the same as it ended the panel's rendering before
+	//Returns zero on error
 void eof_destroy_text_panel(EOF_TEXT_PANEL *panel);
-	//Frees panel->text and frees panel
+	//Frees panel->text, panel->line and panel
+void eof_destroy_notes_macro_cache(void);
+	//Frees all entries of the cache used by eof_expand_notes_window_macro() for statistic macros
 int eof_expand_notes_window_text(char *src_buffer, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel);
 	//Parses the content of the source buffer, expanding macros with eof_expand_notes_window_macro() and populating the destination buffer of the given size
 	//The destination buffer is guaranteed to be NULL terminated
@@ -42,6 +73,11 @@ int eof_expand_notes_window_text(char *src_buffer, char *dest_buffer, unsigned l
 	//Returns zero on error, and writes any failed macro text conversion
 	//Returns 1 on a normal conversion
 int eof_expand_notes_window_macro(char *macro, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel);
+	//Looks the macro up in a hash table, and if it is a statistic macro (ie. a note count that scans the entire track difficulty) whose expansion
+	// was cached since the last chart edit, track difficulty change or tech view change, the cached expansion and return value are used
+	//Otherwise calls eof_expand_notes_window_macro_uncached() and caches the result if it is a statistic macro
+	//Mouse button activity invalidates the cache every frame, since note drags change the chart without creating undo states
+int eof_expand_notes_window_macro_uncached(char *macro, char *dest_buffer, unsigned long dest_buffer_size, EOF_TEXT_PANEL *panel);
 	//Matches the macro against supported macro strings
 	//If a match is found, the corresponding text is generated and written to the destination buffer
 	//The controls structure is altered appropriately when relevant control macros are parsed
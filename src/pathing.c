@@ -12,17 +12,13 @@
 #include "dialog/proc.h"
 #include <math.h>
 
-#ifndef ALLEGRO_WINDOWS
-//Mac/Linux builds will use fork()
-#include  <sys/types.h>
-#endif
-
 #ifdef USEMEMWATCH
 #include "memwatch.h"
 #endif
 
 EOF_SP_PATH_SOLUTION *eof_ch_sp_solution = NULL;	//This is used to store SP pathing and scoring information pertaining to Clone Hero
 int eof_ch_sp_solution_wanted = 0;			//This is used to signal to eof_ch_sp_solution_rebuild() that the global solution structure should be built
+static int eof_ch_sp_path_threads_running = 0;	//Set to nonzero while worker threads are evaluating solutions, during which the (non thread safe) logging functions must not be called from the evaluation logic
 
 int eof_note_is_last_longest_gem(EOF_SONG *sp, unsigned long track, unsigned long note)
 {
@@ -328,17 +324,16 @@ int eof_evaluate_ch_sp_path_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUM
 	EOF_SP_PATH_SCORING_STATE score;		//Tracks current scoring information that will be copied to the score cache after each star power deployment ends
 	unsigned long cache_number = ULONG_MAX;	//The cached deploy scoring structure selected to resume from in evaluating this solution
 	unsigned long deployment_num;			//The instance number of the next star power deployment
-
-	//Last caching variables (stores score caching at one note earlier than the last evaluated solution's last SP deployment)
-	static EOF_SP_PATH_SCORING_STATE last_cache ;	//Stores scoring data for the note prior to the deployment, to be able to skip the most calculations for sequential solutions being tested (ie. deploy at note 1 and 50, note 1 and 51, note 1 and 52, etc).
-	static unsigned long last_cache_deployment_num = 0;	//The next deployment number in effect as of when the last cache data was stored
 	int using_last_cache = 0;
 	int extra_stats = 0;	//Set to nonzero if the passed solution structure is the global solution structure, which will add storage of other stats like deployment end positions, star power meter level at each note
 
 	if(!solution || !solution_num || !solution->deployments || !solution->note_measure_positions || !solution->note_beat_lengths || !eof_song || !solution->track || (solution->track >= eof_song->tracks) || (solution->num_deployments > solution->deploy_count))
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t*Invalid parameters.  Solution invalid.");
-		eof_log_casual(eof_log_string, 1, 1, 1);
+		if(!eof_ch_sp_path_threads_running)
+		{	//Logging is not thread safe
+			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t*Invalid parameters.  Solution invalid.");
+			eof_log_casual(eof_log_string, 1, 1, 1);
+		}
 		return 1;	//Invalid parameters
 	}
 
@@ -349,18 +344,18 @@ int eof_evaluate_ch_sp_path_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUM
 		extra_stats = 1;
 
 	///Look up cached scoring to skip as much calculation as possible
-	if((solution_num->value > 1) && sequential && (last_cache.note_start < solution->note_count))
+	if((solution_num->value > 1) && sequential && (solution->last_cache.note_start < solution->note_count))
 	{	//Use last cache if the calling function called for its use and the cache data is valid
 		using_last_cache = 1;
-		memcpy(&score, &last_cache, sizeof(EOF_SP_PATH_SCORING_STATE));	//Copy the last cache into the scoring state structure
+		memcpy(&score, &solution->last_cache, sizeof(EOF_SP_PATH_SCORING_STATE));	//Copy the last cache into the scoring state structure
 
 		notectr = score.note_end_native;	//Resume parsing from the first note after that cached data
 		index = score.note_end;
-		deployment_num = last_cache_deployment_num;	//The next deployment will be whichever one was next at this point in the previous solution's evaluation
+		deployment_num = solution->last_cache_deployment_num;	//The next deployment will be whichever one was next at this point in the previous solution's evaluation
 	}
 	else
 	{	//Otherwise use normal caching if possible
-		last_cache.note_start = ULONG_MAX;	//Invalidate the last cache structure every time the first solution is being tested or a non sequential solution is tested
+		solution->last_cache.note_start = ULONG_MAX;	//Invalidate the last cache structure every time the first solution is being tested or a non sequential solution is tested
 
 		for(ctr = 0; ctr < solution->num_deployments; ctr++)
 		{	//For each star power deployment in this solution
@@ -689,8 +684,11 @@ int eof_evaluate_ch_sp_path_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUM
 				//Update the star power meter
 				if((beat >= eof_song->beats) || !eof_song->beat[beat]->has_ts)
 				{	//If the beat containing this 1/25 beat interval couldn't be identified, or if the beat has no time signature in effect
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t*Logic error.  Solution invalid.");
-					eof_log_casual(eof_log_string, 1, !logging, 1);
+					if(!eof_ch_sp_path_threads_running)
+					{	//Logging is not thread safe
+						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t*Logic error.  Solution invalid.");
+						eof_log_casual(eof_log_string, 1, !logging, 1);
+					}
 					return 5;	//General logic error
 				}
 				sp_drain = 1.0 / 8.0 / eof_song->beat[beat]->num_beats_in_measure / 25.0;	//Star power drains at a rate of 1/8 per measure of beats, and this is the amount of drain for a 1/25 beat interval
@@ -889,14 +887,14 @@ int eof_evaluate_ch_sp_path_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUM
 		///Store scoring data into the last cache structure if applicable
 		if(index + 1 == solution->deployments[solution->num_deployments - 1])
 		{	//If the last deployment for the solution is the next note
-			memcpy(&last_cache, &score, sizeof(EOF_SP_PATH_SCORING_STATE));	//Store the scoring data to last cache
-			last_cache.note_start = 0;					//This cache data will reflect scoring for all notes from the first one
-			last_cache.note_end = index;				//Through all notes up to the one jus scored
-			last_cache.note_end_native = notectr;
-			last_cache_deployment_num = deployment_num;	//Store this value
+			memcpy(&solution->last_cache, &score, sizeof(EOF_SP_PATH_SCORING_STATE));	//Store the scoring data to last cache
+			solution->last_cache.note_start = 0;					//This cache data will reflect scoring for all notes from the first one
+			solution->last_cache.note_end = index;				//Through all notes up to the one jus scored
+			solution->last_cache.note_end_native = notectr;
+			solution->last_cache_deployment_num = deployment_num;	//Store this value
 			if(logging > 1)
 			{	//Verbose log the caching
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSaving last cache data (note index #%lu, mult = x%lu, hitctr = %lu, score = %lu, SP meter = %.2f%%)", last_cache.note_end, score.multiplier, score.hitcounter, score.score, score.sp_meter * 100.0);
+				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSaving last cache data (note index #%lu, mult = x%lu, hitctr = %lu, score = %lu, SP meter = %.2f%%)", solution->last_cache.note_end, score.multiplier, score.hitcounter, score.score, score.sp_meter * 100.0);
 				eof_log_casual(eof_log_string, 1, 1, 1);
 			}
 		}
@@ -922,41 +920,53 @@ int eof_evaluate_ch_sp_path_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUM
 	return 0;	//Return solution evaluated
 }
 
-int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long last_deploy, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, unsigned long *deployment_notes, char *kill_file)
+int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long last_deploy, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, EOF_BIG_NUMBER *prunedcount, unsigned long *deployment_notes, volatile int *cancel)
 {
 	char windowtitle[101] = {0};
 	int invalid_increment = 0;	//Set to nonzero if the last iteration of the loop manually incremented the solution due to the solution being invalid
+	int prune = 0;				//Set to nonzero if the last tested solution was found to be unable to lead to a better solution by adding more deployments
 	int retval;
 	int sequential;	//Controls the use of the last cache mechanism in eof_evaluate_ch_sp_path_solution()
+	int logging = 0;	//Set to nonzero if verbose logging is to be performed for each solution
 	EOF_BIG_NUMBER solution_count = {0, 0};
-	clock_t time1, time2;
 
-	eof_log("eof_ch_sp_path_single_process_solve() entered", 1);
+	if(!cancel)
+	{	//Logging is not thread safe, and is only performed when this function isn't being run by a worker thread
+		eof_log("eof_ch_sp_path_single_process_solve() entered", 1);
+		logging = (eof_log_level > 1) ? 1 : 0;
+	}
 
 	if(!eof_song || !best || !testing || !validcount || !invalidcount || !deployment_notes)
 	{
-		eof_log("\tInvalid pointer parameters", 1);
+		if(!cancel)
+			eof_log("\tInvalid pointer parameters", 1);
 		return 1;	//Invalid parameters
 	}
 	if(first_deploy > best->note_count)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tLogic error:  First deployment (%lu) > the number of notes in the target track difficulty (%lu)", first_deploy, best->note_count);
-		eof_log(eof_log_string, 1);
+		if(!cancel)
+		{
+			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tLogic error:  First deployment (%lu) > the number of notes in the target track difficulty (%lu)", first_deploy, best->note_count);
+			eof_log(eof_log_string, 1);
+		}
 		return 1;	//Invalid parameters
 	}
 
 	testing->num_deployments = 0;	//The first solution increment will test one deployment
 	testing->deployments[0] = first_deploy;	//Apply a correct value here for the sake of the title bar reflecting an accurate solution set number
 	*deployment_notes = 0;			//Reset this count so the first solution will be counted as the one with the most notes played during SP deployments
-	time1 = clock();				//Track the start time of this loop
 	while(1)
 	{	//Continue testing until all solutions (or specified solutions) are tested
 		unsigned long next_deploy;
 
 		sequential = 0;	//Unless the solution being tested is identical to the previous solution except that the last deployment is one note later, this will be zero
 		eof_big_number_increment(&solution_count);	//Track number of tested solutions
-		if(solution_count.value % 2000 == 0)
-		{	//Every 2000 solutions
+		if(cancel && *cancel)
+		{	//If this function is being run by a worker thread and the supervisor signaled for the worker threads to stop
+			return 2;	//User cancellation
+		}
+		if(!cancel && (solution_count.value % 2000 == 0))
+		{	//Every 2000 solutions (if this function is being run by a worker thread, the supervisor handles the title bar and user cancellation instead)
 			if(solution_count.overflow_count)
 			{	//If more than 4 billion solutions have been tested
 				unsigned long billion_count, leftover;
@@ -985,20 +995,6 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 			}
 			set_window_title(windowtitle);	//Update the title bar
 
-			if(kill_file)
-			{	//If the calling function wanted this function to check for a kill signal file
-				time2 = clock();
-				if((time2 - time1) / CLOCKS_PER_SEC >= EOF_SP_PATH_KILL_FILE_CHECK_INTERVAL)
-				{	//If it's time to check for this signal
-					if(exists(kill_file))
-					{	//If the file does exist
-						eof_log_casual("\tKill signal detected", 1, 1, 1);
-						eof_log_casual(NULL, 1, 1, 1);
-						return 2;	//User cancellation
-					}
-					time1 = time2;
-				}
-			}
 			if(key[KEY_ESC])
 			{	//Allow user to cancel
 				return 2;	//User cancellation
@@ -1023,7 +1019,14 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 				else
 				{	//Add another deployment to the solution
 					unsigned long previous_deploy = testing->deployments[testing->num_deployments - 1];	//This is the note at which the previous deployment occurs
-					next_deploy = eof_ch_pathing_find_next_deployable_sp(testing, previous_deploy);	//Detect the next note after which another 50% of star power meter has accumulated
+					if(prune)
+					{	//If no solution with more deployments after this one can beat the current best solution
+						next_deploy = ULONG_MAX;	//Skip them all by advancing the last deployment instead
+					}
+					else
+					{
+						next_deploy = eof_ch_pathing_find_next_deployable_sp(testing, previous_deploy);	//Detect the next note after which another 50% of star power meter has accumulated
+					}
 
 					if(next_deploy < testing->note_count)
 					{	//If a valid placement for the next deployment was found
@@ -1051,7 +1054,8 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 							next_deploy = testing->deployments[testing->num_deployments - 1] + 1;	//Advance the now-last deployment one note further
 							if(next_deploy >= testing->note_count)
 							{	//If the previous deployment cannot advance even though the deployment that was just removed had come after it
-								eof_log("\tLogic error:  Can't advance previous deployment after removing last deployment (1)", 1);
+								if(!cancel)
+									eof_log("\tLogic error:  Can't advance previous deployment after removing last deployment (1)", 1);
 								return 1;	//Return error
 							}
 							testing->deployments[testing->num_deployments - 1] = next_deploy;
@@ -1084,7 +1088,8 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 					next_deploy = testing->deployments[testing->num_deployments - 1] + 1;	//Advance the now-last deployment one note further
 					if(next_deploy >= testing->note_count)
 					{	//If the previous deployment cannot advance even though the deployment that was just removed had come after it
-						eof_log("\tLogic error:  Can't advance previous deployment after removing last deployment (2)", 1);
+						if(!cancel)
+							eof_log("\tLogic error:  Can't advance previous deployment after removing last deployment (2)", 1);
 						return 1;	//Return error
 					}
 					testing->deployments[testing->num_deployments - 1]= next_deploy;
@@ -1097,19 +1102,22 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 			}
 			else
 			{	//If num_deployments > max_deployments
-				eof_log("\tLogic error:  More than the maximum number of deployments entered the testing solution", 1);
+				if(!cancel)
+					eof_log("\tLogic error:  More than the maximum number of deployments entered the testing solution", 1);
 				return 1;	//Return error
 			}
 		}//Don't increment the solution if the last iteration already did so
 		invalid_increment = 0;
+		prune = 0;
 
 		//Test and compare with the current best solution
-		retval = eof_evaluate_ch_sp_path_solution(testing, &solution_count, (eof_log_level > 1 ? 1 : 0), sequential);	//Evaluate the solution (only perform light evaluation logging if verbose logging or higher is enabled)
+		retval = eof_evaluate_ch_sp_path_solution(testing, &solution_count, logging, sequential);	//Evaluate the solution (only perform light evaluation logging if verbose logging or higher is enabled)
 		if(!retval)
 		{	//If the solution was considered valid
 			if((testing->score > best->score) || ((testing->score == best->score) && (testing->deployment_notes < best->deployment_notes)))
 			{	//If this newly tested solution achieved a higher score than the current best, or if it matched the highest score but did so with fewer notes played during star power deployment
-				eof_log_casual("\t!New best solution", 2, 0, 0);
+				if(logging)
+					eof_log_casual("\t!New best solution", 2, 0, 0);
 
 				best->score = testing->score;	//It is the new best solution, copy its data into the best solution structure
 				best->deployment_notes = testing->deployment_notes;
@@ -1125,6 +1133,28 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 				memcpy(best->deployments, testing->deployments, sizeof(unsigned long) * testing->deploy_count);
 			}
 
+			if(prunedcount && testing->num_deployments && (testing->num_deployments < testing->deploy_count))
+			{	//If the calling function allows pruning, and more deployments could be added to this solution
+				EOF_SP_PATH_SCORING_STATE *last = &testing->deploy_cache[testing->num_deployments - 1];
+				unsigned long upper_bound = testing->score;	//The highest score any solution beginning with this solution's deployments could achieve
+
+				if(last->note_start == testing->deployments[testing->num_deployments - 1])
+				{	//If the cache shows this solution's last deployment ended before the end of the track difficulty
+					//Further deployments can only begin after that, and at best would double the score of every remaining note
+					upper_bound += testing->score - last->score;
+				}
+				if(upper_bound < best->score)
+				{	//If even that can't beat the current best solution
+					if(logging)
+					{	//Skip the overhead of building the logging string if it won't be logged
+						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t!Pruning solutions adding deployments after note index #%lu (upper bound %lu)", testing->deployments[testing->num_deployments - 1], upper_bound);
+						eof_log_casual(eof_log_string, 2, 0, 0);
+					}
+					prune = 1;
+					eof_big_number_increment(prunedcount);	//Track the number of solution subsets that were skipped
+				}
+			}
+
 			eof_big_number_increment(validcount);	//Track the number of valid solutions tested
 		}
 		else
@@ -1138,7 +1168,7 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 					next_deploy = testing->deployments[testing->num_deployments - 1] + 1;	//Get the note index one after the last tested deployment
 					if(next_deploy < testing->note_count)
 					{	//If the next deployment can be advanced to that note
-						if(eof_log_level > 1)
+						if(logging)
 						{	//Skip the overhead of building the logging string if it won't be logged
 							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t!Discarding solutions where deployment #%lu is at note index #%lu", testing->num_deployments, testing->deployments[testing->num_deployments - 1]);
 							eof_log_casual(eof_log_string, 2, 0, 0);
@@ -1156,7 +1186,7 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 					if((note_end < testing->note_count) && (note_end > testing->deployments[testing->num_deployments - 1]))
 					{	//If the next deployment can be advanced to that note
 						next_deploy = note_end;	//Do so
-						if(eof_log_level > 1)
+						if(logging)
 						{	//Skip the overhead of building the logging string if it won't be logged
 							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t!Skipping deployment #%lu to next note index #%lu", testing->num_deployments, next_deploy);
 							eof_log_casual(eof_log_string, 2, 0, 0);
@@ -1175,7 +1205,7 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 				if(next_sp_note < testing->note_count)
 				{	//If such a note exists
 					next_deploy = next_sp_note;	//Do so
-					if(eof_log_level > 1)
+					if(logging)
 					{	//Skip the overhead of building the logging string if it won't be logged
 						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t!Skipping deployment #%lu to next SP note (index #%lu)", testing->num_deployments, next_deploy);
 						eof_log_casual(eof_log_string, 2, 0, 0);
@@ -1184,7 +1214,7 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 				else
 				{	//No such star power note exists, all of the parent deployment's remaining solutions will also fail for the same reason
 					//Remove the last deployment and increment the new-last deployment
-					if(eof_log_level > 1)
+					if(logging)
 					{	//Skip the overhead of building the logging string if it won't be logged
 						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t!There are no more SP notes.  Remaining solutions for deployment #%lu are invalid.", testing->num_deployments);
 						eof_log_casual(eof_log_string, 2, 0, 0);
@@ -1202,13 +1232,14 @@ int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_
 
 			eof_big_number_increment(invalidcount);	//Track the number of invalid solutions tested
 		}//If the solution was invalid
-		if(eof_log_level > 1)
+		if(logging)
 		{	//If there was verbose logging made for this solution
 			eof_log_casual("", 2, 0, 1);	//End the line of logging for this solution
 		}
 	}//Continue testing until all solutions (or specified solutions) are tested
 
-	eof_log_casual(NULL, 2, 1, 1);	//Flush the buffered log writes to disk
+	if(!cancel)
+		eof_log_casual(NULL, 2, 1, 1);	//Flush the buffered log writes to disk
 	return 0;	//Return success
 }
 
@@ -1275,7 +1306,7 @@ int eof_ch_sp_path_setup(EOF_SP_PATH_SOLUTION **bestptr, EOF_SP_PATH_SOLUTION **
 		eof_process_beat_statistics(eof_song, eof_selected_track);
 	if(!eof_song->beat[0]->has_ts)
 	{
-		allegro_message("A time signature is required for the chart, but none in effect on the first beat.  4/4 will be applied.");
+		eof_message("A time signature is required for the chart, but none in effect on the first beat.  4/4 will be applied.");
 
 		eof_prepare_undo(EOF_UNDO_TYPE_NONE);
 		if(undo_made)
@@ -1349,6 +1380,8 @@ int eof_ch_sp_path_setup(EOF_SP_PATH_SOLUTION **bestptr, EOF_SP_PATH_SOLUTION **
 		best->diff = eof_note_type;
 		best->solution_number.overflow_count = best->solution_number.value = 0;
 		best->resulting_sp_meter = bresulting_sp_meter;
+		best->last_cache.note_start = ULONG_MAX;
+		best->last_cache_deployment_num = 0;
 	}
 
 	testing->note_measure_positions = note_measure_positions;
@@ -1358,6 +1391,8 @@ int eof_ch_sp_path_setup(EOF_SP_PATH_SOLUTION **bestptr, EOF_SP_PATH_SOLUTION **
 	testing->diff = eof_note_type;
 	testing->solution_number.overflow_count = testing->solution_number.value = 0;
 	testing->resulting_sp_meter = tresulting_sp_meter;
+	testing->last_cache.note_start = ULONG_MAX;
+	testing->last_cache_deployment_num = 0;
 
 	///Apply EOF_NOTE_TFLAG_SOLO_NOTE and EOF_NOTE_TFLAG_SP_END tflags appropriately to notes in the target track difficulty
 	eof_ch_pathing_mark_tflags(testing);
@@ -1608,7 +1643,7 @@ void eof_ch_sp_path_report_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUMB
 	if(solution->deployment_notes == 0)
 	{	//If there was no best use of star power
 		eof_log("\tNo notes were playable during a star power deployment", 1);
-		allegro_message("No notes were playable during a star power deployment");
+		eof_message("No notes were playable during a star power deployment");
 	}
 	else
 	{	//There is at least one note played during star power deployment
@@ -1632,7 +1667,7 @@ void eof_ch_sp_path_report_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUMB
 			if(notenum >= tracksize)
 			{	//If the note was not identified
 				eof_log("\tLogic error displaying solution.", 1);
-				allegro_message("Logic error displaying solution.");
+				eof_message("Logic error displaying solution.");
 				break;
 			}
 
@@ -1691,7 +1726,7 @@ void eof_ch_sp_path_report_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUMB
 
 		(void) eof_detect_difficulties(eof_song, eof_selected_track);	//Update highlighting variables
 		eof_render();
-		allegro_message("%s\n%s\n\n%s\n%s\n%s\n%s\n%s\n\n%s", resultstring1, timestamps, scorestring, sololess_scorestring, base_score_string, multiplierstring, score_disclaimer, deployment_notes_string);
+		eof_message("%s\n%s\n\n%s\n%s\n%s\n%s\n%s\n\n%s", resultstring1, timestamps, scorestring, sololess_scorestring, base_score_string, multiplierstring, score_disclaimer, deployment_notes_string);
 
 		///Offer to apply SP deploy status to a detected best solution's notes, if no notes in the active track difficulty already have that status
 		if(solution_count.overflow_count + solution_count.value > 1)
@@ -1712,7 +1747,7 @@ void eof_ch_sp_path_report_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUMB
 
 			if(!sp_deploy_notes_exist)
 			{	//If no notes were found to have EOF_NOTE_EFLAG_SP_DEPLOY status already
-				if(alert(NULL, "Apply SP deploy status to the best solution's notes and remove their highlighting?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+				if(eof_alert(NULL, "Apply SP deploy status to the best solution's notes and remove their highlighting?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 				{	//If the user opts to replace the highlighting status with SP deploy status
 					for(ctr = 0; ctr < solution->num_deployments; ctr++)
 					{	//For each deployment in the best solution
@@ -1739,12 +1774,12 @@ DIALOG eof_menu_track_find_ch_sp_path_dialog[] =
 {
 	/* (proc)                (x)  (y)  (w)  (h)  (fg) (bg) (key) (flags) (d1) (d2) (dp)                         (dp2) (dp3) */
 	{ d_agup_window_proc,    0,   0,   360, 186, 0,   0,   0,    0,      0,   0,   "Find optimal CH star power path", NULL, NULL },
-	{ d_agup_text_proc,      12,  40,  60,  12,  0,   0,   0,    0,      0,   0,   "Use this many worker processes:",NULL, NULL },
+	{ d_agup_text_proc,      12,  40,  60,  12,  0,   0,   0,    0,      0,   0,   "Use this many worker threads:",NULL, NULL },
 	{ eof_verified_edit_proc,12,  56,  90,  20,  0,   0,   0,    0,      2,   0,   eof_menu_track_find_ch_sp_path_dialog_string, "0123456789", NULL },
 	{ d_agup_text_proc,      12,  80,  60,  12,  0,   0,   0,    0,      0,   0,   "More (up to the number of threads your CPU supports)",NULL, NULL },
 	{ d_agup_text_proc,      12,  96,  60,  12,  0,   0,   0,    0,      0,   0,   "is faster, but will slow your computer down more.",NULL, NULL },
 	{ d_agup_text_proc,      12,  112, 60,  12,  0,   0,   0,    0,      0,   0,   "",NULL, NULL },
-	{ d_agup_check_proc,     50,  118, 210, 16,  0,   0,   0,    0,      1,   0,   "Enable worker process logging", NULL, NULL },
+	{ d_agup_check_proc,     12,  118, 330, 16,  0,   0,   0,    D_SELECTED, 1, 0, "Skip solutions that can't beat the best found", NULL, NULL },
 	{ d_agup_button_proc,    12,  144, 84,  28,  2,   23,  '\r', D_EXIT, 0,   0,   "OK",                        NULL, NULL },
 	{ d_agup_button_proc,    110, 144, 78,  28,  2,   23,  0,    D_EXIT, 0,   0,   "Cancel",                    NULL, NULL },
 	{ NULL,                  0,   0,   0,   0,   0,   0,   0,    0,      0,   0,   NULL,                        NULL, NULL }
@@ -1755,14 +1790,14 @@ int eof_menu_track_find_ch_sp_path(void)
 	EOF_SP_PATH_SOLUTION *best = NULL, *testing = NULL;
 	unsigned long worst_score = 0;				//The estimated maximum score when no star power is deployed
 	unsigned long first_deploy = ULONG_MAX;		//The first note that occurs after the end of the second star power phrase, and is thus the first note at which star power can be deployed
-	int worker_logging;
 	unsigned long ctr, tracksize;
-	EOF_BIG_NUMBER validcount = {0, 0}, invalidcount = {0, 0}, solution_count = {0, 0};
+	EOF_BIG_NUMBER validcount = {0, 0}, invalidcount = {0, 0}, solution_count = {0, 0}, prunedcount = {0, 0};
+	EOF_BIG_NUMBER *prunedptr = NULL;	//Set to the address of prunedcount if solutions that can't beat the best solution are to be skipped
 	int error = 0;
 	char undo_made = 0;
 	clock_t starttime = 0, endtime = 0;
 	double elapsed_time = 1.0;			//Don't init to 0 to avoid a division by 0 if an error occurs during processing
-	long process_count;
+	long thread_count;
 	unsigned long deployment_notes = 0;	//Tracks the highest count of notes that were found to be playable during all star power deployments of any solution
 
  	eof_log("eof_menu_track_find_ch_sp_path() entered", 1);
@@ -1770,35 +1805,24 @@ int eof_menu_track_find_ch_sp_path(void)
  	if(!eof_song)
 		return 1;	//No project loaded
 
-///Prompt user how many processes to use to evaluate solutions
+///Prompt user how many threads to use to evaluate solutions
 	eof_color_dialog(eof_menu_track_find_ch_sp_path_dialog, gui_fg_color, gui_bg_color);
 	centre_dialog(eof_menu_track_find_ch_sp_path_dialog);
 	if(eof_popup_dialog(eof_menu_track_find_ch_sp_path_dialog, 2) != 7)
 	{	//If the user did not click OK
 		return 1;
 	}
-	process_count = atol(eof_menu_track_find_ch_sp_path_dialog_string);
-	if(process_count < 1)
+	thread_count = atol(eof_menu_track_find_ch_sp_path_dialog_string);
+	if(thread_count < 1)
 	{
-		allegro_message("Must specify at number of processes that is 1 or higher.");
+		eof_message("Must specify at number of threads that is 1 or higher.");
 		return 1;
 	}
-	worker_logging = (eof_menu_track_find_ch_sp_path_dialog[6].flags & D_SELECTED) ? 1 : 0;
-	if(process_count > 1)
-	{	//If the user specified multiple processes
-		if(!eof_song->tags->revision)
-		{	//If project hasn't been saved even once
-			allegro_message("You must save the project after importing a chart in order to use this function with multiple processes.");
-			return 1;
-		}
-		if(eof_changes)
-		{	//If there are unsaved changes in the project
-			allegro_message("You must save changes to the project before using this function with multiple processes.");
-			return 1;
-		}
+	if(eof_menu_track_find_ch_sp_path_dialog[6].flags & D_SELECTED)
+	{	//If the user opted to skip solutions that can't beat the best solution (clearing this tests every solution by brute force)
+		prunedptr = &prunedcount;
 	}
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tEvaluating CH path solution for \"%s\" difficulty %u", eof_song->track[eof_selected_track]->name, eof_note_type);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tEvaluating CH path solution for \"%s\" difficulty %u", eof_song->track[eof_selected_track]->name, eof_note_type);
 	if(eof_ch_sp_path_setup(&best, &testing, &undo_made))
 	{	//If the function that performs setup for the pathing logic failed
 		return 1;
@@ -1810,7 +1834,7 @@ int eof_menu_track_find_ch_sp_path(void)
 	if(eof_evaluate_ch_sp_path_solution(best, &solution_count, 2, 0))
 	{	//Populate the "best" solution with the worst scoring solution, so any better solution will replace it, verbose log the evaluation
 		eof_log("\tError scoring no star power usage", 1);
-		allegro_message("Error scoring no star power usage");
+		eof_message("Error scoring no star power usage");
 		error = 1;	//The testing of all other solutions will be skipped
 	}
 	else
@@ -1841,13 +1865,13 @@ int eof_menu_track_find_ch_sp_path(void)
 	if(!error)
 	{	//If the no deployments score and first available star power deployment were successfully determined
 		starttime = clock();	//Track the start time
-		if(process_count == 1)
-		{	//Perform a single process evaluation of all solutions
-			error = eof_ch_sp_path_single_process_solve(best, testing, first_deploy, ULONG_MAX, &validcount, &invalidcount, &deployment_notes, NULL);
+		if(thread_count == 1)
+		{	//Perform a single threaded evaluation of all solutions
+			error = eof_ch_sp_path_single_process_solve(best, testing, first_deploy, ULONG_MAX, &validcount, &invalidcount, prunedptr, &deployment_notes, NULL);
 		}
 		else
-		{	//Perform a multi process evaluation of all solutions
-			error = eof_ch_sp_path_supervisor_process_solve(best, testing, first_deploy, process_count, &validcount, &invalidcount, &deployment_notes, worker_logging);
+		{	//Perform a multi threaded evaluation of all solutions
+			error = eof_ch_sp_path_threaded_solve(best, testing, first_deploy, thread_count, &validcount, &invalidcount, prunedptr, &deployment_notes);
 		}
 		endtime = clock();	//Track the end time
 		elapsed_time = (double)(endtime - starttime) / (double)CLOCKS_PER_SEC;	//Convert to seconds
@@ -1864,12 +1888,12 @@ int eof_menu_track_find_ch_sp_path(void)
 		if(!testing->deploy_count)
 		{
 			eof_log("\tThere are not enough star power phrases/sustains to deploy even once.", 1);
-			allegro_message("There are not enough star power phrases/sustains to deploy even once.");
+			eof_message("There are not enough star power phrases/sustains to deploy even once.");
 		}
 		else
 		{
 			eof_log("\tFailed to detect optimum star power path.", 1);
-			allegro_message("Failed to detect optimum star power path.");
+			eof_message("Failed to detect optimum star power path.");
 		}
 	}
 	else if(error == 2)
@@ -1896,7 +1920,7 @@ int eof_menu_track_find_ch_sp_path(void)
 		}
 		eof_log("\tUser cancellation.", 1);
 		eof_log(eof_log_string, 1);
-		allegro_message("User cancellation.%s", eof_log_string);
+		eof_message("User cancellation.%s", eof_log_string);
 	}
 	else
 	{
@@ -1911,8 +1935,8 @@ int eof_menu_track_find_ch_sp_path(void)
 				testing->deploy_cache[ctr].note_start = ULONG_MAX;	//Invalidate the entry
 			}
 			eof_log_casual("Best solution:", 1, 1, 1);
-			if(process_count > 1)
-			{	//If multiple worker processes were used to find the best solution
+			if(thread_count > 1)
+			{	//If multiple worker threads were used to find the best solution
 				best->solution_number.value = ULONG_MAX;	//Don't log a solution number since it has no meaning in this context
 			}
 			(void) eof_evaluate_ch_sp_path_solution(testing, &best->solution_number, 2, 0);
@@ -1922,7 +1946,7 @@ int eof_menu_track_find_ch_sp_path(void)
 		if((best->deployment_notes == 0) && (best->score > worst_score))
 		{	//If the best score did not reflect notes being played in star power, but the score somehow was better than the score from when no star power deployment was tested
 			eof_log("\tLogic error calculating solution.", 1);
-			allegro_message("Logic error calculating solution.");
+			eof_message("Logic error calculating solution.");
 		}
 		else
 		{	//The score was determined
@@ -1941,6 +1965,11 @@ int eof_menu_track_find_ch_sp_path(void)
 				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t%lu solutions tested (%lu valid, %lu invalid) in %.2f seconds (%.2f solutions per second)", solution_count.value, validcount.value, invalidcount.value, elapsed_time, ((double)solution_count.value)/elapsed_time);
 			}
 			eof_log(eof_log_string, 1);
+			if(prunedptr)
+			{	//If solutions that couldn't beat the best solution were skipped
+				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t%luB + %lu sets of solutions were skipped because they could not beat the best solution found so far", prunedcount.overflow_count * 4, prunedcount.value);
+				eof_log(eof_log_string, 1);
+			}
 
 			eof_ch_sp_path_report_solution(best, &validcount, &invalidcount, deployment_notes, &undo_made);
 		}
@@ -1967,1095 +1996,139 @@ int eof_menu_track_find_ch_sp_path(void)
 	return 1;
 }
 
-void eof_ch_sp_path_worker(char *job_file)
+static int eof_ch_sp_path_work(void *context, void *worker, unsigned long first_item, unsigned long end_item, volatile int *cancel)
 {
-	PACKFILE *inf, *outf;
-	char filename[1024];
-	char jobreadyfilename[1024];
-	char jobkillfilename[1024];
-	char project_path[1024] = {0};
-	int error = 0, canceled = 0, done = 0, idle = 0, retval, firstjob = 1;
-	EOF_SP_PATH_SOLUTION best = {0}, testing = {0};
-	unsigned long ctr, first_deploy = ULONG_MAX, last_deploy = ULONG_MAX, deployment_notes = 0;
-	EOF_BIG_NUMBER validcount = {0, 0}, invalidcount = {0, 0};
-
-	//Validate initial job file path
-	eof_log_cwd();
-	if(!job_file || !exists(job_file))
-	{	//Invalid parameter
-		error = 1;
-		if(ch_sp_path_worker_logging)
-		{
-			eof_log("\tCan't find job", 1);
-		}
-		else
-		{
-			(void) snprintf(filename, sizeof(filename) - 1, "%scantfindjob", eof_temp_path_s);
-			outf = pack_fopen(filename, "w");	//Create that file
-			(void) pack_fclose(outf);
-		}
-
-		return;
-	}
-	(void) replace_extension(jobreadyfilename, job_file, "jobready", 1024);		//Create the path to the file indicating the job file is ready to read
-	(void) replace_extension(jobkillfilename, job_file, "kill", 1024);			//Create the path to the kill signal file
-
-	//Worker main loop
-	while(EOF_PERSISTENT_WORKER && !done && !error && !canceled)
-	{	//If the worker process is to run until signaled to end by the supervisor, run until the worker's job is completed
-		if(exists(jobreadyfilename))
-		{	//If the supervisor indicated that a job file is ready to access
-			if(!firstjob)
-			{	//If this isn't the first job, re-initialize variables
-				validcount.overflow_count = validcount.value = invalidcount.overflow_count = invalidcount.value = 0;
-				for(ctr = 0; ctr < best.deploy_count; ctr++)
-				{	//For every entry in the deploy cache
-					best.deploy_cache[ctr].note_start = ULONG_MAX;	//Mark it as invalid
-				}
-			}
+	EOF_SP_PATH_WORKER *wp = (EOF_SP_PATH_WORKER *)worker;
+	int prune;
+	unsigned long deployment_notes = 0;
+	int status;
 
-			//Parse the job file
-			if(ch_sp_path_worker_logging)
-			{
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Loading job file \"%s\"", job_file);
-				eof_log(eof_log_string, 1);
-			}
-			inf = pack_fopen(job_file, "rb");
-			if(!inf)
-			{	//If the job file can't be loaded
-				error = 1;
-				if(ch_sp_path_worker_logging)
-				{
-					eof_log("\tCan't load job", 1);
-				}
-				else
-				{
-					(void) snprintf(filename, sizeof(filename) - 1, "%scantloadjob", eof_temp_path_s);
-					outf = pack_fopen(filename, "w");	//Create that file
-					(void) pack_fclose(outf);
-				}
-				break;
-			}
-
-			if(firstjob)
-			{	//If this is the worker's first job file, read common job data
-				if(eof_load_song_string_pf(project_path, inf, sizeof(project_path)))
-				{	//If the project file path can't be read
-					error = 1;
-					if(ch_sp_path_worker_logging)
-					{
-						eof_log("\tCant read project path", 1);
-					}
-					else
-					{
-						(void) snprintf(filename, sizeof(filename) - 1, "%scantreadprojectpath", eof_temp_path_s);
-						outf = pack_fopen(filename, "w");	//Create that file
-						(void) pack_fclose(outf);
-					}
-					break;
-				}
-
-				eof_song = eof_load_song(project_path);
-				if(!eof_song)
-				{	//If the project file couldn't be loaded
-					error = 1;
-					if(ch_sp_path_worker_logging)
-					{
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCan't load project \"%s\"", project_path);
-						eof_log(eof_log_string, 1);
-					}
-					else
-					{
-						(void) snprintf(filename, sizeof(filename) - 1, "%scantloadproject", eof_temp_path_s);
-						outf = pack_fopen(filename, "w");	//Create that file
-						(void) pack_fclose(outf);
-					}
-					break;
-				}
-
-				//Finish setup after loading project
-				eof_song_loaded = 1;
-				eof_init_after_load(0);
-				eof_fixup_notes(eof_song);
-
-				//Initialize solution array with job file contents
-				best.deploy_count = pack_igetl(inf);
-				testing.deploy_count = best.deploy_count;
-				best.deployments = malloc(sizeof(unsigned long) * best.deploy_count);
-				testing.deployments = malloc(sizeof(unsigned long) * best.deploy_count);
-				best.deploy_cache = malloc(sizeof(EOF_SP_PATH_SCORING_STATE) * best.deploy_count);
-				testing.deploy_cache = best.deploy_cache;
-				best.deployment_endings = malloc(sizeof(double) * best.deploy_count);
-				testing.deployment_endings = best.deployment_endings;
-				if(best.deploy_cache)
-				{	//If the deploy cache array was allocated
-					for(ctr = 0; ctr < best.deploy_count; ctr++)
-					{	//For every entry in the deploy cache
-						best.deploy_cache[ctr].note_start = ULONG_MAX;	//Mark it as invalid
-					}
-				}
-
-				best.note_count = pack_igetl(inf);
-				testing.note_count = best.note_count;
-				best.note_measure_positions = malloc(sizeof(double) * best.note_count);
-				testing.note_measure_positions = best.note_measure_positions;
-				best.resulting_sp_meter = malloc(sizeof(double) * best.note_count);
-				testing.resulting_sp_meter = malloc(sizeof(double) * best.note_count);
-				if(!best.resulting_sp_meter || !testing.resulting_sp_meter)
-				{	//If either star power meter arrays failed to allocate
-					error = 1;
-					break;
-				}
-				else if(best.note_measure_positions)
-				{	//If the measure positions array was allocated
-					for(ctr = 0; ctr < best.note_count; ctr++)
-					{	//For every entry in the measure position array
-						double temp = 0.0;
-
-						if(pack_fread(&temp, (long) sizeof(double), inf) != (long) sizeof(double))
-						{	//If the double floating point value was not read
-							error = 1;
-							if(ch_sp_path_worker_logging)
-							{
-								eof_log("\tCan't read floating point position value", 1);
-							}
-							else
-							{
-								(void) snprintf(filename, sizeof(filename) - 1, "%scantreadfppos", eof_temp_path_s);
-								outf = pack_fopen(filename, "w");	//Create that file
-								(void) pack_fclose(outf);
-							}
-							break;
-						}
-						else
-						{
-							best.note_measure_positions[ctr] = temp;
-						}
-					}
-				}
-				else
-				{
-					error = 1;
-				}
-				if(error)	//If the floating point positions failed to be read
-					break;
-
-				best.note_beat_lengths = malloc(sizeof(double) * best.note_count);
-				testing.note_beat_lengths = best.note_beat_lengths;
-				if(best.note_beat_lengths)
-				{	//If the note lengths array was allocated
-					for(ctr = 0; ctr < best.note_count; ctr++)
-					{	//For every entry in the note lengths array
-						double temp = 0.0;
-
-						if(pack_fread(&temp, (long) sizeof(double), inf) != (long) sizeof(double))
-						{	//If the double floating point value was not read
-							error = 1;
-							if(ch_sp_path_worker_logging)
-							{
-								eof_log("\tCan't read floating point length value", 1);
-							}
-							else
-							{
-								(void) snprintf(filename, sizeof(filename) - 1, "%scantreadfplength", eof_temp_path_s);
-								outf = pack_fopen(filename, "w");	//Create that file
-								(void) pack_fclose(outf);
-							}
-							break;
-						}
-						else
-						{
-							best.note_beat_lengths[ctr] = temp;
-						}
-					}
-				}
-				if(error)	//If the floating point lengths failed to be read
-					break;
-
-				best.track = pack_igetl(inf);
-				testing.track = best.track;
-				best.diff = pack_igetw(inf);
-				testing.diff = best.diff;
-
-				if(!best.deployments || !testing.deployments || !best.deploy_cache || !best.note_measure_positions || !best.note_beat_lengths || !best.deployment_endings)
-				{	//If any of the arrays failed to allocate
-					error = 1;
-					if(ch_sp_path_worker_logging)
-					{
-						eof_log("\tCan't allocate memory", 1);
-					}
-					else
-					{
-						(void) snprintf(filename, sizeof(filename) - 1, "%scantallocate", eof_temp_path_s);
-						outf = pack_fopen(filename, "w");	//Create that file
-						(void) pack_fclose(outf);
-					}
-				}
-			}//If this is the worker's first job file, read common job data
-
-			//Read the unique job data (the first and last numbers of the range of solution sets to test)
-			first_deploy = pack_igetl(inf);
-			last_deploy = pack_igetl(inf);
-			(void) pack_fclose(inf);	//Close the job file
-
-			//Initialize structures
-			best.num_deployments = testing.num_deployments = 0;
-			best.score = testing.score = 0;
-
-			//Signal to the supervisor that the worker process will begin testing solutions
-			(void) replace_extension(filename, job_file, "running", (int) sizeof(filename));	//Build the path to this signal file
-			outf = pack_fopen(filename, "w");	//Create that file
-			(void) pack_fclose(outf);
-			idle = 0;
-		}//If a job file is present, parse it
-		else
-		{	//If no job is present, check for the kill signal from the supervisor
-			(void) replace_extension(filename, job_file, "kill", 1024);		//Create the path to the kill signal file
-			if(exists(filename))
-			{	//If this signal file is present
-				if(ch_sp_path_worker_logging)
-				{
-					eof_log("\tKill signal detected", 1);
-				}
-				done = 1;
-				(void) delete_file(filename);
-			}
-		}
-
-		//Test solutions
-		if(!error && !done && !idle)
-		{	//If an error or kill signal hasn't occurred yet, and the worker is not waiting for a job
-			if(firstjob)
-			{	//If this is the first job being processed, set the target track difficulty and apply temporary flags as appropriate
-				eof_selected_track = best.track;
-				eof_note_type = best.diff;
-				(void) eof_detect_difficulties(eof_song, eof_selected_track);
-				eof_ch_pathing_mark_tflags(&testing);
-			}
-
-			//Test the specified range of solutions
-			if(ch_sp_path_worker_logging)
-			{
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tTesting solution sets #%lu through #%lu", first_deploy, last_deploy);
-				eof_log(eof_log_string, 1);
-			}
-			retval = eof_ch_sp_path_single_process_solve(&best, &testing, first_deploy, last_deploy, &validcount, &invalidcount, &deployment_notes, jobkillfilename);
-			if(retval == 1)
-			{	//If the solution testing failed
-				error = 1;
-				if(ch_sp_path_worker_logging)
-				{
-					eof_log("\tSolving failed", 1);
-				}
-				else
-				{
-					(void) snprintf(filename, sizeof(filename) - 1, "%ssolvefailed", eof_temp_path_s);
-					outf = pack_fopen(filename, "w");	//Create that file
-					(void) pack_fclose(outf);
-				}
-			}
-			else if(retval == 2)
-			{	//If the testing was canceled
-				eof_log("\tUser cancellation", 1);
-				canceled = 1;
-			}
-			firstjob = 0;	//All jobs after the first will re-use common data so subsequent job files can eliminate this redundant information
-		}//If an error or kill signal hasn't occurred yet, and the worker is not waiting for a job
-
-		if(error)
-		{	//If the job was not successfully processed
-			(void) replace_extension(filename, job_file, "fail", 1024);		//Create a results file to specify failure
-			outf = pack_fopen(filename, "w");
-			(void) pack_fclose(outf);	//Close the results file
-			idle = 0;
-		}
-		else if(canceled)
-		{	//If the user canceled the job during solution evaluation
-			(void) replace_extension(filename, job_file, "cancel", 1024);	//Create a results file to specify cancellation
-			outf = pack_fopen(filename, "w");
-			if(outf)
-			{
-				(void) pack_iputl(validcount.overflow_count, outf);
-				(void) pack_iputl(validcount.value, outf);
-				(void) pack_iputl(invalidcount.overflow_count, outf);
-				(void) pack_iputl(invalidcount.value, outf);
-				(void) pack_fclose(outf);	//Close the results file
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCancel status file \"%s\" written", filename);
-				eof_log(eof_log_string, 1);
-				(void) eof_validate_temp_folder();
-			}
-			idle = 0;
-		}
-		else if(done)
-		{	//If the supervisor commanded the worker to stop
-			(void) replace_extension(filename, job_file, "dead", 1024);	//Create a results file to specify the worker will terminate
-			outf = pack_fopen(filename, "w");
-			(void) pack_fclose(outf);	//Close the results file
-			idle = 0;
-		}
-		else if(!idle)
-		{	//Normal completion, write best solution information to disk
-			if(ch_sp_path_worker_logging)
-			{
-				char tempstring[30];
-
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tJob (solution sets #%lu-#%lu) completed.  Best solution:  Deploy at indexes ", first_deploy, last_deploy);
-				for(ctr = 0; ctr < testing.num_deployments; ctr++)
-				{	//For each deployment in the chosen solution
-					(void) snprintf(tempstring, sizeof(tempstring) - 1, "%s%lu", (ctr ? ", " : ""), testing.deployments[ctr]);
-					strncat(eof_log_string, tempstring, sizeof(eof_log_string) - 1);
-				}
-				(void) snprintf(tempstring, sizeof(tempstring) - 1, ".  Score = %lu", testing.score);
-				strncat(eof_log_string, tempstring, sizeof(eof_log_string) - 1);
-				eof_log(eof_log_string, 1);
-				eof_log("Waiting for next job", 1);
-			}
-			(void) replace_extension(filename, job_file, "success", 1024);	//Create a results file to contain the best solution
-			outf = pack_fopen(filename, "w");
-			if(outf)
-			{
-				(void) pack_iputl(best.score, outf);
-				(void) pack_iputl(best.deployment_notes, outf);		//Write the number of notes played during star power in the best solution
-				(void) pack_iputl(deployment_notes, outf);			//Write the highest count of notes that were found to be playable during all of this job's tested solutions
-				(void) pack_iputl(validcount.overflow_count, outf);
-				(void) pack_iputl(validcount.value, outf);
-				(void) pack_iputl(invalidcount.overflow_count, outf);
-				(void) pack_iputl(invalidcount.value, outf);
-				(void) pack_iputl(best.num_deployments, outf);
-				for(ctr = 0; ctr < best.num_deployments; ctr++)
-				{	//For each deployment in the solution
-					(void) pack_iputl(best.deployments[ctr], outf);	//Write it to disk
-				}
-				(void) pack_fclose(outf);				//Close the results file
-			}
-			(void) delete_file(jobreadyfilename);	//Delete the job file readiness signal
-			(void) delete_file(job_file);			//Delete the job file to signal to the supervisor process that the results file is ready to access
-			set_window_title("Worker process idle.  Press Esc to cancel");
-			idle = 1;	//Until another job file or a kill signal is seen, this worker is in idle status
-		}
-
-		if(key[KEY_ESC])
-		{
-			canceled = 1;
-		}
-		if(eof_close_button_clicked)
-		{	//Consider clicking the close window control a cancellation
-			eof_close_button_clicked = 0;
-			canceled = 1;
-		}
-		if(idle)
-		{	//If this worker has nothing to do
-			Idle(10);	//Wait a bit before checking again
-		}
-	}//If the worker process is to run until signaled to end by the supervisor, run until the worker's job is completed
-
-	//Cleanup
-	if(best.deployments)
-		free(best.deployments);
-	if(testing.deployments)
-		free(testing.deployments);
-	if(best.deploy_cache)
-		free(best.deploy_cache);
-	if(best.note_measure_positions)
-		free(best.note_measure_positions);
-	if(best.note_beat_lengths)
-		free(best.note_beat_lengths);
-	if(best.deployment_endings)
-		free(best.deployment_endings);
-	if(best.resulting_sp_meter)
-		free(best.resulting_sp_meter);
-	if(testing.resulting_sp_meter)
-		free(testing.resulting_sp_meter);
+	if(!context || !wp || (first_item >= end_item))
+		return 1;	//Invalid parameters
 
-	if(error)
-	{	//If the job failed, create a copy of the job file to a new name for troubleshooting
-		(void) replace_extension(filename, job_file, "failedjob", (int) sizeof(filename));
-		(void) eof_copy_file(job_file, filename);
-	}
+	prune = *(int *)context;
+	status = eof_ch_sp_path_single_process_solve(&wp->best, &wp->testing, first_item, end_item - 1, &wp->validcount, &wp->invalidcount, (prune ? &wp->prunedcount : NULL), &deployment_notes, cancel);
+	if(deployment_notes > wp->deployment_notes)
+		wp->deployment_notes = deployment_notes;	//Track the highest such count among all of this worker's solution sets
 
-	(void) delete_file(jobreadyfilename);	//Delete the job file readiness signal
-	(void) delete_file(job_file);	//Delete the job file to signal to the supervisor process that the worker is no longer running
+	return status;
 }
 
-int eof_ch_sp_path_supervisor_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long worker_count, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, unsigned long *deployment_notes, int worker_logging)
+int eof_ch_sp_path_threaded_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long worker_count, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, EOF_BIG_NUMBER *prunedcount, unsigned long *deployment_notes)
 {
-	EOF_SP_PATH_WORKER *workers = NULL;
-	PACKFILE *fp;
-	unsigned long ctr, workerctr, solutionctr, num_workers_running, num_workers_launched = 0, num_jobs_completed = 0, idle_ctr = 1500;
-	clock_t start_time, end_time, time1, time2;
-	clock_t waiting_overhead = 0;	//Track how many clocks are spent waiting for worker processes to go from waiting to running state
-	clock_t solutions_exhausted_time = 0;	//Track the time of the first instance where there is an idle worker process and no solutions let to assign
-	char filename[50];	//Stores the job filename for worker processes
-	char jobreadyfilename[50];	//Used to create the jobready file for a worker process
-#ifdef ALLEGRO_WINDOWS
-	char commandline[1050];	//Stores the command line for launching a worker process
-#endif
-	char exepath[1050] = {0};
-	char tempstr[100];
-	int done = 0, error = 0, canceled = 0, workerstatuschange;
-	double elapsed_time;
-	unsigned long trackdiffsize = 0;
-	unsigned long job_deploy_notes;	//Used to store a job file's highest count of notes that were found to be playable during all star power deployments of any of the job's solutions
-
-	if(!best || !testing || !validcount || !invalidcount || !worker_count || !deployment_notes)
+	EOF_SP_PATH_WORKER *workers;
+	EOF_WORK_POOL pool = {0};
+	unsigned long ctr, ctr2;
+	int error = 0, prune;
+
+	if(!eof_song || !best || !testing || !validcount || !invalidcount || !worker_count || !deployment_notes)
 		return 1;	//Invalid parameters
 
-	eof_log("eof_ch_sp_path_supervisor_process_solve() entered", 1);
-	start_time = clock();
+	eof_log("eof_ch_sp_path_threaded_solve() entered", 1);
 
-	//Initialize temp folder and job file path array
-	if(eof_validate_temp_folder())
-	{	//Ensure the correct working directory and presence of the temporary folder
-		eof_log("\tCould not validate working directory and temp folder", 1);
-		return 1;	//Return failure
+	if(first_deploy >= testing->note_count)
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tLogic error:  First deployment (%lu) >= the number of notes in the target track difficulty (%lu)", first_deploy, testing->note_count);
+		eof_log(eof_log_string, 1);
+		return 1;	//Invalid parameters
 	}
+	if(!eof_beat_stats_cached)
+		eof_process_beat_statistics(eof_song, eof_selected_track);	//The worker threads read the beat statistics, but must not rebuild them
+	eof_log_casual(NULL, 1, 1, 1);	//Flush the buffered log writes to disk, logging isn't performed again until the worker threads finish
 
-	//Initialize worker array
+	prune = prunedcount ? 1 : 0;	//The worker threads are to skip solutions that can't beat their best solution if the caller is tracking pruned solutions
+
+	//Initialize worker array, each worker gets its own deployment arrays and deploy cache, but shares the read only note arrays
 	workers = malloc(sizeof(EOF_SP_PATH_WORKER) * worker_count);
 	if(!workers)
-		return 1;	//Couldn't allocate memory
+	{
+		eof_log("\tFailed to allocate memory", 1);
+		return 1;	//Return failure
+	}
 	for(ctr = 0; ctr < worker_count; ctr++)
 	{	//For each worker entry
-		workers[ctr].status = EOF_SP_PATH_WORKER_IDLE;
-		workers[ctr].assignment_size = ((double) testing->note_count - first_deploy) * 0.005 / worker_count;	//Begin by dividing the first 0.5% of solution sets to all workers evenly
-		if(!workers[ctr].assignment_size)
-			workers[ctr].assignment_size = 1;	//Job size is a minimum of 1 solution set
-		workers[ctr].job_count = 1;
-	}
-
-	for(workerctr = 0; workerctr < worker_count; workerctr++)
-	{	//For each worker process
-		//Delete any previously created status, job and results files for this worker process ID
-		(void) snprintf(filename, sizeof(filename) - 1, "%s%lu.job", eof_temp_path_s, workerctr);
-		(void) delete_file(filename);	//Delete #.job file
-		(void) replace_extension(filename, filename, "jobready", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.running file
-		(void) replace_extension(filename, filename, "running", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.running file
-		(void) replace_extension(filename, filename, "fail", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.fail file
-		(void) replace_extension(filename, filename, "cancel", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.cancel file
-		(void) replace_extension(filename, filename, "success", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.success file
-		(void) replace_extension(filename, filename, "kill", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.kill file
-		(void) replace_extension(filename, filename, "dead", (int) sizeof(filename));
-		(void) delete_file(filename);	//Delete #.dead file
-	}
-
-	//Delete any existing files used to report worker failure reasons
-	(void) replace_extension(filename, filename, "cantfindjob", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "cantloadjob", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "cantreadprojectpath", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "cantloadproject", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "cantreadfppos", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "cantreadfplength", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "cantallocate", (int) sizeof(filename));
-	(void) delete_file(filename);
-	(void) replace_extension(filename, filename, "solvefailed", (int) sizeof(filename));
-	(void) delete_file(filename);
-
-	//Evaluate solutions
-	solutionctr = first_deploy;	//The first worker process will be directed to calculate this solution set
-	(void) eof_count_selected_notes(&trackdiffsize);	//Count the number of notes in the active track difficulty
-	*deployment_notes = 0;			//Reset this count so the first solution will be counted as the one with the most notes played during SP deployments
-	while(!done && !error && !canceled)
-	{	//Until the supervisor's job is completed
-		workerstatuschange = num_workers_running = 0;
-
-		if(!idle_ctr)
-		{	//Force the worker statuses to be re-rendered every 1500 idle loop iterations
-			workerstatuschange = 1;
-			idle_ctr = 1500;
-		}
-
-		if(testing->note_count > trackdiffsize)
-		{	//If the note count in the testing structure has become corrupted
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tLogic error:  Testing structure note count is corrupted (note_count = %lu, target difficulty note count = %lu)", testing->note_count, trackdiffsize);
-			eof_log_casual(eof_log_string, 1, 1, 1);
-		}
-
-		//Check worker process status
-		for(workerctr = 0; workerctr < worker_count; workerctr++)
-		{	//For each worker process
-			(void) snprintf(filename, sizeof(filename) - 1, "%s%lu.job", eof_temp_path_s, workerctr);	//Build the file path for the process's job/results file
-
-			if(workers[workerctr].status == EOF_SP_PATH_WORKER_IDLE)
-			{	//If this process is waiting for a job
-				if(!error && !canceled)
-				{	//If the supervisor hasn't detected a failed/canceled status
-					if(solutionctr <= testing->note_count)
-					{	//If there are solutions left to test
-						fp = pack_fopen(filename, "wb");	//Create the job file
-						if(!fp)
-						{	//If the file couldn't be created
-							error = 1;
-						}
-						else
-						{	//The job file was opened for writing
-							unsigned long last_deploy;
-
-							//Build the job file
-							last_deploy = solutionctr + workers[workerctr].assignment_size;
-							if(last_deploy > testing->note_count)
-							{	//If this worker is processing the last of the solution sets
-								last_deploy = testing->note_count;	//Bounds check this variable so that the correct value is given to the worker
-							}
-							if(workers[workerctr].job_count == 1)
-							{	//If this is the first job being sent to this worker, include extra data that will be re-used in subsequent jobs
-								(void) eof_save_song_string_pf(eof_filename, fp);	//Write the path to the EOF project file
-								(void) pack_iputl(testing->deploy_count, fp);	//Write the detected maximum number of deployments so the worker can create an appropriately sized depoyment and cache arrays
-								(void) pack_iputl(testing->note_count, fp);		//Write the number of notes in the target track difficulty
-								for(ctr = 0; ctr < testing->note_count; ctr++)
-								{	//For every entry in the note measure position array
-									if(pack_fwrite(&testing->note_measure_positions[ctr], (long) sizeof(double), fp) != (long) sizeof(double))	//Write the note measure position
-									{	//If the double floating point value was not written
-										error = 1;
-										break;
-									}
-								}
-								for(ctr = 0; ctr < testing->note_count; ctr++)
-								{	//For every entry in the note beat lengths array
-									if(pack_fwrite(&testing->note_beat_lengths[ctr], (long) sizeof(double), fp) != (long) sizeof(double))	//Write the note beat length
-									{	//If the double floating point value was not written
-										error = 1;
-										break;
-									}
-								}
-								(void) pack_iputl(testing->track, fp);	//Write the target track
-								(void) pack_iputw(testing->diff, fp);	//Write the target difficulty
-							}
-
-							(void) pack_iputl(solutionctr, fp);		//Write the beginning of the solution set range the worker is to test
-							(void) pack_iputl(last_deploy, fp);		//Write the ending of the solution set range the worker is to test
-							(void) pack_fclose(fp);
-
-							(void) replace_extension(jobreadyfilename, filename, "jobready", (int) sizeof(filename));
-							fp = pack_fopen(jobreadyfilename, "w");	//Create a file to signal to the worker that the job file is ready to access
-							(void) pack_fclose(fp);
-
-							if(EOF_PERSISTENT_WORKER && (workers[workerctr].job_count > 1))
-							{	//If the worker process for this job is already running
-								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tDelivered job file \"%s\" (solution set #%lu to #%lu) to existing worker process", filename, solutionctr, last_deploy);
-								eof_log_casual(eof_log_string, 1, 1, 1);
-							}
-
-							//Launch the worker process if applicable
-							if(!error)
-							{	//If there hasn't been an I/O error
-								if(workers[workerctr].job_count == 1)
-								{	//If this job will initiate a worker process
-									get_executable_name(exepath, (int) sizeof(exepath) - 1);	//Get the full path to the running EOF executable
-
-									#ifdef ALLEGRO_WINDOWS
-										///Windows can easily launch another EOF instance over the command line
-										if(worker_logging)
-										{	//If the user specified to perform per-worker logging
-											(void) snprintf(commandline, sizeof(commandline) - 1, "start /BELOWNORMAL \"\" \"%s\" -ch_sp_path_worker \"%s\" -ch_sp_path_worker_logging", exepath, filename);	//Build the parameters to invoke EOF as a worker process to handle this job file
-										}
-										else
-										{	//Supervisor logging only
-											(void) snprintf(commandline, sizeof(commandline) - 1, "start /BELOWNORMAL \"\" \"%s\" -ch_sp_path_worker \"%s\"", exepath, filename);	//Build the parameters to invoke EOF as a worker process to handle this job file
-										}
-
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tLaunching worker process #%lu to evaluate solution sets #%lu-#%lu with command line:  %s", workerctr, solutionctr, last_deploy, commandline);
-										eof_log_casual(eof_log_string, 1, 1, 1);
-
-										if(eof_system(commandline))
-										{	//If the command failed to run
-											eof_log_casual("\t\tFailed to launch process", 1, 1, 1);
-											error = 1;
-											break;
-										}
-									#else
-										///Mac and other *nix based platforms must use a more complicated means of forking the EOF process
-										eof_log_casual(NULL, 1, 1, 1);	//Flush the buffered log writes to disk
-										pid_t pid = fork();
-										if(pid < 0)
-										{	//fork() failed
-											eof_log_casual("\t\tFailed to fork process", 1, 1, 1);
-											error = 1;
-											break;
-										}
-										else if(pid == 0)
-										{	//If this is the worker process created by fork()
-											eof_stop_logging();	//Prevent the worker process from logging in the supervisor's log
-											if(worker_logging)
-											{	//If the user specified to perform per-worker logging
-												ch_sp_path_worker_logging = 1;			//Signal to eof_start_logging() that this worker process will log
-												ch_sp_path_worker_number = workerctr;	//Signal to eof_start_logging() this worker's process number
-												eof_start_logging();					//Restart logging to create this worker process's log file
-												(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tSuccessfully forked worker process number %lu", workerctr);
-												eof_log_casual(eof_log_string, 1, 1, 1);
-											}
-
-											//Perform cleanup for items allocated by the supervisor, which the worker won't use
-											free(workers);
-											eof_destroy_sp_solution(testing);
-											free(best->deployments);
-											free(best);
-
-											eof_ch_sp_path_worker(filename);	//Divert the process to the worker pathing function
-											eof_quit = 1;	//Signal the main function to exit
-
-											return 1;
-										}
-										else
-										{	//This is the original supervisor process that called fork()
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tSuccessfully forked EOF process, child PID is %d", pid);
-											eof_log_casual(eof_log_string, 1, 1, 1);
-										}
-									#endif
-								}//If this job will initiate a worker process
-
-								num_workers_launched++;
-								workers[workerctr].status = EOF_SP_PATH_WORKER_WAITING;
-								workers[workerctr].first_deploy = solutionctr;
-								workers[workerctr].last_deploy = last_deploy;
-								workers[workerctr].start_time = clock();	//Record the start time of the worker process
-								workerstatuschange = 1;
-								solutionctr = last_deploy + 1;	//Update the counter tracking which solution set to assign next
-							}
-						}//The job file was opened for writing
-					}//If there are solutions left to test
-					else
-					{	//There are no solutions left to test
-						if(!solutions_exhausted_time)
-						{	//If this condition hasn't been logged yet
-							solutions_exhausted_time = clock();
-							elapsed_time = ((double)solutions_exhausted_time - start_time) / CLOCKS_PER_SEC;
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tSolutions to test exhausted at %.2f seconds into supervisor process execution.", elapsed_time);
-							eof_log_casual(eof_log_string, 1, 1, 1);
-						}
-						(void) replace_extension(filename, filename, "kill", (int) sizeof(filename));	//Build the path to the file to command the worker process to end
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tSignaling worker process #%lu to terminate", workerctr);
-						eof_log_casual(eof_log_string, 1, 1, 1);
-						fp = pack_fopen(filename, "w");	//Create that file
-						(void) pack_fclose(fp);
-						workers[workerctr].status = EOF_SP_PATH_WORKER_STOPPING;
-						workerstatuschange = 1;
-					}//There are no solutions left to test
-
-					//Check if user canceled an idle worker process, don't consider this a cancellation of the supervisor, just the process
-					(void) replace_extension(filename, filename, "dead", (int) sizeof(filename));	//Build the path to this worker's termination status file
-					if(exists(filename))
-					{
-						workers[workerctr].status = EOF_SP_PATH_WORKER_STOPPED;
-						workerstatuschange = 1;
-					}
-				}//If the supervisor hasn't detected a failed/canceled status
-			}//If this process is waiting for a job
-			else if(workers[workerctr].status == EOF_SP_PATH_WORKER_WAITING)
-			{	//If this process was previously dispatched, but hasn't been verified to be running yet
-				clock_t current_time = clock();
-
-				num_workers_running++;	//For the purposes of tracking how many workers are currently running, waiting status counts
-				(void) replace_extension(filename, filename, "running", (int) sizeof(filename));	//Build the path to this worker's running status file
-				if(exists(filename))
-				{	//If the worker process created this file to signal that it is processing the job
-					(void) delete_file(filename);	//Delete the .running file to acknowledge that the worker is running
-					workers[workerctr].status = EOF_SP_PATH_WORKER_RUNNING;
-					waiting_overhead += current_time - workers[workerctr].start_time;	//Keep track of how many clocks are spent for worker processes being in waiting state
-					workerstatuschange = 1;
-				}
-				else
-				{	//Otherwise check how long it's been since the process was launched
-					elapsed_time = (double)(current_time - workers[workerctr].start_time) / (double)CLOCKS_PER_SEC;	//Convert to seconds
-					if(elapsed_time > 10.0)
-					{	//If the worker process hasn't been detected within 10 seconds
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tFailed to detect worker process #%lu", workerctr);
-						eof_log_casual(eof_log_string, 1, 1, 1);
-						error = 1;
-					}
-				}
-			}
-			else if(workers[workerctr].status == EOF_SP_PATH_WORKER_RUNNING)
-			{	//If this process was previously running, check if it's done
-				num_workers_running++;	//Track the number of workers in running status
-				(void) replace_extension(filename, filename, "job", (int) sizeof(filename));	//Build the path to this worker's job file
-				if(!exists(filename))
-				{	//If the job file no longer exists, the worker has completed, check the results
-					int retry;
-
-					for(retry = 5; retry > 0; retry--)
-					{	//Attempt to read the results file up to five times
-						(void) replace_extension(filename, filename, "fail", (int) sizeof(filename));	//Build the path to check whether this worker process failed
-						if(exists(filename))
-						{	//If the worker failed
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDetected failure by worker process #%lu", workerctr);
-							eof_log_casual(eof_log_string, 1, 1, 1);
-							error = 1;
-						}
-						else
-						{	//If the worker did not create a file indicating failure status
-							(void) replace_extension(filename, filename, "cancel", (int) sizeof(filename));	//Build the path to check whether this worker process was canceled
-							if(exists(filename))
-							{	//If the user canceled the worker
-								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDetected cancellation by worker process #%lu", workerctr);
-								eof_log_casual(eof_log_string, 1, 1, 1);
-								canceled = 1;
-								workers[workerctr].status = EOF_SP_PATH_WORKER_STOPPED;
-								break;	//Break from retry loop
-							}
-							else
-							{	//If the worker was not canceled
-								(void) replace_extension(filename, filename, "success", (int) sizeof(filename));	//Build the path to check whether this worker process succeeded
-								if(exists(filename))
-								{	//If the worker succeeded
-									for(ctr = 0; ctr < 5; ctr++)
-									{	//Try to read the success file up to five times
-										fp = pack_fopen(filename, "rb");
-										if(fp)		//If the file was opened
-											break;	//exit this loop
-										Idle(2);	//Brief wait before retry
-									}
-									if(!fp)
-									{	//If the results couldn't be accessed
-										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tFailed to open \"%s\" results file", filename);
-										eof_log_casual(eof_log_string, 1, 1, 1);
-										error = 1;
-										break;	//Break from retry loop
-									}
-									else
-									{	//The results file was opened
-										EOF_BIG_NUMBER vcount, icount, sum = {0, 0};
-										char tempstring[30];
-
-										workers[workerctr].end_time = clock();	//Record the completion time of the worker
-
-										//Parse the results
-										testing->score = pack_igetl(fp);
-										testing->deployment_notes = pack_igetl(fp);
-										job_deploy_notes = pack_igetl(fp);
-										if(job_deploy_notes > *deployment_notes)
-										{	//If this job contained a solution that played more notes during combined star power deployments than any other tested solution
-											*deployment_notes = job_deploy_notes;	//Track this count
-										}
-										vcount.overflow_count = pack_igetl(fp);
-										vcount.value = pack_igetl(fp);
-										eof_big_number_add_big_number(validcount, &vcount);		//Keep a sum of the valid solutions, account for overflow
-										icount.overflow_count = pack_igetl(fp);
-										icount.value = pack_igetl(fp);
-										eof_big_number_add_big_number(invalidcount, &icount);	//Keep a sum of the invalid solutions, account for overflow
-
-										testing->num_deployments = pack_igetl(fp);	//The number of deployments in the solution
-										for(ctr = 0; ctr < testing->num_deployments; ctr++)
-										{	//For each deployment in the solution
-											testing->deployments[ctr] = pack_igetl(fp);	//Read the deployment's note index
-										}
-										(void) pack_fclose(fp);
-
-										//Log the results
-										eof_big_number_add_big_number(&sum, &vcount);	//Count the number of valid and invalid solutions tested
-										eof_big_number_add_big_number(&sum, &icount);
-										elapsed_time = (double)(workers[workerctr].end_time - workers[workerctr].start_time) / (double)CLOCKS_PER_SEC;	//Convert to seconds
-										if(sum.overflow_count)
-										{	//If more than 4 billion solutions were tested
-											unsigned long billion_count, leftover;
-
-											billion_count = (sum.overflow_count * 4) + (sum.value / 1000000000);
-											leftover = sum.value % 1000000000;
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tWorker process %lu completed evaluation of solution sets #%lu-#%lu (job #%lu, %lu billion + %lu solutions) in %.2f seconds.  Its best solution:  Deploy at indexes ", workerctr, workers[workerctr].first_deploy, workers[workerctr].last_deploy, workers[workerctr].job_count, billion_count, leftover, elapsed_time);
-										}
-										else
-										{
-											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tWorker process %lu completed evaluation of solution sets #%lu-#%lu (job #%lu, %lu solutions) in %.2f seconds.  Its best solution:  Deploy at indexes ", workerctr, workers[workerctr].first_deploy, workers[workerctr].last_deploy, workers[workerctr].job_count, sum.value, elapsed_time);
-										}
-										for(ctr = 0; ctr < testing->num_deployments; ctr++)
-										{	//For each deployment in the chosen solution
-											(void) snprintf(tempstring, sizeof(tempstring) - 1, "%s%lu", (ctr ? ", " : ""), testing->deployments[ctr]);
-											strncat(eof_log_string, tempstring, sizeof(eof_log_string) - 1);
-										}
-										(void) snprintf(tempstring, sizeof(tempstring) - 1, ".  Score = %lu", testing->score);
-										strncat(eof_log_string, tempstring, sizeof(eof_log_string) - 1);
-										eof_log_casual(eof_log_string, 1, 1, 1);
-										if(elapsed_time < 5.0)
-										{	//If the worker completed in less than five seconds
-											workers[workerctr].assignment_size *= (5.0 / elapsed_time);	//Scale the job assignment size to take at least five seconds long
-										}
-
-										//Compare with current best solution
-										if((testing->score > best->score) || ((testing->score == best->score) && (testing->deployment_notes < best->deployment_notes)))
-										{	//If this worker's solution is the best solution
-											eof_log_casual("\t\t!New best solution", 1, 1, 1);
-
-											best->score = testing->score;	//It is the new best solution, copy its data into the best solution structure
-											best->deployment_notes = testing->deployment_notes;
-											best->num_deployments = testing->num_deployments;
-
-											if(testing->deployment_notes > *deployment_notes)
-											{	//If this solution played more notes during star power than any previous solution
-												*deployment_notes = testing->deployment_notes;	//Track this count
-											}
-											memcpy(best->deployments, testing->deployments, sizeof(unsigned long) * testing->deploy_count);
-										}
-
-										//Update the worker status
-										workers[workerctr].status = EOF_SP_PATH_WORKER_IDLE;
-										workerstatuschange = 1;
-										num_jobs_completed++;	//Track the number of completed solution jobs
-										if(EOF_PERSISTENT_WORKER)
-										{	//If the worker will remain running after completing this job
-											workers[workerctr].job_count++;	//Track how many jobs the worker has been assigned, as all job files ffter the first will require less data to be written to file
-										}
-										break;	//Break from retry loop
-									}//The results file was opened
-								}//If the worker succeeded
-								else
-								{	//None of the expected results file names were found
-									if(retry)
-									{	//If there are read attempts left before giving up
-										Idle(2);	//Brief wait before retry
-									}
-									else
-									{
-										eof_log_casual("\tWorker failed to report status.", 1, 1, 1);
-										error = 1;
-										break;	//Break from retry loop
-									}
-								}
-							}//If the worker was not canceled
-						}//If the worker did not create a file indicating failure status
-					}//Attempt to read the results file up to five times
-					if(error)
-					{
-						set_window_title("SP pathing failed.  Waiting for workers to finish/cancel.");
-						workers[workerctr].status = EOF_SP_PATH_WORKER_FAILED;
-						workerstatuschange = 1;
-					}
-					else
-					{	//If the expected results file was processed, delete it
-						if(!canceled)
-						{	//Except for cancel status files, whose tested solution counts will be read later
-							(void) delete_file(filename);
-						}
-					}
-				}//If the job file no longer exists, the worker has completed, check the results
-			}//If this process was previously dispatched, check if it's done
-			else if(workers[workerctr].status == EOF_SP_PATH_WORKER_STOPPING)
-			{	//If this process was previously commanded to end, check if it has acknowledged
-				(void) replace_extension(filename, filename, "dead", (int) sizeof(filename));	//Build the path to this worker's termination status file
-				if(exists(filename))
-				{
-					workers[workerctr].status = EOF_SP_PATH_WORKER_STOPPED;
-					workerstatuschange = 1;
-				}
-			}
-		}//For each worker process
-
-		//Check for user cancellation in the supervisor process
-		if(key[KEY_ESC])
-		{
-			canceled = 1;
-		}
-		if(eof_close_button_clicked)
-		{	//Consider clicking the close window control a cancellation
-			eof_close_button_clicked = 0;
-			canceled = 1;
-		}
-		if(canceled)
-		{
-			workerstatuschange = 1;
-		}
-
-		if(!workerstatuschange && !num_workers_running && (solutionctr > testing->note_count))
-		{	//If no workers have changed state, none are in running state and all solution sets have already been assigned to workers
-			done = 1;
-		}
-		else if(!workerstatuschange)
-		{	//If all workers are in the same status as during the previous check
-			(void) snprintf(filename, sizeof(filename) - 1, "%seof.recover.on", eof_temp_path_s);	//Build the path for EOF's recovery status file
-			if(!exists(filename))
-			{	//If the recovery status file is not seen
-				if(eof_validate_temp_folder())
-				{	//Ensure the correct working directory and presence of the temporary folder
-					eof_log("\tCould not validate working directory and temp folder", 1);
-					allegro_message("Error:  Working directory lost.");
-					error = 1;
-				}
-			}
-			if(key[KEY_PAUSE])
-			{
-				EOF_BIG_NUMBER sum = {0, 0};
-
-				elapsed_time = (double)(clock() - start_time) / (double)CLOCKS_PER_SEC;	//Convert to seconds
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tElapsed time is %.2f seconds.", elapsed_time);
-				eof_log_casual(eof_log_string, 1, 1, 0);
-
-				eof_big_number_add_big_number(&sum, validcount);	//Count the number of valid and invalid solutions tested
-				eof_big_number_add_big_number(&sum, invalidcount);
-				if(sum.overflow_count)
-				{	//If more than 4 billion solutions were tested
-					unsigned long billion_count, leftover;
-
-					billion_count = (sum.overflow_count * 4) + (sum.value / 1000000000);
-					leftover = sum.value % 1000000000;
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t%lu billion + %lu solutions have been evaluated.", billion_count, leftover);
-				}
-				else
-				{
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t%lu solutions have been evaluated.", sum.value);
-				}
-				eof_log_casual(eof_log_string, 1, 0, 1);
-				eof_log_casual(NULL, 1, 1, 1);	//Flush the buffered log writes to disk
-				eof_log_cwd();
-				key[KEY_PAUSE] = 0;
-			}
-			Idle(10);	//Wait a bit before checking worker process statuses again
-			idle_ctr--;
+		EOF_SP_PATH_WORKER *wp = &workers[ctr];
+
+		memcpy(&wp->testing, testing, sizeof(EOF_SP_PATH_SOLUTION));
+		memcpy(&wp->best, best, sizeof(EOF_SP_PATH_SOLUTION));	//Each worker starts with the calling function's best solution (the score without any star power deployment)
+		wp->testing.deployments = malloc(sizeof(unsigned long) * testing->deploy_count);
+		wp->best.deployments = malloc(sizeof(unsigned long) * testing->deploy_count);
+		wp->testing.deploy_cache = malloc(sizeof(EOF_SP_PATH_SCORING_STATE) * testing->deploy_count);
+		wp->best.deploy_cache = wp->testing.deploy_cache;
+		wp->testing.deployment_endings = wp->best.deployment_endings = NULL;	//These are only used when evaluating the global solution structure
+		wp->testing.resulting_sp_meter = wp->best.resulting_sp_meter = NULL;
+		wp->testing.last_cache.note_start = ULONG_MAX;
+		wp->validcount.overflow_count = wp->validcount.value = 0;
+		wp->invalidcount.overflow_count = wp->invalidcount.value = 0;
+		wp->prunedcount.overflow_count = wp->prunedcount.value = 0;
+		wp->deployment_notes = 0;
+		if(!wp->testing.deployments || !wp->best.deployments || !wp->testing.deploy_cache)
+		{	//If any of those failed to allocate
+			error = 1;
 		}
 		else
 		{
-			int ypos = 0;
-			eof_log_casual(NULL, 1, 1, 1);	//Flush the buffered log writes to disk
-
-			///Blit each worker status to the screen
-			clear_to_color(eof_window_note_upper_left->screen, eof_color_gray);
-			for(workerctr = 0; workerctr < worker_count; workerctr++)
-			{	//For each worker process
-				char *idle_status = "IDLE";
-				char *waiting_status = "WAITING";
-				char *running_status = "RUNNING";
-				char *error_status = "ERROR";
-				char *stopping_status = "STOPPING";
-				char *stopped_status = "STOPPED";
-				char *current_status;
-
-				if(workers[workerctr].status == EOF_SP_PATH_WORKER_IDLE)
-					current_status = idle_status;
-				else if(workers[workerctr].status == EOF_SP_PATH_WORKER_WAITING)
-					current_status = waiting_status;
-				else if(workers[workerctr].status == EOF_SP_PATH_WORKER_RUNNING)
-					current_status = running_status;
-				else if(workers[workerctr].status == EOF_SP_PATH_WORKER_STOPPING)
-					current_status = stopping_status;
-				else if(workers[workerctr].status == EOF_SP_PATH_WORKER_STOPPED)
-					current_status = stopped_status;
-				else
-					current_status = error_status;
-
-				if(workers[workerctr].status == EOF_SP_PATH_WORKER_RUNNING)
-				{	//If the worker process is running, display its assigned solution sets
-					if(workers[workerctr].first_deploy == workers[workerctr].last_deploy)
-					{	//Worker process is only evaluating one solution set
-						(void) snprintf(tempstr, sizeof(tempstr) - 1, "Worker process #%lu status: %s.  Processing job #%lu:  Evaluating solution set #%lu", workerctr, current_status, workers[workerctr].job_count, workers[workerctr].first_deploy);
-					}
-					else
-					{	//Worker process is evaluating multiple solution sets
-						(void) snprintf(tempstr, sizeof(tempstr) - 1, "Worker process #%lu status: %s.  Processing job #%lu:  Evaluating solution set #%lu -> #%lu", workerctr, current_status, workers[workerctr].job_count, workers[workerctr].first_deploy, workers[workerctr].last_deploy);
-					}
-				}
-				else
-				{	//Otherwise just report the worker process's status
-					(void) snprintf(tempstr, sizeof(tempstr) - 1, "Worker process #%lu status: %s", workerctr, current_status);
-				}
-				textout_ex(eof_window_note_upper_left->screen, eof_font, tempstr, 2, ypos, eof_color_white, -1);
-				ypos += 12;
+			memcpy(wp->best.deployments, best->deployments, sizeof(unsigned long) * best->num_deployments);
+			for(ctr2 = 0; ctr2 < testing->deploy_count; ctr2++)
+			{	//For every entry in the deploy cache
+				wp->testing.deploy_cache[ctr2].note_start = ULONG_MAX;	//Mark it as invalid
 			}
-			if(error)
-			{
-				textout_ex(eof_window_note_upper_left->screen, eof_font, "Error encountered.  Waiting for workers to finish/cancel.", 2, ypos, eof_color_white, -1);
-			}
-			else if(canceled)
-			{
-				textout_ex(eof_window_note_upper_left->screen, eof_font, "User cancellation.  Waiting for workers to finish/cancel.", 2, ypos, eof_color_white, -1);
-			}
-			else
-			{
-				textout_ex(eof_window_note_upper_left->screen, eof_font, "Press Escape to cancel.", 2, ypos, eof_color_white, -1);
-			}
-			(void) snprintf(tempstr, sizeof(tempstr) - 1, "%lu worker%s running.  Last assigned solution set is %lu/%lu.", num_workers_running, ((num_workers_running > 1) ? "s" : ""), (solutionctr != first_deploy) ? (solutionctr - 1) : first_deploy, testing->note_count);
-			set_window_title(tempstr);
-			blit(eof_window_note_upper_left->screen, screen, 0, 0, 0, 0, eof_window_note_upper_left->w, eof_window_note_upper_left->h);	//Render the screen normally
-		}
-	}//Until the supervisor's job is completed
-
-	//Command all worker processes to end
-	for(workerctr = 0; workerctr < worker_count; workerctr++)
-	{	//For each worker process
-		if((workers[workerctr].status != EOF_SP_PATH_WORKER_STOPPED) && (workers[workerctr].status != EOF_SP_PATH_WORKER_STOPPING))
-		{	//If the worker hasn't already been stopped or commanded to stop
-			(void) snprintf(filename, sizeof(filename) - 1, "%s%lu.kill", eof_temp_path_s, workerctr);	//Build the file path for the process's kill command
-			fp = pack_fopen(filename, "w");	//Create that file
-			(void) pack_fclose(fp);
-		}
-	}
-
-	//If the processing was cancelled, wait for and read the tested solution counts for each worker
-	time1 = clock();
-	while(canceled)
-	{	//If the processing was cancelled
-		int all_stopped = 1;	//Set to nonzero if any workers are not already stopped
-
-		for(workerctr = 0; workerctr < worker_count; workerctr++)
-		{	//For each worker process
-			if(workers[workerctr].status != EOF_SP_PATH_WORKER_STOPPED)
-			{	//If the process hasn't been confirmed to have stopped yet
-				all_stopped = 0;
-				(void) snprintf(filename, sizeof(filename) - 1, "%s%lu.job", eof_temp_path_s, workerctr);	//Build the file path for the process's job file
-				if(!exists(filename))
-				{	//If the worker has deleted that file
-					(void) replace_extension(filename, filename, "cancel", (int) sizeof(filename));		//Build the path for the process's cancel status file
-					if(exists(filename))
-					{	//If it exists
-						fp = pack_fopen(filename, "rb");
-						if(fp)
-						{	//The results file was opened
-							EOF_BIG_NUMBER vcount, icount;
-
-							vcount.overflow_count = pack_igetl(fp);					//Read the number of valid solutions
-							vcount.value = pack_igetl(fp);
-							eof_big_number_add_big_number(validcount, &vcount);		//Add to the supervisor's ongoing sum of valid solutions, account for overflow
-							icount.overflow_count = pack_igetl(fp);					//Read the number of invalid solutions
-							icount.value = pack_igetl(fp);
-							eof_big_number_add_big_number(invalidcount, &icount);	//Add to the supervisor's ongonig sum of invalid solutions, account for overflow
-
-							workers[workerctr].status = EOF_SP_PATH_WORKER_STOPPED;	//This worker process is confirmed to have stopped
-							(void) pack_fclose(fp);
-						}
-					}
-				}
-			}
-		}
-
-		if(all_stopped)
-		{	//If there are no other cancel status files to wait for
-			break;	//Exit this while loop
-		}
-		else
-		{	//Otherwise if the threshold amount of time for the files to be recceived hasn't been reached, wait and check for more status files
-			time2 = clock();
-			if((time2 - time1) / CLOCKS_PER_SEC > EOF_SP_PATH_KILL_FILE_CHECK_INTERVAL + 1)
-			{	//If it's been more than a second longer than the interval the workers use to check for a kill command
-				break;	//Stop waiting for their status files and report the solution tested counts that are already known and exit this while loop
-			}
-			Idle(10);	//Wait a bit before checking worker process statuses files again
 		}
 	}
-
-	end_time = clock();
-	elapsed_time = ((double) end_time - start_time) / CLOCKS_PER_SEC;
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tSupervisor finished at %.2f seconds into supervisor process execution.  A total of %lu worker instances were launched and %lu jobs completed, with a combined waiting overhead of %.2f seconds.", elapsed_time, num_workers_launched, num_jobs_completed, (double)waiting_overhead / CLOCKS_PER_SEC);
-	eof_log_casual(eof_log_string, 1, 1, 1);
+	if(error)
+	{
+		eof_log("\tFailed to allocate memory", 1);
+	}
+	else
+	{	//Run the worker threads, each testing one solution set at a time
+		pool.function = eof_ch_sp_path_work;
+		pool.context = &prune;
+		pool.workers = workers;
+		pool.worker_size = sizeof(EOF_SP_PATH_WORKER);
+		pool.worker_count = worker_count;
+		pool.first_item = first_deploy;
+		pool.end_item = testing->note_count;
+		pool.range_size = 1;
+		pool.title = "Testing SP path solution sets";
+		eof_ch_sp_path_threads_running = 1;
+		error = eof_work_pool_run(&pool);
+		eof_ch_sp_path_threads_running = 0;
+
+		//Combine the worker threads' results
+		*deployment_notes = 0;
+		for(ctr = 0; ctr < pool.workers_used; ctr++)
+		{	//For each worker entry that was used
+			EOF_SP_PATH_WORKER *wp = &workers[ctr];
+
+			eof_big_number_add_big_number(validcount, &wp->validcount);		//Add to the supervisor's ongoing sum of valid solutions, account for overflow
+			eof_big_number_add_big_number(invalidcount, &wp->invalidcount);	//Add to the supervisor's ongoing sum of invalid solutions, account for overflow
+			if(prunedcount)
+				eof_big_number_add_big_number(prunedcount, &wp->prunedcount);
+			if(wp->deployment_notes > *deployment_notes)
+				*deployment_notes = wp->deployment_notes;	//Track the highest count among all workers
+			if((wp->best.score > best->score) || ((wp->best.score == best->score) && (wp->best.deployment_notes < best->deployment_notes)))
+			{	//If this worker's best solution achieved a higher score than the current best, or if it matched the highest score but did so with fewer notes played during star power deployment
+				best->score = wp->best.score;	//It is the new best solution, copy its data into the best solution structure
+				best->deployment_notes = wp->best.deployment_notes;
+				best->num_deployments = wp->best.num_deployments;
+				best->solution_number = wp->best.solution_number;
+				memcpy(best->deployments, wp->best.deployments, sizeof(unsigned long) * wp->best.num_deployments);
+			}
+		}
+
+		eof_logf(1, "\t%lu of %lu solution sets were tested by worker threads", pool.items_completed, testing->note_count - first_deploy);
+	}
 
 	//Clean up
+	for(ctr = 0; ctr < worker_count; ctr++)
+	{	//For each worker entry
+		free(workers[ctr].testing.deployments);
+		free(workers[ctr].best.deployments);
+		free(workers[ctr].testing.deploy_cache);
+	}
 	free(workers);
 
-	eof_log_casual(NULL, 1, 1, 1);	//Flush the buffered log writes to disk, if any
-
-	if(error)
-		return 1;	//Return error
-	if(canceled)
-		return 2;	//Return cancellation
-
-	return 0;	//Return success
+	return error;	//Return success (0), error (1) or cancellation (2)
 }
 
 int eof_menu_track_evaluate_user_ch_sp_path(void)
@@ -3076,7 +2149,7 @@ int eof_menu_track_evaluate_user_ch_sp_path(void)
 		eof_process_beat_statistics(eof_song, eof_selected_track);
 	if(!eof_song->beat[0]->has_ts)
 	{
-		allegro_message("A time signature must be in effect on the first beat.  Use \"Beat>Time Signature>\" to apply one.");
+		eof_message("A time signature must be in effect on the first beat.  Use \"Beat>Time Signature>\" to apply one.");
 		return 1;
 	}
 
@@ -3098,7 +2171,7 @@ int eof_menu_track_evaluate_user_ch_sp_path(void)
 					(void) snprintf(error_string, sizeof(error_string) - 1, "Solution invalid:  More than the possible number of %lu star power deployments are specified.", testing->deploy_count);
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t%s", error_string);
 					eof_log(eof_log_string, 1);
-					allegro_message("%s", error_string);
+					eof_message("%s", error_string);
 					error = 1;
 					break;
 				}
@@ -3114,7 +2187,7 @@ int eof_menu_track_evaluate_user_ch_sp_path(void)
 	///Evaluate the solution
 	if(!deploy_count)
 	{	//If the user did not specify deployment at any notes
-		allegro_message("No star power deployments were defined.  Use functions in the \"Note>Clone Hero>SP deploy>\" menu to specify deployment at desired notes and try again.");
+		eof_message("No star power deployments were defined.  Use functions in the \"Note>Clone Hero>SP deploy>\" menu to specify deployment at desired notes and try again.");
 	}
 	else if(!error)
 	{	//If the user specified deployment count is valid
@@ -3141,7 +2214,7 @@ int eof_menu_track_evaluate_user_ch_sp_path(void)
 				(void) snprintf(error_string, sizeof(error_string) - 1, "Testing failed:  Unsupported track format.");
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t%s", error_string);
 			eof_log(eof_log_string, 1);
-			allegro_message("%s\nCheck EOF's log for more details.", error_string);
+			eof_message("%s\nCheck EOF's log for more details.", error_string);
 		}
 		else
 		{	//The solution was found valid
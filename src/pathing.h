@@ -45,29 +45,20 @@ typedef struct
 	unsigned long score;				//The estimated score if all notes in the processed track difficulty are hit, and all sustain star power notes are whammied for bonus star power
 	unsigned long deployment_notes;		//The number of notes played during star power deployment
 	EOF_BIG_NUMBER solution_number;
+
+	//Last caching variables (stores score caching at one note earlier than the last evaluated solution's last SP deployment)
+	EOF_SP_PATH_SCORING_STATE last_cache;		//Stores scoring data for the note prior to the deployment, to be able to skip the most calculations for sequential solutions being tested (ie. deploy at note 1 and 50, note 1 and 51, note 1 and 52, etc).
+	unsigned long last_cache_deployment_num;	//The next deployment number in effect as of when the last cache data was stored
 } EOF_SP_PATH_SOLUTION;
 
-#define EOF_PERSISTENT_WORKER 1
-	//Specifies that worker processes will remain running and able to receive additional #.job files from the supervisor process
-	//All jobs after the first will retain common information from the first job instead of requiring it to be defined again in the job
-	// removing the need to read and write kilobytes of floating point data per job file
-	//When the worker sees a #.kill file in the directory of its initial job, it will exit its main loop and end execution
-
-#define EOF_SP_PATH_WORKER_IDLE 0
-#define EOF_SP_PATH_WORKER_WAITING 1
-#define EOF_SP_PATH_WORKER_RUNNING 2
-#define EOF_SP_PATH_WORKER_FAILED 3
-#define EOF_SP_PATH_WORKER_STOPPING 4
-#define EOF_SP_PATH_WORKER_STOPPED 5
 typedef struct
 {
-	int status;						//Tracks the process's status by way of one of the above EOF_SP_PATH_WORKER... macros
-	unsigned long first_deploy;		//The first solution set being tested by the worker process
-	unsigned long last_deploy;		//The last solution set being tested by the worker process
-	unsigned long assignment_size;	//The last number of solution sets assigned to the worker process
-	clock_t start_time;				//When the worker process was started
-	clock_t end_time;				//When the worker process was detected to have completed
-	unsigned long job_count;		//After a persistent worker has received its first job, subsequent job files will omit redundant job data (everything except the start/end solution numbers to test)
+	EOF_SP_PATH_SOLUTION best;			//The best solution found by this worker thread
+	EOF_SP_PATH_SOLUTION testing;		//This worker thread's working solution, having its own deployment array and deploy cache but sharing the supervisor's read only note arrays
+	EOF_BIG_NUMBER validcount;			//The number of valid solutions tested by this worker thread
+	EOF_BIG_NUMBER invalidcount;		//The number of invalid solutions tested by this worker thread
+	EOF_BIG_NUMBER prunedcount;			//The number of solution subsets skipped by this worker thread
+	unsigned long deployment_notes;		//The highest count of notes found to be playable during all star power deployments of any of this worker thread's solutions
 } EOF_SP_PATH_WORKER;
 
 extern EOF_SP_PATH_SOLUTION *eof_ch_sp_solution;
@@ -138,25 +129,29 @@ int eof_evaluate_ch_sp_path_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUM
 	// being that the last deployment is one note later.  This allows more optimized score caching to be used, skipping all calculation earlier than 2 notes before the last
 	// deployment instead of requiring recalculation for all notes after the second to last deployment's scope.
 
-int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long last_deploy, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, unsigned long *deployment_notes, char *kill_file);
+int eof_ch_sp_path_single_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long last_deploy, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, EOF_BIG_NUMBER *prunedcount, unsigned long *deployment_notes, volatile int *cancel);
 	//Calculates all solutions where the first deployment starts at note index between first_deploy and last_deploy (inclusive),
 	// comparing their scores with the provided best solution and updating its content accordingly
 	//If all solutions are to be tested, ULONG_MAX should be specified for last_deploy
 	//validcount and invalidcount are passed so the calling function can know how many solutions were tested
+	//If prunedcount is not NULL, the search is pruned:  After each valid solution, an upper bound is calculated for the score of any solution that adds
+	// more deployments to it (the solution's score plus the score of every note after its last deployment ends, since SP can at most double those).
+	// If that bound is lower than the best score so far, those solutions are skipped and prunedcount is incremented.  The best solution is the same
+	// as when every solution is tested (prunedcount is NULL), but validcount and invalidcount will only reflect the solutions that were actually tested
 	//deployment_notes is used to track the highest count of notes that were found to be playable during all star power deployments of any solution
 	//The testing structure is used as the working structure to store each solution's score, provided for the calling function to reduce overhead
-	//If kill_file is not NULL, this function will periodically check for the existence of this file and if it is found, the function will return the user cancellation code
+	//If cancel is not NULL, the function is being run by a worker thread:  No logging, title bar updates or keyboard checks are performed,
+	// and the function returns the user cancellation code when the referenced variable becomes nonzero
 	//Returns 0 on success, 1 on error or 2 on user cancellation
-#define EOF_SP_PATH_KILL_FILE_CHECK_INTERVAL 5
-	//How many seconds eof_ch_sp_path_single_process_solve() will wait before checking if the worker's kill file exists
 
-int eof_ch_sp_path_supervisor_process_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long worker_count, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, unsigned long *deployment_notes, int worker_logging);
-	//Finds the best solution as eof_ch_sp_path_single_process_solve() does, but does so by running the specified number of worker EOF processes in parallel
+int eof_ch_sp_path_threaded_solve(EOF_SP_PATH_SOLUTION *best, EOF_SP_PATH_SOLUTION *testing, unsigned long first_deploy, unsigned long worker_count, EOF_BIG_NUMBER *validcount, EOF_BIG_NUMBER *invalidcount, EOF_BIG_NUMBER *prunedcount, unsigned long *deployment_notes);
+	//Finds the best solution as eof_ch_sp_path_single_process_solve() does, but does so by running the specified number of worker threads in parallel
 	// to test all solution sets from first_deploy to testing->note_count
-	//validcount and invalidcount are passed so the calling function can know how many solutions were tested among all worker processes
+	//Each worker thread repeatedly claims the next untested solution set through eof_work_pool_run(), so threads that finish short solution sets keep taking more work
+	//The worker threads share testing's read only note_measure_positions and note_beat_lengths arrays, but each keeps its own deployments array and deploy cache
+	//validcount and invalidcount are passed so the calling function can know how many solutions were tested among all worker threads
+	//If prunedcount is not NULL, each worker thread prunes its search as described for eof_ch_sp_path_single_process_solve() and the pruned counts are summed
 	//deployment_notes is used to track the highest count of notes that were found to be playable during all star power deployments of any solution
-	//The testing structure is used as the working structure to store each solution's score, provided for the calling function to reduce overhead
-	//If worker_logging is nonzero, the worker processes are launched with the -ch_sp_path_worker_logging parameter so they perform logging each in their own file
 	//Returns 0 on success, 1 on error or 2 on user cancellation
 
 void eof_ch_pathing_mark_tflags(EOF_SP_PATH_SOLUTION *solution);
@@ -186,13 +181,6 @@ void eof_ch_sp_path_report_solution(EOF_SP_PATH_SOLUTION *solution, EOF_BIG_NUMB
 int eof_menu_track_find_ch_sp_path(void);
 	//Determines optimum star power deployment for the active track difficulty
 
-void eof_ch_sp_path_worker(char *job_file);
-	//When EOF is launched with the ch_sp_path_worker parameter, this function is called after minimal program initialization to process the specified ####.job file
-	//If the job completes successfully, a ###.results file is created at the same path as the job file
-	//If the job fails due to error, a ###.fail file is created at the same path as the job file
-	//If the job is cancelled by the user (ie. Escape keypress), a ###.cancel file is created at the same path as the job file
-	//The specified job file is deleted after the above file is created
-
 int eof_menu_track_evaluate_user_ch_sp_path(void);
 	//For the active track difficulty, examines highlighted notes as a proposed star power path solution and reports the solution's validity/score to the user
 
@@ -0,0 +1,162 @@
+#include <allegro.h>
+#include <alogg.h>
+#include <pthread.h>
+#include "main.h"
+#include "utility.h"
+#include "pcm.h"
+
+#ifdef USEMEMWATCH
+#include "memwatch.h"
+#endif
+
+static EOF_PCM_CACHE_ENTRY *eof_pcm_cache = NULL;	//The decoded PCM data for the most recently acquired audio file
+static pthread_mutex_t eof_pcm_cache_mutex = PTHREAD_MUTEX_INITIALIZER;	//Serializes access to the cache, since the Rocksmith WAV export acquires it from a worker thread
+
+static void eof_pcm_cache_destroy_entry(EOF_PCM_CACHE_ENTRY *entry)
+{
+	if(!entry)
+		return;
+
+	if(entry->audio)
+		destroy_sample(entry->audio);
+	free(entry);
+}
+
+static SAMPLE *eof_pcm_cache_decode(const char *oggfilename, void *oggdata, int oggsize)
+{
+	ALOGG_OGG *oggstruct;
+	SAMPLE *audio = NULL;
+	void *oggbuffer = oggdata;
+
+	if(!oggbuffer)
+	{	//If the OGG data isn't already in memory, read the file
+		oggbuffer = eof_buffer_file(oggfilename, 0);	//Decode the OGG from buffer instead of from file because the latter cannot support special characters in the file path due to limitations with fopen()
+		if(!oggbuffer)
+		{
+			eof_logf(1, "\tPCM cache:  Failed to open input audio file: %s", strerror(errno));
+			return NULL;
+		}
+		oggsize = (int)file_size_ex(oggfilename);
+	}
+
+	oggstruct = alogg_create_ogg_from_buffer(oggbuffer, oggsize);
+	if(oggstruct)
+	{
+		audio = alogg_create_sample_from_ogg(oggstruct);	//Decode OGG into memory
+		if(!audio)
+		{
+			eof_log("\tPCM cache:  ALOGG failed to decode input audio file", 1);
+		}
+		alogg_destroy_ogg(oggstruct);
+	}
+	else
+	{
+		eof_log("\tPCM cache:  ALOGG failed to open input audio file", 1);
+	}
+	if(oggbuffer != oggdata)
+		free(oggbuffer);
+
+	return audio;
+}
+
+EOF_PCM_CACHE_ENTRY *eof_pcm_cache_acquire(const char *oggfilename)
+{
+	if(oggfilename && eof_music_data && !ustricmp(oggfilename, eof_loaded_ogg_name))
+	{	//If this is the loaded chart audio, decode it from its memory buffered copy
+		return eof_pcm_cache_acquire_buffer(oggfilename, eof_music_data, eof_music_data_size);
+	}
+
+	return eof_pcm_cache_acquire_buffer(oggfilename, NULL, 0);
+}
+
+EOF_PCM_CACHE_ENTRY *eof_pcm_cache_acquire_buffer(const char *oggfilename, void *oggdata, int oggsize)
+{
+	EOF_PCM_CACHE_ENTRY *entry = NULL;
+	double starttime;
+
+	if(!oggfilename)
+		return NULL;	//Invalid parameter
+
+	(void) pthread_mutex_lock(&eof_pcm_cache_mutex);
+	if(eof_pcm_cache && !ustricmp(eof_pcm_cache->filename, oggfilename))
+	{	//If this audio file is already decoded
+		entry = eof_pcm_cache;
+		entry->refcount++;
+		(void) pthread_mutex_unlock(&eof_pcm_cache_mutex);
+		return entry;
+	}
+	(void) pthread_mutex_unlock(&eof_pcm_cache_mutex);
+
+	//Otherwise decode it without holding the lock, so other threads aren't blocked for the duration of the decode
+	entry = malloc(sizeof(EOF_PCM_CACHE_ENTRY));
+	if(!entry)
+		return NULL;
+	starttime = eof_get_wall_time();
+	entry->audio = eof_pcm_cache_decode(oggfilename, oggdata, oggsize);
+	if(!entry->audio)
+	{
+		free(entry);
+		return NULL;
+	}
+	(void) ustrncpy(entry->filename, oggfilename, (int)sizeof(entry->filename) - 1);
+	entry->refcount = 1;
+	entry->retained = oggdata ? 1 : 0;
+	eof_logf(1, "\tPCM cache:  Decoded \"%s\" in %f seconds", oggfilename, eof_get_wall_time() - starttime);
+
+	//Publish the decoded audio, replacing the cached audio
+	(void) pthread_mutex_lock(&eof_pcm_cache_mutex);
+	if(eof_pcm_cache && !ustricmp(eof_pcm_cache->filename, oggfilename))
+	{	//If another thread decoded and published the same file in the meantime, use its copy
+		eof_pcm_cache_destroy_entry(entry);
+		entry = eof_pcm_cache;
+		entry->refcount++;
+	}
+	else
+	{
+		if(eof_pcm_cache && !eof_pcm_cache->refcount)
+		{	//If the previously cached audio isn't in use
+			eof_pcm_cache_destroy_entry(eof_pcm_cache);
+		}
+		eof_pcm_cache = entry;	//If it was in use, it will be destroyed when it is released
+	}
+	(void) pthread_mutex_unlock(&eof_pcm_cache_mutex);
+
+	return entry;
+}
+
+void eof_pcm_cache_release(EOF_PCM_CACHE_ENTRY *entry)
+{
+	if(!entry)
+		return;	//Invalid parameter
+
+	(void) pthread_mutex_lock(&eof_pcm_cache_mutex);
+	if(entry->refcount)
+		entry->refcount--;
+	if(!entry->refcount)
+	{	//If this was the entry's last consumer
+		if(entry != eof_pcm_cache)
+		{	//If this entry was flushed or replaced while it was in use
+			eof_pcm_cache_destroy_entry(entry);
+		}
+		else if(!entry->retained)
+		{	//If this entry wasn't decoded from the chart audio, don't keep it resident
+			eof_pcm_cache_destroy_entry(entry);
+			eof_pcm_cache = NULL;
+		}
+	}
+	(void) pthread_mutex_unlock(&eof_pcm_cache_mutex);
+}
+
+void eof_pcm_cache_flush(void)
+{
+	(void) pthread_mutex_lock(&eof_pcm_cache_mutex);
+	if(eof_pcm_cache)
+	{
+		if(!eof_pcm_cache->refcount)
+		{	//If the cached audio isn't in use
+			eof_pcm_cache_destroy_entry(eof_pcm_cache);
+		}
+		eof_pcm_cache = NULL;	//Otherwise it will be destroyed when it is released
+	}
+	(void) pthread_mutex_unlock(&eof_pcm_cache_mutex);
+}
@@ -0,0 +1,33 @@
+#ifndef EOF_PCM_H
+#define EOF_PCM_H
+
+#include <allegro.h>
+
+typedef struct
+{
+	char filename[1024];	//The path of the audio file this PCM data was decoded from
+	SAMPLE *audio;			//The decoded audio (16 bit unsigned samples, interleaved if stereo)
+	unsigned long refcount;	//The number of consumers currently using this entry
+	char retained;			//Nonzero if the entry is the chart audio, which stays cached after its last consumer releases it
+} EOF_PCM_CACHE_ENTRY;
+
+EOF_PCM_CACHE_ENTRY *eof_pcm_cache_acquire(const char *oggfilename);
+	//Returns the decoded PCM data for the specified OGG file, decoding it only if it isn't already cached
+	//If the file is the loaded chart audio, it is decoded from the memory buffered copy (eof_music_data) instead of being read from disk again
+	//The returned entry's data must not be modified and must be released with eof_pcm_cache_release() when the caller is done with it
+	//This reads eof_music_data, so it must only be called from the main thread.  Worker threads use eof_pcm_cache_acquire_buffer()
+	//Returns NULL on error
+EOF_PCM_CACHE_ENTRY *eof_pcm_cache_acquire_buffer(const char *oggfilename, void *oggdata, int oggsize);
+	//Like eof_pcm_cache_acquire(), but if oggdata isn't NULL, it is the OGG file's contents (oggsize bytes) and is decoded instead of the file
+	//The calling thread doesn't hold the cache lock while it decodes, so other threads can use the cache meanwhile
+	//This may be called from any thread
+void eof_pcm_cache_release(EOF_PCM_CACHE_ENTRY *entry);
+	//Releases a reference obtained from eof_pcm_cache_acquire()
+	//The chart audio's PCM data (decoded from a memory buffer) is kept so the waveform graph, spectrogram, BPM detection and
+	//Rocksmith WAV export share one decode, until eof_pcm_cache_flush() is called when the chart audio is unloaded or
+	//a different audio file is acquired.  PCM data decoded from a file on disk is destroyed when its last consumer releases it
+void eof_pcm_cache_flush(void);
+	//Discards the cached PCM data, such as when the chart audio is unloaded or altered
+	//Data still in use by a consumer is destroyed when that consumer releases it
+
+#endif
@@ -158,10 +158,9 @@ void eof_music_play(char resumelastspeed)
 		}
 		else
 		{
-			allegro_message("Can't play song!");
+			eof_message("Can't play song!");
 			eof_music_paused = 1;
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tPlayback failed (error %d)", ret);
-			eof_log(eof_log_string, 3);
+			eof_logf(3, "\t\tPlayback failed (error %d)", ret);
 		}
 	}
 	else
@@ -202,7 +201,7 @@ void eof_catalog_play(void)
 			}
 			else
 			{
-				allegro_message("Can't play song!");
+				eof_message("Can't play song!");
 			}
 		}
 	}
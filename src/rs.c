@@ -175,12 +175,135 @@ int eof_tflag_is_arpeggio(unsigned long tflag)
 	return 0;
 }
 
+#define EOF_RS_CHORD_MATCH_FINGERLESS 1	//Chords only match if both or neither export without fingering
+#define EOF_RS_CHORD_MATCH_ARPEGGIO   2	//Chords only match if both or neither are in an arpeggio (as opposed to a handshape)
+#define EOF_RS_CHORD_TABLE_END ((unsigned long)-1)
+
+typedef struct
+{
+	unsigned long *note;	//The note number of each entry, an array provided by the caller
+	unsigned long *next;	//For each entry, the previously added entry in the same hash bucket, or EOF_RS_CHORD_TABLE_END
+	unsigned long *bucket;	//For each hash bucket, the most recently added entry, or EOF_RS_CHORD_TABLE_END.  If NULL, entries are searched linearly
+	unsigned long entries, buckets;	//buckets is a power of two
+} EOF_RS_CHORD_TABLE;
+	//Indexes chords by the same properties that decide whether two chords share a Rocksmith chord template (strings, frets, fingering and name)
+
+static unsigned long eof_rs_chord_hash(EOF_PRO_GUITAR_NOTE *np)
+{
+	unsigned long ctr, bitmask, hash = 2166136261UL;	//FNV-1a
+	const char *name;
+
+	hash = ((hash ^ (np->note & 0xFF)) * 16777619UL) & 0xFFFFFFFFUL;
+	for(ctr = 0, bitmask = 1; ctr < 6; ctr++, bitmask <<= 1)
+	{	//For each of the 6 supported strings
+		if(np->note & bitmask)
+		{	//If this string is used, hash its fret value (masking out the mute status, which eof_pro_guitar_note_compare() ignores) and its finger
+			hash = ((hash ^ (np->frets[ctr] & 0x7F)) * 16777619UL) & 0xFFFFFFFFUL;
+			hash = ((hash ^ np->finger[ctr]) * 16777619UL) & 0xFFFFFFFFUL;
+		}
+	}
+	for(name = np->name; *name != '\0'; name++)
+	{	//For each character in the chord name
+		hash = ((hash ^ (unsigned char)*name) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+
+	return hash;
+}
+
+static int eof_rs_chord_matches(EOF_PRO_GUITAR_TRACK *tp, unsigned long note1, unsigned long note2, int criteria)
+{
+	if(eof_pro_guitar_note_compare(tp, note1, tp, note2, 0))
+		return 0;	//The notes don't use the same strings and frets
+	if(eof_pro_guitar_note_compare_fingerings(tp->note[note1], tp->note[note2]))
+		return 0;	//The notes don't have identical fingering
+	if(strcmp(tp->note[note1]->name, tp->note[note2]->name))
+		return 0;	//The chord names don't match
+	if((criteria & EOF_RS_CHORD_MATCH_FINGERLESS) && (eof_note_exports_without_fingering(tp, note1) != eof_note_exports_without_fingering(tp, note2)))
+		return 0;	//One chord will export with fingering and the other without fingering
+	if((criteria & EOF_RS_CHORD_MATCH_ARPEGGIO) && (eof_tflag_is_arpeggio(tp->note[note1]->tflags) != eof_tflag_is_arpeggio(tp->note[note2]->tflags)))
+		return 0;	//The arpeggio statuses don't match
+
+	return 1;
+}
+
+static void eof_rs_chord_table_init(EOF_RS_CHORD_TABLE *table, unsigned long *list, unsigned long capacity)
+{
+	unsigned long ctr;
+
+	table->note = list;
+	table->entries = 0;
+	for(table->buckets = 16; table->buckets < capacity; table->buckets <<= 1);	//Use at least one bucket per entry
+	table->bucket = malloc(sizeof(unsigned long) * table->buckets);
+	table->next = malloc(sizeof(unsigned long) * (capacity + 1));
+	if(!table->bucket || !table->next)
+	{	//If the hash table couldn't be allocated, entries will be searched linearly
+		free(table->bucket);
+		free(table->next);
+		table->bucket = NULL;
+		table->next = NULL;
+		return;
+	}
+	for(ctr = 0; ctr < table->buckets; ctr++)
+	{
+		table->bucket[ctr] = EOF_RS_CHORD_TABLE_END;
+	}
+}
+
+static void eof_rs_chord_table_free(EOF_RS_CHORD_TABLE *table)
+{
+	free(table->bucket);
+	free(table->next);
+	table->bucket = NULL;
+	table->next = NULL;
+	table->entries = 0;
+}
+
+static void eof_rs_chord_table_add(EOF_RS_CHORD_TABLE *table, EOF_PRO_GUITAR_TRACK *tp, unsigned long note)
+{
+	unsigned long hash;
+
+	table->note[table->entries] = note;
+	if(table->bucket)
+	{	//If the hash table is in use, link the entry into its bucket
+		hash = eof_rs_chord_hash(tp->note[note]) & (table->buckets - 1);
+		table->next[table->entries] = table->bucket[hash];
+		table->bucket[hash] = table->entries;
+	}
+	table->entries++;
+}
+
+static unsigned long eof_rs_chord_table_find(EOF_RS_CHORD_TABLE *table, EOF_PRO_GUITAR_TRACK *tp, unsigned long note, int criteria)
+{
+	unsigned long ctr, found = table->entries;
+
+	if(!table->bucket)
+	{	//If the hash table isn't in use
+		for(ctr = 0; ctr < table->entries; ctr++)
+		{	//For each entry
+			if(eof_rs_chord_matches(tp, note, table->note[ctr], criteria))
+				return ctr;
+		}
+		return table->entries;	//No match
+	}
+	for(ctr = table->bucket[eof_rs_chord_hash(tp->note[note]) & (table->buckets - 1)]; ctr != EOF_RS_CHORD_TABLE_END; ctr = table->next[ctr])
+	{	//For each entry in the note's hash bucket (newest first)
+		if(eof_rs_chord_matches(tp, note, table->note[ctr], criteria))
+		{	//If the entry matches, keep looking for an older one so the lowest matching entry number is returned, as a linear search would
+			found = ctr;
+		}
+	}
+
+	return found;
+}
+
 unsigned long eof_build_chord_list(EOF_SONG *sp, unsigned long track, unsigned long **results, char target)
 {
-	unsigned long ctr, ctr2, unique_count = 0;
+	unsigned long ctr, ctr2, note, unique_count = 0, *templates;
 	EOF_PRO_GUITAR_NOTE **notelist;	//An array large enough to hold a pointer to every note in the track
 	EOF_PRO_GUITAR_TRACK *tp;
-	char match;
+	EOF_RS_CHORD_TABLE table;	//The chords that follow the note being examined, one entry per distinct chord template
+	char match, ischord, searched, found;
+	int criteria = EOF_RS_CHORD_MATCH_FINGERLESS;
 
 	eof_log("eof_rs_build_chord_list() entered", 1);
 
@@ -194,66 +317,71 @@ unsigned long eof_build_chord_list(EOF_SONG *sp, unsigned long track, unsigned l
 	}
 
 	target |= 4;	//Allow ghosted notes to be counted for chords, since this is required for arpeggios
+	if(target & 2)
+	{	//If the target is Rocksmith 2, chords in arpeggios and chords outside of them use separate chord templates
+		criteria |= EOF_RS_CHORD_MATCH_ARPEGGIO;
+	}
 
 	//Duplicate the track's note array
-	notelist = malloc(sizeof(EOF_PRO_GUITAR_NOTE *) * EOF_MAX_NOTES);	//Allocate memory to duplicate the note[] array
-	if(!notelist)
+	tp = sp->pro_guitar_track[sp->track[track]->tracknum];
+	notelist = malloc(sizeof(EOF_PRO_GUITAR_NOTE *) * (tp->notes + 1));	//Allocate memory to duplicate the note[] array
+	templates = malloc(sizeof(unsigned long) * (tp->notes + 1));	//Allocate memory for the note numbers in the chord table
+	if(!notelist || !templates)
 	{
+		free(notelist);
+		free(templates);
 		*results = NULL;
 		return 0;	//Return error
 	}
-	tp = sp->pro_guitar_track[sp->track[track]->tracknum];
-	memcpy(notelist, tp->note, sizeof(EOF_PRO_GUITAR_NOTE *) * EOF_MAX_NOTES);	//Copy the note array
+	memcpy(notelist, tp->note, sizeof(EOF_PRO_GUITAR_NOTE *) * tp->notes);	//Copy the note array
+	eof_rs_chord_table_init(&table, templates, tp->notes);
 
 	//Overwrite each pointer in the duplicate note array that isn't a unique chord with NULL
-	for(ctr = 0; ctr < tp->notes; ctr++)
-	{	//For each note in the track
-		match = 0;
-		if(eof_note_count_rs_lanes(sp, track, ctr, target) > 1)
+	//A chord that matches a later chord is dropped in favor of it, so the notes are examined in reverse order
+	//and each is looked up among the chords that follow it instead of being compared against each of them
+	for(ctr = tp->notes; ctr > 0; ctr--)
+	{	//For each note in the track, in reverse order
+		note = ctr - 1;
+		match = searched = found = 0;
+		ischord = (eof_note_count_rs_lanes(sp, track, note, target) > 1) ? 1 : 0;
+		if(ischord)
 		{	//If this note is a valid chord based on the target
-			if((tp->note[ctr]->tflags & EOF_NOTE_TFLAG_ARP) && !(tp->note[ctr]->tflags & EOF_NOTE_TFLAG_ARP_FIRST) && (tp->note[ctr]->flags & EOF_PRO_GUITAR_NOTE_FLAG_SPLIT))
+			if((tp->note[note]->tflags & EOF_NOTE_TFLAG_ARP) && !(tp->note[note]->tflags & EOF_NOTE_TFLAG_ARP_FIRST) && (tp->note[note]->flags & EOF_PRO_GUITAR_NOTE_FLAG_SPLIT))
 			{	//If this chord is in an arpeggio/handshape phrase but isn't the first one in the phrase, and it is split, it will not export with a chord tag or handshape tag
-				notelist[ctr] = NULL;	//Eliminate this note from the list
+				notelist[note] = NULL;	//Eliminate this note from the list
 				match = 1;				//Note that this chord will not be retained in the list
 			}
-			else if(!(tp->note[ctr]->tflags & EOF_NOTE_TFLAG_IGNORE) || (tp->note[ctr]->tflags & EOF_NOTE_TFLAG_ARP) || (tp->note[ctr]->tflags & EOF_NOTE_TFLAG_GHOST_HS))
+			else if(!(tp->note[note]->tflags & EOF_NOTE_TFLAG_IGNORE) || (tp->note[note]->tflags & EOF_NOTE_TFLAG_ARP) || (tp->note[note]->tflags & EOF_NOTE_TFLAG_GHOST_HS))
 			{	//If this note is not ignored, is a chord within an arpeggio/handshape or is a temporary chord created created due to ghost handshape status
-				for(ctr2 = ctr + 1; ctr2 < tp->notes; ctr2++)
-				{	//For each note in the track that follows this note
-					if((eof_note_count_rs_lanes(sp, track, ctr2, target) <= 1) || eof_note_compare_simple(sp, track, ctr, ctr2))
-						continue;	//If the note that follows is not a valid chord for the target Rocksmith game or doesn't match the preceding note, skip it
-					if(eof_pro_guitar_note_compare_fingerings(tp->note[ctr], tp->note[ctr2]))
-						continue;	//If this note does not have identical fingering to the one that follows it, skip it
-					if((tp->note[ctr2]->tflags & EOF_NOTE_TFLAG_IGNORE) && !(tp->note[ctr2]->tflags & EOF_NOTE_TFLAG_GHOST_HS))
-						continue;	//If this note is ignored and if it was not created due to ghost handshape status, skip it
-					if(strcmp(tp->note[ctr]->name, tp->note[ctr2]->name))
-						continue;	//If both notes do not have the same name, skip it
-					if(eof_note_exports_without_fingering(tp, ctr) != eof_note_exports_without_fingering(tp, ctr2))
-						continue;	//If one chord will export with fingering and the other without fingering, skip it
-
-					if(!(target & 2))
-					{	//If the target is Rocksmith 1
-						notelist[ctr] = NULL;	//Eliminate this note from the list
-						match = 1;	//Note that this chord matched one of the others and won't be retained in the list
-						break;
-					}
-					if(eof_tflag_is_arpeggio(tp->note[ctr]->tflags) == eof_tflag_is_arpeggio(tp->note[ctr2]->tflags))
-					{	//If both notes have the same arpeggio status (both are in an arpeggio and not a handshape), or at least one is otherwise
-						notelist[ctr] = NULL;	//Eliminate this note from the list
-						match = 1;	//Note that this chord matched one of the others and won't be retained in the list
-						break;
-					}
+				searched = 1;
+				if(eof_rs_chord_table_find(&table, tp, note, criteria) < table.entries)
+				{	//If this chord matches one that follows it
+					found = 1;
+					notelist[note] = NULL;	//Eliminate this note from the list
+					match = 1;	//Note that this chord matched one of the others and won't be retained in the list
 				}
-			}//If this note is not ignored, is a chord within an arpeggio or is a temporary chord created created due to ghost handshape status
+			}
 			else
 			{
-				notelist[ctr] = NULL;	//Eliminate this note from the list since it's not a unique chord
+				notelist[note] = NULL;	//Eliminate this note from the list since it's not a unique chord
 				match = 1;	//This note will not be retained in the list
 			}
+
+			if(!(tp->note[note]->tflags & EOF_NOTE_TFLAG_IGNORE) || (tp->note[note]->tflags & EOF_NOTE_TFLAG_GHOST_HS))
+			{	//If this note is not ignored or was created due to ghost handshape status, the chords that precede it can match it
+				if(!searched)
+				{
+					found = (eof_rs_chord_table_find(&table, tp, note, criteria) < table.entries) ? 1 : 0;
+				}
+				if(!found)
+				{	//If no matching chord is in the table yet, add this one
+					eof_rs_chord_table_add(&table, tp, note);
+				}
+			}
 		}//If this note is a valid chord based on the target
 		else
 		{	//This not is not a chord
-			notelist[ctr] = NULL;	//Eliminate this note from the list since it's not a chord
+			notelist[note] = NULL;	//Eliminate this note from the list since it's not a chord
 			match = 1;	//This note will not be retained in the list
 		}
 
@@ -262,6 +390,8 @@ unsigned long eof_build_chord_list(EOF_SONG *sp, unsigned long track, unsigned l
 			unique_count++;	//Increment unique chord counter
 		}
 	}//For each note in the track
+	eof_rs_chord_table_free(&table);
+	free(templates);
 
 	if(!unique_count)
 	{	//If there were no chords
@@ -317,24 +447,17 @@ unsigned long eof_build_section_list(EOF_SONG *sp, unsigned long **results, unsi
 		*results = NULL;
 		return 0;	//Return error
 	}
-	memcpy(eventlist, sp->text_event, sizeof(EOF_TEXT_EVENT *) * EOF_MAX_TEXT_EVENTS);	//Copy the event array
+	memset(eventlist, 0, sizeof(EOF_TEXT_EVENT *) * EOF_MAX_TEXT_EVENTS);
 
 	//In the case of beats that contain multiple sections, only keep ones that are cached in the beat statistics
+	//Since only 1 section per beat will be exported, the event array is only populated with the sections the beats use
 	eof_process_beat_statistics(sp, track);	//Rebuild beat stats from the perspective of the track being examined
-	for(ctr = 0; ctr < sp->text_events; ctr++)
-	{	//For each text event in the chart
-		match = 0;
-		for(ctr2 = 0; ctr2 < sp->beats; ctr2++)
-		{	//For each beat in the chart
-			if((sp->beat[ctr2]->contained_section_event >= 0) && ((unsigned long)sp->beat[ctr2]->contained_section_event == ctr))
-			{	//If the beat's statistics indicate this section is used
-				match = 1;	//Note that this section is to be kept
-				break;
-			}
-		}
-		if(!match)
-		{	//If none of the beat stats used this section
-			eventlist[ctr] = NULL;	//Eliminate this section from the list since only 1 section per beat will be exported
+	for(ctr2 = 0; ctr2 < sp->beats; ctr2++)
+	{	//For each beat in the chart
+		if((sp->beat[ctr2]->contained_section_event >= 0) && ((unsigned long)sp->beat[ctr2]->contained_section_event < sp->text_events))
+		{	//If the beat's statistics indicate a section is used
+			ctr = sp->beat[ctr2]->contained_section_event;
+			eventlist[ctr] = sp->text_event[ctr];	//Keep that section
 		}
 	}
 
@@ -445,6 +568,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 	char is_bass = 0;	//Is set to nonzero if the specified track is to be considered a bass guitar track
 	char is_picked_bass = 0;	//Is set to nonzero if the specified track is to be considered a picked bass arrangement
 	unsigned long chordid = 0, handshapectr = 0, handshapeloop;
+	EOF_RS_CHORD_TABLE chordtable = {0};	//Indexes the unique chord list by chord template
 	unsigned long handshapestart = 0, handshapeend = 0;
 	long nextnote;
 	unsigned long originalbeatcount;	//If beats are padded to reach the beginning of the next measure (for DDC), this will track the project's original number of beats
@@ -467,7 +591,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 	{	//If the track being exported uses any frets higher than 22
 		*user_warned |= 2;	//Track that this warning is given, but don't prevent it from prompting for each track, since a crash condition should not be ignored
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  At least one track (\"%s\") uses a fret higher than 22.", sp->track[track]->name);
-		if(alert(eof_log_string, "These will cause Rocksmith 1 to crash.", "Cancel its RS1 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
+		if(eof_alert(eof_log_string, "These will cause Rocksmith 1 to crash.", "Cancel its RS1 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
 		{	//If the user opts to cancel the save
 			eof_hightlight_all_notes_above_fret_number(sp, track, 22);
 			return 2;	//Return user cancellation
@@ -497,7 +621,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 		{	//If the user wasn't alerted about this issue yet
 			eof_seek_and_render_position(track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  At least one note in track \"%s\" slides to or above fret 22.", sp->track[track]->name);
-			if(alert(eof_log_string, "This will cause Rocksmith 1 to crash.", "Cancel its RS1 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(eof_log_string, "This will cause Rocksmith 1 to crash.", "Cancel its RS1 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to cancel the save after the highlighting is performed
 				highlight_bad_slides = 1;
 			}
@@ -537,7 +661,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 		if(bre_populated && ((*user_warned & 1024) == 0))
 		{	//If the BRE difficulty was the only one populated, warn that it is being omitted (unless the user was already warned of this)
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  Track \"%s\" only has notes in the BRE difficulty.\nThese are not exported in Rocksmith format unless you remove the difficulty limit (Track>Rocksmith>Remove difficulty limit).", sp->track[track]->name);
-			allegro_message("%s", eof_log_string);
+			eof_message("%s", eof_log_string);
 			eof_log(eof_log_string, 1);
 			*user_warned |= 1024;
 		}
@@ -652,7 +776,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 		if((*user_warned & 2048) == 0)
 		{	//If the user wasn't warned about this yet
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  This track (%s) uses a tuning that isn't known to be supported in Rocksmith 1.  Tuning and note recognition may not work as expected in-game", sp->track[track]->name);
-			allegro_message("Warning:  This track (%s) uses a tuning that isn't one known to be supported in Rocksmith 1.\nTuning and note recognition may not work as expected in-game", sp->track[track]->name);
+			eof_message("Warning:  This track (%s) uses a tuning that isn't one known to be supported in Rocksmith 1.\nTuning and note recognition may not work as expected in-game", sp->track[track]->name);
 			eof_log(eof_log_string, 1);
 			*user_warned |= 2048;
 		}
@@ -859,6 +983,14 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 
 	//Write chord templates
 	chordlistsize = eof_build_chord_list(sp, track, &chordlist, 1);	//Build a list of all unique chords in the track
+	if(chordlistsize)
+	{	//If there were chords, index them so each chord's template can be looked up without comparing it to every entry in the list
+		eof_rs_chord_table_init(&chordtable, chordlist, chordlistsize);
+		for(ctr = 0; ctr < chordlistsize; ctr++)
+		{	//For each unique chord
+			eof_rs_chord_table_add(&chordtable, tp, chordlist[ctr]);
+		}
+	}
 	if(!chordlistsize)
 	{	//If there were no chords, write an empty chord template tag
 		(void) pack_fputs("  <chordTemplates count=\"0\"/>\n", fp);
@@ -873,7 +1005,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 		char finger0def[2] = "0", finger1def[2] = "1", finger2def[2] = "2", finger3def[2] = "3", finger4def[2] = "4", finger5def[2] = "5";	//Static strings for building manually-defined finger information
 		char *fingerdef[6];
 		unsigned long shapenum = 0;
-		EOF_PRO_GUITAR_NOTE temp = {{0}, 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};	//Will have a matching chord shape definition's fingering applied to
+		EOF_PRO_GUITAR_NOTE temp = {"", 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};	//Will have a matching chord shape definition's fingering applied to
 		unsigned char *effective_fingering;	//Will point to either a note's own finger array or one of that of the temp pro guitar note structure above
 
 		fret[0] = &fret0;	//Allow the fret numbers to be accessed via array
@@ -1020,6 +1152,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 			if(chordlist)
 			{	//If the chord list was built
 				free(chordlist);
+				eof_rs_chord_table_free(&chordtable);
 			}
 			(void) pack_fclose(fp);
 			return 0;	//Return failure
@@ -1047,6 +1180,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 				if(chordlist)
 				{	//If the chord list was built
 					free(chordlist);
+					eof_rs_chord_table_free(&chordtable);
 				}
 				(void) pack_fclose(fp);
 				return 0;	//Return failure
@@ -1072,6 +1206,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 				if(chordlist)
 				{	//If the chord list was built
 					free(chordlist);
+					eof_rs_chord_table_free(&chordtable);
 				}
 				(void) pack_fclose(fp);
 				return 0;	//Return failure
@@ -1099,6 +1234,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 				if(chordlist)
 				{	//If the chord list was built
 					free(chordlist);
+					eof_rs_chord_table_free(&chordtable);
 				}
 				(void) pack_fclose(fp);
 				return 0;	//Return failure
@@ -1163,7 +1299,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 	}
 	else
 	{
-		allegro_message("Error:  Default RS sections that were added are missing.  Skipping writing the <sections> tag.");
+		eof_message("Error:  Default RS sections that were added are missing.  Skipping writing the <sections> tag.");
 		eof_log("Error:  Default RS sections that were added are missing.  Skipping writing the <sections> tag.", 1);
 	}
 
@@ -1268,7 +1404,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 							if((*user_warned & 4) == 0)
 							{	//If the user wasn't alerted that one or more open notes have these statuses improperly applied
 								eof_seek_and_render_position(track, eof_get_note_type(sp, track, ctr3), eof_get_note_pos(sp, track, ctr3));
-								allegro_message("Warning:  At least one open note is marked with bend or slide status.\nThis is not supported, so these statuses are being omitted for such notes.");
+								eof_message("Warning:  At least one open note is marked with bend or slide status.\nThis is not supported, so these statuses are being omitted for such notes.");
 								*user_warned |= 4;
 							}
 						}
@@ -1301,32 +1437,17 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 				if((eof_get_note_type(sp, track, ctr3) != ctr) || (eof_note_count_rs_lanes(sp, track, ctr3, 1) <= 1))
 					continue;	//If this note is not in this difficulty or will not export as a chord (at least two non ghosted/muted gems), skip it
 
-				for(ctr4 = 0; ctr4 < chordlistsize; ctr4++)
-				{	//For each of the entries in the unique chord list
-					assert(chordlist != NULL);	//Unneeded check to resolve a false positive in Splint
-					if(!eof_note_compare_simple(sp, track, ctr3, chordlist[ctr4]))
-					{	//If this note matches a chord list entry
-						if(!eof_pro_guitar_note_compare_fingerings(tp->note[ctr3], tp->note[chordlist[ctr4]]))
-						{	//If this note has identical fingering to chord list entry
-							if(eof_note_exports_without_fingering(tp, ctr3) == eof_note_exports_without_fingering(tp, chordlist[ctr4]))
-							{	//If this note and the chord list entry either both export with fingering or both export without fingering
-								if(!strcmp(tp->note[ctr3]->name, tp->note[chordlist[ctr4]]->name))
-								{	//If the chord names match
-									chordid = ctr4;	//Store the chord list entry number
-									break;
-								}
-							}
-						}
-					}
-				}
+				ctr4 = eof_rs_chord_table_find(&chordtable, tp, ctr3, EOF_RS_CHORD_MATCH_FINGERLESS);	//Find the entry in the unique chord list that this chord matches
+				chordid = ctr4;	//Store the chord list entry number
 				if(ctr4 >= chordlistsize)
 				{	//If the chord couldn't be found
 					eof_seek_and_render_position(track, tp->note[ctr3]->type, tp->note[ctr3]->pos);
-					allegro_message("Error:  Couldn't match chord with chord template while exporting chords.  Aborting Rocksmith 1 export.");
+					eof_message("Error:  Couldn't match chord with chord template while exporting chords.  Aborting Rocksmith 1 export.");
 					eof_log("Error:  Couldn't match chord with chord template while exporting chords.  Aborting Rocksmith 1 export.", 1);
 					if(chordlist)
 					{	//If the chord list was built
 						free(chordlist);
+						eof_rs_chord_table_free(&chordtable);
 					}
 					eof_rs_export_cleanup(sp, track);
 					eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -1370,7 +1491,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 			{	//Don't warn about missing FHPs in bass arrangements if user disabled that preference
 				if((*user_warned & 1) == 0)
 				{	//If the user wasn't alerted that one or more track difficulties have no fret hand positions defined
-					allegro_message("Warning (RS):  At least one track difficulty (including one in \"%s\") has no fret hand positions defined.  They will be created automatically.", sp->track[track]->name);
+					eof_message("Warning (RS):  At least one track difficulty (including one in \"%s\") has no fret hand positions defined.  They will be created automatically.", sp->track[track]->name);
 					*user_warned |= 1;
 				}
 			}
@@ -1403,7 +1524,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 		else
 		{	//There are no anchors in this difficulty, write an empty anchors tag
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error:  Failed to automatically generate fret hand positions for level %lu of\n\"%s\" during RS1 export.", ctr2, fn);
-			allegro_message("%s", eof_log_string);
+			eof_message("%s", eof_log_string);
 			eof_log(eof_log_string, 1);
 			(void) pack_fputs("      <anchors count=\"0\"/>\n", fp);
 		}
@@ -1442,29 +1563,17 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 					continue;	//If this note will neither export as a chord (at least two non ghosted/muted gems) nor an arpeggio/handshape (at least two non muted notes), skip it
 
 				//Find this chord's ID
-				for(ctr4 = 0; ctr4 < chordlistsize; ctr4++)
-				{	//For each of the entries in the unique chord list
-					assert(chordlist != NULL);	//Unneeded check to resolve a false positive in Splint
-					if(!eof_note_compare_simple(sp, track, ctr3, chordlist[ctr4]))
-					{	//If this note matches a chord list entry
-						if(!eof_pro_guitar_note_compare_fingerings(tp->note[ctr3], tp->note[chordlist[ctr4]]))
-						{	//If this note has identical fingering to chord list entry
-							if(!strcmp(tp->note[ctr3]->name, tp->note[chordlist[ctr4]]->name))
-							{	//If the chord names match
-								chordid = ctr4;	//Store the chord list entry number
-								break;
-							}
-						}
-					}
-				}
+				ctr4 = eof_rs_chord_table_find(&chordtable, tp, ctr3, 0);	//Find the entry in the unique chord list that this chord matches
+				chordid = ctr4;	//Store the chord list entry number
 				if(ctr4 >= chordlistsize)
 				{	//If the chord couldn't be found
 					eof_seek_and_render_position(track, tp->note[ctr3]->type, tp->note[ctr3]->pos);
-					allegro_message("Error:  Couldn't match chord with chord template while writing handshapes.  Aborting Rocksmith 1 export.");
+					eof_message("Error:  Couldn't match chord with chord template while writing handshapes.  Aborting Rocksmith 1 export.");
 					eof_log("Error:  Couldn't match chord with chord template while writing handshapes.  Aborting Rocksmith 1 export.", 1);
 					if(chordlist)
 					{	//If the chord list was built
 						free(chordlist);
+						eof_rs_chord_table_free(&chordtable);
 					}
 					eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added
 					eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -1541,6 +1650,7 @@ int eof_export_rocksmith_1_track(EOF_SONG * sp, char * fn, unsigned long track,
 	if(chordlist)
 	{	//If the chord list was built
 		free(chordlist);
+		eof_rs_chord_table_free(&chordtable);
 	}
 	//Remove all temporary text events that were added
 	for(ctr = sp->text_events; ctr > 0; ctr--)
@@ -1579,6 +1689,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 	int is_lead = 0, is_rhythm = 0, is_bass = 0;	//Is set to nonzero if the specified track is to be considered any of these arrangement types
 	char is_picked_bass = 0;	//Is set to nonzero if the specified track is to be considered a picked bass arrangement
 	unsigned long chordid = 0, handshapectr = 0;
+	EOF_RS_CHORD_TABLE chordtable = {0};	//Indexes the unique chord list by chord template
 	unsigned long handshapestart = 0, handshapeend = 0;
 	long nextnote, prevnote;
 	unsigned long originalbeatcount;	//If beats are padded to reach the beginning of the next measure (for DDC), this will track the project's original number of beats
@@ -1607,7 +1718,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 		{	//If the user wasn't alerted about this issue yet
 			*user_warned |= 256;
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  At least one track (\"%s\") uses a fret higher than 24.", sp->track[track]->name);
-			if(alert(eof_log_string, "These won't display correctly in Rocksmith 2.", "Cancel its RS2 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(eof_log_string, "These won't display correctly in Rocksmith 2.", "Cancel its RS2 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to cancel the save
 				eof_hightlight_all_notes_above_fret_number(sp, track, 24 - tp->capo);
 				return 2;	//Return user cancellation
@@ -1636,7 +1747,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 		{	//If the user wasn't alerted about this issue yet
 			eof_seek_and_render_position(track, tp->note[ctr]->type, tp->note[ctr]->pos);	//Show the offending note
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  At least one note in track \"%s\" slides to or above fret 25.", sp->track[track]->name);
-			if(alert(eof_log_string, "This could cause Rocksmith 2 to crash.", "Cancel its RS2 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(eof_log_string, "This could cause Rocksmith 2 to crash.", "Cancel its RS2 export and highlight offending notes?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to cancel the save after the highlighting is performed
 				highlight_bad_slides = 1;
 			}
@@ -1678,7 +1789,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 		if(bre_populated && ((*user_warned & 1024) == 0))
 		{	//If the BRE difficulty was the only one populated, warn that it is being omitted (unless the user was already warned of this)
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Warning:  Track \"%s\" only has notes in the BRE difficulty.\nThese are not exported in Rocksmith format unless you remove the difficulty limit (Track>Rocksmith>Remove difficulty limit).", sp->track[track]->name);
-			allegro_message("%s", eof_log_string);
+			eof_message("%s", eof_log_string);
 			eof_log(eof_log_string, 1);
 			*user_warned |= 1024;
 		}
@@ -2029,7 +2140,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 			}
 			else
 			{
-				allegro_message("Error:  Couldn't expand linked chords into single notes.  Aborting Rocksmith 2 export.");
+				eof_message("Error:  Couldn't expand linked chords into single notes.  Aborting Rocksmith 2 export.");
 				eof_log("Error:  Couldn't expand linked chords into single notes.  Aborting Rocksmith 2 export.", 1);
 				eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 				eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -2074,7 +2185,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 			}
 			else
 			{
-				allegro_message("Error:  Couldn't expand a split status chord into single notes.  Aborting Rocksmith 2 export.");
+				eof_message("Error:  Couldn't expand a split status chord into single notes.  Aborting Rocksmith 2 export.");
 				eof_log("Error:  Couldn't expand a split status chord into single notes.  Aborting Rocksmith 2 export.", 1);
 				eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 				eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -2179,7 +2290,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 			}
 			else
 			{
-				allegro_message("Error:  Couldn't expand a chordify status chord into single notes.  Aborting Rocksmith 2 export.");
+				eof_message("Error:  Couldn't expand a chordify status chord into single notes.  Aborting Rocksmith 2 export.");
 				eof_log("Error:  Couldn't expand a chordify status chord into single notes.  Aborting Rocksmith 2 export.", 1);
 				eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 				eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -2299,7 +2410,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 				}
 				else
 				{
-					allegro_message("Error:  Couldn't expand an arpeggio chord into single notes.  Aborting Rocksmith 2 export.");
+					eof_message("Error:  Couldn't expand an arpeggio chord into single notes.  Aborting Rocksmith 2 export.");
 					eof_log("Error:  Couldn't expand an arpeggio chord into single notes.  Aborting Rocksmith 2 export.", 1);
 					eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 					eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -2377,7 +2488,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 		}
 		if(failed)
 		{
-			allegro_message("Error:  Couldn't expand a non arpeggio partially ghosted chord into non ghosted chord(s).  Aborting Rocksmith 2 export.");
+			eof_message("Error:  Couldn't expand a non arpeggio partially ghosted chord into non ghosted chord(s).  Aborting Rocksmith 2 export.");
 			eof_log("Error:  Couldn't expand a non arpeggio partially ghosted chord into non ghosted chord(s).  Aborting Rocksmith 2 export.", 1);
 			eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 			eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -2390,6 +2501,14 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 
 	//Write chord templates
 	chordlistsize = eof_build_chord_list(sp, track, &chordlist, 2);	//Build a list of all unique chords in the track
+	if(chordlistsize)
+	{	//If there were chords, index them so each chord's template can be looked up without comparing it to every entry in the list
+		eof_rs_chord_table_init(&chordtable, chordlist, chordlistsize);
+		for(ctr = 0; ctr < chordlistsize; ctr++)
+		{	//For each unique chord
+			eof_rs_chord_table_add(&chordtable, tp, chordlist[ctr]);
+		}
+	}
 	if(!chordlistsize)
 	{	//If there were no chords, write an empty chord template tag
 		(void) pack_fputs("  <chordTemplates count=\"0\"/>\n", fp);
@@ -2399,7 +2518,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 		long fret[6] = {0};		//Will store the fret number played on each string (-1 means the string is not played)
 		long finger[6] = {0};	//Will store the finger number used to play each string (-1 means unused/undefined)
 		unsigned long shapenum = 0;
-		EOF_PRO_GUITAR_NOTE temp = {{0}, 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};	//Will have a matching chord shape definition's fingering applied to
+		EOF_PRO_GUITAR_NOTE temp = {"", 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};	//Will have a matching chord shape definition's fingering applied to
 		unsigned char *effective_fingering;	//Will point to either a note's own finger array or one of that of the temp pro guitar note structure above
 		char arp[] = "-arp", no_arp[] = "";	//The suffix applied to the chord template's display name, depending on whether the template is for an arpeggio
 		char *suffix;	//Will point to either arp[] or no_arp[]
@@ -2647,7 +2766,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 	}
 	else
 	{
-		allegro_message("Error:  Default RS sections that were added are missing.  Skipping writing the <sections> tag.");
+		eof_message("Error:  Default RS sections that were added are missing.  Skipping writing the <sections> tag.");
 		eof_log("Error:  Default RS sections that were added are missing.  Skipping writing the <sections> tag.", 1);
 	}
 
@@ -2815,32 +2934,17 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 				if((tp->note[ctr3]->tflags & EOF_NOTE_TFLAG_IGNORE) && !(tp->note[ctr3]->tflags & EOF_NOTE_TFLAG_COMBINE))
 					continue;	//If this chord is being ignored (was split into single notes or converted into a non ghosted chord) and isn't marked for combination, skip it
 
-				for(ctr4 = 0; ctr4 < chordlistsize; ctr4++)
-				{	//For each of the entries in the unique chord list
-					assert(chordlist != NULL);	//Unneeded check to resolve a false positive in Splint
-					if(!eof_note_compare_simple(sp, track, ctr3, chordlist[ctr4]))
-					{	//If this note matches a chord list entry
-						if(!eof_pro_guitar_note_compare_fingerings(tp->note[ctr3], tp->note[chordlist[ctr4]]))
-						{	//If this note has identical fingering to chord list entry
-							if(eof_note_exports_without_fingering(tp, ctr3) == eof_note_exports_without_fingering(tp, chordlist[ctr4]))
-							{	//If this note and the chord list entry either both export with fingering or both export without fingering
-								if(!strcmp(tp->note[ctr3]->name, tp->note[chordlist[ctr4]]->name))
-								{	//If the chord names match
-									chordid = ctr4;	//Store the chord list entry number
-									break;
-								}
-							}
-						}
-					}
-				}
+				ctr4 = eof_rs_chord_table_find(&chordtable, tp, ctr3, EOF_RS_CHORD_MATCH_FINGERLESS);	//Find the entry in the unique chord list that this chord matches
+				chordid = ctr4;	//Store the chord list entry number
 				if(ctr4 >= chordlistsize)
 				{	//If the chord couldn't be found
 					eof_seek_and_render_position(track, tp->note[ctr3]->type, tp->note[ctr3]->pos);
-					allegro_message("Error:  Couldn't match chord with chord template while exporting chords.  Aborting Rocksmith 2 export.");
+					eof_message("Error:  Couldn't match chord with chord template while exporting chords.  Aborting Rocksmith 2 export.");
 					eof_log("Error:  Couldn't match chord with chord template while exporting chords.  Aborting Rocksmith 2 export.", 1);
 					if(chordlist)
 					{	//If the chord list was built
 						free(chordlist);
+						eof_rs_chord_table_free(&chordtable);
 					}
 					eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 					eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -2960,7 +3064,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 			{	//Don't warn about missing FHPs in bass arrangements if user disabled that preference
 				if((*user_warned & 1) == 0)
 				{	//If the user wasn't alerted that one or more track difficulties have no fret hand positions defined
-					allegro_message("Warning (RS):  At least one track difficulty (including one in \"%s\") has no fret hand positions defined.  They will be created automatically.", sp->track[track]->name);
+					eof_message("Warning (RS):  At least one track difficulty (including one in \"%s\") has no fret hand positions defined.  They will be created automatically.", sp->track[track]->name);
 					*user_warned |= 1;
 				}
 			}
@@ -3009,7 +3113,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 		else
 		{	//There are no anchors in this difficulty, write an empty anchors tag
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error:  Failed to automatically generate fret hand positions for level %lu of\n\"%s\" during RS2 export.", ctr2, fn);
-			allegro_message("%s", eof_log_string);
+			eof_message("%s", eof_log_string);
 			eof_log(eof_log_string, 1);
 			(void) pack_fputs("      <anchors count=\"0\"/>\n", fp);
 		}
@@ -3063,32 +3167,17 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 						}
 					}
 				}
-				for(ctr4 = 0; ctr4 < chordlistsize; ctr4++)
-				{	//For each of the entries in the unique chord list
-					assert(chordlist != NULL);	//Unneeded check to resolve a false positive in Splint
-					if(!eof_note_compare_simple(sp, track, sourcenote, chordlist[ctr4]))
-					{	//If this note matches a chord list entry
-						if(!eof_pro_guitar_note_compare_fingerings(tp->note[sourcenote], tp->note[chordlist[ctr4]]))
-						{	//If this note has identical fingering to chord list entry
-							if(!strcmp(tp->note[sourcenote]->name, tp->note[chordlist[ctr4]]->name))
-							{	//If the chord names match
-								if(eof_tflag_is_arpeggio(tp->note[sourcenote]->tflags) == eof_tflag_is_arpeggio(tp->note[chordlist[ctr4]]->tflags))
-								{	//If this note's arpeggio status (is in an arpeggio and not a handshape, or in no arpeggio/handshape at all) is the same as that of the chord list entry
-									chordid = ctr4;	//Store the chord list entry number
-									break;
-								}
-							}
-						}
-					}
-				}
+				ctr4 = eof_rs_chord_table_find(&chordtable, tp, sourcenote, EOF_RS_CHORD_MATCH_ARPEGGIO);	//Find the entry in the unique chord list that this chord matches
+				chordid = ctr4;	//Store the chord list entry number
 				if((ctr4 >= chordlistsize) || (chordid >= chordlistsize))
 				{	//If the chord couldn't be found
 					eof_seek_and_render_position(track, tp->note[ctr3]->type, tp->note[ctr3]->pos);
-					allegro_message("Error:  Couldn't match chord with chord template while writing handshapes.  Aborting Rocksmith 2 export.");
+					eof_message("Error:  Couldn't match chord with chord template while writing handshapes.  Aborting Rocksmith 2 export.");
 					eof_log("Error:  Couldn't match chord with chord template while writing handshapes.  Aborting Rocksmith 2 export.", 1);
 					if(chordlist)
 					{	//If the chord list was built
 						free(chordlist);
+						eof_rs_chord_table_free(&chordtable);
 					}
 					eof_rs_export_cleanup(sp, track);	//Remove all temporary notes that were added and remove ignore status from notes
 					eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view if applicable
@@ -3211,6 +3300,7 @@ int eof_export_rocksmith_2_track(EOF_SONG * sp, char * fn, unsigned long track,
 	if(chordlist)
 	{	//If the chord list was built
 		free(chordlist);
+		eof_rs_chord_table_free(&chordtable);
 	}
 	//Remove all temporary text events that were added
 	for(ctr = sp->text_events; ctr > 0; ctr--)
@@ -3337,7 +3427,7 @@ void eof_rs_utf8_expand_xml_text(char *buffer, size_t size, const char *input, u
 
 	if(warnsize && (index > warnsize + 1))
 	{	//If there is a threshold length specified for the output string, and the expanded string exceeds it (accounting for the extra byte used by the string terminator)
-		allegro_message("Warning:  The string\n\"%s\"\nis longer than %lu characters.  It will need to be shortened or it will be truncated.", buffer, (unsigned long)warnsize);
+		eof_message("Warning:  The string\n\"%s\"\nis longer than %lu characters.  It will need to be shortened or it will be truncated.", buffer, (unsigned long)warnsize);
 		(void) usetat(buffer, warnsize, '\0');	//Truncate the string
 	}
 }
@@ -3594,7 +3684,7 @@ void eof_generate_efficient_hand_positions_logic(EOF_SONG *sp, unsigned long tra
 	EOF_PRO_GUITAR_TRACK *tp;
 	unsigned char current_low, current_high, last_anchor = 0;
 	EOF_PRO_GUITAR_NOTE *next_position = NULL;	//Tracks the note at which the next fret hand position will be placed
-	EOF_PRO_GUITAR_NOTE *np, temp = {{0}, 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, temp2 = {{0}, 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};	//Used to track FHPs influenced by fingering or by slides
+	EOF_PRO_GUITAR_NOTE *np, temp = {"", 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, temp2 = {"", 0, 0, 0, {0}, {0}, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};	//Used to track FHPs influenced by fingering or by slides
 	char force_change, started = 0;
 	char restore_tech_view = 0;		//If tech view is in effect, it is temporarily disabled until after the fret hand positions are generated
 	char all = 0;	//Is set to nonzero if the values passed for startnote and stopnote are equal, indicating all existing fret hand positions are to be replaced
@@ -3645,7 +3735,7 @@ void eof_generate_efficient_hand_positions_logic(EOF_SONG *sp, unsigned long tra
 		if(warnuser && function)
 		{	//Skip the warning if the logic to delete FHPs in the specified range was called explicitly
 			eof_clear_input();
-			if(alert(NULL, warning, "Continue?", "&Yes", "&No", 'y', 'n') != 1)
+			if(eof_alert(NULL, warning, "Continue?", "&Yes", "&No", 'y', 'n') != 1)
 			{	//If the user does not opt to remove the existing hand positions
 				eof_menu_track_set_tech_view_state(sp, track, restore_tech_view);	//Re-enable tech view for the second piano roll's track if applicable
 				return;
@@ -4383,7 +4473,7 @@ void eof_delete_rocksmith_wav(void)
 		(void) delete_file(checkfn);
 		if(exists(checkfn))
 		{	//If the file still exists after the attempted deletion
-			allegro_message("Warning:  Couldn't delete the Rocksmith WAV file.  Please delete it manually so it will be recreated during the next save.");
+			eof_message("Warning:  Couldn't delete the Rocksmith WAV file.  Please delete it manually so it will be recreated during the next save.");
 		}
 	}
 }
@@ -4653,7 +4743,7 @@ int eof_check_rs_sections_have_phrases(EOF_SONG *sp, unsigned long track)
 		}
 		eof_seek_and_render_position(track, eof_note_type, sp->beat[ctr]->pos);	//Render the track so the user can see where the correction needs to be made, along with the RS section in question
 		eof_clear_input();
-		if(!user_prompted && alert("At least one Rocksmith section doesn't have a Rocksmith phrase at the same position.", "This can cause the chart's sections to work incorrectly", "Would you like to place Rocksmith phrases to correct this?", "&Yes", "&No", 'y', 'n') != 1)
+		if(!user_prompted && eof_alert("At least one Rocksmith section doesn't have a Rocksmith phrase at the same position.", "This can cause the chart's sections to work incorrectly", "Would you like to place Rocksmith phrases to correct this?", "&Yes", "&No", 'y', 'n') != 1)
 		{	//If the user hasn't already answered this prompt, and doesn't opt to correct the issue
 			eof_2d_render_top_option = original_eof_2d_render_top_option;	//Restore the user's preference
 			return 2;	//Return user cancellation
@@ -4673,7 +4763,7 @@ int eof_check_rs_sections_have_phrases(EOF_SONG *sp, unsigned long track)
 			if(sp->beat[ctr]->contained_section_event < 0)
 			{	//If user added a text event, but it wasn't a Rocksmith phrase
 				eof_clear_input();
-				if(alert("You didn't add a Rocksmith phrase.", NULL, "Do you want to continue adding RS phrases for RS sections that are missing them?", "&Yes", "&No", 'y', 'n') != 1)
+				if(eof_alert("You didn't add a Rocksmith phrase.", NULL, "Do you want to continue adding RS phrases for RS sections that are missing them?", "&Yes", "&No", 'y', 'n') != 1)
 				{	//If the user doesn't opt to finish correcting the issue
 					return 2;	//Return user cancellation
 				}
@@ -5090,8 +5180,7 @@ void eof_load_chord_shape_definitions(char *fn)
 	{	//Until there was an error reading from the file
 		if(num_eof_chord_shapes < EOF_MAX_CHORD_SHAPES)
 		{	//If another chord shape definition can be stored
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tProcessing line #%lu", linectr);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\tProcessing line #%lu", linectr);
 
 			//Load chord shape definition
 			if(strcasestr_spec(buffer, "<chordTemplate"))
@@ -5893,7 +5982,7 @@ int eof_rs_export_common(EOF_SONG * sp, unsigned long track, PACKFILE *fp, unsig
 	{	//If the user did not define a COUNT phrase that applies to either the track being exported or all tracks
 		if((sp->beat[0]->contained_section_event >= 0) && ((*user_warned & 16) == 0))
 		{	//If there is already a phrase defined on the first beat, and the user wasn't warned of this problem yet
-			allegro_message("Warning:  There is no COUNT phrase, but the first beat marker already has a phrase.\nYou should move that phrase because only one phrase per beat is exported.");
+			eof_message("Warning:  There is no COUNT phrase, but the first beat marker already has a phrase.\nYou should move that phrase because only one phrase per beat is exported.");
 			*user_warned |= 16;
 		}
 		eof_log("\t! Adding missing COUNT phrase", 1);
@@ -5915,7 +6004,7 @@ int eof_rs_export_common(EOF_SONG * sp, unsigned long track, PACKFILE *fp, unsig
 					eof_2d_render_top_option = 9;	//Change the user preference to display RS phrases and sections
 					eof_selected_beat = ctr;		//Select it
 					eof_seek_and_render_position(track, eof_note_type, sp->beat[ctr]->pos);	//Show the offending END phrase
-					allegro_message("Warning:  Beat #%lu contains an END phrase, but there's at least one more phrase or section after it.\nThis will cause dynamic difficulty and/or riff repeater to not work correctly.", ctr);
+					eof_message("Warning:  Beat #%lu contains an END phrase, but there's at least one more phrase or section after it.\nThis will cause dynamic difficulty and/or riff repeater to not work correctly.", ctr);
 					eof_2d_render_top_option = original_eof_2d_render_top_option;	//Restore the user's preference
 					*user_warned |= 32;
 					break;
@@ -5934,7 +6023,7 @@ int eof_rs_export_common(EOF_SONG * sp, unsigned long track, PACKFILE *fp, unsig
 			eof_2d_render_top_option = 9;	//Change the user preference to display RS phrases and sections
 			eof_selected_beat = endbeat;		//Select it
 			eof_seek_and_render_position(track, eof_note_type, sp->beat[endbeat]->pos);	//Show where the END phrase should go
-			allegro_message("Warning:  There is no END phrase, but the beat marker after the last note in \"%s\" already has a phrase.\nYou should move that phrase because only one phrase per beat is exported.", sp->track[track]->name);
+			eof_message("Warning:  There is no END phrase, but the beat marker after the last note in \"%s\" already has a phrase.\nYou should move that phrase because only one phrase per beat is exported.", sp->track[track]->name);
 			eof_2d_render_top_option = original_eof_2d_render_top_option;	//Restore the user's preference
 			*user_warned |= 512;
 		}
@@ -5949,7 +6038,7 @@ int eof_rs_export_common(EOF_SONG * sp, unsigned long track, PACKFILE *fp, unsig
 	{	//If the user did not define a noguitar RS section that applies to either the track being exported or all tracks
 		if((sp->beat[endbeat]->contained_rs_section_event >= 0) && ((*user_warned & 128) == 0))
 		{	//If there is already a RS section defined on the first beat after the last note, and the user wasn't warned of this problem yet
-			allegro_message("Warning:  There is no noguitar RS section, but the beat marker after the last note already has a section.\nYou should move that section because only one section per beat is exported.");
+			eof_message("Warning:  There is no noguitar RS section, but the beat marker after the last note already has a section.\nYou should move that section because only one section per beat is exported.");
 			*user_warned |= 128;
 		}
 		eof_log("\t! Adding missing noguitar RS section", 1);
@@ -6048,7 +6137,7 @@ int eof_rs_export_common(EOF_SONG * sp, unsigned long track, PACKFILE *fp, unsig
 		}
 		if(ctr2 >= sectionlistsize)
 		{	//If the section couldn't be found
-			allegro_message("Error:  Couldn't find section in unique section list.  Aborting Rocksmith export.");
+			eof_message("Error:  Couldn't find section in unique section list.  Aborting Rocksmith export.");
 			eof_log("Error:  Couldn't find section in unique section list.  Aborting Rocksmith export.", 1);
 			free(sectionlist);
 			return 0;	//Return error
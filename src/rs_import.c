@@ -1,5 +1,5 @@
 #include <allegro.h>
-#include "chart_import.h"			//For FindLongestLineLength_ALLEGRO()
+#include "utility.h"				//For eof_text_fopen()
 #include "foflc/Lyric_storage.h"	//For strcasestr_spec()
 #include "foflc/RS_parse.h"			//For XML parsing functions
 #include "main.h"
@@ -136,7 +136,7 @@ int eof_parse_chord_template(char *name, size_t size, char *finger, char *frets,
 	return 0;	//Return success
 }
 
-EOF_PRO_GUITAR_NOTE *eof_rs_import_note_tag_data(char *buffer, int function, EOF_PRO_GUITAR_TRACK *tp, unsigned long linectr, unsigned char curdiff)
+EOF_PRO_GUITAR_NOTE *eof_rs_import_note_tag_data(EOF_XML_TAG *tag, int function, EOF_PRO_GUITAR_TRACK *tp, unsigned long linectr, unsigned char curdiff)
 {
 	long timevar = 0, step = 0;
 	long bend = 0, fret = 0, hammeron = 0, harmonic = 0, palmmute = 0, pulloff = 0, string = 0, sustain = 0, tremolo = 0, linknext = 0, accent = 0, ignore = 0, mute = 0, pinchharmonic = 0, tap = 0, vibrato = 0;
@@ -144,58 +144,51 @@ EOF_PRO_GUITAR_NOTE *eof_rs_import_note_tag_data(char *buffer, int function, EOF
 	unsigned long flags = 0;
 	static EOF_PRO_GUITAR_NOTE *np = NULL;
 	EOF_PRO_GUITAR_NOTE *tnp = NULL;
-	char *ptr;
 
-	if(!buffer || !tp)
+	if(!tag || !tp || tag->closing)
 		return NULL;	//Invalid parameters
 
 	//Read note tag
-	ptr = strcasestr_spec(buffer, "<note ");
-	if(!ptr)
-	{	//If it is not a note tag, check if it's a chordnote tag
-		ptr = strcasestr_spec(buffer, "<chordNote ");
-	}
-
-	if(ptr)
+	if(eof_xml_tag_is(tag, "note") || eof_xml_tag_is(tag, "chordNote"))
 	{	//If this is a note or chordnote tag
 		//Read note attributes
-		if(!parse_xml_rs_timestamp("time", buffer, &timevar))
+		if(!eof_xml_attribute_rs_timestamp(tag, "time", &timevar))
 		{	//If the timestamp was not readable
 			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading start timestamp on line #%lu.  Aborting", linectr);
 			eof_log(eof_log_string, 1);
 			return NULL;
 		}
-		(void) parse_xml_attribute_number("bend", buffer, &bend);
-		(void) parse_xml_attribute_number("fret", buffer, &fret);
+		(void) eof_xml_attribute_number(tag, "bend", &bend);
+		(void) eof_xml_attribute_number(tag, "fret", &fret);
 		if(fret >= tp->capo)
 			fret -= tp->capo;	//Apply the capo if applicable
-		(void) parse_xml_attribute_number("hammerOn", buffer, &hammeron);
-		(void) parse_xml_attribute_number("harmonic", buffer, &harmonic);
-		(void) parse_xml_attribute_number("palmMute", buffer, &palmmute);
-		(void) parse_xml_attribute_number("pluck", buffer, &pluck);
-		(void) parse_xml_attribute_number("pullOff", buffer, &pulloff);
-		(void) parse_xml_attribute_number("slap", buffer, &slap);
-		(void) parse_xml_attribute_number("slideTo", buffer, &slideto);
+		(void) eof_xml_attribute_number(tag, "hammerOn", &hammeron);
+		(void) eof_xml_attribute_number(tag, "harmonic", &harmonic);
+		(void) eof_xml_attribute_number(tag, "palmMute", &palmmute);
+		(void) eof_xml_attribute_number(tag, "pluck", &pluck);
+		(void) eof_xml_attribute_number(tag, "pullOff", &pulloff);
+		(void) eof_xml_attribute_number(tag, "slap", &slap);
+		(void) eof_xml_attribute_number(tag, "slideTo", &slideto);
 		if(slideto >= tp->capo)
 			slideto -= tp->capo;	//Apply the capo if applicable
-		(void) parse_xml_attribute_number("string", buffer, &string);
-		if(!parse_xml_rs_timestamp("sustain", buffer, &sustain))
+		(void) eof_xml_attribute_number(tag, "string", &string);
+		if(!eof_xml_attribute_rs_timestamp(tag, "sustain", &sustain))
 		{	//If the timestamp was not readable
 			sustain = 0;	//Assume no sustain is used
 		}
-		(void) parse_xml_attribute_number("tremolo", buffer, &tremolo);
+		(void) eof_xml_attribute_number(tag, "tremolo", &tremolo);
 
 		//Read RS2 note attributes
-		(void) parse_xml_attribute_number("linkNext", buffer, &linknext);
-		(void) parse_xml_attribute_number("accent", buffer, &accent);
-		(void) parse_xml_attribute_number("ignore", buffer, &ignore);
-		(void) parse_xml_attribute_number(" mute", buffer, &mute);	//Include the leading space to avoid reading the value of the "PalmMute" attribute, which contains this substring at the end of the attribute name
-		(void) parse_xml_attribute_number("harmonicPinch", buffer, &pinchharmonic);
-		(void) parse_xml_attribute_number("slideUnpitchTo", buffer, &slideunpitchto);
+		(void) eof_xml_attribute_number(tag, "linkNext", &linknext);
+		(void) eof_xml_attribute_number(tag, "accent", &accent);
+		(void) eof_xml_attribute_number(tag, "ignore", &ignore);
+		(void) eof_xml_attribute_number(tag, "mute", &mute);
+		(void) eof_xml_attribute_number(tag, "harmonicPinch", &pinchharmonic);
+		(void) eof_xml_attribute_number(tag, "slideUnpitchTo", &slideunpitchto);
 		if(slideunpitchto >= tp->capo)
 			slideunpitchto -= tp->capo;	//Apply the capo if applicable
-		(void) parse_xml_attribute_number("tap", buffer, &tap);
-		(void) parse_xml_attribute_number("vibrato", buffer, &vibrato);
+		(void) eof_xml_attribute_number(tag, "tap", &tap);
+		(void) eof_xml_attribute_number(tag, "vibrato", &vibrato);
 
 		//Add note and set attributes
 		if((string >= 0) && (string < 6))
@@ -278,17 +271,16 @@ EOF_PRO_GUITAR_NOTE *eof_rs_import_note_tag_data(char *buffer, int function, EOF
 	}//If this is a note tag
 
 	//Read bendValue tag
-	ptr = strcasestr_spec(buffer, "<bendValue ");
-	if(!ptr || !np)
+	if(!eof_xml_tag_is(tag, "bendValue") || !np)
 		return NULL;	//If this isn't a bendValue tag or a normal note tag wasn't previously read, the tag hasn't been recognized
 
-	if(!parse_xml_rs_timestamp("time", buffer, &timevar))
+	if(!eof_xml_attribute_rs_timestamp(tag, "time", &timevar))
 	{	//If the timestamp was not readable
 		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading start timestamp on line #%lu.  Aborting", linectr);
 		eof_log(eof_log_string, 1);
 		return NULL;
 	}
-	if(!parse_xml_rs_timestamp("step", buffer, &step))
+	if(!eof_xml_attribute_rs_timestamp(tag, "step", &step))
 	{	//If the bend strength was not readable
 		step = 0;	//A strength of 0 is assumed
 	}
@@ -350,6 +342,79 @@ unsigned long eof_evaluate_rs_import_gap_solution(EOF_TECHNOTE_GAP *gaps, unsign
 	return lowestgapsize;
 }
 
+/* returns the spacing of the technotes if the specified number of them were placed into the gap, rounded the same way eof_evaluate_rs_import_gap_solution() does */
+static unsigned long eof_rs_import_gap_spacing(EOF_TECHNOTE_GAP *gap, unsigned long count)
+{
+	return (double)gap->size / (double)(count + 1) + 0.5;
+}
+
+/* returns the most technotes (up to maxcount) the gap can hold while keeping at least the specified spacing, or -1 if even the empty gap is smaller than that */
+static long eof_rs_import_gap_capacity(EOF_TECHNOTE_GAP *gap, unsigned long spacing, unsigned long maxcount)
+{
+	unsigned long count = 0;
+
+	if(eof_rs_import_gap_spacing(gap, 0) < spacing)
+		return -1;
+
+	while((count < maxcount) && (eof_rs_import_gap_spacing(gap, count + 1) >= spacing))
+	{	//The spacing only shrinks as more technotes are added
+		count++;
+	}
+
+	return (long)count;
+}
+
+void eof_solve_rs_import_gap_problem(EOF_TECHNOTE_GAP *gaps, unsigned long numgaps, unsigned *solution, unsigned long solutionsize)
+{
+	unsigned long ctr, ctr2, ctr3, spacing, bestspacing = 0, total, element;
+	long capacity;
+
+	if(!gaps || !solution)
+		return;	//Invalid parameters
+
+	memset(solution, 0, sizeof(unsigned) * solutionsize);
+	if(!numgaps || !solutionsize)
+		return;	//There is nothing to place
+
+	//A solution's value is the spacing in its most crowded gap, so the best value is one of the spacings a gap has with 0 through solutionsize technotes in it
+	//A spacing can be kept if the gaps can hold all of the technotes without any gap's spacing falling below it, find the largest such spacing
+	for(ctr = 0; ctr < numgaps; ctr++)
+	{	//For each gap
+		for(ctr2 = 0; ctr2 <= solutionsize; ctr2++)
+		{	//For each number of technotes it could hold
+			spacing = eof_rs_import_gap_spacing(&gaps[ctr], ctr2);
+			if(spacing <= bestspacing)
+				continue;	//This can't improve on the best spacing found so far
+
+			for(ctr3 = 0, total = 0; ctr3 < numgaps; ctr3++)
+			{	//For each gap, total how many technotes it can hold at this spacing
+				capacity = eof_rs_import_gap_capacity(&gaps[ctr3], spacing, solutionsize);
+				if(capacity < 0)
+					break;	//This gap is already smaller than the spacing
+				total += (unsigned long)capacity;
+			}
+			if((ctr3 == numgaps) && (total >= solutionsize))
+			{	//If every technote fits at this spacing
+				bestspacing = spacing;
+			}
+		}
+	}
+
+	//Of the solutions with the best spacing, use the one an exhaustive search that counts through the solutions with the first technote's gap number as the lowest digit would find first,
+	// by filling the lowest numbered gaps to capacity with the highest numbered technotes
+	element = solutionsize;
+	for(ctr = 0; (ctr < numgaps) && element; ctr++)
+	{	//For each gap, until all technotes are placed
+		capacity = eof_rs_import_gap_capacity(&gaps[ctr], bestspacing, solutionsize);
+		while((capacity > 0) && element)
+		{
+			element--;
+			solution[element] = (unsigned)ctr;
+			capacity--;
+		}
+	}
+}
+
 char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_NOTE *np, EOF_PRO_GUITAR_NOTE **chordnote, unsigned long chordnotectr, unsigned long numtechnotes)
 {
 	unsigned long cflags;	//The flags that all the chordnotes have in common
@@ -512,14 +577,11 @@ char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_N
 		{	//If there are technotes remaining to be placed
 			EOF_TECHNOTE_GAP *gaps;	//Stores information about the spacing between the hard-coded points of this chord (its start and end points and fixed position stop/bend tech notes)
 			EOF_TECHNOTE_GAP *gaps2;	//Used to rebuild the gaps array to remove zero sized gaps (caused by bend tech notes that can be at the same timestamp for multiple strings)
-			unsigned *solution;		//Stores a possible solution indicating which gap number each of the remaining technotes is to be placed into
-			unsigned long solutionval;	//The smallest amount of time between any technote in the solution and another obstacle (fixed position technote or chord start/end)
-			unsigned *bestsolution;		//Stores the solution that was evaluated with the largest buffer of time between each of the remaining technotes
-			unsigned long bestsolutionval;	//The value of the best evaluated solution (higher is better)
+			unsigned long solutionval;	//Tracks which technote number is being placed
+			unsigned *bestsolution;		//Stores the solution with the largest buffer of time between each of the remaining technotes, indicating which gap number each of them is to be placed into
 			unsigned long numgaps = numtechnotes + 1;	//The number of gaps within which the remaining technotes may be placed
 			unsigned long numgaps2;	//The number of gaps existing when the gaps array is rebuilt
 			unsigned long tnnum = 0, lasttechpos;
-			int done = 0;
 
 			//Ensure the chord is long enough to encompass all its technotes
 			if(numtechnotes + neededtechnotes > 1)
@@ -536,17 +598,14 @@ char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_N
 			gaps = malloc(sizeof(EOF_TECHNOTE_GAP) * numgaps);
 			gaps2 = malloc(sizeof(EOF_TECHNOTE_GAP) * numgaps);
 
-			//Build one array each to store the solution currently being tested and the best examined solution
-			solution = malloc(sizeof(unsigned) * neededtechnotes);
+			//Build an array to store the solution
 			bestsolution = malloc(sizeof(unsigned) * neededtechnotes);
-			if(!gaps || !gaps2 || !solution || !bestsolution)
+			if(!gaps || !gaps2 || !bestsolution)
 			{	//If the array was not allocated
 				if(gaps)
 					free(gaps);
 				if(gaps2)
 					free(gaps2);
-				if(solution)
-					free(solution);
 				if(bestsolution)
 					free(bestsolution);
 				eof_log("\tError allocating memory for technote placement logic.  Aborting", 1);
@@ -556,7 +615,6 @@ char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_N
 			{	//If the solution arrays were created
 				memset(gaps, 0, sizeof(EOF_TECHNOTE_GAP) * numgaps);
 				memset(gaps2, 0, sizeof(EOF_TECHNOTE_GAP) * numgaps);
-				memset(solution, 0, sizeof(unsigned) * neededtechnotes);
 				memset(bestsolution, 0, sizeof(unsigned) * neededtechnotes);
 				lasttechpos = np->pos;	//The first gap will begin at the beginning of the chord
 				gaps[numgaps - 1].stop = np->pos + np->length;	//The last gap will end at the end of the chord
@@ -627,38 +685,8 @@ char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_N
 					numgaps = numgaps2;
 					gaps2 = NULL;
 
-					//Test the default solution of all technotes being placed in the first gap
-					bestsolutionval = eof_evaluate_rs_import_gap_solution(gaps, numgaps, solution, neededtechnotes);
-
-					//Until all solutions have been examined, build a new solution to be tested
-					while(!done)
-					{
-						unsigned elementnum = 0;
-
-						//Increment the solution
-						solution[0]++;	//Change the gap number this technote will use
-						while(solution[elementnum] >= numgaps)
-						{	//If this element is overflowed, reset and increment the next element of the solution
-							solution[elementnum] = 0;
-							elementnum++;	//Examine the next element
-							if(elementnum >= neededtechnotes)
-							{	//If all elements have been exhausted
-								done = 1;	//All permutations have been tested, set condition to break from outer while loop
-								break;		//Break from inner while loop
-							}
-							solution[elementnum]++;	//Increment this element
-						}
-						if(done)
-							break;
-
-						//Evaluate the new solution and keep it if it is better than the previous best solution
-						solutionval = eof_evaluate_rs_import_gap_solution(gaps, numgaps, solution, neededtechnotes);
-						if(solutionval > bestsolutionval)
-						{	//If this new solution is better
-							memcpy(bestsolution, solution, sizeof(unsigned) * neededtechnotes);	//Clone the solution
-							bestsolutionval = solutionval;
-						}
-					}
+					//Find the placement that spaces the technotes as sparsely as possible
+					eof_solve_rs_import_gap_problem(gaps, numgaps, bestsolution, neededtechnotes);
 
 					//Count how many technotes will be stored into each gap as part of the best solution
 					for(ctr = 0; ctr < neededtechnotes; ctr++)
@@ -712,7 +740,6 @@ char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_N
 
 				//Cleanup
 				free(gaps);
-				free(solution);
 				free(bestsolution);
 			}//If the solution arrays were created
 		}//If there are technotes remaining to be placed
@@ -732,12 +759,14 @@ char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_N
 
 EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 {
-	char *buffer = NULL, *buffer2 = NULL;		//Will be an array large enough to hold the largest line of text from input file
+	char *buffer = NULL;		//Will point to the current line of text from the input file
+	char *buffer2 = NULL;		//Will be an array large enough to hold the tag content of the current line
 	EOF_PRO_GUITAR_TRACK *tp = NULL;
-	size_t maxlinelength;
+	size_t buffer2size = 256, length;
 	unsigned long linectr = 1, tagctr;
-	PACKFILE *inf = NULL;
+	EOF_TEXT_FILE *inf = NULL;
 	char *ptr, *ptr2, tag[256];
+	EOF_XML_TAG xmltag;		//The first tag on the line being parsed, for the sections of the file that are parsed tag by tag
 	char error = 0, warning = 0;
 	char *phraselist[EOF_RS_PHRASE_IMPORT_LIMIT] = {0};	//Will store the list of phrase names
 	unsigned long phraselist_count = 0;	//Keeps count of how many phrases have been imported
@@ -766,78 +795,71 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 	{
 		return NULL;
 	}
-	inf = pack_fopen(fn, "rt");	//Open file in text mode
+	inf = eof_text_fopen(fn);	//Buffer the file so it can be parsed in a single pass
 	if(!inf)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError loading:  Cannot open input xml file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
-		eof_log(eof_log_string, 1);
+		eof_log("\tError loading:  Cannot buffer input xml file", 1);
 		return NULL;
 	}
 
-	//Allocate memory buffers large enough to hold any line in this file
-	maxlinelength = (size_t)FindLongestLineLength_ALLEGRO(fn, 0);
-	if(!maxlinelength)
-	{
-		eof_log("\tError finding the largest line in the file.  Aborting", 1);
-		(void) pack_fclose(inf);
-		return NULL;
-	}
-	buffer = (char *)malloc(maxlinelength);
-	buffer2 = (char *)malloc(maxlinelength);
-	if(!buffer || !buffer2)
+	//Allocate the tag content buffer, it is grown as needed to hold longer lines
+	buffer2 = (char *)malloc(buffer2size);
+	if(!buffer2)
 	{
-		if(buffer)
-		{	//If the first buffer was allocated
-			free(buffer);
-		}
-		if(buffer2)
-		{	//If the second buffer was allocated, not sure why this would happen if the first failed
-			free(buffer2);
-		}
 		eof_log("\tError allocating memory.  Aborting", 1);
-		(void) pack_fclose(inf);
+		eof_text_fclose(inf);
 		return NULL;
 	}
-	memset(buffer, 0, maxlinelength);	//Fill with 0s to satisfy Splint
-	memset(buffer2, 0, maxlinelength);
+	memset(buffer2, 0, buffer2size);	//Fill with 0s to satisfy Splint
 
 	//Allocate and initialize a pro guitar structure
-	tp = malloc(sizeof(EOF_PRO_GUITAR_TRACK));
+	tp = eof_create_pro_guitar_track();
 	if(!tp)
 	{
 		eof_log("\tError allocating memory.  Aborting", 1);
-		(void) pack_fclose(inf);
-		free(buffer);
+		eof_text_fclose(inf);
 		free(buffer2);
 		return NULL;
 	}
-	memset(tp, 0, sizeof(EOF_PRO_GUITAR_TRACK));	//Initialize memory block to 0 to avoid crashes when not explicitly setting counters that were newly added to the pro guitar structure
 	tp->numstrings = 6;	//The number of strings that will be used in the arrangement is unknown, default to 6
 	tp->numfrets = 22;	//The number of frets that will be used in the arrangement is unknown, default to 22
 	tp->note = tp->pgnote;	//Put the regular pro guitar note array into effect
 	tp->parent = eof_song->pro_guitar_track[eof_song->track[eof_selected_track]->tracknum]->parent;	//Initialize the parent so that the alternate track name can be set if appropriate
 
-	//Read first line of text, capping it to prevent buffer overflow
-	if(!pack_fgets(buffer, (int)maxlinelength, inf))
-	{	//I/O error
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Rocksmith import failed on line #%lu:  Unable to read from file:  \"%s\"", linectr, strerror(errno));
+	//Read first line of text
+	if(eof_text_feof(inf))
+	{	//Empty file
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Rocksmith import failed on line #%lu:  The file is empty", linectr);
 		eof_log(eof_log_string, 1);
 		error = 1;
 	}
+	buffer = eof_text_fgets(inf);
 
 	//Parse the contents of the file
-	while(!error && !pack_feof(inf))
+	while(!error && !eof_text_feof(inf))
 	{	//Until there was an error reading from the file or end of file is reached
 		#ifdef RS_IMPORT_DEBUG
-			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tProcessing line #%lu", linectr);
-			eof_log(eof_log_string, 2);
+			eof_logf(2, "\tProcessing line #%lu", linectr);
 		#endif
 
 		//Separate the line into the opening XML tag (buffer) and the content between the opening and closing tag (buffer2)
 		ptr = strcasestr_spec(buffer, ">");
 		if(ptr)
 		{	//If this line contained an XML tag
-			strcpy(buffer2, ptr);	//Copy the portion of the buffer beginning after the opening tag
+			length = strlen(ptr) + 1;
+			if(length > buffer2size)
+			{	//If the tag content buffer isn't large enough for this line
+				ptr2 = (char *)realloc(buffer2, length);
+				if(!ptr2)
+				{
+					eof_log("\tError allocating memory.  Aborting", 1);
+					error = 1;
+					break;
+				}
+				buffer2 = ptr2;
+				buffer2size = length;
+			}
+			memcpy(buffer2, ptr, length);	//Copy the portion of the buffer beginning after the opening tag
 			ptr2 = strchr(buffer2, '<');
 			if(ptr2)
 			{	//If this line contains a closing XML tag
@@ -851,7 +873,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 		}
 		else
 		{	//This line had no XML, skip it
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text, so the EOF condition can be checked
+			buffer = eof_text_fgets(inf);	//Read next line of text, so the EOF condition can be checked
 			linectr++;
 			continue;
 		}
@@ -859,7 +881,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 		if(strcasestr_spec(buffer, "<scoreUrl>"))
 		{	//If this is a scoreUrl tag (Go PlayAlong XML file)
 			eof_log("This appears to be a Go PlayAlong XML file.  Aborting", 1);
-			allegro_message("This appears to be a Go PlayAlong XML file.  Use \"File>Guitar Pro Import\" instead.");
+			eof_message("This appears to be a Go PlayAlong XML file.  Use \"File>Guitar Pro Import\" instead.");
 			error = 1;
 		}
 		else if(strcasestr_spec(buffer, "<song>") || strcasestr_spec(buffer, "<song version"))
@@ -875,11 +897,11 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 		}
 		else if(strcasestr_spec(buffer, "<vocals "))
 		{	//If this is the vocals tag
-			allegro_message("This is a lyric file, not a guitar or bass arrangement.\nUse File>Import>Lyric to load this file.");
+			eof_message("This is a lyric file, not a guitar or bass arrangement.\nUse File>Import>Lyric to load this file.");
 			eof_log("\tError:  This is a lyric file, not a guitar or bass arrangement.", 1);
-			free(buffer);
+			eof_text_fclose(inf);
 			free(buffer2);
-			free(tp);
+			eof_free_pro_guitar_track(tp);
 			return NULL;
 		}
 		else if(strcasestr_spec(buffer, "<title>"))
@@ -982,9 +1004,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</phrases"))
 				{	//If this is the end of the phrases tag
@@ -1018,7 +1040,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					break;	//Break from inner loop
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}
 			if(error)
@@ -1034,9 +1056,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</phraseIterations"))
 				{	//If this is the end of the phraseIterations tag
@@ -1107,7 +1129,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					}
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}
 			if(error)
@@ -1124,9 +1146,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</chordTemplates"))
 				{	//If this is the end of the chordTemplates tag
@@ -1163,7 +1185,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 						break;	//Break from inner loop
 					}
 					memset(chordlist[chordlist_count], 0, sizeof(EOF_PRO_GUITAR_NOTE));	//Initialize memory block to 0
-					strncpy(chordlist[chordlist_count]->name, tag, sizeof(chordlist[chordlist_count]->name) - 1);	//Store the chord name
+					chordlist[chordlist_count]->name = eof_intern_note_name(tag);	//Store the chord name
 					memcpy(chordlist[chordlist_count]->finger, finger, 8);	//Store the finger array
 					memcpy(chordlist[chordlist_count]->frets, frets, 8);	//Store the fret array
 					chordlist[chordlist_count]->note = note;	//Store the note mask
@@ -1180,7 +1202,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					break;	//Break from inner loop
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}//Until there was an error reading from the file or end of file is reached
 			if(error)
@@ -1193,11 +1215,12 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
-				if(strcasestr_spec(buffer, "</ebeats"))
+				(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the ebeat tag
+				if(xmltag.closing && eof_xml_tag_is(&xmltag, "ebeats"))
 				{	//If this is the end of the ebeats tag
 					for(ctr = eof_song->beats; ctr > beat_count; ctr--)
 					{	//For each of the remaining beats in the project (which weren't initialized), in reverse order
@@ -1205,7 +1228,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					}
 					break;	//Break from loop
 				}
-				if(!parse_xml_rs_timestamp("time", buffer, &output))
+				if(!eof_xml_attribute_rs_timestamp(&xmltag, "time", &output))
 				{	//If the timestamp was not readable
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading timestamp on line #%lu.  Aborting", linectr);
 					eof_log(eof_log_string, 1);
@@ -1229,7 +1252,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				}
 				beat_count++;
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}//Until there was an error reading from the file or end of file is reached
 			if(error)
@@ -1250,9 +1273,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</controls"))
 				{	//If this is the end of the controls tag
@@ -1337,7 +1360,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					break;	//Break from inner loop
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}//Until there was an error reading from the file or end of file is reached
 			if(error)
@@ -1367,9 +1390,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</tones"))
 				{	//If this is the end of the tones tag
@@ -1404,7 +1427,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					break;	//Break from inner loop
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}
 			if(error)
@@ -1419,9 +1442,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</sections"))
 				{	//If this is the end of the sections tag
@@ -1471,7 +1494,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					break;	//Break from inner loop
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}
 			if(error)
@@ -1486,9 +1509,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
 				if(strcasestr_spec(buffer, "</events"))
 				{	//If this is the end of the events tag
@@ -1533,7 +1556,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 					break;	//Break from inner loop
 				}
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;	//Increment line counter
 			}
 			if(error)
@@ -1551,18 +1574,18 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 				eof_log(eof_log_string, 1);
 			#endif
 
-			(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+			buffer = eof_text_fgets(inf);	//Read next line of text
 			linectr++;
-			while(!error || !pack_feof(inf))
+			while(!error || !eof_text_feof(inf))
 			{	//Until there was an error reading from the file or end of file is reached
-				if(strcasestr_spec(buffer, "</levels"))
+				(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the first tag on this line
+				if(xmltag.closing && eof_xml_tag_is(&xmltag, "levels"))
 				{	//If this is the end of the levels tag
 					break;	//Break from loop
 				}
 
 				//Read level tag
-				ptr = strcasestr_spec(buffer, "<level difficulty");
-				if(ptr)
+				if(!xmltag.closing && eof_xml_tag_is(&xmltag, "level"))
 				{	//If this is a level tag
 
 					#ifdef RS_IMPORT_DEBUG
@@ -1570,24 +1593,25 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 						eof_log(eof_log_string, 1);
 					#endif
 
-					if(!parse_xml_attribute_number("difficulty", buffer, &curdiff))
+					if(!eof_xml_attribute_number(&xmltag, "difficulty", &curdiff))
 					{	//If the difficulty number was not readable
 						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading difficulty number on line #%lu.  Aborting", linectr);
 						eof_log(eof_log_string, 1);
 						error = 1;
 						break;	//Break from inner loop
 					}
-					(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+					buffer = eof_text_fgets(inf);	//Read next line of text
 					linectr++;
-					while(!error || !pack_feof(inf))
+					while(!error || !eof_text_feof(inf))
 					{	//Until there was an error reading from the file or end of file is reached
-						if(strcasestr_spec(buffer, "</level>"))
+						(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the first tag on this line
+						if(xmltag.closing && eof_xml_tag_is(&xmltag, "level"))
 						{	//If this is the end of the level tag
 							break;	//Break from loop
 						}
 
 						//Read notes tag
-						if(strcasestr_spec(buffer, "<notes") && !strstr(buffer, "/>"))
+						if(!xmltag.closing && !xmltag.empty && eof_xml_tag_is(&xmltag, "notes"))
 						{	//If this is the notes tag and it isn't empty
 							EOF_PRO_GUITAR_NOTE *npp = NULL;	//Track the previously imported single note for split status purposes
 
@@ -1597,11 +1621,12 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 							#endif
 
 							tagctr = 0;
-							(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+							buffer = eof_text_fgets(inf);	//Read next line of text
 							linectr++;
-							while(!error || !pack_feof(inf))
+							while(!error || !eof_text_feof(inf))
 							{	//Until there was an error reading from the file or end of file is reached
-								if(strcasestr_spec(buffer, "</notes"))
+								(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the first tag on this line
+								if(xmltag.closing && eof_xml_tag_is(&xmltag, "notes"))
 								{	//If this is the end of the notes tag
 									#ifdef RS_IMPORT_DEBUG
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\t\tAdded %lu notes", tagctr);
@@ -1611,10 +1636,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}
 
 								//Read note tag
-								ptr = strcasestr_spec(buffer, "<note ");
-								if(ptr)
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "note"))
 								{	//If this is a note tag
-									np = eof_rs_import_note_tag_data(buffer, 1, tp, linectr, curdiff);	//Parse the note tag and add the note to the track
+									np = eof_rs_import_note_tag_data(&xmltag, 1, tp, linectr, curdiff);	//Parse the note tag and add the note to the track
 									if(!np)
 									{	//If there was an error doing so
 										error = 1;
@@ -1642,23 +1666,22 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}//If this is a note tag
 
 								//Read bendValue tag
-								ptr = strcasestr_spec(buffer, "<bendValue ");
-								if(ptr)
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "bendValue"))
 								{	//If this is a bendValue tag
-									if(!eof_rs_import_note_tag_data(buffer, 1, tp, linectr, curdiff))
+									if(!eof_rs_import_note_tag_data(&xmltag, 1, tp, linectr, curdiff))
 									{	//If there was an error parsing the bendvalue tag and adding a technote as appropriate
 										error = 1;
 										break;	//Break from inner loop
 									}
 								}//If this is a bendValue tag
 
-								(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+								buffer = eof_text_fgets(inf);	//Read next line of text
 								linectr++;
 							}//Until there was an error reading from the file or end of file is reached
 							if(error)
 								break;	//Break from inner loop
 						}//If this is a notes tag
-						else if(strcasestr_spec(buffer, "<chords") && !strstr(buffer, "/>"))
+						else if(!xmltag.closing && !xmltag.empty && eof_xml_tag_is(&xmltag, "chords"))
 						{	//If this is a chords tag and it isn't empty
 							long id = 0, lastid = -1;
 							EOF_PRO_GUITAR_NOTE *chordnote[6] = {NULL, NULL, NULL, NULL, NULL, NULL};	//Stores chordnote data
@@ -1671,11 +1694,12 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 							#endif
 
 							tagctr = 0;
-							(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+							buffer = eof_text_fgets(inf);	//Read next line of text
 							linectr++;
-							while(!error || !pack_feof(inf))
+							while(!error || !eof_text_feof(inf))
 							{	//Until there was an error reading from the file or end of file is reached
-								if(strcasestr_spec(buffer, "</chords>"))
+								(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the first tag on this line
+								if(xmltag.closing && eof_xml_tag_is(&xmltag, "chords"))
 								{	//If this is the end of the chords tag
 									#ifdef RS_IMPORT_DEBUG
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\t\tAdded %lu chords", tagctr);
@@ -1684,7 +1708,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 									break;	//Break from loop
 								}
 
-								if(strcasestr_spec(buffer, "</chord>"))
+								if(xmltag.closing && eof_xml_tag_is(&xmltag, "chord"))
 								{	//If this is the end of the chord tag, process and add technotes for the contents of the chordnote[] array as appropriate
 									error = eof_rs_import_process_chordnotes(tp, np, chordnote, chordnotectr, numtechnotes);
 									if(error)	//If there was an error performing these tasks
@@ -1693,25 +1717,25 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}//If this is the end of the chord tag
 
 								//Read chord tag
-								if(strcasestr_spec(buffer, "<chord "))
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "chord"))
 								{	//If this is a chord tag
 									long highdensity;
 
 									chordnotectr = 0;	//Reset this so the chordnote logic can tell that a chord tag is being parsed
 									numtechnotes = 0;	//Reset this count
-									if(note_count < EOF_MAX_NOTES)
+									if(eof_pro_guitar_track_reserve_notes(tp, note_count + 1, 0))
 									{	//If another chord can be stored
 										flags = 0;
 
 										//Read chord attributes
-										if(!parse_xml_rs_timestamp("time", buffer, &timevar))
+										if(!eof_xml_attribute_rs_timestamp(&xmltag, "time", &timevar))
 										{	//If the timestamp was not readable
 											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading timestamp on line #%lu.  Aborting", linectr);
 											eof_log(eof_log_string, 1);
 											error = 1;
 											break;	//Break from inner loop
 										}
-										if(!parse_xml_attribute_number("chordId", buffer, &id) || (id < 0))
+										if(!eof_xml_attribute_number(&xmltag, "chordId", &id) || (id < 0))
 										{	//If the chord ID was not readable or was invalid
 											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading chord ID on line #%lu.  Aborting", linectr);
 											eof_log(eof_log_string, 1);
@@ -1725,14 +1749,14 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 											error = 1;
 											break;	//Break from inner loop
 										}
-										if(!parse_xml_attribute_text(tag, sizeof(tag), "strum", buffer))
+										if(!eof_xml_attribute_text(&xmltag, "strum", tag, sizeof(tag)))
 										{	//If the strum direction could not be read
 											(void) strncpy(tag, "down", sizeof(tag) - 1);	//Assume down strum
 										}
 										mute = highdensity = palmmute = 0;
-										(void) parse_xml_attribute_number("fretHandMute", buffer, &mute);
-										(void) parse_xml_attribute_number("highDensity", buffer, &highdensity);
-										(void) parse_xml_attribute_number("palmMute", buffer, &palmmute);
+										(void) eof_xml_attribute_number(&xmltag, "fretHandMute", &mute);
+										(void) eof_xml_attribute_number(&xmltag, "highDensity", &highdensity);
+										(void) eof_xml_attribute_number(&xmltag, "palmMute", &palmmute);
 
 										//Add chord and set attributes
 										np = eof_pro_guitar_track_add_note(tp);	//Allocate, initialize and add the new note to the note array
@@ -1768,7 +1792,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}//If this is a chord tag
 
 								//Read chordnote tag
-								if(strcasestr_spec(buffer, "<chordNote "))
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "chordNote"))
 								{	//If this is a chordnote tag
 									EOF_PRO_GUITAR_NOTE *cnp;
 
@@ -1779,7 +1803,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 										error = 1;
 										break;	//Break from inner loop
 									}
-									cnp = eof_rs_import_note_tag_data(buffer, 0, tp, linectr, curdiff);	//Parse the note tag and store the note data in the chordnote array
+									cnp = eof_rs_import_note_tag_data(&xmltag, 0, tp, linectr, curdiff);	//Parse the note tag and store the note data in the chordnote array
 									if(!cnp)
 									{	//If there was an error doing so
 										error = 1;
@@ -1794,9 +1818,9 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}//If this is a chordnote tag
 
 								//Read bendValue tag
-								if(strcasestr_spec(buffer, "<bendValue "))
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "bendValue"))
 								{	//If this is a bendValue tag
-									if(!eof_rs_import_note_tag_data(buffer, 1, tp, linectr, curdiff))
+									if(!eof_rs_import_note_tag_data(&xmltag, 1, tp, linectr, curdiff))
 									{	//If there was an error parsing the bendvalue tag and adding a technote as appropriate
 										error = 1;
 										break;	//Break from inner loop
@@ -1804,7 +1828,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 									numtechnotes++;	//Track that a technote was added
 								}//If this is a bendValue tag
 
-								(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+								buffer = eof_text_fgets(inf);	//Read next line of text
 								linectr++;	//Increment line counter
 							}//If this is the end of the chord tag
 							if(error)
@@ -1820,7 +1844,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								break;	//Break from inner loop
 							}
 						}//If this is a chords tag and it isn't empty
-						else if(strcasestr_spec(buffer, "<anchors") && !strstr(buffer, "/>"))
+						else if(!xmltag.closing && !xmltag.empty && eof_xml_tag_is(&xmltag, "anchors"))
 						{	//If this is an anchors tag and it isn't empty
 							#ifdef RS_IMPORT_DEBUG
 								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\tProcessing <anchors> tag on line #%lu", linectr);
@@ -1828,11 +1852,12 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 							#endif
 
 							tagctr = 0;
-							(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+							buffer = eof_text_fgets(inf);	//Read next line of text
 							linectr++;
-							while(!error || !pack_feof(inf))
+							while(!error || !eof_text_feof(inf))
 							{	//Until there was an error reading from the file or end of file is reached
-								if(strcasestr_spec(buffer, "</anchors"))
+								(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the first tag on this line
+								if(xmltag.closing && eof_xml_tag_is(&xmltag, "anchors"))
 								{	//If this is the end of the anchors tag
 									#ifdef RS_IMPORT_DEBUG
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\t\tAdded %lu anchors", tagctr);
@@ -1842,19 +1867,18 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}
 
 								//Read anchor tag
-								ptr = strcasestr_spec(buffer, "<anchor ");
-								if(ptr)
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "anchor"))
 								{	//If this is an anchor tag
-									if(tp->handpositions < EOF_MAX_NOTES)
+									if(eof_pro_guitar_track_reserve_hand_positions(tp, tp->handpositions + 1))
 									{	//If another fret hand position can be stored
-										if(!parse_xml_rs_timestamp("time", buffer, &timevar))
+										if(!eof_xml_attribute_rs_timestamp(&xmltag, "time", &timevar))
 										{	//If the timestamp was not readable
 											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading timestamp on line #%lu.  Aborting", linectr);
 											eof_log(eof_log_string, 1);
 											error = 1;
 											break;	//Break from inner loop
 										}
-										if(!parse_xml_attribute_number("fret", buffer, &fret))
+										if(!eof_xml_attribute_number(&xmltag, "fret", &fret))
 										{	//If the fret number was not readable
 											(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading fret number on line #%lu.  Aborting", linectr);
 											eof_log(eof_log_string, 1);
@@ -1869,7 +1893,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 												eof_log(eof_log_string, 1);
 												if(!(warning & 1))
 												{	//If the user wasn't warned about this error yet
-													allegro_message("Warning:  This arrangement contains at least one fret hand position higher than fret 19.\nOffending positions won't work in Rocksmith 1 or RB3.");
+													eof_message("Warning:  This arrangement contains at least one fret hand position higher than fret 19.\nOffending positions won't work in Rocksmith 1 or RB3.");
 													warning |= 1;
 												}
 											}
@@ -1880,11 +1904,17 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
  											eof_log(eof_log_string, 1);
  											if(!(warning & 2))
  											{	//If the user wasn't warned about this error yet
-												allegro_message("Warning:  This arrangement contains at least one invalid fret hand position (higher than fret 21).\n  Offending positions were dropped");
+												eof_message("Warning:  This arrangement contains at least one invalid fret hand position (higher than fret 21).\n  Offending positions were dropped");
  												warning |= 2;
  											}
  										}
- 										else
+ 										else if(!eof_pro_guitar_track_reserve_hand_positions(tp, tp->handpositions + 1))
+										{	//If the fret hand position array couldn't grow
+											eof_log("\tError allocating memory.  Aborting", 1);
+											error = 1;
+											break;	//Break from inner loop
+										}
+										else
 										{	//Otherwise add it to the track
 											tp->handposition[tp->handpositions].start_pos = timevar;
 											tp->handposition[tp->handpositions].end_pos = fret - tp->capo;
@@ -1894,14 +1924,14 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 									}//If another fret hand position can be stored
 								}//If this is an anchor tag
 
-								(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+								buffer = eof_text_fgets(inf);	//Read next line of text
 								linectr++;	//Increment line counter
 								tagctr++;
 							}
 							if(error)
 								break;	//Break from inner loop
 						}//If this is an anchors tag and it isn't empty
-						else if(strcasestr_spec(buffer, "<handShapes") && !strstr(buffer, "/>"))
+						else if(!xmltag.closing && !xmltag.empty && eof_xml_tag_is(&xmltag, "handShapes"))
 						{	//If this is an handShapes tag and it isn't empty
 							long start, end, chordid;
 
@@ -1912,11 +1942,12 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 
 							eof_pro_guitar_track_sort_notes(tp);
 							tagctr = 0;
-							(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+							buffer = eof_text_fgets(inf);	//Read next line of text
 							linectr++;
-							while(!error || !pack_feof(inf))
+							while(!error || !eof_text_feof(inf))
 							{	//Until there was an error reading from the file or end of file is reached
-								if(strcasestr_spec(buffer, "</handShapes"))
+								(void) eof_xml_next_tag(buffer, &xmltag);	//Tokenize the first tag on this line
+								if(xmltag.closing && eof_xml_tag_is(&xmltag, "handShapes"))
 								{	//If this is the end of the handShapes tag
 									#ifdef RS_IMPORT_DEBUG
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\t\t\t\tParsed %lu handshapes", tagctr);
@@ -1926,27 +1957,26 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								}
 
 								//Read handShape tag
-								ptr = strcasestr_spec(buffer, "<handShape ");
-								if(ptr)
+								if(!xmltag.closing && eof_xml_tag_is(&xmltag, "handShape"))
 								{	//If this is a handShape tag
 									char arp = 0, hand = 0;
 
 									start = end = chordid = 0;
-									if(!parse_xml_rs_timestamp("startTime", buffer, &start) || (start < 0))
+									if(!eof_xml_attribute_rs_timestamp(&xmltag, "startTime", &start) || (start < 0))
 									{	//If the start timestamp was not readable or was invalid
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading start timestamp on line #%lu.  Aborting", linectr);
 										eof_log(eof_log_string, 1);
 										error = 1;
 										break;	//Break from inner loop
 									}
-									if(!parse_xml_rs_timestamp("endTime", buffer, &end) || (end < 0))
+									if(!eof_xml_attribute_rs_timestamp(&xmltag, "endTime", &end) || (end < 0))
 									{	//If the end timestamp was not readable or was invalid
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading end timestamp on line #%lu.  Aborting", linectr);
 										eof_log(eof_log_string, 1);
 										error = 1;
 										break;	//Break from inner loop
 									}
-									if(!parse_xml_attribute_number("chordId", buffer, &chordid) || (chordid < 0))
+									if(!eof_xml_attribute_number(&xmltag, "chordId", &chordid) || (chordid < 0))
 									{	//If the chord ID number was not readable or was invalid
 										(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading chord ID number on line #%lu.  Aborting", linectr);
 										eof_log(eof_log_string, 1);
@@ -2043,7 +2073,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 										}
 									}
 								}//If this is a handShape tag
-								(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+								buffer = eof_text_fgets(inf);	//Read next line of text
 								linectr++;	//Increment line counter
 								tagctr++;
 							}
@@ -2051,19 +2081,19 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 								break;	//Break from inner loop
 						}//If this is an handShapes tag and it isn't empty
 
-						(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+						buffer = eof_text_fgets(inf);	//Read next line of text
 						linectr++;
 					}//Until there was an error reading from the file or end of file is reached
 					if(error)
 						break;	//Break from outer loop
 				}//If this is a level tag
 
-				(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+				buffer = eof_text_fgets(inf);	//Read next line of text
 				linectr++;
 			}//Until there was an error reading from the file or end of file is reached
 		}//If this is the levels tag and it isn't empty
 
-		(void) pack_fgets(buffer, (int)maxlinelength, inf);	//Read next line of text
+		buffer = eof_text_fgets(inf);	//Read next line of text
 		linectr++;	//Increment line counter
 	}//Until there was an error reading from the file or end of file is reached
 
@@ -2133,7 +2163,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 
 		//Apply strum directions
 		eof_clear_input();
-		if(strum_dir && (alert("At least one chord was marked as strum up.", "Would you like to mark all non strum-up chords as strum down?", NULL, "&Yes", "&No", 'y', 'n') == 1))
+		if(strum_dir && (eof_alert("At least one chord was marked as strum up.", "Would you like to mark all non strum-up chords as strum down?", NULL, "&Yes", "&No", 'y', 'n') == 1))
 		{	//If there were any up strum chords, and user opts to mark all others as down strum chords
 			unsigned long bitmask, count;
 
@@ -2258,8 +2288,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 	{	//For each chord template that was stored
 		free(chordlist[ctr]);	//Free it
 	}
-	(void) pack_fclose(inf);
-	free(buffer);
+	eof_text_fclose(inf);
 	free(buffer2);
 
 	if(!error)
@@ -2278,7 +2307,7 @@ EOF_PRO_GUITAR_TRACK *eof_load_rs(char * fn)
 	{	//For each tech note that was imported
 		free(tp->technote[ctr]);
 	}
-	free(tp);
+	eof_free_pro_guitar_track(tp);
 
 	return NULL;
 }
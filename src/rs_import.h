@@ -2,6 +2,7 @@
 #define EOF_RS_IMPORT_H
 
 #include "song.h"
+#include "utility.h"	//For EOF_XML_TAG
 
 typedef struct
 {
@@ -22,8 +23,8 @@ int eof_parse_chord_template(char *name, size_t size, char *finger, char *frets,
 	//Returns zero on success
 	//Upon error, the specific cause for failure is logged regarding line number linectr and nonzero is returned
 
-EOF_PRO_GUITAR_NOTE *eof_rs_import_note_tag_data(char *buffer, int function, EOF_PRO_GUITAR_TRACK *tp, unsigned long linectr, unsigned char curdiff);
-	//Parses the note, chordnote or bendvalue XML tag contained in the specified array,
+EOF_PRO_GUITAR_NOTE *eof_rs_import_note_tag_data(EOF_XML_TAG *tag, int function, EOF_PRO_GUITAR_TRACK *tp, unsigned long linectr, unsigned char curdiff);
+	//Parses the note, chordnote or bendvalue XML tag tokenized by eof_xml_next_tag(),
 	// creating a pro guitar note structure as defined by the tag
 	//If function is nonzero, the note is appended to the specified track structure
 	// bendvalue tags result in the note being added to the technote set, otherwise the note is added to the normal note set
@@ -37,6 +38,11 @@ unsigned long eof_evaluate_rs_import_gap_solution(EOF_TECHNOTE_GAP *gaps, unsign
 	//The smallest of those amounts is returned as the value of the solution, or ULONG_MAX is returned on error
 	//A larger solution is desired as it indicates all technotes are as sparsely spaced as possible
 
+void eof_solve_rs_import_gap_problem(EOF_TECHNOTE_GAP *gaps, unsigned long numgaps, unsigned *solution, unsigned long solutionsize);
+	//Stores into solution[] the gap number each of the solutionsize technotes is placed into, choosing the placement that eof_evaluate_rs_import_gap_solution() values highest
+	//Ties are broken the same way as testing every placement in turn (counting with the first technote's gap number as the lowest digit) and keeping the first best one
+	//This takes polynomial time in the number of gaps and technotes, instead of the exponential time of testing every placement
+
 char eof_rs_import_process_chordnotes(EOF_PRO_GUITAR_TRACK *tp, EOF_PRO_GUITAR_NOTE *np, EOF_PRO_GUITAR_NOTE **chordnote, unsigned long chordnotectr, unsigned long numtechnotes);
 	//Accepts a pointer to the chord (np) being parsed, an array (chordnote) containing the chordnote data and the number (chordnotectr) of chordnotes in that array
 	// and adds optimally-spaced technotes over the duration of the specified chord
@@ -1,15 +1,20 @@
 #include <allegro.h>
+#include <math.h>
 #include "menu/file.h"
 #include "menu/song.h"
 #include "dialog.h"
 #include "main.h"
 #include "silence.h"
+#include "pcm.h"
 #include "utility.h"
+#include "vorbis/vorbisenc.h"
 
 #ifdef USEMEMWATCH
 #include "memwatch.h"
 #endif
 
+#define EOF_OGG_SERIALNO 0x454F46	//The serial number of OGG files encoded from scratch
+
 static unsigned long msec_to_samples(unsigned long msec)
 {
 	unsigned long sample;
@@ -168,20 +173,798 @@ int save_wav(const char * fn, SAMPLE * sp)
 	return 1;
 }
 
-int eof_add_silence(char * oggfn, unsigned long ms)
+typedef struct
 {
-	char sys_command[1024] = {0};
-	char backupfn[1024] = {0};	//The file path of the backup of the target audio file
-	char wavfn[1024] = {0};		//The file path of the silent WAV file created
-	char soggfn[1024] = {0};	//The file path of the silent OGG file created
-	char oggcfn[1024] = {0};	//The file path to the oggCat utility
-	char old_wd[1024] = {0};	//Store working directory before changing it so we can get back
-	char *rel_oggfn;			//Relative file path to the target audio file
-	char *rel_backupfn;			//Relative file path to the backup of the target audio file
-	SAMPLE * silence_sample;
+	PACKFILE *fp;			//The file the encoded pages are written to
+	ogg_stream_state os;
+	vorbis_info vi;
+	vorbis_comment vc;
+	vorbis_dsp_state vd;
+	vorbis_block vb;
+	int channels;
+	int error;				//Set to nonzero if any page could not be written
+} EOF_OGG_ENCODER;
+
+#define EOF_OGG_ENCODE_CHUNK 1024	//The number of sample frames submitted to the encoder at a time
+
+static void eof_ogg_encoder_write_page(EOF_OGG_ENCODER *enc, ogg_page *og)
+{
+	if(pack_fwrite(og->header, og->header_len, enc->fp) != og->header_len)
+		enc->error = 1;
+	if(pack_fwrite(og->body, og->body_len, enc->fp) != og->body_len)
+		enc->error = 1;
+}
+
+static void eof_ogg_encoder_drain(EOF_OGG_ENCODER *enc)
+{
+	ogg_packet op;
+	ogg_page og;
+
+	while(vorbis_analysis_blockout(&enc->vd, &enc->vb) == 1)
+	{	//For each block of audio the encoder has buffered
+		(void) vorbis_analysis(&enc->vb, NULL);
+		(void) vorbis_bitrate_addblock(&enc->vb);
+		while(vorbis_bitrate_flushpacket(&enc->vd, &op))
+		{	//For each packet that was encoded
+			(void) ogg_stream_packetin(&enc->os, &op);
+			while(ogg_stream_pageout(&enc->os, &og))
+			{	//For each page that is ready to be written
+				eof_ogg_encoder_write_page(enc, &og);
+			}
+		}
+	}
+}
+
+static int eof_ogg_encoder_open(EOF_OGG_ENCODER *enc, PACKFILE *fp, int channels, long freq, int bitrate, int serialno)
+{
+	ogg_packet header, header_comm, header_code;
+	ogg_page og;
+	int ret = -1;
+
+	if(!enc || !fp || (channels < 1) || (freq < 1))
+		return 0;	//Invalid parameters
+
+	memset(enc, 0, sizeof(EOF_OGG_ENCODER));
+	enc->fp = fp;
+	enc->channels = channels;
+	vorbis_info_init(&enc->vi);
+	if(bitrate > 0)
+	{	//If a target bitrate was given, use average bitrate mode
+		ret = vorbis_encode_init(&enc->vi, channels, freq, -1, (long)bitrate * 1000, -1);
+	}
+	if(ret)
+	{	//If no bitrate was given or the encoder doesn't support it at this sample rate (ie. very high sample rates), specify a quality level instead
+		if(bitrate > 0)
+		{
+			eof_log("\t\tVorbis encoder rejected the target bitrate.  Specifying a quality level instead", 1);
+		}
+		vorbis_info_clear(&enc->vi);
+		vorbis_info_init(&enc->vi);
+		ret = vorbis_encode_init_vbr(&enc->vi, channels, freq, 0.9);
+	}
+	if(ret)
+	{
+		eof_log("\tError initializing Vorbis encoder", 1);
+		vorbis_info_clear(&enc->vi);
+		return 0;
+	}
+	vorbis_comment_init(&enc->vc);
+	vorbis_comment_add_tag(&enc->vc, "ENCODER", "EOF");
+	(void) vorbis_analysis_init(&enc->vd, &enc->vi);
+	(void) vorbis_block_init(&enc->vd, &enc->vb);
+	(void) ogg_stream_init(&enc->os, serialno);
+
+	//Write the three header packets, the first of which has to be on its own page
+	(void) vorbis_analysis_headerout(&enc->vd, &enc->vc, &header, &header_comm, &header_code);
+	(void) ogg_stream_packetin(&enc->os, &header);
+	(void) ogg_stream_packetin(&enc->os, &header_comm);
+	(void) ogg_stream_packetin(&enc->os, &header_code);
+	while(ogg_stream_flush(&enc->os, &og))
+	{	//Flush the headers so the audio data starts on a new page
+		eof_ogg_encoder_write_page(enc, &og);
+	}
+
+	return 1;
+}
+
+static void eof_ogg_encoder_write(EOF_OGG_ENCODER *enc, SAMPLE *sp, unsigned long frames)
+{
+	unsigned long pos, chunk, ctr;
+	int channel, sourcechannels;
+	float **buffer;
+
+	if(!enc)
+		return;	//Invalid parameters
+
+	if(sp)
+	{	//If PCM data was given, encode all of it
+		frames = sp->len;
+		sourcechannels = sp->stereo ? 2 : 1;
+	}
+	else
+	{
+		sourcechannels = enc->channels;
+	}
+	for(pos = 0; pos < frames; pos += chunk)
+	{	//For each chunk of sample frames
+		chunk = frames - pos;
+		if(chunk > EOF_OGG_ENCODE_CHUNK)
+			chunk = EOF_OGG_ENCODE_CHUNK;
+		buffer = vorbis_analysis_buffer(&enc->vd, (int)chunk);
+		for(channel = 0; channel < enc->channels; channel++)
+		{	//For each channel being encoded
+			if(!sp)
+			{	//If no PCM data was given, encode silence
+				memset(buffer[channel], 0, sizeof(float) * chunk);
+				continue;
+			}
+			for(ctr = 0; ctr < chunk; ctr++)
+			{	//Convert the unsigned interleaved PCM data to floating point
+				unsigned long index = (pos + ctr) * sourcechannels + (channel < sourcechannels ? channel : 0);
+
+				if(sp->bits == 8)
+					buffer[channel][ctr] = (float)(((unsigned char *)sp->data)[index] - 0x80) / 128.0f;
+				else
+					buffer[channel][ctr] = (float)((long)((unsigned short *)sp->data)[index] - 0x8000) / 32768.0f;
+			}
+		}
+		(void) vorbis_analysis_wrote(&enc->vd, (int)chunk);
+		eof_ogg_encoder_drain(enc);
+	}
+}
+
+static int eof_ogg_encoder_close(EOF_OGG_ENCODER *enc)
+{
+	ogg_page og;
+	int error;
+
+	if(!enc)
+		return 0;	//Invalid parameters
+
+	(void) vorbis_analysis_wrote(&enc->vd, 0);	//Signal the end of the stream
+	eof_ogg_encoder_drain(enc);
+	while(ogg_stream_flush(&enc->os, &og))
+	{	//Write the end of stream page
+		eof_ogg_encoder_write_page(enc, &og);
+	}
+	error = enc->error;
+	(void) ogg_stream_clear(&enc->os);
+	vorbis_block_clear(&enc->vb);
+	vorbis_dsp_clear(&enc->vd);
+	vorbis_comment_clear(&enc->vc);
+	vorbis_info_clear(&enc->vi);
+
+	return !error;
+}
+
+/* reads the pages of an OGG file, calling the callback for each one, stops and returns zero if the callback returns zero */
+static int eof_ogg_read_pages(const char *fn, int (*callback)(ogg_page *og, void *data), void *data)
+{
+	PACKFILE *fp;
+	ogg_sync_state oy;
+	ogg_page og;
+	char *buffer;
+	long size;
+	int done = 0;
+
+	if(!fn || !callback)
+		return 0;	//Invalid parameters
+
+	fp = pack_fopen(fn, "r");
+	if(!fp)
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError opening OGG file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
+		eof_log(eof_log_string, 1);
+		return 0;
+	}
+	(void) ogg_sync_init(&oy);
+	while(!done)
+	{
+		buffer = ogg_sync_buffer(&oy, 4096);
+		size = pack_fread(buffer, 4096, fp);
+		if(size <= 0)
+			break;	//End of file
+		(void) ogg_sync_wrote(&oy, size);
+		while(ogg_sync_pageout(&oy, &og) == 1)
+		{	//For each complete page that was read
+			if(!callback(&og, data))
+			{
+				done = 1;
+				break;
+			}
+		}
+	}
+	(void) ogg_sync_clear(&oy);
+	(void) pack_fclose(fp);
+
+	return 1;
+}
+
+#define EOF_VORBIS_MAX_CONFIGS 64		//The most floors, residues, mappings or modes a Vorbis setup header can define
+#define EOF_VORBIS_MAX_SUBMAPS 16		//The most submaps a Vorbis mapping can define
+#define EOF_VORBIS_MAX_CHANNELS 256		//The most channels a Vorbis stream can have
+
+typedef struct
+{
+	int channels;
+	long rate;
+	long blocksize[2];			//The short and long block sizes in samples
+	int floor_type[EOF_VORBIS_MAX_CONFIGS];
+	int floor0_amplitude_bits[EOF_VORBIS_MAX_CONFIGS];	//For type 0 floors, the width of the amplitude field, which is 0 in an unused floor
+	int floors;
+	unsigned char mapping_mux[EOF_VORBIS_MAX_CONFIGS][EOF_VORBIS_MAX_CHANNELS];		//The submap each channel uses in each mapping
+	unsigned char mapping_floor[EOF_VORBIS_MAX_CONFIGS][EOF_VORBIS_MAX_SUBMAPS];	//The floor each submap uses in each mapping
+	int mappings;
+	int mode_blockflag[EOF_VORBIS_MAX_CONFIGS];
+	int mode_mapping[EOF_VORBIS_MAX_CONFIGS];
+	int modes;
+} EOF_VORBIS_SETUP;
+
+/* returns the number of bits needed to store the specified value, as defined by the Vorbis specification */
+static int eof_vorbis_ilog(unsigned long value)
+{
+	int bits = 0;
+
+	while(value)
+	{
+		bits++;
+		value >>= 1;
+	}
+
+	return bits;
+}
+
+/* reads the specified number of bits (up to 32) from the packet, setting *error if the packet ended */
+static unsigned long eof_vorbis_read(oggpack_buffer *opb, int bits, int *error)
+{
+	long value, high;
+
+	if(bits <= 0)
+		return 0;
+	if(bits > 16)
+	{	//Read wide values in two parts, so a value with every bit set isn't mistaken for the end of the packet
+		value = oggpack_read(opb, 16);
+		high = oggpack_read(opb, bits - 16);
+		if((value < 0) || (high < 0))
+		{
+			*error = 1;
+			return 0;
+		}
+		return (unsigned long)value | ((unsigned long)high << 16);
+	}
+	value = oggpack_read(opb, bits);
+	if(value < 0)
+	{
+		*error = 1;
+		return 0;
+	}
+
+	return (unsigned long)value;
+}
+
+/* returns the number of scalar values in a type 1 codebook lookup table, the largest integer whose dimensions'th power doesn't exceed entries */
+static unsigned long eof_vorbis_lookup1_values(unsigned long entries, unsigned long dimensions)
+{
+	unsigned long r;
+
+	if(!entries || !dimensions)
+		return 0;
+
+	r = (unsigned long)floor(pow((double)entries, 1.0 / (double)dimensions));	//Estimate the root, then correct any floating point rounding error
+	while((r > 1) && (pow((double)r, (double)dimensions) > (double)entries))
+		r--;
+	while(pow((double)(r + 1), (double)dimensions) <= (double)entries)
+		r++;
+
+	return r;
+}
+
+/* reads the stream parameters from the Vorbis identification header and the floor, mapping and mode configurations from the setup header */
+static int eof_vorbis_parse_headers(ogg_packet *id, ogg_packet *setup, EOF_VORBIS_SETUP *vs)
+{
+	oggpack_buffer opb;
+	unsigned long ctr, ctr2, ctr3, count, entries, dimensions, current, lookup_values;
+	int error = 0, bits, value_bits, partitions, classes, maxclass, submaps, class_dimensions[16], partition_class[32];
+
+	if(!id || !setup || !vs || (id->bytes < 30) || (setup->bytes < 7))
+		return 0;	//Invalid parameters
+	if((id->packet[0] != 1) || memcmp(&id->packet[1], "vorbis", 6) || (setup->packet[0] != 5) || memcmp(&setup->packet[1], "vorbis", 6))
+		return 0;	//These aren't Vorbis identification and setup headers
+
+	memset(vs, 0, sizeof(EOF_VORBIS_SETUP));
+	vs->channels = id->packet[11];
+	vs->rate = (long)id->packet[12] | ((long)id->packet[13] << 8) | ((long)id->packet[14] << 16) | ((long)id->packet[15] << 24);
+	vs->blocksize[0] = 1L << (id->packet[28] & 0x0F);
+	vs->blocksize[1] = 1L << (id->packet[28] >> 4);
+	if(!vs->channels || (vs->rate <= 0))
+		return 0;	//Invalid identification header
+
+	oggpack_readinit(&opb, setup->packet + 7, (int)(setup->bytes - 7));
+
+	//Skip the codebooks, they aren't needed to build packets that don't code any audio
+	count = eof_vorbis_read(&opb, 8, &error) + 1;
+	for(ctr = 0; (ctr < count) && !error; ctr++)
+	{	//For each codebook
+		if(eof_vorbis_read(&opb, 24, &error) != 0x564342)
+			return 0;	//Invalid sync pattern
+		dimensions = eof_vorbis_read(&opb, 16, &error);
+		entries = eof_vorbis_read(&opb, 24, &error);
+		if(eof_vorbis_read(&opb, 1, &error))
+		{	//Ordered codeword lengths
+			(void) eof_vorbis_read(&opb, 5, &error);	//Initial length
+			for(current = 0; (current < entries) && !error; )
+			{
+				current += eof_vorbis_read(&opb, eof_vorbis_ilog(entries - current), &error);
+			}
+			if(current > entries)
+				return 0;	//Invalid codebook
+		}
+		else
+		{
+			int sparse = eof_vorbis_read(&opb, 1, &error);
+
+			for(ctr2 = 0; (ctr2 < entries) && !error; ctr2++)
+			{	//For each entry
+				if(!sparse || eof_vorbis_read(&opb, 1, &error))
+					(void) eof_vorbis_read(&opb, 5, &error);	//Codeword length
+			}
+		}
+		bits = eof_vorbis_read(&opb, 4, &error);	//Lookup type
+		if(bits > 2)
+			return 0;	//Invalid lookup type
+		if(bits)
+		{	//If there is a vector lookup table
+			(void) eof_vorbis_read(&opb, 32, &error);	//Minimum value
+			(void) eof_vorbis_read(&opb, 32, &error);	//Delta value
+			value_bits = eof_vorbis_read(&opb, 4, &error) + 1;
+			(void) eof_vorbis_read(&opb, 1, &error);	//Sequence flag
+			lookup_values = (bits == 1) ? eof_vorbis_lookup1_values(entries, dimensions) : entries * dimensions;
+			for(ctr2 = 0; (ctr2 < lookup_values) && !error; ctr2++)
+			{
+				(void) eof_vorbis_read(&opb, value_bits, &error);
+			}
+		}
+	}
+
+	//Time domain transforms are placeholders that must all be 0
+	count = eof_vorbis_read(&opb, 6, &error) + 1;
+	for(ctr = 0; (ctr < count) && !error; ctr++)
+	{
+		if(eof_vorbis_read(&opb, 16, &error))
+			return 0;
+	}
+
+	//Floors
+	vs->floors = eof_vorbis_read(&opb, 6, &error) + 1;
+	for(ctr = 0; (ctr < (unsigned long)vs->floors) && !error; ctr++)
+	{	//For each floor
+		vs->floor_type[ctr] = eof_vorbis_read(&opb, 16, &error);
+		if(vs->floor_type[ctr] == 0)
+		{
+			(void) eof_vorbis_read(&opb, 8, &error);	//Order
+			(void) eof_vorbis_read(&opb, 16, &error);	//Rate
+			(void) eof_vorbis_read(&opb, 16, &error);	//Bark map size
+			vs->floor0_amplitude_bits[ctr] = eof_vorbis_read(&opb, 6, &error);
+			(void) eof_vorbis_read(&opb, 8, &error);	//Amplitude offset
+			count = eof_vorbis_read(&opb, 4, &error) + 1;
+			for(ctr2 = 0; ctr2 < count; ctr2++)
+			{
+				(void) eof_vorbis_read(&opb, 8, &error);	//Book number
+			}
+		}
+		else if(vs->floor_type[ctr] == 1)
+		{
+			partitions = eof_vorbis_read(&opb, 5, &error);
+			maxclass = -1;
+			for(ctr2 = 0; ctr2 < (unsigned long)partitions; ctr2++)
+			{	//For each partition
+				partition_class[ctr2] = eof_vorbis_read(&opb, 4, &error);
+				if(partition_class[ctr2] > maxclass)
+					maxclass = partition_class[ctr2];
+			}
+			for(classes = 0; classes <= maxclass; classes++)
+			{	//For each class
+				class_dimensions[classes] = eof_vorbis_read(&opb, 3, &error) + 1;
+				submaps = eof_vorbis_read(&opb, 2, &error);	//Class subclasses
+				if(submaps)
+					(void) eof_vorbis_read(&opb, 8, &error);	//Class masterbook
+				for(ctr3 = 0; ctr3 < (1UL << submaps); ctr3++)
+				{
+					(void) eof_vorbis_read(&opb, 8, &error);	//Subclass book
+				}
+			}
+			(void) eof_vorbis_read(&opb, 2, &error);	//Multiplier
+			bits = eof_vorbis_read(&opb, 4, &error);	//Range bits
+			for(ctr2 = 0; ctr2 < (unsigned long)partitions; ctr2++)
+			{	//For each partition, skip the X list values for its class' dimensions
+				for(ctr3 = 0; ctr3 < (unsigned long)class_dimensions[partition_class[ctr2]]; ctr3++)
+				{
+					(void) eof_vorbis_read(&opb, bits, &error);
+				}
+			}
+		}
+		else
+		{
+			return 0;	//Invalid floor type
+		}
+	}
+
+	//Residues
+	count = eof_vorbis_read(&opb, 6, &error) + 1;
+	for(ctr = 0; (ctr < count) && !error; ctr++)
+	{	//For each residue
+		unsigned long classifications, cascade[64];
+
+		if(eof_vorbis_read(&opb, 16, &error) > 2)
+			return 0;	//Invalid residue type
+		(void) eof_vorbis_read(&opb, 24, &error);	//Begin
+		(void) eof_vorbis_read(&opb, 24, &error);	//End
+		(void) eof_vorbis_read(&opb, 24, &error);	//Partition size
+		classifications = eof_vorbis_read(&opb, 6, &error) + 1;
+		(void) eof_vorbis_read(&opb, 8, &error);	//Classbook
+		for(ctr2 = 0; ctr2 < classifications; ctr2++)
+		{	//Read the cascade bitmap of each classification
+			cascade[ctr2] = eof_vorbis_read(&opb, 3, &error);
+			if(eof_vorbis_read(&opb, 1, &error))
+				cascade[ctr2] |= eof_vorbis_read(&opb, 5, &error) << 3;
+		}
+		for(ctr2 = 0; ctr2 < classifications; ctr2++)
+		{	//Skip the book number of each cascade stage in use
+			for(ctr3 = 0; ctr3 < 8; ctr3++)
+			{
+				if(cascade[ctr2] & (1UL << ctr3))
+					(void) eof_vorbis_read(&opb, 8, &error);
+			}
+		}
+	}
+
+	//Mappings
+	vs->mappings = eof_vorbis_read(&opb, 6, &error) + 1;
+	for(ctr = 0; (ctr < (unsigned long)vs->mappings) && !error; ctr++)
+	{	//For each mapping
+		if(eof_vorbis_read(&opb, 16, &error))
+			return 0;	//Invalid mapping type
+		submaps = 1;
+		if(eof_vorbis_read(&opb, 1, &error))
+			submaps = eof_vorbis_read(&opb, 4, &error) + 1;
+		if(eof_vorbis_read(&opb, 1, &error))
+		{	//If there is square polar channel coupling
+			count = eof_vorbis_read(&opb, 8, &error) + 1;
+			bits = eof_vorbis_ilog(vs->channels - 1);
+			for(ctr2 = 0; ctr2 < count; ctr2++)
+			{
+				(void) eof_vorbis_read(&opb, bits, &error);	//Magnitude channel
+				(void) eof_vorbis_read(&opb, bits, &error);	//Angle channel
+			}
+		}
+		if(eof_vorbis_read(&opb, 2, &error))
+			return 0;	//Reserved field must be 0
+		for(ctr2 = 0; ctr2 < (unsigned long)vs->channels; ctr2++)
+		{	//Store which submap each channel uses
+			vs->mapping_mux[ctr][ctr2] = (submaps > 1) ? eof_vorbis_read(&opb, 4, &error) : 0;
+			if(vs->mapping_mux[ctr][ctr2] >= submaps)
+				return 0;	//Invalid submap number
+		}
+		for(ctr2 = 0; ctr2 < (unsigned long)submaps; ctr2++)
+		{	//Store which floor each submap uses
+			(void) eof_vorbis_read(&opb, 8, &error);	//Unused time configuration
+			vs->mapping_floor[ctr][ctr2] = eof_vorbis_read(&opb, 8, &error);
+			if(vs->mapping_floor[ctr][ctr2] >= vs->floors)
+				return 0;	//Invalid floor number
+			(void) eof_vorbis_read(&opb, 8, &error);	//Residue number
+		}
+	}
+
+	//Modes
+	vs->modes = eof_vorbis_read(&opb, 6, &error) + 1;
+	for(ctr = 0; (ctr < (unsigned long)vs->modes) && !error; ctr++)
+	{	//For each mode
+		vs->mode_blockflag[ctr] = eof_vorbis_read(&opb, 1, &error);
+		(void) eof_vorbis_read(&opb, 16, &error);	//Window type
+		(void) eof_vorbis_read(&opb, 16, &error);	//Transform type
+		vs->mode_mapping[ctr] = eof_vorbis_read(&opb, 8, &error);
+		if(vs->mode_mapping[ctr] >= vs->mappings)
+			return 0;	//Invalid mapping number
+	}
+	if(error || !eof_vorbis_read(&opb, 1, &error) || error)
+		return 0;	//The header was truncated or is missing its framing bit
+
+	return 1;
+}
+
+/* builds an audio packet in the given mode that flags every channel's floor as unused, which decodes to silence without coding any residue */
+static void eof_vorbis_silent_packet(EOF_VORBIS_SETUP *vs, oggpack_buffer *opb, int mode, int prevlong, int nextlong, ogg_packet *op)
+{
+	int channel, floor, mapping = vs->mode_mapping[mode];
+
+	oggpack_reset(opb);
+	oggpack_write(opb, 0, 1);	//Audio packet type
+	if(vs->modes > 1)
+		oggpack_write(opb, (unsigned long)mode, eof_vorbis_ilog(vs->modes - 1));
+	if(vs->mode_blockflag[mode])
+	{	//Long blocks specify the sizes of the neighboring blocks to select the window shape
+		oggpack_write(opb, (unsigned long)prevlong, 1);
+		oggpack_write(opb, (unsigned long)nextlong, 1);
+	}
+	for(channel = 0; channel < vs->channels; channel++)
+	{	//For each channel, write an unused floor
+		floor = vs->mapping_floor[mapping][vs->mapping_mux[mapping][channel]];
+		if(vs->floor_type[floor] == 1)
+			oggpack_write(opb, 0, 1);	//Clear the nonzero flag
+		else if(vs->floor0_amplitude_bits[floor])
+			oggpack_write(opb, 0, vs->floor0_amplitude_bits[floor]);	//An amplitude of 0
+	}
+	op->packet = oggpack_get_buffer(opb);
+	op->bytes = oggpack_bytes(opb);
+	op->b_o_s = 0;
+	op->e_o_s = 0;
+}
+
+typedef struct
+{
+	ogg_stream_state os;	//Reassembles the packets of the first logical stream
+	int serialno;			//The serial number of the first logical stream, the one silence is added to
+	unsigned long pages;	//The number of pages of the first logical stream that were read
+	unsigned long packets;	//The number of packets of the first logical stream that were read
+	unsigned long header_pages;	//The number of pages holding the three header packets
+	unsigned char *id;		//Copies of the identification and setup header packets
+	long idbytes;
+	unsigned char *setup;
+	long setupbytes;
+	int first_mode;			//The mode of the first audio packet
+	int first_long;			//Nonzero if the first audio packet is a long block
+	int first_prevlong;		//The first audio packet's previous window flag, if it is a long block
+	int error;
+} EOF_OGG_SILENCE_SCAN;
+
+static int eof_ogg_silence_scan_callback(ogg_page *og, void *data)
+{
+	EOF_OGG_SILENCE_SCAN *scan = (EOF_OGG_SILENCE_SCAN *)data;
+	ogg_packet op;
+
+	if(!scan->pages)
+	{	//The first page identifies the logical stream that will be rewritten
+		scan->serialno = ogg_page_serialno(og);
+		(void) ogg_stream_init(&scan->os, scan->serialno);
+	}
+	else if(ogg_page_serialno(og) != scan->serialno)
+	{
+		return 1;	//Ignore the pages of any other logical stream
+	}
+	scan->pages++;
+	if(ogg_stream_pagein(&scan->os, og))
+	{
+		scan->error = 1;
+		return 0;
+	}
+	while(ogg_stream_packetout(&scan->os, &op) == 1)
+	{	//For each packet completed on this page
+		scan->packets++;
+		if(scan->packets == 1)
+		{	//Keep the identification header
+			scan->id = malloc((size_t)op.bytes);
+			if(!scan->id)
+				break;
+			memcpy(scan->id, op.packet, (size_t)op.bytes);
+			scan->idbytes = op.bytes;
+		}
+		else if(scan->packets == 3)
+		{	//Keep the setup header
+			scan->setup = malloc((size_t)op.bytes);
+			if(!scan->setup)
+				break;
+			memcpy(scan->setup, op.packet, (size_t)op.bytes);
+			scan->setupbytes = op.bytes;
+			scan->header_pages = scan->pages;
+			if((og->header[27 + og->header[26] - 1] == 255) || (ogg_stream_packetpeek(&scan->os, NULL) == 1))
+				break;	//The first audio packet has to begin a new page
+		}
+		else if(scan->packets == 4)
+		{	//Read the mode of the first audio packet, which needs the setup header to be parsed first
+			EOF_VORBIS_SETUP *vs = malloc(sizeof(EOF_VORBIS_SETUP));
+			ogg_packet id, setup;
+			oggpack_buffer opb;
+			int error = 0;
+
+			if(!vs || (scan->header_pages == scan->pages))
+			{	//If the memory couldn't be allocated or the first audio packet didn't begin a new page
+				free(vs);
+				break;
+			}
+			id.packet = scan->id;
+			id.bytes = scan->idbytes;
+			setup.packet = scan->setup;
+			setup.bytes = scan->setupbytes;
+			if(eof_vorbis_parse_headers(&id, &setup, vs))
+			{
+				oggpack_readinit(&opb, op.packet, (int)op.bytes);
+				if(!eof_vorbis_read(&opb, 1, &error))
+				{	//If this is an audio packet
+					scan->first_mode = eof_vorbis_read(&opb, eof_vorbis_ilog(vs->modes - 1), &error);
+					if(!error && (scan->first_mode < vs->modes))
+					{
+						scan->first_long = vs->mode_blockflag[scan->first_mode];
+						if(scan->first_long)
+							scan->first_prevlong = eof_vorbis_read(&opb, 1, &error);
+						if(!error)
+						{
+							free(vs);
+							return 0;	//Success, stop reading pages
+						}
+					}
+				}
+			}
+			free(vs);
+			break;
+		}
+	}
+
+	if(scan->packets < 4)
+		return 1;	//Keep reading pages
+
+	scan->error = 1;	//If this point is reached, the stream isn't usable
+	return 0;
+}
+
+typedef struct
+{
+	PACKFILE *fp;			//The file the pages are written to
+	EOF_VORBIS_SETUP *vs;
+	int serialno;			//The serial number of the stream being rewritten
+	unsigned long header_pages;	//The number of header pages to copy before inserting the silence
+	unsigned long silent_packets;	//The number of silent packets to insert
+	int silent_mode;		//The mode of all but the last silent packet
+	int last_mode;			//The mode of the last silent packet, which matches the window the first audio packet expects
+	int first_long;			//Nonzero if the first audio packet is a long block
+	ogg_int64_t shift;		//The number of samples the silence adds before the original audio, which is added to its granule positions
+	unsigned long pages;	//The number of pages of the rewritten stream that were read
+	unsigned long inserted_pages;	//The number of pages of silence that were inserted, which is added to the original pages' sequence numbers
+	int error;
+} EOF_OGG_SILENCE_WRITE;
+
+static int eof_ogg_write_page(PACKFILE *fp, ogg_page *og)
+{
+	if((pack_fwrite(og->header, og->header_len, fp) != og->header_len) || (pack_fwrite(og->body, og->body_len, fp) != og->body_len))
+		return 0;
+
+	return 1;
+}
+
+static int eof_ogg_insert_silence(EOF_OGG_SILENCE_WRITE *state)
+{
+	ogg_stream_state os;
+	oggpack_buffer opb;
+	ogg_packet op;
+	ogg_page og;
+	unsigned long ctr;
+	ogg_int64_t granulepos = 0;
+	long prevsize = 0, size;
+	int mode, prevlong, nextlong;
+
+	(void) ogg_stream_init(&os, state->serialno);
+	os.pageno = (long)state->header_pages;	//Continue the page sequence after the header pages
+	os.b_o_s = 1;							//The header pages already began the stream
+	oggpack_writeinit(&opb);
+	for(ctr = 0; ctr < state->silent_packets; ctr++)
+	{	//For each silent packet
+		mode = (ctr + 1 < state->silent_packets) ? state->silent_mode : state->last_mode;
+		size = state->vs->blocksize[state->vs->mode_blockflag[mode]];
+		if(ctr)
+			granulepos += prevsize / 4 + size / 4;	//Each packet after the first completes the overlap of its block and the previous one
+		prevlong = ctr ? (prevsize == state->vs->blocksize[1]) : state->vs->mode_blockflag[mode];	//The first packet's output is discarded, so its previous window doesn't matter
+		if(ctr + 1 == state->silent_packets)
+			nextlong = state->first_long;	//The last silent packet overlaps the original audio
+		else
+			nextlong = state->vs->mode_blockflag[(ctr + 2 < state->silent_packets) ? state->silent_mode : state->last_mode];
+		eof_vorbis_silent_packet(state->vs, &opb, mode, prevlong, nextlong, &op);
+		op.granulepos = granulepos;
+		op.packetno = 3 + ctr;
+		(void) ogg_stream_packetin(&os, &op);
+		while(ogg_stream_pageout(&os, &og))
+		{
+			if(!eof_ogg_write_page(state->fp, &og))
+				state->error = 1;
+		}
+		prevsize = size;
+	}
+	while(ogg_stream_flush(&os, &og))
+	{	//End the last page of silence so the original audio's pages follow it unaltered
+		if(!eof_ogg_write_page(state->fp, &og))
+			state->error = 1;
+	}
+	state->inserted_pages = (unsigned long)os.pageno - state->header_pages;
+	oggpack_writeclear(&opb);
+	(void) ogg_stream_clear(&os);
+
+	return !state->error;
+}
+
+static int eof_ogg_silence_write_callback(ogg_page *og, void *data)
+{
+	EOF_OGG_SILENCE_WRITE *state = (EOF_OGG_SILENCE_WRITE *)data;
+	ogg_int64_t granulepos;
+	unsigned long pageno;
+	int ctr;
+
+	if(ogg_page_serialno(og) == state->serialno)
+	{	//If this page belongs to the stream being rewritten
+		state->pages++;
+		if(state->pages == state->header_pages + 1)
+		{	//Insert the silence before the first page of audio
+			if(!eof_ogg_insert_silence(state))
+				return 0;
+		}
+		if(state->pages > state->header_pages)
+		{	//Rewrite the original audio page's granule position and sequence number in the page header
+			granulepos = ogg_page_granulepos(og);
+			if(granulepos != -1)
+			{	//Pages on which no packet ends keep the granule position of -1
+				granulepos += state->shift;
+				for(ctr = 0; ctr < 8; ctr++)
+				{
+					og->header[6 + ctr] = (unsigned char)((granulepos >> (ctr * 8)) & 0xFF);
+				}
+			}
+			pageno = (unsigned long)ogg_page_pageno(og) + state->inserted_pages;
+			for(ctr = 0; ctr < 4; ctr++)
+			{
+				og->header[18 + ctr] = (unsigned char)((pageno >> (ctr * 8)) & 0xFF);
+			}
+			ogg_page_checksum_set(og);
+		}
+	}
+	if(!eof_ogg_write_page(state->fp, og))
+	{
+		state->error = 1;
+		return 0;
+	}
+
+	return 1;
+}
+
+/* encodes the specified PCM data to an OGG file, preceded by the specified number of sample frames of silence */
+static int eof_encode_ogg_with_leading_silence(const char *fn, SAMPLE *sp, unsigned long silence_frames, int bitrate)
+{
+	PACKFILE *fp;
+	EOF_OGG_ENCODER enc;
 	int retval;
 
-	if(!oggfn || (ms == 0) || eof_silence_loaded)
+	if(!fn || !sp)
+		return 0;	//Invalid parameters
+
+	fp = pack_fopen(fn, "w");
+	if(!fp)
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError saving OGG:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
+		eof_log(eof_log_string, 1);
+		return 0;
+	}
+	if(!eof_ogg_encoder_open(&enc, fp, sp->stereo ? 2 : 1, sp->freq, bitrate, EOF_OGG_SERIALNO))
+	{
+		(void) pack_fclose(fp);
+		return 0;
+	}
+	eof_ogg_encoder_write(&enc, NULL, silence_frames);	//Encode the silence
+	eof_ogg_encoder_write(&enc, sp, 0);	//Encode the audio directly from memory instead of through a temporary WAV file
+	retval = eof_ogg_encoder_close(&enc);
+	(void) pack_fclose(fp);
+
+	return retval;
+}
+
+int eof_add_silence(char * oggfn, unsigned long ms)
+{
+	char backupfn[1024] = {0};	//The file path of the backup of the target audio file
+	PACKFILE *fp;
+	EOF_OGG_SILENCE_SCAN scan;
+	EOF_OGG_SILENCE_WRITE state;
+	EOF_VORBIS_SETUP *vs = NULL;
+	ogg_packet id, setup;
+	ogg_int64_t target, shift, step;
+	long lastsize;
+	int ctr, short_mode = -1, long_mode = -1, valid = 0;
+
+	if(!oggfn || (ms == 0) || eof_silence_loaded || !eof_music_track)
 	{
 		return 1;	//Return error:  Invalid parameters
 	}
@@ -198,75 +981,107 @@ int eof_add_silence(char * oggfn, unsigned long ms)
 	}
 	(void) delete_file(oggfn);
 
-	silence_sample = create_silence_sample(ms);
-	if(!silence_sample)
+	/* read the Vorbis headers and the first audio packet's window to build silent packets the original stream's decoder setup can decode */
+	memset(&scan, 0, sizeof(scan));
+	(void) eof_ogg_read_pages(backupfn, eof_ogg_silence_scan_callback, &scan);
+	if(scan.pages)
+	{	//If the stream state was initialized
+		(void) ogg_stream_clear(&scan.os);
+	}
+	if(!scan.error && (scan.packets >= 4))
+	{	//If the first audio packet was read
+		vs = malloc(sizeof(EOF_VORBIS_SETUP));
+		id.packet = scan.id;
+		id.bytes = scan.idbytes;
+		setup.packet = scan.setup;
+		setup.bytes = scan.setupbytes;
+		if(vs && eof_vorbis_parse_headers(&id, &setup, vs))
+		{
+			for(ctr = 0; ctr < vs->modes; ctr++)
+			{	//Find a short and a long block mode
+				if(vs->mode_blockflag[ctr] && (long_mode < 0))
+					long_mode = ctr;
+				else if(!vs->mode_blockflag[ctr] && (short_mode < 0))
+					short_mode = ctr;
+			}
+			valid = 1;
+		}
+	}
+	free(scan.id);
+	free(scan.setup);
+	if(valid)
+	{	//Pick the last silent packet's block size to match the window the first audio packet was encoded with
+		state.silent_mode = (short_mode >= 0) ? short_mode : long_mode;	//Short blocks give the finest control over the silence's length
+		if(scan.first_long && scan.first_prevlong)
+			state.last_mode = long_mode;
+		else if(scan.first_long)
+			state.last_mode = short_mode;
+		else
+			state.last_mode = state.silent_mode;
+		if(state.last_mode < 0)
+			valid = 0;	//The stream has no mode with the needed block size
+	}
+	if(!valid)
 	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading the Vorbis headers of \"%s\".  Re-encoding the audio with silence is required.", backupfn);
+		eof_log(eof_log_string, 1);
+		free(vs);
+		(void) eof_copy_file(backupfn, oggfn);	//Restore the original OGG file
 		eof_fix_window_title();
-		return 2;	//Return error:  Couldn't create silent audio
-	}
-	(void) replace_filename(wavfn, eof_song_path, "silence.wav", 1024);
-	(void) save_wav(wavfn, silence_sample);
-	destroy_sample(silence_sample);
-	(void) replace_filename(soggfn, eof_song_path, "silence.ogg", 1024);
-	#ifdef ALLEGRO_WINDOWS
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc2 -o \"%s\" -b %d \"%s\"", soggfn, alogg_get_bitrate_ogg(eof_music_track) / 1000, wavfn);
-	#else
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc -o \"%s\" -b %d \"%s\"", soggfn, alogg_get_bitrate_ogg(eof_music_track) / 1000, wavfn);
-	#endif
-	if(eof_system(sys_command))
+		return 6;	//Return error:  Stitching failed
+	}
+
+	/* choose the number of silent packets that comes closest to the requested length */
+	/* a packet outputs the samples where its block's window overlaps the previous one's, so the first audio packet, which output nothing in the original stream, now also adds samples */
+	target = (ogg_int64_t)ms * vs->rate / 1000;
+	lastsize = vs->blocksize[vs->mode_blockflag[state.last_mode]];
+	shift = lastsize / 4 + vs->blocksize[scan.first_long] / 4;	//The delay with only one silent packet
+	step = vs->blocksize[vs->mode_blockflag[state.silent_mode]] / 2;	//The delay each additional packet adds
+	state.silent_packets = 1;
+	if(target > shift)
 	{
-		eof_fix_window_title();
-		return 3;	//Return error:  Could not encode silent audio
+		shift += step / 2 + lastsize / 4;	//The delay with two silent packets
+		state.silent_packets = 2;
+		if(target > shift)
+		{
+			state.silent_packets += (unsigned long)((target - shift + step / 2) / step);
+			shift += (ogg_int64_t)(state.silent_packets - 2) * step;
+		}
 	}
 
-	/* stitch the original file to the silence file */
-	if(!getcwd(old_wd, 1024))
-	{	//If the current working directory could not be obtained
+	/* write the header pages unaltered, followed by the silence and the original audio pages with their granule positions and page numbers offset to follow it */
+	fp = pack_fopen(oggfn, "w");
+	if(!fp)
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError saving OGG:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
+		eof_log(eof_log_string, 1);
+		free(vs);
+		(void) eof_copy_file(backupfn, oggfn);	//Restore the original OGG file
 		eof_fix_window_title();
-		return 4;	//Return error:  Could not obtain current working directory
-	}
-
-	(void) eof_chdir(eof_song_path);	//Change directory to the project's folder, since oggCat does not support paths that have any Unicode/extended ASCII, relative paths will be given
-	#ifdef ALLEGRO_WINDOWS
-		get_executable_name(oggcfn, 1024);
-		(void) replace_filename(oggcfn, oggcfn, "oggCat.exe", 1024);	//Build the full path to oggCat
-	#else
-		ustrzcpy(oggcfn, 1024, "oggCat");
-	#endif
-	rel_oggfn = get_filename(oggfn);		//Get the relative path to the target OGG file
-	rel_backupfn = get_filename(backupfn);	//Get the relative path to the backup of the target OGG file
-	//Call oggCat while the current working directory is the project folder.  This way, if the project folder's path contains any Unicode or extended ASCII, oggCat won't fail
-	#ifdef ALLEGRO_WINDOWS
-		//For some reason, the Windows build needs extra quotation marks to enclose the entire command if the command begins with a full executable path in quote marks
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "\"\"%s\" \"%s\" \"silence.ogg\" \"%s\"\"", oggcfn, rel_oggfn, rel_backupfn);
-	#else
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "\"%s\" \"%s\" \"silence.ogg\" \"%s\"", oggcfn, rel_oggfn, rel_backupfn);	//Use oggCat to overwrite the target OGG file with the silent audio concatenated with the backup of the target OGG file
-	#endif
-
-	eof_log_cwd();
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCalling oggCat as follows:  %s", sys_command);
-	eof_log(eof_log_string, 1);
-	retval = eof_system(sys_command);
-
-	/* change back to the program folder */
-	if(eof_chdir(old_wd))
-	{
-		allegro_message("Could not change directory to EOF's program folder!\n%s", backupfn);
-		return 5;	//Return error:  Could not set working directory
-	}
-
-	if(retval)
-	{	//If the command failed
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError issuing command \"%s\" from path \"%s\"", sys_command, eof_song_path);
+		return 2;	//Return error:  Couldn't create the combined audio file
+	}
+	state.fp = fp;
+	state.vs = vs;
+	state.serialno = scan.serialno;
+	state.header_pages = scan.header_pages;
+	state.first_long = scan.first_long;
+	state.shift = shift;
+	state.pages = 0;
+	state.inserted_pages = 0;
+	state.error = 0;
+	(void) eof_ogg_read_pages(backupfn, eof_ogg_silence_write_callback, &state);
+	(void) pack_fclose(fp);
+	free(vs);
+	if(state.error || (state.pages <= state.header_pages))
+	{	//If the original audio's pages couldn't be rewritten
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError rewriting the pages of \"%s\"", backupfn);
 		eof_log(eof_log_string, 1);
 		(void) eof_copy_file(backupfn, oggfn);	//Restore the original OGG file
 		eof_fix_window_title();
-		return 6;	//Return error:  oggCat failed
+		return 6;	//Return error:  Stitching failed
 	}
+	eof_logf(1, "\tInserted %lu silent packets (%ld samples) into the existing Vorbis stream", state.silent_packets, (long)shift);
 
-	/* clean up */
-	(void) delete_file(wavfn);	//Delete silence.wav
-	(void) delete_file(soggfn);	//Delete silence.ogg
 	if(eof_load_ogg(oggfn, 0))
 	{	//If the combined audio was loaded
 		eof_fix_waveform_graph();
@@ -284,21 +1099,32 @@ int eof_add_silence(char * oggfn, unsigned long ms)
 	return 8;	//Return error:  Could not load new audio, file does not exist
 }
 
+/* picks the bitrate for re-encoding the chart audio, prompting the user for an OGG encoding quality */
+static int eof_add_silence_recode_bitrate(void)
+{
+	int bitrate;
+
+	if(eof_ogg_settings())
+	{	//If the user selected an OGG encoding quality
+		bitrate = eof_ogg_list_bitrate(eof_ogg_setting);		//Use it for the conversion below
+	}
+	else
+	{	//Automatically pick a bitrate based on the current chart audio
+		eof_log("\tUsing current chart audio bitrate as the re-encode bitrate", 1);
+		bitrate = alogg_get_bitrate_ogg(eof_music_track) / 1000;
+	}
+	if(!bitrate)
+	{	//A user found that in an audio file with a really high sample rate (ie. 96KHz), alogg_get_bitrate_ogg() may return zero instead of an expected value
+		bitrate = 256;	//In case this happens, use a bitrate of 256Kbps, which should be good enough for a very high quality file
+	}
+
+	return bitrate;
+}
+
 int eof_add_silence_recode(char * oggfn, unsigned long ms)
 {
-	char sys_command[1024] = {0};
 	char backupfn[1024] = {0};
-	char wavfn[1024] = {0};
-	char soggfn[1024] = {0};
-	ALOGG_OGG *oggfile = NULL;
-	SAMPLE *decoded = NULL, *combined = NULL;
-	int bits;
-	int stereo;
-	int freq;
-	unsigned long samples;
-	int channels;
-	unsigned long ctr,index;
-	void * oggbuffer = NULL;
+	EOF_PCM_CACHE_ENTRY *pcm = NULL;
 	int bitrate;
 
  	eof_log("eof_add_silence_recode() entered", 1);
@@ -316,166 +1142,26 @@ int eof_add_silence_recode(char * oggfn, unsigned long ms)
 		(void) eof_copy_file(oggfn, backupfn);
 	}
 
-	/* Decode the OGG file into memory */
-	//Load OGG file into memory
-	oggbuffer = eof_buffer_file(oggfn, 0);	//Decode the OGG from buffer instead of from file because the latter cannot support special characters in the file path due to limitations with fopen()
-	if(!oggbuffer)
+	/* Decode the OGG file into memory, reusing the PCM data already decoded for the waveform graph/spectrogram if available */
+	pcm = eof_pcm_cache_acquire(oggfn);
+	if(pcm == NULL)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError reading OGG:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
-		eof_log(eof_log_string, 1);
-		return 42;	//Return failure:  Could not buffer chart audio into memory
-	}
-	oggfile=alogg_create_ogg_from_buffer(oggbuffer, (int)file_size_ex(oggfn));
-	if(oggfile == NULL)
-	{
-		eof_log("ALOGG failed to open input audio file", 1);
-		free(oggbuffer);
-		return 43;	//Return failure:  Could not process buffered chart audio
-	}
-
-	//Decode OGG into memory
-	decoded=alogg_create_sample_from_ogg(oggfile);
-	if(decoded == NULL)
-	{
-		eof_log("Leading silence re-encode: ALOGG failed to decode input audio file", 1);
-		alogg_destroy_ogg(oggfile);
-		free(oggbuffer);
+		eof_log("Leading silence re-encode: Failed to decode input audio file", 1);
 		return 44;	//Return failure:  Could not decode chart audio to memory
 	}
 
-	/* Create a SAMPLE array large enough for the leading silence and the decoded OGG */
-	bits = alogg_get_wave_bits_ogg(oggfile);
-	stereo = alogg_get_wave_is_stereo_ogg(oggfile);
-	freq = alogg_get_wave_freq_ogg(oggfile);
-	alogg_destroy_ogg(oggfile);	//This is no longer needed
-	oggfile = NULL;
-	samples = msec_to_samples(ms);
-	channels = stereo ? 2 : 1;
-	combined = create_sample(bits,stereo,freq,samples+decoded->len);	//Create a sample array long enough for the silence and the OGG file
-	if(combined == NULL)
-	{
-		char *temp;
-		unsigned long allocation_size = (bits / 8) * (stereo ? 2 : 1) * (samples+decoded->len);
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tcreate_sample() failed (presumably couldn't allocate %lu bytes", allocation_size);
-		eof_log(eof_log_string, 1);
-		temp = malloc(allocation_size);	//Just for fun, see if malloc can allocate this manually
-		if(temp)
-		{
-			eof_log("\t\tmalloc() of that amount of memory succeeded...", 1);
-			free(temp);
-		}
-		else
-		{
-			eof_log("\t\tmalloc() of that amount of memory also failed.", 1);
-		}
-		free(oggbuffer);
-		destroy_sample(decoded);
-		return 45;	//Return failure:  Could not create a sample array for the combined audio
-	}
-
-	/* Add the PCM data for the silence */
-	if(bits == 8)
-	{	//Create 8 bit PCM data
-		for(ctr=0,index=0;ctr < samples * channels;ctr++)
-		{
-			((unsigned char *)(combined->data))[index++] = 0x80;
-		}
-	}
-	else
-	{	//Create 16 bit PCM data
-		for(ctr=0,index=0;ctr < samples * channels;ctr++)
-		{
-			((unsigned short *)(combined->data))[index++] = 0x8000;
-		}
-	}
-
-	/* Add the decoded OGG PCM data*/
-	if(bits == 8)
-	{	//Copy 8 bit PCM data
-		for(ctr=0;ctr < decoded->len * channels;ctr++)
-		{
-			((unsigned char *)(combined->data))[index++] = ((unsigned char *)(decoded->data))[ctr];
-		}
-	}
-	else
-	{	//Copy 16 bit PCM data
-		for(ctr=0;ctr < decoded->len * channels;ctr++)
-		{
-			((unsigned short *)(combined->data))[index++] = ((unsigned short *)(decoded->data))[ctr];
-		}
-	}
-
-	/* encode the audio */
-	destroy_sample(decoded);	//This is no longer needed
-	free(oggbuffer);
-	(void) replace_filename(wavfn, eof_song_path, "encode.wav", 1024);
-	(void) save_wav(wavfn, combined);
-	destroy_sample(combined);	//This is no longer needed
-	(void) replace_filename(soggfn, eof_song_path, "encode.ogg", 1024);
-
-	//Obtain an appropriate bitrate
-	if(eof_ogg_settings())
-	{	//If the user selected an OGG encoding quality
-		bitrate = eof_ogg_list_bitrate(eof_ogg_setting);		//Use it for the conversion below
-	}
-	else
-	{	//Automatically pick a bitrate based on the current chart audio
-		eof_log("\tUsing current chart audio bitrate as the re-encode bitrate", 1);
-		bitrate = alogg_get_bitrate_ogg(eof_music_track) / 1000;
-	}
-
-	if(!bitrate)
-	{	//A user found that in an audio file with a really high sample rate (ie. 96KHz), alogg_get_bitrate_ogg() may return zero instead of an expected value
-		bitrate = 256;	//In case this happens, use a bitrate of 256Kbps, which should be good enough for a very high quality file
-	}
-	#ifdef ALLEGRO_WINDOWS
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc2 -o \"%s\" -b %d \"%s\"", soggfn, bitrate, wavfn);
-	#else
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc -o \"%s\" -b %d \"%s\"", soggfn, bitrate, wavfn);
-	#endif
-
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCalling oggenc as follows:  %s", sys_command);
-	eof_log(eof_log_string, 1);
-	if(eof_system(sys_command))
-	{	//If oggenc failed, retry again by specifying a quality level (specifying bitrate can fail in some circumstances)
-		eof_log("\t\toggenc failed.  Retrying by specifying a quality level instead of a target bitrate", 1);
-		#ifdef ALLEGRO_WINDOWS
-			(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc2 -o \"%s\" -q 9 \"%s\"", soggfn, wavfn);
-		#else
-			(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc -o \"%s\" -q 9 \"%s\"", soggfn, wavfn);
-		#endif
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCalling oggenc as follows:  %s", sys_command);
-		eof_log(eof_log_string, 1);
-		if(eof_system(sys_command))
-		{	//If oggenc failed again
-			char tempfname[30] = {0};
-			char redirect[35] = {0};
-
-			if(eof_validate_temp_folder())
-			{	//Ensure the correct working directory and presence of the temporary folder
-				eof_log("\tCould not validate working directory and temp folder", 1);
-				return 46;	//Return failure:  Could not validate cwd and temp folder
-			}
-
-			(void) snprintf(tempfname, sizeof(tempfname) - 1, "%soggenc.log", eof_temp_path_s);
-			(void) snprintf(redirect, sizeof(redirect) - 1, " 2> %s", tempfname);
-			(void) ustrzcat(sys_command, (int) sizeof(sys_command) - 1, redirect);	//Append a redirection to the command to capture the output of oggenc
-			if(eof_system(sys_command))
-			{	//Run one last time to catch the error output
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tOggenc failed.  Please see %s for any errors it gave.", tempfname);
-				eof_log(eof_log_string, 1);
-				eof_fix_window_title();
-				return 47;	//Return failure:  Could not encode combined audio
-			}
-		}
+	/* encode the silence followed by the decoded audio, streaming it to the encoder instead of building the combined audio in memory */
+	bitrate = eof_add_silence_recode_bitrate();
+	if(!eof_encode_ogg_with_leading_silence(oggfn, pcm->audio, msec_to_samples(ms), bitrate))
+	{
+		eof_log("\tFailed to encode the combined audio", 1);
+		eof_pcm_cache_release(pcm);
+		(void) eof_copy_file(backupfn, oggfn);	//Restore the original OGG file
+		eof_fix_window_title();
+		return 47;	//Return failure:  Could not encode combined audio
 	}
+	eof_pcm_cache_release(pcm);	//This is no longer needed
 
-	/* replace the current OGG file with the new file */
-	(void) eof_copy_file(soggfn, oggfn);	//Copy encode.ogg to the filename of the original OGG
-
-	/* clean up */
-	(void) delete_file(soggfn);	//Delete encode.ogg
-	(void) delete_file(wavfn);		//Delete encode.wav
 	if(eof_load_ogg(oggfn, 0))
 	{	//If the combined audio was loaded
 		eof_fix_waveform_graph();
@@ -494,16 +1180,9 @@ int eof_add_silence_recode_mp3(char * oggfn, unsigned long ms)
 	char sys_command[1024] = {0};
 	char backupfn[1024] = {0};
 	char wavfn[1024] = {0};
-	char soggfn[1024] = {0};
 	char mp3fn[1024] = {0};
 	SAMPLE * decoded = NULL;
-	SAMPLE * combined = NULL;
-	int bits;
-	int stereo;
-	int freq;
 	unsigned long samples;
-	int channels;
-	unsigned long ctr,index;
 	int bitrate;
 
  	eof_log("eof_add_silence_recode_mp3() entered", 1);
@@ -531,146 +1210,24 @@ int eof_add_silence_recode_mp3(char * oggfn, unsigned long ms)
 	decoded = load_sample(wavfn);
 	if(!decoded)
 	{
-		allegro_message("Error opening file.\nMake sure there are no Unicode or extended ASCII characters in this chart's file path.");
+		eof_message("Error opening file.\nMake sure there are no Unicode or extended ASCII characters in this chart's file path.");
 		return 22;	//Return failure:  Could not load decoded MP3 file
 	}
-	bits = decoded->bits;
-	stereo = decoded->stereo;
-	freq = decoded->freq;
+	(void) delete_file(wavfn);		//Delete decode.wav
 	samples = (decoded->freq * ms) / 1000;	//Calculate this manually instead of using msec_to_samples() because that function assumes the sample rate matches the current chart audio, and this may not be the case with the original MP3 file the user provided
-	channels = stereo ? 2 : 1;
-	combined = create_sample(bits,stereo,freq,samples+decoded->len);	//Create a sample array long enough for the silence and the OGG file
-	if(combined == NULL)
-	{
-		char *temp;
-		unsigned long allocation_size = (bits / 8) * (stereo ? 2 : 1) * (samples+decoded->len);
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tcreate_sample() failed (presumably couldn't allocate %lu bytes)", allocation_size);
-		eof_log(eof_log_string, 1);
-		temp = malloc(allocation_size);	//Just for fun, see if malloc can allocate this manually
-		if(temp)
-		{
-			eof_log("\t\tmalloc() of that amount of memory succeeded...", 1);
-			free(temp);
-		}
-		else
-		{
-			eof_log("\t\tmalloc() of that amount of memory also failed.", 1);
-		}
-		destroy_sample(decoded);
-		return 23;	//Return failure:  Could not create a sample array for the combined audio
-	}
-	/* Add the PCM data for the silence */
-	if(bits == 8)
-	{	//Create 8 bit PCM data
-		for(ctr=0,index=0;ctr < samples * channels;ctr++)
-		{
-			((unsigned char *)(combined->data))[index++] = 0x80;
-		}
-	}
-	else
-	{	//Create 16 bit PCM data
-		for(ctr=0,index=0;ctr < samples * channels;ctr++)
-		{
-			((unsigned short *)(combined->data))[index++] = 0x8000;
-		}
-	}
-	/* Add the decoded OGG PCM data*/
-	if(bits == 8)
-	{	//Copy 8 bit PCM data
-		for(ctr=0;ctr < decoded->len * channels;ctr++)
-		{
-			((unsigned char *)(combined->data))[index++] = ((unsigned char *)(decoded->data))[ctr];
-		}
-	}
-	else
-	{	//Copy 16 bit PCM data
-		for(ctr=0;ctr < decoded->len * channels;ctr++)
-		{
-			((unsigned short *)(combined->data))[index++] = ((unsigned short *)(decoded->data))[ctr];
-		}
-	}
 
-	/* save combined WAV */
-	(void) replace_filename(wavfn, eof_song_path, "encode.wav", 1024);
-	if(!save_wav(wavfn, combined))
+	/* encode the audio */
+	bitrate = eof_add_silence_recode_bitrate();
+	if(!eof_encode_ogg_with_leading_silence(oggfn, decoded, samples, bitrate))
 	{
-		destroy_sample(decoded);	//This is no longer needed
-		destroy_sample(combined);	//This is no longer needed
-		return 24;	//Return failure:  Could not create the combined audio WAV file
+		eof_log("\tFailed to encode the combined audio", 1);
+		destroy_sample(decoded);
+		(void) eof_copy_file(backupfn, oggfn);	//Restore the original OGG file
+		eof_fix_window_title();
+		return 26;	//Return failure:  Could not encode combined audio
 	}
-
-	/* destroy samples */
 	destroy_sample(decoded);	//This is no longer needed
-	destroy_sample(combined);	//This is no longer needed
 
-	/* encode the audio */
-	//Obtain an appropriate bitrate
-	if(eof_ogg_settings())
-	{	//If the user selected an OGG encoding quality
-		bitrate = eof_ogg_list_bitrate(eof_ogg_setting);		//Use it for the conversion below
-	}
-	else
-	{	//Automatically pick a bitrate based on the current chart audio
-		eof_log("\tUsing current chart audio bitrate as the re-encode bitrate", 1);
-		bitrate = alogg_get_bitrate_ogg(eof_music_track) / 1000;
-	}
-	if(!bitrate)
-	{	//A user found that in an audio file with a really high sample rate (ie. 96KHz), alogg_get_bitrate_ogg() may return zero instead of an expected value
-		bitrate = 256;	//In case this happens, use a bitrate of 256Kbps, which should be good enough for a very high quality file
-	}
-
-	(void) replace_filename(soggfn, eof_song_path, "encode.ogg", 1024);
-	#ifdef ALLEGRO_WINDOWS
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc2 -o \"%s\" -b %d \"%s\"", soggfn, bitrate, wavfn);
-	#else
-		(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc -o \"%s\" -b %d \"%s\"", soggfn, bitrate, wavfn);
-	#endif
-
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCalling oggenc as follows:  %s", sys_command);
-	eof_log(eof_log_string, 1);
-	if(eof_system(sys_command))
-	{	//If oggenc failed, retry again by specifying a quality level (specifying bitrate can fail in some circumstances)
-		eof_log("\t\toggenc failed.  Retrying by specifying a quality level instead of a target bitrate", 1);
-		#ifdef ALLEGRO_WINDOWS
-			(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc2 -o \"%s\" -q 9 \"%s\"", soggfn, wavfn);
-		#else
-			(void) uszprintf(sys_command, (int) sizeof(sys_command) - 1, "oggenc -o \"%s\" -q 9 \"%s\"", soggfn, wavfn);
-		#endif
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCalling oggenc as follows:  %s", sys_command);
-		eof_log(eof_log_string, 1);
-		if(eof_system(sys_command))
-		{	//If oggenc failed again
-			char tempfname[30] = {0};
-			char redirect[35] = {0};
-
-			if(eof_validate_temp_folder())
-			{	//Ensure the correct working directory and presence of the temporary folder
-				eof_log("\tCould not validate working directory and temp folder", 1);
-				return 25;	//Return failure:  Could not validate cwd and temp folder
-			}
-
-			(void) snprintf(tempfname, sizeof(tempfname) - 1, "%soggenc.log", eof_temp_path_s);
-			(void) snprintf(redirect, sizeof(redirect) - 1, " 2> %s", tempfname);
-			(void) ustrzcat(sys_command, (int) sizeof(sys_command) - 1, redirect);	//Append a redirection to the command to capture the output of oggenc
-			if(eof_system(sys_command))
-			{	//Run one last time to catch the error output
-				(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tOggenc failed.  Please see %s for any errors it gave.", tempfname);
-				eof_log(eof_log_string, 1);
-				eof_fix_window_title();
-				return 26;	//Return failure:  Could not encode combined audio
-			}
-		}
-	}
-
-	/* replace the current OGG file with the new file */
-	(void) eof_copy_file(soggfn, oggfn);	//Copy encode.ogg to the filename of the original OGG
-
-	/* clean up */
-	(void) replace_filename(wavfn, eof_song_path, "decode.wav", 1024);
-	(void) delete_file(wavfn);		//Delete decode.wav
-	(void) replace_filename(wavfn, eof_song_path, "encode.wav", 1024);
-	(void) delete_file(wavfn);		//Delete encode.wav
-	(void) delete_file(soggfn);	//Delete encode.ogg
 	if(eof_load_ogg(oggfn, 0))
 	{	//If the combined audio was loaded
 		eof_fix_waveform_graph();
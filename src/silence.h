@@ -1,7 +1,7 @@
 #ifndef EOF_SILENCE_H
 #define EOF_SILENCE_H
 
-int eof_add_silence(char * oggfn, unsigned long ms);	//Backs up the currently loaded OGG file if it hasn't been already and appends it to an OGG (containing only silence) of the specified length
+int eof_add_silence(char * oggfn, unsigned long ms);	//Backs up the currently loaded OGG file if it hasn't been already and inserts silence of approximately the specified length at the beginning of its Vorbis stream
 SAMPLE * create_silence_sample(unsigned long ms);
 	//Creates and returns a SAMPLE array of the specified number of milliseconds' worth of silent PCM data, or NULL on error
 	//If a chart is loaded, the current OGG file's bitrate, frequency, etc. are used
@@ -12,10 +12,14 @@ int save_wav(const char * fn, SAMPLE * sp);
 	//Writes the specified sample to the specified file name in PCM WAV format
 	//Returns nonzero on success
 int eof_add_silence(char * oggfn, unsigned long ms);
-	//Backs up the specified OGG file and uses OggCat to insert the specified amount of silence at the beginning of the OGG file
+	//Backs up the specified OGG file and inserts the specified amount of silence at the beginning of the OGG file
+	//Silent packets are built from the original stream's own setup header and inserted after its header pages, and the granule positions and page numbers
+	// of the original audio pages are offset to follow them, so the result is a single logical stream and the original audio isn't re-encoded
+	//The silence's length is rounded to a whole number of blocks, the caller should measure the resulting audio length
+	//If the stream's headers can't be parsed, the original file is restored and error 6 is returned, in which case eof_add_silence_recode() can be used instead
 	//Returns nonzero on error
 int eof_add_silence_recode(char * oggfn, unsigned long ms);
-	//Backs up the specified OGG file and inserts the specified amount of silence at the beginning of the OGG file by processing in PCM WAV format and then re-encoding to OGG format
+	//Backs up the specified OGG file and inserts the specified amount of silence at the beginning of the OGG file by decoding it to memory and then re-encoding the silence and the decoded audio to OGG format in a single streaming pass
 	//Returns nonzero on error
 int eof_add_silence_recode_mp3(char * oggfn, unsigned long ms);
 	//Similar to eof_add_silence_recode(), but decodes the originally converted MP3 file instead of the OGG file, preserving as much of the original audio quality as possible
@@ -129,7 +129,7 @@ int eof_song_qsort_legacy_notes(const void * e1, const void * e2)
 	EOF_NOTE ** thing1 = (EOF_NOTE **)e1;
 	EOF_NOTE ** thing2 = (EOF_NOTE **)e2;
 
-//	allegro_message("%d\n%d", (*thing1)->pos, (*thing2)->pos);	//Debug
+//	eof_message("%d\n%d", (*thing1)->pos, (*thing2)->pos);	//Debug
 	//Sort first by chronological order
 	if((*thing1)->pos < (*thing2)->pos)
 	{
@@ -267,6 +267,13 @@ void eof_destroy_song(EOF_SONG * sp)
 	if(sp == NULL)
 		return;
 
+	eof_destroy_note_indexes(sp);	//Release any note indexes built for this project
+	if(eof_beat_stats_song == sp)
+	{	//If the cached beat statistics were built for this project
+		eof_beat_stats_song = NULL;
+		eof_beat_stats_cached = 0;
+	}
+
 	if((sp == eof_song) && !eof_undo_in_progress)
 	{	//If the active project is being closed, and this function isn't being called by the undo/redo logic
 		//De-activate the waveform if applicable
@@ -304,6 +311,10 @@ void eof_destroy_song(EOF_SONG * sp)
 	eof_log("\tProject closed", 1);
 	if(eof_recovery && (sp == eof_song))
 	{	//If this EOF instance is maintaining an auto-recovery file, and the currently-open song is being destroyed
+		if(!eof_undo_in_progress)
+		{	//Unless an undo/redo is replacing the project, don't let a pending snapshot recreate the file after it is deleted
+			eof_undo_discard_recovery();
+		}
 		(void) snprintf(eof_recover_path, sizeof(eof_recover_path) - 1, "%seof.recover", eof_temp_path_s);
 		(void) delete_file(eof_recover_path);	//Delete it when the active project is cleanly closed
 	}
@@ -316,6 +327,7 @@ void eof_destroy_song(EOF_SONG * sp)
 
 EOF_SONG * eof_load_song(const char * fn)
 {
+	EOF_MEMORY_FILE mf = {0};
 	PACKFILE * fp = NULL;
 	EOF_SONG * sp = NULL;
 	char header[16] = {'E', 'O', 'F', 'S', 'O', 'N', 'H', 0};	//This header represents the current project format
@@ -328,13 +340,20 @@ EOF_SONG * eof_load_song(const char * fn)
 	{
 		return 0;
 	}
-	fp = pack_fopen(fn, "r");
-	if(!fp)
+	//Read the whole project into memory, so the chunk table of contents at the end of the file can be used while loading
+	if(!eof_memory_file_load(&mf, fn))
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError loading:  Cannot open input .eof file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError loading:  Cannot read input .eof file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
 		eof_log(eof_log_string, 1);
 		return 0;
 	}
+	fp = eof_pack_fopen_memory(&mf);
+	if(!fp)
+	{
+		eof_memory_file_free(&mf);
+		eof_log("\tError loading:  Cannot open memory file", 1);
+		return 0;
+	}
 
 	(void) pack_fread(rheader, 16, fp);
 	if(!ustricmp(rheader, header))
@@ -343,12 +362,14 @@ EOF_SONG * eof_load_song(const char * fn)
 		if(!sp)
 		{
 			(void) pack_fclose(fp);
+			eof_memory_file_free(&mf);
 			return NULL;
 		}
 		sp->tags->accurate_ts = 0;	//For existing projects, this setting must be manually enabled in order to prevent unwanted alteration to beat timings
 		if(!eof_load_song_pf(sp, fp))
 		{
 			(void) pack_fclose(fp);
+			eof_memory_file_free(&mf);
 			eof_destroy_song(sp);	//Destroy the song and return on error
 			return NULL;
 		}
@@ -358,6 +379,7 @@ EOF_SONG * eof_load_song(const char * fn)
 			{	//If the track failed to be added
 				eof_destroy_song(sp);	//Destroy the song and return on error
 				(void) pack_fclose(fp);
+				eof_memory_file_free(&mf);
 				return NULL;
 			}
 		}
@@ -367,6 +389,7 @@ EOF_SONG * eof_load_song(const char * fn)
 			{	//If the track failed to be added
 				eof_destroy_song(sp);	//Destroy the song and return on error
 				(void) pack_fclose(fp);
+				eof_memory_file_free(&mf);
 				return NULL;
 			}
 		}
@@ -376,6 +399,7 @@ EOF_SONG * eof_load_song(const char * fn)
 			{	//If the track failed to be added
 				eof_destroy_song(sp);	//Destroy the song and return on error
 				(void) pack_fclose(fp);
+				eof_memory_file_free(&mf);
 				return NULL;
 			}
 		}
@@ -385,6 +409,7 @@ EOF_SONG * eof_load_song(const char * fn)
 			{	//If the track failed to be added
 				eof_destroy_song(sp);	//Destroy the song and return on error
 				(void) pack_fclose(fp);
+				eof_memory_file_free(&mf);
 				return NULL;
 			}
 		}
@@ -394,6 +419,7 @@ EOF_SONG * eof_load_song(const char * fn)
 			{	//If the track failed to be added
 				eof_destroy_song(sp);	//Destroy the song and return on error
 				(void) pack_fclose(fp);
+				eof_memory_file_free(&mf);
 				return NULL;
 			}
 		}
@@ -403,6 +429,7 @@ EOF_SONG * eof_load_song(const char * fn)
 		sp = eof_load_notes_legacy(fp, rheader[6]);
 	}
 	(void) pack_fclose(fp);
+	eof_memory_file_free(&mf);
 
 //Update path variables
 	(void) ustrcpy(eof_filename, fn);
@@ -415,14 +442,74 @@ EOF_SONG * eof_load_song(const char * fn)
 	return sp;
 }
 
+static void *eof_song_grow_array(void *array, unsigned long *capacity, unsigned long count, size_t elementsize)
+{
+	unsigned long newcapacity;
+	char *ptr;
+
+	if(!capacity || !count || !elementsize)
+		return NULL;	//Invalid parameters
+
+	//Double the capacity until it is large enough, so that adding notes one at a time doesn't reallocate every time
+	newcapacity = *capacity ? *capacity : EOF_MIN_NOTE_CAPACITY;
+	while(newcapacity < count)
+	{
+		if(newcapacity > ULONG_MAX / 2)
+		{	//If doubling again would overflow
+			newcapacity = count;
+			break;
+		}
+		newcapacity *= 2;
+	}
+	if(newcapacity <= *capacity)
+		return array;	//The array is already large enough
+	if(newcapacity > (size_t)-1 / elementsize)
+		return NULL;	//The array can't be addressed
+
+	ptr = realloc(array, (size_t)newcapacity * elementsize);
+	if(!ptr)
+		return NULL;	//The original array is left intact
+
+	memset(ptr + (size_t)*capacity * elementsize, 0, (size_t)(newcapacity - *capacity) * elementsize);	//Initialize the new entries
+	*capacity = newcapacity;
+	return ptr;
+}
+
+int eof_legacy_track_reserve_notes(EOF_LEGACY_TRACK * tp, unsigned long count)
+{
+	EOF_NOTE **array;
+
+	if(!tp || !eof_selection_reserve(count))
+		return 0;	//Invalid parameter or the selection array couldn't be grown
+	if(count <= tp->note_capacity)
+		return 1;	//The array is already large enough
+
+	array = eof_song_grow_array(tp->note, &tp->note_capacity, count, sizeof(EOF_NOTE *));
+	if(!array)
+		return 0;	//Error
+	tp->note = array;
+
+	return 1;
+}
+
+void eof_free_legacy_track(EOF_LEGACY_TRACK * tp)
+{
+	if(!tp)
+		return;
+
+	free(tp->note);
+	free(tp);
+}
+
 EOF_NOTE * eof_legacy_track_add_note(EOF_LEGACY_TRACK * tp)
 {
-	if(tp && (tp->notes < EOF_MAX_NOTES))
+	if(tp && eof_legacy_track_reserve_notes(tp, tp->notes + 1))
 	{
 		tp->note[tp->notes] = malloc(sizeof(EOF_NOTE));
 		if(tp->note[tp->notes])
 		{
 			memset(tp->note[tp->notes], 0, sizeof(EOF_NOTE));
+			tp->note[tp->notes]->name = eof_intern_note_name(NULL);
 			tp->notes++;
 			return tp->note[tp->notes - 1];
 		}
@@ -510,7 +597,7 @@ void eof_legacy_track_fixup_notes(EOF_SONG *sp, unsigned long track, int sel)
 		{
 			eof_selection.multi[eof_selection.current] = 0;
 		}
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	maxlane = tp->numlanes;
 	if((maxlane < 6) && ((tp->parent->track_behavior == EOF_DRUM_TRACK_BEHAVIOR) || (tp->parent->track_type == EOF_TRACK_BASS)))
@@ -914,9 +1001,26 @@ void eof_legacy_track_delete_solo(EOF_LEGACY_TRACK * tp, unsigned long index)
 	tp->solos--;
 }
 
+int eof_vocal_track_reserve_lyrics(EOF_VOCAL_TRACK * tp, unsigned long count)
+{
+	EOF_LYRIC **array;
+
+	if(!tp || !eof_selection_reserve(count))
+		return 0;	//Invalid parameter or the selection array couldn't be grown
+	if(count <= tp->lyric_capacity)
+		return 1;	//The array is already large enough
+
+	array = eof_song_grow_array(tp->lyric, &tp->lyric_capacity, count, sizeof(EOF_LYRIC *));
+	if(!array)
+		return 0;	//Error
+	tp->lyric = array;
+
+	return 1;
+}
+
 EOF_LYRIC * eof_vocal_track_add_lyric(EOF_VOCAL_TRACK * tp)
 {
-	if(tp && (tp->lyrics < EOF_MAX_LYRICS))
+	if(tp && eof_vocal_track_reserve_lyrics(tp, tp->lyrics + 1))
 	{
 		tp->lyric[tp->lyrics] = malloc(sizeof(EOF_LYRIC));
 		if(tp->lyric[tp->lyrics])
@@ -995,7 +1099,7 @@ void eof_vocal_track_fixup_lyrics(EOF_SONG *sp, unsigned long track, int sel)
 		{
 			eof_selection.multi[eof_selection.current] = 0;
 		}
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	for(i = tp->lyrics; i > 0; i--)
 	{	//For each lyric, in reverse order
@@ -1401,17 +1505,13 @@ void eof_toggle_freestyle(EOF_VOCAL_TRACK * tp, unsigned long lyricnumber)
 
 double eof_calc_beat_length(EOF_SONG *sp, unsigned long beat)
 {
-	unsigned long ctr;
 	unsigned num = 4, den = 4;
 	double ms = 500.0;
 
 	if(!sp || (beat >= sp->beats))
 		return 0.0;	//Invalid parameters
 
-	for(ctr = 0; ctr <= beat; ctr++)
-	{	//For each beat, including the target
-		(void) eof_get_ts(sp, &num, &den, ctr);	//Lookup any time signature defined at the beat
-	}
+	(void) eof_get_effective_ts(sp, &num, &den, beat, 0);	//Lookup the time signature in effect at the beat
 
 	ms = (60000.0 / (60000000.0 / (double)sp->beat[beat]->ppqn));	//Get the length of a quarter note based on the tempo in effect
 	if(sp->tags->accurate_ts && (den != 4))
@@ -1540,7 +1640,9 @@ int eof_song_add_track(EOF_SONG * sp, EOF_TRACK_ENTRY * trackdetails)
 				free(ptr3);
 				return 0;	//Return error
 			}
+			ptr->note = NULL;	//The note array is allocated when the first note is added
 			ptr->notes = 0;
+			ptr->note_capacity = 0;
 			ptr->solos = 0;
 			ptr->star_power_paths = 0;
 			ptr->trills = 0;
@@ -1570,7 +1672,9 @@ int eof_song_add_track(EOF_SONG * sp, EOF_TRACK_ENTRY * trackdetails)
 				free(ptr3);
 				return 0;	//Return error
 			}
+			ptr2->lyric = NULL;
 			ptr2->lyrics = 0;
+			ptr2->lyric_capacity = 0;
 			ptr2->lines = 0;
 			ptr2->parent = ptr3;
 			sp->vocal_track[sp->vocal_tracks] = ptr2;
@@ -1583,13 +1687,12 @@ int eof_song_add_track(EOF_SONG * sp, EOF_TRACK_ENTRY * trackdetails)
 			unsigned maxfrets1 = 24, maxfrets2 = 24;	//Rocksmith 2 supports 24 frets per arrangement
 
 			count = sp->pro_guitar_tracks;
-			ptr4 = malloc(sizeof(EOF_PRO_GUITAR_TRACK));
+			ptr4 = eof_create_pro_guitar_track();
 			if(ptr4 == NULL)
 			{
 				free(ptr3);
 				return 0;	//Return error
 			}
-			memset(ptr4, 0, sizeof(EOF_PRO_GUITAR_TRACK));	//Initialize memory block to 0 to avoid crashes when not explicitly setting counters that were newly added to the pro guitar structure
 			if(eof_write_rs_files)
 			{	//If RS1 export is enabled
 				maxfrets1 = 22;	//RS1 only support 22 frets
@@ -1620,7 +1723,7 @@ int eof_song_add_track(EOF_SONG * sp, EOF_TRACK_ENTRY * trackdetails)
 			if(ptr4->numstrings > EOF_TUNING_LENGTH)	//Ensure that the tuning array is large enough
 			{
 				free(ptr3);
-				free(ptr4);
+				eof_free_pro_guitar_track(ptr4);
 				return 0;	//Return error
 			}
 			ptr4->defaulttone[0] = '\0';	//Ensure this string is emptied
@@ -1675,7 +1778,7 @@ int eof_song_delete_track(EOF_SONG * sp, unsigned long track)
 		case EOF_LEGACY_TRACK_FORMAT:
 			if((sp->track[track]->tracknum >= sp->legacy_tracks) || (sp->legacy_track[sp->track[track]->tracknum] == NULL))
 				return 0;	//Cannot remove a legacy track that doesn't exist
-			free(sp->legacy_track[sp->track[track]->tracknum]);
+			eof_free_legacy_track(sp->legacy_track[sp->track[track]->tracknum]);
 			for(ctr = sp->track[track]->tracknum; ctr + 1 < sp->legacy_tracks; ctr++)
 			{
 				sp->legacy_track[ctr] = sp->legacy_track[ctr + 1];
@@ -1685,6 +1788,7 @@ int eof_song_delete_track(EOF_SONG * sp, unsigned long track)
 		case EOF_VOCAL_TRACK_FORMAT:
 			if((sp->track[track]->tracknum >= sp->vocal_tracks) || (sp->vocal_track[sp->track[track]->tracknum] == NULL))
 				return 0;	//Cannot remove a vocal track that doesn't exist
+			free(sp->vocal_track[sp->track[track]->tracknum]->lyric);
 			free(sp->vocal_track[sp->track[track]->tracknum]);
 			for(ctr = sp->track[track]->tracknum; ctr + 1 < sp->vocal_tracks; ctr++)
 			{
@@ -1697,7 +1801,7 @@ int eof_song_delete_track(EOF_SONG * sp, unsigned long track)
 		case EOF_PRO_GUITAR_TRACK_FORMAT:
 			if((sp->track[track]->tracknum >= sp->pro_guitar_tracks) || (sp->pro_guitar_track[sp->track[track]->tracknum] == NULL))
 				return 0;	//Cannot remove a pro guitar track that doesn't exist
-			free(sp->pro_guitar_track[sp->track[track]->tracknum]);
+			eof_free_pro_guitar_track(sp->pro_guitar_track[sp->track[track]->tracknum]);
 			for(ctr = sp->track[track]->tracknum; ctr + 1 < sp->pro_guitar_tracks; ctr++)
 			{
 				sp->pro_guitar_track[ctr] = sp->pro_guitar_track[ctr + 1];
@@ -1728,11 +1832,13 @@ int eof_song_delete_track(EOF_SONG * sp, unsigned long track)
 void eof_read_pro_guitar_note(EOF_PRO_GUITAR_NOTE *ptr, PACKFILE *fp)
 {
 	unsigned long ctr, bitmask;
+	char name[EOF_NAME_LENGTH + 1] = {0};
 
 	if(!ptr || !fp)
 		return;	//Invalid parameters
 
-	(void) eof_load_song_string_pf(ptr->name,fp,EOF_NAME_LENGTH);	//Read the note's name
+	(void) eof_load_song_string_pf(name,fp,EOF_NAME_LENGTH);	//Read the note's name
+	ptr->name = eof_intern_note_name(name);
 	(void) pack_getc(fp);											//Read the chord's number (not supported yet)
 	ptr->type = pack_getc(fp);		//Read the note's difficulty
 	ptr->note = pack_getc(fp);		//Read note bitflags
@@ -1774,6 +1880,94 @@ void eof_read_pro_guitar_note(EOF_PRO_GUITAR_NOTE *ptr, PACKFILE *fp)
 	}
 }
 
+static unsigned long eof_chunk_toc_getl(const unsigned char *ptr)
+{
+	return (unsigned long)ptr[0] | ((unsigned long)ptr[1] << 8) | ((unsigned long)ptr[2] << 16) | ((unsigned long)ptr[3] << 24);
+}
+
+unsigned long eof_read_chunk_toc(const unsigned char *buffer, unsigned long size, EOF_CHUNK_TOC_ENTRY *toc)
+{
+	unsigned long count, ctr, tocsize, datasize;
+	const unsigned char *ptr;
+
+	if(!buffer || !toc || (size < 8))
+		return 0;	//Invalid parameters
+	if(eof_chunk_toc_getl(&buffer[size - 4]) != EOF_CHUNK_TOC_SIGNATURE)
+		return 0;	//The file has no table of contents (ie. it was written by an older release of EOF)
+
+	count = eof_chunk_toc_getl(&buffer[size - 8]);	//Read the number of entries
+	if(!count || (count > EOF_CHUNK_TOC_MAX))
+		return 0;	//Invalid entry count
+	tocsize = (count * 16) + 8;
+	if(tocsize > size)
+		return 0;	//The table of contents is larger than the file
+	datasize = size - tocsize;	//The chunks must all be before the table of contents
+
+	ptr = &buffer[datasize];
+	for(ctr = 0; ctr < count; ctr++, ptr += 16)
+	{	//For each entry
+		toc[ctr].type = eof_chunk_toc_getl(ptr);
+		toc[ctr].index = eof_chunk_toc_getl(ptr + 4);
+		toc[ctr].offset = eof_chunk_toc_getl(ptr + 8);
+		toc[ctr].size = eof_chunk_toc_getl(ptr + 12);
+		if((toc[ctr].offset > datasize) || (toc[ctr].size > datasize - toc[ctr].offset))
+			return 0;	//This chunk isn't within the file's data
+	}
+
+	return count;
+}
+
+EOF_CHUNK_TOC_ENTRY *eof_find_chunk(EOF_CHUNK_TOC_ENTRY *toc, unsigned long count, unsigned long type, unsigned long index)
+{
+	unsigned long ctr;
+
+	if(!toc)
+		return NULL;	//Invalid parameter
+
+	for(ctr = 0; ctr < count; ctr++)
+	{	//For each entry in the table of contents
+		if((toc[ctr].type == type) && (toc[ctr].index == index))
+			return &toc[ctr];
+	}
+
+	return NULL;	//Not found
+}
+
+static void eof_seek_chunk(EOF_MEMORY_FILE *mf, EOF_CHUNK_TOC_ENTRY *toc, unsigned long count, unsigned long type, unsigned long index)
+{
+	EOF_CHUNK_TOC_ENTRY *chunk;
+
+	if(!mf)
+		return;	//Not loading from memory
+
+	chunk = eof_find_chunk(toc, count, type, index);
+	if(chunk && (mf->pos != chunk->offset))
+	{	//If the previous section wasn't read up to exactly where this chunk begins (ie. it has data written by a newer release of EOF)
+		eof_logf(1, "\tChunk type %lu (#%lu) begins at offset %lu instead of %lu.  Resuming from the offset in the table of contents", type, index, chunk->offset, mf->pos);
+		mf->pos = chunk->offset;
+	}
+}
+
+static void eof_chunk_toc_begin(EOF_MEMORY_FILE *mf, EOF_CHUNK_TOC_ENTRY *toc, unsigned long count, unsigned long type, unsigned long index)
+{
+	if(!mf || (count >= EOF_CHUNK_TOC_MAX))
+		return;	//Not saving to memory, or the table of contents is full
+
+	toc[count].type = type;
+	toc[count].index = index;
+	toc[count].offset = mf->pos;
+	toc[count].size = 0;
+}
+
+static void eof_chunk_toc_end(EOF_MEMORY_FILE *mf, EOF_CHUNK_TOC_ENTRY *toc, unsigned long *count)
+{
+	if(!mf || (*count >= EOF_CHUNK_TOC_MAX))
+		return;	//Not saving to memory, or the table of contents is full
+
+	toc[*count].size = mf->pos - toc[*count].offset;
+	(*count)++;
+}
+
 int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 {
 	unsigned char inputc;
@@ -1803,11 +1997,19 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 	unsigned char numdiffs;
 	char unshare_drum_phrasing;
 	EOF_PRO_GUITAR_TRACK *tp = NULL;
+	EOF_MEMORY_FILE *mf = eof_pack_memory_file(fp);	//If reading from memory, the chunk table of contents can be used to locate each section
+	EOF_CHUNK_TOC_ENTRY toc[EOF_CHUNK_TOC_MAX];
+	unsigned long toc_count = 0;
 
  	eof_log("eof_load_song_pf() entered", 1);
 
 	if((sp == NULL) || (fp == NULL))
 		return 0;	//Return failure
+	if(mf)
+	{	//If the project is buffered in memory, look for the chunk table of contents at its end
+		toc_count = eof_read_chunk_toc(mf->buffer, mf->size, toc);
+		eof_logf(2, "\tChunk table of contents entries:  %lu", toc_count);
+	}
 
 	unshare_drum_phrasing = sp->tags->unshare_drum_phrasing;	//Store this outside the project structure until load completes, so that both drum tracks' phrases can be loaded
 	sp->tags->unshare_drum_phrasing = 1;
@@ -1849,8 +2051,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 
 	/* read song properties */
 	count = pack_igetw(fp);			//Read the number of INI strings
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tINI string count:  %lu", count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tINI string count:  %lu", count);
 	for(ctr=0; ctr<count; ctr++)
 	{	//For each INI string in the project
 		inputc = pack_getc(fp);		//Read the type of INI string
@@ -1869,8 +2070,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 	}
 
 	count = pack_igetw(fp);			//Read the number of INI booleans
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tINI boolean count:  %lu", count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tINI boolean count:  %lu", count);
 	for(ctr=0; ctr<count; ctr++)
 	{	//For each INI boolean in the project
 		inputc = pack_getc(fp);		//Read the type of INI boolean
@@ -1881,8 +2081,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 	}
 
 	count = pack_igetw(fp);			//Read the number of INI numbers
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tINI number count:  %lu", count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tINI number count:  %lu", count);
 	for(ctr=0; ctr<count; ctr++)
 	{	//For each INI number in the project
 		inputc = pack_getc(fp);		//Read the type of INI number
@@ -1895,8 +2094,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 
 	/* read chart data */
 	count = pack_igetw(fp);			//Read the number of OGG profiles
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tOGG profile count:  %lu", count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tOGG profile count:  %lu", count);
 	sp->tags->oggs = 0;
 	for(ctr=0; ctr<count; ctr++)
 	{	//For each OGG profile in the project
@@ -1911,9 +2109,9 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 		}
 	}
 
+	eof_seek_chunk(mf, toc, toc_count, EOF_CHUNK_BEATS, 0);
 	count = pack_igetl(fp);					//Read the number of beats
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBeat count:  %lu", count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tBeat count:  %lu", count);
 	if(!eof_song_resize_beats(sp, count))	//Resize the beat array accordingly
 	{
 		eof_log("Error:  Couldn't resize beat array", 1);
@@ -1928,9 +2126,9 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 		sp->beat[ctr]->key = pack_getc(fp);			//Read the beat's key signature
 	}
 
+	eof_seek_chunk(mf, toc, toc_count, EOF_CHUNK_TEXT_EVENTS, 0);
 	count = pack_igetl(fp);				//Read the number of text events
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tText event count:  %lu", count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tText event count:  %lu", count);
 	if(!eof_song_resize_text_events(sp, count))	//Resize the text event array accordingly
 	{
 		eof_log("Error:  Couldn't resize text event array", 1);
@@ -1944,16 +2142,15 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 		sp->text_event[ctr]->flags = pack_igetw(fp);	//Read the text event's flags
 	}
 
+	eof_seek_chunk(mf, toc, toc_count, EOF_CHUNK_CUSTOM_DATA, 0);
 	custom_data_count = pack_igetl(fp);		//Read the number of custom data blocks
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tCustom data block count:  %lu", custom_data_count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tCustom data block count:  %lu", custom_data_count);
 	sp->tags->start_point = sp->tags->end_point = ULONG_MAX;	//These will both be considered undefined unless the project being loaded defines them
 	for(custom_data_ctr = 0; custom_data_ctr < custom_data_count; custom_data_ctr++)
 	{	//For each custom data block in the project
 		custom_data_size = pack_igetl(fp);	//Read the size of the custom data block
 		data_block_type = pack_igetl(fp);	//Read the data block type
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tData block type %lu, size %lu", data_block_type, custom_data_size);
-		eof_log(eof_log_string, 2);
+		eof_logf(2, "\t\tData block type %lu, size %lu", data_block_type, custom_data_size);
 		if(custom_data_size)
 		{	//If this data block is nonzero in size
 			if(data_block_type == 1)
@@ -2120,10 +2317,10 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 
 	/* read track data */
 	track_count = pack_igetl(fp);		//Read the number of tracks
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tTrack count:  %lu", track_count);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tTrack count:  %lu", track_count);
 	for(track_ctr=0; track_ctr<track_count; track_ctr++)
 	{	//For each track in the project
+		eof_seek_chunk(mf, toc, toc_count, EOF_CHUNK_TRACK, track_ctr);
 		(void) eof_load_song_string_pf(temp.name,fp,sizeof(temp.name));	//Read the track name
 		temp.track_format = pack_getc(fp);		//Read the track format
 		temp.track_behavior = pack_getc(fp);	//Read the track behavior
@@ -2152,10 +2349,10 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 			case EOF_LEGACY_TRACK_FORMAT:	//Legacy (non pro guitar, non pro bass, non pro keys, pro or non pro drums)
 				sp->legacy_track[sp->legacy_tracks-1]->numlanes = pack_getc(fp);	//Read the number of lanes/keys/etc. used in this track
 				count = pack_igetl(fp);	//Read the number of notes in this track
-				if(count > EOF_MAX_NOTES)
+				if(!eof_legacy_track_reserve_notes(sp->legacy_track[sp->legacy_tracks-1], count))
 				{
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unsupported number of notes in track %lu.  Aborting", track_ctr);
-					allegro_message("%s", eof_log_string);
+					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unable to allocate %lu notes in track %lu.  Aborting", count, track_ctr);
+					eof_message("%s", eof_log_string);
 					eof_log(eof_log_string, 1);
 					return 0;
 				}
@@ -2163,7 +2360,10 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 				for(ctr=0; ctr<count; ctr++)
 				{	//For each note in this track
 					EOF_NOTE *ptr = sp->legacy_track[sp->legacy_tracks-1]->note[ctr];	//Simplify
-					(void) eof_load_song_string_pf(ptr->name,fp,EOF_NAME_LENGTH);	//Read the note's name
+					char name[EOF_NAME_LENGTH + 1] = {0};
+
+					(void) eof_load_song_string_pf(name,fp,EOF_NAME_LENGTH);	//Read the note's name
+					ptr->name = eof_intern_note_name(name);
 					ptr->type = pack_getc(fp);		//Read the note's difficulty
 					ptr->note = pack_getc(fp);		//Read note bitflags
 					ptr->pos = pack_igetl(fp);		//Read note position
@@ -2179,10 +2379,10 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 			case EOF_VOCAL_TRACK_FORMAT:	//Vocal
 				(void) pack_getc(fp);	//Read the tone set number assigned to this track (not supported yet)
 				count = pack_igetl(fp);	//Read the number of notes in this track
-				if(count > EOF_MAX_LYRICS)
+				if(!eof_vocal_track_reserve_lyrics(sp->vocal_track[sp->vocal_tracks-1], count))
 				{
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unsupported number of lyrics in track %lu.  Aborting", track_ctr);
-					allegro_message("%s", eof_log_string);
+					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unable to allocate %lu lyrics in track %lu.  Aborting", count, track_ctr);
+					eof_message("%s", eof_log_string);
 					eof_log(eof_log_string, 1);
 					return 0;
 				}
@@ -2204,7 +2404,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 				}
 			break;
 			case EOF_PRO_KEYS_TRACK_FORMAT:	//Pro Keys
-				allegro_message("Error: Pro Keys not supported yet.  Aborting");
+				eof_message("Error: Pro Keys not supported yet.  Aborting");
 				eof_log("Error: Pro Keys not supported yet.  Aborting", 1);
 			return 0;
 			case EOF_PRO_GUITAR_TRACK_FORMAT:	//Pro Guitar/Bass
@@ -2215,7 +2415,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 				if(count > 8)
 				{
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unsupported number of strings in track %lu.  Aborting", track_ctr);
-					allegro_message("%s", eof_log_string);
+					eof_message("%s", eof_log_string);
 					eof_log(eof_log_string, 1);
 					return 0;
 				}
@@ -2223,7 +2423,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 				if(tp->numstrings > EOF_TUNING_LENGTH)
 				{	//Prevent overflow
 					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Unsupported number of strings in track %lu.  Aborting", track_ctr);
-					allegro_message("%s", eof_log_string);
+					eof_message("%s", eof_log_string);
 					eof_log(eof_log_string, 1);
 					return 0;
 				}
@@ -2232,10 +2432,10 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 					tp->tuning[ctr] = pack_getc(fp);	//Read the string's tuning
 				}
 				count = pack_igetl(fp);	//Read the number of notes in this track
-				if(count > EOF_MAX_NOTES)
+				if(!eof_pro_guitar_track_reserve_notes(tp, count, 0))
 				{
-					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unsupported number of notes in track %lu.  Aborting", track_ctr);
-					allegro_message("%s", eof_log_string);
+					(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Error: Unable to allocate %lu notes in track %lu.  Aborting", count, track_ctr);
+					eof_message("%s", eof_log_string);
 					eof_log(eof_log_string, 1);
 					return 0;
 				}
@@ -2252,10 +2452,10 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 				tp->parent->numdiffs = numdiffs;	//Update the track's difficulty count
 			break;
 			case EOF_PRO_VARIABLE_LEGACY_TRACK_FORMAT:	//Variable Lane Legacy (not implemented yet)
-				allegro_message("Error: Variable lane not supported yet.  Aborting");
+				eof_message("Error: Variable lane not supported yet.  Aborting");
 			return 0;
 			default://Unknown track type
-				allegro_message("Error: Unsupported track type.  Aborting");
+				eof_message("Error: Unsupported track type.  Aborting");
 				eof_log("Error: Unsupported track type.  Aborting", 1);
 			return 0;
 		}
@@ -2312,7 +2512,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This is invalid, the size needed to have included the 4 byte ID
 							char *error = "Error:  Invalid custom data block size (finger definitions).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2335,7 +2535,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//Corrupt file
 							char *error = "Error: Invalid pro guitar finger array data block.  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2346,7 +2546,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be 5 bytes long
 							char *error = "Error:  Invalid custom data block size (arrangement type).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2362,7 +2562,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be 5 bytes long
 							char *error = "Error:  Invalid custom data block size (track tuning not honored).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2381,7 +2581,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be 5 bytes long
 							char *error = "Error:  Invalid custom data block size (capo position).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2397,7 +2597,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be at least 8 bytes long
 							char *error = "Error:  Invalid custom data block size (tech notes).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2405,6 +2605,15 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//Ensure this logic only runs for a pro guitar track
 							tp = sp->pro_guitar_track[sp->pro_guitar_tracks-1];	//Redundant assignment of tp to resolve a false positive with Coverity
 							tp->technotes = pack_igetl(fp);	//Read the number of tech notes
+							if(!eof_pro_guitar_track_reserve_notes(tp, tp->technotes, 1))
+							{	//If the tech note array couldn't hold that many tech notes
+								char *error = "Error:  Unable to allocate memory for (tech notes).  Aborting";
+
+								tp->technotes = 0;
+								eof_message("%s", error);
+								eof_log(error, 1);
+								return 0;
+							}
 							for(ctr = 0; ctr < tp->technotes; ctr++)
 							{	//For each tech note in the custom data block
 								tp->technote[ctr] = malloc(sizeof(EOF_PRO_GUITAR_NOTE));	//Allocate memory for the tech note
@@ -2412,7 +2621,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 								{
 									char *error = "Error:  Unable to allocate memory for (tech notes).  Aborting";
 
-									allegro_message("%s", error);
+									eof_message("%s", error);
 									eof_log(error, 1);
 									return 0;
 								}
@@ -2431,7 +2640,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be at least 5 bytes long
 							char *error = "Error:  Invalid custom data block size (accent note bitmasks).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2449,7 +2658,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be 5 bytes long
 							char *error = "Error:  Invalid custom data block size (track difficulty count).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2465,7 +2674,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be at least 5 bytes long
 							char *error = "Error:  Invalid custom data block size (SP deploy bitmasks).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2483,7 +2692,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 						{	//This data block is expected to be at least 5 bytes long
 							char *error = "Error:  Invalid custom data block size (ghost note bitmasks).  Aborting";
 
-							allegro_message("%s", error);
+							eof_message("%s", error);
 							eof_log(error, 1);
 							return 0;
 						}
@@ -2499,7 +2708,7 @@ int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp)
 					default:	//Unknown custom data block ID
 						if(custom_data_size < 4)
 						{	//This is invalid, the size needed to have included the 4 byte ID
-							allegro_message("Error:  Invalid custom data block size (unknown custom data block).  Aborting");
+							eof_message("Error:  Invalid custom data block size (unknown custom data block).  Aborting");
 							eof_log("Error:  Invalid custom data block size (unknown custom data block).  Aborting", 1);
 							return 0;
 						}
@@ -2877,7 +3086,7 @@ int eof_track_add_section(EOF_SONG * sp, unsigned long track, unsigned long sect
 			if(sp->track[track]->track_format == EOF_PRO_GUITAR_TRACK_FORMAT)
 			{
 				count = sp->pro_guitar_track[tracknum]->handpositions;
-				if(count < EOF_MAX_NOTES)
+				if(eof_pro_guitar_track_reserve_hand_positions(sp->pro_guitar_track[tracknum], count + 1))
 				{	//If EOF can store the fret hand position
 					if(end && (end <= 21))
 					{	//If the fret hand position is valid (greater than zero and at or below RS2's limit)
@@ -2957,7 +3166,7 @@ int eof_track_add_section(EOF_SONG * sp, unsigned long track, unsigned long sect
 	return 0;	//Return error
 }
 
-int eof_save_song_string_pf(char *buffer, PACKFILE *fp)
+int eof_save_song_string_pf(const char *buffer, PACKFILE *fp)
 {
 	unsigned long length = 0, ctr;
 
@@ -3034,9 +3243,8 @@ void eof_write_pro_guitar_note(EOF_PRO_GUITAR_NOTE *ptr, PACKFILE *fp)
 	}
 }
 
-int eof_save_song(EOF_SONG * sp, const char * fn)
+int eof_save_song_pf(EOF_SONG * sp, PACKFILE * fp)
 {
-	PACKFILE * fp = NULL;
 	char header[16] = {'E', 'O', 'F', 'S', 'O', 'N', 'H', 0};
 	unsigned long count, ctr, ctr2, tracknum = 0;
 	unsigned long track_count,track_ctr,bookmark_count,track_custom_block_count,bitmask,fingerdefinitions;
@@ -3044,7 +3252,7 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 	char has_solos,has_star_power,has_bookmarks,has_catalog,has_lyric_phrases,has_arpeggios,has_trills,has_tremolos,has_sliders,has_handpositions,has_popupmesages,has_fingerdefinitions,has_arrangement,has_tonechanges,ignore_tuning,has_capo,has_tech_notes,has_accent,has_diff_count,has_sp_deploy,has_ghost;
 	char omit_bonus = 0;	//Set to nonzero if the bonus pro guitar track is empty and will be omitted from the exported project file
 							//This is to maintain as much backwards compatibility with older releases of EOF 1.8 as possible, since they would crash when trying to open a file with the bonus track
-	int temp_file_error = 0;	//Set to nonzero if the temp files for any custom data blocks couldn't be written due to the temp files used to create the data being empty (ie. disk full)
+	int block_error = 0;	//Set to nonzero if any custom data blocks couldn't be built in memory
 
 	#define EOF_USE_FP_BEAT_TIMINGS 1
 		//Set this to 0 to disable the saving of floating point beat positions
@@ -3064,17 +3272,18 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 	EOF_PRO_GUITAR_TRACK *tp;
 	char restore_tech_view;		//If tech view is in effect for a pro guitar track, it is temporarily disabled until after the track's notes have been written
 
- 	eof_log("eof_save_song() entered", 2);
+	EOF_MEMORY_FILE *mf = eof_pack_memory_file(fp);	//If serializing to memory, each chunk's offset is tracked for the table of contents
+	EOF_CHUNK_TOC_ENTRY toc[EOF_CHUNK_TOC_MAX];
+	unsigned long toc_count = 0, tracks_written = 0;
 
-	if((sp == NULL) || (fn == NULL))
+ 	eof_log("eof_save_song_pf() entered", 2);
+
+	if((sp == NULL) || (fp == NULL))
 	{
 		eof_log("\tError saving:  Invalid parameters", 1);
 		return 0;	//Return error
 	}
 
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Saving to file \"%s\"", fn);
-	eof_log(eof_log_string, 2);
-
 	unshare_drum_phrasing = sp->tags->unshare_drum_phrasing;	//Store this outside the project structure until save completes, so that both drum tracks' phrases can be written
 	sp->tags->unshare_drum_phrasing = 1;
 
@@ -3104,13 +3313,6 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 	ininumberbuffer[2] = &sp->tags->difficulty;
 
 	/* write file header */
-	fp = eof_pack_fopen_retry(fn, "w", 5);
-	if(!fp)
-	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError saving:  Cannot open output .eof file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
-		eof_log(eof_log_string, 1);
-		return 0;	//Return error
-	}
 	(void) pack_fwrite(header, 16, fp);
 
 	/* write chart properties */
@@ -3188,6 +3390,7 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 		(void) pack_iputl(sp->tags->ogg[ctr].midi_offset, fp);	//Write the profile's MIDI delay
 		(void) pack_iputl(sp->tags->ogg[ctr].flags, fp);		//Write the profile's flags
 	}
+	eof_chunk_toc_begin(mf, toc, toc_count, EOF_CHUNK_BEATS, 0);
 	(void) pack_iputl(sp->beats, fp);	//Write the number of beats
 	for(ctr=0; ctr < sp->beats; ctr++)
 	{	//For each beat in the project
@@ -3196,6 +3399,8 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 		(void) pack_iputl(sp->beat[ctr]->flags, fp);	//Write the beat's flags
 		(void) pack_putc(sp->beat[ctr]->key, fp);		//Write the beat's key signature
 	}
+	eof_chunk_toc_end(mf, toc, &toc_count);
+	eof_chunk_toc_begin(mf, toc, toc_count, EOF_CHUNK_TEXT_EVENTS, 0);
 	(void) pack_iputl(sp->text_events, fp);	//Write the number of text events
 	for(ctr=0; ctr < sp->text_events; ctr++)
 	{	//For each text event in the project
@@ -3204,14 +3409,10 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 		(void) pack_iputw(sp->text_event[ctr]->track, fp);	//Write the text event's associated track number
 		(void) pack_iputw(sp->text_event[ctr]->flags, fp);	//Write the text event's flags
 	}
+	eof_chunk_toc_end(mf, toc, &toc_count);
 
 	/* write custom data blocks */
-	if(eof_validate_temp_folder())
-	{	//Ensure the correct working directory and presence of the temporary folder
-		eof_log("\tCould not validate working directory and temp folder", 1);
-		return 0;
-	}
-
+	//Blocks whose size isn't known in advance are built in memory first, since this function also serializes undo states and autosaves
 //	(void) pack_iputl(0, fp);	//Write an empty custom data block
 	has_raw_midi_data = has_start_end_points = 0;
 	if(sp->midi_data_head)
@@ -3222,24 +3423,22 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 	{	//If either the start or end points are defined
 		has_start_end_points = 1;
 	}
+	eof_chunk_toc_begin(mf, toc, toc_count, EOF_CHUNK_CUSTOM_DATA, 0);
 	if(has_raw_midi_data || EOF_USE_FP_BEAT_TIMINGS || has_start_end_points)
 	{	//If writing data in a custom data block
 		(void) pack_iputl(has_raw_midi_data + EOF_USE_FP_BEAT_TIMINGS + has_start_end_points, fp);	//Write the number of custom data blocks
 		if(has_raw_midi_data)
 		{	//If there is raw MIDI data being stored, write it as a custom data block
-			PACKFILE *tfp;	//Used to create a temp file containing the MIDI data block, so its size can easily be determined before dumping into the output project file
+			EOF_MEMORY_FILE mf = {0};	//Stores the MIDI data block, so its size can easily be determined before dumping into the output project file
+			PACKFILE *tfp;
 			struct eof_MIDI_data_track *trackptr;	//Used to point to the beginning of the track linked list
 			struct eof_MIDI_data_event *eventptr;
-			unsigned long filesize;
-			char rawmididatafn[30];
 
-		//Parse the linked list to write the MIDI data to a temp file
-			(void) snprintf(rawmididatafn, sizeof(rawmididatafn) - 1, "%srawmididata.tmp", eof_temp_path_s);
-			tfp = eof_pack_fopen_retry(rawmididatafn, "w", 5);
+		//Parse the linked list to write the MIDI data to memory
+			tfp = eof_pack_fopen_memory(&mf);
 			if(!tfp)
-			{	//If the temp file couldn't be opened for writing
-				eof_log("\tError creating temp file for raw MIDI data block", 1);
-				(void) pack_fclose(fp);
+			{	//If the memory file couldn't be opened for writing
+				eof_log("\tError creating memory file for raw MIDI data block", 1);
 				return 0;	//return error
 			}
 			for(ctr = 0, trackptr = sp->midi_data_head; trackptr != NULL; ctr++, trackptr = trackptr->next);	//Count the number of tracks in this list
@@ -3277,41 +3476,27 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 				}
 				trackptr = trackptr->next;	//Point to the next track
 			}
-			(void) pack_fclose(tfp);	//Close temp file
+			(void) pack_fclose(tfp);	//Close memory file
 
 		//Write the custom data block
-			filesize = (unsigned long)file_size_ex(rawmididatafn);
-			if(!filesize)
-				temp_file_error = 1;
-			(void) pack_iputl(filesize, fp);	//Write the size of this data block
-			tfp = pack_fopen(rawmididatafn, "r");
-			if(!tfp)
-			{	//If the temp file couldn't be opened for reading
-				eof_log("\tError reading temp file for raw MIDI data block", 1);
-				(void) pack_fclose(fp);
-				return 0;	//return error
-			}
-			for(ctr = 0; ctr < filesize; ctr++)
-			{	//For each byte in the temp file
-				(void) pack_putc(pack_getc(tfp), fp);	//Copy the byte to the output project file
-			}
-			(void) pack_fclose(tfp);
-			(void) delete_file(rawmididatafn);	//Delete the temp file
+			if(!mf.size || mf.error)
+				block_error = 1;
+			(void) pack_iputl(mf.size, fp);	//Write the size of this data block
+			if(mf.size)
+				(void) pack_fwrite(mf.buffer, (long)mf.size, fp);	//Copy the block to the output project file
+			eof_memory_file_free(&mf);
 		}//If there is raw MIDI data being stored, write it as a custom data block
 		if(EOF_USE_FP_BEAT_TIMINGS)
 		{	//If floating point beat timings are to be written
 			char buffer[100] = {0};	//Will be used to store an ASCII representation of the beat timestamps
-			PACKFILE *tfp;	//Used to create a temp file containing the beat timings, so its size can easily be determined before dumping into the output project file
-			unsigned long filesize;
-			char beattimesfn[30];
+			EOF_MEMORY_FILE mf = {0};	//Stores the beat timings, so their size can easily be determined before dumping into the output project file
+			PACKFILE *tfp;
 
-		//Write the beat timings to a temp file
-			(void) snprintf(beattimesfn, sizeof(beattimesfn) - 1, "%sbeattimes.tmp", eof_temp_path_s);
-			tfp = eof_pack_fopen_retry(beattimesfn, "w", 5);
+		//Write the beat timings to memory
+			tfp = eof_pack_fopen_memory(&mf);
 			if(!tfp)
-			{	//If the temp file couldn't be opened for writing
-				eof_log("\tError creating temp file for floating point beat timings data block", 1);
-				(void) pack_fclose(fp);
+			{	//If the memory file couldn't be opened for writing
+				eof_log("\tError creating memory file for floating point beat timings data block", 1);
 				return 0;	//return error
 			}
 			for(ctr = 0; ctr < sp->beats; ctr++)
@@ -3319,27 +3504,16 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 				(void) snprintf(buffer, sizeof(buffer) - 1, "%.15f", sp->beat[ctr]->fpos);	//Create a string representation of this beat's timestamp
 				(void) eof_save_song_string_pf(buffer, tfp);		//Write timing string
 			}
-			(void) pack_fclose(tfp);	//Close temp file
+			(void) pack_fclose(tfp);	//Close memory file
 
 		//Write the custom data block
-			filesize = (unsigned long)file_size_ex(beattimesfn);
-			if(!filesize)
-				temp_file_error = 1;
-			(void) pack_iputl(filesize, fp);	//Write the size of this data block
+			if(!mf.size || mf.error)
+				block_error = 1;
+			(void) pack_iputl(mf.size, fp);	//Write the size of this data block
 			(void) pack_iputl(2, fp);			//Write the data block ID (2 = Floating point beat timings)
-			tfp = pack_fopen(beattimesfn, "r");
-			if(!tfp)
-			{	//If the temp file couldn't be opened for reading
-				eof_log("\tError reading temp file for floating point beat timings data block", 1);
-				(void) pack_fclose(fp);
-				return 0;	//return error
-			}
-			for(ctr = 0; ctr < filesize; ctr++)
-			{	//For each byte in the temp file
-				(void) pack_putc(pack_getc(tfp), fp);	//Copy the byte to the output project file
-			}
-			(void) pack_fclose(tfp);
-			(void) delete_file(beattimesfn);	//Delete the temp file
+			if(mf.size)
+				(void) pack_fwrite(mf.buffer, (long)mf.size, fp);	//Copy the block to the output project file
+			eof_memory_file_free(&mf);
 		}
 		if(has_start_end_points)
 		{	//If the start and end points are to be written
@@ -3355,6 +3529,7 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 		(void) pack_iputl(4, fp);			//Write the size of this data block
 		(void) pack_iputl(0xFFFFFFFF, fp);	//Write the data block ID (0xFFFFFFFF = Debug block)
 	}
+	eof_chunk_toc_end(mf, toc, &toc_count);
 
 	/* write track data */
 	//Count the number of bookmarks
@@ -3392,6 +3567,7 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 		{	//If this is the bonus pro guitar track, and the track is to be omitted from the project file
 			continue;	//Skip to the next track
 		}
+		eof_chunk_toc_begin(mf, toc, toc_count, EOF_CHUNK_TRACK, tracks_written);
 		restore_tech_view = 0;	//Reset this condition
 		tp = NULL;
 		if(track_ctr >= EOF_TRACKS_MAX)
@@ -3611,8 +3787,7 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 					}
 				break;
 				case EOF_PRO_KEYS_TRACK_FORMAT:	//Pro Keys
-					allegro_message("Error: Pro Keys not supported yet.  Aborting");
-					(void) pack_fclose(fp);
+					eof_message("Error: Pro Keys not supported yet.  Aborting");
 				return 0;
 				case EOF_PRO_GUITAR_TRACK_FORMAT:	//Pro Guitar/Bass
 				{
@@ -3781,12 +3956,10 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 				}
 				break;//Pro Guitar/Bass
 				case EOF_PRO_VARIABLE_LEGACY_TRACK_FORMAT:	//Variable Lane Legacy (not implemented yet)
-					allegro_message("Error: Variable lane not supported yet.  Aborting");
-					(void) pack_fclose(fp);
+					eof_message("Error: Variable lane not supported yet.  Aborting");
 				return 0;
 				default://Unknown track type
-					allegro_message("Error: Unsupported track type.  Aborting");
-					(void) pack_fclose(fp);
+					eof_message("Error: Unsupported track type.  Aborting");
 				return 0;
 			}//Perform the appropriate logic to write this format of track
 		}//Write other tracks
@@ -3896,45 +4069,32 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 				}
 				if(has_tech_notes)
 				{	//Write tech notes
-					PACKFILE *tempf;	//Since the size of the custom data block must be known in advance, write it to a temp file so its size can be read
-					unsigned long filesize;
-					char tempfilename[30];
+					EOF_MEMORY_FILE mf = {0};	//Since the size of the custom data block must be known in advance, build it in memory so its size can be read
+					PACKFILE *tempf;
 
-					(void) snprintf(tempfilename, sizeof(tempfilename) - 1, "%seof_tech_notes.tmp", eof_temp_path_s);
-					tempf = eof_pack_fopen_retry(tempfilename, "w", 1);
+					tempf = eof_pack_fopen_memory(&mf);
 					if(!tempf)
-					{	//If there was an error opening the temp file for writing
-						eof_log("Error writing tech notes to temp file, skipping export of the track's tech notes", 1);
+					{	//If there was an error opening the memory file for writing
+						eof_log("Error writing tech notes to memory, skipping export of the track's tech notes", 1);
 						(void) pack_iputl(8, fp);	//Write the number of bytes this block will contain (4 byte number of tech notes and a 4 byte block ID)
 						(void) pack_iputl(7, fp);	//Write the pro guitar tech note custom data block ID
 						(void) pack_iputl(0, fp);	//Write 0 tech notes
 					}
 					else
-					{	//The temp file was opened for writing
+					{	//The memory file was opened for writing
 						(void) pack_iputl(tp->technotes, tempf);	//Write the number of tech notes
 						for(ctr = 0; ctr < tp->technotes; ctr++)
 						{	//For each tech note in this track
-							eof_write_pro_guitar_note(tp->technote[ctr], tempf);	//Write the tech note to the temp file
+							eof_write_pro_guitar_note(tp->technote[ctr], tempf);	//Write the tech note to the memory file
 						}
-						(void) pack_fclose(tempf);	//Close temp file
-						filesize = (unsigned long)file_size_ex(tempfilename);
-						if(!filesize)
-							temp_file_error = 1;
-						(void) pack_iputl(filesize + 4, fp);	//Write the number of bytes this block will contain (the temp file and a 4 byte block ID)
+						(void) pack_fclose(tempf);	//Close memory file
+						if(!mf.size || mf.error)
+							block_error = 1;
+						(void) pack_iputl(mf.size + 4, fp);	//Write the number of bytes this block will contain (the memory file and a 4 byte block ID)
 						(void) pack_iputl(7, fp);				//Write the pro guitar tech note custom data block ID
-						tempf = pack_fopen(tempfilename, "r");	//Open temp file for reading
-						if(!tempf)
-						{	//If the temp file couldn't be accessed
-							eof_log("Error reading tech notes temp file.  Aborting", 1);
-							(void) pack_fclose(fp);
-							return 0;
-						}
-						for(ctr = 0; ctr < filesize; ctr++)
-						{	//For each byte in the temp file
-							(void) pack_putc(pack_getc(tempf), fp);	//Copy the byte to the project file
-						}
-						(void) pack_fclose(tempf);			//Close temp file
-						(void) delete_file(tempfilename);	//And delete it
+						if(mf.size)
+							(void) pack_fwrite(mf.buffer, (long)mf.size, fp);	//Copy the block to the project file
+						eof_memory_file_free(&mf);
 					}
 				}//Write tech notes
 				if(has_diff_count)
@@ -3985,21 +4145,76 @@ int eof_save_song(EOF_SONG * sp, const char * fn)
 		{	//If tech view needs to be re-enabled for the track that was just written
 			eof_menu_pro_guitar_track_enable_tech_view(tp);
 		}
+		eof_chunk_toc_end(mf, toc, &toc_count);
+		tracks_written++;
 	}//For each track in the project
 
-	(void) pack_fclose(fp);
 	sp->tags->unshare_drum_phrasing = unshare_drum_phrasing;	//After all tracks have been formally written, store this value back into the project to optionally override drum phrase handling
 
-	if(temp_file_error)
+	if(mf && toc_count)
+	{	//Append the chunk table of contents.  Older releases of EOF stop reading after the last track, so they ignore it
+		for(ctr = 0; ctr < toc_count; ctr++)
+		{	//For each chunk that was written
+			(void) pack_iputl(toc[ctr].type, fp);
+			(void) pack_iputl(toc[ctr].index, fp);
+			(void) pack_iputl(toc[ctr].offset, fp);
+			(void) pack_iputl(toc[ctr].size, fp);
+		}
+		(void) pack_iputl(toc_count, fp);					//Write the number of entries
+		(void) pack_iputl(EOF_CHUNK_TOC_SIGNATURE, fp);	//Write the signature last, so a reader can find the table from the end of the file
+	}
+
+	if(block_error)
 	{	//If any of the custom data blocks failed to be created
 		eof_log("\tOne or more data blocks failed to be written", 1);
-		allegro_message("Warning:  Some of the project failed to save due to inability to write to files in EOF's temp folder.  Possibly caused by running out of disk space or antivirus interference.");
+		eof_message("Warning:  Some of the project failed to save due to running out of memory while building its data blocks.");
 	}
 
 	eof_log("\tSave completed", 2);
 	return 1;	//Return success
 }
 
+int eof_save_song(EOF_SONG * sp, const char * fn)
+{
+	EOF_MEMORY_FILE mf = {0};
+	PACKFILE * fp = NULL;
+	int retval;
+
+ 	eof_log("eof_save_song() entered", 2);
+
+	if((sp == NULL) || (fn == NULL))
+	{
+		eof_log("\tError saving:  Invalid parameters", 1);
+		return 0;	//Return error
+	}
+
+	eof_logf(2, "Saving to file \"%s\"", fn);
+
+	//Serialize the project in memory first, so the existing file is only overwritten once the whole project was built, with a single write
+	fp = eof_pack_fopen_memory(&mf);
+	if(!fp)
+	{
+		eof_log("\tError saving:  Cannot open memory file", 1);
+		return 0;	//Return error
+	}
+	retval = eof_save_song_pf(sp, fp);
+	if(retval && pack_ferror(fp))
+	{	//If any write to the memory file failed, the serialized project is incomplete and must not replace the existing file
+		eof_log("\tError saving:  Could not build the project in memory", 1);
+		retval = 0;
+	}
+	(void) pack_fclose(fp);
+	if(retval && !eof_memory_file_save(&mf, fn))
+	{	//If the project was serialized but couldn't be written to disk
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tError saving:  Cannot write output .eof file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
+		eof_log(eof_log_string, 1);
+		retval = 0;
+	}
+	eof_memory_file_free(&mf);
+
+	return retval;
+}
+
 EOF_SONG * eof_create_song_populated(void)
 {
 	EOF_SONG * sp;
@@ -4087,15 +4302,101 @@ int eof_lane_six_enabled(unsigned long track)
 	return 0;
 }
 
+EOF_PRO_GUITAR_TRACK *eof_create_pro_guitar_track(void)
+{
+	EOF_PRO_GUITAR_TRACK *tp;
+
+	tp = malloc(sizeof(EOF_PRO_GUITAR_TRACK));
+	if(!tp)
+		return NULL;
+
+	memset(tp, 0, sizeof(EOF_PRO_GUITAR_TRACK));	//Initialize memory block to 0 to avoid crashes when not explicitly setting counters that were newly added to the pro guitar structure
+	if(!eof_pro_guitar_track_reserve_notes(tp, 1, 0) || !eof_pro_guitar_track_reserve_notes(tp, 1, 1))
+	{	//If either note array couldn't be allocated
+		eof_free_pro_guitar_track(tp);
+		return NULL;
+	}
+	tp->note = tp->pgnote;	//Put the regular pro guitar note array into effect
+
+	return tp;
+}
+
+int eof_pro_guitar_track_reserve_notes(EOF_PRO_GUITAR_TRACK * tp, unsigned long count, char tech)
+{
+	EOF_PRO_GUITAR_NOTE **array;
+	char active;
+
+	if(!tp || !eof_selection_reserve(count))
+		return 0;	//Invalid parameter or the selection array couldn't be grown
+
+	if(tech)
+	{
+		if(count <= tp->technote_capacity)
+			return 1;	//The array is already large enough
+		active = (tp->note == tp->technote);
+		array = eof_song_grow_array(tp->technote, &tp->technote_capacity, count, sizeof(EOF_PRO_GUITAR_NOTE *));
+		if(!array)
+			return 0;	//Error
+		tp->technote = array;
+	}
+	else
+	{
+		if(count <= tp->pgnote_capacity)
+			return 1;	//The array is already large enough
+		active = (tp->note == tp->pgnote);
+		array = eof_song_grow_array(tp->pgnote, &tp->pgnote_capacity, count, sizeof(EOF_PRO_GUITAR_NOTE *));
+		if(!array)
+			return 0;	//Error
+		tp->pgnote = array;
+	}
+	if(active)
+	{	//If the array that moved is the active note set
+		tp->note = array;
+	}
+
+	return 1;
+}
+
+int eof_pro_guitar_track_reserve_hand_positions(EOF_PRO_GUITAR_TRACK * tp, unsigned long count)
+{
+	EOF_PHRASE_SECTION *array;
+
+	if(!tp)
+		return 0;	//Invalid parameter
+	if(count <= tp->handposition_capacity)
+		return 1;	//The array is already large enough
+
+	array = eof_song_grow_array(tp->handposition, &tp->handposition_capacity, count, sizeof(EOF_PHRASE_SECTION));
+	if(!array)
+		return 0;	//Error
+	tp->handposition = array;
+
+	return 1;
+}
+
+void eof_free_pro_guitar_track(EOF_PRO_GUITAR_TRACK * tp)
+{
+	if(!tp)
+		return;
+
+	free(tp->pgnote);
+	free(tp->technote);
+	free(tp->handposition);
+	free(tp);
+}
+
 EOF_PRO_GUITAR_NOTE *eof_pro_guitar_track_add_note(EOF_PRO_GUITAR_TRACK *tp)
 {
-	if(!tp || (tp->notes >= EOF_MAX_NOTES))
+	if(!tp)
 		return NULL;	//Invalid parameters
+	if(!eof_pro_guitar_track_reserve_notes(tp, tp->notes + 1, (tp->note == tp->technote)))
+		return NULL;	//Couldn't grow the active note array
 
 	tp->note[tp->notes] = malloc(sizeof(EOF_PRO_GUITAR_NOTE));
 	if(tp->note[tp->notes])
 	{
 		memset(tp->note[tp->notes], 0, sizeof(EOF_PRO_GUITAR_NOTE));
+		tp->note[tp->notes]->name = eof_intern_note_name(NULL);
 		tp->notes++;	//Update the generic note counter
 		if(tp->note == tp->technote)
 		{	//If tech view is in effect
@@ -4113,12 +4414,13 @@ EOF_PRO_GUITAR_NOTE *eof_pro_guitar_track_add_note(EOF_PRO_GUITAR_TRACK *tp)
 
 EOF_PRO_GUITAR_NOTE *eof_pro_guitar_track_add_tech_note(EOF_PRO_GUITAR_TRACK *tp)
 {
-	if(tp && (tp->technotes < EOF_MAX_NOTES))
+	if(tp && eof_pro_guitar_track_reserve_notes(tp, tp->technotes + 1, 1))
 	{
 		tp->technote[tp->technotes] = malloc(sizeof(EOF_PRO_GUITAR_NOTE));
 		if(tp->technote[tp->technotes])
 		{
 			memset(tp->technote[tp->technotes], 0, sizeof(EOF_PRO_GUITAR_NOTE));
+			tp->technote[tp->technotes]->name = eof_intern_note_name(NULL);
 			tp->technotes++;
 			if(tp->note == tp->technote)
 			{	//If tech view is in effect
@@ -4225,6 +4527,7 @@ void *eof_track_add_note(EOF_SONG *sp, unsigned long track)
 	if((sp == NULL) || !track || (track >= sp->tracks))
 		return NULL;
 	tracknum = sp->track[track]->tracknum;
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
 
 	switch(sp->track[track]->track_format)
 	{
@@ -4253,6 +4556,7 @@ void eof_track_delete_note(EOF_SONG *sp, unsigned long track, unsigned long note
 	if((sp == NULL) || !track || (track >= sp->tracks))
 		return;
 	tracknum = sp->track[track]->tracknum;
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
 
 	if(note < eof_get_track_size(sp, track))
 	{
@@ -4561,6 +4865,7 @@ void eof_set_note_length(EOF_SONG *sp, unsigned long track, unsigned long note,
 	if((sp == NULL) || !track || (track >= sp->tracks))
 		return;
 	tracknum = sp->track[track]->tracknum;
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
 
 	switch(sp->track[track]->track_format)
 	{
@@ -4796,7 +5101,7 @@ unsigned long eof_get_pro_guitar_note_note(EOF_PRO_GUITAR_TRACK *tp, unsigned lo
 	return tp->note[note]->note;
 }
 
-void *eof_track_add_create_note(EOF_SONG *sp, unsigned long track, unsigned char note, unsigned long pos, long length, char type, char *text)
+void *eof_track_add_create_note(EOF_SONG *sp, unsigned long track, unsigned char note, unsigned long pos, long length, char type, const char *text)
 {
 	void *new_note = NULL;
 	EOF_NOTE *ptr = NULL;
@@ -4838,14 +5143,7 @@ void *eof_track_add_create_note(EOF_SONG *sp, unsigned long track, unsigned char
 			ptr->length = length;
 			ptr->flags = 0;
 			ptr->tflags = 0;
-			if(text != NULL)
-			{
-				(void) ustrcpy(ptr->name, text);
-			}
-			else
-			{
-				ptr->name[0] = '\0';	//Empty the string
-			}
+			ptr->name = eof_intern_note_name(text);
 			if(sp->track[track]->track_behavior == EOF_KEYS_TRACK_BEHAVIOR)
 			{	//In a keys track, all lanes are forced to be "crazy" and be allowed to overlap other lanes
 				ptr->flags |= EOF_NOTE_FLAG_CRAZY;	//Set the crazy flag bit
@@ -4874,14 +5172,7 @@ void *eof_track_add_create_note(EOF_SONG *sp, unsigned long track, unsigned char
 
 		case EOF_PRO_GUITAR_TRACK_FORMAT:
 			ptr3 = (EOF_PRO_GUITAR_NOTE *)new_note;
-			if(text != NULL)
-			{
-				(void) ustrcpy(ptr3->name, text);
-			}
-			else
-			{
-				ptr3->name[0] = '\0';	//Empty the string
-			}
+			ptr3->name = eof_intern_note_name(text);
 			ptr3->type = type;
 			ptr3->note = note;
 			ptr3->ghost = 0;
@@ -4990,6 +5281,7 @@ void eof_set_note_pos(EOF_SONG *sp, unsigned long track, unsigned long note, uns
 	if((sp == NULL) || !track || (track >= sp->tracks))
 		return;
 	tracknum = sp->track[track]->tracknum;
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
 
 	switch(sp->track[track]->track_format)
 	{
@@ -5065,6 +5357,7 @@ void eof_move_note_pos(EOF_SONG *sp, unsigned long track, unsigned long note, un
 	if((sp == NULL) || !track || (track >= sp->tracks))
 		return;
 	tracknum = sp->track[track]->tracknum;
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
 
 	switch(sp->track[track]->track_format)
 	{
@@ -5245,6 +5538,164 @@ void eof_set_note_sp_deploy(EOF_SONG *sp, unsigned long track, unsigned long not
 	}
 }
 
+EOF_NOTE_INDEX eof_note_index_cache[EOF_NOTE_INDEX_CACHE_SIZE] = {{0}};
+unsigned long eof_note_index_next_slot = 0;
+unsigned long eof_note_index_generation[EOF_TRACKS_MAX + 1] = {0};
+
+void eof_note_index_invalidate(unsigned long track)
+{
+	if(track <= EOF_TRACKS_MAX)
+	{
+		eof_note_index_generation[track]++;
+	}
+}
+
+void eof_note_index_invalidate_all(void)
+{
+	unsigned long ctr;
+
+	for(ctr = 0; ctr <= EOF_TRACKS_MAX; ctr++)
+	{
+		eof_note_index_generation[ctr]++;
+	}
+}
+
+void eof_destroy_note_indexes(EOF_SONG *sp)
+{
+	unsigned long ctr;
+
+	for(ctr = 0; ctr < EOF_NOTE_INDEX_CACHE_SIZE; ctr++)
+	{	//For each cached note index
+		if(!sp || (eof_note_index_cache[ctr].sp == sp))
+		{	//If it was built for the specified project, or all indexes are being destroyed
+			if(eof_note_index_cache[ctr].notes)
+				free(eof_note_index_cache[ctr].notes);
+			memset(&eof_note_index_cache[ctr], 0, sizeof(EOF_NOTE_INDEX));
+		}
+	}
+}
+
+static void *eof_note_index_get_noteset(EOF_SONG *sp, unsigned long track)
+{
+	unsigned long tracknum = sp->track[track]->tracknum;
+
+	switch(sp->track[track]->track_format)
+	{
+		case EOF_LEGACY_TRACK_FORMAT:
+		return sp->legacy_track[tracknum]->note;
+
+		case EOF_VOCAL_TRACK_FORMAT:
+		return sp->vocal_track[tracknum]->lyric;
+
+		case EOF_PRO_GUITAR_TRACK_FORMAT:
+		return sp->pro_guitar_track[tracknum]->note;	//This points to either the normal or the tech note array, depending on whether tech view is in effect
+
+		default:
+		break;
+	}
+
+	return NULL;
+}
+
+EOF_NOTE_INDEX *eof_get_note_index(EOF_SONG *sp, unsigned long track, unsigned char type)
+{
+	unsigned long ctr, tracksize, lastpos = 0, pos;
+	long length;
+	void *noteset;
+	EOF_NOTE_INDEX *ip = NULL;
+
+	if((sp == NULL) || !track || (track >= sp->tracks) || (track > EOF_TRACKS_MAX))
+		return NULL;	//Invalid parameters
+
+	noteset = eof_note_index_get_noteset(sp, track);
+	tracksize = eof_get_track_size(sp, track);
+	for(ctr = 0; ctr < EOF_NOTE_INDEX_CACHE_SIZE; ctr++)
+	{	//For each cached note index
+		ip = &eof_note_index_cache[ctr];
+		if((ip->sp == sp) && (ip->track == track) && (ip->type == type) && (ip->noteset == noteset))
+		{	//If this index was built for the specified track difficulty
+			if((ip->generation == eof_note_index_generation[track]) && (ip->tracksize == tracksize))
+				return ip;	//If it is still valid, return it
+
+			break;	//Otherwise rebuild it in place
+		}
+	}
+	if(ctr >= EOF_NOTE_INDEX_CACHE_SIZE)
+	{	//If the track difficulty wasn't cached, replace the least recently added index
+		ip = &eof_note_index_cache[eof_note_index_next_slot];
+		eof_note_index_next_slot = (eof_note_index_next_slot + 1) % EOF_NOTE_INDEX_CACHE_SIZE;
+	}
+
+	//Rebuild the index
+	if(ip->capacity < tracksize)
+	{	//If the index's note array needs to be enlarged
+		unsigned long *newnotes = realloc(ip->notes, sizeof(unsigned long) * tracksize);
+
+		if(!newnotes)
+		{	//If the memory couldn't be allocated
+			if(ip->notes)
+				free(ip->notes);
+			memset(ip, 0, sizeof(EOF_NOTE_INDEX));
+			return NULL;
+		}
+		ip->notes = newnotes;
+		ip->capacity = tracksize;
+	}
+	ip->sp = sp;
+	ip->track = track;
+	ip->type = type;
+	ip->noteset = noteset;
+	ip->generation = eof_note_index_generation[track];
+	ip->tracksize = tracksize;
+	ip->count = 0;
+	ip->maxlength = 0;
+	ip->sorted = 1;
+	for(ctr = 0; ctr < tracksize; ctr++)
+	{	//For each note in the track
+		if(eof_get_note_type(sp, track, ctr) != type)
+			continue;	//If the note isn't in the specified difficulty, skip it
+
+		pos = eof_get_note_pos(sp, track, ctr);
+		length = eof_get_note_length(sp, track, ctr);
+		if(pos < lastpos)
+		{	//If this note is earlier than the previous note in the difficulty
+			ip->sorted = 0;	//The index can't be binary searched
+		}
+		if((length > 0) && ((unsigned long)length > ip->maxlength))
+		{	//Track the longest note length
+			ip->maxlength = length;
+		}
+		lastpos = pos;
+		ip->notes[ip->count++] = ctr;
+	}
+
+	return ip;
+}
+
+unsigned long eof_note_index_find(EOF_SONG *sp, EOF_NOTE_INDEX *ip, unsigned long pos)
+{
+	unsigned long low = 0, high, mid;
+
+	if(!sp || !ip || !ip->sorted)
+		return 0;	//If the index can't be binary searched, the caller has to examine every entry
+
+	high = ip->count;
+	while(low < high)
+	{	//Binary search for the first note at or after the specified position
+		mid = low + (high - low) / 2;
+		if(eof_get_note_pos(sp, ip->track, ip->notes[mid]) < pos)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
 void eof_track_sort_notes(EOF_SONG *sp, unsigned long track)
 {
 	unsigned long tracknum, tflags, ctr;
@@ -5287,6 +5738,8 @@ void eof_track_sort_notes(EOF_SONG *sp, unsigned long track)
 		break;
 	}
 
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
+
 	//Recreate the note selection if applicable
 	if(eof_selection.track == track)
 	{	//If the track being sorted has selected notes
@@ -5309,8 +5762,7 @@ void eof_track_sort_notes(EOF_SONG *sp, unsigned long track)
 
 void eof_track_fixup_notes(EOF_SONG *sp, unsigned long track, int sel)
 {
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "eof_track_fixup_notes() entered for track %lu", track);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "eof_track_fixup_notes() entered for track %lu", track);
 
 	if((sp == NULL) || !track || (track >= sp->tracks) || !sp->tags)
 		return;
@@ -5674,7 +6126,7 @@ void eof_pro_guitar_track_fixup_notes(EOF_SONG *sp, unsigned long track, int sel
 		{
 			eof_selection.multi[eof_selection.current] = 0;
 		}
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	//Loop through notes looking for any marked as temporary or ignored and return from function if any are found to avoid merging/deleting them
 	for(i = 0; i < tp->notes; i++)
@@ -6458,6 +6910,7 @@ void eof_set_note_type(EOF_SONG *sp, unsigned long track, unsigned long note, un
 	if((sp == NULL) || !track || (track >= sp->tracks))
 		return;
 	tracknum = sp->track[track]->tracknum;
+	eof_note_index_invalidate(track);	//Any cached note index for this track will need to be rebuilt
 
 	switch(sp->track[track]->track_format)
 	{
@@ -7257,11 +7710,11 @@ void eof_set_pro_guitar_fret_number(char function, unsigned long fretvalue)
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 }
 
-char *eof_get_note_name(EOF_SONG *sp, unsigned long track, unsigned long note)
+const char *eof_get_note_name(EOF_SONG *sp, unsigned long track, unsigned long note)
 {
 	unsigned long tracknum;
 
@@ -7299,12 +7752,131 @@ char *eof_get_note_name(EOF_SONG *sp, unsigned long track, unsigned long note)
 	return NULL;	//Return error
 }
 
+char *eof_get_lyric_text(EOF_SONG *sp, unsigned long track, unsigned long lyric)
+{
+	unsigned long tracknum;
+
+	if((sp == NULL) || !track || (track >= sp->tracks))
+		return NULL;	//Return error
+	if(sp->track[track]->track_format != EOF_VOCAL_TRACK_FORMAT)
+		return NULL;	//Only lyrics have editable text
+	tracknum = sp->track[track]->tracknum;
+	if(lyric >= sp->vocal_track[tracknum]->lyrics)
+		return NULL;	//Return error
+
+	return sp->vocal_track[tracknum]->lyric[lyric]->text;
+}
+
+static char **eof_note_name_table = NULL;			//Open addressed hash table of interned note names
+static unsigned long eof_note_name_table_size = 0;	//The number of slots in the table, always a power of two
+static unsigned long eof_note_name_table_count = 0;	//The number of names stored in the table
+
+static unsigned long eof_note_name_hash(const char *name)
+{
+	unsigned long hash = 2166136261UL;	//FNV-1a
+
+	while(*name != '\0')
+	{
+		hash ^= (unsigned char)*name;
+		hash *= 16777619UL;
+		hash &= 0xFFFFFFFFUL;
+		name++;
+	}
+
+	return hash;
+}
+
+static int eof_note_name_table_grow(void)
+{
+	char **newtable;
+	unsigned long newsize, ctr, index;
+
+	newsize = eof_note_name_table_size ? eof_note_name_table_size * 2 : 256;
+	if(newsize < eof_note_name_table_size)
+		return 0;	//Overflow
+	newtable = calloc((size_t)newsize, sizeof(char *));
+	if(!newtable)
+		return 0;	//Couldn't allocate memory
+
+	for(ctr = 0; ctr < eof_note_name_table_size; ctr++)
+	{	//Rehash each name in the old table
+		if(eof_note_name_table[ctr])
+		{
+			index = eof_note_name_hash(eof_note_name_table[ctr]) & (newsize - 1);
+			while(newtable[index])
+			{	//Linear probe for an empty slot
+				index = (index + 1) & (newsize - 1);
+			}
+			newtable[index] = eof_note_name_table[ctr];
+		}
+	}
+	free(eof_note_name_table);
+	eof_note_name_table = newtable;
+	eof_note_name_table_size = newsize;
+
+	return 1;
+}
+
+const char *eof_intern_note_name(const char *name)
+{
+	static const char empty[] = "";
+	char buffer[EOF_NAME_LENGTH + 1];
+	unsigned long index;
+	size_t length;
+
+	if(!name || (name[0] == '\0'))
+		return empty;
+
+	(void) ustrzcpy(buffer, (int)sizeof(buffer), name);	//Truncate the name the same way the old fixed size array did
+	if((eof_note_name_table_count + 1) * 2 > eof_note_name_table_size)
+	{	//If the table would be more than half full
+		if(!eof_note_name_table_grow())
+		{
+			eof_log("\tError allocating memory to intern note name", 1);
+			return empty;
+		}
+	}
+
+	index = eof_note_name_hash(buffer) & (eof_note_name_table_size - 1);
+	while(eof_note_name_table[index])
+	{	//Linear probe until the name or an empty slot is found
+		if(!strcmp(eof_note_name_table[index], buffer))
+			return eof_note_name_table[index];	//This name is already interned
+		index = (index + 1) & (eof_note_name_table_size - 1);
+	}
+
+	length = strlen(buffer) + 1;
+	eof_note_name_table[index] = malloc(length);
+	if(!eof_note_name_table[index])
+	{
+		eof_log("\tError allocating memory to intern note name", 1);
+		return empty;
+	}
+	memcpy(eof_note_name_table[index], buffer, length);
+	eof_note_name_table_count++;
+
+	return eof_note_name_table[index];
+}
+
+void eof_free_note_names(void)
+{
+	unsigned long ctr;
+
+	for(ctr = 0; ctr < eof_note_name_table_size; ctr++)
+	{
+		free(eof_note_name_table[ctr]);
+	}
+	free(eof_note_name_table);
+	eof_note_name_table = NULL;
+	eof_note_name_table_size = eof_note_name_table_count = 0;
+}
+
 void *eof_copy_note(EOF_SONG *ssp, unsigned long sourcetrack, unsigned long sourcenote, EOF_SONG *dsp, unsigned long desttrack, unsigned long pos, long length, char type)
 {
 	unsigned long sourcetracknum, desttracknum, newnotenum;
 	unsigned long flags, eflags;
 	unsigned char note, accent, ghost;
-	char *text;
+	const char *text;
 	void *result = NULL;
 
  	eof_log("eof_copy_note() entered", 2);
@@ -7460,7 +8032,7 @@ int eof_create_image_sequence(char benchmark_only)
 
 		if((eof_song->tags->start_point != ULONG_MAX) && (eof_song->tags->end_point != ULONG_MAX) && (eof_song->tags->start_point != eof_song->tags->end_point))
 		{	//If both the start and end points are defined with different timestamps
-			if(alert(NULL, "Sequence only the start->end position?", NULL, "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert(NULL, "Sequence only the start->end position?", NULL, "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opts to only create an image sequence for only the selected portion of the chart
 				startpos = eof_song->tags->start_point;
 				endpos = eof_song->tags->end_point + eof_av_delay;
@@ -7478,11 +8050,11 @@ int eof_create_image_sequence(char benchmark_only)
 			err = eof_mkdir(eof_temp_filename);
 			if(err && !eof_folder_exists(eof_temp_filename))
 			{	//If it couldn't be created and is still not found to exist (in case the previous check was a false negative)
-				allegro_message("Could not create folder!\n%s", eof_temp_filename);
+				eof_message("Could not create folder!\n%s", eof_temp_filename);
 				return 1;
 			}
 		}
-		else if(alert(NULL, "Overwrite contents of existing \\sequence folder?", NULL, "&Yes", "&No", 'y', 'n') != 1)
+		else if(eof_alert(NULL, "Overwrite contents of existing \\sequence folder?", NULL, "&Yes", "&No", 'y', 'n') != 1)
 		{	//If user declined to overwrite the contents of the folder
 			return 1;
 		}
@@ -7545,7 +8117,7 @@ int eof_create_image_sequence(char benchmark_only)
 		fps = (double)framectr / ((double)(endtime - starttime) / (double)CLOCKS_PER_SEC);	//Find the average FPS
 		set_window_title("Benchmarking image sequence: 100%");
 		(void) snprintf(windowtitle, sizeof(windowtitle) - 1, "Average render rate was %.2fFPS",fps);
-		allegro_message("%s", windowtitle);
+		eof_message("%s", windowtitle);
 		eof_log(windowtitle, 1);
 	}
 
@@ -7751,7 +8323,7 @@ void eof_adjust_note_length(EOF_SONG * sp, unsigned long track, unsigned long am
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 }
 
@@ -7796,7 +8368,7 @@ void eof_track_delete_arpeggio(EOF_SONG *sp, unsigned long track, unsigned long
 	}
 }
 
-void eof_set_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, char *name)
+void eof_set_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, const char *name)
 {
 // 	eof_log("eof_set_note_name() entered");
 
@@ -7811,7 +8383,7 @@ void eof_set_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, ch
 		case EOF_LEGACY_TRACK_FORMAT:
 			if(note < sp->legacy_track[tracknum]->notes)
 			{
-				(void) ustrcpy(sp->legacy_track[tracknum]->note[note]->name, name);
+				sp->legacy_track[tracknum]->note[note]->name = eof_intern_note_name(name);
 			}
 		break;
 
@@ -7825,7 +8397,7 @@ void eof_set_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, ch
 		case EOF_PRO_GUITAR_TRACK_FORMAT:
 			if(note < sp->pro_guitar_track[tracknum]->notes)
 			{
-				(void) ustrcpy(sp->pro_guitar_track[tracknum]->note[note]->name, name);
+				sp->pro_guitar_track[tracknum]->note[note]->name = eof_intern_note_name(name);
 			}
 		break;
 
@@ -8221,18 +8793,32 @@ int eof_track_convert_ghl_lane_ordering(EOF_SONG *sp, unsigned long track)
 
 char eof_search_for_note_near(EOF_SONG *sp, unsigned long track, unsigned long targetpos, unsigned long delta, char type, unsigned long *match)
 {
-	unsigned long i, notepos, distance = 0;
+	unsigned long i, ctr, first = 0, count, notepos, distance = 0;
 	char matchfound = 0;
+	EOF_NOTE_INDEX *ip;
 
 	if((sp == NULL) || (track >= sp->tracks) || (match == NULL))
 		return 0;
 
-	for(i = 0; i < eof_get_track_size(sp, track); i++)
-	{	//For each note in the specified track
+	ip = eof_get_note_index(sp, track, type);
+	if(ip)
+	{	//If the track difficulty's note index is available, only the notes within range of the target need to be examined
+		first = eof_note_index_find(sp, ip, (targetpos > delta) ? targetpos - delta : 0);
+		count = ip->count;
+	}
+	else
+	{
+		count = eof_get_track_size(sp, track);
+	}
+	for(ctr = first; ctr < count; ctr++)
+	{	//For each note in the specified track difficulty, starting with the first one that may be in range
+		i = ip ? ip->notes[ctr] : ctr;
 		if(eof_get_note_type(sp, track, i) != type)
 			continue;	//If this note is not in the specified difficulty, skip it
 
 		notepos = eof_get_note_pos(sp, track, i);
+		if(ip && ip->sorted && (notepos > targetpos) && (notepos - targetpos > delta))
+			break;	//If this and all remaining notes in the difficulty are after the target and out of range, stop looking
 		if((notepos < targetpos) && (targetpos - notepos <= delta))
 		{	//If this note is before the target but in range
 			if(!matchfound || (targetpos - notepos < distance))
@@ -8311,7 +8897,7 @@ unsigned long eof_get_highest_fret(EOF_SONG *sp, unsigned long track, char scope
 	if(note_selection_updated)
 	{	//If the only note modified was the seek hover note
 		eof_selection.multi[eof_seek_hover_note] = 0;	//Deselect it to restore the note selection's original condition
-		eof_selection.current = EOF_MAX_NOTES - 1;
+		eof_selection.current = EOF_NO_NOTE_SELECTED;
 	}
 	return highestfret;
 }
@@ -9021,7 +9607,7 @@ void eof_track_add_or_remove_track_difficulty_content_range(EOF_SONG *sp, unsign
 				{	//If the user wasn't prompted about how to handle this condition yet, seek to the note in question and prompt the user whether to take action
 					eof_seek_and_render_position(eof_selected_track, eof_note_type, notepos);
 					eof_clear_input();
-					if(alert("At least one note is between 1 and 10 ms before the phrase.", NULL, "Move such notes to the start of the phrase?", "&Yes", "&No", 'y', 'n') == 1)
+					if(eof_alert("At least one note is between 1 and 10 ms before the phrase.", NULL, "Move such notes to the start of the phrase?", "&Yes", "&No", 'y', 'n') == 1)
 					{	//If the user opts to correct the note positions
 						prompt = 1;	//Store a "yes" response
 					}
@@ -9806,8 +10392,7 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 					 eof_length_within_target_range(eof_get_beat_length(eof_song, ctr - 1) + eof_get_beat_length(eof_song, ctr), last_normal_beat_length, 0.15))
 				{	//If the previous beat is not a mid beat tempo change, but the sum of its length and this beat's length would be more appropriate for one beat length
 						eof_log("\tCase 1:  Removing mid beat tempo change:", 2);
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDeleting beat #%lu", ctr + delete_count);
-						eof_log(eof_log_string, 2);
+						eof_logf(2, "\t\tDeleting beat #%lu", ctr + delete_count);
 						eof_menu_beat_delete_logic(ctr);	//Delete the beat
 						ctr--;								//Rewind one beat to compensate for the increment at the end of the loop
 						delete_count++;	//Track the number of deleted beats so the native beat numbers can be logged
@@ -9830,14 +10415,12 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 								if(ctr > 1)
 								{	//Bounds check
 									ctr--;								//Rewind one beat
-									(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDeleting beat #%lu", ctr + delete_count);
-									eof_log(eof_log_string, 2);
+									eof_logf(2, "\t\tDeleting beat #%lu", ctr + delete_count);
 									eof_menu_beat_delete_logic(ctr);	//Delete it
 									consecutive_count--;				//One less beat to delete
 								}
 							}
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tRemoving mid beat flag from beat #%lu", ctr - 1 + delete_count);
-							eof_log(eof_log_string, 2);
+							eof_logf(2, "\t\tRemoving mid beat flag from beat #%lu", ctr - 1 + delete_count);
 							delete_count += temp;	//Track the number of deleted beats so the native beat numbers can be logged
 							eof_song->beat[ctr - 1]->flags &= ~EOF_BEAT_FLAG_MIDBEAT;	//Clear the mid beat tempo flag from this combined beat
 							last_normal_beat_length = eof_get_beat_length(eof_song, ctr - 1);	//The combined beats' length is now the normal length
@@ -9850,8 +10433,7 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 							char undo_made = 1;
 
 							eof_log("\tCase 3:  Deleting anchor:", 2);
-							(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDeleting anchor #%lu", ctr - 1 + delete_count);
-							eof_log(eof_log_string, 2);
+							eof_logf(2, "\t\tDeleting anchor #%lu", ctr - 1 + delete_count);
 							eof_selected_beat = ctr - 1;	//Target the previous beat
 							(void) eof_menu_beat_delete_anchor_logic(&undo_made);	//Use "Beat>Delete anchor" to effectively remove its tempo change so that the beat assumes the previous tempo
 							ongoing_beat_length = 0;	//Reset this sum
@@ -9866,8 +10448,7 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 					{	//This is a mid beat tempo change with a normal beat that follows it
 ///Case 4:  One mid beat tempo change followed by a normal beat
 						eof_log("\tCase 4:  Removing mid beat tempo change:", 2);
-						(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tDeleting beat #%lu", ctr + delete_count);
-						eof_log(eof_log_string, 2);
+						eof_logf(2, "\t\tDeleting beat #%lu", ctr + delete_count);
 						eof_menu_beat_delete_logic(ctr);	//Delete the beat
 						ctr--;								//Rewind one beat to compensate for the increment at the end of the loop
 
@@ -9876,8 +10457,7 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 						{	//Bounds check
 							if(eof_length_within_target_range(last_normal_beat_length, eof_get_beat_length(eof_song, ctr - 1), 0.15))
 							{	//If it's within the target length, it won't need any further processing later in this function
-								(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tRemoving mid beat flag from beat #%lu", ctr + delete_count);
-								eof_log(eof_log_string, 2);
+								eof_logf(2, "\t\tRemoving mid beat flag from beat #%lu", ctr + delete_count);
 								eof_song->beat[ctr]->flags &= ~EOF_BEAT_FLAG_MIDBEAT;	//Clear the mid beat tempo flag from this combined beat
 							}
 						}
@@ -9900,7 +10480,7 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 		}//For each beat except the last
 		if(delete_count)
 		{	//If any beats were deleted
-			allegro_message("One or more mid-beat tempo changes were altered during import due to the \"Import drops mid beat tempos\" preference being enabled.  Make sure to review the tempo map and note sync and re-import after disabling that preference if you are unsatisfied with the results.");
+			eof_message("One or more mid-beat tempo changes were altered during import due to the \"Import drops mid beat tempos\" preference being enabled.  Make sure to review the tempo map and note sync and re-import after disabling that preference if you are unsatisfied with the results.");
 			warned = 1;
 		}
 	}//If the user set the preference to delete mid beat tempo changes
@@ -9916,7 +10496,7 @@ void eof_song_enforce_mid_beat_tempo_change_removal(void)
 			}
 			if(!warned)
 			{
-				allegro_message("At least one beat marker was inserted due to mid-beat tempo or time signatures changes in the imported file.  Make sure to clean up the beat map or update time signatures accordingly.");
+				eof_message("At least one beat marker was inserted due to mid-beat tempo or time signatures changes in the imported file.  Make sure to clean up the beat map or update time signatures accordingly.");
 				warned = 1;
 			}
 		}
@@ -10754,14 +11334,14 @@ int eof_check_for_notes_preceding_sections(int function)
 						eof_clear_input();
 						if(function)
 						{	//If the calling function wanted to alert and prompt to cancel save
-							if(alert("At least one note occurs before the first section marker.", "Such notes won't show up when practicing sections in-game.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+							if(eof_alert("At least one note occurs before the first section marker.", "Such notes won't show up when practicing sections in-game.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 							{	//If the user opts to cancel the save
 								return 1;	//Return cancellation
 							}
 						}
 						else
 						{	//The calling function only wanted to alert
-							allegro_message("At least one note occurs before the first section marker.\nSuch notes won't show up when practicing sections in-game.");
+							eof_message("At least one note occurs before the first section marker.\nSuch notes won't show up when practicing sections in-game.");
 						}
 						break;	//Stop checking the first note in each track
 					}
@@ -14,11 +14,8 @@
 #define EOF_MAX_OGGS                 8
 #define EOF_OLD_MAX_NOTES        65536
 
-#define EOF_MAX_NOTES            32768
-///Use this definition instead to quadruple the note limit
-///#define EOF_MAX_NOTES            131072
+#define EOF_MIN_NOTE_CAPACITY       64	//The number of entries a track's note, tech note, fret hand position and lyric arrays are first allocated with, they double in size as needed
 
-#define EOF_MAX_LYRICS   EOF_MAX_NOTES
 #define EOF_MAX_LYRIC_LINES       4096
 #define EOF_MAX_LYRIC_LENGTH       255
 #define EOF_MAX_CATALOG_ENTRIES    256
@@ -162,7 +159,7 @@
 
 typedef struct
 {
-	char name[EOF_NAME_LENGTH + 1];
+	const char *name;			//Interned, see eof_intern_note_name()
 	unsigned char type;			//Stores the note's difficulty
 	unsigned char note;			//Stores the note's fret values
 	unsigned char accent;		//Stores the note's accent bitmask (for drums)
@@ -180,7 +177,7 @@ typedef struct
 
 typedef struct
 {
-	char name[EOF_NAME_LENGTH + 1];
+	const char *name;			//Interned, see eof_intern_note_name()
 	unsigned char type;			//Stores the note's difficulty
 	unsigned char note;			//Stores the note's string statuses (set=played, reset=not played).  Bit 0 refers to string 6 (low E), bit 5 refers to string 1 (high e), etc.
 	unsigned char ghost;		//Stores the note's ghost statuses.  Bit 0 indicates whether string 1 is ghosted, etc.
@@ -368,8 +365,9 @@ typedef struct
 	unsigned char numlanes;		//The number of lanes, keys, etc. in this track
 	EOF_TRACK_ENTRY * parent;	//Allows an easy means to look up the global track using a legacy track pointer
 
-	EOF_NOTE * note[EOF_MAX_NOTES];
+	EOF_NOTE ** note;				//Grows as notes are added, see eof_legacy_track_reserve_notes()
 	unsigned long notes;
+	unsigned long note_capacity;	//The number of entries allocated for note[]
 
 	/* solos */
 	EOF_PHRASE_SECTION solo[EOF_MAX_PHRASES];
@@ -399,8 +397,9 @@ typedef struct
 	unsigned char toneset;		//The tone cue set assigned for playback of this track
 	EOF_TRACK_ENTRY * parent;	//Allows an easy means to look up the global track using a vocal track pointer
 
-	EOF_LYRIC * lyric[EOF_MAX_LYRICS];
+	EOF_LYRIC ** lyric;				//Grows as lyrics are added, see eof_vocal_track_reserve_lyrics()
 	unsigned long lyrics;
+	unsigned long lyric_capacity;	//The number of entries allocated for lyric[]
 
 	/* lyric lines */
 	EOF_PHRASE_SECTION line[EOF_MAX_LYRIC_LINES];
@@ -427,12 +426,14 @@ typedef struct
 	unsigned long notes;
 
 	/* regular pro guitar notes */
-	EOF_PRO_GUITAR_NOTE * pgnote[EOF_MAX_NOTES];
+	EOF_PRO_GUITAR_NOTE ** pgnote;		//Grows as notes are added, see eof_pro_guitar_track_reserve_notes()
 	unsigned long pgnotes;
+	unsigned long pgnote_capacity;		//The number of entries allocated for pgnote[]
 
 	/* tech notes */
-	EOF_PRO_GUITAR_NOTE * technote[EOF_MAX_NOTES];
+	EOF_PRO_GUITAR_NOTE ** technote;	//Grows as tech notes are added
 	unsigned long technotes;
+	unsigned long technote_capacity;	//The number of entries allocated for technote[]
 
 	/* solos */
 	EOF_PHRASE_SECTION solo[EOF_MAX_PHRASES];
@@ -455,8 +456,9 @@ typedef struct
 	unsigned long tremolos;
 
 	/* fret hand positions */
-	EOF_PHRASE_SECTION handposition[EOF_MAX_NOTES];	//There has to be the ability to store as many fret hand position changes as there are notes
+	EOF_PHRASE_SECTION *handposition;	//There has to be the ability to store as many fret hand position changes as there are notes, so this grows the same way as the note arrays
 	unsigned long handpositions;
+	unsigned long handposition_capacity;	//The number of entries allocated for handposition[]
 
 	/* popup messages */
 	EOF_PHRASE_SECTION popupmessage[EOF_MAX_PHRASES];
@@ -635,11 +637,34 @@ typedef struct
 
 } EOF_SONG;
 
+//Chunk table of contents, appended after the track data of project files and undo states so that their sections can be located by offset
+#define EOF_CHUNK_TOC_SIGNATURE	0x434F5445	//"ETOC" as written in little endian, stored in the last 4 bytes of the file
+#define EOF_CHUNK_TOC_MAX		(EOF_TRACKS_MAX + 4)	//The beats, text events and custom data block chunks, plus one chunk for each track
+#define EOF_CHUNK_BEATS			1
+#define EOF_CHUNK_TEXT_EVENTS	2
+#define EOF_CHUNK_CUSTOM_DATA	3
+#define EOF_CHUNK_TRACK			4
+
+typedef struct
+{
+	unsigned long type;		//One of the EOF_CHUNK_ macros
+	unsigned long index;	//For track chunks, the track's position in the file's track list.  0 for other chunks
+	unsigned long offset;	//The number of bytes from the start of the file to the chunk
+	unsigned long size;		//The number of bytes in the chunk
+} EOF_CHUNK_TOC_ENTRY;
+
 EOF_SONG * eof_create_song(void);	//Allocates, initializes and returns an EOF_SONG structure
 void eof_destroy_song(EOF_SONG * sp);	//De-allocates the memory used by the EOF_SONG structure.  If eof_undo_in_progress is nonzero, the spectrogram and waveform data are destroyed if applicable.
 int eof_load_song_pf(EOF_SONG * sp, PACKFILE * fp);	//Loads data from the specified PACKFILE pointer into the given EOF_SONG structure (called by eof_load_song()).  Returns 0 on error
 EOF_SONG * eof_load_song(const char * fn);	//Loads the specified EOF file, validating the file header and loading the appropriate OGG file
 int eof_save_song(EOF_SONG * sp, const char * fn);	//Saves the song to file.  Returns zero on error
+int eof_save_song_pf(EOF_SONG * sp, PACKFILE * fp);	//Writes the song to the specified PACKFILE pointer, which is left open (called by eof_save_song()).  Returns zero on error
+	//If the PACKFILE was opened with eof_pack_fopen_memory(), a chunk table of contents is appended after the track data
+unsigned long eof_read_chunk_toc(const unsigned char *buffer, unsigned long size, EOF_CHUNK_TOC_ENTRY *toc);
+	//Reads the chunk table of contents from the end of the specified project file image into toc[], which must have EOF_CHUNK_TOC_MAX entries
+	//Returns the number of entries read, or 0 if the file has no table of contents or it is invalid
+EOF_CHUNK_TOC_ENTRY *eof_find_chunk(EOF_CHUNK_TOC_ENTRY *toc, unsigned long count, unsigned long type, unsigned long index);
+	//Returns the table of contents entry for the specified chunk, or NULL if it isn't listed
 EOF_SONG *eof_clone_chart_time_range(EOF_SONG *sp, unsigned long start, unsigned long end);	//Builds a new song structure containing the specified time range of content in the active project, or NULL on error
 
 unsigned long eof_get_track_size(EOF_SONG *sp, unsigned long track);						//Returns the number of notes/lyrics in the specified track (or just that of its active note set if a pro guitar track is specified), or 0 on error
@@ -693,9 +718,16 @@ void eof_set_note_accent(EOF_SONG *sp, unsigned long track, unsigned long note,
 void eof_set_note_ghost(EOF_SONG *sp, unsigned long track, unsigned long note, unsigned char value);	//Sets the accent bitmask value of the specified legacy or pro guitar note
 unsigned char eof_get_note_sp_deploy(EOF_SONG *sp, unsigned long track, unsigned long note);	//Returns the SP deploy bitmask of the specified note, or 0 on error
 void eof_set_note_sp_deploy(EOF_SONG *sp, unsigned long track, unsigned long note, unsigned char value);	//Sets the SP deploy bitmask of the specified note
-char *eof_get_note_name(EOF_SONG *sp, unsigned long track, unsigned long note);				//Returns a pointer to the note's statically allocated name array, or a lyric's text array, or NULL on error
-void eof_set_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, char *name);	//Copies the string into the note's statically allocated name array, or a lyric's text array
-void *eof_track_add_create_note(EOF_SONG *sp, unsigned long track, unsigned char note, unsigned long pos, long length, char type, char *text);
+const char *eof_get_note_name(EOF_SONG *sp, unsigned long track, unsigned long note);				//Returns a pointer to the note's interned name, or a lyric's text array, or NULL on error.  Use eof_set_note_name() to change it
+void eof_set_note_name(EOF_SONG *sp, unsigned long track, unsigned long note, const char *name);	//Points the note at the interned copy of the string, or copies the string into a lyric's text array
+char *eof_get_lyric_text(EOF_SONG *sp, unsigned long track, unsigned long lyric);	//Returns a pointer to the lyric's text array, which may be edited in place, or NULL on error or if the track isn't a vocal track
+const char *eof_intern_note_name(const char *name);
+	//Returns the shared copy of the string (truncated to EOF_NAME_LENGTH bytes), adding it to the name table if it isn't there yet
+	//Notes with the same name share one string instead of each storing a fixed size array.  NULL or an empty string returns the shared empty string
+	//Interned names are never modified and are kept until eof_free_note_names() is called at program exit
+void eof_free_note_names(void);
+	//Frees the interned note name table
+void *eof_track_add_create_note(EOF_SONG *sp, unsigned long track, unsigned char note, unsigned long pos, long length, char type, const char *text);
 	//Adds and initializes the appropriate note for the specified track, returning the newly created note structure, or NULL on error
 	//Automatic flags will be applied appropriately (ie. crazy status for all notes in PART KEYS)
 	//text is used to initialize the note name or lyric text, and may be NULL
@@ -703,6 +735,32 @@ void eof_track_sort_notes(EOF_SONG *sp, unsigned long track);
 	//Calls the appropriate sort function for the specified track.  eof_selection.multi[] is preserved before the sort and recreated afterward, since sorting invalidates
 	// the selection array due to note numbering being changed
 	//Functions that depend on notes being sorted should be able to expect that notes are sorted primarily by timestamp and secondarily by difficulty number
+
+#define EOF_NOTE_INDEX_CACHE_SIZE 4
+typedef struct
+{
+	EOF_SONG *sp;				//The project this index was built for
+	unsigned long track;		//The track this index was built for
+	unsigned char type;			//The track difficulty this index was built for
+	void *noteset;				//The note array this index was built for (identifies whether a pro guitar track's normal or tech notes were in view)
+	unsigned long generation;	//The track's invalidation counter at the time this index was built
+	unsigned long tracksize;	//The number of notes in the track at the time this index was built
+	unsigned long *notes;		//The numbers of the notes in the track difficulty, in the order they appear in the track
+	unsigned long count;		//The number of entries in notes[]
+	unsigned long capacity;		//The number of entries allocated for notes[]
+	unsigned long maxlength;	//The length of the longest note in the track difficulty, so that a search can back up far enough to find a sustain that reaches a given position
+	char sorted;				//Nonzero if the track difficulty's notes are in chronological order, which is required for eof_note_index_find() to binary search
+} EOF_NOTE_INDEX;
+
+void eof_note_index_invalidate(unsigned long track);	//Marks any cached note index for the specified track as needing to be rebuilt (called when notes are added, deleted, sorted or re-timed)
+void eof_note_index_invalidate_all(void);				//Marks all cached note indexes as needing to be rebuilt
+void eof_destroy_note_indexes(EOF_SONG *sp);			//Releases all cached note indexes built for the specified project, or all cached note indexes if sp is NULL
+EOF_NOTE_INDEX *eof_get_note_index(EOF_SONG *sp, unsigned long track, unsigned char type);
+	//Returns a cached index of the notes in the specified track difficulty, rebuilding it if it was invalidated or the track's note count changed
+	//Returns NULL on error, in which case the caller should examine every note in the track
+unsigned long eof_note_index_find(EOF_SONG *sp, EOF_NOTE_INDEX *ip, unsigned long pos);
+	//Binary searches the specified note index and returns the entry number of the first note at or after the specified position, or ip->count if there is none
+	//Returns 0 if the index isn't chronologically sorted, in which case the caller should examine every entry
 int eof_song_qsort_phrase_sections(const void * e1, const void * e2);	//A generic qsort comparitor that will sort phrase sections into chronological order
 long eof_track_fixup_previous_note(EOF_SONG *sp, unsigned long track, unsigned long note);	//Returns the note/lyric one before the specified note/lyric number that is in the same difficulty, or -1 if there is none
 long eof_track_fixup_next_note(EOF_SONG *sp, unsigned long track, unsigned long note);	//Returns the note/lyric one after the specified note/lyric number that is in the same difficulty, or -1 if there is none
@@ -802,6 +860,12 @@ void eof_erase_track_difficulty(EOF_SONG *sp, unsigned long track, unsigned char
 EOF_NOTE * eof_legacy_track_add_note(EOF_LEGACY_TRACK * tp);	//Allocates, initializes and stores a new EOF_NOTE structure into the notes array.  Returns the newly allocated structure or NULL upon error
 void eof_legacy_track_delete_note(EOF_LEGACY_TRACK * tp, unsigned long note);	//Removes and frees the specified note from the notes array.  All notes after the deleted note are moved back in the array one position
 void eof_legacy_track_sort_notes(EOF_LEGACY_TRACK * tp);	//Performs a quicksort of the notes array
+int eof_legacy_track_reserve_notes(EOF_LEGACY_TRACK * tp, unsigned long count);
+	//Ensures the track's note array has room for at least the specified number of notes, doubling its size as needed
+	//eof_selection.multi[] is grown to match
+	//Returns zero on error
+void eof_free_legacy_track(EOF_LEGACY_TRACK * tp);
+	//Frees the track structure and its note array.  Notes still in the track are not freed
 int eof_song_qsort_legacy_notes(const void * e1, const void * e2);	//The comparitor function used to quicksort the legacy notes array, first by timestamp, second by difficulty, third by note mask
 long eof_fixup_previous_legacy_note(EOF_LEGACY_TRACK * tp, unsigned long note);	//Returns the note one before the specified note number that is in the same difficulty, or -1 if there is none
 long eof_fixup_next_legacy_note(EOF_LEGACY_TRACK * tp, unsigned long note);	//Returns the note one after the specified note number that is in the same difficulty, or -1 if there is none
@@ -817,6 +881,10 @@ void eof_legacy_track_delete_tremolo(EOF_LEGACY_TRACK * tp, unsigned long index)
 int eof_legacy_track_add_slider(EOF_LEGACY_TRACK * tp, unsigned long start_pos, unsigned long end_pos);	//Adds a slider phrase at the specified start and stop timestamp for the specified track.  Returns nonzero on success
 
 EOF_LYRIC * eof_vocal_track_add_lyric(EOF_VOCAL_TRACK * tp);	//Allocates, initializes and stores a new EOF_LYRIC structure into the lyrics array.  Returns the newly allocated structure or NULL upon error
+int eof_vocal_track_reserve_lyrics(EOF_VOCAL_TRACK * tp, unsigned long count);
+	//Ensures the track's lyric array has room for at least the specified number of lyrics, doubling its size as needed
+	//eof_selection.multi[] is grown to match
+	//Returns zero on error
 void eof_vocal_track_delete_lyric(EOF_VOCAL_TRACK * tp, unsigned long lyric);	//Removes and frees the specified lyric from the lyrics array.  All lyrics after the deleted lyric are moved back in the array one position
 void eof_vocal_track_sort_lyrics(EOF_VOCAL_TRACK * tp);		//Performs a quicksort of the lyrics array by timestamp
 int eof_song_qsort_lyrics(const void * e1, const void * e2);	//The comparitor function used to quicksort the lyrics array
@@ -834,6 +902,19 @@ EOF_PRO_GUITAR_NOTE *eof_pro_guitar_track_add_note(EOF_PRO_GUITAR_TRACK *tp);
 EOF_PRO_GUITAR_NOTE *eof_pro_guitar_track_add_tech_note(EOF_PRO_GUITAR_TRACK *tp);	//Allocates, initializes and stores a new EOF_PRO_GUITAR_NOTE structure into the technote array.  Returns the newly allocated structure or NULL upon error
 void eof_pro_guitar_track_sort_notes(EOF_PRO_GUITAR_TRACK * tp);	//Performs a quicksort of the active note set, first by timestamp, second by difficulty, third by note mask
 void eof_pro_guitar_track_sort_tech_notes(EOF_PRO_GUITAR_TRACK * tp);	//Performs a quicksort of the specified track's tech notes, first by timestamp, second by difficulty, third by note mask
+EOF_PRO_GUITAR_TRACK *eof_create_pro_guitar_track(void);
+	//Allocates a zero initialized pro guitar track with its note arrays allocated and the regular note set in effect
+	//The normal and tech note arrays are always allocated separately, since the active note set is identified by comparing tp->note against them
+	//Returns NULL on error
+int eof_pro_guitar_track_reserve_notes(EOF_PRO_GUITAR_TRACK * tp, unsigned long count, char tech);
+	//Ensures the track's regular note array (or tech note array if tech is nonzero) has room for at least the specified number of notes,
+	// doubling its size as needed and keeping tp->note pointed at the active note set
+	//eof_selection.multi[] is grown to match
+	//Returns zero on error
+int eof_pro_guitar_track_reserve_hand_positions(EOF_PRO_GUITAR_TRACK * tp, unsigned long count);
+	//Ensures the track's fret hand position array has room for at least the specified number of entries.  Returns zero on error
+void eof_free_pro_guitar_track(EOF_PRO_GUITAR_TRACK * tp);
+	//Frees the track structure and its note, tech note and fret hand position arrays.  Notes still in the track are not freed
 int eof_song_qsort_pro_guitar_notes(const void * e1, const void * e2);	//The comparitor function used to quicksort the pro guitar notes array
 void eof_pro_guitar_track_delete_note(EOF_PRO_GUITAR_TRACK * tp, unsigned long note);	//Removes and frees the specified note from the notes array.  All notes after the deleted note are moved back in the array one position
 long eof_fixup_previous_pro_guitar_note(EOF_PRO_GUITAR_TRACK * tp, unsigned long note);	//Returns the note one before the specified note number that is in the same difficulty, or -1 if there is none
@@ -924,7 +1005,7 @@ int eof_load_song_string_pf(char *const buffer, PACKFILE *fp, const size_t buffe
 	//That number of bytes is read, the first (buffersize-1) of which are copied to the buffer
 	//If buffersize is 0, the string is parsed in the file but not stored, otherwise the buffer is NULL terminated
 	//Nonzero is returned on error
-int eof_save_song_string_pf(char *const buffer, PACKFILE *fp);
+int eof_save_song_string_pf(const char *buffer, PACKFILE *fp);
 	//Writes two bytes for the length of the string, followed by the string (minus the NULL terminator)
 	//If buffer is NULL, two zero bytes (representing empty string) are written to the file
 	//The length of the string written is in bytes, not chars, so Unicode strings could be supported
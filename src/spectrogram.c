@@ -4,6 +4,8 @@
 #include "spectrogram.h"
 #include "song.h"
 #include "main.h"
+#include "pcm.h"
+#include "modules/g-idle.h"
 
 #ifdef USEMEMWATCH
 #include "memwatch.h"
@@ -24,10 +26,21 @@ int eof_spectrogram_userange = 0;					//Specifies whether to display the selecte
 int eof_spectrogram_logplot = 1;					//Specifies whether to graph the y-axis on a log scale
 int eof_spectrogram_avgbins = 0;					//Specifies whether to average the bins within a pixel
 
-void eof_destroy_spectrogram(struct spectrogramstruct *ptr)
+static fftw_plan eof_spectrogram_fftplan = NULL;	//The FFTW plan is kept between spectrogram generations, since exhaustive planning is slow
+static int eof_spectrogram_fftplan_size = 0;		//The window size eof_spectrogram_fftplan was created for
+
+void eof_destroy_spectrogram_fftplan(void)
 {
-	unsigned long ctr;
+	if(eof_spectrogram_fftplan)
+	{
+		fftw_destroy_plan(eof_spectrogram_fftplan);
+		eof_spectrogram_fftplan = NULL;
+	}
+	eof_spectrogram_fftplan_size = 0;
+}
 
+void eof_destroy_spectrogram(struct spectrogramstruct *ptr)
+{
  	eof_log("eof_destroy_spectrogram() entered", 1);
 
 	if(ptr)
@@ -35,25 +48,14 @@ void eof_destroy_spectrogram(struct spectrogramstruct *ptr)
 		if(ptr->oggfilename)
 			free(ptr->oggfilename);
 		if(ptr->left.slices)
-		{
-			for(ctr = 0; ctr < ptr->numslices; ctr++)
-			{	//For each slice of spectrogram data
-				if(ptr->left.slices[ctr].amplist)
-					free(ptr->left.slices[ctr].amplist);
-			}
 			free(ptr->left.slices);
-		}
 		if(ptr->right.slices)
-		{
-			for(ctr = 0; ctr < ptr->numslices; ctr++)
-			{	//For each slice of spectrogram data
-				if(ptr->right.slices[ctr].amplist)
-					free(ptr->right.slices[ctr].amplist);
-			}
 			free(ptr->right.slices);
-		}
+		if(ptr->amparena)
+			free(ptr->amparena);	//Every slice's amplitude list is stored in this one allocation
 		if(ptr->px_to_freq.map)
 			free(ptr->px_to_freq.map);
+		eof_destroy_spectrogram_tiles(ptr);
 		free(ptr);
 	}
 
@@ -69,9 +71,148 @@ void eof_destroy_spectrogram(struct spectrogramstruct *ptr)
 	eof_spectrogram_colorscale = NULL;
 }
 
+void eof_destroy_spectrogram_tiles(struct spectrogramstruct *spectrogram)
+{
+	unsigned long ctr;
+
+	if(!spectrogram)
+		return;
+
+	for(ctr = 0; ctr < EOF_SPECTROGRAM_TILE_COUNT; ctr++)
+	{	//For each tile
+		if(spectrogram->tilecache.tiles[ctr].bitmap)
+		{
+			destroy_bitmap(spectrogram->tilecache.tiles[ctr].bitmap);
+			spectrogram->tilecache.tiles[ctr].bitmap = NULL;
+		}
+	}
+}
+
+static double eof_spectrogram_pixel_amplitude(struct spectrogramstruct *spectrogram, struct spectrogramslice *ampdata, unsigned long curslice, unsigned long yoffset)
+{
+	unsigned long cursamp, nextsamp, sampoffset;
+	double val;
+
+	//Find the bins for these frequencies
+	cursamp = spectrogram_get_freq_from_px(spectrogram, yoffset);
+	if(eof_spectrogram_avgbins)
+	{
+		nextsamp = spectrogram_get_freq_from_px(spectrogram, yoffset+1);
+		if(cursamp == nextsamp)
+		{
+			nextsamp = cursamp + 1;
+		}
+
+		//Average the samples to get a gray value
+		val = 0.0;
+		for(sampoffset = cursamp; sampoffset < nextsamp; sampoffset++)
+		{	//Break from loop before a buffer overread can occur
+			val += ampdata[curslice].amplist[sampoffset];
+		}
+		val = val/(double)(nextsamp - cursamp);
+	}
+	else
+	{
+		val = ampdata[curslice].amplist[cursamp];
+	}
+
+	return val;
+}
+
+static int eof_spectrogram_column_has_data(struct spectrogramstruct *spectrogram, unsigned long column)
+{
+	return ((unsigned long)((double)(column * eof_zoom) / spectrogram->windowlength) < spectrogram->numslices);
+}
+
+static struct spectrogramtile *eof_get_spectrogram_tile(struct spectrogramstruct *spectrogram, char channelnum, unsigned long column)
+{
+	struct spectrogramtilecache *cache = &spectrogram->tilecache;
+	struct spectrogramchanneldata *channel = channelnum ? &spectrogram->right : &spectrogram->left;
+	struct spectrogramtile *tile = NULL;
+	unsigned long ctr, curslice, yoffset, height = channel->height - 1;
+
+	cache->usecounter++;
+	for(ctr = 0; ctr < EOF_SPECTROGRAM_TILE_COUNT; ctr++)
+	{	//For each tile
+		if(cache->tiles[ctr].bitmap && (cache->tiles[ctr].channel == channelnum) && (cache->tiles[ctr].column == column))
+		{	//If this column range was already rendered
+			cache->tiles[ctr].lastused = cache->usecounter;
+			return &cache->tiles[ctr];
+		}
+		if(!tile || (tile->bitmap && (!cache->tiles[ctr].bitmap || (cache->tiles[ctr].lastused < tile->lastused))))
+		{	//Track the first unused tile, otherwise the least recently used one
+			tile = &cache->tiles[ctr];
+		}
+	}
+
+	//Render the column range into the chosen tile
+	if(!tile->bitmap)
+	{
+		tile->bitmap = create_bitmap(EOF_SPECTROGRAM_TILE_WIDTH, height);
+		if(!tile->bitmap)
+			return NULL;
+	}
+	tile->channel = channelnum;
+	tile->column = column;
+	tile->lastused = cache->usecounter;
+	clear_to_color(tile->bitmap, 0);
+	for(ctr = 0; ctr < EOF_SPECTROGRAM_TILE_WIDTH; ctr++, column++)
+	{	//For each column in the tile
+		if(!eof_spectrogram_column_has_data(spectrogram, column))
+			break;	//The rest of the tile is past the end of the audio and won't be drawn
+		curslice = (double)(column * eof_zoom) / spectrogram->windowlength;
+		for(yoffset = 0; yoffset < height; yoffset++)
+		{	//For each pixel in the column, from the bottom up
+			putpixel(tile->bitmap, ctr, height - 1 - yoffset, eof_color_scale(log(eof_spectrogram_pixel_amplitude(spectrogram, channel->slices, curslice, yoffset)), spectrogram->log_max, eof_spectrogram_colorscheme));
+		}
+	}
+
+	return tile;
+}
+
+static void eof_render_spectrogram_tiles(struct spectrogramstruct *spectrogram, char channelnum, unsigned long startpixel, unsigned long curms)
+{
+	struct spectrogramchanneldata *channel = channelnum ? &spectrogram->right : &spectrogram->left;
+	struct spectrogramtile *tile;
+	unsigned long x, ctr, column, tilecolumn, width, top;
+
+	if(channel->height < 2)
+		return;	//There are no rows to draw
+
+	top = channel->yaxis + channel->halfheight - (channel->height - 2);	//The top row drawn by eof_render_spectrogram_col()
+	column = curms / eof_zoom;	//Each pixel represents eof_zoom number of milliseconds of audio
+	for(x = startpixel; x < (unsigned long)eof_window_editor->w; x += width, column += width)
+	{	//For each run of columns that is in the same tile
+		if(!eof_spectrogram_column_has_data(spectrogram, column))
+			break;	//The rest of the graph is past the end of the audio
+
+		tilecolumn = column - (column % EOF_SPECTROGRAM_TILE_WIDTH);
+		width = EOF_SPECTROGRAM_TILE_WIDTH - (column - tilecolumn);
+		if(width > eof_window_editor->w - x)
+			width = eof_window_editor->w - x;
+		while((width > 1) && !eof_spectrogram_column_has_data(spectrogram, column + width - 1))
+		{	//Don't draw the columns past the end of the audio
+			width--;
+		}
+
+		tile = eof_get_spectrogram_tile(spectrogram, channelnum, tilecolumn);
+		if(tile)
+		{
+			blit(tile->bitmap, eof_window_editor->screen, column - tilecolumn, 0, x, top, width, channel->height - 1);
+		}
+		else
+		{	//If the tile couldn't be allocated, draw the columns directly
+			for(ctr = 0; ctr < width; ctr++)
+			{
+				eof_render_spectrogram_col(spectrogram, channel, channel->slices, x + ctr, (column + ctr) * eof_zoom);
+			}
+		}
+	}
+}
+
 int eof_render_spectrogram(struct spectrogramstruct *spectrogram)
 {
-	unsigned long x,startpixel;
+	unsigned long startpixel;
 	unsigned long ycoord1,ycoord2;	//Stores the Y coordinates of graph 1's and 2's Y axis
 	unsigned long height;		//Stores the heigth of the fretboard area
 	unsigned long top,bottom;	//Stores the top and bottom coordinates for the area the graph will render to
@@ -177,19 +318,24 @@ int eof_render_spectrogram(struct spectrogramstruct *spectrogram)
 	//Calculate the y axis bins
 	eof_spectrogram_calculate_px_to_freq(spectrogram);
 
-//render graph from left to right, one pixel at a time (each pixel represents eof_zoom number of milliseconds of audio)
-	//for(x=startpixel;x < eof_window_editor->w;x++)
-	for(x=startpixel;x < eof_window_editor->w;x++,curms+=eof_zoom)
-	{	//for each pixel in the piano roll's visible width
-		if(eof_spectrogram_renderleftchannel)
-		{	//If the left channel rendering is enabled
-			eof_render_spectrogram_col(spectrogram,&spectrogram->left,spectrogram->left.slices,x,curms);
-		}
+	//Discard the cached tiles if they were rendered with different settings
+	if((spectrogram->tilecache.zoom != eof_zoom) || (spectrogram->tilecache.height != height) || (spectrogram->tilecache.colorscheme != eof_spectrogram_colorscheme) || (spectrogram->tilecache.avgbins != eof_spectrogram_avgbins))
+	{
+		eof_destroy_spectrogram_tiles(spectrogram);
+		spectrogram->tilecache.zoom = eof_zoom;
+		spectrogram->tilecache.height = height;
+		spectrogram->tilecache.colorscheme = eof_spectrogram_colorscheme;
+		spectrogram->tilecache.avgbins = eof_spectrogram_avgbins;
+	}
 
-		if(eof_spectrogram_renderrightchannel)
-		{	//If the right channel rendering is enabled
-			eof_render_spectrogram_col(spectrogram,&spectrogram->right,spectrogram->right.slices,x,curms);
-		}
+//render graph from left to right, blitting runs of pre-colored columns from the tile cache
+	if(eof_spectrogram_renderleftchannel)
+	{	//If the left channel rendering is enabled
+		eof_render_spectrogram_tiles(spectrogram, 0, startpixel, curms);
+	}
+	if(eof_spectrogram_renderrightchannel)
+	{	//If the right channel rendering is enabled
+		eof_render_spectrogram_tiles(spectrogram, 1, startpixel, curms);
 	}
 
 	return 0;
@@ -242,6 +388,7 @@ void eof_spectrogram_calculate_px_to_freq(struct spectrogramstruct *spectrogram)
 
 	eof_log("Recreating px_to_freq table",1);
 	spectrogram->px_to_freq.dirty = 0;
+	eof_destroy_spectrogram_tiles(spectrogram);	//The cached tiles were rendered with the old table
 
 	if(spectrogram->px_to_freq.map)
 		free(spectrogram->px_to_freq.map);
@@ -343,9 +490,6 @@ void eof_render_spectrogram_col(struct spectrogramstruct *spectrogram,struct spe
 	unsigned long curslice;
 	unsigned long actualzero;
 	double val;
-	unsigned long cursamp;
-	unsigned long nextsamp;
-	unsigned long sampoffset;
 
 	if(spectrogram != NULL)
 	{
@@ -357,28 +501,7 @@ void eof_render_spectrogram_col(struct spectrogramstruct *spectrogram,struct spe
 		}
 		for(yoffset=0;yoffset < channel->height-1;yoffset++)
 		{
-			//Find the bins for these frequencies
-			cursamp = spectrogram_get_freq_from_px(spectrogram, yoffset);
-			if(eof_spectrogram_avgbins)
-			{
-				nextsamp = spectrogram_get_freq_from_px(spectrogram, yoffset+1);
-				if(cursamp == nextsamp)
-				{
-					nextsamp = cursamp + 1;
-				}
-
-				//Average the samples to get a gray value
-				val = 0.0;
-				for(sampoffset = cursamp; sampoffset < nextsamp; sampoffset++)
-				{	//Break from loop before a buffer overread can occur
-					val += ampdata[curslice].amplist[sampoffset];
-				}
-				val = val/(double)(nextsamp - cursamp);
-			}
-			else
-			{
-				val = ampdata[curslice].amplist[cursamp];
-			}
+			val = eof_spectrogram_pixel_amplitude(spectrogram, ampdata, curslice, yoffset);
 
 			putpixel(eof_window_editor->screen, x, actualzero - yoffset, eof_color_scale(log(val),spectrogram->log_max,eof_spectrogram_colorscheme));
 			//To test a color scale
@@ -531,51 +654,34 @@ void eof_render_spectrogram_line(struct spectrogramstruct *spectrogram,struct sp
 #define EOF_DEBUG_SPECTROGRAM
 struct spectrogramstruct *eof_create_spectrogram(char *oggfilename)
 {
-	ALOGG_OGG *oggstruct=NULL;
+	EOF_PCM_CACHE_ENTRY *pcm=NULL;
 	SAMPLE *audio=NULL;
-	void * oggbuffer = NULL;
 	struct spectrogramstruct *spectrogram=NULL;
 	static struct spectrogramstruct emptyspectrogram;	//all variables in this auto initialize to value 0
-	char done=0;	//-1 on unsuccessful completion, 1 on successful completion
+	char done=0;	//-1 on unsuccessful completion, 1 on successful completion, 2 if the user canceled
 	unsigned long slicenum=0;
-	clock_t starttime = 0, endtime = 0;
-
-	fftw_plan fftplan;
+	double starttime = 0.0, endtime = 0.0;
 
 	eof_log("\tGenerating spectrogram", 1);
 	eof_log("eof_create_spectrogram() entered", 1);
 	set_window_title("Generating Spectrogram...");
-	starttime = clock();	//Get the start time of the spectrogram creation
+	starttime = eof_get_wall_time();	//Get the start time of the spectrogram creation
 
 	if(oggfilename == NULL)
 	{
 		#ifdef EOF_DEBUG_SPECTROGRAM
-		allegro_message("Spectrogram: Invalid parameters");
+		eof_message("Spectrogram: Invalid parameters");
 		#endif
 		return NULL;
 	}
 
-//Load OGG file into memory
-	oggbuffer = eof_buffer_file(oggfilename, 0);
-	if(!oggbuffer)
-	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Spectrogram: Failed to open input audio file: %s",strerror(errno));
-		eof_log(eof_log_string, 1);
-		return NULL;
-	}
-	oggstruct=alogg_create_ogg_from_buffer(oggbuffer, (int) file_size_ex(oggfilename));
-	if(oggstruct == NULL)
-	{
-		eof_log("Spectrogram: ALOGG failed to open input audio file", 1);
-		free(oggbuffer);
-		return NULL;
-	}
-
-//Decode OGG into memory
-	audio=alogg_create_sample_from_ogg(oggstruct);
+//Obtain the decoded audio, which is shared with the waveform graph and other analysis functions
+	pcm=eof_pcm_cache_acquire(oggfilename);
+	if(pcm)
+		audio=pcm->audio;
 	if(audio == NULL)
 	{
-		eof_log("Spectrogram: ALOGG failed to decode input audio file", 1);
+		eof_log("Spectrogram: Failed to decode input audio file", 1);
 		done=-1;
 	}
 	else if((audio->bits != 8) && (audio->bits != 16))	//This logic currently only supports 8 and 16 bit audio
@@ -595,8 +701,7 @@ struct spectrogramstruct *eof_create_spectrogram(char *oggfilename)
 		else
 		{
 			*spectrogram=emptyspectrogram;					//Set all variables to value zero
-			spectrogram->numbuff = 1;
-			if(alogg_get_wave_is_stereo_ogg(oggstruct))	//If this audio file has two audio channels
+			if(audio->stereo)	//If this audio file has two audio channels
 				spectrogram->is_stereo = 1;
 			else
 				spectrogram->is_stereo = 0;
@@ -642,52 +747,204 @@ struct spectrogramstruct *eof_create_spectrogram(char *oggfilename)
 		}
 	}
 
-	//Allocate memory for the buffer pointers
+	//Allocate the amplitude lists for all slices of both channels in one contiguous block
 	if((done != -1) && spectrogram)
 	{	//If there wasn't an error yet
-		clock_t starttime2 = 0, endtime2 = 0;
-
-		spectrogram->buffin=(double *) fftw_malloc(sizeof(double) * eof_spectrogram_windowsize*spectrogram->numbuff);
-		spectrogram->buffout=(double *) fftw_malloc(sizeof(double) * eof_spectrogram_windowsize*spectrogram->numbuff);
+		unsigned long amplistsize = (unsigned long)eof_spectrogram_windowsize / 2 + 1;	//Each slice stores one amplitude for each frequency band
+		unsigned long channels = spectrogram->is_stereo ? 2 : 1;
 
-		starttime2 = clock();
-		fftplan=fftw_plan_r2r_1d(eof_spectrogram_windowsize,spectrogram->buffin,spectrogram->buffout,FFTW_R2HC,FFTW_DESTROY_INPUT | FFTW_EXHAUSTIVE);
-		endtime2 = clock();
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tFFTW plan generated in %f seconds.", (double)(endtime2 - starttime2) / (double)CLOCKS_PER_SEC);
-		eof_log(eof_log_string, 1);
+		spectrogram->amparena=(double *)malloc(sizeof(double) * amplistsize * spectrogram->numslices * channels);
+		if(spectrogram->amparena == NULL)
+		{
+			eof_log("Spectrogram: Unable to allocate memory for the amplitude data", 1);
+			done=-1;
+		}
+		else
+		{
+			for(slicenum=0; slicenum < spectrogram->numslices; slicenum++)
+			{	//For each slice, point its amplitude list(s) into the arena
+				spectrogram->left.slices[slicenum].amplist = spectrogram->amparena + (slicenum * amplistsize);
+				if(spectrogram->is_stereo)
+					spectrogram->right.slices[slicenum].amplist = spectrogram->amparena + ((spectrogram->numslices + slicenum) * amplistsize);
+			}
+		}
+	}
 
-		eof_log("\tGenerating slices...", 1);
-		while(!done)
+	//Create the FFTW plan if the window size changed since the last spectrogram was generated
+	if((done != -1) && spectrogram && (!eof_spectrogram_fftplan || (eof_spectrogram_fftplan_size != eof_spectrogram_windowsize)))
+	{
+		double starttime2 = 0.0, endtime2 = 0.0;
+		double *buffin=(double *) fftw_malloc(sizeof(double) * eof_spectrogram_windowsize);
+		double *buffout=(double *) fftw_malloc(sizeof(double) * eof_spectrogram_windowsize);
+
+		eof_destroy_spectrogram_fftplan();
+		if(buffin && buffout)
+		{	//The plan is only executed with other buffers allocated by fftw_malloc(), so these are just used for planning
+			starttime2 = eof_get_wall_time();
+			eof_spectrogram_fftplan=fftw_plan_r2r_1d(eof_spectrogram_windowsize,buffin,buffout,FFTW_R2HC,FFTW_DESTROY_INPUT | FFTW_EXHAUSTIVE);
+			endtime2 = eof_get_wall_time();
+			eof_spectrogram_fftplan_size = eof_spectrogram_windowsize;
+			(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tFFTW plan generated in %f seconds.", endtime2 - starttime2);
+			eof_log(eof_log_string, 1);
+		}
+		if(buffin)
+			fftw_free(buffin);
+		if(buffout)
+			fftw_free(buffout);
+		if(!eof_spectrogram_fftplan)
 		{
-			done=eof_process_next_spectrogram_slice(spectrogram,audio,slicenum++,fftplan);
+			eof_log("Spectrogram: Unable to create the FFTW plan", 1);
+			done=-1;
 		}
 	}
 
+	if((done != -1) && spectrogram)
+	{	//If there wasn't an error yet
+		eof_log("\tGenerating slices...", 1);
+		done = eof_spectrogram_threaded_process(spectrogram, audio, eof_spectrogram_fftplan, eof_cpu_count());
+	}
+
 //Cleanup
-	alogg_destroy_ogg(oggstruct);
-	if(audio != NULL)
-	if(oggbuffer)
-		free(oggbuffer);
-	if(done == -1)	//Unsuccessful completion
+	eof_pcm_cache_release(pcm);
+	if(done != 1)	//Unsuccessful completion
 	{
 		if(spectrogram)
 		{
 			if(spectrogram->oggfilename)
 				free(spectrogram->oggfilename);
+			if(spectrogram->left.slices)
+				free(spectrogram->left.slices);
+			if(spectrogram->right.slices)
+				free(spectrogram->right.slices);
+			if(spectrogram->amparena)
+				free(spectrogram->amparena);
 			free(spectrogram);
 		}
-		eof_log("Spectrogram: Failed to generate spectrogram", 1);
+		if(done == 2)
+		{
+			eof_log("Spectrogram: Generation canceled by user", 1);
+			set_window_title("Release Escape key...");
+			while(key[KEY_ESC])
+			{	//Wait for user to release Escape key
+				Idle(10);
+			}
+			eof_fix_window_title();
+		}
+		else
+			eof_log("Spectrogram: Failed to generate spectrogram", 1);
 		return NULL;	//Return error
 	}
 
-	endtime = clock();	//Get the start time of the spectrogram creation
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tSpectrogram generated in %f seconds", (double)(endtime - starttime) / (double)CLOCKS_PER_SEC);
+	endtime = eof_get_wall_time();	//Get the end time of the spectrogram creation
+	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tSpectrogram generated in %f seconds", endtime - starttime);
 	eof_log(eof_log_string, 1);
 
 	return spectrogram;	//Return spectrogram data
 }
 
-int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAMPLE *audio,unsigned long slicenum,fftw_plan fftplan)
+static int eof_spectrogram_work(void *context, void *worker, unsigned long first_item, unsigned long end_item, volatile int *cancel)
+{
+	EOF_SPECTROGRAM_WORK_CONTEXT *ctx = (EOF_SPECTROGRAM_WORK_CONTEXT *)context;
+	EOF_SPECTROGRAM_WORKER *wp = (EOF_SPECTROGRAM_WORKER *)worker;
+	unsigned long slicenum;
+
+	(void) cancel;	//A slice range is short enough to finish before checking for cancellation
+	if(!ctx || !wp)
+		return 1;	//Invalid parameters
+
+	for(slicenum = first_item; slicenum < end_item; slicenum++)
+	{	//For each slice in the range
+		if(eof_process_next_spectrogram_slice(ctx->spectrogram, ctx->audio, slicenum, ctx->fftplan, wp->buffin, wp->buffout, &wp->destmax) < 0)
+			return 1;	//The slice failed to process
+	}
+
+	return 0;
+}
+
+int eof_spectrogram_threaded_process(struct spectrogramstruct *spectrogram, SAMPLE *audio, fftw_plan fftplan, unsigned long worker_count)
+{
+	EOF_SPECTROGRAM_WORKER *workers;
+	EOF_SPECTROGRAM_WORK_CONTEXT context;
+	EOF_WORK_POOL pool = {0};
+	unsigned long ctr;
+	int error = 0, retval = 1;
+
+	if(!spectrogram || !audio || !fftplan || !worker_count)
+		return -1;	//Invalid parameters
+
+	if(worker_count > spectrogram->numslices / EOF_SPECTROGRAM_SLICE_RANGE + 1)
+		worker_count = spectrogram->numslices / EOF_SPECTROGRAM_SLICE_RANGE + 1;	//Don't start more threads than there are slice ranges
+
+	context.spectrogram = spectrogram;
+	context.audio = audio;
+	context.fftplan = fftplan;
+
+	//Initialize worker array, each worker gets its own FFT buffers but shares the plan, which FFTW allows to be executed concurrently on different buffers
+	workers = malloc(sizeof(EOF_SPECTROGRAM_WORKER) * worker_count);
+	if(!workers)
+	{
+		eof_log("\tFailed to allocate memory", 1);
+		return -1;	//Return failure
+	}
+	for(ctr = 0; ctr < worker_count; ctr++)
+	{	//For each worker entry
+		EOF_SPECTROGRAM_WORKER *wp = &workers[ctr];
+
+		wp->buffin = (double *) fftw_malloc(sizeof(double) * eof_spectrogram_windowsize);	//FFTW requires the same alignment as the arrays used for planning, which fftw_malloc() guarantees
+		wp->buffout = (double *) fftw_malloc(sizeof(double) * eof_spectrogram_windowsize);
+		wp->destmax = 0.0;
+		if(!wp->buffin || !wp->buffout)
+			error = 1;
+	}
+	if(error)
+	{
+		eof_log("\tFailed to allocate memory", 1);
+		retval = -1;
+	}
+	else
+	{	//Run the worker threads
+		pool.function = eof_spectrogram_work;
+		pool.context = &context;
+		pool.workers = workers;
+		pool.worker_size = sizeof(EOF_SPECTROGRAM_WORKER);
+		pool.worker_count = worker_count;
+		pool.first_item = 0;
+		pool.end_item = spectrogram->numslices;
+		pool.range_size = EOF_SPECTROGRAM_SLICE_RANGE;
+		pool.title = "Generating Spectrogram";
+		pool.inline_fallback = 1;	//Generate the spectrogram in this thread if no worker threads can be created
+		error = eof_work_pool_run(&pool);
+		if(error == 1)
+			retval = -1;
+		else if(error == 2)
+			retval = 2;
+
+		//Combine the worker threads' results
+		spectrogram->destmax = 0.0;
+		for(ctr = 0; ctr < pool.workers_used; ctr++)
+		{	//For each worker entry that was used
+			if(workers[ctr].destmax > spectrogram->destmax)
+				spectrogram->destmax = workers[ctr].destmax;
+		}
+
+		eof_logf(1, "\t%lu of %lu slices were generated by %lu worker threads", pool.items_completed, spectrogram->numslices, pool.workers_used);
+	}
+
+	//Clean up
+	for(ctr = 0; ctr < worker_count; ctr++)
+	{	//For each worker entry
+		if(workers[ctr].buffin)
+			fftw_free(workers[ctr].buffin);
+		if(workers[ctr].buffout)
+			fftw_free(workers[ctr].buffout);
+	}
+	free(workers);
+	eof_fix_window_title();
+
+	return retval;
+}
+
+int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAMPLE *audio,unsigned long slicenum,fftw_plan fftplan,double *buffin,double *buffout,double *destmax)
 {
 	unsigned long sampleindex=0;	//The byte index into audio->data
 	unsigned long startsample=0;	//The sample number of the first sample being processed
@@ -700,21 +957,18 @@ int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAM
 	char outofsamples=0;		//Will be set to 1 if all samples in the audio structure have been processed
 
 //Validate parameters
-	if((spectrogram == NULL) || (spectrogram->left.slices == NULL) || (audio == NULL))
+	if((spectrogram == NULL) || (spectrogram->left.slices == NULL) || (audio == NULL) || !buffin || !buffout || !destmax)
 	{
-		eof_log("\tNo sound found", 1);
 		return -1;	//Return error
 	}
 
 	if(spectrogram->is_stereo && (spectrogram->right.slices == NULL))
 	{
-		eof_log("\tStereo channel not found", 1);
 		return -1;	//Return error
 	}
 
 	if((slicenum >= spectrogram->numslices))
 	{	//If this is more than the number of slices that were supposed to be read
-		eof_log("\tSlicenum is too far", 1);
 		return 1;	//Return out of samples
 	}
 
@@ -738,7 +992,7 @@ int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAM
 			{
 				outofsamples=1;
 				//Zero-pad the remaining buffer...
-				memset(spectrogram->buffin+cursamp,0,sizeof(double) * (eof_spectrogram_windowsize - cursamp));
+				memset(buffin+cursamp,0,sizeof(double) * (eof_spectrogram_windowsize - cursamp));
 				break;
 			}
 
@@ -747,11 +1001,11 @@ int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAM
 				sample+=((unsigned char *)audio->data)[sampleindex+1]<<8;	//Assume little endian byte order, read the next (high byte) of data
 
 			sample -= spectrogram->zeroamp;
-			spectrogram->buffin[cursamp] = (double)sample;
+			buffin[cursamp] = (double)sample;
 
 			sampleindex+=samplesize;		//Adjust index to point to next sample for this channel
 		}
-		fftw_execute(fftplan);
+		fftw_execute_r2r(fftplan, buffin, buffout);	//Use the new-array execute function, which is safe to call from multiple threads with the same plan
 		if(channel == 0)
 		{
 			dest=&spectrogram->left.slices[slicenum];
@@ -765,26 +1019,24 @@ int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAM
 		{	//Logic error
 			return -1;	//Return error
 		}
-		dest->amplist=(double*)malloc(sizeof(double) * (halfsize + 1));
 		if(dest->amplist == NULL)
-		{
-			eof_log("Spectrogram: Unable to allocate memory for the amplitude data", 1);
+		{	//The amplitude list is expected to have been pointed into the spectrogram's amplitude arena
 			return -1;	//Return error
 		}
-		dest->amplist[0] = spectrogram->buffout[0];			//The first one is all real
+		dest->amplist[0] = buffout[0];			//The first one is all real
 		for(cursamp=halfsize - 1; cursamp > 0; cursamp--)
 		{
 			dest->amplist[cursamp] = sqrt(
-				spectrogram->buffout[cursamp] * spectrogram->buffout[cursamp] +
-				spectrogram->buffout[eof_spectrogram_windowsize - cursamp] *
-				spectrogram->buffout[eof_spectrogram_windowsize - cursamp]
+				buffout[cursamp] * buffout[cursamp] +
+				buffout[eof_spectrogram_windowsize - cursamp] *
+				buffout[eof_spectrogram_windowsize - cursamp]
 			);
-			if(dest->amplist[cursamp] > spectrogram->destmax)
+			if(dest->amplist[cursamp] > *destmax)
 			{
-				spectrogram->destmax = dest->amplist[cursamp];
+				*destmax = dest->amplist[cursamp];
 			}
 		}
-		dest->amplist[halfsize] = spectrogram->buffout[halfsize];
+		dest->amplist[halfsize] = buffout[halfsize];
 	}
 
 	return outofsamples;	//Return success/completed status
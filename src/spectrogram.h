@@ -5,6 +5,9 @@
 #define DEFAULT_STARTFREQ 27.5
 #define DEFAULT_ENDFREQ 4186
 #define MINFREQ 27.5
+#define EOF_SPECTROGRAM_SLICE_RANGE 256	//The number of slices a spectrogram worker thread claims at a time
+#define EOF_SPECTROGRAM_TILE_WIDTH 128	//The number of graph columns rendered into each cached tile
+#define EOF_SPECTROGRAM_TILE_COUNT 72	//The maximum number of cached tiles, enough for both channels across a 4K wide editor window
 
 struct spectrogramslice
 {
@@ -31,12 +34,30 @@ struct spectrogrampxtofreq
 	char is_log;
 };
 
+//A cached strip of pre-colored graph columns
+struct spectrogramtile
+{
+	BITMAP *bitmap;
+	unsigned long column;	//The first column this tile renders, measured in units of eof_zoom milliseconds from the start of the audio
+	char channel;			//0 for the left channel, 1 for the right channel
+	unsigned long lastused;	//The tile cache's use counter value when this tile was last drawn, so the least recently used tile can be replaced
+};
+
+//The cached tiles are only valid for the settings they were rendered with, and are discarded when any of them change
+struct spectrogramtilecache
+{
+	struct spectrogramtile tiles[EOF_SPECTROGRAM_TILE_COUNT];
+	int zoom;				//The eof_zoom value the tiles were rendered with
+	unsigned long height;	//The graph height the tiles were rendered with
+	char colorscheme;		//The eof_spectrogram_colorscheme value the tiles were rendered with
+	int avgbins;			//The eof_spectrogram_avgbins value the tiles were rendered with
+	unsigned long usecounter;
+};
+
 struct spectrogramstruct
 {
 	char *oggfilename;
-	double *buffin;						//Allow multiple input/output buffers, for overlap
-	double *buffout;
-	short int numbuff;					//Number of buffers to overlap
+	double *amparena;					//The amplitude lists of every slice of both channels, allocated as one block
 	double windowlength;				//The length of one slice of the graph in milliseconds
 	unsigned long numslices;			//The number of spectrogram structures in the arrays below
 	unsigned int zeroamp;				//The amplitude representing a 0 amplitude for this spectrogram (32768 for 16 bit audio samples, 128 for 8 bit audio samples)
@@ -46,11 +67,26 @@ struct spectrogramstruct
 	long rate;
 
 	struct spectrogrampxtofreq px_to_freq;
+	struct spectrogramtilecache tilecache;	//Pre-colored columns of the graph, so that rendering is mostly blitting
 
 	struct spectrogramchanneldata left;	//The amplitude and graph data for the audio's left channel
 	struct spectrogramchanneldata right;	//The amplitude and graph data for the audio's right channel (if applicable)
 };
 
+typedef struct
+{
+	struct spectrogramstruct *spectrogram;	//The spectrogram being generated, whose slices' amplitude lists the workers fill in
+	SAMPLE *audio;					//The decoded audio, which is only read by the workers
+	fftw_plan fftplan;				//The plan shared by all workers
+} EOF_SPECTROGRAM_WORK_CONTEXT;
+
+typedef struct
+{
+	double *buffin;					//This worker's FFT input buffer
+	double *buffout;				//This worker's FFT output buffer
+	double destmax;					//The highest amplitude found in this worker's slices
+} EOF_SPECTROGRAM_WORKER;
+
 //A colortable for a color scale, to map values to colors
 struct spectrogramcolorscalestruct
 {
@@ -81,9 +117,13 @@ double eof_spectrogram_freq_from_y(long rate, double y);
 	//Converts a given y value to a frequency
 void eof_spectrogram_calculate_px_to_freq(struct spectrogramstruct *spectrogram);
 	//Regenerates the px_to_freq table
+unsigned long spectrogram_get_freq_from_px(struct spectrogramstruct *spectrogram, int px);
+	//Returns the frequency bin represented by the specified pixel of the y axis, or 0 if it is out of range
 
 void eof_destroy_spectrogram(struct spectrogramstruct *ptr);
 	//frees memory used by the specified spectrogram structure
+void eof_destroy_spectrogram_tiles(struct spectrogramstruct *spectrogram);
+	//Frees the specified spectrogram's cached tiles, which are re-rendered as they're needed
 int eof_render_spectrogram(struct spectrogramstruct *spectrogram);
 	//Renders the left channel spectrogram into the editor window, taking the zoom level into account
 	//Returns nonzero on failure
@@ -91,20 +131,31 @@ void eof_render_spectrogram_line(struct spectrogramstruct *spectrogram,struct sp
 	//Debugging function used for testing a colorscale, draws a line of a given color on the spectrogram
 void eof_render_spectrogram_col(struct spectrogramstruct *spectrogram,struct spectrogramchanneldata *channel,struct spectrogramslice *ampdata, unsigned long x, unsigned long curms);
 	//Given the amplitude and the channel and spectrogram to process, renders a column of the channel's spectrogram at x for the time curms
+	//This is only used if a tile can't be allocated, eof_render_spectrogram() otherwise blits the columns from the tile cache
 int eof_color_scale(double value, double max, short int scalenum);
 	//Accessor for the color scale
 void eof_generate_colorscale(char scalenum);
 	//Generates color scales
 
+void eof_destroy_spectrogram_fftplan(void);
+	//Destroys the FFTW plan that is kept between spectrogram generations, this is called when the program exits
 struct spectrogramstruct *eof_create_spectrogram(char *oggfilename);
 	//Decompresses the specified OGG file into memory and creates spectrogram data
 	//windowlength is the length of one spectrogram graph slice in milliseconds
 	//The correct number of samples are used to represent each column (slice) of the graph
 	//The spectrogram data is returned, otherwise NULL is returned upon error
 
-int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAMPLE *audio,unsigned long slicenum,fftw_plan fftplan);
-	//Processes spectrogram->slicesize number of audio samples, or if there are not enough, the remainder of the samples, storing the peak amplitude and RMS into spectrogram->slices[slicenum]
-	//If the audio is stereo, the data for the right channel is likewise processed and stored into spectrogram->slices2[slicenum]
+int eof_spectrogram_threaded_process(struct spectrogramstruct *spectrogram, SAMPLE *audio, fftw_plan fftplan, unsigned long worker_count);
+	//Processes all of the spectrogram's slices by running up to the specified number of worker threads in parallel
+	//Each worker thread repeatedly claims the next EOF_SPECTROGRAM_SLICE_RANGE slices through eof_work_pool_run() and uses its own FFT buffers with the shared plan
+	//The slices' amplitude lists must already point into spectrogram->amparena
+	//The title bar shows the progress and the user can cancel with the Escape key
+	//Returns 1 on success, 2 if the user canceled or -1 on error
+int eof_process_next_spectrogram_slice(struct spectrogramstruct *spectrogram,SAMPLE *audio,unsigned long slicenum,fftw_plan fftplan,double *buffin,double *buffout,double *destmax);
+	//Processes eof_spectrogram_windowsize number of audio samples, or if there are not enough, the remainder of the samples, storing the amplitude of each frequency band into spectrogram->left.slices[slicenum].amplist
+	//If the audio is stereo, the data for the right channel is likewise processed and stored into spectrogram->right.slices[slicenum].amplist
+	//buffin and buffout are the FFT buffers to use with the plan, and *destmax is raised to the highest amplitude found
+	//This is safe to call from multiple threads for different slices, as long as each thread has its own buffers and destmax
 	//Returns 0 on success, 1 when all samples are exhausted or -1 on error
 
 #endif
@@ -305,7 +305,8 @@ int eof_lookup_chord(EOF_PRO_GUITAR_TRACK *tp, unsigned long track, unsigned lon
 	char *chord_intervals_index;	//This is an index into chord_intervals[] for added string processing efficiency
 	unsigned long ctr, ctr2, ctr3, ctr4, halfstep, halfstep2, skipaccidental, pass, scalenum;
 	int retval, bass = -1;			//bass will track the bass note (for now, the note played on the lowest used string) of the chord
-	char *name, **notename = eof_note_names_sharp;
+	const char *name;
+	char **notename = eof_note_names_sharp;
 	unsigned long originalskipctr = skipctr;	//Save this for caching purposes
 
 	if((tp == NULL) || (note >= tp->notes) || !scale || !chord || !isslash || !bassnote)
@@ -719,14 +720,14 @@ int eof_rs_check_chord_name(EOF_SONG *sp, unsigned long track, unsigned long not
 		if(function)
 		{
 			eof_seek_and_render_position(track, tp->note[note]->type, tp->note[note]->pos);
-			if(alert("Warning (Rocksmith):  A chord name including \"maj\"", "(with a lowercase m) may appear in-game named as a minor chord.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
+			if(eof_alert("Warning (Rocksmith):  A chord name including \"maj\"", "(with a lowercase m) may appear in-game named as a minor chord.", "Cancel save?", "&Yes", "&No", 'y', 'n') == 1)
 			{	//If the user opted to cancel the save
 				return 2;	//Return cancellation
 			}
 		}
 		else
 		{
-			allegro_message("Warning (Rocksmith):  A chord name including \"maj\" (with a lowercase m) may appear in-game named as a minor chord.");
+			eof_message("Warning (Rocksmith):  A chord name including \"maj\" (with a lowercase m) may appear in-game named as a minor chord.");
 		}
 		return 1;	//Return user acknowledgment
 	}
@@ -1,4 +1,7 @@
 #include <allegro.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
 #include "main.h"
 #include "menu/edit.h"
 #include "menu/track.h"	//For the tech view enable/disable functions
@@ -21,14 +24,395 @@ int eof_redo_count = 0;
 int eof_redo_type = 0;
 int eof_undo_states_initialized = 0;
 int eof_undo_in_progress = 0;	//Used to prevent eof_destroy_song() from destroying the spectrogram and waveform data if they are already built
+EOF_UNDO_STATE eof_undo_state[EOF_MAX_UNDO] = {{0}};
+EOF_UNDO_STATE eof_redo_state = {0};
+
+void eof_undo_free_state(EOF_UNDO_STATE *state)
+{
+	if(!state)
+		return;
+
+	if(state->data)
+		free(state->data);
+	memset(state, 0, sizeof(EOF_UNDO_STATE));
+}
+
+int eof_undo_capture_state(EOF_UNDO_STATE *state)
+{
+	EOF_MEMORY_FILE mf = {0};
+	PACKFILE *fp;
+	unsigned char *shrunk;
+	int retval;
+
+	if(!state || !eof_song)
+		return 0;	//Invalid parameters
+
+	fp = eof_pack_fopen_memory(&mf);
+	if(!fp)
+		return 0;
+	retval = eof_save_song_pf(eof_song, fp);
+	if(pack_ferror(fp))
+	{	//If any write to the memory file failed, the snapshot is truncated and restoring it would lose data
+		eof_log("\tError:  Could not build the undo state in memory", 1);
+		retval = 0;
+	}
+	(void) pack_fclose(fp);
+	if(!retval || !mf.size)
+	{	//If the project couldn't be serialized
+		eof_memory_file_free(&mf);
+		return 0;
+	}
+	shrunk = realloc(mf.buffer, mf.size);	//Release the unused capacity of the buffer
+	if(shrunk)
+		mf.buffer = shrunk;
+
+	eof_undo_free_state(state);
+	state->data = mf.buffer;
+	state->size = state->fullsize = mf.size;
+	state->keyframe = 1;
+	return 1;
+}
+
+static void eof_undo_make_delta(EOF_UNDO_STATE *older, const EOF_UNDO_STATE *newer)
+{
+	unsigned long prefix = 0, suffix = 0, limit, middle;
+	unsigned char *delta = NULL;
+
+	if(!older || !newer || !older->keyframe || !newer->keyframe || !older->data || !newer->data)
+		return;	//Both states must be keyframes
+
+	limit = (older->size < newer->size) ? older->size : newer->size;
+	while((prefix < limit) && (older->data[prefix] == newer->data[prefix]))
+	{	//Count the leading bytes the two states have in common
+		prefix++;
+	}
+	while((suffix < limit - prefix) && (older->data[older->size - 1 - suffix] == newer->data[newer->size - 1 - suffix]))
+	{	//Count the trailing bytes the two states have in common, without overlapping the common prefix
+		suffix++;
+	}
+	middle = older->size - prefix - suffix;
+	if(middle)
+	{	//If there are any differing bytes to store
+		delta = malloc(middle);
+		if(!delta)
+			return;	//If the memory couldn't be allocated, leave the older state as a keyframe
+		memcpy(delta, &older->data[prefix], middle);
+	}
+	free(older->data);
+	older->data = delta;
+	older->size = middle;
+	older->prefix = prefix;
+	older->suffix = suffix;
+	older->keyframe = 0;
+}
+
+unsigned char *eof_undo_rebuild_state(unsigned long index, unsigned long *size)
+{
+	unsigned long chain[EOF_MAX_UNDO];	//The undo slots between the requested one and the nearest newer keyframe
+	unsigned long chainlength = 0, ctr, slot, newsize;
+	unsigned char *buffer, *newbuffer;
+	EOF_UNDO_STATE *state;
+
+	if((index >= EOF_MAX_UNDO) || !size)
+		return NULL;	//Invalid parameters
+
+	for(slot = index, ctr = 0; ctr < EOF_MAX_UNDO; ctr++, slot = (slot + 1) % EOF_MAX_UNDO)
+	{	//Walk toward newer undo states until a keyframe is found
+		if(eof_undo_state[slot].keyframe)
+			break;
+		chain[chainlength++] = slot;
+	}
+	if(!eof_undo_state[slot].keyframe || !eof_undo_state[slot].data)
+	{	//If the journal is broken
+		eof_log("	Undo journal is missing its keyframe", 1);
+		return NULL;
+	}
+	buffer = malloc(eof_undo_state[slot].size);
+	if(!buffer)
+		return NULL;
+	memcpy(buffer, eof_undo_state[slot].data, eof_undo_state[slot].size);
+	*size = eof_undo_state[slot].size;
+
+	while(chainlength)
+	{	//Apply each delta, from the newest to the oldest
+		state = &eof_undo_state[chain[--chainlength]];
+		if(state->prefix + state->suffix > *size)
+		{	//If this delta doesn't fit the state it was made from
+			eof_log("	Undo journal delta is corrupt", 1);
+			free(buffer);
+			return NULL;
+		}
+		newsize = state->fullsize;
+		newbuffer = malloc(newsize ? newsize : 1);
+		if(!newbuffer)
+		{
+			free(buffer);
+			return NULL;
+		}
+		memcpy(newbuffer, buffer, state->prefix);										//Copy the leading bytes shared with the newer state
+		if(state->size)
+			memcpy(&newbuffer[state->prefix], state->data, state->size);				//Copy the bytes unique to this state
+		memcpy(&newbuffer[state->prefix + state->size], &buffer[*size - state->suffix], state->suffix);	//Copy the trailing bytes shared with the newer state
+		free(buffer);
+		buffer = newbuffer;
+		*size = newsize;
+	}
+
+	return buffer;
+}
+
+static void eof_undo_store_newest(EOF_UNDO_STATE *state)
+{
+	unsigned long previous = (eof_undo_current_index + EOF_MAX_UNDO - 1) % EOF_MAX_UNDO;
+
+	eof_undo_free_state(&eof_undo_state[eof_undo_current_index]);	//Discard whatever this slot held (the oldest undo state if the journal is full)
+	eof_undo_state[eof_undo_current_index] = *state;
+	memset(state, 0, sizeof(EOF_UNDO_STATE));
+	if(eof_undo_count > 0)
+	{	//If there is an older undo state, store it as a delta against the new one
+		eof_undo_make_delta(&eof_undo_state[previous], &eof_undo_state[eof_undo_current_index]);
+	}
+}
+
+static void eof_undo_drop_newest(void)
+{
+	unsigned long previous = (eof_undo_current_index + EOF_MAX_UNDO - 1) % EOF_MAX_UNDO;
+	unsigned char *buffer;
+	unsigned long size = 0;
+
+	if((eof_undo_count > 0) && !eof_undo_state[previous].keyframe)
+	{	//If the undo state that becomes the newest is a delta, rebuild it into a keyframe before the state it depends on is discarded
+		buffer = eof_undo_rebuild_state(previous, &size);
+		if(buffer)
+		{
+			eof_undo_free_state(&eof_undo_state[previous]);
+			eof_undo_state[previous].data = buffer;
+			eof_undo_state[previous].size = eof_undo_state[previous].fullsize = size;
+			eof_undo_state[previous].keyframe = 1;
+		}
+	}
+	eof_undo_free_state(&eof_undo_state[eof_undo_current_index]);
+}
+
+typedef struct
+{
+	unsigned char *data;	//A private copy of the serialized project, so the undo journal can keep converting the original into a delta
+	unsigned long size;
+	char undo_path[1024];	//The undo file this snapshot is written to
+	char project_path[1024];	//The project path written to eof.recover along with the undo file path
+} EOF_RECOVERY_JOB;
+
+static pthread_mutex_t eof_recovery_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t eof_recovery_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t eof_recovery_thread;
+static int eof_recovery_thread_running = 0;	//Nonzero while the writer thread exists
+static int eof_recovery_thread_stop = 0;		//Set to signal the writer thread to write any pending snapshot and exit
+static int eof_recovery_writing = 0;			//Nonzero while the writer thread is writing a snapshot outside of the lock
+static EOF_RECOVERY_JOB *eof_recovery_pending = NULL;	//The newest snapshot that hasn't been written yet.  A newer snapshot replaces it
+
+static void eof_recovery_free_job(EOF_RECOVERY_JOB *job)
+{
+	if(!job)
+		return;
+
+	free(job->data);
+	free(job);
+}
+
+static int eof_recovery_replace_file(const char *src, const char *dest)
+{
+	#ifdef ALLEGRO_WINDOWS
+	(void) delete_file(dest);	//rename() won't replace an existing file on Windows
+	#endif
+	return !rename(src, dest);
+}
+
+static void eof_recovery_write_job(EOF_RECOVERY_JOB *job)
+{
+	char fn[1024] = {0}, tempfn[1024] = {0};
+	EOF_MEMORY_FILE mf = {0};
+	FILE *fp;
+
+	//Write the snapshot beside the undo file and rename it into place, so a crash mid-write never leaves a truncated undo file behind
+	(void) snprintf(tempfn, sizeof(tempfn) - 1, "%s.tmp", job->undo_path);
+	mf.buffer = job->data;
+	mf.size = mf.capacity = job->size;
+	if(!eof_memory_file_save(&mf, tempfn) || !eof_recovery_replace_file(tempfn, job->undo_path))
+	{	//If the file could not be written
+		(void) delete_file(tempfn);
+		eof_logf(1, "\tError:  Unable to write undo state \"%s\".  There may be a permissions issue or interference (ie. from antivirus software).", job->undo_path);
+		return;
+	}
+
+	//eof.recover is only pointed at the undo file once that file is complete
+	(void) snprintf(fn, sizeof(fn) - 1, "%seof.recover", eof_temp_path_s);
+	(void) snprintf(tempfn, sizeof(tempfn) - 1, "%seof%03u.recover.tmp", eof_temp_path_s, eof_log_id);	//Include this instance's ID so concurrently running instances don't write the same temporary file
+	fp = fopen(tempfn, "wb");	//Open the recovery definition file for writing
+	if(fp)
+	{	//If the file opened
+		(void) fputs(job->undo_path, fp);		//Write the undo file path
+		(void) fputs("\n", fp);				//Write a newline character
+		(void) fputs(job->project_path, fp);	//Write the project path
+		if(fclose(fp) || !eof_recovery_replace_file(tempfn, fn))
+		{	//If the recovery definition file could not be completed
+			(void) delete_file(tempfn);
+			eof_log("\tError:  Unable to update eof.recover", 1);
+		}
+	}
+}
+
+static void *eof_recovery_writer_thread(void *arg)
+{
+	EOF_RECOVERY_JOB *job;
+	struct timespec wake;
+
+	(void) arg;
+	(void) pthread_mutex_lock(&eof_recovery_lock);
+	while(1)
+	{
+		while(!eof_recovery_pending && !eof_recovery_thread_stop)
+		{	//Wait for a snapshot to be submitted
+			(void) pthread_cond_wait(&eof_recovery_cond, &eof_recovery_lock);
+		}
+		if(!eof_recovery_pending)
+			break;	//Stopping with nothing left to write
+
+		if(eof_recovery_interval && !eof_recovery_thread_stop)
+		{	//Give a burst of edits the configured interval to settle, so only its last snapshot is written to disk
+			(void) clock_gettime(CLOCK_REALTIME, &wake);
+			wake.tv_sec += eof_recovery_interval / 1000;
+			wake.tv_nsec += (long)(eof_recovery_interval % 1000) * 1000000L;
+			if(wake.tv_nsec >= 1000000000L)
+			{
+				wake.tv_sec++;
+				wake.tv_nsec -= 1000000000L;
+			}
+			while(eof_recovery_pending && !eof_recovery_thread_stop)
+			{	//Until the interval elapses, or the snapshot is flushed/discarded early
+				if(pthread_cond_timedwait(&eof_recovery_cond, &eof_recovery_lock, &wake))
+					break;	//Timed out
+			}
+			if(!eof_recovery_pending)
+				continue;	//The snapshot was discarded while waiting
+		}
+		job = eof_recovery_pending;	//Take the newest snapshot
+		eof_recovery_pending = NULL;
+		eof_recovery_writing = 1;
+		(void) pthread_mutex_unlock(&eof_recovery_lock);
+
+		eof_recovery_write_job(job);
+		eof_recovery_free_job(job);
+
+		(void) pthread_mutex_lock(&eof_recovery_lock);
+		eof_recovery_writing = 0;
+		(void) pthread_cond_broadcast(&eof_recovery_cond);	//Wake any thread waiting in eof_undo_discard_recovery()
+	}
+	(void) pthread_mutex_unlock(&eof_recovery_lock);
+
+	return NULL;
+}
+
+static void eof_undo_flush_recovery(void)
+{
+	EOF_UNDO_STATE *state = &eof_undo_state[eof_undo_current_index];
+	EOF_RECOVERY_JOB *job;
+
+	if(!eof_recovery)
+		return;	//This EOF instance is not maintaining auto-recovery files
+	if(!state->data || !eof_undo_filename[eof_undo_current_index])
+		return;
+
+	//The newest undo state is already a complete serialization of the project, so copying it is the snapshot.
+	//The copy is needed because the journal rewrites this state into a delta when the next edit is made
+	job = malloc(sizeof(EOF_RECOVERY_JOB));
+	if(!job)
+		return;
+	job->data = malloc(state->size);
+	if(!job->data)
+	{
+		free(job);
+		return;
+	}
+	memcpy(job->data, state->data, state->size);
+	job->size = state->size;
+	strncpy(job->undo_path, eof_undo_filename[eof_undo_current_index], sizeof(job->undo_path) - 1);
+	job->undo_path[sizeof(job->undo_path) - 1] = '\0';
+	job->project_path[0] = '\0';
+	(void) append_filename(job->project_path, eof_song_path, eof_loaded_song_name, (int) sizeof(job->project_path));	//Construct the full path to the project file
+
+	(void) pthread_mutex_lock(&eof_recovery_lock);
+	if(!eof_recovery_thread_running)
+	{	//Start the writer thread the first time a snapshot is submitted
+		eof_recovery_thread_stop = 0;
+		if(pthread_create(&eof_recovery_thread, NULL, eof_recovery_writer_thread, NULL))
+		{	//If the thread couldn't be created, write the snapshot on this thread instead
+			(void) pthread_mutex_unlock(&eof_recovery_lock);
+			eof_log("\tError:  Unable to start the auto-recovery writer thread", 1);
+			eof_recovery_write_job(job);
+			eof_recovery_free_job(job);
+			return;
+		}
+		eof_recovery_thread_running = 1;
+	}
+	eof_recovery_free_job(eof_recovery_pending);	//A snapshot that hasn't been written yet is superseded by this one
+	eof_recovery_pending = job;
+	(void) pthread_cond_broadcast(&eof_recovery_cond);
+	(void) pthread_mutex_unlock(&eof_recovery_lock);
+}
+
+void eof_undo_discard_recovery(void)
+{
+	(void) pthread_mutex_lock(&eof_recovery_lock);
+	eof_recovery_free_job(eof_recovery_pending);
+	eof_recovery_pending = NULL;
+	(void) pthread_cond_broadcast(&eof_recovery_cond);
+	while(eof_recovery_writing)
+	{	//Wait for a write that is already underway to finish
+		(void) pthread_cond_wait(&eof_recovery_cond, &eof_recovery_lock);
+	}
+	(void) pthread_mutex_unlock(&eof_recovery_lock);
+}
+
+void eof_undo_stop_recovery_writer(void)
+{
+	(void) pthread_mutex_lock(&eof_recovery_lock);
+	if(!eof_recovery_thread_running)
+	{
+		(void) pthread_mutex_unlock(&eof_recovery_lock);
+		return;
+	}
+	eof_recovery_thread_stop = 1;	//The thread writes any pending snapshot immediately and exits
+	(void) pthread_cond_broadcast(&eof_recovery_cond);
+	(void) pthread_mutex_unlock(&eof_recovery_lock);
+	(void) pthread_join(eof_recovery_thread, NULL);
+	eof_recovery_thread_running = 0;
+	eof_recovery_thread_stop = 0;
+}
+
+static int eof_undo_load_state_memory(unsigned char *data, unsigned long size)
+{
+	EOF_MEMORY_FILE mf = {0};
+	PACKFILE *fp;
+	int retval;
+
+	if(!data)
+		return 0;
+
+	mf.buffer = data;
+	mf.size = mf.capacity = size;
+	fp = eof_pack_fopen_memory(&mf);
+	if(!fp)
+		return 0;
+	retval = eof_undo_load_state_pf(fp);
+	(void) pack_fclose(fp);
+
+	return retval;
+}
 
 int eof_undo_load_state(const char * fn)
 {
-	EOF_SONG * sp = NULL;
-	PACKFILE * fp = NULL, * rfp = NULL;
-	char rheader[16] = {0};
-	int old_eof_silence_loaded = eof_silence_loaded;	//Retain this value, since it is destroyed by eof_destroy_song()
-	char eof_recover_path[50];
+	PACKFILE * fp = NULL;
+	int retval;
 
  	eof_log("eof_undo_load_state() entered", 1);
 
@@ -41,15 +425,33 @@ int eof_undo_load_state(const char * fn)
 	{
 		return 0;
 	}
+	retval = eof_undo_load_state_pf(fp);
+	(void) pack_fclose(fp);
+
+	return retval;
+}
+
+int eof_undo_load_state_pf(PACKFILE * fp)
+{
+	EOF_SONG * sp = NULL;
+	PACKFILE * rfp = NULL;
+	char rheader[16] = {0};
+	int old_eof_silence_loaded = eof_silence_loaded;	//Retain this value, since it is destroyed by eof_destroy_song()
+	char eof_recover_path[50];
+
+ 	eof_log("eof_undo_load_state_pf() entered", 2);
+
+	if(fp == NULL)
+	{
+		return 0;
+	}
 	if(pack_fread(rheader, 16, fp) != 16)
 	{
-		(void) pack_fclose(fp);
 		return 0;	//Return error if 16 bytes cannot be read
 	}
 	sp = eof_create_song();		//Initialize an empty chart
 	if(sp == NULL)
 	{
-		(void) pack_fclose(fp);
 		return 0;
 	}
 	sp->tags->accurate_ts = 0;	//For existing projects, this setting must be manually enabled in order to prevent unwanted alteration to beat timings
@@ -57,18 +459,16 @@ int eof_undo_load_state(const char * fn)
 	rfp = pack_fopen(eof_recover_path, "r");	//Open the recovery file to prevent eof_destroy_song() from deleting it
 	if(!eof_load_song_pf(sp, fp))
 	{	//If loading the undo state fails
-		allegro_message("Failed to perform undo");
+		eof_message("Failed to perform undo");
 		(void) pack_fclose(rfp);	//Close this recovery file handle so that it will be deleted by the following call to eof_destroy_song()
 		eof_destroy_song(sp);
-		(void) pack_fclose(fp);
 		return 0;	//Return failure
 	}
-	(void) pack_fclose(fp);
 	if(EOF_TRACK_PRO_GUITAR_B >= sp->tracks)
 	{	//If the chart loaded does not contain a bonus pro guitar track (a pre 1.8RC12 chart or a post 1.8RC12 chart with an empty bonus track during save)
 		if(eof_song_add_track(sp, &eof_default_tracks[EOF_TRACK_PRO_GUITAR_B]) == 0)	//Add a blank bonus pro guitar track
 		{	//If the track failed to be added
-			allegro_message("Failed to perform undo");
+			eof_message("Failed to perform undo");
 			(void) pack_fclose(rfp);	//Close this recovery file handle so that it will be deleted by the following call to eof_destroy_song()
 			eof_destroy_song(sp);
 			return 0;	//Return failure
@@ -89,8 +489,15 @@ int eof_undo_load_state(const char * fn)
 
 void eof_undo_reset(void)
 {
+	unsigned long ctr;
+
  	eof_log("eof_undo_reset() entered", 1);
 
+	for(ctr = 0; ctr < EOF_MAX_UNDO; ctr++)
+	{	//For each undo slot
+		eof_undo_free_state(&eof_undo_state[ctr]);
+	}
+	eof_undo_free_state(&eof_redo_state);
 	eof_undo_current_index = 0;
 	eof_undo_count = 0;
 	eof_redo_count = 0;
@@ -98,8 +505,9 @@ void eof_undo_reset(void)
 
 int eof_undo_add(int type)
 {
-	char fn[1024] = {0}, temp[1024] = {0};
+	char fn[1024] = {0};
 	unsigned long ctr;
+	EOF_UNDO_STATE state = {0};
 
  	eof_log("eof_undo_add() entered", 2);
 
@@ -122,7 +530,7 @@ int eof_undo_add(int type)
 			eof_undo_filename[ctr] = malloc(sizeof(fn) + 1);
 			if(eof_undo_filename[ctr] == NULL)
 			{
-				allegro_message("Error initializing undo system.  Undo disabled");
+				eof_message("Error initializing undo system.  Undo disabled");
 				eof_undo_states_initialized = -1;
 				return 0;
 			}
@@ -154,33 +562,16 @@ int eof_undo_add(int type)
 		eof_log(eof_log_string, 1);
 		(void) eof_copy_file(eof_loaded_ogg_name, fn);
 	}
+	if(!eof_undo_capture_state(&state))
+	{	//If the project could not be serialized into the undo journal
+		eof_message("Error:  Unable to store undo state.  There may not be enough available memory.");
+		return 0;
+	}
 	eof_undo_last_type = type;
 
-	(void) delete_file(eof_undo_filename[eof_undo_current_index]);	//Try to delete the file
-	if(exists(eof_undo_filename[eof_undo_current_index]))
-	{	//If the file could not be deleted, it probably won't be able to be overwritten either
-		allegro_message("Error:  Unable to delete undo state.  There may be a permissions issue or interference (ie. from antivirus software).");
-	}
-	(void) eof_save_song(eof_song, eof_undo_filename[eof_undo_current_index]);
-	if(!exists(eof_undo_filename[eof_undo_current_index]))
-	{	//If the file could not be written
-		allegro_message("Error:  Unable to write undo state.  There may be a permissions issue or interference (ie. from antivirus software).");
-	}
+	eof_undo_store_newest(&state);
 	eof_undo_type[eof_undo_current_index] = type;
-	if(eof_recovery)
-	{	//If this EOF instance is maintaining auto-recovery files
-		PACKFILE *fp;
-		(void) snprintf(fn, sizeof(fn) - 1, "%seof.recover", eof_temp_path_s);
-		fp = pack_fopen(fn, "w");	//Open the recovery definition file for writing
-		if(fp)
-		{	//If the file opened
-			(void) append_filename(temp, eof_song_path, eof_loaded_song_name, 1024);	//Construct the full path to the project file
-			(void) pack_fputs(eof_undo_filename[eof_undo_current_index], fp);			//Write the undo file path
-			(void) pack_fputs("\n", fp);												//Write a newline character
-			(void) pack_fputs(temp, fp);												//Write the project path
-			(void) pack_fclose(fp);
-		}
-	}
+	eof_undo_flush_recovery();	//If this EOF instance is maintaining auto-recovery files, write the new undo state to disk
 	eof_undo_current_index++;
 	if(eof_undo_current_index >= EOF_MAX_UNDO)
 	{
@@ -199,7 +590,8 @@ int eof_undo_apply(void)
 {
 	char fn[1024] = {0};
 	char title[256] = {0};
-	unsigned long ctr;
+	unsigned long ctr, size = 0;
+	unsigned char *buffer;
 	EOF_PRO_GUITAR_TRACK *tp = NULL;
 	char tech_view_status[EOF_PRO_GUITAR_TRACKS_MAX] = {0};	//Tracks whether or not tech view was in effect for each of the pro guitar tracks, so this view's status can be restored after the undo
 
@@ -226,16 +618,9 @@ int eof_undo_apply(void)
 
 	strncpy(title, eof_song->tags->title, sizeof(title) - 1);	//Backup the song title field, since if it changes as part of the undo, the Rocksmith WAV file should be deleted
 
-	(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo", eof_temp_path_s, eof_log_id);	//Include EOF's log ID in the redo name to almost guarantee it is uniquely named
-	(void) delete_file(fn);	//Try to delete the file
-	if(exists(fn))
-	{	//If the file could not be deleted, it probably won't be able to be overwritten either
-		allegro_message("Error:  Unable to delete redo state.  There may be a permissions issue or interference (ie. from antivirus software).");
-	}
-	(void) eof_save_song(eof_song, fn);
-	if(!exists(fn))
-	{	//If the file could not be written
-		allegro_message("Error:  Unable to write redo state.  There may be a permissions issue or interference (ie. from antivirus software).");
+	if(!eof_undo_capture_state(&eof_redo_state))
+	{	//If the redo state could not be stored
+		eof_message("Error:  Unable to store redo state.  There may not be enough available memory.");
 	}
 	eof_redo_type = 0;
 	eof_undo_current_index--;
@@ -243,7 +628,12 @@ int eof_undo_apply(void)
 	{
 		eof_undo_current_index = EOF_MAX_UNDO - 1;
 	}
-	(void) eof_undo_load_state(eof_undo_filename[eof_undo_current_index]);
+	eof_undo_count--;	//The undo state being applied is removed from the journal
+	buffer = eof_undo_rebuild_state(eof_undo_current_index, &size);
+	(void) eof_undo_load_state_memory(buffer, size);
+	if(buffer)
+		free(buffer);
+	eof_undo_drop_newest();	//Make the next undo state a keyframe and release the one that was just applied
 	if(eof_undo_type[eof_undo_current_index] == EOF_UNDO_TYPE_NOTE_SEL)
 	{
 		(void) eof_menu_edit_deselect_all();
@@ -270,7 +660,6 @@ int eof_undo_apply(void)
 	{	//If the song title changed as part of the undo, delete the Rocksmith WAV file, since changing the title will cause a new WAV file to be written
 		eof_delete_rocksmith_wav();
 	}
-	eof_undo_count--;
 	eof_redo_count = 1;
 	eof_change_count--;
 	if(eof_change_count == 0)
@@ -311,6 +700,7 @@ void eof_redo_apply(void)
 	char title[256] = {0};
 	unsigned long ctr;
 	EOF_PRO_GUITAR_TRACK *tp = NULL;
+	EOF_UNDO_STATE state = {0};
 	char tech_view_status[EOF_PRO_GUITAR_TRACKS_MAX] = {0};	//Tracks whether or not tech view was in effect for each of the pro guitar tracks, so this view's status can be restored after the redo
 
  	eof_log("eof_redo_apply() entered", 1);
@@ -335,23 +725,20 @@ void eof_redo_apply(void)
 
 		strncpy(title, eof_song->tags->title, sizeof(title) - 1);	//Backup the song title field, since if it changes as part of the redo, the Rocksmith WAV file should be deleted
 
-		(void) delete_file(eof_undo_filename[eof_undo_current_index]);	//Try to delete the file
-		if(exists(eof_undo_filename[eof_undo_current_index]))
-		{	//If the file could not be deleted, it probably won't be able to be overwritten either
-			allegro_message("Error:  Unable to delete undo state.  There may be a permissions issue or interference (ie. from antivirus software).");
-		}
-		(void) eof_save_song(eof_song, eof_undo_filename[eof_undo_current_index]);
-		if(!exists(eof_undo_filename[eof_undo_current_index]))
-		{	//If the file could not be written
-			allegro_message("Error:  Unable to write undo state.  There may be a permissions issue or interference (ie. from antivirus software).");
+		if(!eof_undo_capture_state(&state))
+		{	//If the undo state could not be stored
+			eof_message("Error:  Unable to store undo state.  There may not be enough available memory.");
+			return;
 		}
+		eof_undo_store_newest(&state);
+		eof_undo_flush_recovery();	//If this EOF instance is maintaining auto-recovery files, write the new undo state to disk
 		eof_undo_current_index++;
 		if(eof_undo_current_index >= EOF_MAX_UNDO)
 		{
 			eof_undo_current_index = 0;
 		}
-		(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo", eof_temp_path_s, eof_log_id);	//Get the name of this EOF instance's redo file
-		(void) eof_undo_load_state(fn);	//And load it
+		(void) eof_undo_load_state_memory(eof_redo_state.data, eof_redo_state.size);	//Load the redo state
+		eof_undo_free_state(&eof_redo_state);
 		if(eof_redo_type == EOF_UNDO_TYPE_SILENCE)
 		{
 			(void) snprintf(fn, sizeof(fn) - 1, "%seof%03u.redo.ogg", eof_temp_path_s, eof_log_id);	//Get the name of this EOF instance's redo OGG
@@ -406,6 +793,12 @@ void eof_destroy_undo(void)
 {
 	unsigned long ctr;
 
+	eof_undo_stop_recovery_writer();	//The writer thread refers to the undo filenames
+	for(ctr = 0; ctr < EOF_MAX_UNDO; ctr++)
+	{	//For each undo slot
+		eof_undo_free_state(&eof_undo_state[ctr]);
+	}
+	eof_undo_free_state(&eof_redo_state);
 	if(eof_undo_states_initialized > 0)
 	{
 		for(ctr = 0; ctr < EOF_MAX_UNDO; ctr++)
@@ -427,6 +820,7 @@ int eof_remove_undo(void)
 	}
 	eof_undo_current_index--;
 	eof_undo_count--;
+	eof_undo_drop_newest();	//Make the next undo state a keyframe and release the one that was removed
 	eof_change_count--;
 	if(eof_change_count == 0)
 	{
@@ -15,10 +15,23 @@
 #define EOF_UNDO_TYPE_SILENCE      5
 #define EOF_UNDO_TYPE_TEMPO_ADJUST 6
 
+typedef struct
+{
+	unsigned char *data;	//For a keyframe, the complete serialized project.  Otherwise only the bytes that differ from the next newer undo state
+	unsigned long size;		//The number of bytes in data
+	unsigned long fullsize;	//The size of the complete serialized project this undo state represents
+	unsigned long prefix;	//For a delta, the number of leading bytes that are identical to those of the next newer undo state
+	unsigned long suffix;	//For a delta, the number of trailing bytes that are identical to those of the next newer undo state
+	char keyframe;			//Nonzero if data holds the complete serialized project
+} EOF_UNDO_STATE;
+	//Undo states are journaled in memory.  The newest undo state is always a keyframe and each older state is normally stored as a
+	//delta against the next newer state, so an edit only costs the memory of the bytes it changed in the serialized project
+
 extern int eof_undo_count;
 extern int eof_redo_count;
 extern int eof_undo_last_type;
 extern char * eof_undo_filename[EOF_MAX_UNDO];
+extern EOF_UNDO_STATE eof_undo_state[EOF_MAX_UNDO];
 extern int eof_undo_states_initialized;
 extern int eof_undo_current_index;
 extern int eof_undo_in_progress;
@@ -28,7 +41,18 @@ int eof_undo_add(int type);	//Adds another undo state, except some cases where t
 int eof_remove_undo(void);	//Removes the latest undo state.  Returns nonzero if an undo state was removed
 int eof_undo_apply(void);	//Saves the redo state and applies the next available undo state
 void eof_redo_apply(void);	//Applies the redo state
-int eof_undo_load_state(const char * fn);	//Applies the specified undo/redo state, or returns 0 upon error (called by eof_undo_apply() and eof_redo_apply())
-void eof_destroy_undo(void);	//Frees the memory for all of the filenames in eof_undo_filename[]
+int eof_undo_load_state(const char * fn);	//Applies the undo/redo state stored in the specified file, or returns 0 upon error
+int eof_undo_load_state_pf(PACKFILE * fp);	//Applies the undo/redo state read from the specified PACKFILE, or returns 0 upon error (called by eof_undo_apply() and eof_redo_apply())
+void eof_undo_free_state(EOF_UNDO_STATE *state);	//Releases the memory used by the specified undo state
+int eof_undo_capture_state(EOF_UNDO_STATE *state);	//Serializes the active project into the specified undo state as a keyframe.  Returns 0 on error
+unsigned char *eof_undo_rebuild_state(unsigned long index, unsigned long *size);
+	//Reconstructs the complete serialized project for the specified undo slot by applying the deltas between it and the nearest newer keyframe
+	//The returned buffer is allocated and must be freed by the calling function, and its size is returned through *size.  Returns NULL on error
+void eof_undo_discard_recovery(void);
+	//Drops any auto-recovery snapshot that hasn't been written yet and waits for a write already in progress to finish
+	//Called before eof.recover is deleted, so the writer thread can't recreate it afterward
+void eof_undo_stop_recovery_writer(void);
+	//Writes any pending auto-recovery snapshot and ends the writer thread that eof_undo_add() starts on demand
+void eof_destroy_undo(void);	//Frees the memory for all of the filenames in eof_undo_filename[] and all of the undo states
 
 #endif
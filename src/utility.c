@@ -1,6 +1,13 @@
 #include <allegro.h>
+#ifdef ALLEGRO_WINDOWS
+	#include <winalleg.h>	//For GetSystemInfo()
+#else
+	#include <unistd.h>		//For sysconf()
+#endif
 #include <ctype.h>
+#include <pthread.h>
 #include <sys/stat.h>
+#include <time.h>
 #include "utility.h"
 #include "main.h"	//For logging
 #include "foflc/RS_parse.h"	//For rs_lyric_substitute_char_extended()
@@ -110,13 +117,11 @@ void *eof_buffer_file(const char * fn, char appendnull)
 
 	if(fn == NULL)
 		return NULL;
-	(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\tBuffering file:  \"%s\"", fn);
-	eof_log(eof_log_string, 2);
+	eof_logf(2, "\tBuffering file:  \"%s\"", fn);
 	fp = pack_fopen(fn, "r");
 	if(fp == NULL)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tCannot open specified file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
-		eof_log(eof_log_string, 1);
+		eof_logf(1, "\t\tCannot open specified file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
 		return NULL;
 	}
 	filesize = buffersize = file_size_ex(fn);
@@ -127,8 +132,7 @@ void *eof_buffer_file(const char * fn, char appendnull)
 	data = (char *)malloc(buffersize);
 	if(data == NULL)
 	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tCannot allocate %lu bytes of memory.", (unsigned long)buffersize);
-		eof_log(eof_log_string, 1);
+		eof_logf(1, "\t\tCannot allocate %lu bytes of memory.", (unsigned long)buffersize);
 		(void) pack_fclose(fp);
 		return NULL;
 	}
@@ -555,6 +559,592 @@ PACKFILE *eof_pack_fopen_retry(const char *filename, const char *mode, unsigned
 	return fp;
 }
 
+static int eof_memory_file_fclose(void *userdata)
+{
+	return 0;	//The memory buffer is owned by the EOF_MEMORY_FILE structure, nothing to release
+}
+
+static int eof_memory_file_getc(void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	if(mf->pos >= mf->size)
+		return EOF;	//End of data
+
+	return mf->buffer[mf->pos++];
+}
+
+static int eof_memory_file_ungetc(int c, void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	if(!mf->pos)
+		return EOF;	//Can't move before the beginning of the buffer
+
+	mf->pos--;
+	mf->buffer[mf->pos] = (unsigned char)c;
+	return c;
+}
+
+static long eof_memory_file_fread(void *p, long n, void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+	unsigned long count;
+
+	if((n <= 0) || (mf->pos >= mf->size))
+		return 0;
+
+	count = mf->size - mf->pos;
+	if((unsigned long)n < count)
+		count = (unsigned long)n;
+	memcpy(p, &mf->buffer[mf->pos], count);
+	mf->pos += count;
+
+	return (long)count;
+}
+
+static int eof_memory_file_reserve(EOF_MEMORY_FILE *mf, unsigned long count)
+{
+	unsigned long newcapacity;
+	unsigned char *newbuffer;
+
+	if(mf->pos + count <= mf->capacity)
+		return 1;	//The buffer is already large enough
+
+	newcapacity = mf->capacity ? mf->capacity : 65536;
+	while(newcapacity < mf->pos + count)
+	{	//Double the capacity until the write will fit
+		newcapacity *= 2;
+	}
+	newbuffer = realloc(mf->buffer, newcapacity);
+	if(!newbuffer)
+	{	//Couldn't grow the buffer
+		mf->error = 1;	//Track that the memory file's contents are incomplete
+		return 0;
+	}
+
+	mf->buffer = newbuffer;
+	mf->capacity = newcapacity;
+	return 1;
+}
+
+static int eof_memory_file_putc(int c, void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	if(!eof_memory_file_reserve(mf, 1))
+		return EOF;
+
+	mf->buffer[mf->pos++] = (unsigned char)c;
+	if(mf->pos > mf->size)
+		mf->size = mf->pos;
+
+	return c;
+}
+
+static long eof_memory_file_fwrite(const void *p, long n, void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	if(n <= 0)
+		return 0;
+	if(!eof_memory_file_reserve(mf, (unsigned long)n))
+		return 0;
+
+	memcpy(&mf->buffer[mf->pos], p, (size_t)n);
+	mf->pos += (unsigned long)n;
+	if(mf->pos > mf->size)
+		mf->size = mf->pos;
+
+	return n;
+}
+
+static int eof_memory_file_fseek(void *userdata, int offset)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	if((offset < 0) || (mf->pos + (unsigned long)offset > mf->size))
+		return -1;	//Allegro only seeks forward, and not beyond the end of the data
+
+	mf->pos += (unsigned long)offset;
+	return 0;
+}
+
+static int eof_memory_file_feof(void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	return (mf->pos >= mf->size);
+}
+
+static int eof_memory_file_ferror(void *userdata)
+{
+	EOF_MEMORY_FILE *mf = (EOF_MEMORY_FILE *)userdata;
+
+	return mf->error;
+}
+
+static PACKFILE_VTABLE eof_memory_file_vtable =
+{
+	eof_memory_file_fclose,
+	eof_memory_file_getc,
+	eof_memory_file_ungetc,
+	eof_memory_file_fread,
+	eof_memory_file_putc,
+	eof_memory_file_fwrite,
+	eof_memory_file_fseek,
+	eof_memory_file_feof,
+	eof_memory_file_ferror
+};
+
+PACKFILE *eof_pack_fopen_memory(EOF_MEMORY_FILE *mf)
+{
+	if(!mf)
+		return NULL;	//Invalid parameter
+
+	mf->pos = 0;
+	mf->error = 0;
+	return pack_fopen_vtable(&eof_memory_file_vtable, mf);
+}
+
+void eof_memory_file_free(EOF_MEMORY_FILE *mf)
+{
+	if(!mf)
+		return;	//Invalid parameter
+
+	if(mf->buffer)
+		free(mf->buffer);
+	mf->buffer = NULL;
+	mf->size = mf->capacity = mf->pos = 0;
+	mf->error = 0;
+}
+
+int eof_memory_file_save(EOF_MEMORY_FILE *mf, const char *fn)
+{
+	PACKFILE *fp;
+	long size;
+
+	if(!mf || !mf->buffer || !fn || (mf->size > LONG_MAX) || mf->error)
+		return 0;	//Invalid parameters, or the memory file's contents are incomplete
+
+	fp = eof_pack_fopen_retry(fn, "w", 5);
+	if(!fp)
+		return 0;	//Couldn't open the file for writing
+
+	size = (long)mf->size;
+	if(pack_fwrite(mf->buffer, size, fp) != size)
+	{	//If the data couldn't be fully written
+		(void) pack_fclose(fp);
+		return 0;
+	}
+	if(pack_fclose(fp))
+		return 0;	//The buffered data couldn't be flushed to disk
+
+	return 1;
+}
+
+int eof_memory_file_load(EOF_MEMORY_FILE *mf, const char *fn)
+{
+	uint64_t filesize;
+	void *data;
+
+	if(!mf || !fn)
+		return 0;	//Invalid parameters
+
+	filesize = file_size_ex(fn);
+	if(!filesize || (filesize > LONG_MAX))
+		return 0;	//The file is empty, missing or too large to buffer
+	data = eof_buffer_file(fn, 0);
+	if(!data)
+		return 0;	//Couldn't read the file
+
+	eof_memory_file_free(mf);
+	mf->buffer = data;
+	mf->size = mf->capacity = (unsigned long)filesize;
+	return 1;
+}
+
+EOF_MEMORY_FILE *eof_pack_memory_file(PACKFILE *fp)
+{
+	if(!fp || (fp->vtable != &eof_memory_file_vtable))
+		return NULL;	//Not a memory PACKFILE
+
+	return (EOF_MEMORY_FILE *)fp->userdata;
+}
+
+EOF_TEXT_FILE *eof_text_fopen(const char *fn)
+{
+	EOF_TEXT_FILE *fp;
+	PACKFILE *inf;
+	uint64_t filesize;
+	long bytesread;
+
+	if(!fn)
+		return NULL;	//Invalid parameter
+
+	filesize = file_size_ex(fn);
+	if(filesize >= LONG_MAX)
+	{
+		eof_log("\t\tText file is too large to buffer", 1);
+		return NULL;
+	}
+	inf = pack_fopen(fn, "r");
+	if(!inf)
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tCannot open specified file:  \"%s\"", strerror(errno));	//Get the Operating System's reason for the failure
+		eof_log(eof_log_string, 1);
+		return NULL;
+	}
+	fp = malloc(sizeof(EOF_TEXT_FILE));
+	if(!fp)
+	{
+		(void) pack_fclose(inf);
+		return NULL;
+	}
+	memset(fp, 0, sizeof(EOF_TEXT_FILE));
+	fp->data = malloc((size_t)filesize + 1);	//Allocate an extra byte for the NULL terminator
+	if(!fp->data)
+	{
+		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "\t\tCannot allocate %lu bytes of memory.", (unsigned long)filesize + 1);
+		eof_log(eof_log_string, 1);
+		free(fp);
+		(void) pack_fclose(inf);
+		return NULL;
+	}
+	bytesread = filesize ? pack_fread(fp->data, (long)filesize, inf) : 0;
+	(void) pack_fclose(inf);
+	if(bytesread < 0)
+	{	//If the read failed
+		bytesread = 0;
+	}
+	fp->size = (size_t)bytesread;	//Only parse as much of the file as was actually read
+	fp->data[fp->size] = '\0';
+
+	return fp;
+}
+
+char *eof_text_fgets(EOF_TEXT_FILE *fp)
+{
+	char *line, *ptr, *end, *dest;
+	size_t length, needed, ctr;
+	char nonascii = 0;
+
+	if(!fp || !fp->data)
+		return NULL;	//Invalid parameter
+
+	line = &fp->data[fp->pos];
+	end = &fp->data[fp->size];	//This is always the NULL terminator
+	for(ptr = line; ptr < end; ptr++)
+	{	//Find the end of this line
+		if((*ptr == '\n') || (*ptr == '\r'))
+			break;
+		nonascii |= *ptr & 0x80;
+	}
+	length = (size_t)(ptr - line);
+	fp->pos += length;
+	if(ptr < end)
+	{	//If a line ending was found, skip past it
+		fp->pos++;
+		if((ptr[0] == '\r') && (ptr + 1 < end) && (ptr[1] == '\n'))
+		{	//CR+LF is a single line ending
+			fp->pos++;
+		}
+		*ptr = '\0';	//Terminate the line in place
+	}
+
+	if(!nonascii && (get_uformat() != U_UNICODE))
+	{	//ASCII text is the same in the current text format, no conversion is needed
+		return line;
+	}
+
+	//pack_fgets() stores each byte as a character in the current text format, do the same
+	needed = (length + 1) * (size_t)uwidth_max(U_CURRENT);
+	if(needed > fp->convertsize)
+	{	//If the conversion buffer needs to grow
+		dest = realloc(fp->convert, needed);
+		if(!dest)
+			return line;	//If the buffer can't grow, return the line unconverted rather than fail
+		fp->convert = dest;
+		fp->convertsize = needed;
+	}
+	dest = fp->convert;
+	for(ctr = 0; ctr < length; ctr++)
+	{
+		dest += usetc(dest, (unsigned char)line[ctr]);
+	}
+	(void) usetc(dest, 0);
+
+	return fp->convert;
+}
+
+int eof_text_feof(EOF_TEXT_FILE *fp)
+{
+	if(!fp || !fp->data)
+		return 1;
+
+	return (fp->pos >= fp->size);
+}
+
+void eof_text_fclose(EOF_TEXT_FILE *fp)
+{
+	if(!fp)
+		return;
+
+	free(fp->data);
+	free(fp->convert);
+	free(fp);
+}
+
+/* returns nonzero if the specified text (which isn't terminated) is the specified name, ignoring case */
+static int eof_xml_name_matches(const char *text, size_t length, const char *name)
+{
+	size_t ctr;
+
+	for(ctr = 0; ctr < length; ctr++)
+	{	//For each character of the text
+		if((name[ctr] == '\0') || (tolower((unsigned char)text[ctr]) != tolower((unsigned char)name[ctr])))
+			return 0;
+	}
+
+	return (name[length] == '\0');	//Only a match if the name ends here too
+}
+
+char *eof_xml_next_tag(char *input, EOF_XML_TAG *tag)
+{
+	char *ptr, *end, quote;
+	EOF_XML_ATTRIBUTE *ap;
+
+	if(!input || !tag)
+		return NULL;	//Invalid parameters
+
+	ptr = strchr(input, '<');
+	if(!ptr)
+	{	//If there are no more tags, clear the tag so it doesn't match any name
+		tag->name = tag->content = NULL;
+		tag->namelen = tag->contentlen = 0;
+		tag->closing = tag->empty = 0;
+		tag->attributes = 0;
+		return NULL;
+	}
+
+	tag->closing = tag->empty = 0;	//The attribute array isn't cleared, only the first tag->attributes entries are used
+	tag->attributes = 0;
+	ptr++;
+	if(*ptr == '/')
+	{	//If this is a closing tag
+		tag->closing = 1;
+		ptr++;
+	}
+	tag->name = ptr;
+	if(!strncmp(ptr, "!--", 3))
+	{	//If this is a comment, it ends at the first --> sequence regardless of any other markup in it
+		tag->namelen = 3;
+		end = strstr(ptr + 3, "-->");
+		ptr = end ? end + 3 : ptr + strlen(ptr);
+		tag->content = ptr;
+		tag->contentlen = strcspn(ptr, "<");
+		return ptr;
+	}
+	while((*ptr != '\0') && !isspace((unsigned char)*ptr) && (*ptr != '>') && (*ptr != '/'))
+	{	//Find the end of the tag name
+		ptr++;
+	}
+	tag->namelen = (size_t)(ptr - tag->name);
+
+	while(*ptr != '\0')
+	{	//Until the end of the tag or the text is reached
+		if(isspace((unsigned char)*ptr))
+		{	//Skip whitespace between attributes
+			ptr++;
+			continue;
+		}
+		if(*ptr == '>')
+		{	//The end of the tag
+			ptr++;
+			break;
+		}
+		if(((*ptr == '/') || (*ptr == '?')) && (ptr[1] == '>'))
+		{	//The end of an empty element tag or a processing instruction
+			if(*ptr == '/')
+				tag->empty = 1;
+			ptr += 2;
+			break;
+		}
+
+		//Read an attribute
+		if(tag->attributes < EOF_XML_MAX_ATTRIBUTES)
+		{	//If there's room to record this attribute
+			ap = &tag->attribute[tag->attributes];
+			tag->attributes++;
+		}
+		else
+		{
+			ap = NULL;
+		}
+		end = ptr;
+		while((*end != '\0') && !isspace((unsigned char)*end) && (*end != '=') && (*end != '>') && (*end != '/'))
+		{	//Find the end of the attribute name
+			end++;
+		}
+		if(end == ptr)
+		{	//If this is a stray character, such as a slash that doesn't end the tag, skip it
+			if(ap)
+				tag->attributes--;
+			ptr++;
+			continue;
+		}
+		if(ap)
+		{
+			ap->name = ptr;
+			ap->namelen = (size_t)(end - ptr);
+			ap->value = end;
+			ap->valuelen = 0;
+		}
+		ptr = end;
+		while(isspace((unsigned char)*ptr))
+		{
+			ptr++;
+		}
+		if(*ptr != '=')
+			continue;	//This attribute has no value
+		ptr++;
+		while(isspace((unsigned char)*ptr))
+		{
+			ptr++;
+		}
+		if((*ptr == '\"') || (*ptr == '\''))
+		{	//If the value is quoted
+			quote = *ptr;
+			ptr++;
+			end = strchr(ptr, quote);
+			if(!end)
+				end = ptr + strlen(ptr);	//The value ends where the text ends
+		}
+		else
+		{	//Unquoted values end at whitespace or the end of the tag
+			end = ptr;
+			while((*end != '\0') && !isspace((unsigned char)*end) && (*end != '>'))
+			{
+				end++;
+			}
+			quote = 0;
+		}
+		if(ap)
+		{
+			ap->value = ptr;
+			ap->valuelen = (size_t)(end - ptr);
+		}
+		ptr = end;
+		if(quote && (*ptr == quote))
+			ptr++;	//Skip the closing quotation mark
+	}
+
+	tag->content = ptr;
+	tag->contentlen = strcspn(ptr, "<");
+
+	return ptr;
+}
+
+char *eof_xml_find_tag(char *input, const char *name, EOF_XML_TAG *tag)
+{
+	char *ptr = input;
+
+	while((ptr = eof_xml_next_tag(ptr, tag)) != NULL)
+	{	//For each tag in the text
+		if(!tag->closing && eof_xml_tag_is(tag, name))
+			return ptr;
+	}
+
+	return NULL;
+}
+
+int eof_xml_tag_is(EOF_XML_TAG *tag, const char *name)
+{
+	if(!tag || !tag->name || !name)
+		return 0;
+
+	return eof_xml_name_matches(tag->name, tag->namelen, name);
+}
+
+EOF_XML_ATTRIBUTE *eof_xml_find_attribute(EOF_XML_TAG *tag, const char *name)
+{
+	unsigned long ctr;
+
+	if(!tag || !name)
+		return NULL;
+
+	for(ctr = 0; ctr < tag->attributes; ctr++)
+	{	//For each of the tag's attributes
+		if(eof_xml_name_matches(tag->attribute[ctr].name, tag->attribute[ctr].namelen, name))
+			return &tag->attribute[ctr];
+	}
+
+	return NULL;
+}
+
+int eof_xml_attribute_text(EOF_XML_TAG *tag, const char *name, char *buffer, size_t size)
+{
+	EOF_XML_ATTRIBUTE *ap;
+	size_t length;
+
+	if(!buffer || !size)
+		return 0;	//Invalid parameters
+
+	ap = eof_xml_find_attribute(tag, name);
+	if(!ap)
+		return 0;	//The attribute is not present
+
+	length = (ap->valuelen < size - 1) ? ap->valuelen : size - 1;
+	memcpy(buffer, ap->value, length);
+	buffer[length] = '\0';
+
+	return 1;
+}
+
+int eof_xml_attribute_number(EOF_XML_TAG *tag, const char *name, long *output)
+{
+	char buffer[11];
+
+	if(!output || !eof_xml_attribute_text(tag, name, buffer, sizeof(buffer)))
+		return 0;
+
+	*output = atol(buffer);
+	return 1;
+}
+
+int eof_xml_attribute_rs_timestamp(EOF_XML_TAG *tag, const char *name, long *output)
+{
+	char buffer[11], padded[11], *fraction;
+	long wholeseconds, milliseconds = 0;
+	size_t length;
+
+	if(!output || !eof_xml_attribute_text(tag, name, buffer, sizeof(buffer)))
+		return 0;
+
+	fraction = strrchr(buffer, '.');
+	if(fraction)
+	{	//If there is a decimal point, the whole seconds are the digits before it (after any earlier decimal point) and the milliseconds are the digits after it
+		*fraction = '\0';
+		fraction++;
+		wholeseconds = atol(strrchr(buffer, '.') ? strrchr(buffer, '.') + 1 : buffer);
+		length = strlen(fraction);
+		memcpy(padded, fraction, length);
+		while(length < 3)
+		{	//Pad fractions with fewer than three decimal places with zeros so they convert to milliseconds
+			padded[length++] = '0';
+		}
+		padded[length] = '\0';
+		milliseconds = atol(padded);
+	}
+	else
+	{
+		wholeseconds = atol(buffer);
+	}
+
+	*output = (wholeseconds * 1000) + milliseconds;
+	return 1;
+}
+
 int eof_number_is_power_of_two(unsigned long value)
 {
 	unsigned long mask, count;
@@ -567,3 +1157,219 @@ int eof_number_is_power_of_two(unsigned long value)
 
 	return 0;
 }
+
+double eof_get_wall_time(void)
+{
+	struct timespec now;
+
+	if(clock_gettime(CLOCK_MONOTONIC, &now))
+		return 0.0;
+
+	return (double)now.tv_sec + ((double)now.tv_nsec / 1000000000.0);
+}
+
+int eof_cpu_count(void)
+{
+	#ifdef ALLEGRO_WINDOWS
+		SYSTEM_INFO info;
+
+		GetSystemInfo(&info);
+		if(info.dwNumberOfProcessors > 0)
+			return (int) info.dwNumberOfProcessors;
+	#else
+		long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+		if(count > 0)
+			return (int) count;
+	#endif
+
+	return 1;
+}
+
+typedef struct
+{
+	EOF_WORK_POOL *pool;
+	pthread_mutex_t lock;			//Protects the below counters, which are shared by all worker threads
+	unsigned long next_item;		//The first item of the next range that hasn't been claimed by a worker thread
+	unsigned long items_completed;	//The number of items that worker threads have finished processing
+	unsigned long workers_running;	//The number of worker threads that haven't exited yet
+	volatile int cancel;			//Set to nonzero to signal all worker threads to stop at their next cancellation check
+	int error;						//Set to nonzero if any call to the work function failed
+} EOF_WORK_QUEUE;
+
+typedef struct
+{
+	EOF_WORK_QUEUE *queue;			//The work queue this worker claims item ranges from
+	void *worker;					//This worker's entry in the pool's worker array
+	pthread_t thread;
+} EOF_WORK_THREAD;
+
+static void *eof_work_pool_thread(void *arg)
+{
+	EOF_WORK_THREAD *thread = (EOF_WORK_THREAD *)arg;
+	EOF_WORK_QUEUE *queue;
+	EOF_WORK_POOL *pool;
+	unsigned long first_item, end_item;
+	int status;
+
+	if(!thread || !thread->queue)
+		return NULL;	//Invalid parameter
+
+	queue = thread->queue;
+	pool = queue->pool;
+	while(!queue->cancel)
+	{	//Until the supervisor signals to stop
+		//Claim the next range of items
+		(void) pthread_mutex_lock(&queue->lock);
+		first_item = queue->next_item;
+		end_item = first_item + pool->range_size;
+		if(end_item > pool->end_item)
+			end_item = pool->end_item;
+		if(first_item < end_item)
+			queue->next_item = end_item;
+		(void) pthread_mutex_unlock(&queue->lock);
+		if(first_item >= end_item)
+			break;	//All items have been claimed
+
+		status = pool->function(pool->context, thread->worker, first_item, end_item, &queue->cancel);
+		if(status)
+		{	//If the items failed to process or the supervisor canceled
+			if(status == 1)
+			{
+				(void) pthread_mutex_lock(&queue->lock);
+				queue->error = 1;
+				(void) pthread_mutex_unlock(&queue->lock);
+				queue->cancel = 1;	//Signal the other worker threads to stop, since the work will fail
+			}
+			break;
+		}
+
+		(void) pthread_mutex_lock(&queue->lock);
+		queue->items_completed += end_item - first_item;
+		(void) pthread_mutex_unlock(&queue->lock);
+	}
+
+	(void) pthread_mutex_lock(&queue->lock);
+	queue->workers_running--;
+	(void) pthread_mutex_unlock(&queue->lock);
+
+	return NULL;
+}
+
+int eof_work_pool_run(EOF_WORK_POOL *pool)
+{
+	EOF_WORK_QUEUE queue;
+	EOF_WORK_THREAD *threads;
+	unsigned long ctr, items_completed, workers_running, total_items, started = 0;
+	char windowtitle[101] = {0};
+	int canceled = 0;
+
+	if(!pool || !pool->function || !pool->workers || !pool->worker_size || !pool->worker_count || (pool->first_item > pool->end_item))
+		return 1;	//Invalid parameters
+
+	pool->workers_used = 0;
+	pool->items_completed = 0;
+	if(!pool->range_size)
+		pool->range_size = 1;
+	total_items = pool->end_item - pool->first_item;
+
+	//Initialize work queue
+	if(pthread_mutex_init(&queue.lock, NULL))
+	{
+		eof_log("\tCould not initialize work queue", 1);
+		return 1;	//Return failure
+	}
+	queue.pool = pool;
+	queue.next_item = pool->first_item;
+	queue.items_completed = 0;
+	queue.workers_running = 0;
+	queue.cancel = 0;
+	queue.error = 0;
+
+	threads = malloc(sizeof(EOF_WORK_THREAD) * pool->worker_count);
+	if(!threads)
+	{
+		(void) pthread_mutex_destroy(&queue.lock);
+		eof_log("\tFailed to allocate memory", 1);
+		return 1;	//Return failure
+	}
+	for(ctr = 0; ctr < pool->worker_count; ctr++)
+	{	//For each worker entry
+		threads[ctr].queue = &queue;
+		threads[ctr].worker = (char *)pool->workers + (ctr * pool->worker_size);
+	}
+
+	//Start the worker threads
+	for(ctr = 0; ctr < pool->worker_count; ctr++)
+	{	//For each worker entry
+		(void) pthread_mutex_lock(&queue.lock);
+		queue.workers_running++;
+		(void) pthread_mutex_unlock(&queue.lock);
+		if(pthread_create(&threads[ctr].thread, NULL, eof_work_pool_thread, &threads[ctr]))
+		{	//If the thread couldn't be created
+			(void) pthread_mutex_lock(&queue.lock);
+			queue.workers_running--;
+			(void) pthread_mutex_unlock(&queue.lock);
+			break;	//Use the worker threads that were created
+		}
+		started++;
+	}
+
+	if(!started)
+	{	//If no worker threads could be created at all
+		if(pool->inline_fallback)
+		{	//Process all items in this thread instead
+			eof_log("\tCould not start worker threads, processing in a single thread", 1);
+			queue.workers_running = 1;
+			(void) eof_work_pool_thread(&threads[0]);
+			pool->workers_used = 1;
+		}
+		else
+		{
+			eof_log("\tCould not start worker threads", 1);
+			queue.error = 1;
+		}
+	}
+
+	//Update the title bar and check for user cancellation until the worker threads finish
+	while(started)
+	{
+		(void) pthread_mutex_lock(&queue.lock);
+		items_completed = queue.items_completed;
+		workers_running = queue.workers_running;
+		(void) pthread_mutex_unlock(&queue.lock);
+		if(!workers_running)
+			break;	//All worker threads have exited
+
+		if(!canceled)
+		{
+			(void) snprintf(windowtitle, sizeof(windowtitle) - 1, "%s with %lu threads (%lu%%)- Press Esc to cancel", pool->title ? pool->title : "Processing", workers_running, total_items ? items_completed * 100 / total_items : 100);
+			set_window_title(windowtitle);	//Update the title bar
+			if(key[KEY_ESC] || eof_close_button_clicked)
+			{	//Allow user to cancel, considering clicking the close window control a cancellation
+				eof_close_button_clicked = 0;
+				canceled = 1;
+				queue.cancel = 1;	//Signal the worker threads to stop
+				set_window_title("Waiting for worker threads to stop...");
+			}
+		}
+		Idle(10);
+	}
+	for(ctr = 0; ctr < started; ctr++)
+	{	//For each worker thread that was created
+		(void) pthread_join(threads[ctr].thread, NULL);
+	}
+	if(started)
+		pool->workers_used = started;
+	pool->items_completed = queue.items_completed;
+
+	free(threads);
+	(void) pthread_mutex_destroy(&queue.lock);
+
+	if(queue.error)
+		return 1;	//Return error
+	if(canceled)
+		return 2;	//Return cancellation
+
+	return 0;	//Return success
+}
@@ -47,7 +47,131 @@ PACKFILE *eof_pack_fopen_retry(const char *filename, const char *mode, unsigned
 	//Attempts to open the specified file in the specified mode up to [count] number of times, with a 1ms delay between each attempt
 	//If any attempts succeed, the PACKFILE handle is returned, otherwise if all attempts fail, NULL is returned
 
+typedef struct
+{
+	unsigned char *buffer;	//The memory buffer holding the file's data
+	unsigned long size;		//The number of bytes of data in the buffer
+	unsigned long capacity;	//The number of bytes allocated for the buffer
+	unsigned long pos;		//The current read/write position
+	int error;				//Set to nonzero if a write failed because the buffer couldn't be grown, reported through pack_ferror()
+} EOF_MEMORY_FILE;
+
+PACKFILE *eof_pack_fopen_memory(EOF_MEMORY_FILE *mf);
+	//Returns a PACKFILE handle that reads from and writes to the specified memory file, growing its buffer as needed during writes
+	//The memory file's position and error flag are reset.  Closing the PACKFILE does not release the buffer
+	//Returns NULL on error
+void eof_memory_file_free(EOF_MEMORY_FILE *mf);
+	//Releases the buffer of the specified memory file and resets its size, capacity, position and error flag to 0
+int eof_memory_file_save(EOF_MEMORY_FILE *mf, const char *fn);
+	//Writes the contents of the specified memory file to the specified file.  Returns 0 on error, including if the memory file's error flag is set
+int eof_memory_file_load(EOF_MEMORY_FILE *mf, const char *fn);
+	//Replaces the contents of the specified memory file with the entire contents of the specified file.  Returns 0 on error
+EOF_MEMORY_FILE *eof_pack_memory_file(PACKFILE *fp);
+	//Returns the memory file that the specified PACKFILE was opened on with eof_pack_fopen_memory(), or NULL if it is any other kind of PACKFILE
+	//Memory PACKFILEs aren't buffered, so the memory file's pos is the PACKFILE's current offset and may be changed to seek in either direction
+
+typedef struct
+{
+	char *data;			//The file's contents, followed by a NULL terminator
+	size_t size;		//The number of bytes of file content in data[]
+	size_t pos;			//The offset of the next unread byte in data[]
+	char *convert;		//Receives lines that have to be converted to the current text format
+	size_t convertsize;	//The number of bytes allocated for convert[]
+} EOF_TEXT_FILE;
+
+EOF_TEXT_FILE *eof_text_fopen(const char *fn);
+	//Reads the specified file into memory so its lines can be parsed with eof_text_fgets() in a single pass,
+	// instead of scanning it with FindLongestLineLength_ALLEGRO() and reading it again with pack_fgets()
+	//Returns NULL on error
+char *eof_text_fgets(EOF_TEXT_FILE *fp);
+	//Returns the next line of the file with its line ending (CR, LF or CR+LF) removed, as pack_fgets() would
+	//ASCII lines are terminated and returned in place in the file's buffer, other lines are converted to the current text format in fp->convert
+	//The returned string may be modified by the calling function and remains valid until the next call
+	//If the conversion buffer can't be allocated, the line is returned unconverted
+	//An empty string is returned once the end of the file is reached, or NULL if fp is invalid
+int eof_text_feof(EOF_TEXT_FILE *fp);
+	//Returns nonzero if every line of the file has been read, as pack_feof() would
+void eof_text_fclose(EOF_TEXT_FILE *fp);
+	//Releases the specified text file and its buffers
+
+#define EOF_XML_MAX_ATTRIBUTES 32	//The most attributes eof_xml_next_tag() records for one tag, any beyond this are skipped
+
+typedef struct
+{
+	char *name;			//Points to the attribute name within the tokenized text, it is not terminated
+	size_t namelen;
+	char *value;		//Points to the attribute value (without its quotation marks) within the tokenized text, it is not terminated
+	size_t valuelen;
+} EOF_XML_ATTRIBUTE;
+
+typedef struct
+{
+	char *name;			//Points to the tag name (without the leading slash of a closing tag) within the tokenized text, it is not terminated
+	size_t namelen;
+	char closing;		//Nonzero if this is a closing tag, ie. </notes>
+	char empty;			//Nonzero if this is an empty element tag, ie. <notes count="0" />
+	EOF_XML_ATTRIBUTE attribute[EOF_XML_MAX_ATTRIBUTES];
+	unsigned long attributes;
+	char *content;		//Points to the text following the tag up to the next tag or the end of the tokenized text, it is not terminated
+	size_t contentlen;
+} EOF_XML_TAG;
+
+char *eof_xml_next_tag(char *input, EOF_XML_TAG *tag);
+	//Tokenizes the first XML tag at or after input into *tag without copying or altering the text, so the tag's fields point into input
+	//Single and double quoted attribute values are recognized, attributes without a value are given an empty one
+	//A tag that isn't closed before the end of the text (ie. one that continues on the next line of the file) ends where the text ends
+	//Returns a pointer to the text after the tag so that the next call finds the following tag, or NULL if there are no more tags (in which case *tag is cleared)
+char *eof_xml_find_tag(char *input, const char *name, EOF_XML_TAG *tag);
+	//Tokenizes the tags in input in turn until an opening or empty element tag with the specified name (case insensitive) is found
+	//Returns a pointer to the text after that tag (its content), or NULL if no such tag is found
+int eof_xml_tag_is(EOF_XML_TAG *tag, const char *name);
+	//Returns nonzero if the tag has the specified name (case insensitive), whether it is an opening or closing tag
+EOF_XML_ATTRIBUTE *eof_xml_find_attribute(EOF_XML_TAG *tag, const char *name);
+	//Returns the tag's attribute with the specified name (case insensitive), or NULL if the tag doesn't have it
+int eof_xml_attribute_text(EOF_XML_TAG *tag, const char *name, char *buffer, size_t size);
+	//Copies the value of the specified attribute to buffer, which is always terminated, truncating it to size - 1 characters
+	//Returns 1 on success or 0 if the tag doesn't have the attribute
+int eof_xml_attribute_number(EOF_XML_TAG *tag, const char *name, long *output);
+	//Reads the value of the specified attribute as a number into *output the same way parse_xml_attribute_number() does
+	//Returns 1 on success, otherwise *output isn't changed and 0 is returned
+int eof_xml_attribute_rs_timestamp(EOF_XML_TAG *tag, const char *name, long *output);
+	//Reads the value of the specified attribute as a Rocksmith timestamp in seconds into *output in milliseconds, the same way parse_xml_rs_timestamp() does
+	//Returns 1 on success, otherwise *output isn't changed and 0 is returned
+
 int eof_number_is_power_of_two(unsigned long value);
 	//Returns nonzero if the specified value is any power of two from 2^0 through 2^31
 
+double eof_get_wall_time(void);
+	//Returns the number of seconds elapsed on a monotonic clock, for timing operations in elapsed real time
+	//Unlike clock(), this isn't affected by the CPU time of other threads or by time spent waiting on I/O
+
+int eof_cpu_count(void);
+	//Returns the number of processors available to the program, or 1 if that can't be determined
+
+typedef int (*EOF_WORK_FUNCTION)(void *context, void *worker, unsigned long first_item, unsigned long end_item, volatile int *cancel);
+	//Processes items first_item through end_item - 1 using the given worker structure and the shared context, both of which are defined by the caller of eof_work_pool_run()
+	//Long running work functions should stop and return 2 once *cancel becomes nonzero
+	//Returns 0 on success, 1 on error (which signals the other workers to stop) or 2 if the work was stopped due to cancellation
+
+typedef struct
+{
+	EOF_WORK_FUNCTION function;		//The function each worker thread calls on the ranges of items it claims
+	void *context;					//Passed to every call of the work function, this should only be read by the workers
+	void *workers;					//An array of worker_count structures of worker_size bytes each, one of which is given to each worker thread for its own state
+	size_t worker_size;
+	unsigned long worker_count;		//The maximum number of worker threads to run
+	unsigned long first_item;		//The first item number to process
+	unsigned long end_item;			//One higher than the last item number to process
+	unsigned long range_size;		//The number of items a worker thread claims at a time
+	const char *title;				//Describes the work for the title bar progress display, ie. "Generating Spectrogram"
+	char inline_fallback;			//If nonzero and no worker thread can be created, the first worker structure is used to process all items in the calling thread instead of this being an error
+	unsigned long workers_used;		//Set by eof_work_pool_run() to the number of worker structures (from the beginning of the array) that were given to a worker
+	unsigned long items_completed;	//Set by eof_work_pool_run() to the number of items that were processed
+} EOF_WORK_POOL;
+
+int eof_work_pool_run(EOF_WORK_POOL *pool);
+	//Runs up to pool->worker_count worker threads, each of which repeatedly claims the next pool->range_size items and passes them to the work function
+	//The calling thread updates the title bar with the progress until the workers finish, and the user can cancel with the Escape key or the close window control
+	//Returns 0 on success, 1 on error or 2 if the user canceled
+
 #endif
@@ -4,6 +4,7 @@
 #include "waveform.h"
 #include "song.h"
 #include "main.h"
+#include "pcm.h"
 
 #ifdef USEMEMWATCH
 #include "memwatch.h"
@@ -12,13 +13,27 @@
 struct wavestruct *eof_waveform = NULL;	//Stores the waveform data
 char eof_display_waveform = 0;			//Specifies whether the waveform display is enabled
 
+static unsigned long eof_waveform_level_count(struct wavestruct *waveform, unsigned long level, unsigned long index)
+{	//Returns the number of slices represented by the specified entry of the specified pyramid level, since the last entry of a level may be a partial group
+	unsigned long first = index << level;
+	unsigned long count = 1UL << level;
+
+	if(first >= waveform->numslices)
+		return 0;
+	if(first + count > waveform->numslices)
+		return waveform->numslices - first;
+	return count;
+}
+
 int eof_waveform_slice_mean(struct waveformslice *left, struct waveformslice *right, struct wavestruct *waveform, unsigned long slicestart, unsigned long num)
 {
 // 	eof_log("eof_waveform_slice_mean() entered");
 
-	unsigned long ctr, ctr2;
+	unsigned long ctr, pos, end, level, count, nodecount;
+	double minsum, peaksum, rmssum;
 	struct waveformslice *results;
-	struct waveformslice *channel = NULL;
+	struct waveformchanneldata *channel = NULL;
+	struct waveformslice *node;
 
 //Validate parameters
 	if(waveform == NULL)
@@ -32,12 +47,12 @@ int eof_waveform_slice_mean(struct waveformslice *left, struct waveformslice *ri
 	{	//For each possible channel
 		if((ctr == 0) && (left != NULL) && (waveform->left.slices))
 		{	//If this is the left channel, its processing is enabled and there is waveform data for this channel
-			channel = waveform->left.slices;	//Point to left channel data
+			channel = &waveform->left;	//Point to left channel data
 			results = left;
 		}
 		else if((ctr == 1) && (right != NULL) && (waveform->right.slices))
 		{	//Or if this is the right channel, its processing is enabled and there is waveform data for this channel
-			channel = waveform->right.slices;	//Point to right channel data
+			channel = &waveform->right;	//Point to right channel data
 			results = right;
 		}
 		else
@@ -45,35 +60,97 @@ int eof_waveform_slice_mean(struct waveformslice *left, struct waveformslice *ri
 			continue;
 		}
 		results->min = results->peak = results->rms = 0;	//Reset this channel's result data
+		if(!num)
+			continue;
+		if(slicestart >= waveform->numslices)
+		{	//If the first amplitude is unavailable,
+			results->min = results ->peak = results->rms = waveform->zeroamp;	//Set it to a 0dB amplitude
+			continue;
+		}
 
-		for(ctr2 = 0; ctr2 < num; ctr2++)
-		{	//For each requested waveform slice, add the data
-			if(slicestart + ctr2 + 1 > waveform->numslices)	//If the next slice to process doesn't exist
-			{
-				if(ctr2 == 0)	//If the first amplitude is unavailable,
-					results->min = results ->peak = results->rms = waveform->zeroamp;	//Set it to a 0dB amplitude
-
-				break;					//exit this loop
+		end = slicestart + num;
+		if(end > waveform->numslices)
+			end = waveform->numslices;	//Only slices that exist are averaged
+		count = end - slicestart;
+		minsum = peaksum = rmssum = 0.0;
+		for(pos = slicestart; pos < end; pos += nodecount)
+		{	//Add the largest aligned group of slices that starts at this position and doesn't extend past the range
+			for(level = 0; level + 1 < channel->numlevels; level++)
+			{	//Check whether the next larger group would still fit, the last group of a level is partial so it fits if the range extends to the last slice
+				if((pos & ((2UL << level) - 1)) || ((pos + (2UL << level) > end) && (end != waveform->numslices)))
+					break;
 			}
-
-			results->min += channel[slicestart + ctr2].min;
-			results->peak += channel[slicestart + ctr2].peak;
-			results->rms += channel[slicestart + ctr2].rms;
+			node = level ? &channel->levels[level][pos >> level] : &channel->slices[pos];
+			nodecount = eof_waveform_level_count(waveform, level, pos >> level);
+			minsum += (double)node->min * nodecount;
+			peaksum += (double)node->peak * nodecount;
+			rmssum += node->rms * nodecount;
 		}
 
-		if(ctr2 > 1)
-		{	//If at least two slices' data was added, calculate the mean, round up
-			results->min = ((double)results->min / ctr2 + 0.5);
-			results->peak = ((double)results->peak / ctr2 + 0.5);
-			results->rms = ((double)results->rms / ctr2 );
-		}
+		//Calculate the mean, round up
+		results->min = (minsum / count + 0.5);
+		results->peak = (peaksum / count + 0.5);
+		results->rms = (rmssum / count);
 	}
 
 	return 0;	//Return success
 }
 
+void eof_build_waveform_levels(struct wavestruct *waveform)
+{
+	unsigned long ctr, level, index, nodes, prevnodes;
+	double weight1, weight2;
+	struct waveformchanneldata *channel;
+	struct waveformslice *prev, *dest;
+
+	if(!waveform)
+		return;
+
+	for(ctr = 0; ctr <= waveform->is_stereo; ctr++)
+	{	//For each channel in the audio
+		channel = ctr ? &waveform->right : &waveform->left;
+		if(!channel->slices)
+			continue;
+
+		channel->numlevels = 1;	//Level 0 is the slice data itself
+		prev = channel->slices;
+		nodes = waveform->numslices;
+		for(level = 1; (nodes > 1) && (level < EOF_WAVEFORM_MAX_LEVELS); level++)
+		{	//Until a level with only one entry is built
+			prevnodes = nodes;
+			nodes = (prevnodes + 1) / 2;
+			dest = (struct waveformslice *)malloc(sizeof(struct waveformslice) * nodes);
+			if(!dest)
+			{
+				eof_log("Waveform: Unable to allocate memory for the waveform levels", 1);
+				break;	//Rendering will use the levels that were built
+			}
+			for(index = 0; index < nodes; index++)
+			{	//For each entry in this level, combine the two entries below it, weighting each by the number of slices it represents
+				weight1 = eof_waveform_level_count(waveform, level - 1, index * 2);
+				weight2 = (index * 2 + 1 < prevnodes) ? eof_waveform_level_count(waveform, level - 1, index * 2 + 1) : 0.0;
+				if(weight2 > 0.0)
+				{
+					dest[index].min = ((prev[index * 2].min * weight1 + prev[index * 2 + 1].min * weight2) / (weight1 + weight2) + 0.5);
+					dest[index].peak = ((prev[index * 2].peak * weight1 + prev[index * 2 + 1].peak * weight2) / (weight1 + weight2) + 0.5);
+					dest[index].rms = (prev[index * 2].rms * weight1 + prev[index * 2 + 1].rms * weight2) / (weight1 + weight2);
+				}
+				else
+				{	//The last entry of an odd sized level has no pair
+					dest[index] = prev[index * 2];
+				}
+			}
+			channel->levels[level] = dest;
+			channel->numlevels++;
+			prev = dest;
+		}
+	}
+}
+
 void eof_destroy_waveform(struct wavestruct *ptr)
 {
+	unsigned long ctr;
+
  	eof_log("eof_destroy_waveform() entered", 1);
 
 	if(ptr)
@@ -84,6 +161,13 @@ void eof_destroy_waveform(struct wavestruct *ptr)
 			free(ptr->left.slices);
 		if(ptr->right.slices)
 			free(ptr->right.slices);
+		for(ctr = 1; ctr < EOF_WAVEFORM_MAX_LEVELS; ctr++)
+		{	//For each level above the slice data
+			if(ptr->left.levels[ctr])
+				free(ptr->left.levels[ctr]);
+			if(ptr->right.levels[ctr])
+				free(ptr->right.levels[ctr]);
+		}
 		free(ptr);
 	}
 
@@ -274,9 +358,8 @@ void eof_render_waveform_line(unsigned int zeroamp, struct waveformchanneldata *
 
 struct wavestruct *eof_create_waveform(char *oggfilename, unsigned long slicelength)
 {
-	ALOGG_OGG *oggstruct = NULL;
+	EOF_PCM_CACHE_ENTRY *pcm = NULL;
 	SAMPLE *audio = NULL;
-	void * oggbuffer = NULL;
 	struct wavestruct *waveform = NULL;
 	static struct wavestruct emptywaveform;	//all variables in this auto initialize to value 0
 	char done = 0;	//-1 on unsuccessful completion, 1 on successful completion
@@ -293,27 +376,13 @@ struct wavestruct *eof_create_waveform(char *oggfilename, unsigned long slicelen
 		return NULL;
 	}
 
-//Load OGG file into memory
-	oggbuffer = eof_buffer_file(oggfilename, 0);
-	if(!oggbuffer)
-	{
-		(void) snprintf(eof_log_string, sizeof(eof_log_string) - 1, "Waveform: Failed to open input audio file: %s",strerror(errno));
-		eof_log(eof_log_string, 1);
-		return NULL;
-	}
-	oggstruct = alogg_create_ogg_from_buffer(oggbuffer, (int)file_size_ex(oggfilename));
-	if(oggstruct == NULL)
-	{
-		eof_log("Waveform: ALOGG failed to open input audio file", 1);
-		free(oggbuffer);
-		return NULL;
-	}
-
-//Decode OGG into memory
-	audio = alogg_create_sample_from_ogg(oggstruct);
+//Obtain the decoded audio, which is shared with the spectrogram and other analysis functions
+	pcm = eof_pcm_cache_acquire(oggfilename);
+	if(pcm)
+		audio = pcm->audio;
 	if(audio == NULL)
 	{
-		eof_log("Waveform: ALOGG failed to decode input audio file", 1);
+		eof_log("Waveform: Failed to decode input audio file", 1);
 		done = -1;
 	}
 	else if((audio->bits != 8) && (audio->bits != 16))	//This logic currently only supports 8 and 16 bit audio
@@ -334,7 +403,7 @@ struct wavestruct *eof_create_waveform(char *oggfilename, unsigned long slicelen
 		{
 			*waveform = emptywaveform;					//Set all variables to value zero
 			waveform->slicelength = slicelength;
-			if(alogg_get_wave_is_stereo_ogg(oggstruct))	//If this audio file has two audio channels
+			if(audio->stereo)	//If this audio file has two audio channels
 				waveform->is_stereo = 1;
 			else
 				waveform->is_stereo = 0;
@@ -386,10 +455,7 @@ struct wavestruct *eof_create_waveform(char *oggfilename, unsigned long slicelen
 	}
 
 //Cleanup
-	alogg_destroy_ogg(oggstruct);
-	if(audio != NULL)
-		destroy_sample(audio);
-	free(oggbuffer);
+	eof_pcm_cache_release(pcm);
 	if(done == -1)	//Unsuccessful completion
 	{
 		if(waveform)
@@ -398,7 +464,7 @@ struct wavestruct *eof_create_waveform(char *oggfilename, unsigned long slicelen
 				free(waveform->oggfilename);
 			free(waveform);
 		}
-		allegro_message("Failed to generate waveform.  See log for details");
+		eof_message("Failed to generate waveform.  See log for details");
 		return NULL;	//Return error
 	}
 
@@ -414,6 +480,7 @@ struct wavestruct *eof_create_waveform(char *oggfilename, unsigned long slicelen
 		else
 			waveform->right.maxampoffset = waveform->zeroamp - waveform->right.maxamp;
 	}
+	eof_build_waveform_levels(waveform);	//Allow the graph to be rendered at any zoom level without averaging more than a few entries per column
 
 	eof_log("\tWaveform generated", 1);
 	return waveform;	//Return waveform data
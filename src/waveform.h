@@ -1,6 +1,8 @@
 #ifndef EOF_WAVEFORM_H
 #define EOF_WAVEFORM_H
 
+#define EOF_WAVEFORM_MAX_LEVELS 32	//The maximum number of levels in each channel's pyramid of slice means
+
 struct waveformslice
 {
 	unsigned min;	//The trough (lowest) amplitude for the samples
@@ -11,6 +13,8 @@ struct waveformslice
 struct waveformchanneldata
 {
 	struct waveformslice *slices;	//The waveform data for this channel
+	struct waveformslice *levels[EOF_WAVEFORM_MAX_LEVELS];	//levels[n] holds the mean of each aligned group of 2^n slices, levels[0] is unused since that is the slices array itself
+	unsigned long numlevels;		//The number of levels available, including level 0
 	unsigned maxamp;				//The highest amplitude of samples in this channel
 	unsigned long maxampoffset;		//The difference between the zero amplitude and the channel's maximum amplitude (cached to optimize rendering)
 	unsigned long yaxis;			//The y coordinate representing the y axis the channel's graph will render to
@@ -42,7 +46,11 @@ void eof_destroy_waveform(struct wavestruct *ptr);
 int eof_waveform_slice_mean(struct waveformslice *left, struct waveformslice *right, struct wavestruct *waveform, unsigned long slicestart, unsigned long num);
 	//performs a mathematical mean on the specified waveform slice data, returning the results via left and right if they aren't NULL, which will hold the values for the left and right channels, respectively.
 	//slice numbering begins with 0
+	//The range is added as the fewest aligned power of two groups of slices from each channel's levels, so the cost doesn't grow with num
 	//returns nonzero on error
+void eof_build_waveform_levels(struct wavestruct *waveform);
+	//Builds each channel's levels[] pyramid from its slice data, so that the mean of any range of slices can be found from a few entries
+	//If memory for a level can't be allocated, the pyramid stops at the levels that were built
 int eof_render_waveform(struct wavestruct *waveform);
 	//Renders the left channel waveform into the editor window, taking the zoom level into account
 	//Returns nonzero on failure
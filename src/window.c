@@ -22,6 +22,7 @@ EOF_WINDOW * eof_window_create(int x, int y, int w, int h, BITMAP * bp)
 		wp->w = w;
 		wp->h = h;
 		wp->screen = create_sub_bitmap(bp, x, y, w, h);
+		wp->dirty = 1;	//A new window always has to be rendered
 	}
 	return wp;
 }
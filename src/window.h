@@ -9,6 +9,7 @@ typedef struct
 	int x, y;
 	int w, h;
 	BITMAP * screen;
+	int dirty;	//Nonzero if the window's contents have to be re-rendered, otherwise eof_render_damaged() reuses what was drawn to its bitmap in the previous frame
 
 } EOF_WINDOW;
 